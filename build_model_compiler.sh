@@ -0,0 +1,25 @@
+#!/bin/bash
+# build_model_compiler.sh
+# Builds util/model_compiler, which turns model.yaml and the PCB pick-and-place file into model.h and model.bin.
+
+OUTPUT_DIR=${1:-"build"}
+mkdir -p "$OUTPUT_DIR"
+
+# Only the blob format and the k-d tree are needed, so no Eigen
+CPP_FILES="lib/PixelTheater/src/model/model_blob.cpp lib/PixelTheater/src/model/kd_tree.cpp"
+
+echo "Building model compiler to: $OUTPUT_DIR/model_compiler"
+
+${CXX:-g++} ${CPP_FILES} util/model_compiler/model_compiler.cpp \
+     -I"lib/PixelTheater/include" \
+     -std=gnu++17 \
+     -O2 \
+     -DPLATFORM_NATIVE \
+     -o "$OUTPUT_DIR/model_compiler"
+
+if [ $? -eq 0 ]; then
+  echo "Build complete: $OUTPUT_DIR/model_compiler"
+else
+  echo "Build failed"
+  exit 1
+fi
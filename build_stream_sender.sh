@@ -0,0 +1,37 @@
+#!/bin/bash
+# build_stream_sender.sh
+# Builds util/stream_sender, the host-side frame streamer for StreamReceiverScene.
+
+OUTPUT_DIR=${1:-"build"}
+mkdir -p "$OUTPUT_DIR"
+
+# Eigen comes from the PlatformIO native env if it has been installed, else the system
+EIGEN_DIR=".pio/libdeps/native/ArduinoEigen/ArduinoEigen"
+if [ ! -d "$EIGEN_DIR" ]; then
+  EIGEN_DIR="/usr/include/eigen3"
+fi
+
+CPP_FILES=$(find lib/PixelTheater/src src/scenes -name '*.cpp' \
+                -not -path '*/webgl/*' \
+                -not -name 'web_platform.cpp')
+
+echo "Building stream sender to: $OUTPUT_DIR/stream_sender"
+
+${CXX:-g++} ${CPP_FILES} src/benchmark.cpp util/stream_sender/stream_sender.cpp \
+     -I"lib/PixelTheater/include" \
+     -I"src" \
+     -I"src/models" \
+     -I"include" \
+     -I"$EIGEN_DIR" \
+     -std=gnu++17 \
+     -O2 \
+     -DPLATFORM_NATIVE \
+     -pthread \
+     -o "$OUTPUT_DIR/stream_sender"
+
+if [ $? -eq 0 ]; then
+  echo "Build complete: $OUTPUT_DIR/stream_sender"
+else
+  echo "Build failed"
+  exit 1
+fi
@@ -0,0 +1,34 @@
+#!/bin/bash
+# build_telemetry_decoder.sh
+# Builds util/telemetry_decoder, which turns the firmware's binary telemetry into CSV or JSON.
+
+OUTPUT_DIR=${1:-"build"}
+mkdir -p "$OUTPUT_DIR"
+
+# Eigen comes from the PlatformIO native env if it has been installed, else the system
+EIGEN_DIR=".pio/libdeps/native/ArduinoEigen/ArduinoEigen"
+if [ ! -d "$EIGEN_DIR" ]; then
+  EIGEN_DIR="/usr/include/eigen3"
+fi
+
+CPP_FILES=$(find lib/PixelTheater/src -name '*.cpp' \
+                -not -path '*/webgl/*' \
+                -not -name 'web_platform.cpp')
+
+echo "Building telemetry decoder to: $OUTPUT_DIR/telemetry_decoder"
+
+${CXX:-g++} ${CPP_FILES} util/telemetry_decoder/telemetry_decoder.cpp \
+     -I"lib/PixelTheater/include" \
+     -I"$EIGEN_DIR" \
+     -std=gnu++17 \
+     -O2 \
+     -DPLATFORM_NATIVE \
+     -pthread \
+     -o "$OUTPUT_DIR/telemetry_decoder"
+
+if [ $? -eq 0 ]; then
+  echo "Build complete: $OUTPUT_DIR/telemetry_decoder"
+else
+  echo "Build failed"
+  exit 1
+fi
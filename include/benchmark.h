@@ -18,29 +18,27 @@
 #include <map>
 #include <string>
 #endif
+#include "PixelTheater/core/cycle_counter.h"
 
 namespace Benchmark {
 
-// Structure to hold benchmark data
+// Structure to hold benchmark data. Times come from the platform's cycle
+// counter (PixelTheater::CycleCounter) with its own overhead subtracted.
 struct BenchmarkData {
-    uint32_t total_time_us = 0;    // Total accumulated time in microseconds
+    uint64_t total_time_ns = 0;    // Total accumulated time in nanoseconds
     uint32_t count = 0;            // Number of times this benchmark has been run
-    uint32_t min_time_us = UINT32_MAX; // Minimum time recorded
-    uint32_t max_time_us = 0;      // Maximum time recorded
+    uint32_t min_time_ns = UINT32_MAX; // Minimum time recorded
+    uint32_t max_time_ns = 0;      // Maximum time recorded
 };
 
-// Global benchmark data storage
-extern std::map<std::string, BenchmarkData> benchmarks;
+// Global benchmark data storage (transparent compare: lookups by name don't build a std::string)
+extern std::map<std::string, BenchmarkData, std::less<>> benchmarks;
 
-// Current active benchmark name
-extern std::string current_benchmark;
+// Current active benchmark name (a string literal from BENCHMARK_START), or nullptr
+extern const char* current_benchmark;
 
-// Start time for current benchmark
-#if defined(PLATFORM_NATIVE) || defined(PLATFORM_WEB)
-extern std::chrono::time_point<std::chrono::high_resolution_clock> benchmark_start_time;
-#else
-extern uint32_t benchmark_start_time;
-#endif
+// Start time for current benchmark, in cycle counter ticks
+extern PixelTheater::CycleCounter::Ticks benchmark_start_time;
 
 // Whether benchmarking is enabled
 extern bool enabled;
@@ -58,45 +56,36 @@ inline uint32_t micros() {
 #endif
 
 // Start a benchmark measurement
-inline void start(const std::string& name) {
+inline void start(const char* name) {
     if (!enabled) return;
     
     current_benchmark = name;
-    #if defined(PLATFORM_NATIVE) || defined(PLATFORM_WEB)
-    benchmark_start_time = std::chrono::high_resolution_clock::now();
-    #else
-    benchmark_start_time = micros();
-    #endif
+    benchmark_start_time = PixelTheater::CycleCounter::now();   // Last, so little else is timed
 }
 
 // End the current benchmark measurement
 inline void end() {
-    if (!enabled || current_benchmark.empty()) return;
+    const PixelTheater::CycleCounter::Ticks end_time = PixelTheater::CycleCounter::now();
+    if (!enabled || !current_benchmark) return;
     
-    uint32_t elapsed;
-    #if defined(PLATFORM_NATIVE) || defined(PLATFORM_WEB)
-    auto end_time = std::chrono::high_resolution_clock::now();
-    elapsed = static_cast<uint32_t>(
-        std::chrono::duration_cast<std::chrono::microseconds>(end_time - benchmark_start_time).count()
-    );
-    #else
-    uint32_t end_time = micros();
-    elapsed = end_time - benchmark_start_time;
-    #endif
+    const uint32_t elapsed = PixelTheater::CycleCounter::elapsedNs(benchmark_start_time, end_time);
     
-    auto& data = benchmarks[current_benchmark];
-    data.total_time_us += elapsed;
+    // Only the first measurement under a name allocates
+    auto it = benchmarks.find(current_benchmark);
+    if (it == benchmarks.end()) it = benchmarks.emplace(current_benchmark, BenchmarkData{}).first;
+    auto& data = it->second;
+    data.total_time_ns += elapsed;
     data.count++;
     
-    if (elapsed < data.min_time_us) {
-        data.min_time_us = elapsed;
+    if (elapsed < data.min_time_ns) {
+        data.min_time_ns = elapsed;
     }
     
-    if (elapsed > data.max_time_us) {
-        data.max_time_us = elapsed;
+    if (elapsed > data.max_time_ns) {
+        data.max_time_ns = elapsed;
     }
     
-    current_benchmark.clear();
+    current_benchmark = nullptr;
 }
 
 // Reset all benchmark data
@@ -115,31 +104,36 @@ inline void report(float fps = 0) {
         return;
     }
     
+    const PixelTheater::CycleCounter::Calibration& timer = PixelTheater::CycleCounter::calibration();
     #if defined(PLATFORM_NATIVE) || defined(PLATFORM_WEB)
     std::cout << "\n----- BENCHMARK REPORT -----" << std::endl;
     if (fps > 0) {
         float frame_time_ms = 1000.0f / fps;
         std::cout << "FPS: " << fps << " (" << frame_time_ms << " ms/frame)" << std::endl;
     }
+    std::cout << "Timer: " << timer.source << ", resolution " << timer.resolution_ns()
+              << " ns, overhead " << timer.overhead_ns() << " ns (subtracted)" << std::endl;
     
-    std::cout << "Name                  | Calls |  Avg (us) |   Min   |   Max   | % Frame" << std::endl;
-    std::cout << "----------------------|-------|-----------|---------|---------|--------" << std::endl;
+    std::cout << "Name                  | Calls |  Avg (us) | Min (us) | Max (us) | % Frame" << std::endl;
+    std::cout << "----------------------|-------|-----------|----------|----------|--------" << std::endl;
     #else
     Serial.println("\n----- BENCHMARK REPORT -----");
     if (fps > 0) {
         float frame_time_ms = 1000.0f / fps;
         Serial.printf("FPS: %.1f (%.2f ms/frame)\n", fps, frame_time_ms);
     }
+    Serial.printf("Timer: %s, resolution %.1f ns, overhead %.1f ns (subtracted)\n",
+        timer.source, timer.resolution_ns(), timer.overhead_ns());
     
-    Serial.println("Name                  | Calls |  Avg (us) |   Min   |   Max   | % Frame");
-    Serial.println("----------------------|-------|-----------|---------|---------|--------");
+    Serial.println("Name                  | Calls |  Avg (us) | Min (us) | Max (us) | % Frame");
+    Serial.println("----------------------|-------|-----------|----------|----------|--------");
     #endif
     
     for (const auto& entry : benchmarks) {
         const auto& name = entry.first;
         const auto& data = entry.second;
         
-        float avg_time = data.count > 0 ? (float)data.total_time_us / data.count : 0;
+        float avg_time = data.count > 0 ? (float)data.total_time_ns / data.count / 1000.0f : 0;
         float percent = 0;
         
         if (fps > 0) {
@@ -155,22 +149,22 @@ inline void report(float fps = 0) {
         
         #if defined(PLATFORM_NATIVE) || defined(PLATFORM_WEB)
         char buffer[128];
-        snprintf(buffer, sizeof(buffer), "%-20s | %5d | %9.1f | %7d | %7d | %6.2f%%",
+        snprintf(buffer, sizeof(buffer), "%-20s | %5u | %9.3f | %8.3f | %8.3f | %6.2f%%",
             name_str.c_str(),
             data.count,
             avg_time,
-            data.min_time_us,
-            data.max_time_us,
+            data.min_time_ns / 1000.0f,
+            data.max_time_ns / 1000.0f,
             percent
         );
         std::cout << buffer << std::endl;
         #else
-        Serial.printf("%-20s | %5d | %9.1f | %7d | %7d | %6.2f%%\n",
+        Serial.printf("%-20s | %5u | %9.3f | %8.3f | %8.3f | %6.2f%%\n",
             name_str.c_str(),
             data.count,
             avg_time,
-            data.min_time_us,
-            data.max_time_us,
+            data.min_time_ns / 1000.0f,
+            data.max_time_ns / 1000.0f,
             percent
         );
         #endif
@@ -27,6 +27,7 @@
 #include "PixelTheater/color/palettes.h"    // Standard Palettes enum & data
 #include "PixelTheater/color/gradients.h"   // Generated Gradient palette data
 #include "PixelTheater/color/palette_api.h" // Core palette functions (colorFromPalette, blend)
+#include "PixelTheater/color/palette256.h"  // 256-entry palette lookup tables
 #include "PixelTheater/color/definitions.h" // Static color definitions (CRGB::Red, etc.)
 #include "PixelTheater/color/conversions.h" // Color conversion functions (rgb2hsv, hsv2rgb)
 #include "PixelTheater/color/measurement.h" // Color measurement functions (distance, brightness)
@@ -20,6 +20,7 @@
 
 #include "PixelTheater.h"
 #include "PixelTheater/easing.h"
+#include "PixelTheater/core/fixed_containers.h"
 
 namespace Scenes {
 
@@ -30,11 +31,18 @@ using PixelTheater::Scene;
 using PixelTheater::CRGB;
 using PixelTheater::CHSV;
 using PixelTheater::CRGBPalette16;
+using PixelTheater::Palette256;
 
 // ─── Utility helpers ───────────────────────────────────────────────────────
 using PixelTheater::colorFromPalette;
 using PixelTheater::map;  // Arduino‑style map() for int & float
 
+// ─── Allocation-free storage (see core/arena.h, core/fixed_containers.h) ──
+using PixelTheater::Arena;
+using PixelTheater::FixedVector;
+using PixelTheater::FixedPool;
+using PixelTheater::RingBuffer;
+
 // ─── Math constants ────────────────────────────────────────────────────────
 using PixelTheater::Constants::PT_PI;
 using PixelTheater::Constants::PT_TWO_PI;
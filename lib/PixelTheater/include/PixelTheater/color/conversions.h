@@ -6,6 +6,17 @@ namespace PixelTheater {
 
 // HSV <-> RGB Conversions
 void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb);
+
+// Batch versions, bit-exact with the single-pixel conversion. Hue,
+// saturation and value each index a table, so a buffer of LEDs costs little
+// more than reading and writing it.
+void hsv2rgb_rainbow(const CHSV* hsv, CRGB* rgb, int count);
+// Separate hue, saturation and value arrays
+void hsv2rgb_rainbow(const uint8_t* hue, const uint8_t* sat, const uint8_t* val, CRGB* rgb, int count);
+// One saturation and value for every LED: rainbows and hue rotation. At
+// full saturation and value each LED is a single table load.
+void hsv2rgb_rainbow(const uint8_t* hue, uint8_t sat, uint8_t val, CRGB* rgb, int count);
+
 PixelTheater::CHSV rgb2hsv_approximate(const PixelTheater::CRGB& rgb);
 
 // Operator overloads - DECLARATIONS ONLY
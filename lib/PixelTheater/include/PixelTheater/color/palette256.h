@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "PixelTheater/core/crgb.h"
+#include "PixelTheater/color/gradients.h"
+#include "PixelTheater/color/palette_api.h"
+#include "PixelTheater/color/palettes.h"
+
+namespace PixelTheater {
+
+/**
+ * @brief A palette expanded to all 256 indices, so a lookup is one load.
+ *
+ * colorFromPalette() splits the index, fetches two of the 16 entries and
+ * runs three lerp8by8() calls for every pixel. A Palette256 does that once
+ * per entry when it is built, optionally with the brightness baked in, and
+ * after that palette[index] is all a scene pays. Entries built from a
+ * CRGBPalette16 are exactly what colorFromPalette() returns for the same
+ * index, brightness and blend type.
+ *
+ * Gradient palettes (the generated data in color/gradients.h, which includes
+ * the WLED palettes from util/palettes) are expanded the way FastLED fills a
+ * CRGBPalette256 from gradient bytes, on every platform.
+ *
+ * Build in setup(): 768 bytes, no heap. fadeToward() crossfades towards
+ * another Palette256 a slice of entries at a time, so a palette change can
+ * be spread over frames instead of rebuilding the table in one go.
+ */
+class Palette256 {
+public:
+    static constexpr size_t SIZE = 256;
+
+    Palette256() = default;     // All black
+    explicit Palette256(const CRGBPalette16& pal, uint8_t brightness = 255,
+                        TBlendType blendType = LINEARBLEND) {
+        build(pal, brightness, blendType);
+    }
+    explicit Palette256(const GradientPaletteData& gradient, uint8_t brightness = 255) {
+        build(gradient, brightness);
+    }
+
+    void build(const CRGBPalette16& pal, uint8_t brightness = 255, TBlendType blendType = LINEARBLEND);
+
+    /**
+     * @brief Expand gradient bytes: (position, r, g, b) anchors in rising
+     * order. Indices before the first anchor take its color, those after the
+     * last take the last one's. Empty or malformed data (not a whole number
+     * of anchors) leaves the palette black.
+     */
+    void build(const GradientPaletteData& gradient, uint8_t brightness = 255);
+
+    // Scale every entry, for a brightness change after building
+    void scale(uint8_t brightness);
+
+    const CRGB& operator[](uint8_t index) const { return _entries[index]; }
+    const CRGB* data() const { return _entries.data(); }
+
+    // out[i] = palette[indices[i]]
+    void map(const uint8_t* indices, CRGB* out, size_t count) const;
+    // out[i] = palette[indices[i] + shift], wrapping: a rotating palette
+    void map(const uint8_t* indices, CRGB* out, size_t count, uint8_t shift) const;
+
+    /**
+     * @brief Move up to `entries` entries, continuing from where the previous
+     * call stopped, at most `step` levels per channel towards target.
+     *
+     * Called every frame this is a steady crossfade in the manner of
+     * FastLED's nblendPaletteTowardPalette(); a smaller slice spreads the
+     * same fade over more frames for less work per frame.
+     * @return true once the palette equals target
+     */
+    bool fadeToward(const Palette256& target, uint8_t step, size_t entries = SIZE);
+
+    bool operator==(const Palette256& other) const;
+    bool operator!=(const Palette256& other) const { return !(*this == other); }
+
+private:
+    std::array<CRGB, SIZE> _entries{};
+    uint8_t _cursor = 0;        // Next entry for fadeToward()
+};
+
+} // namespace PixelTheater
@@ -24,8 +24,8 @@ enum TBlendType {
  * @brief Get a color from a 16-entry palette.
  * 
  * Handles interpolation between entries based on blend type.
- * Note: Native/Web implementation currently only supports CRGBPalette16,
- * gradient palette support is Teensy-only via FastLED for now.
+ * For per-pixel lookups in a frame loop, or for gradient palettes, expand
+ * the palette once into a Palette256 (color/palette256.h) instead.
  * 
  * @param pal The 16-entry palette (CRGBPalette16).
  * @param index The 8-bit index (0-255) into the virtual 256-entry palette.
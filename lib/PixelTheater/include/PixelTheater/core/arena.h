@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace PixelTheater {
+
+/**
+ * @brief Bump allocator over one block reserved up front.
+ *
+ * allocate() moves a pointer forward; nothing is freed individually, and
+ * reset() releases everything at once. Scenes get one from Scene::arena():
+ * reserve() and allocate in setup(), then use the memory from tick() without
+ * touching the heap. The Theater resets a scene's arena with the scene
+ * (Scene::reset()), so the next setup() starts from an empty block.
+ *
+ * Destructors never run, so only trivially destructible types can be
+ * created here. Allocation fails (returns nullptr) once the block is full.
+ *
+ *   void setup() override {
+ *       arena().reserve(ledCount() * sizeof(CRGB));
+ *       scratch = arena().allocate<CRGB>(ledCount());
+ *   }
+ */
+class Arena {
+public:
+    Arena() = default;
+    explicit Arena(size_t capacity) { reserve(capacity); }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Make room for at least capacity bytes. Reallocates (and so
+     * resets) only when the current block is smaller.
+     */
+    void reserve(size_t capacity) {
+        if (capacity <= _capacity) return;
+        _block.reset(new uint8_t[capacity]);
+        _capacity = capacity;
+        _used = 0;
+    }
+
+    /**
+     * @brief Raw, aligned bytes, or nullptr when the block is full
+     */
+    void* allocate_bytes(size_t size, size_t align = alignof(std::max_align_t)) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(_block.get());
+        const uintptr_t start = (base + _used + align - 1) & ~(static_cast<uintptr_t>(align) - 1);
+        const size_t end = static_cast<size_t>(start - base) + size;
+        if (!_block || end > _capacity) return nullptr;
+        _used = end;
+        if (_used > _high_water) _high_water = _used;
+        return reinterpret_cast<void*>(start);
+    }
+
+    /**
+     * @brief Value-initialised array of count T, or nullptr when full
+     */
+    template <typename T>
+    T* allocate(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena never runs destructors");
+        void* p = allocate_bytes(sizeof(T) * count, alignof(T));
+        if (!p) return nullptr;
+        T* items = static_cast<T*>(p);
+        for (size_t i = 0; i < count; ++i) new (items + i) T();
+        return items;
+    }
+
+    /**
+     * @brief Room for count T, left unconstructed (placement-new each one),
+     * or nullptr when full. For types without a default constructor.
+     */
+    template <typename T>
+    T* allocate_uninitialized(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena never runs destructors");
+        return static_cast<T*>(allocate_bytes(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * @brief One T constructed from args, or nullptr when full
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena never runs destructors");
+        void* p = allocate_bytes(sizeof(T), alignof(T));
+        return p ? new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // Release everything; the block itself is kept
+    void reset() { _used = 0; }
+
+    size_t capacity() const { return _capacity; }
+    size_t used() const { return _used; }
+    size_t remaining() const { return _capacity - _used; }
+    size_t high_water() const { return _high_water; }    // Most ever used at once
+
+private:
+    std::unique_ptr<uint8_t[]> _block;
+    size_t _capacity = 0;
+    size_t _used = 0;
+    size_t _high_water = 0;
+};
+
+} // namespace PixelTheater
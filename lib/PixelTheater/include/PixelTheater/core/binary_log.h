@@ -0,0 +1,234 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "PixelTheater/core/log.h"
+
+// Bytes in the deferred log ring; must be a power of two
+#ifndef PIXELTHEATER_LOG_BUFFER
+#define PIXELTHEATER_LOG_BUFFER 4096
+#endif
+
+namespace PixelTheater {
+
+/**
+ * @brief Deferred logger: records a format-string ID and the raw arguments
+ * into a lock-free ring, to be formatted later.
+ *
+ * record() copies a few bytes and returns; nothing is formatted on the
+ * caller's path. drain() formats records into text on the device (from the
+ * idle part of the loop), or read() hands out the raw bytes for a host to
+ * decode with LogDecoder. A format string gets its ID the first time it is
+ * logged, announced by a definition record carrying its text, so the host
+ * needs no symbol table.
+ *
+ * Format strings are kept by address, so they must be string literals.
+ * String arguments are copied (up to MAX_STRING bytes). One producer and
+ * one consumer: one thread logs while another drains, never two loggers.
+ *
+ * Stream format, little-endian, one record after another:
+ *   u8 level | u8 length | u16 format id | u32 micros | length bytes
+ * The payload is a type tag and value per argument, or for a definition
+ * record (level DEFINE) the format text.
+ */
+class BinaryLog {
+public:
+    static constexpr size_t CAPACITY = PIXELTHEATER_LOG_BUFFER;
+    static constexpr uint16_t MAX_FORMATS = 256;
+    static constexpr size_t MAX_STRING = 32;
+    static constexpr size_t HEADER_SIZE = 8;
+    static constexpr size_t MAX_PAYLOAD = 255;
+    static constexpr uint8_t DEFINE = 0xFF;     // Level byte of a format definition
+
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "PIXELTHEATER_LOG_BUFFER must be a power of two");
+
+    // Argument type tags
+    enum Tag : uint8_t {
+        I32 = 'i',
+        U32 = 'u',
+        I64 = 'I',
+        U64 = 'U',
+        F32 = 'f',
+        F64 = 'd',
+        STR = 's',
+        PTR = 'p'
+    };
+
+    BinaryLog() = default;
+    BinaryLog(const BinaryLog&) = delete;
+    BinaryLog& operator=(const BinaryLog&) = delete;
+
+    /**
+     * @brief Queue one message. Returns false (and counts a drop) if the
+     * ring is full or the arguments don't fit a record.
+     */
+    template <typename... Args>
+    bool record(Log::Level level, const char* format, Args... args) {
+        const uint16_t id = intern(format);
+        if (id >= MAX_FORMATS) return drop();
+        if (!_announced[id] && !announce(id)) return drop();
+
+        uint8_t buffer[HEADER_SIZE + MAX_PAYLOAD];
+        uint8_t* p = buffer + HEADER_SIZE;
+        [[maybe_unused]] uint8_t* const end = buffer + sizeof(buffer); // Unused without args
+        if (!(true && ... && encode(p, end, args))) return drop();
+        const size_t length = static_cast<size_t>(p - buffer) - HEADER_SIZE;
+        write_header(buffer, level, static_cast<uint8_t>(length), id);
+        return push(buffer, HEADER_SIZE + length) || drop();
+    }
+
+    /**
+     * @brief Format up to max_records queued messages, calling
+     * sink(Log::Level, uint32_t micros, const char* text) for each.
+     * Returns how many were formatted. Consumer side.
+     */
+    template <typename Sink>
+    size_t drain(Sink&& sink, size_t max_records = SIZE_MAX) {
+        size_t count = 0;
+        char text[256];
+        Log::Level level;
+        uint32_t micros;
+        while (count < max_records && pop(level, micros, text, sizeof(text))) {
+            sink(level, micros, static_cast<const char*>(text));
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Copy whole queued records, raw, into out (for a host to decode).
+     * Returns the bytes copied. Consumer side.
+     */
+    size_t read(uint8_t* out, size_t max);
+
+    /**
+     * @brief Queue a definition for every known format again, e.g. when a
+     * host decoder connects after messages were already logged.
+     */
+    void resendFormats();
+
+    size_t pending() const {        // Bytes waiting for the consumer
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+    uint32_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+    uint16_t formatCount() const { return _format_count; }
+
+    /**
+     * @brief printf-format a record payload. Shared with LogDecoder.
+     */
+    static void format(const char* fmt, const uint8_t* args, size_t length, char* out, size_t out_size);
+
+private:
+    static constexpr uint16_t NO_ID = 0xFFFF;
+    static constexpr size_t TABLE_SIZE = MAX_FORMATS * 2;   // Open addressing, at most half full
+
+    // Format string -> ID, by address
+    uint16_t intern(const char* format);
+    bool announce(uint16_t id);
+    bool push(const uint8_t* data, size_t size);
+    bool pop(Log::Level& level, uint32_t& micros, char* text, size_t text_size);
+    bool drop() {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    static void write_header(uint8_t* out, uint8_t level, uint8_t length, uint16_t id);
+
+    // --- Argument encoding ---
+    template <typename T>
+    static bool put(uint8_t*& p, uint8_t* end, Tag tag, T value) {
+        if (end - p < static_cast<ptrdiff_t>(1 + sizeof(T))) return false;
+        *p++ = tag;
+        std::memcpy(p, &value, sizeof(T));
+        p += sizeof(T);
+        return true;
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value, bool>::type
+    encode(uint8_t*& p, uint8_t* end, T value) {
+        if (sizeof(T) <= 4) {
+            return std::is_signed<T>::value ? put(p, end, I32, static_cast<int32_t>(value))
+                                            : put(p, end, U32, static_cast<uint32_t>(value));
+        }
+        return std::is_signed<T>::value ? put(p, end, I64, static_cast<int64_t>(value))
+                                        : put(p, end, U64, static_cast<uint64_t>(value));
+    }
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value, bool>::type
+    encode(uint8_t*& p, uint8_t* end, T value) {
+        return encode(p, end, static_cast<typename std::underlying_type<T>::type>(value));
+    }
+    static bool encode(uint8_t*& p, uint8_t* end, float value) { return put(p, end, F32, value); }
+    static bool encode(uint8_t*& p, uint8_t* end, double value) { return put(p, end, F64, value); }
+    static bool encode(uint8_t*& p, uint8_t* end, const char* value) {
+        const char* s = value ? value : "(null)";
+        size_t n = 0;
+        while (n < MAX_STRING && s[n]) ++n;
+        if (end - p < static_cast<ptrdiff_t>(2 + n)) return false;
+        *p++ = STR;
+        *p++ = static_cast<uint8_t>(n);
+        std::memcpy(p, s, n);
+        p += n;
+        return true;
+    }
+    static bool encode(uint8_t*& p, uint8_t* end, char* value) { return encode(p, end, static_cast<const char*>(value)); }
+    static bool encode(uint8_t*& p, uint8_t* end, const void* value) {
+        return put(p, end, PTR, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+    }
+
+    // Producer and consumer each own one counter; both only grow
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+    std::atomic<uint32_t> _dropped{0};
+    uint8_t _ring[CAPACITY];
+
+    // Written by the producer only; an ID is published before any record using it
+    const char* _table_keys[TABLE_SIZE] = {};
+    uint16_t _table_ids[TABLE_SIZE] = {};
+    const char* _formats[MAX_FORMATS] = {};
+    bool _announced[MAX_FORMATS] = {};
+    uint16_t _format_count = 0;
+};
+
+/**
+ * @brief Host-side decoder for the bytes BinaryLog::read() produces.
+ *
+ * Learns format strings from definition records, so it must see the stream
+ * from the start (or after BinaryLog::resendFormats()). Bytes can arrive in
+ * any chunking.
+ */
+class LogDecoder {
+public:
+    struct Line {
+        Log::Level level = Log::Info;
+        uint32_t micros = 0;
+        std::string text;
+    };
+
+    void feed(const uint8_t* data, size_t size);
+
+    // Next decoded message, or false when more bytes are needed
+    bool next(Line& line);
+
+    // Records whose format had not been defined
+    uint32_t unknown() const { return _unknown; }
+
+private:
+    std::vector<uint8_t> _pending;
+    size_t _offset = 0;
+    std::vector<std::string> _formats;
+    uint32_t _unknown = 0;
+};
+
+namespace Log {
+    // Ring used by scene logging when PIXELTHEATER_LOG_DEFERRED is defined
+    BinaryLog& deferred();
+}
+
+} // namespace PixelTheater
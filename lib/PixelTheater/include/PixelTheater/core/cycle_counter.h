@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Platform-specific includes must be outside namespace
+#if defined(PLATFORM_TEENSY)
+#include <Arduino.h>
+#elif defined(PLATFORM_WEB) || defined(EMSCRIPTEN)
+#include <emscripten.h>
+#else
+#include <time.h>
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(PIXELTHEATER_NO_RDTSC)
+#include <x86intrin.h>
+#define PIXELTHEATER_CYCLES_RDTSC 1
+#endif
+#endif
+
+namespace PixelTheater {
+
+/**
+ * @brief Highest-resolution counter each platform has, for profiling.
+ *
+ *   Teensy 4   DWT CYCCNT, one tick per CPU cycle (1.67 ns at 600 MHz)
+ *   x86 native rdtsc, calibrated against CLOCK_MONOTONIC_RAW
+ *   other      clock_gettime(CLOCK_MONOTONIC_RAW), ticks are ns
+ *   web        emscripten_get_now(), ticks are ns (the browser rounds it)
+ *
+ * now() is inline and does nothing but read the counter. calibration()
+ * measures, once, how long a tick is, what a back-to-back pair of reads
+ * costs (subtracted from every interval by elapsedNs()) and the smallest
+ * step the counter actually takes. rdtsc is not serialising, so single
+ * intervals of a few cycles jitter; averages over many calls are sound.
+ */
+namespace CycleCounter {
+#if defined(PLATFORM_TEENSY)
+    using Ticks = uint32_t;     // Wraps every 7 s at 600 MHz; differences stay correct
+#else
+    using Ticks = uint64_t;
+#endif
+
+    inline Ticks now() {
+#if defined(PLATFORM_TEENSY)
+        return ARM_DWT_CYCCNT;
+#elif defined(PLATFORM_WEB) || defined(EMSCRIPTEN)
+        return static_cast<Ticks>(emscripten_get_now() * 1e6);
+#elif defined(PIXELTHEATER_CYCLES_RDTSC)
+        return __rdtsc();
+#else
+        timespec ts;
+#ifdef CLOCK_MONOTONIC_RAW
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+        return static_cast<Ticks>(ts.tv_sec) * 1000000000ull + static_cast<Ticks>(ts.tv_nsec);
+#endif
+    }
+
+    struct Calibration {
+        const char* source = "";
+        double ns_per_tick = 1.0;
+        Ticks overhead = 0;         // Ticks a now(); now() pair measures with nothing between
+        Ticks resolution = 1;       // Smallest non-zero step seen between two reads
+
+        double overhead_ns() const { return overhead * ns_per_tick; }
+        double resolution_ns() const { return resolution * ns_per_tick; }
+    };
+
+    /**
+     * @brief The platform counter's calibration. The first call measures it
+     * (about 10 ms with rdtsc, well under 1 ms elsewhere), so call it from
+     * setup() rather than mid-frame.
+     */
+    const Calibration& calibration();
+
+    // Measure again, e.g. after the CPU clock was changed
+    const Calibration& calibrate();
+
+    /**
+     * @brief Measure overhead and resolution of any counter. ns_per_tick is
+     * taken as given. Used by calibrate(), and by tests with synthetic clocks.
+     */
+    Calibration measure(Ticks (*read)(), double ns_per_tick, const char* source, size_t samples = 1000);
+
+    // Interval between two now() readings in ns, less the counter's own overhead
+    uint32_t elapsedNs(Ticks start, Ticks end);
+}
+
+} // namespace PixelTheater
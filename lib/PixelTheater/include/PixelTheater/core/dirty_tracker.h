@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PixelTheater/core/crgb.h"
+#include "PixelTheater/limits.h"
+
+namespace PixelTheater {
+
+class ILedBuffer;
+class IModel;
+
+/**
+ * @brief Tracks which LEDs changed from one frame to the next.
+ *
+ * capture() compares the buffer against a copy of the previous frame, so
+ * only real colour changes count: a scene that fades every LED each frame
+ * but leaves most of them black still produces a sparse dirty set, and
+ * writes made through Face::leds are seen too.
+ *
+ * After each capture:
+ *   - isDirty()/forEachDirtyRange() give the LEDs changed in that frame
+ *   - faceDirty() gives the faces containing any of them
+ *   - changedSince(i, n) answers "has LED i changed since frame n", so a
+ *     consumer that skips frames can catch up with one pass
+ *
+ * Memory is 7 bytes per LED plus one bit. Enable it per scene with
+ * Scene::set_dirty_tracking(); the Theater captures once per frame and
+ * hands the tracker to the platform, whose output skips unchanged channels.
+ */
+class DirtyTracker {
+public:
+    static constexpr size_t MAX_FACES = Limits::ABSOLUTE_MAX_FACES;
+
+    /**
+     * @brief Size for led_count LEDs and drop all history.
+     * The next capture() reports every LED as changed.
+     */
+    void reset(size_t led_count);
+
+    /**
+     * @brief Record each face's LED range (from Face::led_offset()) for faceDirty().
+     */
+    void setFaces(const IModel& model);
+
+    /**
+     * @brief Make the next capture() report every LED as changed.
+     * Use after anything that invalidates downstream state, e.g. a scene switch.
+     */
+    void invalidate() { _valid = false; }
+
+    /**
+     * @brief Diff the buffer against the previous capture and advance frame().
+     */
+    void capture(const ILedBuffer& leds);
+
+    // Frames captured so far; LEDs changed in the latest capture are stamped with this
+    uint32_t frame() const { return _frame; }
+    size_t ledCount() const { return _previous.size(); }
+
+    // --- Latest frame ---
+    bool isDirty(size_t index) const {
+        return index < _previous.size() && (_bits[index >> 5] >> (index & 31)) & 1u;
+    }
+    size_t dirtyCount() const { return _dirty_count; }
+    bool anyDirty() const { return _dirty_count > 0; }
+    bool faceDirty(size_t face) const {
+        return face < MAX_FACES && (_face_bits[face >> 5] >> (face & 31)) & 1u;
+    }
+    size_t dirtyFaceCount() const;
+
+    /**
+     * @brief Call fn(first, count) for each run of consecutive dirty LEDs.
+     */
+    template <typename Fn>
+    void forEachDirtyRange(Fn&& fn) const {
+        size_t run_start = 0;
+        bool in_run = false;
+        for (size_t w = 0; w < _bits.size(); ++w) {
+            uint32_t word = _bits[w];
+            // Skip whole words that don't start or end a run
+            if ((word == 0 && !in_run) || (word == 0xFFFFFFFFu && in_run)) continue;
+            for (size_t b = 0; b < 32; ++b) {
+                const bool dirty = (word >> b) & 1u;
+                if (dirty == in_run) continue;
+                const size_t index = w * 32 + b;
+                if (dirty) {
+                    run_start = index;
+                } else {
+                    fn(run_start, index - run_start);
+                }
+                in_run = dirty;
+            }
+        }
+        if (in_run) fn(run_start, _previous.size() - run_start);
+    }
+
+    // --- History ---
+
+    /**
+     * @brief True if LED index changed in any capture after frame since_frame.
+     */
+    bool changedSince(size_t index, uint32_t since_frame) const {
+        return index < _stamp.size() && _stamp[index] > since_frame;
+    }
+
+    /**
+     * @brief Call fn(index) for every LED changed after frame since_frame.
+     */
+    template <typename Fn>
+    void forEachChangedSince(uint32_t since_frame, Fn&& fn) const {
+        for (size_t i = 0; i < _stamp.size(); ++i) {
+            if (_stamp[i] > since_frame) fn(i);
+        }
+    }
+
+private:
+    struct FaceRange {
+        uint16_t offset;
+        uint16_t count;
+    };
+
+    std::vector<CRGB> _previous;    // Buffer contents at the last capture
+    std::vector<uint32_t> _stamp;   // Frame each LED last changed in
+    std::vector<uint32_t> _bits;    // Changed in the latest capture, 1 bit per LED
+    std::vector<FaceRange> _faces;
+    uint32_t _face_bits[(MAX_FACES + 31) / 32] = {}; // Faces changed in the latest capture
+    uint32_t _frame = 0;
+    size_t _dirty_count = 0;
+    bool _valid = false;            // False until _previous holds a real frame
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace PixelTheater {
+
+/**
+ * @brief Vector with its storage inline: never allocates.
+ *
+ * push_back() and emplace_back() return false (and drop the item) once
+ * Capacity items are held, so callers decide how to handle overflow.
+ * Iteration is over a plain array, so range-for and std:: algorithms work.
+ */
+template <typename T, size_t Capacity>
+class FixedVector {
+public:
+    FixedVector() = default;
+    ~FixedVector() { clear(); }
+
+    FixedVector(const FixedVector& other) {
+        for (const T& item : other) emplace_back(item);
+    }
+    FixedVector& operator=(const FixedVector& other) {
+        if (this != &other) {
+            clear();
+            for (const T& item : other) emplace_back(item);
+        }
+        return *this;
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    bool full() const { return _size >= Capacity; }
+
+    bool push_back(const T& item) { return emplace_back(item); }
+
+    template <typename... Args>
+    bool emplace_back(Args&&... args) {
+        if (_size >= Capacity) return false;
+        new (slot(_size)) T(std::forward<Args>(args)...);
+        ++_size;
+        return true;
+    }
+
+    void pop_back() {
+        if (_size == 0) return;
+        data()[--_size].~T();
+    }
+
+    /**
+     * @brief Remove item i by moving the last item into its slot (O(1),
+     * does not keep order)
+     */
+    void erase_swap(size_t i) {
+        if (i >= _size) return;
+        if (i != _size - 1) data()[i] = std::move(data()[_size - 1]);
+        pop_back();
+    }
+
+    void clear() {
+        while (_size > 0) pop_back();
+    }
+
+    T* data() { return reinterpret_cast<T*>(_storage); }
+    const T* data() const { return reinterpret_cast<const T*>(_storage); }
+    T& operator[](size_t i) { return data()[i]; }
+    const T& operator[](size_t i) const { return data()[i]; }
+    T& back() { return data()[_size - 1]; }
+    const T& back() const { return data()[_size - 1]; }
+
+    T* begin() { return data(); }
+    T* end() { return data() + _size; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + _size; }
+
+private:
+    void* slot(size_t i) { return _storage + i * sizeof(T); }
+
+    alignas(T) unsigned char _storage[sizeof(T) * Capacity];
+    size_t _size = 0;
+};
+
+/**
+ * @brief Fixed set of Capacity object slots handed out and returned at run time.
+ *
+ * acquire() constructs an object in a free slot and returns it (nullptr when
+ * every slot is taken); release() destroys it and frees the slot. Pointers
+ * stay valid until released. Both are O(1); nothing is allocated.
+ */
+template <typename T, uint16_t Capacity>
+class FixedPool {
+public:
+    FixedPool() { reset_free_list(); }
+    ~FixedPool() { clear(); }
+
+    FixedPool(const FixedPool&) = delete;
+    FixedPool& operator=(const FixedPool&) = delete;
+
+    static constexpr uint16_t capacity() { return Capacity; }
+    uint16_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    bool full() const { return _size >= Capacity; }
+
+    template <typename... Args>
+    T* acquire(Args&&... args) {
+        if (_size >= Capacity) return nullptr;
+        const uint16_t i = _free[Capacity - 1 - _size];
+        ++_size;
+        _live[i] = true;
+        return new (slot(i)) T(std::forward<Args>(args)...);
+    }
+
+    void release(T* item) {
+        const uint16_t i = index_of(item);
+        if (i >= Capacity || !_live[i]) return;
+        item->~T();
+        _live[i] = false;
+        --_size;
+        _free[Capacity - 1 - _size] = i;
+    }
+
+    void clear() {
+        for (uint16_t i = 0; i < Capacity; ++i) {
+            if (_live[i]) reinterpret_cast<T*>(slot(i))->~T();
+        }
+        _size = 0;
+        reset_free_list();
+    }
+
+    /**
+     * @brief Call fn(T&) for every live object, in slot order
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (uint16_t i = 0; i < Capacity; ++i) {
+            if (_live[i]) fn(*reinterpret_cast<T*>(slot(i)));
+        }
+    }
+
+    // Slot number of an object from this pool, or Capacity if it is not one
+    uint16_t index_of(const T* item) const {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(item);
+        if (p < _storage || p >= _storage + sizeof(_storage)) return Capacity;
+        return static_cast<uint16_t>((p - _storage) / sizeof(T));
+    }
+
+private:
+    void* slot(uint16_t i) { return _storage + static_cast<size_t>(i) * sizeof(T); }
+
+    // Free slots are the first Capacity - size entries, taken from the end
+    void reset_free_list() {
+        for (uint16_t i = 0; i < Capacity; ++i) {
+            _free[i] = static_cast<uint16_t>(Capacity - 1 - i);
+            _live[i] = false;
+        }
+    }
+
+    alignas(T) unsigned char _storage[sizeof(T) * Capacity];
+    uint16_t _free[Capacity];
+    bool _live[Capacity];
+    uint16_t _size = 0;
+};
+
+/**
+ * @brief Fixed-capacity ring: push() appends, overwriting the oldest item
+ * when full.
+ *
+ * Index 0 is the oldest item and size() - 1 the newest; newest(n) counts
+ * back from the newest. T must be default-constructible and copyable.
+ */
+template <typename T, size_t Capacity>
+class RingBuffer {
+public:
+    static constexpr size_t capacity() { return Capacity; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    bool full() const { return _size >= Capacity; }
+    void clear() { _head = 0; _size = 0; }
+
+    void push(const T& item) {
+        _items[(_head + _size) % Capacity] = item;
+        if (_size < Capacity) {
+            ++_size;
+        } else {
+            _head = (_head + 1) % Capacity;
+        }
+    }
+
+    /**
+     * @brief Remove the oldest item. Returns false if empty.
+     */
+    bool pop(T& out) {
+        if (_size == 0) return false;
+        out = _items[_head];
+        _head = (_head + 1) % Capacity;
+        --_size;
+        return true;
+    }
+
+    T& operator[](size_t i) { return _items[(_head + i) % Capacity]; }
+    const T& operator[](size_t i) const { return _items[(_head + i) % Capacity]; }
+    const T& oldest() const { return (*this)[0]; }
+    const T& newest(size_t n = 0) const { return (*this)[_size - 1 - n]; }
+
+private:
+    T _items[Capacity]{};
+    size_t _head = 0;
+    size_t _size = 0;
+};
+
+} // namespace PixelTheater
@@ -46,6 +46,12 @@ public:
      */
     virtual size_t ledCount() const = 0;
 
+    /**
+     * @brief The LEDs as one contiguous array, or nullptr if the buffer
+     * is not stored that way. Whole-buffer passes (post-processing) use it.
+     */
+    virtual CRGB* data() { return nullptr; }
+
     // Future consideration: Add a method to get a span or iterator?
     // virtual std::span<CRGB> leds() = 0; 
     // virtual std::span<const CRGB> leds() const = 0;
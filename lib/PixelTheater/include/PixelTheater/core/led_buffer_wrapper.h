@@ -62,6 +62,10 @@ public:
         return num_leds_;
     }
 
+    CRGB* data() override {
+        return leds_ptr_;
+    }
+
 private:
     // Helper for returning a dummy LED when clamping an empty buffer
     static CRGB& dummyLed() {
@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdarg>  // For va_list
+#include <cstdint>
 #include <cstdio>   // For vprintf
 #include <functional>
 #include <string>   // For std::string
@@ -20,9 +21,39 @@
 //  - Provides consistent logging interface across native and hardware platforms
 //  - Handles platform-specific output (printf vs Serial)
 //  - Used for debugging and user feedback
+//  - PIXELTHEATER_LOG_LEVEL sets the most verbose level compiled in; calls
+//    above it compile to nothing (see Scene::logInfo() and friends)
+
+// 0 off, 1 error, 2 warning, 3 info, 4 debug
+#ifndef PIXELTHEATER_LOG_LEVEL
+#define PIXELTHEATER_LOG_LEVEL 3
+#endif
 
 namespace PixelTheater {
 namespace Log {
+    enum Level : uint8_t {
+        Off = 0,
+        Error = 1,
+        Warning = 2,
+        Info = 3,
+        Debug = 4
+    };
+
+    // Whether calls at this level are compiled in
+    constexpr bool enabled(Level level) {
+        return level != Off && level <= PIXELTHEATER_LOG_LEVEL;
+    }
+
+    inline const char* levelName(Level level) {
+        switch (level) {
+            case Error: return "ERROR";
+            case Warning: return "WARN";
+            case Info: return "INFO";
+            case Debug: return "DEBUG";
+            default: return "?";
+        }
+    }
+
     // For native and web platforms - use std::function for flexibility
     #if defined(PLATFORM_NATIVE) || defined(PLATFORM_WEB)
         using LogFunction = std::function<void(const char*)>;
@@ -44,7 +75,8 @@ namespace Log {
         
         // Keep only the original C-style variadic function
         inline void info(const char* fmt, ...) {
-            static char buffer[256];
+            if (!enabled(Info)) return;
+            char buffer[256];
             va_list args;
             va_start(args, fmt);
             vsnprintf(buffer, sizeof(buffer), fmt, args);
@@ -52,7 +84,8 @@ namespace Log {
             set_log_function(nullptr)(buffer);
         }
         inline void warning(const char* fmt, ...) {
-            static char buffer[256];
+            if (!enabled(Warning)) return;
+            char buffer[256];
             va_list args;
             va_start(args, fmt);
             vsnprintf(buffer, sizeof(buffer), fmt, args);
@@ -60,7 +93,8 @@ namespace Log {
             set_log_function(nullptr)(buffer);
         }
         inline void error(const char* fmt, ...) {
-            static char buffer[256];
+            if (!enabled(Error)) return;
+            char buffer[256];
             va_list args;
             va_start(args, fmt);
             vsnprintf(buffer, sizeof(buffer), fmt, args);
@@ -71,6 +105,7 @@ namespace Log {
     #else
         // Hardware environment - direct to Serial
         inline void info(const char* fmt, ...) {
+            if (!enabled(Info)) return;
             char buf[256];
             va_list args;
             va_start(args, fmt);
@@ -79,6 +114,7 @@ namespace Log {
             if (Serial) Serial.print(buf);
         }
         inline void warning(const char* fmt, ...) {
+            if (!enabled(Warning)) return;
             char buf[256];
             va_list args;
             va_start(args, fmt);
@@ -87,6 +123,7 @@ namespace Log {
             if (Serial) Serial.print(buf);
         }
         inline void error(const char* fmt, ...) {
+            if (!enabled(Error)) return;
             char buf[256];
             va_list args;
             va_start(args, fmt);
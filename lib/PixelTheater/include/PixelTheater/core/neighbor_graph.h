@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PixelTheater {
+
+class IModel;
+
+/**
+ * @brief The model's LED neighbour lists packed into one array (CSR).
+ *
+ * Point::getNeighbors() is a fixed array of Limits::MAX_NEIGHBORS entries
+ * padded with 0xFFFF sentinels, so every walk over it checks each slot.
+ * Here the neighbours of LED i are ids[offsets[i]] up to ids[offsets[i + 1]],
+ * sentinels and out-of-range ids dropped, so a pass over all of them is one
+ * straight read of 2 bytes per edge. Built once, in setup().
+ */
+class NeighborGraph {
+public:
+    // Pack the neighbours of the first led_count points of the model
+    void build(const IModel& model, size_t led_count);
+
+    size_t ledCount() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+    size_t edgeCount() const { return _ids.size(); }
+
+    const uint16_t* neighbors(size_t led) const { return _ids.data() + _offsets[led]; }
+    size_t degree(size_t led) const { return _offsets[led + 1] - _offsets[led]; }
+
+    /**
+     * @brief out[i] = mean of in[] over the neighbours of LED i, per channel
+     * (truncated, as integer division would). LEDs without neighbours keep
+     * their own colour. in and out are CRGB arrays of ledCount() LEDs, as
+     * bytes, and must not overlap.
+     */
+    void average(const uint8_t* in, uint8_t* out) const;
+
+private:
+    std::vector<uint32_t> _offsets;
+    std::vector<uint16_t> _ids;
+};
+
+} // namespace PixelTheater
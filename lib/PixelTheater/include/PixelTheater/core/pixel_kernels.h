@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PixelTheater {
+
+/**
+ * @brief Whole-buffer byte kernels for post-processing.
+ *
+ * Each works on n bytes of a CRGB array seen as flat channel bytes (a CRGB
+ * is three bytes with no padding), the same operation on every byte, so a
+ * 1248-LED frame is one loop of 3744 bytes. On the Teensy 4 the saturating
+ * ones use the Cortex-M7 DSP instructions that handle four bytes at once
+ * (UQADD8, UQSUB8); elsewhere the loops are plain enough for the compiler
+ * to vectorise. Results are identical on every platform.
+ */
+namespace PixelKernels {
+    // dst = qadd8(dst, src), byte by byte
+    void addSaturate(uint8_t* dst, const uint8_t* src, size_t n);
+
+    // dst = qsub8(src, value): keeps what is above value, e.g. a bloom bright pass
+    void subtractSaturate(uint8_t* dst, const uint8_t* src, size_t n, uint8_t value);
+
+    // dst = blend8(dst, src, amount), the same as nblend() per channel
+    void blend(uint8_t* dst, const uint8_t* src, size_t n, uint8_t amount);
+
+    // dst = scale8(dst, scale), the same as CRGB::nscale8()
+    void scale(uint8_t* dst, size_t n, uint8_t scale);
+
+    /**
+     * @brief dst = (dst * scale16 + dither) >> 16.
+     * Fine-grained decay for small time steps: with dither spread evenly
+     * over 0..65535 across frames, the expected result is exact, so dim
+     * values keep fading at the right rate instead of sticking (scale16
+     * near 65536) or dropping a whole step per frame.
+     */
+    void scale16(uint8_t* dst, size_t n, uint32_t scale16, uint16_t dither);
+}
+
+} // namespace PixelTheater
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PixelTheater/core/crgb.h"
+#include "PixelTheater/core/neighbor_graph.h"
+
+namespace PixelTheater {
+
+class IModel;
+
+/**
+ * @brief A scene's post-processing stack, run on the LED buffer after each
+ * tick().
+ *
+ * Stages run in the order they were added:
+ *   Blur    blend each LED towards the mean of its model neighbours,
+ *           `iterations` times
+ *   Bloom   take what is brighter than `threshold`, spread it over the
+ *           neighbour graph `iterations` times and add it back, scaled by
+ *           `amount`
+ *   Trails  exponential decay by time rather than by frame: light halves
+ *           every `half_life` seconds whatever the frame rate
+ *
+ * Scratch buffers and the neighbour graph are allocated when a stage that
+ * needs them is added (in setup()), so apply() never touches the heap. The
+ * per-byte work goes through PixelKernels. Add stages in setup() with
+ * Scene::post_process(); change a stage's settings through stage() at any
+ * time. reset() removes the stages but keeps the buffers.
+ */
+class PostProcess {
+public:
+    static constexpr size_t MAX_STAGES = 8;
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    enum class StageType : uint8_t { Blur, Bloom, Trails };
+
+    struct Stage {
+        StageType type = StageType::Blur;
+        bool enabled = true;
+        float amount = 0.0f;        // Blur: blend towards the mean, Bloom: glow strength (0..1)
+        uint8_t iterations = 1;     // Blur passes, or how far Bloom spreads
+        uint8_t threshold = 0;      // Bloom: channel level where the glow starts
+        float half_life = 0.0f;     // Trails: seconds for light to halve; 0 is off
+    };
+
+    PostProcess(const IModel& model, size_t led_count);
+
+    // Each returns the stage's handle for stage(), or NONE if the stack is full
+    size_t addBlur(float amount, uint8_t iterations = 1);
+    size_t addBloom(uint8_t threshold, float amount, uint8_t radius = 2);
+    size_t addTrails(float half_life);
+
+    // nullptr for an unknown handle
+    Stage* stage(size_t handle) { return handle < _count ? &_stages[handle] : nullptr; }
+    size_t stageCount() const { return _count; }
+
+    // Remove every stage; buffers are kept for the next setup()
+    void clear() { _count = 0; }
+
+    /**
+     * @brief Run the enabled stages over count LEDs.
+     * @param dt Seconds since the previous frame, for Trails
+     */
+    void apply(CRGB* leds, size_t count, float dt);
+
+    const NeighborGraph& graph() const { return _graph; }
+
+private:
+    size_t add(const Stage& stage, bool needs_graph, bool needs_glow);
+    void blur(uint8_t* bytes, const Stage& stage);
+    void bloom(uint8_t* bytes, const Stage& stage);
+    void trails(uint8_t* bytes, size_t n, const Stage& stage, float dt);
+
+    const IModel& _model;
+    size_t _led_count;
+    NeighborGraph _graph;
+    std::vector<CRGB> _scratch;     // Neighbour means
+    std::vector<CRGB> _glow;        // Bloom's bright pass
+    Stage _stages[MAX_STAGES];
+    size_t _count = 0;
+    uint16_t _dither = 0;           // Trails rounding, spread evenly over frames
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PixelTheater {
+
+/**
+ * @brief A scene's quality knobs: things it can do less of when frames run
+ * over budget, such as agent count caps, a blur pass or sampling resolution.
+ *
+ * Each knob has `levels` steps, from 0 (cheapest) to levels - 1 (full
+ * quality, where every knob starts). Scenes declare knobs in setup() with
+ * Scene::quality_knob() and read them every tick; the QualityGovernor moves
+ * them. Declaration order is priority: stepDown() lowers the first knob that
+ * can still go down, so declare the one that is cheapest to lose first.
+ * stepUp() retraces the same path backwards.
+ *
+ * Fixed size, no heap: names must be string literals (or otherwise outlive
+ * the scene).
+ */
+class QualityKnobs {
+public:
+    static constexpr size_t MAX_KNOBS = 8;
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    /**
+     * @brief Declare a knob, at full quality. Declaring a name again (setup()
+     * running a second time) returns the same index and keeps its level.
+     * @return Index for level(), or NONE if levels < 2 or all knobs are used
+     */
+    size_t add(const char* name, uint8_t levels);
+
+    // Remove every knob; setup() declares them again
+    void clear() { _count = 0; }
+
+    size_t count() const { return _count; }
+    const char* name(size_t knob) const { return knob < _count ? _knobs[knob].name : ""; }
+    uint8_t levels(size_t knob) const { return knob < _count ? _knobs[knob].levels : 1; }
+
+    // Current level; an unknown knob (e.g. NONE) reads as full quality
+    uint8_t level(size_t knob) const {
+        return knob < _count ? _knobs[knob].level : static_cast<uint8_t>(levels(knob) - 1);
+    }
+
+    // Level as 0..1, 1 at full quality
+    float ratio(size_t knob) const {
+        return knob < _count ? static_cast<float>(_knobs[knob].level) / (_knobs[knob].levels - 1) : 1.0f;
+    }
+
+    // Clamped to the knob's range
+    void set(size_t knob, uint8_t level);
+
+    /**
+     * @brief Take a knob out of the governor's path while lowering it saves
+     * nothing, e.g. a blur pass whose amount is 0. An inactive knob goes back
+     * to full quality and stepDown()/stepUp() pass over it. Knobs start active.
+     */
+    void setActive(size_t knob, bool active);
+    bool active(size_t knob) const { return knob < _count && _knobs[knob].active; }
+
+    // One step along the priority order; false when already at the end
+    bool stepDown();
+    bool stepUp();
+
+    // Every knob back to full quality
+    void restore();
+
+    // Sum of all levels, and what it is at full quality: the overall quality
+    uint16_t total() const;
+    uint16_t maxTotal() const;
+
+private:
+    struct Knob {
+        const char* name;
+        uint8_t levels;
+        uint8_t level;
+        bool active;
+    };
+    Knob _knobs[MAX_KNOBS] = {};
+    size_t _count = 0;
+};
+
+/**
+ * @brief Steps a scene's quality knobs down when frames run over a time
+ * budget and back up when there is headroom again.
+ *
+ * record() sorts each frame: slow (above target * over), fast (below
+ * target * under) or in between. Slow frames count towards a step down and
+ * every other frame counts one back, so a lone spike does nothing but a
+ * mostly slow run of down_frames steps quality down. Fast frames count
+ * towards a step up after up_frames; frames in between count one back and
+ * a slow frame starts that count over. Each step moves one knob level and
+ * starts both counts over. The gap between the thresholds
+ * and the longer wait for going up are the hysteresis: a level whose cost
+ * lands between them stays. If a step up is undone by the next step, the
+ * following step up waits twice as long (up to max_backoff times), so a
+ * level that cannot hold is not retried every few seconds.
+ */
+class QualityGovernor {
+public:
+    struct Config {
+        uint32_t target_us = 0;         // Frame budget; 0 turns the governor off
+        float over = 1.05f;             // Above target * over counts as over budget
+        float under = 0.70f;            // Below target * under counts as headroom
+        uint16_t down_frames = 10;      // Frames over budget before a step down
+        uint16_t up_frames = 120;       // Frames with headroom before a step up
+        uint8_t max_backoff = 8;        // Longest wait for a step up, in up_frames
+    };
+
+    void setConfig(const Config& config);
+    const Config& config() const { return _config; }
+
+    // Shorthand for setting only target_us
+    void setTarget(uint32_t target_us) { _config.target_us = target_us; }
+    bool enabled() const { return _config.target_us > 0; }
+
+    /**
+     * @brief Account for one frame, and move one knob if it is time.
+     * @return -1 after a step down, +1 after a step up, else 0
+     */
+    int record(uint32_t frame_us, QualityKnobs& knobs);
+
+    // Forget the counts and backoff, e.g. for a new scene
+    void reset();
+
+    // Progress towards the next step down and up
+    uint16_t overCount() const { return _over_count; }
+    uint32_t underCount() const { return _under_count; }
+
+    uint32_t stepsDown() const { return _steps_down; }
+    uint32_t stepsUp() const { return _steps_up; }
+
+private:
+    Config _config;
+    uint16_t _over_count = 0;
+    uint32_t _under_count = 0;
+    uint8_t _backoff = 1;
+    int _last_step = 0;
+    uint32_t _steps_down = 0;
+    uint32_t _steps_up = 0;
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include "PixelTheater/core/imodel.h"
+#include "PixelTheater/constants.h"
+
+namespace PixelTheater {
+
+/**
+ * @brief Fixed-capacity spatial hash for points on a sphere.
+ *
+ * Points are binned by direction only (their distance from the origin is
+ * ignored), so model coordinates, agent positions and unit vectors can all be
+ * inserted as-is. Cells are equal-area: ZBands slices of equal height in z
+ * times LonBins slices of longitude.
+ *
+ * Usage per frame:
+ *   hash.clear();
+ *   for (...) hash.insert(id, x, y, z);   // O(1) each
+ *   hash.build();                          // O(n + cells) counting sort
+ *   hash.query(x, y, z, angle, [](uint16_t id, float dot) { ... });
+ *
+ * Queries visit only the cells overlapping the spherical cap of the given
+ * angular radius and report every point with dot >= cos(angle), where dot is
+ * the cosine of the angle between the unit directions.
+ *
+ * Storage is sized once by reserve() (or indexModel()); insert() never grows
+ * it, so per-frame rebuilds do not allocate.
+ */
+template <uint8_t ZBands = 16, uint8_t LonBins = 32>
+class SphereHash {
+public:
+    static constexpr uint16_t CELLS = static_cast<uint16_t>(ZBands) * LonBins;
+
+    SphereHash() = default;
+    explicit SphereHash(uint16_t capacity) { reserve(capacity); }
+
+    /**
+     * @brief Allocate room for capacity points. Clears the hash.
+     */
+    void reserve(uint16_t capacity) {
+        _x.assign(capacity, 0.0f);
+        _y.assign(capacity, 0.0f);
+        _z.assign(capacity, 0.0f);
+        _id.assign(capacity, 0);
+        _cell.assign(capacity, 0);
+        _order.assign(capacity, 0);
+        clear();
+    }
+
+    uint16_t capacity() const { return static_cast<uint16_t>(_x.size()); }
+    uint16_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+
+    void clear() {
+        _count = 0;
+        _built = false;
+    }
+
+    /**
+     * @brief Add a point. Returns false when full or for a zero-length vector.
+     * @param id Caller's index for this point, passed back from query()
+     */
+    bool insert(uint16_t id, float x, float y, float z) {
+        if (_count >= _x.size()) return false;
+        float len_sq = x * x + y * y + z * z;
+        if (len_sq <= 1e-12f) return false;
+        float inv = 1.0f / std::sqrt(len_sq);
+        x *= inv; y *= inv; z *= inv;
+
+        _x[_count] = x;
+        _y[_count] = y;
+        _z[_count] = z;
+        _id[_count] = id;
+        _cell[_count] = cellFor(x, y, z);
+        ++_count;
+        _built = false;
+        return true;
+    }
+
+    /**
+     * @brief Sort inserted points into cells. Must be called before query().
+     */
+    void build() {
+        std::fill(_start, _start + CELLS + 1, 0);
+        for (uint16_t i = 0; i < _count; ++i) ++_start[_cell[i] + 1];
+        for (uint16_t c = 0; c < CELLS; ++c) _start[c + 1] += _start[c];
+
+        // Scatter slots into cell order using a running cursor per cell
+        std::copy(_start, _start + CELLS, _fill);
+        for (uint16_t i = 0; i < _count; ++i) _order[_fill[_cell[i]]++] = i;
+        _built = true;
+    }
+
+    /**
+     * @brief Angular query radius with its cosine/sine precomputed.
+     * Build one up front when running many queries with the same radius.
+     */
+    struct Radius {
+        float angle, cos_a, sin_a;
+        explicit Radius(float a) : angle(a), cos_a(std::cos(a)), sin_a(std::sin(a)) {}
+    };
+
+    /**
+     * @brief Visit every point within max_angle radians of direction (x, y, z).
+     * @param fn Callable as fn(uint16_t id, float dot)
+     */
+    template <typename Fn>
+    void query(float x, float y, float z, float max_angle, Fn&& fn) const {
+        query(x, y, z, Radius(max_angle), fn);
+    }
+
+    template <typename Fn>
+    void query(float x, float y, float z, const Radius& radius, Fn&& fn) const {
+        if (!_built || _count == 0) return;
+        float len_sq = x * x + y * y + z * z;
+        if (len_sq <= 1e-12f) return;
+        float inv = 1.0f / std::sqrt(len_sq);
+        x *= inv; y *= inv; z *= inv;
+
+        if (radius.angle >= Constants::PT_PI) {
+            for (uint16_t k = 0; k < _count; ++k) visit(_order[k], x, y, z, -2.0f, fn);
+            return;
+        }
+        const float cos_r = radius.cos_a;
+
+        // z range of the cap: cos(polar -/+ angle), expanded without any trig.
+        // The cap reaches a pole when the query is within angle of it.
+        const float sin_polar = std::sqrt(std::max(0.0f, 1.0f - z * z));
+        const bool has_north = z >= cos_r;
+        const bool has_south = z <= -cos_r;
+        const float z_hi = has_north ? 1.0f : z * cos_r + sin_polar * radius.sin_a;
+        const float z_lo = has_south ? -1.0f : z * cos_r - sin_polar * radius.sin_a;
+        const uint8_t band_lo = bandFor(z_lo - EDGE_MARGIN);
+        const uint8_t band_hi = bandFor(z_hi + EDGE_MARGIN);
+
+        // Longitude half-width of the cap; the whole ring when the cap covers a pole
+        bool all_lon = has_north || has_south || radius.sin_a >= sin_polar;
+        int lon_lo = 0, lon_hi = LonBins - 1;
+        if (!all_lon) {
+            // asin(s) <= s * pi/2 on [0, 1]: slightly wider than the exact cap, no libm call
+            const float half = radius.sin_a / sin_polar * Constants::PT_HALF_PI + EDGE_MARGIN + 2.0f * ATAN_ERROR;
+            const float lon = fastAtan2(y, x);
+            const float scale = LonBins / Constants::PT_TWO_PI;
+            lon_lo = static_cast<int>(std::floor((lon - half + Constants::PT_PI) * scale));
+            lon_hi = static_cast<int>(std::floor((lon + half + Constants::PT_PI) * scale));
+            if (lon_hi - lon_lo + 1 >= LonBins) { lon_lo = 0; lon_hi = LonBins - 1; }
+        }
+
+        for (uint8_t band = band_lo; band <= band_hi; ++band) {
+            const uint16_t row = band * LonBins;
+            for (int l = lon_lo; l <= lon_hi; ++l) {
+                const int wrapped = l < 0 ? l + LonBins : (l >= LonBins ? l - LonBins : l);
+                const uint16_t cell = row + wrapped;
+                for (uint16_t k = _start[cell]; k < _start[cell + 1]; ++k) {
+                    visit(_order[k], x, y, z, cos_r, fn);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Id of the point closest in direction to (x, y, z), or -1 if empty.
+     * Searches a cap of start_angle first and doubles it until something is found,
+     * so start_angle only needs to be about the typical point spacing.
+     */
+    int nearest(float x, float y, float z, float start_angle = 0.1f) const {
+        if (!_built || _count == 0) return -1;
+        int best_id = -1;
+        float best_dot = -2.0f;
+        for (float angle = std::max(start_angle, 1e-3f); best_id < 0; angle *= 2.0f) {
+            query(x, y, z, angle, [&](uint16_t id, float dot) {
+                if (dot > best_dot) {
+                    best_dot = dot;
+                    best_id = id;
+                }
+            });
+            if (angle >= Constants::PT_PI) break;
+        }
+        return best_id;
+    }
+
+    /**
+     * @brief Size for, insert every point of a model (id = LED index) and build.
+     * LED positions never move, so this is typically done once in setup().
+     */
+    void indexModel(const IModel& model) {
+        const uint16_t n = static_cast<uint16_t>(std::min<size_t>(model.pointCount(), UINT16_MAX));
+        if (capacity() < n) reserve(n);
+        clear();
+        for (size_t i = 0; i < n; ++i) {
+            const Point& p = model.point(i);
+            insert(static_cast<uint16_t>(i), p.x(), p.y(), p.z());
+        }
+        build();
+    }
+
+private:
+    // Widens cell ranges slightly so float rounding never drops a point on the cap edge
+    static constexpr float EDGE_MARGIN = 1e-4f;
+
+    // Polynomial atan2 used for binning, max error ~2e-4 rad.
+    // Inserts and queries share it, so bins stay consistent.
+    static constexpr float ATAN_ERROR = 3e-4f;
+    static float fastAtan2(float y, float x) {
+        const float ax = std::fabs(x), ay = std::fabs(y);
+        const float mx = std::max(ax, ay);
+        if (mx <= 0.0f) return 0.0f;
+        const float a = std::min(ax, ay) / mx;
+        const float s = a * a;
+        float r = ((-0.0464964749f * s + 0.15931422f) * s - 0.327622764f) * s * a + a;
+        if (ay > ax) r = Constants::PT_HALF_PI - r;
+        if (x < 0.0f) r = Constants::PT_PI - r;
+        if (y < 0.0f) r = -r;
+        return r;
+    }
+
+    static uint8_t bandFor(float z) {
+        int band = static_cast<int>((z + 1.0f) * 0.5f * ZBands);
+        return static_cast<uint8_t>(std::max(0, std::min(band, ZBands - 1)));
+    }
+
+    static uint16_t cellFor(float x, float y, float z) {
+        int lon = static_cast<int>((fastAtan2(y, x) + Constants::PT_PI) * (LonBins / Constants::PT_TWO_PI));
+        lon = std::max(0, std::min(lon, LonBins - 1));
+        return static_cast<uint16_t>(bandFor(z) * LonBins + lon);
+    }
+
+    template <typename Fn>
+    void visit(uint16_t slot, float x, float y, float z, float cos_r, Fn& fn) const {
+        const float dot = _x[slot] * x + _y[slot] * y + _z[slot] * z;
+        if (dot >= cos_r) fn(_id[slot], dot);
+    }
+
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
+    std::vector<uint16_t> _id;
+    std::vector<uint16_t> _cell;
+    std::vector<uint16_t> _order;   // Slots sorted by cell
+    uint16_t _start[CELLS + 1];     // First _order entry of each cell
+    uint16_t _fill[CELLS];          // Scatter cursor used by build()
+    uint16_t _count = 0;
+    bool _built = false;
+};
+
+} // namespace PixelTheater
@@ -20,7 +20,15 @@ namespace Limits {
     
     // Absolute hardware limits for validation
     static constexpr size_t ABSOLUTE_MAX_LEDS = 10000;    // Sanity check
-    static constexpr size_t ABSOLUTE_MAX_FACES = 32;      // Sanity check
+    static constexpr size_t ABSOLUTE_MAX_FACES = 255;     // Face ids are uint8_t
+
+    // LED ids and neighbour ids are uint16_t, with 0xFFFF marking an unused
+    // neighbour slot; faces of MAX_LEDS_PER_FACE must be able to reach
+    // ABSOLUTE_MAX_LEDS
+    static_assert(ABSOLUTE_MAX_LEDS < 0xFFFF, "LED ids are uint16_t");
+    static_assert(ABSOLUTE_MAX_FACES <= 0xFF, "Face ids are uint8_t");
+    static_assert(ABSOLUTE_MAX_FACES * MAX_LEDS_PER_FACE >= ABSOLUTE_MAX_LEDS,
+                  "ABSOLUTE_MAX_LEDS needs more faces than ABSOLUTE_MAX_FACES");
 
     // New limits for region counts
     static constexpr size_t MAX_RINGS = 8;  // Max rings per face
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PixelTheater {
+
+/**
+ * @brief A static 3-D k-d tree for nearest-neighbour queries over LED
+ * positions.
+ *
+ * Finding each LED's neighbours by comparing every pair is O(N²): about a
+ * million distance checks for DodecaRGBv2 and a hundred million at
+ * Limits::ABSOLUTE_MAX_LEDS. The tree is built once in O(N log N) by
+ * splitting at the median along the widest axis, then each query visits a
+ * handful of leaves.
+ *
+ * The tree is stored implicitly: the positions are reordered so that each
+ * node is the middle of its range, with no child pointers. build() copies
+ * the positions; queries do not touch the heap.
+ */
+class KdTree {
+public:
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+    static constexpr size_t MAX_RESULTS = 32;
+
+    struct Result {
+        uint32_t index;         // Position in the array given to build()
+        float distance_sq;
+    };
+
+    // xyz holds count points as x, y, z triples
+    void build(const float* xyz, size_t count);
+
+    size_t size() const { return _points.size(); }
+
+    /**
+     * @brief The k points closest to (x, y, z) and no further than
+     * max_distance, nearest first. Equal distances are ordered by index.
+     * @param exclude Index to leave out, usually the query point itself
+     * @return How many results were written to out (at most k, at most
+     * MAX_RESULTS)
+     */
+    size_t nearest(float x, float y, float z, size_t k, float max_distance,
+                   Result* out, size_t exclude = NONE) const;
+
+private:
+    struct Node {
+        float pos[3];
+        uint32_t index;
+        uint8_t axis;
+    };
+
+    void buildRange(size_t begin, size_t end);
+    void search(size_t begin, size_t end, const float* query, size_t exclude,
+                Result* results, size_t& count, size_t k, float& worst) const;
+
+    std::vector<Node> _points;
+};
+
+} // namespace PixelTheater
@@ -49,8 +49,10 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <array>
 #include "PixelTheater/model_def.h"
+#include "PixelTheater/model/model_blob.h"
 #include "PixelTheater/core/crgb.h"
 #include "PixelTheater/core/color.h"
 #include "face.h"
@@ -67,6 +69,14 @@ private:
     std::array<Face, ModelDef::FACE_COUNT> _faces;
 
     void initialize() {
+        if constexpr (HasModelBlob<ModelDef>::value) {
+            initializeFromBlob();
+        } else {
+            initializeFromArrays();
+        }
+    }
+
+    void initializeFromArrays() {
         // Initialize points
         // Access ModelDef statically
         for(size_t i = 0; i < ModelDef::LED_COUNT; ++i) {
@@ -127,6 +137,40 @@ private:
         }
     }
 
+    // Compiled models (util/model_compiler) carry their points, faces and
+    // neighbours as one binary blob instead of constexpr arrays
+    void initializeFromBlob() {
+        ModelBlobReader blob(reinterpret_cast<const uint8_t*>(ModelDef::BLOB), ModelDef::BLOB_SIZE);
+        if (!blob.valid() || blob.ledCount() != ModelDef::LED_COUNT || blob.faceCount() != ModelDef::FACE_COUNT) {
+            return;     // Leaves an empty model rather than reading past the data
+        }
+
+        ModelBlob::NeighborRecord blob_neighbors[Limits::MAX_NEIGHBORS];
+        Point::Neighbor neighbors[Limits::MAX_NEIGHBORS];
+        for(size_t i = 0; i < ModelDef::LED_COUNT; ++i) {
+            const auto point = blob.point(i);
+            if (point.id >= ModelDef::LED_COUNT) continue;
+            _points[point.id] = Point(point.id, point.face_id, point.x, point.y, point.z);
+            const size_t count = blob.neighbors(i, blob_neighbors, Limits::MAX_NEIGHBORS);
+            for(size_t n = 0; n < count; ++n) neighbors[n] = {blob_neighbors[n].id, blob_neighbors[n].distance};
+            _points[point.id].setNeighbors(neighbors, count);
+        }
+
+        size_t led_offset = 0;
+        for(size_t i = 0; i < ModelDef::FACE_COUNT; i++) {
+            const auto face_data = blob.face(i);
+            const auto face_type = blob.faceType(face_data.type_id < blob.faceTypeCount() ? face_data.type_id : 0);
+            const auto sides = std::min<size_t>(static_cast<size_t>(face_type.type), Limits::MAX_EDGES_PER_FACE);
+            auto& face = _faces[i];
+            face = Face(face_type.type, face_data.id, led_offset, face_type.num_leds, _leds,
+                        static_cast<uint16_t>(sides));
+            for(size_t j = 0; j < sides; j++) {
+                face.vertices[j] = {face_data.vertices[j].x, face_data.vertices[j].y, face_data.vertices[j].z};
+            }
+            led_offset += face_type.num_leds;
+        }
+    }
+
 public:
     // Modified constructor - only requires LED array pointer
     explicit Model(CRGB* leds)
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "PixelTheater/limits.h"
+#include "PixelTheater/model/face_type.h"
+
+namespace PixelTheater {
+
+/**
+ * Binary model format, written by util/model_compiler and read by
+ * ModelBlobReader.
+ *
+ *   header      32 bytes
+ *   face types  face_type_count * 8 bytes
+ *   faces       face_count * 112 bytes
+ *   points      led_count * 16 bytes
+ *   neighbors   led_count * max_neighbors * 6 bytes
+ *   groups      group_count * 12 bytes, then the groups' LEDs (u16 each)
+ *   strings     name, version, description, model type, then group names;
+ *               each NUL-ended
+ *
+ * Header:
+ *   magic "PTMB" | version:u16 | header_size:u16 | led_count:u16 |
+ *   face_count:u8 | face_type_count:u8 | max_neighbors:u8 | reserved:u8 |
+ *   group_count:u16 | sphere_radius:f32 | strings_size:u32 |
+ *   total_size:u32 | checksum:u32
+ *
+ *   face type   type:u8 | reserved:u8 | num_leds:u16 | edge_length_mm:f32
+ *   face        id:u8 | type_id:u8 | rotation:u8 | vertex_count:u8 |
+ *               x, y, z:f32 | MAX_VERTICES * (x, y, z:f32)
+ *   point       id:u16 | face_id:u8 | reserved:u8 | x, y, z:f32
+ *   neighbor    id:u16 | distance:f32, nearest first; unused slots have
+ *               id 0xFFFF
+ *   group       face_type:u8 | reserved:u8 | led_count:u16 | first:u32 |
+ *               name:u32. The group's LEDs are entries first.. of the LED
+ *               list, as indices within one face of that type; name is an
+ *               offset into the strings.
+ *
+ * Multi-byte fields are little-endian, floats IEEE-754. The checksum
+ * (FNV-1a) covers everything after the header. Every section is at an
+ * offset worked out from the header, so a reader can use the bytes in place.
+ * Version 1 had no groups; the reader still accepts it.
+ */
+namespace ModelBlob {
+    static constexpr uint8_t MAGIC[4] = {'P', 'T', 'M', 'B'};
+    static constexpr uint16_t VERSION = 2;
+    static constexpr uint16_t MIN_VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 32;
+    static constexpr size_t MAX_VERTICES = 8;
+    static constexpr size_t FACE_TYPE_SIZE = 8;
+    static constexpr size_t FACE_SIZE = 16 + MAX_VERTICES * 12;
+    static constexpr size_t POINT_SIZE = 16;
+    static constexpr size_t NEIGHBOR_SIZE = 6;
+    static constexpr size_t GROUP_SIZE = 12;
+    static constexpr uint16_t NO_NEIGHBOR = 0xFFFF;
+
+    static_assert(Limits::MAX_EDGES_PER_FACE <= MAX_VERTICES, "Face vertices no longer fit the blob format");
+
+    struct FaceTypeRecord {
+        FaceType type = FaceType::None;
+        uint16_t num_leds = 0;
+        float edge_length_mm = 0.0f;
+    };
+
+    struct Vertex {
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+    };
+
+    struct FaceRecord {
+        uint8_t id = 0;
+        uint8_t type_id = 0;
+        uint8_t rotation = 0;
+        uint8_t vertex_count = 0;
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        Vertex vertices[MAX_VERTICES];
+    };
+
+    struct PointRecord {
+        uint16_t id = 0;
+        uint8_t face_id = 0;
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+    };
+
+    struct NeighborRecord {
+        uint16_t id = NO_NEIGHBOR;
+        float distance = -1.0f;
+    };
+
+    // A named set of LEDs on every face of one type, e.g. "center" or "ring0"
+    struct GroupRecord {
+        const char* name = "";
+        uint8_t face_type = 0;      // Index into the face types
+        uint16_t led_count = 0;
+    };
+
+    uint32_t checksum(const uint8_t* data, size_t len);
+}
+
+/**
+ * @brief Assembles a model blob. Host-side: used by the model compiler and
+ * the tests.
+ */
+class ModelBlobWriter {
+public:
+    explicit ModelBlobWriter(size_t max_neighbors = Limits::MAX_NEIGHBORS)
+        : _max_neighbors(max_neighbors) {}
+
+    void setMetadata(const std::string& name, const std::string& version,
+                     const std::string& description, const std::string& model_type);
+    void setSphereRadius(float radius) { _sphere_radius = radius; }
+
+    void addFaceType(const ModelBlob::FaceTypeRecord& face_type) { _face_types.push_back(face_type); }
+    void addFace(const ModelBlob::FaceRecord& face) { _faces.push_back(face); }
+
+    // leds are indices within a face of type face_type
+    void addGroup(uint8_t face_type, const std::string& name, const uint16_t* leds, size_t count);
+
+    // Neighbors beyond max_neighbors are dropped
+    void addPoint(const ModelBlob::PointRecord& point,
+                  const ModelBlob::NeighborRecord* neighbors, size_t neighbor_count);
+
+    size_t pointCount() const { return _points.size(); }
+
+    /**
+     * @brief Lay out the blob.
+     * @return Empty if the model exceeds the format's limits (65534 LEDs,
+     * 255 faces or face types, 65535 groups or LEDs in a group)
+     */
+    std::vector<uint8_t> finish() const;
+
+private:
+    size_t _max_neighbors;
+    float _sphere_radius = 0.0f;
+    std::string _strings[4];
+    std::vector<ModelBlob::FaceTypeRecord> _face_types;
+    std::vector<ModelBlob::FaceRecord> _faces;
+    std::vector<ModelBlob::PointRecord> _points;
+    std::vector<ModelBlob::NeighborRecord> _neighbors;
+    struct Group {
+        uint8_t face_type;
+        std::string name;
+        std::vector<uint16_t> leds;
+    };
+    std::vector<Group> _groups;
+};
+
+/**
+ * @brief Reads a model blob in place, without copying it.
+ *
+ * open() checks the header, the section sizes and the checksum, then that
+ * the records agree: face type ids, point face ids and neighbour ids are in
+ * range and the faces' LEDs add up to ledCount(), so faces built from them
+ * stay inside an LED buffer of ledCount(). The record accessors assume it
+ * succeeded and that the index is in range.
+ */
+class ModelBlobReader {
+public:
+    ModelBlobReader() = default;
+    ModelBlobReader(const uint8_t* data, size_t size) { open(data, size); }
+
+    // false if the bytes are not a complete, intact blob of this version
+    bool open(const uint8_t* data, size_t size);
+    bool valid() const { return _data != nullptr; }
+
+    size_t ledCount() const { return _led_count; }
+    size_t faceCount() const { return _face_count; }
+    size_t faceTypeCount() const { return _face_type_count; }
+    size_t maxNeighbors() const { return _max_neighbors; }
+    size_t groupCount() const { return _group_count; }
+    uint16_t formatVersion() const { return _version_number; }
+    float sphereRadius() const { return _sphere_radius; }
+    size_t size() const { return _size; }
+
+    const char* name() const { return _name; }
+    const char* version() const { return _version; }
+    const char* description() const { return _description; }
+    const char* modelType() const { return _model_type; }
+
+    ModelBlob::FaceTypeRecord faceType(size_t i) const;
+    ModelBlob::FaceRecord face(size_t i) const;
+    ModelBlob::PointRecord point(size_t i) const;
+
+    /**
+     * @brief Copy point i's neighbours, nearest first, up to max entries.
+     * @return How many were written; unused slots are not counted
+     */
+    size_t neighbors(size_t i, ModelBlob::NeighborRecord* out, size_t max) const;
+
+    ModelBlob::GroupRecord group(size_t i) const;
+
+    // LED j of group i, as an index within one face
+    uint16_t groupLed(size_t i, size_t j) const;
+
+    // The group with this name on the given face type, or -1
+    int findGroup(const char* name, uint8_t face_type = 0) const;
+
+private:
+    // Cross-record checks for open(), once the section offsets are set
+    bool recordsConsistent() const;
+
+    const uint8_t* _data = nullptr;
+    size_t _size = 0;
+    size_t _led_count = 0;
+    size_t _face_count = 0;
+    size_t _face_type_count = 0;
+    size_t _max_neighbors = 0;
+    size_t _group_count = 0;
+    uint16_t _version_number = 0;
+    float _sphere_radius = 0.0f;
+    size_t _face_types_at = 0;
+    size_t _faces_at = 0;
+    size_t _points_at = 0;
+    size_t _neighbors_at = 0;
+    size_t _groups_at = 0;
+    size_t _group_leds_at = 0;
+    size_t _strings_at = 0;
+    const char* _name = "";
+    const char* _version = "";
+    const char* _description = "";
+    const char* _model_type = "";
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PixelTheater/core/imodel.h"
+#include "PixelTheater/core/crgb.h"
+#include "PixelTheater/model/model_blob.h"
+#include "PixelTheater/model/point.h"
+#include "PixelTheater/model/face.h"
+
+namespace PixelTheater {
+
+/**
+ * @brief A model chosen at run time from a ModelBlob (model.bin), instead of
+ * a ModelDefinition compiled into the program.
+ *
+ * The blob is never copied. load() reads bytes the caller keeps alive: a
+ * compiled model's BLOB, a PROGMEM array in the Teensy's memory-mapped
+ * flash, or a buffer filled from SD. loadFile() maps model.bin with mmap
+ * on native and web builds. Points (with their neighbours) and faces are
+ * built from the blob once, at load, because IModel hands out references
+ * to them; metadata and LED groups are read from the blob in place.
+ *
+ * Usage:
+ *   auto model = std::make_unique<RuntimeModel>();
+ *   if (model->loadFile("models/big_sphere.bin"))
+ *       theater.useNativePlatform(std::move(model));
+ */
+class RuntimeModel : public IModel {
+public:
+    RuntimeModel() = default;
+    ~RuntimeModel() override;
+
+    RuntimeModel(const RuntimeModel&) = delete;
+    RuntimeModel& operator=(const RuntimeModel&) = delete;
+
+    /**
+     * @brief Use a blob in place. The bytes must outlive the model.
+     * @return false if they are not a valid blob; the model is then empty
+     */
+    bool load(const uint8_t* data, size_t size);
+
+#if !defined(PLATFORM_TEENSY)
+    // Map a model file read-only and load it; unmapped when the model is
+    // destroyed or another model is loaded
+    bool loadFile(const char* path);
+#endif
+
+    /**
+     * @brief Point the faces at the LED buffer (at least pointCount() LEDs).
+     * Until then faces have geometry but no LEDs.
+     */
+    void attachLeds(CRGB* leds);
+
+    bool loaded() const { return _blob.valid(); }
+    const ModelBlobReader& blob() const { return _blob; }
+    const char* name() const { return _blob.name(); }
+
+    // IModel
+    // Out-of-range indices clamp, as in ModelWrapper
+    const Point& point(size_t index) const override {
+        if (index >= _points.size()) return _points.empty() ? dummyPoint() : _points.back();
+        return _points[index];
+    }
+    size_t pointCount() const noexcept override { return _points.size(); }
+    const Face& face(size_t index) const override {
+        if (index >= _faces.size()) return _faces.empty() ? dummyFace() : _faces.back();
+        return _faces[index];
+    }
+    size_t faceCount() const noexcept override { return _faces.size(); }
+    float getSphereRadius() const override { return _blob.sphereRadius(); }
+
+    /**
+     * @brief Model-wide LED indices of a named group on one face, e.g.
+     * group "center" of face 3.
+     * @return How many were written to out (at most max); 0 if the face has
+     * no group by that name
+     */
+    size_t groupLeds(const char* group, size_t face, uint16_t* out, size_t max) const;
+
+private:
+    void unload();
+    void buildFaces();
+    static const Point& dummyPoint();
+    static const Face& dummyFace();
+
+    ModelBlobReader _blob;
+    std::vector<Point> _points;
+    std::vector<Face> _faces;
+    std::vector<uint8_t> _face_type;    // Face type index of each face
+    CRGB* _leds = nullptr;
+
+    // mmap'd file, if loadFile() was used
+    void* _mapping = nullptr;
+    size_t _mapping_size = 0;
+};
+
+} // namespace PixelTheater
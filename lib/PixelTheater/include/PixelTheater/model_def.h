@@ -2,6 +2,8 @@
 #include "model/face_type.h"
 #include "limits.h"  // For MAX_LEDS_PER_REGION
 #include <array>
+#include <cstddef>
+#include <type_traits>
 
 namespace PixelTheater {
 
@@ -51,4 +53,18 @@ struct ModelDefinition {
     };
 };
 
+/**
+ * Models built by util/model_compiler keep the metadata constants above but
+ * replace FACE_TYPES, FACES, POINTS and NEIGHBORS with a ModelBlob
+ * (model/model_blob.h) in two members:
+ *   static constexpr size_t BLOB_SIZE;
+ *   static constexpr char BLOB[];
+ * Model<ModelDef> reads whichever form the definition has.
+ */
+template<typename T, typename = void>
+struct HasModelBlob : std::false_type {};
+
+template<typename T>
+struct HasModelBlob<T, std::void_t<decltype(T::BLOB), decltype(T::BLOB_SIZE)>> : std::true_type {};
+
 } // namespace PixelTheater 
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "PixelTheater/params/preset.h"
+#include <EEPROM.h>
+
+namespace PixelTheater {
+
+/**
+ * @brief PresetStorage in the Teensy EEPROM emulation (4284 bytes on a 4.x).
+ * base reserves the bytes below it for other uses. Writes use EEPROM.update,
+ * which skips bytes that already hold the value.
+ */
+class EepromPresetStorage : public PresetStorage {
+public:
+    explicit EepromPresetStorage(size_t base = 0) : _base(base) {}
+
+    size_t capacity() const override {
+        const size_t length = EEPROM.length();
+        return length > _base ? length - _base : 0;
+    }
+
+    bool read(size_t offset, uint8_t* dst, size_t len) override {
+        if (offset + len > capacity()) return false;
+        for (size_t i = 0; i < len; ++i) dst[i] = EEPROM.read(static_cast<int>(_base + offset + i));
+        return true;
+    }
+
+    bool write(size_t offset, const uint8_t* src, size_t len) override {
+        if (offset + len > capacity()) return false;
+        for (size_t i = 0; i < len; ++i) EEPROM.update(static_cast<int>(_base + offset + i), src[i]);
+        return true;
+    }
+
+private:
+    size_t _base;
+};
+
+} // namespace PixelTheater
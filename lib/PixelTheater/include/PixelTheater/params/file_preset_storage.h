@@ -0,0 +1,29 @@
+#pragma once
+
+#include "PixelTheater/params/preset.h"
+#include <string>
+
+namespace PixelTheater {
+
+/**
+ * @brief PresetStorage in a file, for native builds.
+ * The file is created on the first write; reads past its end fail, which
+ * PresetBank treats as an empty slot.
+ */
+class FilePresetStorage : public PresetStorage {
+public:
+    FilePresetStorage(const std::string& path, size_t capacity = 4096)
+        : _path(path), _capacity(capacity) {}
+
+    size_t capacity() const override { return _capacity; }
+    bool read(size_t offset, uint8_t* dst, size_t len) override;
+    bool write(size_t offset, const uint8_t* src, size_t len) override;
+
+    const std::string& path() const { return _path; }
+
+private:
+    std::string _path;
+    size_t _capacity;
+};
+
+} // namespace PixelTheater
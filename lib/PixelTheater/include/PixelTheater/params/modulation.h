@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "PixelTheater/settings.h"
+
+namespace PixelTheater {
+
+/**
+ * @brief Animates scene parameters from LFO, random-walk and envelope sources.
+ *
+ * Sources and routes live in fixed tables; update() is one pass over them
+ * with no allocation: evaluate every source, sum each route's
+ * `offset + depth * source` onto its parameter's base value, then write each
+ * parameter once by index (so its flags still clamp or wrap the result).
+ * Depth and offset are in the parameter's own units.
+ *
+ * The base value is whatever the parameter held when it was first routed.
+ * If something else changes the parameter (the UI, a preset recall), that
+ * becomes the new base on the next update, so modulation rides on top of
+ * manual control instead of fighting it.
+ *
+ * LFOs and random walks output -1..1; envelopes output 0..1.
+ *
+ *   auto& mod = modulation();                       // In setup()
+ *   int lfo = mod.add_lfo(0.25f);
+ *   mod.route(lfo, "speed", 0.5f);                  // speed = base +/- 0.5
+ */
+class ModulationMatrix {
+public:
+    static constexpr size_t MAX_SOURCES = 16;
+    static constexpr size_t MAX_ROUTES = 64;
+
+    enum class Shape : uint8_t { Sine, Triangle, Saw, Square };
+
+    explicit ModulationMatrix(Settings& settings);
+
+    // Sources; each returns the source index, or -1 if the table is full
+    int add_lfo(float hz, Shape shape = Shape::Sine, float phase = 0.0f);
+    int add_random_walk(float rate, uint32_t seed = 1);    // rate: typical drift per second
+    // ADSR, linear: attack 0 to 1 and decay 1 to sustain take the given
+    // seconds; release falls at a full scale per `release` seconds
+    int add_envelope(float attack, float decay, float sustain, float release);
+
+    // Envelope gate
+    void trigger(int source);
+    void release(int source);
+
+    /**
+     * @brief Route a source to a numeric parameter.
+     * @return False if the source or parameter is unknown, the parameter is a
+     *         switch or select, or the route table is full
+     */
+    bool route(int source, const std::string& param, float depth, float offset = 0.0f);
+
+    // Remove every route to a parameter and restore its base value
+    void unroute(const std::string& param);
+
+    // Remove everything, restoring routed parameters to their base values
+    void clear();
+
+    // Advance all sources by dt seconds and write the modulated parameters
+    void update(float dt);
+
+    size_t source_count() const { return _source_count; }
+    size_t route_count() const { return _route_count; }
+    float source_value(int source) const;
+
+private:
+    enum class Kind : uint8_t { Lfo, RandomWalk, Envelope };
+    enum class Stage : uint8_t { Idle, Attack, Decay, Sustain, Release };
+
+    struct Source {
+        Kind kind;
+        Shape shape;
+        Stage stage;
+        float rate;         // LFO: cycles/s; walk: drift/s
+        float phase;        // LFO phase 0..1
+        float value;        // Latest output
+        float attack, decay, sustain, release;
+        uint32_t rng;       // Random walk state
+    };
+
+    struct Route {
+        uint8_t source;
+        uint8_t dest;
+        float depth;
+        float offset;
+    };
+
+    // One per routed parameter
+    struct Dest {
+        std::string name;   // To re-resolve the index if parameters are added
+        int index;
+        bool integer;
+        float base;
+        float written;      // What update() last wrote, to spot outside changes
+        float sum;
+    };
+
+    int add_source(const Source& source);
+    int find_dest(const std::string& name) const;
+    float read(const Dest& dest) const;
+    void write(Dest& dest, float value);
+    void resolve();
+    void remove_dest(size_t dest);
+
+    Settings& _settings;
+    uint32_t _revision;     // Settings schema revision the indices belong to
+
+    Source _sources[MAX_SOURCES];
+    size_t _source_count = 0;
+    Route _routes[MAX_ROUTES];
+    size_t _route_count = 0;
+    Dest _dests[MAX_ROUTES];
+    size_t _dest_count = 0;
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "PixelTheater/params/param_value.h"
+
+namespace PixelTheater {
+
+class Scene;
+struct SceneParameterSchema;
+
+/**
+ * Compact binary parameter protocol for control channels where JSON is too
+ * slow to build and parse (USB serial, UDP). Parameters are addressed by
+ * their index in the scene's SceneParameterSchema, and every message names
+ * the schema version it was built against, so a client holding an old
+ * schema gets StaleSchema back instead of setting the wrong parameter.
+ *
+ * All multi-byte fields are little-endian.
+ *
+ *   Request: op u8 | schema u32 | count u8 | entries
+ *     Set:    entry = index u8, value
+ *     Get:    entry = index u8; count 0 asks for every parameter
+ *     Schema: no entries; the reply carries the schema JSON
+ *   Reply:   op|REPLY u8 | schema u32 | status u8 | count u8 | entries
+ *     Set/Get: entry = index u8, value (Set echoes the values after clamping)
+ *     Schema:  length u16, then the JSON text; count is 0
+ *
+ * Values are float32 for float types, int32 for count and select, and one
+ * byte for switches. A Set batch is checked in full before anything is
+ * applied: one bad entry rejects the whole message.
+ */
+namespace ParamProtocol {
+    static constexpr size_t REQUEST_HEADER = 6;
+    static constexpr size_t REPLY_HEADER = 7;
+    static constexpr uint8_t REPLY = 0x80;
+
+    enum class Op : uint8_t { Set = 1, Get = 2, Schema = 3 };
+
+    enum class Status : uint8_t {
+        Ok = 0,
+        StaleSchema,    // Request built against another schema version; fetch it again
+        BadIndex,       // Index past the end of the schema
+        Truncated,      // Message shorter than its count says
+        BadOp,
+        Overflow        // Reply did not fit the output buffer
+    };
+
+    struct Update {
+        uint8_t index;
+        ParamValue value;
+    };
+
+    // Encoded size of a value of this type
+    size_t value_size(ParamType type);
+
+    // Write/read one value in the wire encoding (value_size(type) bytes).
+    // Presets store values the same way.
+    void encode_value(uint8_t* out, ParamType type, const ParamValue& value);
+    ParamValue decode_value(const uint8_t* in, ParamType type);
+
+    /**
+     * @brief Build a Set request.
+     * @return Message length, 0 if it does not fit or an index is out of range
+     */
+    size_t encode_set(const SceneParameterSchema& schema, const Update* updates, size_t count,
+                      uint8_t* out, size_t max);
+
+    /**
+     * @brief Build a Get request. count 0 asks for every parameter.
+     * @return Message length, 0 if it does not fit
+     */
+    size_t encode_get(const SceneParameterSchema& schema, const uint8_t* indices, size_t count,
+                      uint8_t* out, size_t max);
+
+    // Build a Schema request; version 0 is fine before the client has a schema
+    size_t encode_schema_request(uint32_t version, uint8_t* out, size_t max);
+
+    /**
+     * @brief Handle one request against a scene and write the reply.
+     * @return Reply length (at least REPLY_HEADER when max allows), 0 if max
+     *         is too small even for an error reply
+     */
+    size_t handle(Scene& scene, const uint8_t* in, size_t len, uint8_t* out, size_t max);
+
+    struct Reply {
+        Op op = Op::Get;
+        Status status = Status::BadOp;
+        uint32_t version = 0;       // The device's current schema version
+        size_t count = 0;           // Entries written to values
+        const char* json = nullptr; // Schema replies: points into the reply buffer
+        size_t json_length = 0;
+    };
+
+    /**
+     * @brief Decode a reply. Set/Get entries are written to values (up to max_values).
+     * Error replies decode fine: check reply.status, and on StaleSchema fetch
+     * the schema again.
+     * @return False if the reply is malformed, or is an Ok reply for another schema
+     */
+    bool decode_reply(const SceneParameterSchema& schema, const uint8_t* in, size_t len,
+                      Reply& reply, Update* values, size_t max_values);
+}
+
+} // namespace PixelTheater
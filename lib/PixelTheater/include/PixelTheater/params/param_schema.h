@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -19,6 +20,7 @@ class Scene; // ADDED back forward declaration
 struct ParameterSchema {
     std::string name;
     std::string type;
+    ParamType param_type = ParamType::range;  // Same as type, without the string compares
     std::string description;
     
     // Range information
@@ -50,6 +52,12 @@ struct SceneParameterSchema {
     std::string scene_name;
     std::string scene_description;
     std::vector<ParameterSchema> parameters;
+
+    // Hash of everything above: the same scene and parameters give the same
+    // version on every build and platform, so clients can keep a schema they
+    // fetched earlier and check it is still current. Parameter indices in the
+    // binary protocol (param_protocol.h) are positions in `parameters`.
+    uint32_t version = 0;
     
     // Convert to JSON string
     std::string to_json() const;
@@ -62,6 +70,9 @@ namespace ParamSchema {
     // Function to generate the schema from a Scene instance
     // DECLARATION ONLY
     SceneParameterSchema generate_schema(const Scene& scene);
+
+    // Content hash used for SceneParameterSchema::version
+    uint32_t compute_version(const SceneParameterSchema& schema);
     
     // Convert schema to JSON
     std::string to_json(const SceneParameterSchema& schema);
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PixelTheater/params/param_value.h"
+
+namespace PixelTheater {
+
+class Settings;
+
+/**
+ * @brief Every parameter value of a scene in one fixed-size binary blob.
+ *
+ * Layout: 'P' 'r' | layout hash u32 | count u8 | values length u8 | values.
+ * Values are in declaration order, encoded as in ParamProtocol (4 bytes, or
+ * 1 for switches). The layout hash is Settings::layout_hash(), so a preset
+ * only recalls into a scene with the same parameter names and types.
+ *
+ * No heap: a Preset can be copied, stored and recalled without allocating.
+ */
+class Preset {
+public:
+    static constexpr size_t MAX_SIZE = 256;
+    static constexpr size_t HEADER_SIZE = 8;
+
+    Preset() { clear(); }
+
+    // Load a stored blob; returns valid()
+    bool assign(const uint8_t* data, size_t len);
+    void clear();
+
+    bool valid() const;
+    uint32_t layout() const;
+    size_t count() const { return _data[6]; }
+    const uint8_t* values() const { return _data + HEADER_SIZE; }
+    size_t values_size() const { return _data[7]; }
+
+    // The whole blob, for storage
+    const uint8_t* data() const { return _data; }
+    size_t size() const { return valid() ? HEADER_SIZE + values_size() : 0; }
+
+private:
+    friend class Settings;
+    // Used by Settings::snapshot: header first, then the values written in place
+    uint8_t* begin_write(uint32_t layout, size_t count);
+    void end_write(size_t values_size);
+
+    uint8_t _data[MAX_SIZE];
+};
+
+/**
+ * @brief Interpolates every numeric parameter between two presets over time.
+ *
+ * begin() decodes both presets once into flat from/delta arrays, keeping
+ * only the parameters that differ; each frame update() writes them straight
+ * into Settings by index, with no name lookups or decoding. Counts round to
+ * the nearest integer. Switches and selects cannot be blended and flip to
+ * the target halfway through.
+ */
+class PresetMorph {
+public:
+    static constexpr size_t MAX_PARAMS = 64;
+
+    /**
+     * @brief Start a morph between two presets of this scene.
+     * @return False if either preset does not match the scene's layout
+     */
+    bool begin(const Settings& settings, const Preset& from, const Preset& to, float seconds);
+
+    // Morph from the current values to a preset
+    bool begin(const Settings& settings, const Preset& to, float seconds);
+
+    /**
+     * @brief Advance by dt seconds and write the interpolated values.
+     * @return True while the morph is still running
+     */
+    bool update(Settings& settings, float dt);
+
+    // Write the values at position t (0..1) without touching the morph's clock
+    void apply(Settings& settings, float t) const;
+
+    bool active() const { return _active; }
+    float progress() const { return _t; }
+    void stop() { _active = false; }
+
+private:
+    // Numeric parameters that change
+    float _from[MAX_PARAMS];
+    float _delta[MAX_PARAMS];
+    uint8_t _index[MAX_PARAMS];
+    bool _integer[MAX_PARAMS];
+    size_t _numeric = 0;
+
+    // Switches and selects that change
+    uint8_t _discrete_index[MAX_PARAMS];
+    ParamValue _discrete_from[MAX_PARAMS];
+    ParamValue _discrete_to[MAX_PARAMS];
+    size_t _discrete = 0;
+
+    float _t = 0.0f;
+    float _rate = 0.0f;     // Progress per second
+    bool _active = false;
+};
+
+/**
+ * @brief Byte-addressed persistent store for a PresetBank.
+ *
+ * Implementations: EepromPresetStorage (Teensy EEPROM emulation) and
+ * FilePresetStorage (a file on native builds).
+ */
+class PresetStorage {
+public:
+    virtual ~PresetStorage() = default;
+    virtual size_t capacity() const = 0;
+    virtual bool read(size_t offset, uint8_t* dst, size_t len) = 0;
+    virtual bool write(size_t offset, const uint8_t* src, size_t len) = 0;
+};
+
+/**
+ * @brief Fixed slots of presets, mirrored in RAM.
+ *
+ * load() reads every slot once; after that recall() only touches RAM, so it
+ * is cheap enough for a button handler. save() and store() write through to
+ * the storage (only the bytes the preset uses, to spare EEPROM wear).
+ */
+class PresetBank {
+public:
+    static constexpr size_t SLOT_SIZE = Preset::MAX_SIZE;
+
+    // Slot count is capped to what fits in the storage
+    PresetBank(PresetStorage& storage, size_t slots);
+
+    // Read all slots from storage; returns how many hold a valid preset
+    size_t load();
+
+    size_t slot_count() const { return _slots.size(); }
+
+    // nullptr for an empty slot or one out of range
+    const Preset* slot(size_t index) const;
+
+    bool save(size_t index, const Settings& settings);
+    bool store(size_t index, const Preset& preset);
+    bool recall(size_t index, Settings& settings) const;
+    bool erase(size_t index);
+
+private:
+    PresetStorage& _storage;
+    std::vector<Preset> _slots;
+};
+
+} // namespace PixelTheater
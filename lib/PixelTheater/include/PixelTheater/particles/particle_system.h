@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include "PixelTheater/core/crgb.h"
+#include "PixelTheater/core/iled_buffer.h"
+#include "PixelTheater/core/sphere_hash.h"
+#include "PixelTheater/platform/platform.h"
+
+namespace PixelTheater {
+
+/**
+ * @brief Initial state for one particle, passed to ParticleSystem::spawn()
+ */
+struct ParticleSpawn {
+    float x = 0.0f, y = 0.0f, z = 0.0f;     // Position (model coordinates)
+    float vx = 0.0f, vy = 0.0f, vz = 0.0f;  // Velocity (units/sec)
+    float life = 1.0f;                      // Lifetime in seconds
+    CRGB color = CRGB(255, 255, 255);
+};
+
+/**
+ * @brief Fixed-capacity particle pool stored as structure-of-arrays.
+ *
+ * Live particles are always packed into [0, size()), so loops touch only
+ * live data and removal is an O(1) swap with the last particle. Nothing is
+ * allocated after construction; spawn() simply fails once the pool is full.
+ *
+ * The arrays are public so scenes can apply their own forces in a tight loop:
+ *   for (uint16_t i = 0; i < ps.size(); ++i) ps.vz[i] -= gravity * dt;
+ *
+ * Note: kill() and update() reorder particles, so indices are not stable
+ * across frames.
+ */
+template <uint16_t Capacity>
+class ParticleSystem {
+public:
+    float x[Capacity], y[Capacity], z[Capacity];
+    float vx[Capacity], vy[Capacity], vz[Capacity];
+    float life[Capacity];       // Seconds remaining
+    float max_life[Capacity];   // Lifetime at spawn, for fading
+    CRGB color[Capacity];
+
+    static constexpr uint16_t capacity() { return Capacity; }
+    uint16_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+    bool full() const { return _count >= Capacity; }
+    void clear() { _count = 0; }
+
+    /**
+     * @brief Add a particle. Returns false (and drops it) when the pool is full.
+     */
+    bool spawn(const ParticleSpawn& p) {
+        if (_count >= Capacity || p.life <= 0.0f) return false;
+        const uint16_t i = _count++;
+        x[i] = p.x; y[i] = p.y; z[i] = p.z;
+        vx[i] = p.vx; vy[i] = p.vy; vz[i] = p.vz;
+        life[i] = p.life;
+        max_life[i] = p.life;
+        color[i] = p.color;
+        return true;
+    }
+
+    /**
+     * @brief Remove particle i by moving the last particle into its slot.
+     */
+    void kill(uint16_t i) {
+        if (i >= _count) return;
+        const uint16_t last = --_count;
+        if (i == last) return;
+        x[i] = x[last]; y[i] = y[last]; z[i] = z[last];
+        vx[i] = vx[last]; vy[i] = vy[last]; vz[i] = vz[last];
+        life[i] = life[last];
+        max_life[i] = max_life[last];
+        color[i] = color[last];
+    }
+
+    /**
+     * @brief Integrate positions, age particles and remove the dead ones.
+     * @param dt Seconds since last update
+     * @param radius If > 0, particles are kept on a sphere of this radius and
+     *               their velocity is kept tangent to it
+     * @param drag Fraction of velocity lost per second (0 = none)
+     */
+    void update(float dt, float radius = 0.0f, float drag = 0.0f) {
+        const float damping = drag > 0.0f ? std::max(0.0f, 1.0f - drag * dt) : 1.0f;
+        uint16_t i = 0;
+        while (i < _count) {
+            life[i] -= dt;
+            if (life[i] <= 0.0f) {
+                kill(i); // Re-examine slot i, it now holds the former last particle
+                continue;
+            }
+            vx[i] *= damping; vy[i] *= damping; vz[i] *= damping;
+            x[i] += vx[i] * dt; y[i] += vy[i] * dt; z[i] += vz[i] * dt;
+
+            if (radius > 0.0f) {
+                const float len_sq = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+                if (len_sq > 1e-12f) {
+                    const float inv = 1.0f / std::sqrt(len_sq);
+                    const float nx = x[i] * inv, ny = y[i] * inv, nz = z[i] * inv;
+                    x[i] = nx * radius; y[i] = ny * radius; z[i] = nz * radius;
+                    const float radial = vx[i] * nx + vy[i] * ny + vz[i] * nz;
+                    vx[i] -= radial * nx; vy[i] -= radial * ny; vz[i] -= radial * nz;
+                }
+            }
+            ++i;
+        }
+    }
+
+    /**
+     * @brief Additively splat every particle onto the LEDs within splat_angle.
+     *
+     * Brightness falls off linearly in (1 - cos) from the particle centre to the
+     * edge of the splat and fades with remaining life.
+     *
+     * @param leds Target buffer
+     * @param led_index Spatial hash of the LED positions (see SphereHash::indexModel)
+     * @param splat_angle Splat radius in radians
+     */
+    template <typename LedIndex>
+    void render(ILedBuffer& leds, const LedIndex& led_index, float splat_angle) const {
+        const typename LedIndex::Radius radius(splat_angle);
+        const float cos_r = radius.cos_a;
+        const float inv_span = 1.0f / std::max(1e-6f, 1.0f - cos_r);
+        for (uint16_t i = 0; i < _count; ++i) {
+            const float fade = std::min(1.0f, life[i] / max_life[i]);
+            const CRGB c = color[i];
+            led_index.query(x[i], y[i], z[i], radius, [&](uint16_t led, float dot) {
+                const uint8_t scale = static_cast<uint8_t>((dot - cos_r) * inv_span * fade * 255.0f);
+                if (scale == 0) return;
+                CRGB splat = c;
+                splat.nscale8(scale);
+                leds.led(led) += splat;
+            });
+        }
+    }
+
+private:
+    uint16_t _count = 0;
+};
+
+/**
+ * @brief Emits particles from a point on the sphere at a steady rate.
+ *
+ * Particles leave in a random direction tangent to the sphere, so they travel
+ * across the surface when the system is updated with a radius.
+ */
+struct ParticleEmitter {
+    float x = 0.0f, y = 0.0f, z = 0.0f;  // Emission point (model coordinates)
+    float rate = 10.0f;                  // Particles per second
+    float speed = 50.0f;                 // Initial speed (units/sec)
+    float speed_jitter = 0.0f;           // +/- random speed variation
+    float life = 1.0f;                   // Lifetime in seconds
+    float life_jitter = 0.0f;            // +/- random lifetime variation
+    CRGB color = CRGB(255, 255, 255);
+
+    /**
+     * @brief Spawn this frame's share of particles.
+     * Fractional particles carry over to the next frame, so low rates still emit.
+     * @return Number of particles spawned
+     */
+    template <uint16_t Capacity>
+    uint16_t emit(ParticleSystem<Capacity>& system, float dt, Platform& rng) {
+        _accumulator += rate * dt;
+        uint16_t spawned = 0;
+        while (_accumulator >= 1.0f) {
+            _accumulator -= 1.0f;
+            if (!system.spawn(makeParticle(rng))) {
+                _accumulator = 0.0f; // Pool full, don't build up a burst
+                break;
+            }
+            ++spawned;
+        }
+        return spawned;
+    }
+
+    ParticleSpawn makeParticle(Platform& rng) const {
+        ParticleSpawn p;
+        p.x = x; p.y = y; p.z = z;
+        p.color = color;
+        p.life = std::max(0.01f, life + rng.randomFloat(-life_jitter, life_jitter));
+
+        // Random direction with the radial component removed
+        float dx = rng.randomFloat(-1.0f, 1.0f);
+        float dy = rng.randomFloat(-1.0f, 1.0f);
+        float dz = rng.randomFloat(-1.0f, 1.0f);
+        const float len_sq = x * x + y * y + z * z;
+        if (len_sq > 1e-12f) {
+            const float radial = (dx * x + dy * y + dz * z) / len_sq;
+            dx -= radial * x; dy -= radial * y; dz -= radial * z;
+        }
+        const float d_len = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const float v = speed + rng.randomFloat(-speed_jitter, speed_jitter);
+        if (d_len > 1e-6f) {
+            p.vx = dx / d_len * v; p.vy = dy / d_len * v; p.vz = dz / d_len * v;
+        }
+        return p;
+    }
+
+private:
+    float _accumulator = 0.0f;
+};
+
+} // namespace PixelTheater
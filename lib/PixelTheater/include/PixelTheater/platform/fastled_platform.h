@@ -1,5 +1,7 @@
 #pragma once
 #include "platform.h"
+#include "output_map.h"
+#include "PixelTheater/core/log.h"
 #include <FastLED.h>
 #include <Arduino.h> // For millis(), random(), etc.
 #include <HardwareSerial.h> // For Serial.printf
@@ -17,9 +19,39 @@ public:
     CRGB* getLEDs() override { return _leds; }
     uint16_t getNumLEDs() const override { return _num_leds; }
     
-    void show() override { FastLED.show(); }
+    void show() override {
+        if (_output_map) {
+            // Channels of unchanged LEDs still hold them from the last gather
+            const uint16_t channels = _dirty_tracker && !_output_stale ? _output_map->dirtyChannels(*_dirty_tracker)
+                                                                       : OutputMap::ALL_CHANNELS;
+            _output_map->gather(_leds, _output, channels);
+            _output_stale = false;
+        }
+        FastLED.show();
+    }
     void setBrightness(uint8_t b) override { FastLED.setBrightness(b); }
-    void clear() override { FastLED.clear(); }
+    void clear() override {
+        if (_output_map) fill_solid(_leds, _num_leds, CRGB::Black);
+        FastLED.clear();
+        _output_stale = true; // Behind the tracker's back
+    }
+    void setDirtyTracker(const DirtyTracker* tracker) override {
+        _dirty_tracker = tracker;
+        _output_stale = true;
+    }
+
+    /**
+     * @brief Parallel output: the LED array stays in model order for scenes,
+     * and show() first gathers it into output (map.bufferSize() LEDs), whose
+     * channels were added to FastLED one controller per pin. nullptr turns
+     * it off, for when the controllers were added on the LED array itself.
+     * While a dirty tracker is set, only channels with changed LEDs are gathered.
+     */
+    void setOutput(const OutputMap* map, CRGB* output) {
+        _output_map = output ? map : nullptr;
+        _output = output;
+        _output_stale = true;
+    }
     
     void setMaxRefreshRate(uint8_t fps) override { FastLED.setMaxRefreshRate(fps); }
     void setDither(uint8_t dither) override { FastLED.setDither(dither); }
@@ -44,6 +76,10 @@ public:
 private:
     CRGB* _leds;
     uint16_t _num_leds;
+    const OutputMap* _output_map = nullptr;
+    CRGB* _output = nullptr;
+    const DirtyTracker* _dirty_tracker = nullptr;
+    bool _output_stale = true; // _output doesn't match the LEDs: gather every channel
 };
 
 // --- Inline Implementations (or move to .cpp) ---
@@ -67,6 +103,7 @@ inline float FastLEDPlatform::randomFloat(float min, float max) {
     return min + randomFloat() * (max - min);
 }
 inline void FastLEDPlatform::logInfo(const char* format, ...) {
+    if (!Log::enabled(Log::Info)) return;
     if (Serial) {
         va_list args;
         va_start(args, format);
@@ -77,6 +114,7 @@ inline void FastLEDPlatform::logInfo(const char* format, ...) {
     }
 }
 inline void FastLEDPlatform::logWarning(const char* format, ...) {
+    if (!Log::enabled(Log::Warning)) return;
      if (Serial) {
         va_list args;
         va_start(args, format);
@@ -87,6 +125,7 @@ inline void FastLEDPlatform::logWarning(const char* format, ...) {
     }
 }
 inline void FastLEDPlatform::logError(const char* format, ...) {
+    if (!Log::enabled(Log::Error)) return;
      if (Serial) {
         va_list args;
         va_start(args, format);
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <vector>
 #include "PixelTheater/core/crgb.h"
 #include "platform.h"
+#include "output_map.h"
 
 namespace PixelTheater {
 
@@ -45,12 +47,29 @@ public:
     void logWarning(const char* format, ...) override;
     void logError(const char* format, ...) override;
 
+    /**
+     * @brief Send each frame to a multi-channel driver: show() passes every
+     * channel of map to driver as wire bytes (in order, at the current
+     * brightness), then calls driver->show(). Both must outlive the
+     * platform; nullptr turns output off. While a dirty tracker is set,
+     * channels whose LEDs did not change are not written again.
+     */
+    void setOutput(const OutputMap* map, OutputDriver* driver, ColorOrder order = ColorOrder::GRB);
+    void setDirtyTracker(const DirtyTracker* tracker) override;
+
 private:
     CRGB* _leds{nullptr};
     uint16_t _num_leds{0};
     uint8_t _brightness{255};
     uint8_t _max_refresh_rate{0};
     uint8_t _dither{0};
+
+    const OutputMap* _output_map{nullptr};
+    OutputDriver* _output_driver{nullptr};
+    ColorOrder _output_order{ColorOrder::GRB};
+    std::vector<uint8_t> _output_bytes;     // One channel, sized by setOutput()
+    const DirtyTracker* _dirty_tracker{nullptr};
+    bool _output_stale{true};               // The driver's bytes don't match the LEDs: write every channel
 };
 
 } // namespace PixelTheater 
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PixelTheater/core/crgb.h"
+
+namespace PixelTheater {
+
+class DirtyTracker;
+class IModel;
+
+// Byte order on the wire; WS2812 strips take GRB
+enum class ColorOrder : uint8_t { RGB, RBG, GRB, GBR, BRG, BGR };
+
+/**
+ * @brief Where each LED of the model goes on a parallel output: logical LED
+ * index (what scenes draw) -> (channel, position along that channel's strip).
+ *
+ * Parallel drivers clock every channel at once, so a frame takes as long as
+ * the longest strip; more, shorter channels mean a shorter frame. The map
+ * is built once, in setup(), into two tables over a channel-major output
+ * buffer in which channel c occupies
+ * [c * stride(), c * stride() + channelLength(c)):
+ *   - slot(i): where logical LED i goes in that buffer
+ *   - source(c, p): the logical LED at position p of channel c
+ * so gather() and channelBytes() are one straight pass per frame.
+ *
+ * Usage:
+ *   OutputMap map;
+ *   map.splitByFace(model, 4);      // 4 pins, whole faces on each
+ *   map.gather(leds, out);          // out holds map.bufferSize() LEDs
+ */
+class OutputMap {
+public:
+    static constexpr size_t MAX_CHANNELS = 16;
+    static constexpr uint16_t ALL_CHANNELS = 0xFFFF; // One bit per channel
+
+    /**
+     * @brief Cut LEDs 0..led_count-1 into channels runs of (nearly) equal
+     * length, in order.
+     * @return false for 0 or more than MAX_CHANNELS channels, or more than
+     * Limits::ABSOLUTE_MAX_LEDS LEDs; the map is then empty
+     */
+    bool splitEvenly(size_t led_count, size_t channels);
+
+    /**
+     * @brief Give each channel a run of whole faces, in model order, such
+     * that the longest channel is as short as it can be. Faces are not cut
+     * because strips are wired face by face. With two channels on
+     * DodecaRGBv2 this is the original wiring: faces 0-5 and 6-11.
+     */
+    bool splitByFace(const IModel& model, size_t channels);
+
+    /**
+     * @brief Hand wiring: face f goes on channel face_channel[f] (one entry
+     * per face), and each channel runs through its faces in model order.
+     */
+    bool assignFaces(const IModel& model, const uint8_t* face_channel, size_t channels);
+
+    size_t channels() const { return _channels; }
+    size_t ledCount() const { return _slot.size(); }
+    size_t channelLength(size_t channel) const { return _length[channel]; }
+
+    // Longest channel: the output buffer's channel pitch and the frame's
+    // transmit length
+    size_t stride() const { return _stride; }
+    size_t bufferSize() const { return _channels * _stride; }
+
+    uint32_t slot(size_t led) const { return _slot[led]; }
+    size_t channelOf(size_t led) const { return _slot[led] / _stride; }
+    size_t positionOf(size_t led) const { return _slot[led] % _stride; }
+    uint16_t source(size_t channel, size_t position) const { return _source[channel * _stride + position]; }
+
+    // out[slot(i)] = leds[i] for the channels set in channel_mask; the padding
+    // after shorter channels is not touched
+    void gather(const CRGB* leds, CRGB* out, uint16_t channel_mask = ALL_CHANNELS) const;
+
+    /**
+     * @brief Channels holding any LED changed in the tracker's latest
+     * capture, one bit each: the ones output has to resend. Costs a pass
+     * over the dirty LEDs only. ALL_CHANNELS if the tracker is sized for
+     * another LED count.
+     */
+    uint16_t dirtyChannels(const DirtyTracker& tracker) const;
+
+    /**
+     * @brief One channel as it goes down the wire: channelLength() * 3
+     * bytes in the given order, scaled by brightness as FastLED's show()
+     * does. bytes must hold stride() * 3.
+     * @return Bytes written
+     */
+    size_t channelBytes(size_t channel, const CRGB* leds, uint8_t* bytes,
+                        ColorOrder order = ColorOrder::GRB, uint8_t brightness = 255) const;
+
+private:
+    // Build the tables from each LED's channel; LEDs keep their logical
+    // order within a channel
+    bool build(const std::vector<uint8_t>& led_channel, size_t channels);
+    void reset();
+
+    size_t _channels = 0;
+    size_t _stride = 0;
+    uint16_t _length[MAX_CHANNELS] = {};
+    std::vector<uint32_t> _slot;        // Per logical LED
+    std::vector<uint16_t> _source;      // Per output slot; 0xFFFF for padding
+};
+
+/**
+ * @brief A multi-channel LED driver fed by a platform with an OutputMap,
+ * one channel's wire bytes at a time. A channel not written since the last
+ * show() is unchanged: the driver sends its previous bytes again.
+ */
+class OutputDriver {
+public:
+    virtual ~OutputDriver() = default;
+    virtual void write(size_t channel, const uint8_t* bytes, size_t size) = 0;
+    // Every channel has been written: send the frame
+    virtual void show() = 0;
+};
+
+} // namespace PixelTheater
@@ -9,6 +9,8 @@ namespace PixelTheater {
 // void fill_solid(CRGB* leds, size_t num_leds, const CRGB& color);
 void nscale8(CRGB* leds, size_t num_leds, uint8_t scale);
 
+class DirtyTracker;
+
 class Platform {
 public:
     virtual ~Platform() = default;
@@ -22,6 +24,10 @@ public:
     virtual void setBrightness(uint8_t brightness) = 0;
     virtual void clear() = 0;
 
+    // LEDs changed in the frame about to be shown, or nullptr when the scene
+    // doesn't track them (see DirtyTracker). Output may then skip unchanged channels.
+    virtual void setDirtyTracker(const DirtyTracker* tracker) { (void)tracker; }
+
     // Performance settings
     virtual void setMaxRefreshRate(uint8_t fps) = 0;
     virtual void setDither(uint8_t dither) = 0;
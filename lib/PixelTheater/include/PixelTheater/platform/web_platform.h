@@ -6,6 +6,7 @@
 #include "PixelTheater/platform/webgl/renderer.h"
 #include "PixelTheater/platform/webgl/mesh.h"
 #include "PixelTheater/model_def.h"
+#include "PixelTheater/model/model_blob.h"
 #include "PixelTheater/platform/webgl/web_model.h"
 #include "PixelTheater/platform/webgl/shaders.h"
 #include "PixelTheater/model/point.h"
@@ -87,29 +88,48 @@ public:
         model.metadata.version = ModelDef::VERSION;
         model.metadata.num_leds = ModelDef::LED_COUNT;
         
-        // LED positions
         model.leds.positions.reserve(ModelDef::LED_COUNT);
-        for (uint16_t i = 0; i < ModelDef::LED_COUNT; i++) {
-            // Get coordinates directly from POINTS array
-            const auto& point = ModelDef::POINTS[i];
-            model.leds.positions.push_back({point.x, point.y, point.z});
-        }
-        
-        // Geometry
         model.geometry.faces.reserve(ModelDef::FACE_COUNT);
-        for (uint16_t face = 0; face < ModelDef::FACE_COUNT; face++) {
-            WebFace web_face;
-            for (uint16_t i = 0; i < 5; i++) {
-                web_face.vertices[i] = {
-                    ModelDef::FACES[face].vertices[i].x,
-                    ModelDef::FACES[face].vertices[i].y,
-                    ModelDef::FACES[face].vertices[i].z
-                };
+        if constexpr (HasModelBlob<ModelDef>::value) {
+            // Compiled model: read the blob in place
+            ModelBlobReader blob(reinterpret_cast<const uint8_t*>(ModelDef::BLOB), ModelDef::BLOB_SIZE);
+            if (!blob.valid()) return model;
+            for (uint16_t i = 0; i < blob.ledCount(); i++) {
+                const auto point = blob.point(i);
+                model.leds.positions.push_back({point.x, point.y, point.z});
+            }
+            for (uint16_t face = 0; face < blob.faceCount(); face++) {
+                const auto face_data = blob.face(face);
+                WebFace web_face;
+                for (uint16_t i = 0; i < 5; i++) {
+                    web_face.vertices[i] = {face_data.vertices[i].x, face_data.vertices[i].y, face_data.vertices[i].z};
+                }
+                model.geometry.faces.push_back(web_face);
+            }
+            return model;
+        } else {
+            // LED positions
+            for (uint16_t i = 0; i < ModelDef::LED_COUNT; i++) {
+                // Get coordinates directly from POINTS array
+                const auto& point = ModelDef::POINTS[i];
+                model.leds.positions.push_back({point.x, point.y, point.z});
             }
-            model.geometry.faces.push_back(web_face);
+
+            // Geometry
+            for (uint16_t face = 0; face < ModelDef::FACE_COUNT; face++) {
+                WebFace web_face;
+                for (uint16_t i = 0; i < 5; i++) {
+                    web_face.vertices[i] = {
+                        ModelDef::FACES[face].vertices[i].x,
+                        ModelDef::FACES[face].vertices[i].y,
+                        ModelDef::FACES[face].vertices[i].z
+                    };
+                }
+                model.geometry.faces.push_back(web_face);
+            }
+
+            return model;
         }
-        
-        return model;
     }
 
     // Initialize with a specific model (Web-specific)
@@ -5,13 +5,19 @@
 #include <vector>
 #include "settings.h"
 #include "settings_proxy.h"
+#include "params/modulation.h"
+#include "core/arena.h"
+#include "core/binary_log.h"
+#include "core/quality.h"
+#include "core/post_process.h"
+#include "core/log.h"
 #include "params/param_def.h"
 #include "params/param_value.h"
 #include "model/model.h"
 #include "platform/platform.h"
 #include "core/imodel.h"
 #include "core/iled_buffer.h"
-#include <cstdarg>
+#include <cstdio>
 
 // Forward declare to avoid circular dependency
 namespace PixelTheater {
@@ -142,9 +148,20 @@ namespace PixelTheater {
          */
         virtual void reset() {
             _tick_count = 0; // Ensure reset happens first
+            if (_modulation) _modulation->clear(); // setup() adds its routes again
+            _quality.clear();                      // ...declares its quality knobs again
+            if (_post) _post->clear();             // ...and its post-processing stages
+            _arena.reset();                        // ...and allocates again
             settings.reset_all();
         }
 
+        /**
+         * Called instead of reset() and setup() when a scene that retains
+         * its state becomes active again (see set_retain_state)
+         * Optional override
+         */
+        virtual void resume() {}
+
         /**
          * Set scene name
          * @param name Scene name
@@ -177,6 +194,103 @@ namespace PixelTheater {
             _author = author;
         }
 
+        /**
+         * Ask the Theater to track which LEDs change each frame (see DirtyTracker).
+         * Off by default; it costs a compare of the whole buffer per frame, so
+         * enable it in setup() for sparse scenes whose consumers use it.
+         * @param enabled Whether to track changes while this scene runs
+         */
+        void set_dirty_tracking(bool enabled) {
+            _dirty_tracking = enabled;
+        }
+
+        /**
+         * Parameter modulation (LFOs, random walks, envelopes) for this scene.
+         * Created on first use, normally in setup(); the Theater updates it
+         * before every tick().
+         */
+        ModulationMatrix& modulation() {
+            if (!_modulation) _modulation = std::make_unique<ModulationMatrix>(_settings_storage);
+            return *_modulation;
+        }
+
+        /**
+         * Memory for this scene's buffers and agents (see Arena). Reserve and
+         * allocate in setup(); it is released by reset(), before the next
+         * setup(), so tick() never has to touch the heap.
+         */
+        Arena& arena() {
+            return _arena;
+        }
+
+        /**
+         * Post-processing stages (blur, bloom, trails) run on the LEDs after
+         * every tick(). Created on first use; add stages in setup(), which
+         * also allocates their buffers.
+         */
+        PostProcess& post_process() {
+            if (!_post) _post = std::make_unique<PostProcess>(model(), ledCount());
+            return *_post;
+        }
+
+        /**
+         * Run the post-processing stages; a no-op for scenes that never used them
+         * @param dt Seconds since the previous frame
+         */
+        void apply_post_process(float dt) {
+            if (_post && leds_ptr) _post->apply(leds_ptr->data(), leds_ptr->ledCount(), dt);
+        }
+
+        /**
+         * Quality knobs declared with quality_knob(). The Theater's
+         * QualityGovernor moves them while the scene runs.
+         */
+        QualityKnobs& quality_knobs() {
+            return _quality;
+        }
+        const QualityKnobs& quality_knobs() const {
+            return _quality;
+        }
+
+        /**
+         * Advance modulation by dt seconds; a no-op for scenes that never used it
+         */
+        void update_modulation(float dt) {
+            if (_modulation) _modulation->update(dt);
+        }
+
+        /**
+         * Keep this scene's state across scene switches. The Theater then runs
+         * reset() and setup() only the first time the scene is shown (or
+         * prewarmed), and calls resume() on later visits, so returning to it
+         * costs nothing and it carries on where it left off.
+         * @param enabled Whether to keep state while other scenes run
+         */
+        void set_retain_state(bool enabled) {
+            _retain_state = enabled;
+        }
+
+        /**
+         * Whether this scene keeps its state across switches
+         */
+        bool retain_state() const {
+            return _retain_state;
+        }
+
+        /**
+         * Whether setup() has run and the scene can start without it
+         */
+        bool prepared() const {
+            return _prepared;
+        }
+
+        /**
+         * Whether this scene asked for dirty tracking
+         */
+        bool dirty_tracking() const {
+            return _dirty_tracking;
+        }
+
         /**
          * Get scene name
          * @return Name of the scene
@@ -252,18 +366,24 @@ namespace PixelTheater {
 
         /**
          * Get parameter schema for this scene
+         * Cached; rebuilt only after parameters, name or description change.
          * @return Parameter schema
          */
-        SceneParameterSchema parameter_schema() const {
-            return ParamSchema::generate_schema(*this);
-        }
+        const SceneParameterSchema& parameter_schema() const;
 
         /**
          * Get parameter schema as JSON string
+         * Cached alongside parameter_schema().
          * @return JSON string
          */
-        std::string parameter_schema_json() const {
-            return parameter_schema().to_json();
+        const std::string& parameter_schema_json() const;
+
+        /**
+         * Content hash of the parameter schema (SceneParameterSchema::version)
+         * @return Schema version, stable across builds for the same parameters
+         */
+        uint32_t schema_version() const {
+            return parameter_schema().version;
         }
 
         // --- ADDED: Virtual status method ---
@@ -320,63 +440,19 @@ namespace PixelTheater {
         // Math/Random Utilities Helpers
         // ... random*() ...
 
-        // Logging Utilities Helpers (Variadic)
-        // Non-const versions
-        void logInfo(const char* format, ...) {
-            if (!platform_ptr) return;
-            char buffer[256]; // Static buffer, adjust size if needed
-            va_list args;
-            va_start(args, format);
-            vsnprintf(buffer, sizeof(buffer), format, args);
-            va_end(args);
-            platform_ptr->logInfo(buffer); // Pass the formatted buffer
-        }
-        void logWarning(const char* format, ...) {
-            if (!platform_ptr) return;
-            char buffer[256];
-            va_list args;
-            va_start(args, format);
-            vsnprintf(buffer, sizeof(buffer), format, args);
-            va_end(args);
-            platform_ptr->logWarning(buffer); // Pass the formatted buffer
-        }
-        void logError(const char* format, ...) {
-            if (!platform_ptr) return;
-            char buffer[256];
-            va_list args;
-            va_start(args, format);
-            vsnprintf(buffer, sizeof(buffer), format, args);
-            va_end(args);
-            platform_ptr->logError(buffer); // Pass the formatted buffer
-        }
-        // Const versions
-        void logInfo(const char* format, ...) const {
-            if (!platform_ptr) return;
-            char buffer[256];
-            va_list args;
-            va_start(args, format);
-            vsnprintf(buffer, sizeof(buffer), format, args);
-            va_end(args);
-            platform_ptr->logInfo(buffer);
-        }
-        void logWarning(const char* format, ...) const {
-            if (!platform_ptr) return;
-            char buffer[256];
-            va_list args;
-            va_start(args, format);
-            vsnprintf(buffer, sizeof(buffer), format, args);
-            va_end(args);
-            platform_ptr->logWarning(buffer); 
-        }
-        void logError(const char* format, ...) const {
-            if (!platform_ptr) return;
-            char buffer[256];
-            va_list args;
-            va_start(args, format);
-            vsnprintf(buffer, sizeof(buffer), format, args);
-            va_end(args);
-            platform_ptr->logError(buffer);
-        }
+        // Logging Utilities Helpers
+        // Levels above PIXELTHEATER_LOG_LEVEL compile to nothing. With
+        // PIXELTHEATER_LOG_DEFERRED the message goes to Log::deferred() as
+        // raw arguments (format must be a literal); otherwise it is
+        // formatted now and passed to the platform.
+        template <typename... Args>
+        void logInfo(const char* format, Args... args) const { log_at<Log::Info>(format, args...); }
+        template <typename... Args>
+        void logWarning(const char* format, Args... args) const { log_at<Log::Warning>(format, args...); }
+        template <typename... Args>
+        void logError(const char* format, Args... args) const { log_at<Log::Error>(format, args...); }
+        template <typename... Args>
+        void logDebug(const char* format, Args... args) const { log_at<Log::Debug>(format, args...); }
         
         // --- End Scene Helper Methods --- 
 
@@ -397,6 +473,20 @@ namespace PixelTheater {
         Platform* platform_ptr = nullptr;
         // Initialized tick count (matches initializer list order)
         size_t _tick_count{0}; 
+        bool _dirty_tracking = false;
+        bool _retain_state = false;
+        bool _prepared = false;    // Set by the Theater once setup() has run
+
+        std::unique_ptr<ModulationMatrix> _modulation;
+        Arena _arena;
+        QualityKnobs _quality;
+        std::unique_ptr<PostProcess> _post;
+
+        // Parameter schema cache, keyed on the Settings schema revision
+        mutable SceneParameterSchema _schema_cache;
+        mutable std::string _schema_json_cache;
+        mutable uint32_t _schema_cache_revision = 0;
+        mutable bool _schema_json_valid = false;
 
         /**
          * Define a parameter with a string type and default value
@@ -480,6 +570,40 @@ namespace PixelTheater {
             else param(name, type, default_val, flags, description);
         }
 
+        /**
+         * Declare something this scene can do less of when frames run over
+         * budget (see QualityKnobs). Call in setup(), cheapest to lose first.
+         * @param name Knob name (a string literal)
+         * @param levels Number of levels; 2 for on/off
+         * @return Handle for quality_level() and friends
+         */
+        size_t quality_knob(const char* name, uint8_t levels = 2) {
+            return _quality.add(name, levels);
+        }
+
+        /**
+         * Current level of a knob, 0 (cheapest) to levels - 1 (full quality)
+         */
+        uint8_t quality_level(size_t knob) const {
+            return _quality.level(knob);
+        }
+
+        /**
+         * Whether a knob is at full quality; for on/off knobs such as a blur pass
+         */
+        bool quality_full(size_t knob) const {
+            return _quality.level(knob) + 1 >= _quality.levels(knob);
+        }
+
+        /**
+         * Scale a count by a knob: full at full quality, minimum at level 0,
+         * evenly in between. E.g. quality_scale(agents_knob, settings["count"], 10)
+         */
+        int quality_scale(size_t knob, int full, int minimum) const {
+            if (full <= minimum) return full;
+            return minimum + static_cast<int>((full - minimum) * _quality.ratio(knob) + 0.5f);
+        }
+
         // Metadata Definition Method
         void meta(const std::string& key, const std::string& value) {
             // TODO: Implement proper metadata storage if needed beyond settings
@@ -505,6 +629,26 @@ namespace PixelTheater {
 
     private:
         friend class Theater; 
+
+        template <Log::Level Level, typename... Args>
+        void log_at(const char* format, Args... args) const {
+            if constexpr (Log::enabled(Level)) {
+#ifdef PIXELTHEATER_LOG_DEFERRED
+                Log::deferred().record(Level, format, args...);
+#else
+                if (!platform_ptr) return;
+                char buffer[256];
+                if constexpr (sizeof...(Args) == 0) {
+                    snprintf(buffer, sizeof(buffer), "%s", format);
+                } else {
+                    snprintf(buffer, sizeof(buffer), format, args...);
+                }
+                if (Level == Log::Error) platform_ptr->logError("%s", buffer);
+                else if (Level == Log::Warning) platform_ptr->logWarning("%s", buffer);
+                else platform_ptr->logInfo("%s", buffer);
+#endif
+            }
+        }
         // Allow the specific test fixture template to access connect
         template<typename SceneType> friend struct ::NewSceneFixture; 
         
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "PixelTheater/scene.h"
+
+namespace PixelTheater {
+
+// Builds a scene in place at `where` and returns it
+using SceneFactory = Scene* (*)(void* where);
+
+namespace detail {
+    template <typename SceneType>
+    Scene* construct_scene(void* where) { return new (where) SceneType(); }
+
+    constexpr size_t max_of() { return 0; }
+    template <typename... Rest>
+    constexpr size_t max_of(size_t first, Rest... rest) {
+        return first > max_of(rest...) ? first : max_of(rest...);
+    }
+}
+
+/**
+ * @brief Compile-time list of scene types, for Theater::useSceneList().
+ *
+ * Nothing is constructed here: the list only knows how big the largest
+ * scene is and how to build each one, so the Theater can keep a single
+ * statically sized buffer and construct scenes into it on activation.
+ *
+ *   using Show = SceneList<SparklesScene, BoidsScene, BlobScene>;
+ *   theater.useSceneList<Show>();
+ */
+template <typename... SceneTypes>
+struct SceneList {
+    static_assert(sizeof...(SceneTypes) > 0, "SceneList needs at least one scene");
+    static_assert((std::is_base_of<Scene, SceneTypes>::value && ...),
+                  "SceneList types must inherit from PixelTheater::Scene");
+
+    static constexpr size_t count = sizeof...(SceneTypes);
+    static constexpr size_t max_align = detail::max_of(alignof(SceneTypes)...);
+    // Bytes for one scene of any type, padded so slots stay aligned
+    static constexpr size_t slot_size =
+        (detail::max_of(sizeof(SceneTypes)...) + max_align - 1) / max_align * max_align;
+    // What constructing every scene up front would take
+    static constexpr size_t total_size = (0 + ... + sizeof(SceneTypes));
+
+    static constexpr SceneFactory factories[count] = { &detail::construct_scene<SceneTypes>... };
+};
+
+} // namespace PixelTheater
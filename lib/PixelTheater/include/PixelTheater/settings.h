@@ -1,6 +1,8 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "params/param_def.h"
 #include "params/param_value.h"
 
@@ -11,6 +13,8 @@
 
 namespace PixelTheater {
 
+class Preset;
+
 class Settings {
 public:
     // Constructors
@@ -23,6 +27,15 @@ public:
     void set_value(const std::string& name, const ParamValue& value);
     ParamValue get_value(const std::string& name) const;
 
+    // Value access by index (declaration order), without the name lookup.
+    // Indices are valid until parameters are added.
+    size_t size() const { return _defs.size(); }
+    int index_of(const std::string& name) const;  // -1 if missing
+    int index_of(const char* name) const;         // Same, without building a std::string
+    void set_value_at(size_t index, const ParamValue& value);
+    const ParamValue& value_at(size_t index) const { return _values[index]; }
+    const ParamDef& metadata_at(size_t index) const { return _defs[index]; }
+
     // Metadata access
     const ParamDef& get_metadata(const std::string& name) const;
     ParamType get_type(const std::string& name) const;
@@ -57,12 +70,29 @@ public:
     // Value validation
     bool is_valid_value(const std::string& name, const ParamValue& value) const;
     
-    // Get all parameter names
+    // Get all parameter names, in the order they were declared
     std::vector<std::string> get_parameter_names() const;
 
+    // Changes whenever parameters are added or replaced (not when values change).
+    // Unique across all Settings objects, so it is safe to key caches on.
+    uint32_t schema_revision() const { return _schema_revision; }
+
+    // Hash of the parameter names and types in order; the same on every run,
+    // so stored presets can be checked against it
+    uint32_t layout_hash() const { return _layout_hash; }
+
+    // Presets: every value in one compact binary blob (see preset.h)
+    bool snapshot(Preset& preset) const;
+    bool recall(const Preset& preset);
+
 private:
-    std::unordered_map<std::string, ParamDef> _params;
-    std::unordered_map<std::string, ParamValue> _values;
+    void update_layout_hash();
+
+    std::vector<ParamDef> _defs;                    // Declaration order
+    std::vector<ParamValue> _values;                // Parallel to _defs
+    std::unordered_map<std::string, size_t> _index; // Name to position
+    uint32_t _schema_revision = 0;
+    uint32_t _layout_hash = 0;
 };
 
 } // namespace PixelTheater 
\ No newline at end of file
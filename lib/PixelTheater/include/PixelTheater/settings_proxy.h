@@ -23,85 +23,101 @@ public:
     }
 
     // Parameter proxy returned by operator[]
+    //  - Resolves the name to an index once, so reads in tick() neither
+    //    allocate nor hash; only an unknown name is copied (for warnings)
     class Parameter {
     public:
         Parameter(Settings& settings, const std::string& name)
             : _settings(settings)
-            , _name(name)
-        {}
+            , _index(settings.index_of(name))
+        {
+            if (_index < 0) _missing = name;
+        }
+        Parameter(Settings& settings, const char* name)
+            : _settings(settings)
+            , _index(settings.index_of(name))
+        {
+            if (_index < 0) _missing = name;
+        }
 
         // Direct value access
         operator float() const {
-            ParamValue val = _settings.get_value(_name);
-            return val.as_float();
+            return value().as_float();
         }
         operator int() const {
-            ParamValue val = _settings.get_value(_name);
-            return val.as_int();
+            return value().as_int();
         }
         operator bool() const {
-            ParamValue val = _settings.get_value(_name);
-            return val.as_bool();
+            return value().as_bool();
         }
         
         // Add conversion operator for uint8_t
         operator uint8_t() const {
-            ParamValue val = _settings.get_value(_name);
-            return static_cast<uint8_t>(val.as_int());
+            return static_cast<uint8_t>(value().as_int());
         }
 
         // Direct assignment
         Parameter& operator=(float value) {
             ParamValue val(value);
-            if (!_settings.is_valid_value(_name, val)) {
+            if (!_settings.is_valid_value(key(), val)) {
                 Log::warning("[WARNING] Parameter '%s': invalid value %.2f. Using sentinel.\n", 
-                    _name.c_str(), value);
-                val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(_name).type);
+                    key().c_str(), value);
+                val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(key()).type);
             }
-            _settings.set_value(_name, val);
+            _settings.set_value(key(), val);
             return *this;
         }
         Parameter& operator=(int value) {
             ParamValue val(value);
-            if (!_settings.is_valid_value(_name, val)) {
+            if (!_settings.is_valid_value(key(), val)) {
                 Log::warning("[WARNING] Parameter '%s': invalid value %d. Using sentinel.\n", 
-                    _name.c_str(), value);
-                val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(_name).type);
+                    key().c_str(), value);
+                val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(key()).type);
             }
-            _settings.set_value(_name, val);
+            _settings.set_value(key(), val);
             return *this;
         }
         Parameter& operator=(bool value) {
             ParamValue val(value);
-            if (!_settings.is_valid_value(_name, val)) {
+            if (!_settings.is_valid_value(key(), val)) {
                 Log::warning("[WARNING] Parameter '%s': invalid value %s. Using sentinel.\n", 
-                    _name.c_str(), value ? "true" : "false");
-                val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(_name).type);
+                    key().c_str(), value ? "true" : "false");
+                val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(key()).type);
             }
-            _settings.set_value(_name, val);
+            _settings.set_value(key(), val);
             return *this;
         }
         Parameter& operator=(const ParamValue& value) {
-            if (!_settings.is_valid_value(_name, value)) {
-                Log::warning("[WARNING] Parameter '%s': invalid value. Using sentinel.\n", _name.c_str());
-                ParamValue val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(_name).type);
-                _settings.set_value(_name, val);
+            if (!_settings.is_valid_value(key(), value)) {
+                Log::warning("[WARNING] Parameter '%s': invalid value. Using sentinel.\n", key().c_str());
+                ParamValue val = ParamHandlers::TypeHandler::get_sentinel_for_type(_settings.get_metadata(key()).type);
+                _settings.set_value(key(), val);
             } else {
-                _settings.set_value(_name, value);
+                _settings.set_value(key(), value);
             }
             return *this;
         }
 
         // Direct metadata access
-        float min() const { return _settings.get_metadata(_name).get_min(); }
-        float max() const { return _settings.get_metadata(_name).get_max(); }
-        bool has_flag(ParamFlags flag) const { return _settings.get_metadata(_name).has_flag(flag); }
-        std::string name() const { return _settings.get_metadata(_name).name; }
-        std::string description() const { return _settings.get_metadata(_name).description; }
+        float min() const { return _settings.get_metadata(key()).get_min(); }
+        float max() const { return _settings.get_metadata(key()).get_max(); }
+        bool has_flag(ParamFlags flag) const { return _settings.get_metadata(key()).has_flag(flag); }
+        std::string name() const { return _settings.get_metadata(key()).name; }
+        std::string description() const { return _settings.get_metadata(key()).description; }
 
     private:
+        // The definition's own name, so lookups by name need no copy
+        const std::string& key() const {
+            return _index >= 0 ? _settings.metadata_at(static_cast<size_t>(_index)).name : _missing;
+        }
+
+        ParamValue value() const {
+            return _index >= 0 ? _settings.value_at(static_cast<size_t>(_index)) : _settings.get_value(_missing);
+        }
+
         Settings& _settings;
-        std::string _name;
+        int _index;
+        std::string _missing;   // The name, only when it isn't a parameter
     };
 
     // Return Parameter proxy for operator[]
@@ -111,6 +127,12 @@ public:
     const Parameter operator[](const std::string& name) const { 
         return Parameter(_settings, name); 
     }
+    Parameter operator[](const char* name) {
+        return Parameter(_settings, name);
+    }
+    const Parameter operator[](const char* name) const { 
+        return Parameter(_settings, name); 
+    }
 
     // Direct methods for adding range parameters
     void add_range_parameter(const std::string& name, 
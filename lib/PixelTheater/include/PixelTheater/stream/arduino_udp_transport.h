@@ -0,0 +1,42 @@
+#pragma once
+
+#include "PixelTheater/stream/packet_transport.h"
+#include <Arduino.h>
+#include <Udp.h>
+
+namespace PixelTheater {
+
+/**
+ * @brief PacketTransport over any Arduino UDP implementation, e.g.
+ * QNEthernet's EthernetUDP on the Teensy 4.1. The caller owns the UDP
+ * object and calls begin(port) on it.
+ */
+class ArduinoUdpTransport : public PacketTransport {
+public:
+    explicit ArduinoUdpTransport(UDP& udp) : _udp(udp) {}
+
+    void setRemote(const IPAddress& ip, uint16_t port) {
+        _remote_ip = ip;
+        _remote_port = port;
+    }
+
+    size_t receive(uint8_t* dst, size_t max) override {
+        const int size = _udp.parsePacket();
+        if (size <= 0) return 0;
+        const int n = _udp.read(dst, max);
+        return n > 0 ? static_cast<size_t>(n) : 0;
+    }
+
+    size_t send(const uint8_t* src, size_t len) override {
+        if (_remote_port == 0 || !_udp.beginPacket(_remote_ip, _remote_port)) return 0;
+        const size_t n = _udp.write(src, len);
+        return _udp.endPacket() ? n : 0;
+    }
+
+private:
+    UDP& _udp;
+    IPAddress _remote_ip;
+    uint16_t _remote_port = 0;
+};
+
+} // namespace PixelTheater
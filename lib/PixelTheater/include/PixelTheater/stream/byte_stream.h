@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PixelTheater {
+
+/**
+ * @brief Minimal byte transport for frame streaming.
+ *
+ * Implementations: SerialByteStream (Teensy USB serial) and FdByteStream
+ * (POSIX file descriptors: ttys, ptys, pipes, files).
+ */
+class ByteStream {
+public:
+    virtual ~ByteStream() = default;
+
+    /**
+     * @brief Read whatever is available without blocking.
+     * @return Bytes copied into dst, 0 if nothing was waiting
+     */
+    virtual size_t read(uint8_t* dst, size_t max) = 0;
+
+    /**
+     * @brief Write all of src, blocking until it is accepted.
+     * @return Bytes written; less than len only if the stream failed
+     */
+    virtual size_t write(const uint8_t* src, size_t len) = 0;
+};
+
+} // namespace PixelTheater
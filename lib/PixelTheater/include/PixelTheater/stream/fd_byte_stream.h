@@ -0,0 +1,56 @@
+#pragma once
+
+#include "PixelTheater/stream/byte_stream.h"
+#include <memory>
+
+namespace PixelTheater {
+
+/**
+ * @brief ByteStream over a POSIX file descriptor (native builds only).
+ *
+ * Works with serial devices, ptys, pipes and plain files. Reads never block;
+ * writes block until everything has been accepted.
+ */
+class FdByteStream : public ByteStream {
+public:
+    /**
+     * @param fd Open descriptor
+     * @param owns Close fd in the destructor
+     */
+    explicit FdByteStream(int fd, bool owns = false);
+    ~FdByteStream() override;
+
+    FdByteStream(const FdByteStream&) = delete;
+    FdByteStream& operator=(const FdByteStream&) = delete;
+
+    /**
+     * @brief Open an existing device, pipe or file for writing and reading.
+     * Terminals (USB serial, ptys) are switched to raw mode so no byte is
+     * translated. Returns nullptr (errno set) if the path cannot be opened;
+     * nothing is created, so a mistyped device name is an error.
+     */
+    static std::unique_ptr<FdByteStream> open(const char* path);
+
+    /**
+     * @brief Create (or truncate) a plain file and write to it.
+     * Returns nullptr (errno set) on failure.
+     */
+    static std::unique_ptr<FdByteStream> create(const char* path);
+
+    size_t read(uint8_t* dst, size_t max) override;
+    size_t write(const uint8_t* src, size_t len) override;
+
+    // Wait up to timeout_ms for data to read; false on timeout
+    bool waitReadable(int timeout_ms) const;
+
+    int fd() const { return _fd; }
+
+    // Put a terminal descriptor in raw mode; no-op for anything else
+    static void makeRaw(int fd);
+
+private:
+    int _fd;
+    bool _owns;
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PixelTheater/core/crgb.h"
+
+namespace PixelTheater {
+
+/**
+ * LED frame wire format, shared by FrameEncoder and FrameDecoder.
+ *
+ * Every frame is:
+ *   'P' 'T' | type:u8 | seq:u16 | led_count:u16 | payload_len:u16 | payload | crc:u16
+ * Multi-byte fields are little-endian. The CRC (CRC-16/CCITT-FALSE) covers
+ * everything from type to the end of the payload.
+ *
+ * Payloads by type:
+ *   Raw    led_count * (r, g, b)
+ *   Rle    runs of (count:u8 1-255, r, g, b) adding up to led_count
+ *   Delta  spans of (start:u16, count:u16, count * (r, g, b)) changed since
+ *          frame seq - 1; only applies on top of exactly that frame
+ *
+ * The encoder never produces a payload larger than Raw, so a decoder sized
+ * for N LEDs needs at most N * 3 payload bytes.
+ */
+namespace FrameStream {
+    static constexpr uint8_t MAGIC_0 = 'P';
+    static constexpr uint8_t MAGIC_1 = 'T';
+    static constexpr size_t HEADER_SIZE = 9;   // Magic through payload_len
+    static constexpr size_t CRC_SIZE = 2;
+
+    enum class FrameType : uint8_t {
+        Raw = 0,
+        Rle = 1,
+        Delta = 2
+    };
+
+    uint16_t crc16(const uint8_t* data, size_t len, uint16_t crc = 0xFFFF);
+}
+
+/**
+ * @brief Packs LED frames for streaming, picking the smallest encoding.
+ *
+ * Keeps a copy of the previous frame for delta encoding. A full (Raw or Rle)
+ * keyframe is sent every keyframe_interval frames so a receiver that joins
+ * late or drops a frame recovers quickly.
+ */
+class FrameEncoder {
+public:
+    enum class Mode : uint8_t {
+        Auto,   // Smallest of Raw, Rle and (between keyframes) Delta
+        Raw,
+        Rle,
+        Delta   // Delta whenever possible, Raw for keyframes
+    };
+
+    explicit FrameEncoder(size_t max_leds, uint16_t keyframe_interval = 30);
+
+    /**
+     * @brief Encode one frame. The result stays valid until the next call.
+     * @return Number of bytes in data(), 0 if count exceeds max_leds
+     */
+    size_t encode(const CRGB* leds, size_t count, Mode mode = Mode::Auto);
+
+    const uint8_t* data() const { return _out.data(); }
+    size_t size() const { return _out.size(); }
+    FrameStream::FrameType lastType() const { return _last_type; }
+    uint16_t sequence() const { return _seq; }
+
+    // Make the next frame a keyframe, e.g. after the receiver was reset
+    void forceKeyframe() { _since_keyframe = _keyframe_interval; }
+
+private:
+    size_t rlePayload(const CRGB* leds, size_t count, uint8_t* out, size_t limit) const;
+    size_t deltaPayload(const CRGB* leds, size_t count, uint8_t* out, size_t limit) const;
+    void finish(FrameStream::FrameType type, size_t count, const uint8_t* payload, size_t len);
+
+    size_t _max_leds;
+    uint16_t _keyframe_interval;
+    uint16_t _since_keyframe;
+    uint16_t _seq = 0;
+    size_t _prev_count = 0;
+    FrameStream::FrameType _last_type = FrameStream::FrameType::Raw;
+    std::vector<CRGB> _prev;
+    std::vector<uint8_t> _scratch;  // Candidate payloads
+    std::vector<uint8_t> _out;
+};
+
+/**
+ * @brief Incremental decoder: feed it bytes as they arrive.
+ *
+ * Bytes can be fed in any chunking. After a bad header or checksum the
+ * decoder skips ahead to the next magic, so it resynchronises on its own.
+ * All buffers are allocated in the constructor.
+ */
+class FrameDecoder {
+public:
+    struct Stats {
+        uint32_t frames = 0;            // Frames applied
+        uint32_t checksum_errors = 0;
+        uint32_t format_errors = 0;     // Bad header or payload
+        uint32_t missing_base = 0;      // Delta frames without their previous frame
+        uint32_t bytes = 0;
+    };
+
+    explicit FrameDecoder(size_t max_leds);
+
+    /**
+     * @brief Consume bytes.
+     * @return Number of frames completed and applied during this call
+     */
+    size_t feed(const uint8_t* data, size_t len);
+
+    // Latest complete frame
+    const CRGB* frame() const { return _frame.data(); }
+    size_t ledCount() const { return _led_count; }
+    bool hasFrame() const { return _have_frame; }
+    uint16_t sequence() const { return _seq; }
+    const Stats& stats() const { return _stats; }
+
+    void reset();
+
+private:
+    enum class State : uint8_t { Magic0, Magic1, Header, Body };
+
+    size_t process();
+    bool apply();
+    void rescan(size_t from);
+
+    size_t _max_leds;
+    std::vector<CRGB> _frame;
+    std::vector<uint8_t> _buf;      // Current frame from type onwards
+    size_t _have = 0;               // Bytes in _buf
+    size_t _need = 0;               // Bytes _buf must reach in this state
+    State _state = State::Magic0;
+    size_t _led_count = 0;
+    uint16_t _seq = 0;
+    bool _have_frame = false;
+    Stats _stats;
+};
+
+} // namespace PixelTheater
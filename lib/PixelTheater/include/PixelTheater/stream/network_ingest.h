@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PixelTheater/core/crgb.h"
+
+namespace PixelTheater {
+
+class PacketTransport;
+
+/**
+ * Packet builders for the protocols NetworkIngest understands. They write
+ * into a caller-provided buffer (at least MAX_PACKET bytes for Art-Net and
+ * E1.31) and return the packet length. Used by senders and tests.
+ */
+namespace ArtNet {
+    static constexpr uint16_t PORT = 6454;
+    static constexpr size_t HEADER_SIZE = 18;
+    static constexpr size_t MAX_PACKET = HEADER_SIZE + 512;
+
+    // ArtDmx for a 15-bit port address; seq 0 disables sequencing
+    size_t buildDmx(uint8_t* out, uint16_t universe, uint8_t seq, const uint8_t* slots, size_t count);
+    size_t buildSync(uint8_t* out);
+}
+
+namespace E131 {
+    static constexpr uint16_t PORT = 5568;
+    static constexpr size_t HEADER_SIZE = 126;  // Up to and including the start code
+    static constexpr size_t MAX_PACKET = HEADER_SIZE + 512;
+    static constexpr size_t SYNC_PACKET = 49;
+
+    // Data packet; sync_address 0 means "show immediately"
+    size_t buildData(uint8_t* out, uint16_t universe, uint8_t seq, uint16_t sync_address,
+                     const uint8_t* slots, size_t count);
+    size_t buildSync(uint8_t* out, uint8_t seq, uint16_t sync_address);
+}
+
+namespace Opc {
+    static constexpr uint16_t PORT = 7890;
+    static constexpr size_t HEADER_SIZE = 4;
+
+    // "Set pixel colors" message; out needs HEADER_SIZE + count * 3 bytes
+    size_t buildSetPixels(uint8_t* out, uint8_t channel, const CRGB* leds, size_t count);
+}
+
+/**
+ * @brief Assembles LED frames from Open Pixel Control, Art-Net and E1.31 (sACN) packets.
+ *
+ * Packets are parsed in place and their channel data written straight into
+ * the frame being assembled; there is no per-packet staging copy. A
+ * completed frame is copied once to the front buffer, so universes that
+ * did not arrive keep their last values in the next frame. DMX
+ * universes map to consecutive LED ranges (170 RGB LEDs each by default),
+ * so 1248 LEDs span 8 universes.
+ *
+ * Frame sync:
+ *   - OPC messages are whole frames and show immediately
+ *   - DMX frames complete when every mapped universe has arrived, or when a
+ *     universe arrives twice (the sender skipped one; show what we have)
+ *   - Once an ArtSync or an E1.31 packet with a sync address is seen, frames
+ *     complete only on sync packets, so all universes change together. If
+ *     eight frames' worth of data then arrive without a sync, it falls back
+ *     to the rules above (Art-Net senders drop sync without saying so), and
+ *     goes back to sync mode on the next sync packet
+ *
+ * E1.31 packets flagged as preview or out of sequence are ignored.
+ * All buffers are allocated in the constructor.
+ */
+class NetworkIngest {
+public:
+    enum class Protocol : uint8_t { None, ArtNet, E131, Opc };
+
+    struct Config {
+        uint16_t artnet_universe = 0;       // Port address of the first LEDs
+        uint16_t e131_universe = 1;         // sACN universes start at 1
+        uint16_t leds_per_universe = 170;   // 510 of the 512 channels
+        uint8_t opc_channel = 0;            // 0 accepts every OPC channel
+    };
+
+    struct Stats {
+        uint32_t packets = 0;
+        uint32_t frames = 0;
+        uint32_t syncs = 0;
+        uint32_t ignored = 0;       // Unmapped universe, preview, other opcodes
+        uint32_t malformed = 0;
+        uint32_t out_of_order = 0;  // E1.31 sequence check
+    };
+
+    explicit NetworkIngest(size_t led_count);
+    NetworkIngest(size_t led_count, const Config& config);
+
+    /**
+     * @brief Parse one datagram.
+     * @return The protocol it was recognised as, None if it was rejected
+     */
+    Protocol handlePacket(const uint8_t* data, size_t len);
+
+    /**
+     * @brief Receive and handle up to max_packets waiting packets.
+     * @return Number of frames completed
+     */
+    size_t drain(PacketTransport& transport, size_t max_packets = 64);
+
+    // Latest complete frame
+    const CRGB* frame() const { return _front.data(); }
+    size_t ledCount() const { return _front.size(); }
+    uint32_t frameCount() const { return _stats.frames; }
+    bool syncMode() const { return _sync_mode; }
+    size_t universeCount() const { return _universes; }
+    const Stats& stats() const { return _stats; }
+    const Config& config() const { return _config; }
+
+    // Size of the receive buffer drain() uses: fits the largest accepted packet
+    size_t maxPacket() const { return _packet.size(); }
+
+private:
+    Protocol handleArtNet(const uint8_t* data, size_t len);
+    Protocol handleE131(const uint8_t* data, size_t len);
+    Protocol handleOpc(const uint8_t* data, size_t len);
+    void handleDmx(size_t index, const uint8_t* slots, size_t count);
+    void handleSync();
+    void completeFrame();
+
+    Config _config;
+    size_t _universes;
+    std::vector<CRGB> _back;            // Frame being assembled
+    std::vector<CRGB> _front;           // Last complete frame
+    std::vector<uint8_t> _received;     // Per universe: written since the last frame
+    std::vector<int16_t> _e131_seq;     // Per universe: last E1.31 sequence number, -1 before the first
+    std::vector<uint8_t> _packet;       // Receive buffer for drain()
+    size_t _received_count = 0;
+    size_t _unsynced_packets = 0;       // DMX packets since the last sync
+    uint16_t _sync_address = 0;         // E1.31 sync universe the data asked for
+    bool _sync_mode = false;
+    bool _sync_recent = true;           // No fallback since the last sync packet
+    Stats _stats;
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PixelTheater {
+
+/**
+ * @brief Minimal datagram transport for network LED ingest.
+ *
+ * Implementations: UdpTransport (POSIX sockets, native builds) and
+ * ArduinoUdpTransport (any Arduino UDP class, e.g. Teensy 4.1 Ethernet).
+ */
+class PacketTransport {
+public:
+    virtual ~PacketTransport() = default;
+
+    /**
+     * @brief Receive one waiting packet without blocking.
+     * @return Packet length, 0 if nothing was waiting. Longer packets are truncated to max.
+     */
+    virtual size_t receive(uint8_t* dst, size_t max) = 0;
+
+    /**
+     * @brief Send one packet to the transport's remote address.
+     * @return Bytes sent, 0 on failure
+     */
+    virtual size_t send(const uint8_t* src, size_t len) = 0;
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "PixelTheater/stream/byte_stream.h"
+#include <Arduino.h>
+
+namespace PixelTheater {
+
+/**
+ * @brief ByteStream over an Arduino Stream, e.g. the Teensy USB Serial.
+ * Teensy USB serial ignores the baud rate and runs at full USB speed.
+ */
+class SerialByteStream : public ByteStream {
+public:
+    explicit SerialByteStream(Stream& serial) : _serial(serial) {}
+
+    size_t read(uint8_t* dst, size_t max) override {
+        const int available = _serial.available();
+        if (available <= 0) return 0;
+        const size_t n = static_cast<size_t>(available) < max ? static_cast<size_t>(available) : max;
+        return _serial.readBytes(reinterpret_cast<char*>(dst), n);
+    }
+
+    size_t write(const uint8_t* src, size_t len) override {
+        return _serial.write(src, len);
+    }
+
+private:
+    Stream& _serial;
+};
+
+} // namespace PixelTheater
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "PixelTheater/params/param_types.h"
+
+namespace PixelTheater {
+
+class Scene;
+
+/**
+ * Binary telemetry wire format, shared by TelemetryEncoder and
+ * TelemetryDecoder.
+ *
+ * Every packet is:
+ *   'P' 'M' | type:u8 | seq:u16 | millis:u32 | payload_len:u16 | payload | crc:u16
+ * Little-endian, CRC-16/CCITT-FALSE (FrameStream::crc16) over type through
+ * payload. The magic differs from LED frames ('P' 'T') and the decoder skips
+ * anything that isn't a valid packet, so telemetry can share a serial port
+ * with text output.
+ *
+ * Payloads by type:
+ *   Frames    frames:u16 | window_ms:u32 | min_us:u32 | max_us:u32 | total_us:u32
+ *             | bucket_us:u16 | n:u8 | n * count:u16
+ *             Frame-time histogram since the previous Frames packet. Bucket i
+ *             holds frames of i * bucket_us up to (i + 1) * bucket_us; the
+ *             last of the BUCKETS buckets also takes everything slower.
+ *             Trailing empty buckets are not sent.
+ *   ZoneName  id:u8 | len:u8 | name
+ *   Zones     n:u8 | n * (id:u8 | calls:u32 | total_us:u32 | min_us:u32 | max_us:u32)
+ *             Profiler zones updated since the previous Zones packet, by id
+ *   System    temp_centi_c:i16 | power_mw:u32 | brightness:u8 | log_dropped:u32
+ *             | quality:u8 | quality_max:u8     scene quality (QualityKnobs::total)
+ *   Scene     index:u8 | schema:u32 | len:u8 | name | n:u8
+ *             | n * (type:u8 | len:u8 | name)      parameter names and types
+ *   Params    index:u8 | schema:u32 | n:u8 | n * (type:u8 | value)
+ *             Values encoded as ParamProtocol::encode_value, by schema index
+ *   Status    len:u8 | text      the scene's status() line, when it changes
+ *
+ * Names are sent once and again at every keyframe, so a decoder that joins
+ * late fills its tables within keyframe_interval_ms.
+ */
+namespace Telemetry {
+    static constexpr uint8_t MAGIC_0 = 'P';
+    static constexpr uint8_t MAGIC_1 = 'M';
+    static constexpr size_t HEADER_SIZE = 11;   // Magic through payload_len
+    static constexpr size_t CRC_SIZE = 2;
+    static constexpr size_t MAX_PAYLOAD = 512;
+    static constexpr size_t MAX_PACKET = HEADER_SIZE + MAX_PAYLOAD + CRC_SIZE;
+    static constexpr size_t BUCKETS = 32;
+    static constexpr size_t MAX_ZONES = 24;
+    static constexpr size_t MAX_NAME = 23;
+    static constexpr size_t MAX_STATUS = 127;
+
+    enum class Type : uint8_t {
+        Frames = 1,
+        ZoneName = 2,
+        Zones = 3,
+        System = 4,
+        Scene = 5,
+        Params = 6,
+        Status = 7
+    };
+
+    const char* typeName(Type type);
+}
+
+/**
+ * @brief Collects frame times, profiler zones, system readings and scene
+ * state on the device, and hands them out as small binary packets.
+ *
+ * recordFrame() is cheap enough for every frame (a histogram increment).
+ * Everything else is sent at stats_interval_ms, or when it changes, one
+ * packet per next() call so the serial port never takes a burst. All
+ * storage is inline; nothing is allocated.
+ */
+class TelemetryEncoder {
+public:
+    struct Config {
+        uint32_t stats_interval_ms = 1000;      // Frames, Zones and System
+        uint32_t params_interval_ms = 200;      // How often to look for changed parameters
+        uint32_t keyframe_interval_ms = 5000;   // Names and scene sent again
+        uint16_t bucket_us = 1000;              // Histogram resolution
+    };
+
+    TelemetryEncoder();
+    explicit TelemetryEncoder(const Config& config);
+
+    // Frame time in microseconds
+    void recordFrame(uint32_t frame_us);
+
+    /**
+     * @brief True once per stats interval, when zones and system readings
+     * should be refreshed with setZone() and setSystem().
+     */
+    bool statsDue(uint32_t now_ms) const;
+
+    /**
+     * @brief Latest totals of one profiler zone. The name is copied the first
+     * time it is seen; later calls match it by text. Zones past MAX_ZONES
+     * are ignored.
+     */
+    void setZone(const char* name, uint32_t calls, uint32_t total_us, uint32_t min_us, uint32_t max_us);
+
+    void setSystem(float temp_c, float power_mw, uint8_t brightness, uint32_t log_dropped = 0);
+
+    // Current scene's quality level out of its maximum (0 of 0 without knobs)
+    void setQuality(uint16_t level, uint16_t max);
+
+    /**
+     * @brief Current scene's status text (Scene::status()). Copied, cut to
+     * MAX_STATUS bytes, and sent when it differs from the last one sent.
+     */
+    void setStatus(const char* text);
+
+    /**
+     * @brief Current scene. Only read during next(), so the scene must stay
+     * alive until the next setScene() call. nullptr for none.
+     */
+    void setScene(const Scene* scene, size_t index);
+
+    /**
+     * @brief Build the next packet that is due, if any.
+     * @param out At least Telemetry::MAX_PACKET bytes
+     * @return Packet length, 0 when nothing is due
+     */
+    size_t next(uint32_t now_ms, uint8_t* out, size_t max);
+
+    // Send names and scene again, e.g. when a host has just connected
+    void forceKeyframe();
+
+    uint16_t sequence() const { return _seq; }
+
+private:
+    struct Zone {
+        char name[Telemetry::MAX_NAME + 1];
+        uint32_t calls, total_us, min_us, max_us;
+        bool announced;
+        bool dirty;
+    };
+
+    size_t finish(Telemetry::Type type, uint32_t now_ms, uint8_t* out, size_t payload_len);
+    void closeWindow(uint32_t now_ms);
+    size_t zonesPayload(uint8_t* payload);
+    size_t scenePayload(uint8_t* payload) const;
+    size_t paramsPayload(uint8_t* payload) const;
+    bool paramsChanged();
+    void scheduleStats(uint32_t now_ms);
+
+    Config _config;
+    uint16_t _seq = 0;
+    bool _started = false;
+    uint32_t _last_stats_ms = 0;
+    uint32_t _last_params_ms = 0;
+    uint32_t _last_keyframe_ms = 0;
+
+    // Frames since the last Frames packet
+    uint16_t _buckets[Telemetry::BUCKETS] = {};
+    uint32_t _frames = 0;
+    uint32_t _window_start_ms = 0;
+    uint32_t _min_us = UINT32_MAX;
+    uint32_t _max_us = 0;
+    uint32_t _total_us = 0;
+    uint8_t _frames_payload[21 + Telemetry::BUCKETS * 2];  // Closed window, waiting to go out
+    size_t _frames_len = 0;
+
+    Zone _zones[Telemetry::MAX_ZONES];
+    size_t _zone_count = 0;
+
+    int16_t _temp_centi_c = 0;
+    uint32_t _power_mw = 0;
+    uint8_t _brightness = 0;
+    uint32_t _log_dropped = 0;
+    uint8_t _quality = 0;
+    uint8_t _quality_max = 0;
+    char _status[Telemetry::MAX_STATUS + 1] = {};
+
+    const Scene* _scene = nullptr;
+    size_t _scene_index = 0;
+    uint32_t _scene_schema = 0;
+    uint8_t _param_bytes[Telemetry::MAX_PAYLOAD];   // Last Params payload sent
+    size_t _param_len = 0;
+
+    // Packets waiting to go out
+    bool _frames_due = false;
+    bool _zones_due = false;
+    bool _system_due = false;
+    bool _scene_due = false;
+    bool _params_due = false;
+    bool _status_due = false;
+};
+
+/**
+ * @brief Host-side decoder: turns the packet stream back into named values.
+ *
+ * Bytes can arrive in any chunking, mixed with text. Zone and parameter
+ * names are learnt from ZoneName and Scene packets; values seen before their
+ * names get numeric placeholders ("zone3", "param2").
+ */
+class TelemetryDecoder {
+public:
+    struct Field {
+        std::string key;
+        double value;
+    };
+
+    struct Packet {
+        Telemetry::Type type = Telemetry::Type::Frames;
+        uint16_t seq = 0;
+        uint32_t millis = 0;
+        std::string text;               // Scene name, zone name or scene status
+        std::vector<Field> fields;      // Flattened values, e.g. "fps", "zone.frame.avg_us"
+    };
+
+    struct Stats {
+        uint32_t packets = 0;
+        uint32_t checksum_errors = 0;
+        uint32_t lost = 0;              // Gaps in the sequence numbers
+        uint32_t other_bytes = 0;       // Text and noise between packets
+    };
+
+    void feed(const uint8_t* data, size_t len);
+
+    // Next decoded packet, or false when more bytes are needed
+    bool next(Packet& packet);
+
+    // Bytes skipped since the last call that weren't part of a packet
+    std::string takeText();
+
+    const Stats& stats() const { return _stats; }
+
+private:
+    struct Param {
+        std::string name;
+        ParamType type;
+    };
+
+    void decode(Telemetry::Type type, const uint8_t* payload, size_t len, Packet& packet);
+    void skip(size_t count);
+
+    std::vector<uint8_t> _buf;
+    size_t _offset = 0;
+    std::string _text;
+    bool _have_seq = false;
+    uint16_t _last_seq = 0;
+    std::vector<std::string> _zone_names;
+    std::vector<Param> _params;
+    uint32_t _params_schema = 0;
+    Stats _stats;
+};
+
+} // namespace PixelTheater
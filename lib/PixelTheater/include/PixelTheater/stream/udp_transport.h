@@ -0,0 +1,42 @@
+#pragma once
+
+#include "PixelTheater/stream/packet_transport.h"
+
+namespace PixelTheater {
+
+/**
+ * @brief PacketTransport over a POSIX UDP socket (native builds only).
+ *
+ * Bind to receive; set a remote to send. A receiver bound to port 0 gets an
+ * ephemeral port (see localPort()), which is what the loopback tests use.
+ */
+class UdpTransport : public PacketTransport {
+public:
+    UdpTransport();
+    ~UdpTransport() override;
+
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
+
+    // Listen on address:port; false if the socket or bind failed
+    bool bind(uint16_t port, const char* address = "0.0.0.0");
+
+    // Where send() goes; host is a dotted IPv4 address. Enables broadcast for x.x.x.255
+    bool setRemote(const char* host, uint16_t port);
+
+    size_t receive(uint8_t* dst, size_t max) override;
+    size_t send(const uint8_t* src, size_t len) override;
+
+    // Wait up to timeout_ms for a packet; false on timeout
+    bool waitReadable(int timeout_ms) const;
+
+    uint16_t localPort() const;
+    bool isOpen() const { return _fd >= 0; }
+
+private:
+    int _fd;
+    bool _has_remote = false;
+    alignas(8) unsigned char _remote[16]; // sockaddr_in, kept opaque to avoid socket headers here
+};
+
+} // namespace PixelTheater
@@ -10,8 +10,11 @@
 // Include full INTERFACE definitions needed by Theater members/methods
 #include "PixelTheater/core/imodel.h"
 #include "PixelTheater/core/iled_buffer.h"
+#include "PixelTheater/core/dirty_tracker.h"
+#include "PixelTheater/core/quality.h"
 #include "PixelTheater/platform/platform.h"
 #include "PixelTheater/scene.h" // Uses interfaces
+#include "PixelTheater/scene_list.h"
 
 // Include full WRAPPER & CONCRETE definitions needed for template implementations
 #include "PixelTheater/platform/native_platform.h"
@@ -25,6 +28,7 @@
 #include "PixelTheater/model_def.h"
 #include "PixelTheater/core/model_wrapper.h" // Include wrapper header
 #include "PixelTheater/core/led_buffer_wrapper.h" // Include wrapper header
+#include "PixelTheater/model/runtime_model.h"
 
 // Forward declarations
 namespace PixelTheater {
@@ -89,6 +93,14 @@ public:
     template<typename TModelDef>
     void useNativePlatform(size_t num_leds);
 
+    /**
+     * @brief Initialize the Theater with the NativePlatform and a model
+     * loaded at run time, with one LED per point.
+     *
+     * @param model A loaded RuntimeModel; ignored if null or not loaded.
+     */
+    void useNativePlatform(std::unique_ptr<RuntimeModel> model);
+
 #ifdef PLATFORM_TEENSY // Only declare useFastLEDPlatform for Teensy builds
     /**
      * @brief Initialize the Theater to use the FastLEDPlatform.
@@ -99,6 +111,12 @@ public:
      */
     template<typename TModelDef>
     void useFastLEDPlatform(::CRGB* leds, size_t num_leds);
+
+    /**
+     * @brief Initialize the Theater with the FastLEDPlatform and a model
+     * loaded at run time. num_leds must cover every point of the model.
+     */
+    void useFastLEDPlatform(::CRGB* leds, size_t num_leds, std::unique_ptr<RuntimeModel> model);
 #endif
 
     /**
@@ -113,35 +131,147 @@ public:
     template<typename SceneType>
     void addScene();
 
+    // Most scenes a scene list can keep constructed at once
+    static constexpr size_t MAX_RESIDENT_SCENES = 4;
+
+    /**
+     * @brief Register every scene in a SceneList without constructing any.
+     *
+     * A scene is built when it is activated (or prewarmed), into one of
+     * ResidentSlots slots of a static buffer sized for the largest scene in
+     * the list. When the slots are full the least recently used scene that
+     * isn't current is destroyed to make room, so only ResidentSlots scenes
+     * (and their settings, pools and arenas) are ever in memory. With one
+     * slot nothing can be prewarmed; retained state lasts only while the
+     * scene stays resident. Can follow or precede addScene() calls; indices
+     * continue in registration order.
+     */
+    template<typename List, size_t ResidentSlots = 1>
+    void useSceneList();
+
+    /**
+     * @brief Bytes of static scene storage claimed by useSceneList()
+     */
+    size_t sceneStorageBytes() const;
+
     void start(); 
     void nextScene(); 
     void previousScene(); 
     void update(); 
     
     // --- Scene Access (Task 9) ---
+    // A scene from a scene list exists only while resident; otherwise these
+    // log an error and return a placeholder scene
     Scene& scene(size_t index);
     const Scene& scene(size_t index) const;
-    const std::vector<std::unique_ptr<Scene>>& scenes() const;
     Scene* currentScene();
     const Scene* currentScene() const;
     size_t sceneCount() const;
 
+    // Index of the current scene, or sceneCount() if there is none
+    size_t currentSceneIndex() const;
+
+    // Whether the scene at index is constructed (always true for addScene())
+    bool isResident(size_t index) const;
+
     // --- ADDED: Platform Access --- 
     Platform* platform();
     const Platform* platform() const;
 
+    // The model, e.g. to lay out an OutputMap; nullptr before a platform is set
+    const IModel* model() const;
+
     // --- ADDED: Scene Control --- 
     bool setScene(size_t index);
 
+    /**
+     * @brief Run a scene's reset() and setup() now, so that switching to it
+     * later skips them.
+     *
+     * Meant for idle time (e.g. while the scene button is held), so the
+     * expensive init of the next scene doesn't land in a frame. setup()
+     * must not draw, as another scene still owns the LEDs. Does nothing for
+     * the current scene or one that is already prepared.
+     */
+    bool prewarm(size_t index);
+
+    /**
+     * @brief Prewarm the scene nextScene() would switch to.
+     */
+    bool prewarmNext();
+
+    /**
+     * @brief Time taken by scene switches: the outgoing scene is done, the
+     * incoming one is ready to tick.
+     */
+    struct SwitchStats {
+        uint32_t last_us = 0;
+        uint32_t max_us = 0;
+        uint32_t count = 0;
+    };
+    const SwitchStats& switchStats() const;
+
+    /**
+     * @brief LEDs changed by the current scene's latest frame, or nullptr
+     * when the scene has not enabled dirty tracking.
+     */
+    const DirtyTracker* dirtyTracker() const;
+
+    /**
+     * @brief Adapts the current scene's quality knobs to a frame budget.
+     *
+     * Off until given a target (setTarget() or setConfig()). Then update()
+     * times the scene's share of each frame (modulation, tick() and dirty
+     * capture, not show(), whose cost no knob can change) with the cycle
+     * counter and feeds it to the governor. Reset on every scene switch.
+     */
+    QualityGovernor& qualityGovernor();
+    const QualityGovernor& qualityGovernor() const;
+
+    /**
+     * @brief Scene time of the latest frame in us, measured only while the
+     * quality governor is enabled
+     */
+    uint32_t lastFrameUs() const;
+
 protected:
     // Core components managed by the Theater
     std::unique_ptr<Platform> platform_;
     std::unique_ptr<IModel> model_;      // Holds the ModelWrapper
     std::unique_ptr<ILedBuffer> leds_;   // Holds the LedBufferWrapper
     
-    std::vector<std::unique_ptr<Scene>> scenes_;
+    struct SceneEntry {
+        std::unique_ptr<Scene> owned;       // addScene(): built up front
+        SceneFactory factory = nullptr;     // useSceneList(): built into a slot on demand
+        Scene* instance = nullptr;          // owned.get(), or the resident list scene
+        int slot = -1;                      // Storage slot while resident
+        uint32_t last_used = 0;             // Activation count when last current
+    };
+
+    std::vector<SceneEntry> scenes_;
     Scene* current_scene_ = nullptr;
 
+    // Scene list storage: resident_slots_ slots of slot_size_ bytes
+    unsigned char* scene_storage_ = nullptr;
+    bool* scene_storage_claim_ = nullptr;   // Cleared on destruction so another Theater can use it
+    size_t slot_size_ = 0;
+    size_t resident_slots_ = 0;
+    static constexpr size_t NO_ENTRY = static_cast<size_t>(-1);
+    size_t slot_entry_[MAX_RESIDENT_SCENES];  // Entry occupying each slot, or NO_ENTRY
+    uint32_t activations_ = 0;
+
+    // Created the first time a scene enables dirty tracking
+    std::unique_ptr<DirtyTracker> dirty_tracker_;
+    bool dirty_tracking_ = false;   // The current scene enabled it
+
+    SwitchStats switch_stats_;
+
+    QualityGovernor quality_governor_;
+    uint32_t last_frame_us_ = 0;
+
+    // millis() at the last update, for the modulation time step (0 before the first)
+    uint32_t last_update_ms_ = 0;
+
     // Internal state flag
     bool initialized_ = false;
 
@@ -160,9 +290,26 @@ protected:
     template<typename TModelDef, typename TPlatform>
     void internal_prepare(std::unique_ptr<TPlatform> platform);
 
+    // As internal_prepare(), for a RuntimeModel: attaches it to the platform's LEDs
+    void internal_prepare_runtime(std::unique_ptr<Platform> platform, std::unique_ptr<RuntimeModel> model);
+
 private:
-    // No private members needed currently?
-    // Add any truly private implementation details here if necessary.
+    // Make a scene current: resume it if it retains state and is prepared,
+    // otherwise reset() and setup(). `restart` forces the latter.
+    void activate(size_t index, bool restart = false);
+
+    // Run reset() and setup() and mark the scene prepared
+    void prepare(Scene& scene);
+
+    // The scene at index, constructing it if it comes from a scene list.
+    // Evicts the current scene only if evict_current; nullptr if no slot.
+    Scene* instantiate(size_t index, bool evict_current);
+
+    // Destroy the list scene in a slot
+    void evict(size_t slot);
+
+    // Attach or detach the dirty tracker to match the current scene; call after setup()
+    void syncDirtyTracking();
 
 };
 
@@ -229,10 +376,45 @@ void Theater::addScene() {
     auto new_scene = std::make_unique<SceneType>();
     Scene* scene_ptr = new_scene.get();
     scene_ptr->connect(*model_, *leds_, *platform_); 
-    scenes_.push_back(std::move(new_scene));
     if (!current_scene_) {
         current_scene_ = scene_ptr;
     }
+    SceneEntry entry;
+    entry.owned = std::move(new_scene);
+    entry.instance = scene_ptr;
+    scenes_.push_back(std::move(entry));
+}
+
+template<typename List, size_t ResidentSlots>
+void Theater::useSceneList() {
+    static_assert(ResidentSlots >= 1 && ResidentSlots <= MAX_RESIDENT_SCENES,
+                  "ResidentSlots must be between 1 and Theater::MAX_RESIDENT_SCENES");
+    if (!initialized_) return;
+    if (scene_storage_) {
+        Log::warning("[WARNING] Theater: scene list already set, ignoring another\n");
+        return;
+    }
+
+    // One buffer per list type for the life of the program, never on the heap
+    alignas(List::max_align) static unsigned char storage[List::slot_size * ResidentSlots];
+    static bool claimed = false;
+    if (claimed) {
+        Log::warning("[WARNING] Theater: scene list storage is in use by another Theater\n");
+        return;
+    }
+    claimed = true;
+    scene_storage_claim_ = &claimed;
+    scene_storage_ = storage;
+    slot_size_ = List::slot_size;
+    resident_slots_ = ResidentSlots;
+
+    scenes_.reserve(scenes_.size() + List::count);
+    for (size_t i = 0; i < List::count; ++i) {
+        SceneEntry entry;
+        entry.factory = List::factories[i];
+        scenes_.push_back(std::move(entry));
+    }
+    for (size_t slot = 0; slot < MAX_RESIDENT_SCENES; ++slot) slot_entry_[slot] = NO_ENTRY;
 }
 
 // --- ADDED Guarded Implementation for useWebPlatform ---
@@ -56,109 +56,99 @@ PixelTheater::CHSV rgb2hsv_approximate(const PixelTheater::CRGB& rgb) {
     return hsv;
 }
 
-// HSV conversion implementation (moved from core/color.cpp)
-void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
-    // Handle grayscale case
-    if(hsv.sat == 0) {
-        rgb.r = rgb.g = rgb.b = hsv.val;
-        return;
+// --- HSV -> RGB via lookup tables ---
+//
+// The rainbow conversion factors into three steps: the full-saturation,
+// full-value color for the hue; desaturation, which is scale8_video() by
+// 255 - desat plus a floor of desat; and scale8_video() by value. Hue and
+// saturation each index a small table, so a pixel is two loads and six
+// multiplies with no branches. At saturation 255 and value 255 the scale
+// steps are the identity, and at saturation 0 they give grey at `val`, so
+// every input goes through the same path.
+namespace {
+    struct Rgb8 { uint8_t r, g, b; };
+    struct SatScale { uint8_t scale, floor; };
+
+    constexpr uint8_t video8(uint8_t i, uint8_t scale) {
+        return static_cast<uint8_t>(((i * scale) >> 8) + ((i && scale) ? 1 : 0));
     }
 
-    uint8_t hue = hsv.hue;
-    uint8_t sat = hsv.sat;
-    uint8_t val = hsv.val;
-
-    uint8_t offset = hue & 0x1F; // 0..31
-    uint8_t offset8 = offset << 3; // 0..248
-
-    uint8_t third = scale8(offset8, (256/3)); // max = 85
-    uint8_t twothirds = scale8(offset8, ((256 * 2) / 3)); // max = 170
-
-    uint8_t r, g, b;
-
-    if(!(hue & 0x80)) { // 0XX
-        if(!(hue & 0x40)) { // 00X
-            if(!(hue & 0x20)) { // 000
-                r = 255 - third;
-                g = third;
-                b = 0;
-            } else { // 001
-                r = 171;
-                g = 85 + third;
-                b = 0;
-            }
-        } else { // 01X
-            if(!(hue & 0x20)) { // 010
-                r = 171 - twothirds;
-                g = 170 + third;
-                b = 0;
-            } else { // 011
-                r = 0;
-                g = 255 - third;
-                b = third;
-            }
-        }
-    } else { // 1XX
-        if(!(hue & 0x40)) { // 10X
-            if(!(hue & 0x20)) { // 100
-                r = 0;
-                g = 171 - twothirds;
-                b = 85 + third;
-            } else { // 101
-                r = third;
-                g = 0;
-                b = 255 - third;
-            }
-        } else { // 11X
-            if(!(hue & 0x20)) { // 110
-                r = 85 + third;
-                g = 0;
-                b = 171 - twothirds;
-            } else { // 111 - pink section
-                r = 170;  // Was 171 + third
-                g = 0;
-                b = 85;   // Was 171 - twothirds
-            }
+    // FastLED's rainbow: eight sections of 32 hues, the yellow section
+    // widened and the last (pink) section held flat
+    constexpr Rgb8 rainbowHue(uint8_t hue) {
+        const uint8_t offset8 = static_cast<uint8_t>((hue & 0x1F) << 3);
+        const uint8_t third = static_cast<uint8_t>((offset8 * 86) >> 8);         // scale8(offset8, 85)
+        const uint8_t twothirds = static_cast<uint8_t>((offset8 * 171) >> 8);    // scale8(offset8, 170)
+        switch (hue >> 5) {
+            case 0: return {static_cast<uint8_t>(255 - third), third, 0};
+            case 1: return {171, static_cast<uint8_t>(85 + third), 0};
+            case 2: return {static_cast<uint8_t>(171 - twothirds), static_cast<uint8_t>(170 + third), 0};
+            case 3: return {0, static_cast<uint8_t>(255 - third), third};
+            case 4: return {0, static_cast<uint8_t>(171 - twothirds), static_cast<uint8_t>(85 + third)};
+            case 5: return {third, 0, static_cast<uint8_t>(255 - third)};
+            case 6: return {static_cast<uint8_t>(85 + third), 0, static_cast<uint8_t>(171 - twothirds)};
+            default: return {170, 0, 85};
         }
     }
 
-    // Scale down colors if we're desaturated at all
-    if(sat != 255) {
-        if(sat == 0) {
-            r = g = b = 255;  // Full white
-        } else {
-            uint8_t desat = 255 - sat;
-            // Use exact scale8_video formula
-            desat = ((int)desat * (int)desat >> 8) + ((desat && desat) ? 1 : 0);
-            uint8_t satscale = 255 - desat;
-
-            // Scale using exact scale8_video formula
-            if(r) r = ((int)r * (int)satscale >> 8) + ((r && satscale) ? 1 : 0);
-            if(g) g = ((int)g * (int)satscale >> 8) + ((g && satscale) ? 1 : 0);
-            if(b) b = ((int)b * (int)satscale >> 8) + ((b && satscale) ? 1 : 0);
-
-            // Add the brightness floor
-            uint8_t brightness_floor = desat;
-            r += brightness_floor;
-            g += brightness_floor;
-            b += brightness_floor;
-        }
+    constexpr SatScale satScale(uint8_t sat) {
+        const uint8_t desat = video8(static_cast<uint8_t>(255 - sat), static_cast<uint8_t>(255 - sat));
+        return {static_cast<uint8_t>(255 - desat), desat};
     }
 
-    // Scale everything by value at the end using same approach
-    if(val != 255) {
-        if(val == 0) {
-            r = g = b = 0;
-        } else {
-            if(r) r = ((int)r * (int)val >> 8) + 1;
-            if(g) g = ((int)g * (int)val >> 8) + 1;
-            if(b) b = ((int)b * (int)val >> 8) + 1;
+    struct Tables {
+        Rgb8 hue[256];
+        SatScale sat[256];
+    };
+
+    constexpr Tables makeTables() {
+        Tables t{};
+        for (int i = 0; i < 256; ++i) {
+            t.hue[i] = rainbowHue(static_cast<uint8_t>(i));
+            t.sat[i] = satScale(static_cast<uint8_t>(i));
         }
+        return t;
     }
 
-    rgb.r = r;
-    rgb.g = g;
-    rgb.b = b;
+    constexpr Tables TABLES = makeTables();
+
+    inline void convert(uint8_t hue, uint8_t sat, uint8_t val, CRGB& rgb) {
+        const Rgb8& c = TABLES.hue[hue];
+        const SatScale& s = TABLES.sat[sat];
+        rgb.r = video8(static_cast<uint8_t>(video8(c.r, s.scale) + s.floor), val);
+        rgb.g = video8(static_cast<uint8_t>(video8(c.g, s.scale) + s.floor), val);
+        rgb.b = video8(static_cast<uint8_t>(video8(c.b, s.scale) + s.floor), val);
+    }
+}
+
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    convert(hsv.hue, hsv.sat, hsv.val, rgb);
+}
+
+void hsv2rgb_rainbow(const CHSV* hsv, CRGB* rgb, int count) {
+    for (int i = 0; i < count; ++i) convert(hsv[i].hue, hsv[i].sat, hsv[i].val, rgb[i]);
+}
+
+void hsv2rgb_rainbow(const uint8_t* hue, const uint8_t* sat, const uint8_t* val, CRGB* rgb, int count) {
+    for (int i = 0; i < count; ++i) convert(hue[i], sat[i], val[i], rgb[i]);
+}
+
+void hsv2rgb_rainbow(const uint8_t* hue, uint8_t sat, uint8_t val, CRGB* rgb, int count) {
+    if (sat == 255 && val == 255) {
+        for (int i = 0; i < count; ++i) {
+            const Rgb8& c = TABLES.hue[hue[i]];
+            rgb[i] = CRGB(c.r, c.g, c.b);
+        }
+        return;
+    }
+    if (count <= 256) {
+        for (int i = 0; i < count; ++i) convert(hue[i], sat, val, rgb[i]);
+        return;
+    }
+    // Longer than the table: convert each hue once, then look them up
+    CRGB table[256];
+    for (int h = 0; h < 256; ++h) convert(static_cast<uint8_t>(h), sat, val, table[h]);
+    for (int i = 0; i < count; ++i) rgb[i] = table[hue[i]];
 }
 
 // Operator implementations
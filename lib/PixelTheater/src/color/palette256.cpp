@@ -0,0 +1,82 @@
+#include "PixelTheater/color/palette256.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace PixelTheater {
+
+static_assert(sizeof(CRGB) == 3, "Palette256 compares entries as flat channel bytes");
+
+namespace {
+    // FastLED's fill_gradient_RGB(): 8.8 fixed point steps from start to end
+    // inclusive, so gradient tables match a FastLED CRGBPalette256
+    void fillGradient(CRGB* entries, uint8_t start, const uint8_t* from, uint8_t end, const uint8_t* to) {
+        const int32_t divisor = end > start ? end - start : 1;
+        int32_t accum[3];
+        int32_t delta[3];
+        for (int c = 0; c < 3; ++c) {
+            accum[c] = from[c] << 8;
+            delta[c] = (((to[c] - from[c]) << 7) / divisor) * 2;
+        }
+        for (int i = start; i <= end; ++i) {
+            entries[i] = CRGB(accum[0] >> 8, accum[1] >> 8, accum[2] >> 8);
+            for (int c = 0; c < 3; ++c) accum[c] += delta[c];
+        }
+    }
+
+    uint8_t stepToward(uint8_t value, uint8_t target, uint8_t step) {
+        if (value < target) return target - value > step ? value + step : target;
+        return value - target > step ? value - step : target;
+    }
+}
+
+void Palette256::build(const CRGBPalette16& pal, uint8_t brightness, TBlendType blendType) {
+    for (size_t i = 0; i < SIZE; ++i) {
+        _entries[i] = colorFromPalette(pal, static_cast<uint8_t>(i), brightness, blendType);
+    }
+}
+
+void Palette256::build(const GradientPaletteData& gradient, uint8_t brightness) {
+    _entries.fill(CRGB(0, 0, 0));
+    if (!gradient.data || gradient.size < 4 || gradient.size % 4 != 0) return;
+
+    const uint8_t* anchor = gradient.data;
+    const uint8_t* last = gradient.data + gradient.size - 4;
+    std::fill(_entries.begin(), _entries.begin() + anchor[0] + 1, CRGB(anchor[1], anchor[2], anchor[3]));
+    for (const uint8_t* next = anchor + 4; next <= last; anchor = next, next += 4) {
+        if (next[0] < anchor[0]) return;        // Out of order: stop at what is known
+        fillGradient(_entries.data(), anchor[0], anchor + 1, next[0], next + 1);
+    }
+    std::fill(_entries.begin() + anchor[0], _entries.end(), CRGB(anchor[1], anchor[2], anchor[3]));
+    if (brightness != 255) scale(brightness);
+}
+
+void Palette256::scale(uint8_t brightness) {
+    for (auto& entry : _entries) entry.nscale8(brightness);
+}
+
+void Palette256::map(const uint8_t* indices, CRGB* out, size_t count) const {
+    const CRGB* lut = _entries.data();
+    for (size_t i = 0; i < count; ++i) out[i] = lut[indices[i]];
+}
+
+void Palette256::map(const uint8_t* indices, CRGB* out, size_t count, uint8_t shift) const {
+    const CRGB* lut = _entries.data();
+    for (size_t i = 0; i < count; ++i) out[i] = lut[static_cast<uint8_t>(indices[i] + shift)];
+}
+
+bool Palette256::fadeToward(const Palette256& target, uint8_t step, size_t entries) {
+    entries = std::min(entries, SIZE);
+    for (size_t n = 0; n < entries; ++n, ++_cursor) {
+        uint8_t* value = _entries[_cursor].raw;
+        const uint8_t* goal = target._entries[_cursor].raw;
+        for (int c = 0; c < 3; ++c) value[c] = stepToward(value[c], goal[c], step);
+    }
+    return *this == target;
+}
+
+bool Palette256::operator==(const Palette256& other) const {
+    return std::memcmp(_entries.data(), other._entries.data(), sizeof(_entries)) == 0;
+}
+
+} // namespace PixelTheater
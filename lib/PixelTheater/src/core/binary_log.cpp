@@ -0,0 +1,273 @@
+#include "PixelTheater/core/binary_log.h"
+#include "PixelTheater/core/time.h"
+
+#include <cstdio>
+
+namespace PixelTheater {
+
+namespace {
+    uint16_t read_u16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+    uint32_t read_u32(const uint8_t* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    // Bytes taken by the value after a tag (string: length byte + text)
+    size_t value_size(uint8_t tag, const uint8_t* value, size_t available) {
+        switch (tag) {
+            case BinaryLog::I32: case BinaryLog::U32: case BinaryLog::F32: return 4;
+            case BinaryLog::I64: case BinaryLog::U64: case BinaryLog::F64: case BinaryLog::PTR: return 8;
+            case BinaryLog::STR: return available ? 1 + value[0] : 1;
+            default: return available + 1;  // Unknown tag: more than is left, stop
+        }
+    }
+}
+
+// --- Producer ---
+
+void BinaryLog::write_header(uint8_t* out, uint8_t level, uint8_t length, uint16_t id) {
+    const uint32_t micros = getSystemTimeProvider().micros();
+    out[0] = level;
+    out[1] = length;
+    out[2] = static_cast<uint8_t>(id);
+    out[3] = static_cast<uint8_t>(id >> 8);
+    out[4] = static_cast<uint8_t>(micros);
+    out[5] = static_cast<uint8_t>(micros >> 8);
+    out[6] = static_cast<uint8_t>(micros >> 16);
+    out[7] = static_cast<uint8_t>(micros >> 24);
+}
+
+uint16_t BinaryLog::intern(const char* format) {
+    // Fibonacci hash of the address, linear probing
+    size_t slot = (reinterpret_cast<uintptr_t>(format) * 2654435761u) & (TABLE_SIZE - 1);
+    for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+        if (_table_keys[slot] == format) return _table_ids[slot];
+        if (!_table_keys[slot]) {
+            if (_format_count >= MAX_FORMATS) return NO_ID;
+            const uint16_t id = _format_count++;
+            _formats[id] = format;
+            _table_ids[slot] = id;
+            _table_keys[slot] = format;
+            return id;
+        }
+        slot = (slot + 1) & (TABLE_SIZE - 1);
+    }
+    return NO_ID;
+}
+
+bool BinaryLog::announce(uint16_t id) {
+    uint8_t buffer[HEADER_SIZE + MAX_PAYLOAD];
+    size_t length = std::strlen(_formats[id]);
+    if (length > MAX_PAYLOAD) length = MAX_PAYLOAD;
+    write_header(buffer, DEFINE, static_cast<uint8_t>(length), id);
+    std::memcpy(buffer + HEADER_SIZE, _formats[id], length);
+    _announced[id] = push(buffer, HEADER_SIZE + length);
+    return _announced[id];
+}
+
+void BinaryLog::resendFormats() {
+    for (uint16_t id = 0; id < _format_count; ++id) {
+        if (!announce(id)) break;
+    }
+}
+
+bool BinaryLog::push(const uint8_t* data, size_t size) {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    const size_t tail = _tail.load(std::memory_order_acquire);
+    if (CAPACITY - (head - tail) < size) return false;
+
+    const size_t start = head & (CAPACITY - 1);
+    const size_t first = size < CAPACITY - start ? size : CAPACITY - start;
+    std::memcpy(_ring + start, data, first);
+    std::memcpy(_ring, data + first, size - first);
+    _head.store(head + size, std::memory_order_release);
+    return true;
+}
+
+// --- Consumer ---
+
+bool BinaryLog::pop(Log::Level& level, uint32_t& micros, char* text, size_t text_size) {
+    for (;;) {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        const size_t head = _head.load(std::memory_order_acquire);
+        if (head == tail) return false;
+
+        uint8_t record[HEADER_SIZE + MAX_PAYLOAD];
+        for (size_t i = 0; i < HEADER_SIZE; ++i) record[i] = _ring[(tail + i) & (CAPACITY - 1)];
+        const size_t length = record[1];
+        for (size_t i = 0; i < length; ++i) {
+            record[HEADER_SIZE + i] = _ring[(tail + HEADER_SIZE + i) & (CAPACITY - 1)];
+        }
+        _tail.store(tail + HEADER_SIZE + length, std::memory_order_release);
+
+        if (record[0] == DEFINE) continue;     // The device has the text already
+        level = static_cast<Log::Level>(record[0]);
+        micros = read_u32(record + 4);
+        const uint16_t id = read_u16(record + 2);
+        format(id < MAX_FORMATS && _formats[id] ? _formats[id] : "<unknown format>",
+               record + HEADER_SIZE, length, text, text_size);
+        return true;
+    }
+}
+
+size_t BinaryLog::read(uint8_t* out, size_t max) {
+    size_t tail = _tail.load(std::memory_order_relaxed);
+    const size_t head = _head.load(std::memory_order_acquire);
+    size_t copied = 0;
+    while (tail != head) {
+        const size_t size = HEADER_SIZE + _ring[(tail + 1) & (CAPACITY - 1)];
+        if (copied + size > max) break;
+        for (size_t i = 0; i < size; ++i) out[copied + i] = _ring[(tail + i) & (CAPACITY - 1)];
+        copied += size;
+        tail += size;
+    }
+    _tail.store(tail, std::memory_order_release);
+    return copied;
+}
+
+// --- Formatting ---
+
+void BinaryLog::format(const char* fmt, const uint8_t* args, size_t length, char* out, size_t out_size) {
+    if (!out_size) return;
+    size_t used = 0;
+    size_t arg = 0;
+    auto emit = [&](const char* s, size_t n) {
+        if (used + 1 >= out_size) return;
+        if (n > out_size - 1 - used) n = out_size - 1 - used;
+        std::memcpy(out + used, s, n);
+        used += n;
+    };
+
+    const char* p = fmt;
+    while (*p) {
+        if (*p != '%') {
+            const char* literal = p;
+            while (*p && *p != '%') ++p;
+            emit(literal, static_cast<size_t>(p - literal));
+            continue;
+        }
+        if (p[1] == '%') {
+            emit("%", 1);
+            p += 2;
+            continue;
+        }
+
+        // Rebuild the conversion without its length modifier; the tag decides the type
+        char spec[24];
+        size_t n = 0;
+        spec[n++] = *p++;
+        while (*p && std::strchr("-+ #0123456789.", *p) && n < sizeof(spec) - 4) spec[n++] = *p++;
+        while (*p && std::strchr("hlzjtLq", *p)) ++p;
+        const char conversion = *p ? *p++ : 's';
+
+        if (arg >= length) {
+            emit("<?>", 3);
+            continue;
+        }
+        const uint8_t tag = args[arg];
+        const uint8_t* value = args + arg + 1;
+        const size_t size = value_size(tag, value, length - arg - 1);
+        if (arg + 1 + size > length) break;
+        arg += 1 + size;
+
+        char piece[64];
+        int written = -1;
+        const bool integer_conversion = std::strchr("diouxXc", conversion) != nullptr;
+        const bool float_conversion = std::strchr("fFeEgGaA", conversion) != nullptr;
+        if (integer_conversion && (tag == I32 || tag == U32)) {
+            spec[n++] = conversion;
+            spec[n] = '\0';
+            int32_t v;
+            std::memcpy(&v, value, 4);
+            written = std::snprintf(piece, sizeof(piece), spec, v);
+        } else if (integer_conversion && (tag == I64 || tag == U64)) {
+            spec[n++] = 'l';
+            spec[n++] = 'l';
+            spec[n++] = conversion;
+            spec[n] = '\0';
+            long long v;
+            std::memcpy(&v, value, 8);
+            written = std::snprintf(piece, sizeof(piece), spec, v);
+        } else if (float_conversion && (tag == F32 || tag == F64)) {
+            spec[n++] = conversion;
+            spec[n] = '\0';
+            double v;
+            if (tag == F32) {
+                float f;
+                std::memcpy(&f, value, 4);
+                v = f;
+            } else {
+                std::memcpy(&v, value, 8);
+            }
+            written = std::snprintf(piece, sizeof(piece), spec, v);
+        } else if (conversion == 's' && tag == STR) {
+            spec[n++] = 's';
+            spec[n] = '\0';
+            char str[MAX_STRING + 1];
+            std::memcpy(str, value + 1, value[0]);
+            str[value[0]] = '\0';
+            written = std::snprintf(piece, sizeof(piece), spec, str);
+        } else if (conversion == 'p' && tag == PTR) {
+            uint64_t v;
+            std::memcpy(&v, value, 8);
+            written = std::snprintf(piece, sizeof(piece), "0x%llx", static_cast<unsigned long long>(v));
+        }
+
+        if (written < 0) {
+            emit("<?>", 3);        // Conversion and argument don't match
+        } else {
+            emit(piece, static_cast<size_t>(written) < sizeof(piece) ? static_cast<size_t>(written) : sizeof(piece) - 1);
+        }
+    }
+    out[used] = '\0';
+}
+
+// --- Host decoder ---
+
+void LogDecoder::feed(const uint8_t* data, size_t size) {
+    // Drop what has been consumed before growing
+    if (_offset > 0 && _offset == _pending.size()) {
+        _pending.clear();
+        _offset = 0;
+    }
+    _pending.insert(_pending.end(), data, data + size);
+}
+
+bool LogDecoder::next(Line& line) {
+    for (;;) {
+        const size_t available = _pending.size() - _offset;
+        if (available < BinaryLog::HEADER_SIZE) return false;
+        const uint8_t* record = _pending.data() + _offset;
+        const size_t length = record[1];
+        if (available < BinaryLog::HEADER_SIZE + length) return false;
+        _offset += BinaryLog::HEADER_SIZE + length;
+
+        const uint16_t id = read_u16(record + 2);
+        if (record[0] == BinaryLog::DEFINE) {
+            if (_formats.size() <= id) _formats.resize(id + 1);
+            _formats[id].assign(reinterpret_cast<const char*>(record + BinaryLog::HEADER_SIZE), length);
+            continue;
+        }
+
+        line.level = static_cast<Log::Level>(record[0]);
+        line.micros = read_u32(record + 4);
+        char text[256];
+        if (id < _formats.size() && !_formats[id].empty()) {
+            BinaryLog::format(_formats[id].c_str(), record + BinaryLog::HEADER_SIZE, length, text, sizeof(text));
+        } else {
+            ++_unknown;
+            std::snprintf(text, sizeof(text), "<format %u not defined>", static_cast<unsigned>(id));
+        }
+        line.text = text;
+        return true;
+    }
+}
+
+namespace Log {
+    BinaryLog& deferred() {
+        static BinaryLog log;
+        return log;
+    }
+}
+
+} // namespace PixelTheater
@@ -0,0 +1,100 @@
+#include "PixelTheater/core/cycle_counter.h"
+
+namespace PixelTheater {
+namespace CycleCounter {
+
+namespace {
+    Calibration g_calibration;
+    bool g_calibrated = false;
+
+    Ticks read_now() { return now(); }
+
+#if defined(PIXELTHEATER_CYCLES_RDTSC)
+    uint64_t monotonic_ns() {
+        timespec ts;
+#ifdef CLOCK_MONOTONIC_RAW
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    // TSC ticks against the raw monotonic clock over ~10 ms. The TSC runs at
+    // a fixed rate on every x86 made in the last 15 years, so once is enough.
+    double tsc_ns_per_tick() {
+        const uint64_t ns0 = monotonic_ns();
+        const uint64_t t0 = __rdtsc();
+        uint64_t ns1;
+        do {
+            ns1 = monotonic_ns();
+        } while (ns1 - ns0 < 10000000ull);
+        const uint64_t t1 = __rdtsc();
+        return t1 > t0 ? static_cast<double>(ns1 - ns0) / static_cast<double>(t1 - t0) : 1.0;
+    }
+#endif
+}
+
+Calibration measure(Ticks (*read)(), double ns_per_tick, const char* source, size_t samples) {
+    Calibration result;
+    result.source = source;
+    result.ns_per_tick = ns_per_tick;
+
+    // Overhead: the least a back-to-back pair ever reads. The minimum, not
+    // the mean, so compensation never makes a real interval negative.
+    Ticks overhead = static_cast<Ticks>(-1);
+    for (size_t i = 0; i < samples; ++i) {
+        const Ticks a = read();
+        const Ticks b = read();
+        const Ticks d = static_cast<Ticks>(b - a);
+        if (d < overhead) overhead = d;
+    }
+    result.overhead = samples ? overhead : 0;
+
+    // Resolution: wait for the counter to move and keep the smallest step.
+    // A coarse clock returns the same value for many reads in a row.
+    Ticks resolution = static_cast<Ticks>(-1);
+    for (size_t i = 0; i < samples; ++i) {
+        const Ticks a = read();
+        Ticks b = read();
+        for (size_t spin = 0; b == a && spin < 1000000; ++spin) b = read();
+        const Ticks d = static_cast<Ticks>(b - a);
+        if (d > 0 && d < resolution) resolution = d;
+    }
+    result.resolution = resolution == static_cast<Ticks>(-1) ? 0 : resolution;
+    return result;
+}
+
+const Calibration& calibrate() {
+#if defined(PLATFORM_TEENSY)
+    // The Teensy core turns the counter on at boot; make sure
+    ARM_DEMCR |= ARM_DEMCR_TRCENA;
+    ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+    g_calibration = measure(read_now, 1e9 / F_CPU_ACTUAL, "dwt_cyccnt");
+#elif defined(PLATFORM_WEB) || defined(EMSCRIPTEN)
+    g_calibration = measure(read_now, 1.0, "emscripten_now");
+#elif defined(PIXELTHEATER_CYCLES_RDTSC)
+    g_calibration = measure(read_now, tsc_ns_per_tick(), "rdtsc");
+#elif defined(CLOCK_MONOTONIC_RAW)
+    g_calibration = measure(read_now, 1.0, "monotonic_raw");
+#else
+    g_calibration = measure(read_now, 1.0, "monotonic");
+#endif
+    g_calibrated = true;
+    return g_calibration;
+}
+
+const Calibration& calibration() {
+    return g_calibrated ? g_calibration : calibrate();
+}
+
+uint32_t elapsedNs(Ticks start, Ticks end) {
+    const Calibration& cal = calibration();
+    Ticks ticks = static_cast<Ticks>(end - start);
+    ticks = ticks > cal.overhead ? ticks - cal.overhead : 0;
+    const double ns = ticks * cal.ns_per_tick;
+    return ns < 4294967295.0 ? static_cast<uint32_t>(ns + 0.5) : UINT32_MAX;
+}
+
+} // namespace CycleCounter
+} // namespace PixelTheater
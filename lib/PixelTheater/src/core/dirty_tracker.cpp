@@ -0,0 +1,75 @@
+#include "PixelTheater/core/dirty_tracker.h"
+#include "PixelTheater/core/iled_buffer.h"
+#include "PixelTheater/core/imodel.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace PixelTheater {
+
+void DirtyTracker::reset(size_t led_count) {
+    _previous.assign(led_count, CRGB(0, 0, 0));
+    _stamp.assign(led_count, 0);
+    _bits.assign((led_count + 31) / 32, 0);
+    std::fill(std::begin(_face_bits), std::end(_face_bits), 0);
+    _frame = 0;
+    _dirty_count = 0;
+    _valid = false;
+}
+
+void DirtyTracker::setFaces(const IModel& model) {
+    _faces.clear();
+    // Face ids are uint8_t, so no model has more faces than this
+    const size_t count = std::min(model.faceCount(), MAX_FACES);
+    for (size_t f = 0; f < count; ++f) {
+        const Face& face = model.face(f);
+        _faces.push_back({face.led_offset(), face.led_count()});
+    }
+}
+
+size_t DirtyTracker::dirtyFaceCount() const {
+    size_t count = 0;
+    for (uint32_t word : _face_bits) {
+        for (; word; word &= word - 1) ++count;
+    }
+    return count;
+}
+
+void DirtyTracker::capture(const ILedBuffer& leds) {
+    const size_t count = std::min(leds.ledCount(), _previous.size());
+    ++_frame;
+    std::fill(_bits.begin(), _bits.end(), 0);
+    _dirty_count = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const CRGB& c = leds.led(i);
+        CRGB& prev = _previous[i];
+        if (_valid && c.r == prev.r && c.g == prev.g && c.b == prev.b) continue;
+        prev = c;
+        _stamp[i] = _frame;
+        _bits[i >> 5] |= 1u << (i & 31);
+        ++_dirty_count;
+    }
+    _valid = true;
+
+    // A face is dirty if any bit in its LED range is set
+    std::fill(std::begin(_face_bits), std::end(_face_bits), 0);
+    if (_dirty_count == 0) return;
+    for (size_t f = 0; f < _faces.size(); ++f) {
+        const size_t first = _faces[f].offset;
+        const size_t end = std::min<size_t>(first + _faces[f].count, count);
+        for (size_t i = first; i < end; ) {
+            const uint32_t word = _bits[i >> 5] >> (i & 31);
+            if (word != 0) {
+                // Lowest set bit from i onwards, as long as it is still inside the face
+                size_t offset = 0;
+                while (!((word >> offset) & 1u)) ++offset;
+                if (i + offset < end) _face_bits[f >> 5] |= 1u << (f & 31);
+                break;
+            }
+            i = (i | 31) + 1; // Start of the next word
+        }
+    }
+}
+
+} // namespace PixelTheater
@@ -0,0 +1,62 @@
+#include "PixelTheater/core/neighbor_graph.h"
+#include "PixelTheater/core/imodel.h"
+#include "PixelTheater/limits.h"
+#include "PixelTheater/model/point.h"
+
+#include <algorithm>
+
+namespace PixelTheater {
+
+namespace {
+    // ceil(65536 / n): (sum * RECIPROCAL[n]) >> 16 == sum / n for every sum
+    // of n bytes, so the mean needs no division
+    constexpr uint32_t reciprocal(size_t n) { return n ? static_cast<uint32_t>((65536 + n - 1) / n) : 0; }
+    constexpr uint32_t RECIPROCAL[Limits::MAX_NEIGHBORS + 1] = {
+        reciprocal(0), reciprocal(1), reciprocal(2), reciprocal(3),
+        reciprocal(4), reciprocal(5), reciprocal(6), reciprocal(7),
+    };
+    static_assert(Limits::MAX_NEIGHBORS == 7, "Extend RECIPROCAL to match Limits::MAX_NEIGHBORS");
+}
+
+void NeighborGraph::build(const IModel& model, size_t led_count) {
+    led_count = std::min(led_count, model.pointCount());
+    _offsets.assign(led_count + 1, 0);
+    _ids.clear();
+    _ids.reserve(led_count * Limits::MAX_NEIGHBORS);
+    for (size_t i = 0; i < led_count; ++i) {
+        for (const auto& neighbor : model.point(i).getNeighbors()) {
+            if (neighbor.id < led_count) _ids.push_back(neighbor.id);
+        }
+        _offsets[i + 1] = static_cast<uint32_t>(_ids.size());
+    }
+    _ids.shrink_to_fit();
+}
+
+void NeighborGraph::average(const uint8_t* in, uint8_t* out) const {
+    const size_t count = ledCount();
+    const uint16_t* ids = _ids.data();
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t begin = _offsets[i];
+        const uint32_t end = _offsets[i + 1];
+        uint8_t* o = out + i * 3;
+        if (begin == end) {
+            o[0] = in[i * 3];
+            o[1] = in[i * 3 + 1];
+            o[2] = in[i * 3 + 2];
+            continue;
+        }
+        uint32_t r = 0, g = 0, b = 0;
+        for (uint32_t e = begin; e < end; ++e) {
+            const uint8_t* c = in + ids[e] * 3;
+            r += c[0];
+            g += c[1];
+            b += c[2];
+        }
+        const uint32_t inv = RECIPROCAL[end - begin];
+        o[0] = static_cast<uint8_t>((r * inv) >> 16);
+        o[1] = static_cast<uint8_t>((g * inv) >> 16);
+        o[2] = static_cast<uint8_t>((b * inv) >> 16);
+    }
+}
+
+} // namespace PixelTheater
@@ -0,0 +1,67 @@
+#include "PixelTheater/core/pixel_kernels.h"
+
+#include <cstring>
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#define PIXELTHEATER_KERNELS_SIMD32 1
+#endif
+
+namespace PixelTheater {
+namespace PixelKernels {
+
+#if defined(PIXELTHEATER_KERNELS_SIMD32)
+namespace {
+    // Four bytes at a time; the buffers need not be aligned (the M7 handles
+    // unaligned word loads, and memcpy compiles to a single LDR/STR)
+    inline uint32_t load4(const uint8_t* p) { uint32_t v; std::memcpy(&v, p, 4); return v; }
+    inline void store4(uint8_t* p, uint32_t v) { std::memcpy(p, &v, 4); }
+}
+#endif
+
+void addSaturate(uint8_t* dst, const uint8_t* src, size_t n) {
+    size_t i = 0;
+#if defined(PIXELTHEATER_KERNELS_SIMD32)
+    for (; i + 4 <= n; i += 4) store4(dst + i, __uqadd8(load4(dst + i), load4(src + i)));
+#endif
+    for (; i < n; ++i) {
+        const unsigned sum = dst[i] + src[i];
+        dst[i] = static_cast<uint8_t>(sum > 255 ? 255 : sum);
+    }
+}
+
+void subtractSaturate(uint8_t* dst, const uint8_t* src, size_t n, uint8_t value) {
+    size_t i = 0;
+#if defined(PIXELTHEATER_KERNELS_SIMD32)
+    const uint32_t values = value * 0x01010101u;
+    for (; i + 4 <= n; i += 4) store4(dst + i, __uqsub8(load4(src + i), values));
+#endif
+    for (; i < n; ++i) dst[i] = static_cast<uint8_t>(src[i] > value ? src[i] - value : 0);
+}
+
+void blend(uint8_t* dst, const uint8_t* src, size_t n, uint8_t amount) {
+    if (amount == 0) return;
+    if (amount == 255) {
+        std::memmove(dst, src, n);
+        return;
+    }
+    // blend8() from color.h, written out so the loop vectorises
+    const uint16_t keep = 255 - amount;
+    for (size_t i = 0; i < n; ++i) {
+        const uint16_t mix = static_cast<uint16_t>(dst[i] * keep + src[i] * amount + 128);
+        dst[i] = static_cast<uint8_t>((mix + (mix >> 8)) >> 8);
+    }
+}
+
+void scale(uint8_t* dst, size_t n, uint8_t scale) {
+    const uint16_t factor = static_cast<uint16_t>(scale) + 1;
+    for (size_t i = 0; i < n; ++i) dst[i] = static_cast<uint8_t>((dst[i] * factor) >> 8);
+}
+
+void scale16(uint8_t* dst, size_t n, uint32_t scale16, uint16_t dither) {
+    if (scale16 > 65536) scale16 = 65536;
+    for (size_t i = 0; i < n; ++i) dst[i] = static_cast<uint8_t>((dst[i] * scale16 + dither) >> 16);
+}
+
+} // namespace PixelKernels
+} // namespace PixelTheater
@@ -0,0 +1,110 @@
+#include "PixelTheater/core/post_process.h"
+#include "PixelTheater/core/imodel.h"
+#include "PixelTheater/core/pixel_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace PixelTheater {
+
+static_assert(sizeof(CRGB) == 3, "Post-processing treats CRGB arrays as flat channel bytes");
+
+namespace {
+    uint8_t toByte(float ratio) {
+        return static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, ratio)) * 255.0f + 0.5f);
+    }
+}
+
+PostProcess::PostProcess(const IModel& model, size_t led_count)
+    : _model(model), _led_count(led_count) {}
+
+size_t PostProcess::add(const Stage& stage, bool needs_graph, bool needs_glow) {
+    if (_count == MAX_STAGES) return NONE;
+    if (needs_graph && _graph.ledCount() == 0 && _led_count > 0) {
+        _graph.build(_model, _led_count);
+        _scratch.resize(_led_count);
+    }
+    if (needs_glow) _glow.resize(_led_count);
+    _stages[_count] = stage;
+    return _count++;
+}
+
+size_t PostProcess::addBlur(float amount, uint8_t iterations) {
+    Stage stage;
+    stage.type = StageType::Blur;
+    stage.amount = amount;
+    stage.iterations = iterations;
+    return add(stage, true, false);
+}
+
+size_t PostProcess::addBloom(uint8_t threshold, float amount, uint8_t radius) {
+    Stage stage;
+    stage.type = StageType::Bloom;
+    stage.amount = amount;
+    stage.iterations = radius;
+    stage.threshold = threshold;
+    return add(stage, true, true);
+}
+
+size_t PostProcess::addTrails(float half_life) {
+    Stage stage;
+    stage.type = StageType::Trails;
+    stage.half_life = half_life;
+    return add(stage, false, false);
+}
+
+void PostProcess::apply(CRGB* leds, size_t count, float dt) {
+    if (!leds) return;
+    uint8_t* bytes = leds[0].raw;
+    for (size_t s = 0; s < _count; ++s) {
+        const Stage& stage = _stages[s];
+        if (!stage.enabled) continue;
+        switch (stage.type) {
+            case StageType::Blur:
+                if (count >= _graph.ledCount()) blur(bytes, stage);
+                break;
+            case StageType::Bloom:
+                if (count >= _graph.ledCount()) bloom(bytes, stage);
+                break;
+            case StageType::Trails:
+                trails(bytes, count * 3, stage, dt);
+                break;
+        }
+    }
+}
+
+void PostProcess::blur(uint8_t* bytes, const Stage& stage) {
+    const uint8_t amount = toByte(stage.amount);
+    if (amount == 0 || _graph.ledCount() == 0) return;
+    const size_t n = _graph.ledCount() * 3;
+    uint8_t* mean = _scratch[0].raw;
+    for (uint8_t pass = 0; pass < stage.iterations; ++pass) {
+        _graph.average(bytes, mean);
+        PixelKernels::blend(bytes, mean, n, amount);
+    }
+}
+
+void PostProcess::bloom(uint8_t* bytes, const Stage& stage) {
+    const uint8_t amount = toByte(stage.amount);
+    if (amount == 0 || _graph.ledCount() == 0) return;
+    const size_t n = _graph.ledCount() * 3;
+    uint8_t* glow = _glow[0].raw;
+    uint8_t* mean = _scratch[0].raw;
+    PixelKernels::subtractSaturate(glow, bytes, n, stage.threshold);
+    for (uint8_t pass = 0; pass < stage.iterations; ++pass) {
+        _graph.average(glow, mean);
+        PixelKernels::blend(glow, mean, n, 128);   // Half stays, half spreads one ring further
+    }
+    PixelKernels::scale(glow, n, amount);
+    PixelKernels::addSaturate(bytes, glow, n);
+}
+
+void PostProcess::trails(uint8_t* bytes, size_t n, const Stage& stage, float dt) {
+    if (stage.half_life <= 0.0f || dt <= 0.0f) return;
+    const float keep = std::exp2(-dt / stage.half_life);
+    const uint32_t scale16 = static_cast<uint32_t>(keep * 65536.0f + 0.5f);
+    PixelKernels::scale16(bytes, n, scale16, _dither);
+    _dither += 40503;   // 65536 / golden ratio: covers 0..65535 evenly over frames
+}
+
+} // namespace PixelTheater
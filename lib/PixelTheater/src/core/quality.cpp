@@ -0,0 +1,119 @@
+#include "PixelTheater/core/quality.h"
+
+#include <cstring>
+
+namespace PixelTheater {
+
+size_t QualityKnobs::add(const char* name, uint8_t levels) {
+    if (!name || levels < 2) return NONE;
+    for (size_t i = 0; i < _count; ++i) {
+        if (std::strcmp(_knobs[i].name, name) == 0) {
+            _knobs[i].levels = levels;
+            if (_knobs[i].level >= levels) _knobs[i].level = levels - 1;
+            return i;
+        }
+    }
+    if (_count == MAX_KNOBS) return NONE;
+    _knobs[_count] = Knob{name, levels, static_cast<uint8_t>(levels - 1), true};
+    return _count++;
+}
+
+void QualityKnobs::set(size_t knob, uint8_t level) {
+    if (knob >= _count) return;
+    _knobs[knob].level = level < _knobs[knob].levels ? level : _knobs[knob].levels - 1;
+}
+
+void QualityKnobs::setActive(size_t knob, bool active) {
+    if (knob >= _count || _knobs[knob].active == active) return;
+    _knobs[knob].active = active;
+    _knobs[knob].level = _knobs[knob].levels - 1;
+}
+
+bool QualityKnobs::stepDown() {
+    for (size_t i = 0; i < _count; ++i) {
+        if (_knobs[i].active && _knobs[i].level > 0) {
+            _knobs[i].level--;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool QualityKnobs::stepUp() {
+    // The last knob that went down comes back first
+    for (size_t i = _count; i-- > 0;) {
+        if (_knobs[i].active && _knobs[i].level + 1 < _knobs[i].levels) {
+            _knobs[i].level++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void QualityKnobs::restore() {
+    for (size_t i = 0; i < _count; ++i) _knobs[i].level = _knobs[i].levels - 1;
+}
+
+uint16_t QualityKnobs::total() const {
+    uint16_t sum = 0;
+    for (size_t i = 0; i < _count; ++i) sum += _knobs[i].level;
+    return sum;
+}
+
+uint16_t QualityKnobs::maxTotal() const {
+    uint16_t sum = 0;
+    for (size_t i = 0; i < _count; ++i) sum += _knobs[i].levels - 1;
+    return sum;
+}
+
+void QualityGovernor::setConfig(const Config& config) {
+    _config = config;
+    reset();
+}
+
+void QualityGovernor::reset() {
+    _over_count = 0;
+    _under_count = 0;
+    _backoff = 1;
+    _last_step = 0;
+}
+
+int QualityGovernor::record(uint32_t frame_us, QualityKnobs& knobs) {
+    if (!enabled() || knobs.count() == 0) return 0;
+
+    const float target = static_cast<float>(_config.target_us);
+    const float frame = static_cast<float>(frame_us);
+    if (frame > target * _config.over) {
+        _under_count = 0;
+        if (++_over_count < _config.down_frames) return 0;
+        if (!knobs.stepDown()) {
+            _over_count = 0;    // Already at the bottom; nothing left to give
+            return 0;
+        }
+        // The level we just left could not hold: wait longer before trying it again
+        if (_last_step > 0 && _backoff < _config.max_backoff) _backoff *= 2;
+        _last_step = -1;
+        _steps_down++;
+    } else {
+        if (_over_count > 0) _over_count--;
+        if (frame >= target * _config.under) {
+            if (_under_count > 0) _under_count--;
+            return 0;
+        }
+        if (++_under_count < static_cast<uint32_t>(_config.up_frames) * _backoff) return 0;
+        if (!knobs.stepUp()) {
+            _under_count = 0;
+            return 0;
+        }
+        // Two steps up in a row: the load really went down
+        if (_last_step > 0) _backoff = 1;
+        _last_step = 1;
+        _steps_up++;
+    }
+
+    _over_count = 0;
+    _under_count = 0;
+    return _last_step;
+}
+
+} // namespace PixelTheater
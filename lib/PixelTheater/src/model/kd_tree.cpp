@@ -0,0 +1,97 @@
+#include "PixelTheater/model/kd_tree.h"
+
+#include <algorithm>
+
+namespace PixelTheater {
+
+namespace {
+    bool closer(float d, uint32_t i, const KdTree::Result& r) {
+        return d < r.distance_sq || (d == r.distance_sq && i < r.index);
+    }
+}
+
+void KdTree::build(const float* xyz, size_t count) {
+    _points.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        Node& node = _points[i];
+        node.pos[0] = xyz[i * 3];
+        node.pos[1] = xyz[i * 3 + 1];
+        node.pos[2] = xyz[i * 3 + 2];
+        node.index = static_cast<uint32_t>(i);
+        node.axis = 0;
+    }
+    buildRange(0, count);
+}
+
+void KdTree::buildRange(size_t begin, size_t end) {
+    if (end - begin < 2) return;
+
+    // Split along the axis the points spread furthest on
+    float lo[3] = {_points[begin].pos[0], _points[begin].pos[1], _points[begin].pos[2]};
+    float hi[3] = {lo[0], lo[1], lo[2]};
+    for (size_t i = begin + 1; i < end; ++i) {
+        for (int a = 0; a < 3; ++a) {
+            lo[a] = std::min(lo[a], _points[i].pos[a]);
+            hi[a] = std::max(hi[a], _points[i].pos[a]);
+        }
+    }
+    uint8_t axis = 0;
+    for (uint8_t a = 1; a < 3; ++a) {
+        if (hi[a] - lo[a] > hi[axis] - lo[axis]) axis = a;
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    std::nth_element(_points.begin() + begin, _points.begin() + mid, _points.begin() + end,
+                     [axis](const Node& a, const Node& b) {
+                         return a.pos[axis] < b.pos[axis] || (a.pos[axis] == b.pos[axis] && a.index < b.index);
+                     });
+    _points[mid].axis = axis;
+    buildRange(begin, mid);
+    buildRange(mid + 1, end);
+}
+
+size_t KdTree::nearest(float x, float y, float z, size_t k, float max_distance,
+                       Result* out, size_t exclude) const {
+    k = std::min(k, MAX_RESULTS);
+    if (k == 0 || _points.empty() || max_distance < 0.0f) return 0;
+    const float query[3] = {x, y, z};
+    size_t count = 0;
+    float worst = max_distance * max_distance;
+    search(0, _points.size(), query, exclude, out, count, k, worst);
+    return count;
+}
+
+void KdTree::search(size_t begin, size_t end, const float* query, size_t exclude,
+                    Result* results, size_t& count, size_t k, float& worst) const {
+    if (begin >= end) return;
+    const size_t mid = begin + (end - begin) / 2;
+    const Node& node = _points[mid];
+
+    const float dx = node.pos[0] - query[0];
+    const float dy = node.pos[1] - query[1];
+    const float dz = node.pos[2] - query[2];
+    const float d = dx * dx + dy * dy + dz * dz;
+    if (d <= worst && node.index != exclude && (count < k || closer(d, node.index, results[count - 1]))) {
+        // Insert in order, dropping the furthest once there are k
+        size_t slot = count < k ? count++ : k - 1;
+        while (slot > 0 && closer(d, node.index, results[slot - 1])) {
+            results[slot] = results[slot - 1];
+            --slot;
+        }
+        results[slot] = {node.index, d};
+        if (count == k) worst = results[k - 1].distance_sq;
+    }
+
+    if (end - begin == 1) return;
+    const float diff = query[node.axis] - node.pos[node.axis];
+    const bool left_first = diff < 0.0f;
+    if (left_first) search(begin, mid, query, exclude, results, count, k, worst);
+    else search(mid + 1, end, query, exclude, results, count, k, worst);
+    // The far side can only hold something as close as the splitting plane
+    if (diff * diff <= worst) {
+        if (left_first) search(mid + 1, end, query, exclude, results, count, k, worst);
+        else search(begin, mid, query, exclude, results, count, k, worst);
+    }
+}
+
+} // namespace PixelTheater
@@ -0,0 +1,318 @@
+#include "PixelTheater/model/model_blob.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace PixelTheater {
+
+// Every target (Teensy, x86/ARM hosts, WebAssembly) is little-endian, so
+// fields are copied as they are
+namespace {
+    void put8(std::vector<uint8_t>& out, uint8_t v) { out.push_back(v); }
+    void put16(std::vector<uint8_t>& out, uint16_t v) { out.push_back(v & 0xFF); out.push_back(v >> 8); }
+    void put32(std::vector<uint8_t>& out, uint32_t v) {
+        for (int i = 0; i < 4; ++i) out.push_back((v >> (8 * i)) & 0xFF);
+    }
+    void putFloat(std::vector<uint8_t>& out, float v) {
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        put32(out, bits);
+    }
+
+    uint16_t get16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+    uint32_t get32(const uint8_t* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+    float getFloat(const uint8_t* p) {
+        const uint32_t bits = get32(p);
+        float v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+}
+
+uint32_t ModelBlob::checksum(const uint8_t* data, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// --- ModelBlobWriter ---
+
+void ModelBlobWriter::setMetadata(const std::string& name, const std::string& version,
+                                  const std::string& description, const std::string& model_type) {
+    _strings[0] = name;
+    _strings[1] = version;
+    _strings[2] = description;
+    _strings[3] = model_type;
+}
+
+void ModelBlobWriter::addGroup(uint8_t face_type, const std::string& name, const uint16_t* leds, size_t count) {
+    _groups.push_back({face_type, name, std::vector<uint16_t>(leds, leds + count)});
+}
+
+void ModelBlobWriter::addPoint(const ModelBlob::PointRecord& point,
+                               const ModelBlob::NeighborRecord* neighbors, size_t neighbor_count) {
+    _points.push_back(point);
+    const size_t kept = std::min(neighbor_count, _max_neighbors);
+    for (size_t i = 0; i < _max_neighbors; ++i) {
+        _neighbors.push_back(i < kept ? neighbors[i] : ModelBlob::NeighborRecord{});
+    }
+}
+
+std::vector<uint8_t> ModelBlobWriter::finish() const {
+    using namespace ModelBlob;
+    if (_points.size() >= NO_NEIGHBOR || _faces.size() > 255 || _face_types.size() > 255 ||
+        _max_neighbors > 255 || _groups.size() > 0xFFFF) {
+        return {};
+    }
+    for (const auto& group : _groups) {
+        if (group.leds.size() > 0xFFFF) return {};
+    }
+
+    std::vector<uint8_t> body;
+    for (const auto& ft : _face_types) {
+        put8(body, static_cast<uint8_t>(ft.type));
+        put8(body, 0);
+        put16(body, ft.num_leds);
+        putFloat(body, ft.edge_length_mm);
+    }
+    for (const auto& face : _faces) {
+        put8(body, face.id);
+        put8(body, face.type_id);
+        put8(body, face.rotation);
+        put8(body, face.vertex_count);
+        putFloat(body, face.x);
+        putFloat(body, face.y);
+        putFloat(body, face.z);
+        for (const auto& v : face.vertices) {
+            putFloat(body, v.x);
+            putFloat(body, v.y);
+            putFloat(body, v.z);
+        }
+    }
+    for (const auto& point : _points) {
+        put16(body, point.id);
+        put8(body, point.face_id);
+        put8(body, 0);
+        putFloat(body, point.x);
+        putFloat(body, point.y);
+        putFloat(body, point.z);
+    }
+    for (const auto& neighbor : _neighbors) {
+        put16(body, neighbor.id);
+        putFloat(body, neighbor.distance);
+    }
+    size_t first = 0;
+    size_t name_at = 0;
+    for (const auto& s : _strings) name_at += s.size() + 1;
+    for (const auto& group : _groups) {
+        put8(body, group.face_type);
+        put8(body, 0);
+        put16(body, static_cast<uint16_t>(group.leds.size()));
+        put32(body, static_cast<uint32_t>(first));
+        put32(body, static_cast<uint32_t>(name_at));
+        first += group.leds.size();
+        name_at += group.name.size() + 1;
+    }
+    for (const auto& group : _groups) {
+        for (uint16_t led : group.leds) put16(body, led);
+    }
+
+    size_t strings_size = 0;
+    auto putString = [&](const std::string& s) {
+        body.insert(body.end(), s.begin(), s.end());
+        body.push_back(0);
+        strings_size += s.size() + 1;
+    };
+    for (const auto& s : _strings) putString(s);
+    for (const auto& group : _groups) putString(group.name);
+
+    std::vector<uint8_t> out;
+    out.reserve(HEADER_SIZE + body.size());
+    out.insert(out.end(), MAGIC, MAGIC + 4);
+    put16(out, VERSION);
+    put16(out, HEADER_SIZE);
+    put16(out, static_cast<uint16_t>(_points.size()));
+    put8(out, static_cast<uint8_t>(_faces.size()));
+    put8(out, static_cast<uint8_t>(_face_types.size()));
+    put8(out, static_cast<uint8_t>(_max_neighbors));
+    put8(out, 0);
+    put16(out, static_cast<uint16_t>(_groups.size()));
+    putFloat(out, _sphere_radius);
+    put32(out, static_cast<uint32_t>(strings_size));
+    put32(out, static_cast<uint32_t>(HEADER_SIZE + body.size()));
+    put32(out, checksum(body.data(), body.size()));
+    out.insert(out.end(), body.begin(), body.end());
+    return out;
+}
+
+// --- ModelBlobReader ---
+
+bool ModelBlobReader::open(const uint8_t* data, size_t size) {
+    using namespace ModelBlob;
+    *this = ModelBlobReader();
+    if (!data || size < HEADER_SIZE || std::memcmp(data, MAGIC, 4) != 0) return false;
+    const uint16_t version = get16(data + 4);
+    if (version < MIN_VERSION || version > VERSION || get16(data + 6) != HEADER_SIZE) return false;
+
+    const size_t led_count = get16(data + 8);
+    const size_t face_count = data[10];
+    const size_t face_type_count = data[11];
+    const size_t max_neighbors = data[12];
+    const size_t group_count = version >= 2 ? get16(data + 14) : 0;
+    const size_t strings_size = get32(data + 20);
+    const size_t total = get32(data + 24);
+    const size_t fixed = HEADER_SIZE + face_type_count * FACE_TYPE_SIZE + face_count * FACE_SIZE +
+                         led_count * (POINT_SIZE + max_neighbors * NEIGHBOR_SIZE) + group_count * GROUP_SIZE;
+    // What is left between the fixed sections and the strings is the groups' LED list
+    if (size < total || total < fixed || total - fixed < strings_size) return false;
+    const size_t group_leds_size = total - fixed - strings_size;
+    if (group_leds_size % 2 != 0 || (group_count == 0 && group_leds_size != 0)) return false;
+    if (checksum(data + HEADER_SIZE, total - HEADER_SIZE) != get32(data + 28)) return false;
+
+    // At least four NUL-ended strings, the last ending exactly at the end of the blob
+    const char* strings = reinterpret_cast<const char*>(data + total - strings_size);
+    if (strings_size == 0 || strings[strings_size - 1] != 0) return false;
+    const char* found[4];
+    size_t at = 0;
+    for (auto& s : found) {
+        const void* nul = at < strings_size ? std::memchr(strings + at, 0, strings_size - at) : nullptr;
+        if (!nul) return false;
+        s = strings + at;
+        at = static_cast<const char*>(nul) - strings + 1;
+    }
+    if (version < 2 && at != strings_size) return false;
+
+    const size_t groups_at = fixed - group_count * GROUP_SIZE;
+    for (size_t g = 0; g < group_count; ++g) {
+        const uint8_t* p = data + groups_at + g * GROUP_SIZE;
+        if (p[0] >= face_type_count || size_t{get32(p + 4)} + get16(p + 2) > group_leds_size / 2 ||
+            get32(p + 8) < at || get32(p + 8) >= strings_size) {
+            return false;
+        }
+    }
+
+    _data = data;
+    _size = total;
+    _led_count = led_count;
+    _face_count = face_count;
+    _face_type_count = face_type_count;
+    _max_neighbors = max_neighbors;
+    _group_count = group_count;
+    _version_number = version;
+    _sphere_radius = getFloat(data + 16);
+    _face_types_at = HEADER_SIZE;
+    _faces_at = _face_types_at + face_type_count * FACE_TYPE_SIZE;
+    _points_at = _faces_at + face_count * FACE_SIZE;
+    _neighbors_at = _points_at + led_count * POINT_SIZE;
+    _groups_at = groups_at;
+    _group_leds_at = fixed;
+    _strings_at = total - strings_size;
+    _name = found[0];
+    _version = found[1];
+    _description = found[2];
+    _model_type = found[3];
+    if (!recordsConsistent()) {
+        *this = ModelBlobReader();
+        return false;
+    }
+    return true;
+}
+
+bool ModelBlobReader::recordsConsistent() const {
+    size_t face_leds = 0;
+    for (size_t f = 0; f < _face_count; ++f) {
+        const uint8_t type_id = _data[_faces_at + f * ModelBlob::FACE_SIZE + 1];
+        if (type_id >= _face_type_count) return false;
+        face_leds += faceType(type_id).num_leds;
+    }
+    if (face_leds != _led_count) return false;
+
+    for (size_t i = 0; i < _led_count; ++i) {
+        const uint8_t* p = _data + _points_at + i * ModelBlob::POINT_SIZE;
+        if (get16(p) >= _led_count || p[2] >= _face_count) return false;
+        const uint8_t* n = _data + _neighbors_at + i * _max_neighbors * ModelBlob::NEIGHBOR_SIZE;
+        for (size_t k = 0; k < _max_neighbors; ++k, n += ModelBlob::NEIGHBOR_SIZE) {
+            const uint16_t id = get16(n);
+            if (id != ModelBlob::NO_NEIGHBOR && id >= _led_count) return false;
+        }
+    }
+    return true;
+}
+
+ModelBlob::FaceTypeRecord ModelBlobReader::faceType(size_t i) const {
+    const uint8_t* p = _data + _face_types_at + i * ModelBlob::FACE_TYPE_SIZE;
+    ModelBlob::FaceTypeRecord ft;
+    ft.type = static_cast<FaceType>(p[0]);
+    ft.num_leds = get16(p + 2);
+    ft.edge_length_mm = getFloat(p + 4);
+    return ft;
+}
+
+ModelBlob::FaceRecord ModelBlobReader::face(size_t i) const {
+    const uint8_t* p = _data + _faces_at + i * ModelBlob::FACE_SIZE;
+    ModelBlob::FaceRecord face;
+    face.id = p[0];
+    face.type_id = p[1];
+    face.rotation = p[2];
+    face.vertex_count = std::min<uint8_t>(p[3], ModelBlob::MAX_VERTICES);
+    face.x = getFloat(p + 4);
+    face.y = getFloat(p + 8);
+    face.z = getFloat(p + 12);
+    for (size_t v = 0; v < ModelBlob::MAX_VERTICES; ++v) {
+        const uint8_t* q = p + 16 + v * 12;
+        face.vertices[v] = {getFloat(q), getFloat(q + 4), getFloat(q + 8)};
+    }
+    return face;
+}
+
+ModelBlob::PointRecord ModelBlobReader::point(size_t i) const {
+    const uint8_t* p = _data + _points_at + i * ModelBlob::POINT_SIZE;
+    ModelBlob::PointRecord point;
+    point.id = get16(p);
+    point.face_id = p[2];
+    point.x = getFloat(p + 4);
+    point.y = getFloat(p + 8);
+    point.z = getFloat(p + 12);
+    return point;
+}
+
+size_t ModelBlobReader::neighbors(size_t i, ModelBlob::NeighborRecord* out, size_t max) const {
+    const uint8_t* p = _data + _neighbors_at + i * _max_neighbors * ModelBlob::NEIGHBOR_SIZE;
+    size_t count = 0;
+    for (size_t n = 0; n < _max_neighbors && count < max; ++n, p += ModelBlob::NEIGHBOR_SIZE) {
+        const uint16_t id = get16(p);
+        if (id == ModelBlob::NO_NEIGHBOR) continue;
+        out[count++] = {id, getFloat(p + 2)};
+    }
+    return count;
+}
+
+ModelBlob::GroupRecord ModelBlobReader::group(size_t i) const {
+    const uint8_t* p = _data + _groups_at + i * ModelBlob::GROUP_SIZE;
+    ModelBlob::GroupRecord group;
+    group.name = reinterpret_cast<const char*>(_data + _strings_at + get32(p + 8));
+    group.face_type = p[0];
+    group.led_count = get16(p + 2);
+    return group;
+}
+
+uint16_t ModelBlobReader::groupLed(size_t i, size_t j) const {
+    const uint8_t* p = _data + _groups_at + i * ModelBlob::GROUP_SIZE;
+    return get16(_data + _group_leds_at + (get32(p + 4) + j) * 2);
+}
+
+int ModelBlobReader::findGroup(const char* name, uint8_t face_type) const {
+    for (size_t i = 0; i < _group_count; ++i) {
+        const auto g = group(i);
+        if (g.face_type == face_type && std::strcmp(g.name, name) == 0) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+} // namespace PixelTheater
@@ -0,0 +1,123 @@
+#include "PixelTheater/model/runtime_model.h"
+
+#include <algorithm>
+
+#if !defined(PLATFORM_TEENSY)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace PixelTheater {
+
+RuntimeModel::~RuntimeModel() {
+    unload();
+}
+
+void RuntimeModel::unload() {
+    _blob = ModelBlobReader();
+    _points.clear();
+    _faces.clear();
+    _face_type.clear();
+#if !defined(PLATFORM_TEENSY)
+    if (_mapping) munmap(_mapping, _mapping_size);
+#endif
+    _mapping = nullptr;
+    _mapping_size = 0;
+}
+
+bool RuntimeModel::load(const uint8_t* data, size_t size) {
+    if (data != _mapping) unload();
+    if (!_blob.open(data, size)) return false;
+
+    ModelBlob::NeighborRecord blob_neighbors[Limits::MAX_NEIGHBORS];
+    Point::Neighbor neighbors[Limits::MAX_NEIGHBORS];
+    _points.resize(_blob.ledCount());
+    for (size_t i = 0; i < _blob.ledCount(); ++i) {
+        const auto point = _blob.point(i);
+        _points[point.id] = Point(point.id, point.face_id, point.x, point.y, point.z);
+        const size_t count = _blob.neighbors(i, blob_neighbors, Limits::MAX_NEIGHBORS);
+        for (size_t n = 0; n < count; ++n) neighbors[n] = {blob_neighbors[n].id, blob_neighbors[n].distance};
+        _points[point.id].setNeighbors(neighbors, count);
+    }
+    buildFaces();
+    return true;
+}
+
+#if !defined(PLATFORM_TEENSY)
+bool RuntimeModel::loadFile(const char* path) {
+    unload();
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);      // The mapping stays valid
+    if (mapping == MAP_FAILED) return false;
+
+    _mapping = mapping;
+    _mapping_size = static_cast<size_t>(st.st_size);
+    if (!load(static_cast<const uint8_t*>(mapping), _mapping_size)) {
+        unload();
+        return false;
+    }
+    return true;
+}
+#endif
+
+void RuntimeModel::attachLeds(CRGB* leds) {
+    _leds = leds;
+    buildFaces();
+}
+
+void RuntimeModel::buildFaces() {
+    _faces.clear();
+    _face_type.clear();
+    if (!_blob.valid()) return;
+    _faces.reserve(_blob.faceCount());
+    _face_type.reserve(_blob.faceCount());
+
+    size_t led_offset = 0;
+    for (size_t i = 0; i < _blob.faceCount(); ++i) {
+        const auto face_data = _blob.face(i);
+        const uint8_t type_id = face_data.type_id; // In range: checked by ModelBlobReader::open()
+        const auto face_type = _blob.faceType(type_id);
+        const auto sides = std::min<size_t>(static_cast<size_t>(face_type.type), Limits::MAX_EDGES_PER_FACE);
+        _faces.emplace_back(face_type.type, face_data.id, static_cast<uint16_t>(led_offset), face_type.num_leds,
+                            _leds, static_cast<uint16_t>(sides));
+        for (size_t j = 0; j < sides; ++j) {
+            _faces.back().vertices[j] = {face_data.vertices[j].x, face_data.vertices[j].y, face_data.vertices[j].z};
+        }
+        _face_type.push_back(type_id);
+        led_offset += face_type.num_leds;
+    }
+}
+
+const Point& RuntimeModel::dummyPoint() {
+    static const Point dummy;
+    return dummy;
+}
+
+const Face& RuntimeModel::dummyFace() {
+    static const Face dummy;
+    return dummy;
+}
+
+size_t RuntimeModel::groupLeds(const char* group, size_t face, uint16_t* out, size_t max) const {
+    if (face >= _faces.size()) return 0;
+    const int g = _blob.findGroup(group, _face_type[face]);
+    if (g < 0) return 0;
+    const auto record = _blob.group(static_cast<size_t>(g));
+    const Face& f = _faces[face];
+    size_t count = 0;
+    for (size_t j = 0; j < record.led_count && count < max; ++j) {
+        const uint16_t led = _blob.groupLed(static_cast<size_t>(g), j);
+        if (led < f.led_count()) out[count++] = static_cast<uint16_t>(f.led_offset() + led);
+    }
+    return count;
+}
+
+} // namespace PixelTheater
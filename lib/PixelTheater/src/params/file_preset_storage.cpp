@@ -0,0 +1,33 @@
+#if !defined(PLATFORM_TEENSY)
+
+#include "PixelTheater/params/file_preset_storage.h"
+#include <cstdio>
+
+namespace PixelTheater {
+
+bool FilePresetStorage::read(size_t offset, uint8_t* dst, size_t len) {
+    if (offset + len > _capacity) return false;
+    FILE* f = fopen(_path.c_str(), "rb");
+    if (!f) return false;
+    const bool ok = fseek(f, static_cast<long>(offset), SEEK_SET) == 0 &&
+                    fread(dst, 1, len, f) == len;
+    fclose(f);
+    return ok;
+}
+
+bool FilePresetStorage::write(size_t offset, const uint8_t* src, size_t len) {
+    if (offset + len > _capacity) return false;
+    FILE* f = fopen(_path.c_str(), "r+b");
+    if (!f) f = fopen(_path.c_str(), "w+b");
+    if (!f) return false;
+    // Seeking past the end and writing leaves a zero-filled gap: empty slots
+    const bool ok = fseek(f, static_cast<long>(offset), SEEK_SET) == 0 &&
+                    fwrite(src, 1, len, f) == len &&
+                    fflush(f) == 0;
+    fclose(f);
+    return ok;
+}
+
+} // namespace PixelTheater
+
+#endif
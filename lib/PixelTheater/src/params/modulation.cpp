@@ -0,0 +1,235 @@
+#include "PixelTheater/params/modulation.h"
+#include "PixelTheater/core/log.h"
+#include <cmath>
+
+namespace PixelTheater {
+
+namespace {
+    constexpr float TWO_PI_F = 6.28318530718f;
+
+    bool is_numeric(ParamType type) {
+        return ParamHandlers::TypeHandler::is_float_type(type) || type == ParamType::count;
+    }
+
+    // Uniform in -1..1
+    float next_random(uint32_t& state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return static_cast<float>(state >> 8) * (2.0f / 16777216.0f) - 1.0f;
+    }
+}
+
+ModulationMatrix::ModulationMatrix(Settings& settings)
+    : _settings(settings)
+    , _revision(settings.schema_revision())
+{}
+
+int ModulationMatrix::add_source(const Source& source) {
+    if (_source_count >= MAX_SOURCES) {
+        Log::warning("[WARNING] ModulationMatrix: no room for more than %zu sources\n", MAX_SOURCES);
+        return -1;
+    }
+    _sources[_source_count] = source;
+    return static_cast<int>(_source_count++);
+}
+
+int ModulationMatrix::add_lfo(float hz, Shape shape, float phase) {
+    Source s{};
+    s.kind = Kind::Lfo;
+    s.shape = shape;
+    s.rate = hz;
+    s.phase = phase - std::floor(phase);
+    return add_source(s);
+}
+
+int ModulationMatrix::add_random_walk(float rate, uint32_t seed) {
+    Source s{};
+    s.kind = Kind::RandomWalk;
+    s.rate = rate;
+    s.rng = seed ? seed : 1;
+    return add_source(s);
+}
+
+int ModulationMatrix::add_envelope(float attack, float decay, float sustain, float release) {
+    Source s{};
+    s.kind = Kind::Envelope;
+    s.stage = Stage::Idle;
+    s.attack = attack;
+    s.decay = decay;
+    s.sustain = sustain < 0.0f ? 0.0f : (sustain > 1.0f ? 1.0f : sustain);
+    s.release = release;
+    return add_source(s);
+}
+
+void ModulationMatrix::trigger(int source) {
+    if (source < 0 || static_cast<size_t>(source) >= _source_count) return;
+    if (_sources[source].kind == Kind::Envelope) _sources[source].stage = Stage::Attack;
+}
+
+void ModulationMatrix::release(int source) {
+    if (source < 0 || static_cast<size_t>(source) >= _source_count) return;
+    Source& s = _sources[source];
+    if (s.kind == Kind::Envelope && s.stage != Stage::Idle) s.stage = Stage::Release;
+}
+
+float ModulationMatrix::source_value(int source) const {
+    if (source < 0 || static_cast<size_t>(source) >= _source_count) return 0.0f;
+    return _sources[source].value;
+}
+
+int ModulationMatrix::find_dest(const std::string& name) const {
+    for (size_t i = 0; i < _dest_count; ++i) {
+        if (_dests[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+float ModulationMatrix::read(const Dest& dest) const {
+    const ParamValue& value = _settings.value_at(static_cast<size_t>(dest.index));
+    return dest.integer ? static_cast<float>(value.as_int()) : value.as_float();
+}
+
+void ModulationMatrix::write(Dest& dest, float value) {
+    if (dest.integer) {
+        _settings.set_value_at(static_cast<size_t>(dest.index), ParamValue(static_cast<int>(lroundf(value))));
+    } else {
+        _settings.set_value_at(static_cast<size_t>(dest.index), ParamValue(value));
+    }
+    // Read back: flags may have clamped or wrapped it
+    dest.written = read(dest);
+}
+
+bool ModulationMatrix::route(int source, const std::string& param, float depth, float offset) {
+    if (source < 0 || static_cast<size_t>(source) >= _source_count) return false;
+    if (_settings.schema_revision() != _revision) resolve();
+
+    int dest = find_dest(param);
+    if (dest < 0) {
+        const int index = _settings.index_of(param);
+        if (index < 0 || !is_numeric(_settings.metadata_at(static_cast<size_t>(index)).type)) {
+            Log::warning("[WARNING] ModulationMatrix: '%s' is not a numeric parameter\n", param.c_str());
+            return false;
+        }
+        if (_dest_count >= MAX_ROUTES) return false;
+        Dest& d = _dests[_dest_count];
+        d.name = param;
+        d.index = index;
+        d.integer = _settings.metadata_at(static_cast<size_t>(index)).type == ParamType::count;
+        d.base = read(d);
+        d.written = d.base;
+        d.sum = d.base;
+        dest = static_cast<int>(_dest_count++);
+    }
+    if (_route_count >= MAX_ROUTES) {
+        Log::warning("[WARNING] ModulationMatrix: no room for more than %zu routes\n", MAX_ROUTES);
+        return false;
+    }
+    _routes[_route_count++] = Route{static_cast<uint8_t>(source), static_cast<uint8_t>(dest), depth, offset};
+    return true;
+}
+
+void ModulationMatrix::remove_dest(size_t dest) {
+    if (_dests[dest].index >= 0) write(_dests[dest], _dests[dest].base);
+
+    size_t kept = 0;
+    for (size_t i = 0; i < _route_count; ++i) {
+        if (_routes[i].dest == dest) continue;
+        Route r = _routes[i];
+        if (r.dest > dest) r.dest--;
+        _routes[kept++] = r;
+    }
+    _route_count = kept;
+    for (size_t i = dest + 1; i < _dest_count; ++i) _dests[i - 1] = _dests[i];
+    _dest_count--;
+}
+
+void ModulationMatrix::unroute(const std::string& param) {
+    const int dest = find_dest(param);
+    if (dest >= 0) remove_dest(static_cast<size_t>(dest));
+}
+
+void ModulationMatrix::clear() {
+    while (_dest_count > 0) remove_dest(_dest_count - 1);
+    _route_count = 0;
+    _source_count = 0;
+}
+
+void ModulationMatrix::resolve() {
+    _revision = _settings.schema_revision();
+    for (size_t i = 0; i < _dest_count; ++i) {
+        Dest& d = _dests[i];
+        d.index = _settings.index_of(d.name);
+        if (d.index >= 0 && !is_numeric(_settings.metadata_at(static_cast<size_t>(d.index)).type)) d.index = -1;
+        if (d.index < 0) continue;
+        d.integer = _settings.metadata_at(static_cast<size_t>(d.index)).type == ParamType::count;
+        d.base = read(d);
+        d.written = d.base;
+    }
+}
+
+void ModulationMatrix::update(float dt) {
+    if (_settings.schema_revision() != _revision) resolve();
+
+    for (size_t i = 0; i < _source_count; ++i) {
+        Source& s = _sources[i];
+        switch (s.kind) {
+            case Kind::Lfo: {
+                s.phase += s.rate * dt;
+                s.phase -= std::floor(s.phase);
+                switch (s.shape) {
+                    case Shape::Sine:     s.value = std::sin(s.phase * TWO_PI_F); break;
+                    case Shape::Triangle: s.value = 1.0f - 4.0f * std::fabs(s.phase - 0.5f); break;
+                    case Shape::Saw:      s.value = 2.0f * s.phase - 1.0f; break;
+                    case Shape::Square:   s.value = s.phase < 0.5f ? 1.0f : -1.0f; break;
+                }
+                break;
+            }
+            case Kind::RandomWalk: {
+                // Uniform steps scaled so the spread after one second is about `rate`
+                s.value += next_random(s.rng) * s.rate * std::sqrt(3.0f * dt);
+                if (s.value > 1.0f) s.value = 2.0f - s.value;
+                if (s.value < -1.0f) s.value = -2.0f - s.value;
+                break;
+            }
+            case Kind::Envelope: {
+                switch (s.stage) {
+                    case Stage::Idle:
+                        break;
+                    case Stage::Attack:
+                        s.value = s.attack > 0.0f ? s.value + dt / s.attack : 1.0f;
+                        if (s.value >= 1.0f) { s.value = 1.0f; s.stage = Stage::Decay; }
+                        break;
+                    case Stage::Decay:
+                        s.value = s.decay > 0.0f ? s.value - dt * (1.0f - s.sustain) / s.decay : s.sustain;
+                        if (s.value <= s.sustain) { s.value = s.sustain; s.stage = Stage::Sustain; }
+                        break;
+                    case Stage::Sustain:
+                        break;
+                    case Stage::Release:
+                        s.value = s.release > 0.0f ? s.value - dt / s.release : 0.0f;
+                        if (s.value <= 0.0f) { s.value = 0.0f; s.stage = Stage::Idle; }
+                        break;
+                }
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < _dest_count; ++i) {
+        Dest& d = _dests[i];
+        if (d.index < 0) continue;
+        const float current = read(d);
+        if (current != d.written) d.base = current;     // Changed from outside
+        d.sum = d.base;
+    }
+    for (size_t i = 0; i < _route_count; ++i) {
+        const Route& r = _routes[i];
+        _dests[r.dest].sum += r.offset + r.depth * _sources[r.source].value;
+    }
+    for (size_t i = 0; i < _dest_count; ++i) {
+        if (_dests[i].index >= 0) write(_dests[i], _dests[i].sum);
+    }
+}
+
+} // namespace PixelTheater
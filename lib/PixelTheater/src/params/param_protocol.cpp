@@ -0,0 +1,230 @@
+#include "PixelTheater/params/param_protocol.h"
+#include "PixelTheater/params/param_schema.h"
+#include "PixelTheater/scene.h"
+#include <cstring>
+
+namespace PixelTheater {
+namespace ParamProtocol {
+
+namespace {
+
+void put_u32(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+uint32_t get_u32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+size_t write_header(uint8_t* out, Op op, uint32_t version, size_t count) {
+    out[0] = static_cast<uint8_t>(op);
+    put_u32(out + 1, version);
+    out[5] = static_cast<uint8_t>(count);
+    return REQUEST_HEADER;
+}
+
+size_t reply_header(uint8_t* out, Op op, uint32_t version, Status status, size_t count) {
+    out[0] = static_cast<uint8_t>(op) | REPLY;
+    put_u32(out + 1, version);
+    out[5] = static_cast<uint8_t>(status);
+    out[6] = static_cast<uint8_t>(count);
+    return REPLY_HEADER;
+}
+
+// Entries are index + value; returns the reply length or 0 on overflow.
+// Schema order is Settings declaration order, so indices address Settings directly.
+size_t write_values(Scene& scene, const SceneParameterSchema& schema, Op op,
+                    const uint8_t* indices, size_t count, uint8_t* out, size_t max) {
+    size_t pos = REPLY_HEADER;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t index = indices ? indices[i] : i;
+        const ParameterSchema& param = schema.parameters[index];
+        const size_t size = value_size(param.param_type);
+        if (pos + 1 + size > max) return 0;
+        out[pos++] = static_cast<uint8_t>(index);
+        encode_value(out + pos, param.param_type, scene._settings_storage.value_at(index));
+        pos += size;
+    }
+    reply_header(out, op, schema.version, Status::Ok, count);
+    return pos;
+}
+
+} // namespace
+
+size_t value_size(ParamType type) {
+    return type == ParamType::switch_type ? 1 : 4;
+}
+
+void encode_value(uint8_t* p, ParamType type, const ParamValue& value) {
+    if (type == ParamType::switch_type) {
+        p[0] = value.as_bool() ? 1 : 0;
+    } else if (ParamHandlers::TypeHandler::is_int_type(type)) {
+        put_u32(p, static_cast<uint32_t>(value.as_int()));
+    } else {
+        const float f = value.as_float();
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        put_u32(p, bits);
+    }
+}
+
+ParamValue decode_value(const uint8_t* p, ParamType type) {
+    if (type == ParamType::switch_type) {
+        return ParamValue(p[0] != 0);
+    }
+    const uint32_t bits = get_u32(p);
+    if (ParamHandlers::TypeHandler::is_int_type(type)) {
+        return ParamValue(static_cast<int>(static_cast<int32_t>(bits)));
+    }
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return ParamValue(f);
+}
+
+size_t encode_set(const SceneParameterSchema& schema, const Update* updates, size_t count,
+                  uint8_t* out, size_t max) {
+    if (count > 255 || max < REQUEST_HEADER) return 0;
+    size_t pos = REQUEST_HEADER;
+    for (size_t i = 0; i < count; ++i) {
+        if (updates[i].index >= schema.parameters.size()) return 0;
+        const ParamType type = schema.parameters[updates[i].index].param_type;
+        const size_t size = value_size(type);
+        if (pos + 1 + size > max) return 0;
+        out[pos++] = updates[i].index;
+        encode_value(out + pos, type, updates[i].value);
+        pos += size;
+    }
+    write_header(out, Op::Set, schema.version, count);
+    return pos;
+}
+
+size_t encode_get(const SceneParameterSchema& schema, const uint8_t* indices, size_t count,
+                  uint8_t* out, size_t max) {
+    if (count > 255 || max < REQUEST_HEADER + count) return 0;
+    write_header(out, Op::Get, schema.version, count);
+    if (count) memcpy(out + REQUEST_HEADER, indices, count);
+    return REQUEST_HEADER + count;
+}
+
+size_t encode_schema_request(uint32_t version, uint8_t* out, size_t max) {
+    if (max < REQUEST_HEADER) return 0;
+    return write_header(out, Op::Schema, version, 0);
+}
+
+size_t handle(Scene& scene, const uint8_t* in, size_t len, uint8_t* out, size_t max) {
+    if (max < REPLY_HEADER) return 0;
+    const SceneParameterSchema& schema = scene.parameter_schema();
+    if (len < REQUEST_HEADER) {
+        return reply_header(out, Op::Get, schema.version, Status::Truncated, 0);
+    }
+
+    const Op op = static_cast<Op>(in[0]);
+    const uint32_t version = get_u32(in + 1);
+    const size_t count = in[5];
+    const uint8_t* entries = in + REQUEST_HEADER;
+    const size_t entries_len = len - REQUEST_HEADER;
+
+    if (op == Op::Schema) {
+        const std::string& json = scene.parameter_schema_json();
+        if (json.size() > 0xFFFF || REPLY_HEADER + 2 + json.size() > max) {
+            return reply_header(out, op, schema.version, Status::Overflow, 0);
+        }
+        out[REPLY_HEADER] = static_cast<uint8_t>(json.size());
+        out[REPLY_HEADER + 1] = static_cast<uint8_t>(json.size() >> 8);
+        memcpy(out + REPLY_HEADER + 2, json.data(), json.size());
+        reply_header(out, op, schema.version, Status::Ok, 0);
+        return REPLY_HEADER + 2 + json.size();
+    }
+    if (op != Op::Set && op != Op::Get) {
+        return reply_header(out, op, schema.version, Status::BadOp, 0);
+    }
+    if (version != schema.version) {
+        return reply_header(out, op, schema.version, Status::StaleSchema, 0);
+    }
+
+    if (op == Op::Get) {
+        if (count == 0) {
+            const size_t all = schema.parameters.size() < 255 ? schema.parameters.size() : 255;
+            const size_t n = write_values(scene, schema, op, nullptr, all, out, max);
+            return n ? n : reply_header(out, op, schema.version, Status::Overflow, 0);
+        }
+        if (entries_len < count) {
+            return reply_header(out, op, schema.version, Status::Truncated, 0);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (entries[i] >= schema.parameters.size()) {
+                return reply_header(out, op, schema.version, Status::BadIndex, 0);
+            }
+        }
+        const size_t n = write_values(scene, schema, op, entries, count, out, max);
+        return n ? n : reply_header(out, op, schema.version, Status::Overflow, 0);
+    }
+
+    // Set: check the whole batch, then apply it
+    uint8_t indices[255];
+    size_t pos = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (pos >= entries_len) {
+            return reply_header(out, op, schema.version, Status::Truncated, 0);
+        }
+        const uint8_t index = entries[pos];
+        if (index >= schema.parameters.size()) {
+            return reply_header(out, op, schema.version, Status::BadIndex, 0);
+        }
+        pos += 1 + value_size(schema.parameters[index].param_type);
+        if (pos > entries_len) {
+            return reply_header(out, op, schema.version, Status::Truncated, 0);
+        }
+        indices[i] = index;
+    }
+    pos = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const ParameterSchema& param = schema.parameters[indices[i]];
+        scene._settings_storage.set_value_at(indices[i], decode_value(entries + pos + 1, param.param_type));
+        pos += 1 + value_size(param.param_type);
+    }
+    const size_t n = write_values(scene, schema, op, indices, count, out, max);
+    return n ? n : reply_header(out, op, schema.version, Status::Overflow, 0);
+}
+
+bool decode_reply(const SceneParameterSchema& schema, const uint8_t* in, size_t len,
+                  Reply& reply, Update* values, size_t max_values) {
+    reply = Reply();
+    if (len < REPLY_HEADER || !(in[0] & REPLY)) return false;
+    reply.op = static_cast<Op>(in[0] & ~REPLY);
+    reply.version = get_u32(in + 1);
+    reply.status = static_cast<Status>(in[5]);
+    const size_t count = in[6];
+    if (reply.status != Status::Ok) return true;
+
+    if (reply.op == Op::Schema) {
+        if (len < REPLY_HEADER + 2) return false;
+        reply.json_length = in[REPLY_HEADER] | (static_cast<size_t>(in[REPLY_HEADER + 1]) << 8);
+        if (len < REPLY_HEADER + 2 + reply.json_length) return false;
+        reply.json = reinterpret_cast<const char*>(in + REPLY_HEADER + 2);
+        return true;
+    }
+    if (reply.version != schema.version) return false;
+
+    size_t pos = REPLY_HEADER;
+    for (size_t i = 0; i < count; ++i) {
+        if (pos >= len || in[pos] >= schema.parameters.size()) return false;
+        const uint8_t index = in[pos];
+        const ParamType type = schema.parameters[index].param_type;
+        if (pos + 1 + value_size(type) > len) return false;
+        if (reply.count < max_values) {
+            values[reply.count].index = index;
+            values[reply.count].value = decode_value(in + pos + 1, type);
+            reply.count++;
+        }
+        pos += 1 + value_size(type);
+    }
+    return true;
+}
+
+} // namespace ParamProtocol
+} // namespace PixelTheater
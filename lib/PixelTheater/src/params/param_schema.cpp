@@ -80,6 +80,7 @@ std::string SceneParameterSchema::to_json() const {
     json << "{\n";
     json << "  \"name\": \"" << escape_json(scene_name) << "\",\n";
     json << "  \"description\": \"" << escape_json(scene_description) << "\",\n";
+    json << "  \"version\": " << version << ",\n";
     json << "  \"parameters\": [\n";
     
     for (size_t i = 0; i < parameters.size(); i++) {
@@ -111,6 +112,7 @@ ParameterSchema ParameterSchema::from_param_def(const ParamDef& def) {
     ParameterSchema schema;
     schema.name = def.name;
     schema.type = ParamHandlers::TypeHandler::get_name(def.type);
+    schema.param_type = def.type;
     schema.description = def.description;
     schema.min_value = def.min_value;
     schema.max_value = def.max_value;
@@ -140,8 +142,51 @@ SceneParameterSchema ParamSchema::generate_schema(const Scene& scene) {
             schema.parameters.push_back(ParameterSchema::from_param_def(def));
         }
     }
-    
+
+    schema.version = compute_version(schema);
     return schema;
 }
 
+// FNV-1a over the fields, with a separator after each so "ab"+"c" != "a"+"bc".
+// Floats are hashed by bit pattern: any change to a range is a new version.
+namespace {
+    struct SchemaHash {
+        uint32_t h = 2166136261u;
+
+        void bytes(const void* data, size_t len) {
+            const uint8_t* p = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < len; ++i) {
+                h = (h ^ p[i]) * 16777619u;
+            }
+        }
+        void str(const std::string& s) {
+            bytes(s.data(), s.size());
+            bytes("", 1);
+        }
+        template<typename T> void value(T v) { bytes(&v, sizeof(v)); }
+    };
+}
+
+uint32_t ParamSchema::compute_version(const SceneParameterSchema& schema) {
+    SchemaHash hash;
+    hash.str(schema.scene_name);
+    hash.str(schema.scene_description);
+    hash.value(static_cast<uint32_t>(schema.parameters.size()));
+    for (const auto& param : schema.parameters) {
+        hash.str(param.name);
+        hash.str(param.type);
+        hash.str(param.description);
+        hash.value(param.min_value);
+        hash.value(param.max_value);
+        hash.value(param.default_float);
+        hash.value(static_cast<int32_t>(param.default_int));
+        hash.value(static_cast<uint8_t>(param.default_bool));
+        hash.value(static_cast<uint32_t>(param.options.size()));
+        for (const auto& option : param.options) hash.str(option);
+        hash.str(param.flags);
+    }
+    // 0 means "no schema yet"
+    return hash.h ? hash.h : 1;
+}
+
 } // namespace PixelTheater 
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "PixelTheater/params/preset.h"
+#include "PixelTheater/params/param_protocol.h"
+#include "PixelTheater/settings.h"
+#include "PixelTheater/core/log.h"
+#include <cmath>
+#include <cstring>
+
+namespace PixelTheater {
+
+namespace {
+    constexpr uint8_t MAGIC0 = 'P';
+    constexpr uint8_t MAGIC1 = 'r';
+}
+
+// --- Preset ---
+
+bool Preset::assign(const uint8_t* data, size_t len) {
+    clear();
+    if (len < HEADER_SIZE || len > MAX_SIZE) return false;
+    memcpy(_data, data, len);
+    if (!valid() || HEADER_SIZE + values_size() > len) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+void Preset::clear() {
+    memset(_data, 0, HEADER_SIZE);
+}
+
+bool Preset::valid() const {
+    return _data[0] == MAGIC0 && _data[1] == MAGIC1 && HEADER_SIZE + values_size() <= MAX_SIZE;
+}
+
+uint32_t Preset::layout() const {
+    return static_cast<uint32_t>(_data[2]) | (static_cast<uint32_t>(_data[3]) << 8) |
+           (static_cast<uint32_t>(_data[4]) << 16) | (static_cast<uint32_t>(_data[5]) << 24);
+}
+
+uint8_t* Preset::begin_write(uint32_t layout, size_t count) {
+    clear();
+    if (count > 255) return nullptr;
+    _data[2] = static_cast<uint8_t>(layout);
+    _data[3] = static_cast<uint8_t>(layout >> 8);
+    _data[4] = static_cast<uint8_t>(layout >> 16);
+    _data[5] = static_cast<uint8_t>(layout >> 24);
+    _data[6] = static_cast<uint8_t>(count);
+    return _data + HEADER_SIZE;
+}
+
+void Preset::end_write(size_t values_size) {
+    _data[7] = static_cast<uint8_t>(values_size);
+    _data[0] = MAGIC0;
+    _data[1] = MAGIC1;
+}
+
+// --- PresetMorph ---
+
+bool PresetMorph::begin(const Settings& settings, const Preset& from, const Preset& to, float seconds) {
+    _active = false;
+    _numeric = 0;
+    _discrete = 0;
+    const size_t count = settings.size();
+    if (count > MAX_PARAMS) {
+        Log::warning("[WARNING] PresetMorph: %zu parameters, only %zu supported\n", count, MAX_PARAMS);
+        return false;
+    }
+    for (const Preset* p : {&from, &to}) {
+        if (!p->valid() || p->layout() != settings.layout_hash() || p->count() != count) return false;
+    }
+
+    size_t pos = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const ParamType type = settings.metadata_at(i).type;
+        const size_t size = ParamProtocol::value_size(type);
+        if (pos + size > from.values_size() || pos + size > to.values_size()) return false;
+        const ParamValue a = ParamProtocol::decode_value(from.values() + pos, type);
+        const ParamValue b = ParamProtocol::decode_value(to.values() + pos, type);
+        pos += size;
+
+        if (ParamHandlers::TypeHandler::is_float_type(type) || type == ParamType::count) {
+            const bool integer = type == ParamType::count;
+            const float fa = integer ? static_cast<float>(a.as_int()) : a.as_float();
+            const float fb = integer ? static_cast<float>(b.as_int()) : b.as_float();
+            if (fa == fb) continue;
+            _index[_numeric] = static_cast<uint8_t>(i);
+            _integer[_numeric] = integer;
+            _from[_numeric] = fa;
+            _delta[_numeric] = fb - fa;
+            _numeric++;
+        } else {
+            const bool same = type == ParamType::switch_type ? a.as_bool() == b.as_bool()
+                                                             : a.as_int() == b.as_int();
+            if (same) continue;
+            _discrete_index[_discrete] = static_cast<uint8_t>(i);
+            _discrete_from[_discrete] = a;
+            _discrete_to[_discrete] = b;
+            _discrete++;
+        }
+    }
+
+    _t = 0.0f;
+    _rate = seconds > 0.0f ? 1.0f / seconds : 0.0f;
+    _active = true;
+    return true;
+}
+
+bool PresetMorph::begin(const Settings& settings, const Preset& to, float seconds) {
+    Preset current;
+    if (!settings.snapshot(current)) return false;
+    return begin(settings, current, to, seconds);
+}
+
+bool PresetMorph::update(Settings& settings, float dt) {
+    if (!_active) return false;
+    _t = _rate > 0.0f ? _t + dt * _rate : 1.0f;
+    if (_t >= 1.0f) {
+        _t = 1.0f;
+        _active = false;
+    }
+    apply(settings, _t);
+    return _active;
+}
+
+void PresetMorph::apply(Settings& settings, float t) const {
+    for (size_t i = 0; i < _numeric; ++i) {
+        const float v = _from[i] + _delta[i] * t;
+        if (_integer[i]) {
+            settings.set_value_at(_index[i], ParamValue(static_cast<int>(lroundf(v))));
+        } else {
+            settings.set_value_at(_index[i], ParamValue(v));
+        }
+    }
+    for (size_t i = 0; i < _discrete; ++i) {
+        settings.set_value_at(_discrete_index[i], t < 0.5f ? _discrete_from[i] : _discrete_to[i]);
+    }
+}
+
+// --- PresetBank ---
+
+PresetBank::PresetBank(PresetStorage& storage, size_t slots)
+    : _storage(storage)
+{
+    const size_t fit = storage.capacity() / SLOT_SIZE;
+    if (slots > fit) {
+        Log::warning("[WARNING] PresetBank: storage holds %zu slots, not %zu\n", fit, slots);
+        slots = fit;
+    }
+    _slots.resize(slots);
+}
+
+size_t PresetBank::load() {
+    size_t loaded = 0;
+    uint8_t buffer[SLOT_SIZE];
+    for (size_t i = 0; i < _slots.size(); ++i) {
+        _slots[i].clear();
+        if (!_storage.read(i * SLOT_SIZE, buffer, Preset::HEADER_SIZE)) continue;
+        // Read only what the header says is there
+        const size_t len = Preset::HEADER_SIZE + buffer[7];
+        if (buffer[0] != MAGIC0 || buffer[1] != MAGIC1 || len > SLOT_SIZE) continue;
+        if (!_storage.read(i * SLOT_SIZE + Preset::HEADER_SIZE, buffer + Preset::HEADER_SIZE, buffer[7])) continue;
+        if (_slots[i].assign(buffer, len)) loaded++;
+    }
+    return loaded;
+}
+
+const Preset* PresetBank::slot(size_t index) const {
+    if (index >= _slots.size() || !_slots[index].valid()) return nullptr;
+    return &_slots[index];
+}
+
+bool PresetBank::save(size_t index, const Settings& settings) {
+    Preset preset;
+    return settings.snapshot(preset) && store(index, preset);
+}
+
+bool PresetBank::store(size_t index, const Preset& preset) {
+    if (index >= _slots.size() || !preset.valid()) return false;
+    _slots[index] = preset;
+    return _storage.write(index * SLOT_SIZE, preset.data(), preset.size());
+}
+
+bool PresetBank::recall(size_t index, Settings& settings) const {
+    const Preset* preset = slot(index);
+    return preset && settings.recall(*preset);
+}
+
+bool PresetBank::erase(size_t index) {
+    if (index >= _slots.size()) return false;
+    _slots[index].clear();
+    const uint8_t blank[2] = {0, 0};
+    return _storage.write(index * SLOT_SIZE, blank, sizeof(blank));
+}
+
+} // namespace PixelTheater
@@ -5,6 +5,7 @@
 #include <ctime> // For seeding rand()
 #include <cmath> // For fmod
 #include <cstdio> // For printf (logging)
+#include "PixelTheater/core/log.h"
 #include <cstdarg> // For va_list etc. (logging)
 
 namespace PixelTheater {
@@ -37,15 +38,40 @@ uint16_t NativePlatform::getNumLEDs() const {
 }
 
 void NativePlatform::show() {
-    // No-op in native environment
+    // Nothing to drive unless a test attached an output
+    if (!_output_map || !_output_driver) return;
+    const uint16_t channels = _dirty_tracker && !_output_stale ? _output_map->dirtyChannels(*_dirty_tracker)
+                                                               : OutputMap::ALL_CHANNELS;
+    for (size_t c = 0; c < _output_map->channels(); ++c) {
+        if (!((channels >> c) & 1u)) continue;
+        const size_t size = _output_map->channelBytes(c, _leds, _output_bytes.data(), _output_order, _brightness);
+        _output_driver->write(c, _output_bytes.data(), size);
+    }
+    _output_driver->show();
+    _output_stale = false;
+}
+
+void NativePlatform::setOutput(const OutputMap* map, OutputDriver* driver, ColorOrder order) {
+    _output_map = map;
+    _output_driver = driver;
+    _output_order = order;
+    _output_bytes.assign(map ? map->stride() * 3 : 0, 0);
+    _output_stale = true;
+}
+
+void NativePlatform::setDirtyTracker(const DirtyTracker* tracker) {
+    _dirty_tracker = tracker;
+    _output_stale = true;
 }
 
 void NativePlatform::setBrightness(uint8_t brightness) {
+    if (brightness != _brightness) _output_stale = true; // Every byte scales with it
     _brightness = brightness;
 }
 
 void NativePlatform::clear() {
     fill_solid(_leds, _num_leds, CRGB::Black);
+    _output_stale = true; // Behind the tracker's back
 }
 
 void NativePlatform::setMaxRefreshRate(uint8_t fps) {
@@ -104,6 +130,7 @@ float NativePlatform::randomFloat(float min, float max) { // min to max
 
 // Logging implementations using vprintf
 void NativePlatform::logInfo(const char* format, ...) {
+    if (!Log::enabled(Log::Info)) return;
     printf("[INFO] ");
     va_list args;
     va_start(args, format);
@@ -113,6 +140,7 @@ void NativePlatform::logInfo(const char* format, ...) {
 }
 
 void NativePlatform::logWarning(const char* format, ...) {
+    if (!Log::enabled(Log::Warning)) return;
      printf("[WARN] ");
     va_list args;
     va_start(args, format);
@@ -122,6 +150,7 @@ void NativePlatform::logWarning(const char* format, ...) {
 }
 
 void NativePlatform::logError(const char* format, ...) {
+    if (!Log::enabled(Log::Error)) return;
      printf("[ERROR] ");
     va_list args;
     va_start(args, format);
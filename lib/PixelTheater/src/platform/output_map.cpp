@@ -0,0 +1,179 @@
+#include "PixelTheater/platform/output_map.h"
+#include "PixelTheater/core/dirty_tracker.h"
+#include "PixelTheater/core/imodel.h"
+#include "PixelTheater/core/math_utils.h"
+#include "PixelTheater/limits.h"
+#include "PixelTheater/model/face.h"
+
+#include <algorithm>
+
+namespace PixelTheater {
+
+namespace {
+    constexpr uint16_t PADDING = 0xFFFF;
+
+    // CRGB::raw index of the first, second and third byte on the wire
+    constexpr uint8_t ORDER[6][3] = {
+        {0, 1, 2},  // RGB
+        {0, 2, 1},  // RBG
+        {1, 0, 2},  // GRB
+        {1, 2, 0},  // GBR
+        {2, 0, 1},  // BRG
+        {2, 1, 0},  // BGR
+    };
+
+    bool validChannels(size_t channels) { return channels > 0 && channels <= OutputMap::MAX_CHANNELS; }
+}
+
+void OutputMap::reset() {
+    _channels = 0;
+    _stride = 0;
+    std::fill(_length, _length + MAX_CHANNELS, 0);
+    _slot.clear();
+    _source.clear();
+}
+
+bool OutputMap::splitEvenly(size_t led_count, size_t channels) {
+    if (!validChannels(channels) || led_count > Limits::ABSOLUTE_MAX_LEDS) {
+        reset();
+        return false;
+    }
+    // The first led_count % channels channels take one LED more
+    std::vector<uint8_t> led_channel(led_count);
+    const size_t base = led_count / channels, extra = led_count % channels;
+    size_t led = 0;
+    for (size_t c = 0; c < channels; ++c) {
+        for (size_t n = base + (c < extra ? 1 : 0); n > 0; --n) led_channel[led++] = static_cast<uint8_t>(c);
+    }
+    return build(led_channel, channels);
+}
+
+bool OutputMap::splitByFace(const IModel& model, size_t channels) {
+    if (!validChannels(channels)) {
+        reset();
+        return false;
+    }
+    const size_t faces = model.faceCount();
+    if (faces == 0) return splitEvenly(model.pointCount(), channels);
+
+    // Smallest channel length that fits every face into channels runs: the
+    // greedy packing count only falls as the length grows, so bisect on it
+    size_t largest = 0, total = 0;
+    for (size_t f = 0; f < faces; ++f) {
+        largest = std::max<size_t>(largest, model.face(f).led_count());
+        total += model.face(f).led_count();
+    }
+    auto runsNeeded = [&](size_t limit) {
+        size_t runs = 1, load = 0;
+        for (size_t f = 0; f < faces; ++f) {
+            const size_t leds = model.face(f).led_count();
+            if (load + leds > limit) {
+                ++runs;
+                load = 0;
+            }
+            load += leds;
+        }
+        return runs;
+    };
+    size_t low = largest, high = total;
+    while (low < high) {
+        const size_t mid = (low + high) / 2;
+        if (runsNeeded(mid) <= channels) high = mid;
+        else low = mid + 1;
+    }
+
+    // Pack to that length, also moving on once the faces left are no more
+    // than the channels left, so every channel gets a face if it can
+    std::vector<uint8_t> face_channel(faces);
+    size_t channel = 0, load = 0;
+    for (size_t f = 0; f < faces; ++f) {
+        const size_t leds = model.face(f).led_count();
+        const size_t channels_after = channels - channel - 1;
+        if (load > 0 && (load + leds > low || faces - f <= channels_after)) {
+            ++channel;
+            load = 0;
+        }
+        face_channel[f] = static_cast<uint8_t>(channel);
+        load += leds;
+    }
+    return assignFaces(model, face_channel.data(), channels);
+}
+
+bool OutputMap::assignFaces(const IModel& model, const uint8_t* face_channel, size_t channels) {
+    const size_t led_count = model.pointCount();
+    if (!validChannels(channels) || led_count > Limits::ABSOLUTE_MAX_LEDS) {
+        reset();
+        return false;
+    }
+    // LEDs outside every face (there are none in a well-formed model) go on channel 0
+    std::vector<uint8_t> led_channel(led_count, 0);
+    for (size_t f = 0; f < model.faceCount(); ++f) {
+        if (face_channel[f] >= channels) {
+            reset();
+            return false;
+        }
+        const Face& face = model.face(f);
+        const size_t end = std::min<size_t>(face.led_offset() + face.led_count(), led_count);
+        for (size_t i = face.led_offset(); i < end; ++i) led_channel[i] = face_channel[f];
+    }
+    return build(led_channel, channels);
+}
+
+bool OutputMap::build(const std::vector<uint8_t>& led_channel, size_t channels) {
+    reset();
+    for (uint8_t c : led_channel) ++_length[c];
+    _channels = channels;
+    _stride = *std::max_element(_length, _length + channels);
+
+    _slot.resize(led_channel.size());
+    _source.assign(bufferSize(), PADDING);
+    uint16_t next[MAX_CHANNELS] = {};
+    for (size_t i = 0; i < led_channel.size(); ++i) {
+        const size_t c = led_channel[i];
+        const uint32_t slot = static_cast<uint32_t>(c * _stride + next[c]++);
+        _slot[i] = slot;
+        _source[slot] = static_cast<uint16_t>(i);
+    }
+    return true;
+}
+
+void OutputMap::gather(const CRGB* leds, CRGB* out, uint16_t channel_mask) const {
+    for (size_t c = 0; c < _channels; ++c) {
+        if (!((channel_mask >> c) & 1u)) continue;
+        const uint16_t* source = _source.data() + c * _stride;
+        CRGB* dst = out + c * _stride;
+        for (size_t p = 0; p < _length[c]; ++p) dst[p] = leds[source[p]];
+    }
+}
+
+uint16_t OutputMap::dirtyChannels(const DirtyTracker& tracker) const {
+    if (tracker.ledCount() != _slot.size()) return ALL_CHANNELS;
+    const uint16_t all = static_cast<uint16_t>((1u << _channels) - 1);
+    uint16_t dirty = 0;
+    tracker.forEachDirtyRange([&](size_t first, size_t count) {
+        for (size_t i = first; i < first + count && dirty != all; ++i) {
+            dirty |= static_cast<uint16_t>(1u << (_slot[i] / _stride));
+        }
+    });
+    return dirty;
+}
+
+size_t OutputMap::channelBytes(size_t channel, const CRGB* leds, uint8_t* bytes,
+                               ColorOrder order, uint8_t brightness) const {
+    const uint8_t* o = ORDER[static_cast<uint8_t>(order)];
+    const uint16_t* source = _source.data() + channel * _stride;
+    const size_t length = _length[channel];
+    for (size_t p = 0; p < length; ++p) {
+        const uint8_t* rgb = leds[source[p]].raw;
+        uint8_t* out = bytes + p * 3;
+        out[0] = rgb[o[0]];
+        out[1] = rgb[o[1]];
+        out[2] = rgb[o[2]];
+    }
+    if (brightness < 255) {
+        for (size_t b = 0; b < length * 3; ++b) bytes[b] = scale8(bytes[b], brightness);
+    }
+    return length * 3;
+}
+
+} // namespace PixelTheater
@@ -41,6 +41,27 @@ void Scene::connect(IModel& model_ref, ILedBuffer& leds_ref, Platform& platform_
     leds = LedsProxy(leds_ptr); 
 }
 
+const SceneParameterSchema& Scene::parameter_schema() const {
+    // Name and description are public members as well as setters, so compare
+    // them rather than relying on the setters to invalidate
+    if (_schema_cache_revision != _settings_storage.schema_revision() || _schema_cache.version == 0 ||
+        _schema_cache.scene_name != _name || _schema_cache.scene_description != _description) {
+        _schema_cache = ParamSchema::generate_schema(*this);
+        _schema_cache_revision = _settings_storage.schema_revision();
+        _schema_json_valid = false;
+    }
+    return _schema_cache;
+}
+
+const std::string& Scene::parameter_schema_json() const {
+    const SceneParameterSchema& schema = parameter_schema();
+    if (!_schema_json_valid) {
+        _schema_json_cache = schema.to_json();
+        _schema_json_valid = true;
+    }
+    return _schema_json_cache;
+}
+
 const IModel& Scene::model() const {
     if (!model_ptr) {
         logError("Scene::model() called before model connected");
@@ -1,8 +1,17 @@
 #include "PixelTheater/settings.h"
+#include "PixelTheater/params/preset.h"
+#include "PixelTheater/params/param_protocol.h"
 #include <vector>
 
 namespace PixelTheater {
 
+namespace {
+    uint32_t next_schema_revision() {
+        static uint32_t revision = 0;
+        return ++revision;
+    }
+}
+
 Settings::Settings(const ParamDef* params, size_t count) {
     for (size_t i = 0; i < count; i++) {
         add_parameter(params[i]);
@@ -10,56 +19,86 @@ Settings::Settings(const ParamDef* params, size_t count) {
 }
 
 Settings::Settings(const Settings& other) {
-    _params = other._params;
+    _defs = other._defs;
     _values = other._values;
+    _index = other._index;
+    _schema_revision = other._schema_revision;
+    _layout_hash = other._layout_hash;
 }
 
 Settings& Settings::operator=(const Settings& other) {
     if (this != &other) {
-        _params = other._params;
+        _defs = other._defs;
         _values = other._values;
+        _index = other._index;
+        _schema_revision = other._schema_revision;
+        _layout_hash = other._layout_hash;
     }
     return *this;
 }
 
 void Settings::add_parameter(const ParamDef& def) {
+    auto it = _index.find(def.name);
+    size_t index;
+    if (it == _index.end()) {
+        index = _defs.size();
+        _index[def.name] = index;
+        _defs.push_back(def);
+        _values.emplace_back();
+    } else {
+        index = it->second;
+        _defs[index] = def;
+    }
+    _schema_revision = next_schema_revision();
+    update_layout_hash();
+
     if (!def.validate_value(def.get_default_value())) {
         Log::warning("[WARNING] Invalid default value for parameter '%s'. Using sentinel value.\n", def.name.c_str());
-        _params[def.name] = def;
-        _values[def.name] = ParamHandlers::TypeHandler::get_sentinel_for_type(def.type);
+        _values[index] = ParamHandlers::TypeHandler::get_sentinel_for_type(def.type);
         return;
     }
     
-    _params[def.name] = def;
-    _values[def.name] = def.get_default_value();
+    _values[index] = def.get_default_value();
 }
 
 void Settings::reset_all() {
-    for (const auto& param : _params) {
-        const std::string& name = param.first;  // Use the map key, which is a valid std::string
-        const ParamDef& def = param.second;
-        
-        // Get the default value and set it
-        ParamValue default_value = def.get_default_value();
-        _values[name] = default_value;  // Directly set the value in the _values map
+    for (size_t i = 0; i < _defs.size(); i++) {
+        _values[i] = _defs[i].get_default_value();
     }
 }
 
 void Settings::set_value(const std::string& name, const ParamValue& value) {
-    auto param_it = _params.find(name);
-    if (param_it == _params.end()) {
+    auto it = _index.find(name);
+    if (it == _index.end()) {
         Log::warning("[WARNING] Parameter not found: %s\n", name.c_str());
         return;
     }
-    
-    const ParamDef& def = param_it->second;
+    set_value_at(it->second, value);
+}
+
+int Settings::index_of(const std::string& name) const {
+    auto it = _index.find(name);
+    return it == _index.end() ? -1 : static_cast<int>(it->second);
+}
+
+int Settings::index_of(const char* name) const {
+    // Scenes have a handful of parameters, so a scan beats hashing a copy
+    for (size_t i = 0; i < _defs.size(); ++i) {
+        if (_defs[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void Settings::set_value_at(size_t index, const ParamValue& value) {
+    const ParamDef& def = _defs[index];
+    const std::string& name = def.name;
     
     // First check if the value's type is compatible with the parameter's type
     if (!ParamHandlers::TypeHandler::can_convert(value.type(), def.type)) {
         Log::warning("[WARNING] Parameter '%s': incompatible type (expected %s, got %s)\n", 
             name.c_str(), ParamHandlers::TypeHandler::get_name(def.type), 
             ParamHandlers::TypeHandler::get_name(value.type()));
-        _values[name] = ParamHandlers::TypeHandler::get_sentinel_for_type(def.type);
+        _values[index] = ParamHandlers::TypeHandler::get_sentinel_for_type(def.type);
         return;
     }
     
@@ -67,7 +106,7 @@ void Settings::set_value(const std::string& name, const ParamValue& value) {
     // since the value will be adjusted in apply_flags
     if (def.has_flag(Flags::CLAMP) || def.has_flag(Flags::WRAP)) {
         // Apply flags (which includes clamping if needed) and store the result
-        _values[name] = def.apply_flags(value);
+        _values[index] = def.apply_flags(value);
         return;
     }
     
@@ -76,31 +115,31 @@ void Settings::set_value(const std::string& name, const ParamValue& value) {
     if (!ParamHandlers::TypeHandler::validate(def.type, value)) {
         Log::warning("[WARNING] Parameter '%s': invalid value for type %s\n", 
             name.c_str(), ParamHandlers::TypeHandler::get_name(def.type));
-        _values[name] = ParamHandlers::TypeHandler::get_sentinel_for_type(def.type);
+        _values[index] = ParamHandlers::TypeHandler::get_sentinel_for_type(def.type);
         return;
     }
     
     // Apply flags (which includes clamping if needed) and store the result
-    _values[name] = def.apply_flags(value);
+    _values[index] = def.apply_flags(value);
 }
 
 ParamValue Settings::get_value(const std::string& name) const {
-    auto value_it = _values.find(name);
-    if (value_it == _values.end()) {
+    auto it = _index.find(name);
+    if (it == _index.end()) {
         Log::warning("[WARNING] Parameter not found: %s\n", name.c_str());
         return ParamValue();  // Return default sentinel value
     }
-    return value_it->second;
+    return _values[it->second];
 }
 
 const ParamDef& Settings::get_metadata(const std::string& name) const {
-    auto it = _params.find(name);
-    if (it == _params.end()) {
+    auto it = _index.find(name);
+    if (it == _index.end()) {
         Log::warning("[WARNING] Parameter not found: %s\n", name.c_str());
         static const ParamDef sentinel_def;  // Returns empty ParamDef
         return sentinel_def;
     }
-    return it->second;
+    return _defs[it->second];
 }
 
 ParamType Settings::get_type(const std::string& name) const {
@@ -288,23 +327,74 @@ bool Settings::is_valid_value(const std::string& name, const ParamValue& value)
 
 void Settings::inherit_from(const Settings& base) {
     // Copy all parameters and values from base
-    _params = base._params;
+    _defs = base._defs;
     _values = base._values;
+    _index = base._index;
+    _schema_revision = next_schema_revision();
+    _layout_hash = base._layout_hash;
 }
 
 bool Settings::has_parameter(const std::string& name) const {
-    return _params.find(name) != _params.end();
+    return _index.find(name) != _index.end();
 }
 
 std::vector<std::string> Settings::get_parameter_names() const {
     std::vector<std::string> names;
-    names.reserve(_params.size());  // Reserve space for efficiency
-    
-    for (const auto& pair : _params) {
-        names.push_back(pair.first);
+    names.reserve(_defs.size());
+    for (const auto& def : _defs) {
+        names.push_back(def.name);
     }
-    
     return names;
 }
 
+void Settings::update_layout_hash() {
+    // FNV-1a over "name\0type" for each parameter in order
+    uint32_t h = 2166136261u;
+    for (const auto& def : _defs) {
+        for (char c : def.name) h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+        h = (h ^ 0u) * 16777619u;
+        h = (h ^ static_cast<uint8_t>(def.type)) * 16777619u;
+    }
+    _layout_hash = h;
+}
+
+bool Settings::snapshot(Preset& preset) const {
+    uint8_t* out = preset.begin_write(_layout_hash, _defs.size());
+    if (!out) {
+        Log::warning("[WARNING] Preset: %zu parameters do not fit in %zu bytes\n", _defs.size(), Preset::MAX_SIZE);
+        return false;
+    }
+    size_t pos = 0;
+    for (size_t i = 0; i < _defs.size(); i++) {
+        const size_t size = ParamProtocol::value_size(_defs[i].type);
+        if (Preset::HEADER_SIZE + pos + size > Preset::MAX_SIZE) {
+            Log::warning("[WARNING] Preset: %zu parameters do not fit in %zu bytes\n", _defs.size(), Preset::MAX_SIZE);
+            return false;
+        }
+        ParamProtocol::encode_value(out + pos, _defs[i].type, _values[i]);
+        pos += size;
+    }
+    preset.end_write(pos);
+    return true;
+}
+
+bool Settings::recall(const Preset& preset) {
+    if (!preset.valid() || preset.layout() != _layout_hash || preset.count() != _defs.size()) {
+        return false;
+    }
+    const uint8_t* in = preset.values();
+    size_t pos = 0;
+    for (size_t i = 0; i < _defs.size(); i++) {
+        const size_t size = ParamProtocol::value_size(_defs[i].type);
+        if (pos + size > preset.values_size()) return false;
+        pos += size;
+    }
+    pos = 0;
+    for (size_t i = 0; i < _defs.size(); i++) {
+        set_value_at(i, ParamProtocol::decode_value(in + pos, _defs[i].type));
+        pos += ParamProtocol::value_size(_defs[i].type);
+    }
+    return true;
+}
+
 } // namespace PixelTheater 
\ No newline at end of file
@@ -0,0 +1,71 @@
+#if !defined(PLATFORM_TEENSY) && !defined(PLATFORM_WEB) && !defined(EMSCRIPTEN)
+
+#include "PixelTheater/stream/fd_byte_stream.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace PixelTheater {
+
+FdByteStream::FdByteStream(int fd, bool owns) : _fd(fd), _owns(owns) {}
+
+FdByteStream::~FdByteStream() {
+    if (_owns && _fd >= 0) ::close(_fd);
+}
+
+std::unique_ptr<FdByteStream> FdByteStream::open(const char* path) {
+    int fd = ::open(path, O_RDWR | O_NOCTTY);
+    if (fd < 0 && errno != ENOENT) fd = ::open(path, O_WRONLY | O_NOCTTY);
+    if (fd < 0) return nullptr;
+    makeRaw(fd);
+    return std::unique_ptr<FdByteStream>(new FdByteStream(fd, true));
+}
+
+std::unique_ptr<FdByteStream> FdByteStream::create(const char* path) {
+    const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return nullptr;
+    return std::unique_ptr<FdByteStream>(new FdByteStream(fd, true));
+}
+
+void FdByteStream::makeRaw(int fd) {
+    termios tio;
+    if (!isatty(fd) || tcgetattr(fd, &tio) != 0) return;
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+}
+
+bool FdByteStream::waitReadable(int timeout_ms) const {
+    pollfd p = {_fd, POLLIN, 0};
+    return ::poll(&p, 1, timeout_ms) > 0 && (p.revents & POLLIN);
+}
+
+size_t FdByteStream::read(uint8_t* dst, size_t max) {
+    if (max == 0 || !waitReadable(0)) return 0;
+    const ssize_t n = ::read(_fd, dst, max);
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+size_t FdByteStream::write(const uint8_t* src, size_t len) {
+    size_t done = 0;
+    while (done < len) {
+        const ssize_t n = ::write(_fd, src + done, len - done);
+        if (n > 0) {
+            done += static_cast<size_t>(n);
+        } else if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+            pollfd p = {_fd, POLLOUT, 0};
+            ::poll(&p, 1, 100);
+        } else {
+            break;
+        }
+    }
+    return done;
+}
+
+} // namespace PixelTheater
+
+#endif // !defined(PLATFORM_TEENSY) && !defined(PLATFORM_WEB) && !defined(EMSCRIPTEN)
@@ -0,0 +1,319 @@
+#include "PixelTheater/stream/frame_codec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace PixelTheater {
+
+namespace {
+
+constexpr size_t NO_FIT = static_cast<size_t>(-1);
+constexpr size_t HEADER_FIELDS = FrameStream::HEADER_SIZE - 2; // type through payload_len
+constexpr size_t SPAN_HEADER = 4;   // Delta span: start, count
+
+// Nibble table for CRC-16/CCITT-FALSE (poly 0x1021): small enough for any target
+constexpr uint16_t CRC_NIBBLES[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+inline void put16(uint8_t* p, uint16_t v) {
+    p[0] = static_cast<uint8_t>(v & 0xFF);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+inline uint16_t get16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline bool sameColor(const CRGB& a, const CRGB& b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+inline uint8_t* putColor(uint8_t* p, const CRGB& c) {
+    p[0] = c.r;
+    p[1] = c.g;
+    p[2] = c.b;
+    return p + 3;
+}
+
+} // namespace
+
+uint16_t FrameStream::crc16(const uint8_t* data, size_t len, uint16_t crc) {
+    for (size_t i = 0; i < len; ++i) {
+        const uint8_t b = data[i];
+        crc = static_cast<uint16_t>((crc << 4) ^ CRC_NIBBLES[((crc >> 12) ^ (b >> 4)) & 0x0F]);
+        crc = static_cast<uint16_t>((crc << 4) ^ CRC_NIBBLES[((crc >> 12) ^ b) & 0x0F]);
+    }
+    return crc;
+}
+
+// --- FrameEncoder ---
+
+FrameEncoder::FrameEncoder(size_t max_leds, uint16_t keyframe_interval)
+    : _max_leds(std::min<size_t>(max_leds, 0xFFFF)),
+      _keyframe_interval(std::max<uint16_t>(keyframe_interval, 1)),
+      _since_keyframe(_keyframe_interval),
+      _prev(_max_leds),
+      _scratch(_max_leds * 3 * 2) {
+    _out.reserve(FrameStream::HEADER_SIZE + _max_leds * 3 + FrameStream::CRC_SIZE);
+}
+
+size_t FrameEncoder::rlePayload(const CRGB* leds, size_t count, uint8_t* out, size_t limit) const {
+    size_t len = 0;
+    for (size_t i = 0; i < count; ) {
+        size_t run = 1;
+        while (i + run < count && run < 255 && sameColor(leds[i + run], leds[i])) ++run;
+        if (len + 4 > limit) return NO_FIT;
+        out[len] = static_cast<uint8_t>(run);
+        putColor(out + len + 1, leds[i]);
+        len += 4;
+        i += run;
+    }
+    return len;
+}
+
+size_t FrameEncoder::deltaPayload(const CRGB* leds, size_t count, uint8_t* out, size_t limit) const {
+    size_t len = 0;
+    for (size_t i = 0; i < count; ) {
+        if (sameColor(leds[i], _prev[i])) { ++i; continue; }
+
+        // Extend the span; a single unchanged LED costs less to resend than a new span header
+        size_t end = i + 1;
+        while (end < count) {
+            if (!sameColor(leds[end], _prev[end])) { ++end; continue; }
+            if (end + 1 < count && !sameColor(leds[end + 1], _prev[end + 1])) { end += 2; continue; }
+            break;
+        }
+
+        const size_t span = end - i;
+        if (len + SPAN_HEADER + span * 3 > limit) return NO_FIT;
+        put16(out + len, static_cast<uint16_t>(i));
+        put16(out + len + 2, static_cast<uint16_t>(span));
+        uint8_t* p = out + len + SPAN_HEADER;
+        for (size_t k = i; k < end; ++k) p = putColor(p, leds[k]);
+        len += SPAN_HEADER + span * 3;
+        i = end;
+    }
+    return len;
+}
+
+size_t FrameEncoder::encode(const CRGB* leds, size_t count, Mode mode) {
+    using FrameStream::FrameType;
+    _out.clear();
+    if (count > _max_leds) return 0;
+
+    const size_t raw_len = count * 3;
+    const bool keyframe = _since_keyframe >= _keyframe_interval || count != _prev_count;
+    uint8_t* delta_buf = _scratch.data();
+    uint8_t* rle_buf = _scratch.data() + _max_leds * 3;
+
+    // Candidates must beat Raw, which keeps every payload within raw_len
+    size_t delta_len = NO_FIT;
+    size_t rle_len = NO_FIT;
+    if (!keyframe && (mode == Mode::Auto || mode == Mode::Delta)) {
+        delta_len = deltaPayload(leds, count, delta_buf, raw_len);
+    }
+    if (mode == Mode::Auto || mode == Mode::Rle) {
+        rle_len = rlePayload(leds, count, rle_buf, std::min(raw_len, delta_len));
+    }
+
+    if (delta_len != NO_FIT && (rle_len == NO_FIT || delta_len <= rle_len)) {
+        finish(FrameType::Delta, count, delta_buf, delta_len);
+    } else if (rle_len != NO_FIT && rle_len < raw_len) {
+        finish(FrameType::Rle, count, rle_buf, rle_len);
+    } else {
+        uint8_t* p = rle_buf;
+        for (size_t i = 0; i < count; ++i) p = putColor(p, leds[i]);
+        finish(FrameType::Raw, count, rle_buf, raw_len);
+    }
+
+    std::copy(leds, leds + count, _prev.begin());
+    _prev_count = count;
+    _since_keyframe = (_last_type == FrameType::Delta) ? _since_keyframe + 1 : 1;
+    return _out.size();
+}
+
+void FrameEncoder::finish(FrameStream::FrameType type, size_t count, const uint8_t* payload, size_t len) {
+    ++_seq;
+    _last_type = type;
+    _out.resize(FrameStream::HEADER_SIZE + len + FrameStream::CRC_SIZE);
+    uint8_t* p = _out.data();
+    p[0] = FrameStream::MAGIC_0;
+    p[1] = FrameStream::MAGIC_1;
+    p[2] = static_cast<uint8_t>(type);
+    put16(p + 3, _seq);
+    put16(p + 5, static_cast<uint16_t>(count));
+    put16(p + 7, static_cast<uint16_t>(len));
+    if (len > 0) std::memcpy(p + FrameStream::HEADER_SIZE, payload, len);
+    put16(p + FrameStream::HEADER_SIZE + len, FrameStream::crc16(p + 2, HEADER_FIELDS + len));
+}
+
+// --- FrameDecoder ---
+
+FrameDecoder::FrameDecoder(size_t max_leds)
+    : _max_leds(std::min<size_t>(max_leds, 0xFFFF)),
+      _frame(_max_leds),
+      _buf(HEADER_FIELDS + _max_leds * 3 + FrameStream::CRC_SIZE) {}
+
+void FrameDecoder::reset() {
+    _state = State::Magic0;
+    _have = 0;
+    _need = 0;
+    _have_frame = false;
+    _stats = Stats();
+}
+
+size_t FrameDecoder::feed(const uint8_t* data, size_t len) {
+    size_t frames = 0;
+    _stats.bytes += static_cast<uint32_t>(len);
+
+    while (len > 0) {
+        if (_state == State::Magic0 || _state == State::Magic1) {
+            const uint8_t b = *data++;
+            --len;
+            if (_state == State::Magic1 && b == FrameStream::MAGIC_1) {
+                _state = State::Header;
+                _have = 0;
+                _need = HEADER_FIELDS;
+            } else {
+                _state = (b == FrameStream::MAGIC_0) ? State::Magic1 : State::Magic0;
+            }
+            continue;
+        }
+
+        const size_t take = std::min(len, _need - _have);
+        std::memcpy(_buf.data() + _have, data, take);
+        _have += take;
+        data += take;
+        len -= take;
+        frames += process();
+    }
+    return frames;
+}
+
+size_t FrameDecoder::process() {
+    using FrameStream::FrameType;
+    size_t frames = 0;
+
+    while ((_state == State::Header || _state == State::Body) && _have >= _need) {
+        const uint8_t type = _buf[0];
+        const size_t count = get16(_buf.data() + 3);
+        const size_t payload_len = get16(_buf.data() + 5);
+
+        if (_state == State::Header) {
+            const bool valid = type <= static_cast<uint8_t>(FrameType::Delta)
+                && count > 0 && count <= _max_leds
+                && payload_len <= count * 3
+                && (type != static_cast<uint8_t>(FrameType::Raw) || payload_len == count * 3);
+            if (!valid) {
+                ++_stats.format_errors;
+                rescan(0);
+                continue;
+            }
+            _state = State::Body;
+            _need = HEADER_FIELDS + payload_len + FrameStream::CRC_SIZE;
+            continue;
+        }
+
+        const size_t body = HEADER_FIELDS + payload_len;
+        if (FrameStream::crc16(_buf.data(), body) != get16(_buf.data() + body)) {
+            ++_stats.checksum_errors;
+            rescan(0);
+            continue;
+        }
+        if (apply()) {
+            ++_stats.frames;
+            ++frames;
+        }
+        rescan(_need);
+    }
+    return frames;
+}
+
+bool FrameDecoder::apply() {
+    using FrameStream::FrameType;
+    const FrameType type = static_cast<FrameType>(_buf[0]);
+    const uint16_t seq = get16(_buf.data() + 1);
+    const size_t count = get16(_buf.data() + 3);
+    const size_t len = get16(_buf.data() + 5);
+    const uint8_t* p = _buf.data() + HEADER_FIELDS;
+
+    // Validate everything before writing, so a bad frame never leaves a half-applied base
+    switch (type) {
+        case FrameType::Raw:
+            for (size_t i = 0; i < count; ++i, p += 3) _frame[i] = CRGB(p[0], p[1], p[2]);
+            break;
+
+        case FrameType::Rle: {
+            size_t total = 0;
+            for (size_t o = 0; o + 4 <= len; o += 4) total += p[o];
+            if (len % 4 != 0 || total != count) {
+                ++_stats.format_errors;
+                return false;
+            }
+            size_t i = 0;
+            for (size_t o = 0; o < len; o += 4) {
+                const CRGB c(p[o + 1], p[o + 2], p[o + 3]);
+                for (uint8_t k = 0; k < p[o]; ++k) _frame[i++] = c;
+            }
+            break;
+        }
+
+        case FrameType::Delta: {
+            if (!_have_frame || count != _led_count || seq != static_cast<uint16_t>(_seq + 1)) {
+                ++_stats.missing_base;
+                return false;
+            }
+            size_t o = 0;
+            while (o < len) {
+                if (o + SPAN_HEADER > len) break;
+                const size_t start = get16(p + o);
+                const size_t span = get16(p + o + 2);
+                if (span == 0 || start + span > count || o + SPAN_HEADER + span * 3 > len) break;
+                o += SPAN_HEADER + span * 3;
+            }
+            if (o != len) {
+                ++_stats.format_errors;
+                return false;
+            }
+            for (o = 0; o < len; ) {
+                const size_t start = get16(p + o);
+                const size_t span = get16(p + o + 2);
+                const uint8_t* c = p + o + SPAN_HEADER;
+                for (size_t k = 0; k < span; ++k, c += 3) _frame[start + k] = CRGB(c[0], c[1], c[2]);
+                o += SPAN_HEADER + span * 3;
+            }
+            break;
+        }
+    }
+
+    _led_count = count;
+    _seq = seq;
+    _have_frame = true;
+    return true;
+}
+
+void FrameDecoder::rescan(size_t from) {
+    // Look for the next magic in what is already buffered; a frame that failed
+    // its checks may have swallowed the start of the next good one
+    for (size_t k = from; k < _have; ++k) {
+        if (_buf[k] != FrameStream::MAGIC_0) continue;
+        if (k + 1 == _have) {
+            _state = State::Magic1;
+            _have = 0;
+            return;
+        }
+        if (_buf[k + 1] == FrameStream::MAGIC_1) {
+            _have -= k + 2;
+            std::memmove(_buf.data(), _buf.data() + k + 2, _have);
+            _state = State::Header;
+            _need = HEADER_FIELDS;
+            return;
+        }
+    }
+    _state = State::Magic0;
+    _have = 0;
+}
+
+} // namespace PixelTheater
@@ -0,0 +1,312 @@
+#include "PixelTheater/stream/network_ingest.h"
+#include "PixelTheater/stream/packet_transport.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace PixelTheater {
+
+namespace {
+
+constexpr uint8_t ARTNET_ID[8] = {'A', 'r', 't', '-', 'N', 'e', 't', 0};
+constexpr uint16_t ARTNET_OP_DMX = 0x5000;
+constexpr uint16_t ARTNET_OP_SYNC = 0x5200;
+constexpr uint8_t ARTNET_PROTOCOL_VERSION = 14;
+
+constexpr uint8_t E131_ID[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+constexpr uint32_t E131_ROOT_DATA = 0x00000004;
+constexpr uint32_t E131_ROOT_EXTENDED = 0x00000008;
+constexpr uint32_t E131_FRAMING_DATA = 0x00000002;
+constexpr uint32_t E131_FRAMING_SYNC = 0x00000001;
+constexpr uint8_t E131_OPT_PREVIEW = 0x80;
+constexpr uint8_t E131_OPT_TERMINATED = 0x40;
+constexpr uint8_t E131_CID[16] = {'P', 'i', 'x', 'e', 'l', 'T', 'h', 'e', 'a', 't', 'e', 'r', 0, 0, 0, 1};
+
+constexpr uint8_t OPC_SET_PIXELS = 0;
+
+constexpr size_t SYNC_FALLBACK_FRAMES = 8;
+
+inline uint16_t be16(const uint8_t* p) { return static_cast<uint16_t>((p[0] << 8) | p[1]); }
+inline uint32_t be32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (p[2] << 8) | p[3];
+}
+inline void putBe16(uint8_t* p, uint16_t v) { p[0] = static_cast<uint8_t>(v >> 8); p[1] = static_cast<uint8_t>(v); }
+inline void putBe32(uint8_t* p, uint32_t v) { putBe16(p, static_cast<uint16_t>(v >> 16)); putBe16(p + 2, static_cast<uint16_t>(v)); }
+
+// DMX slots (or OPC data) as RGB triplets
+inline void copyRgb(CRGB* dst, const uint8_t* slots, size_t leds) {
+    for (size_t i = 0; i < leds; ++i, slots += 3) {
+        dst[i].r = slots[0];
+        dst[i].g = slots[1];
+        dst[i].b = slots[2];
+    }
+}
+
+// E1.31 PDU flags and length: high nibble 0x7, length counted from this field
+inline void putPduLength(uint8_t* p, size_t length) { putBe16(p, static_cast<uint16_t>(0x7000 | (length & 0x0FFF))); }
+
+void putE131Root(uint8_t* out, size_t total, uint32_t vector) {
+    putBe16(out, 0x0010);               // Preamble size
+    putBe16(out + 2, 0x0000);           // Postamble size
+    std::memcpy(out + 4, E131_ID, sizeof(E131_ID));
+    putPduLength(out + 16, total - 16);
+    putBe32(out + 18, vector);
+    std::memcpy(out + 22, E131_CID, sizeof(E131_CID));
+}
+
+} // namespace
+
+// --- Packet builders ---
+
+size_t ArtNet::buildDmx(uint8_t* out, uint16_t universe, uint8_t seq, const uint8_t* slots, size_t count) {
+    count = std::min<size_t>(count, 512);
+    const size_t length = std::max<size_t>((count + 1) & ~size_t(1), 2); // Even, at least 2
+    std::memcpy(out, ARTNET_ID, sizeof(ARTNET_ID));
+    out[8] = ARTNET_OP_DMX & 0xFF;
+    out[9] = ARTNET_OP_DMX >> 8;
+    out[10] = 0;
+    out[11] = ARTNET_PROTOCOL_VERSION;
+    out[12] = seq;
+    out[13] = 0;                        // Physical port
+    out[14] = static_cast<uint8_t>(universe & 0xFF);
+    out[15] = static_cast<uint8_t>((universe >> 8) & 0x7F);
+    putBe16(out + 16, static_cast<uint16_t>(length));
+    std::memcpy(out + HEADER_SIZE, slots, count);
+    if (length > count) std::memset(out + HEADER_SIZE + count, 0, length - count);
+    return HEADER_SIZE + length;
+}
+
+size_t ArtNet::buildSync(uint8_t* out) {
+    std::memcpy(out, ARTNET_ID, sizeof(ARTNET_ID));
+    out[8] = ARTNET_OP_SYNC & 0xFF;
+    out[9] = ARTNET_OP_SYNC >> 8;
+    out[10] = 0;
+    out[11] = ARTNET_PROTOCOL_VERSION;
+    out[12] = 0;                        // Aux
+    out[13] = 0;
+    return 14;
+}
+
+size_t E131::buildData(uint8_t* out, uint16_t universe, uint8_t seq, uint16_t sync_address,
+                       const uint8_t* slots, size_t count) {
+    count = std::min<size_t>(count, 512);
+    const size_t total = HEADER_SIZE + count;
+    putE131Root(out, total, E131_ROOT_DATA);
+
+    // Framing layer
+    putPduLength(out + 38, total - 38);
+    putBe32(out + 40, E131_FRAMING_DATA);
+    std::memset(out + 44, 0, 64);
+    std::memcpy(out + 44, "PixelTheater", 12);   // Source name
+    out[108] = 100;                     // Priority
+    putBe16(out + 109, sync_address);
+    out[111] = seq;
+    out[112] = 0;                       // Options
+    putBe16(out + 113, universe);
+
+    // DMP layer
+    putPduLength(out + 115, total - 115);
+    out[117] = 0x02;                    // Set property
+    out[118] = 0xA1;                    // Address and data type
+    putBe16(out + 119, 0);              // First property address
+    putBe16(out + 121, 1);              // Address increment
+    putBe16(out + 123, static_cast<uint16_t>(count + 1));
+    out[125] = 0;                       // DMX start code
+    std::memcpy(out + HEADER_SIZE, slots, count);
+    return total;
+}
+
+size_t E131::buildSync(uint8_t* out, uint8_t seq, uint16_t sync_address) {
+    putE131Root(out, SYNC_PACKET, E131_ROOT_EXTENDED);
+    putPduLength(out + 38, SYNC_PACKET - 38);
+    putBe32(out + 40, E131_FRAMING_SYNC);
+    out[44] = seq;
+    putBe16(out + 45, sync_address);
+    out[47] = 0;                        // Reserved
+    out[48] = 0;
+    return SYNC_PACKET;
+}
+
+size_t Opc::buildSetPixels(uint8_t* out, uint8_t channel, const CRGB* leds, size_t count) {
+    count = std::min<size_t>(count, 0xFFFF / 3);
+    out[0] = channel;
+    out[1] = OPC_SET_PIXELS;
+    putBe16(out + 2, static_cast<uint16_t>(count * 3));
+    std::memcpy(out + HEADER_SIZE, leds, count * 3);
+    return HEADER_SIZE + count * 3;
+}
+
+// --- NetworkIngest ---
+
+NetworkIngest::NetworkIngest(size_t led_count) : NetworkIngest(led_count, Config()) {}
+
+NetworkIngest::NetworkIngest(size_t led_count, const Config& config)
+    : _config(config),
+      _back(led_count),
+      _front(led_count),
+      _packet(std::max(E131::MAX_PACKET, Opc::HEADER_SIZE + led_count * 3)) {
+    _config.leds_per_universe = std::max<uint16_t>(1, std::min<uint16_t>(_config.leds_per_universe, 170));
+    _universes = (led_count + _config.leds_per_universe - 1) / _config.leds_per_universe;
+    _received.assign(_universes, 0);
+    _e131_seq.assign(_universes, -1);
+}
+
+NetworkIngest::Protocol NetworkIngest::handlePacket(const uint8_t* data, size_t len) {
+    ++_stats.packets;
+    if (len >= ArtNet::HEADER_SIZE - 4 && std::memcmp(data, ARTNET_ID, sizeof(ARTNET_ID)) == 0) {
+        return handleArtNet(data, len);
+    }
+    if (len >= 22 && std::memcmp(data + 4, E131_ID, sizeof(E131_ID)) == 0) {
+        return handleE131(data, len);
+    }
+    return handleOpc(data, len);
+}
+
+size_t NetworkIngest::drain(PacketTransport& transport, size_t max_packets) {
+    const uint32_t before = _stats.frames;
+    for (size_t i = 0; i < max_packets; ++i) {
+        const size_t len = transport.receive(_packet.data(), _packet.size());
+        if (len == 0) break;
+        handlePacket(_packet.data(), len);
+    }
+    return _stats.frames - before;
+}
+
+NetworkIngest::Protocol NetworkIngest::handleArtNet(const uint8_t* data, size_t len) {
+    const uint16_t opcode = static_cast<uint16_t>(data[8] | (data[9] << 8));
+    if (opcode == ARTNET_OP_SYNC) {
+        handleSync();
+        return Protocol::ArtNet;
+    }
+    if (opcode != ARTNET_OP_DMX) {
+        ++_stats.ignored;               // Polls, replies and the rest of the protocol
+        return Protocol::ArtNet;
+    }
+    if (len < ArtNet::HEADER_SIZE) {
+        ++_stats.malformed;
+        return Protocol::None;
+    }
+
+    const uint16_t universe = static_cast<uint16_t>(data[14] | ((data[15] & 0x7F) << 8));
+    const size_t length = be16(data + 16);
+    if (length > 512 || ArtNet::HEADER_SIZE + length > len) {
+        ++_stats.malformed;
+        return Protocol::None;
+    }
+    if (universe < _config.artnet_universe || static_cast<size_t>(universe - _config.artnet_universe) >= _universes) {
+        ++_stats.ignored;
+        return Protocol::ArtNet;
+    }
+    handleDmx(universe - _config.artnet_universe, data + ArtNet::HEADER_SIZE, length);
+    return Protocol::ArtNet;
+}
+
+NetworkIngest::Protocol NetworkIngest::handleE131(const uint8_t* data, size_t len) {
+    const uint32_t root = be32(data + 18);
+    if (root == E131_ROOT_EXTENDED) {
+        if (len < 47 || be32(data + 40) != E131_FRAMING_SYNC) {
+            ++_stats.ignored;           // Universe discovery and friends
+            return Protocol::E131;
+        }
+        // Whatever the mode: a sync after a fallback switches sync back on
+        if (_sync_address != 0 && be16(data + 45) == _sync_address) handleSync();
+        return Protocol::E131;
+    }
+
+    if (root != E131_ROOT_DATA || len < E131::HEADER_SIZE || be32(data + 40) != E131_FRAMING_DATA
+        || data[117] != 0x02) {
+        ++_stats.malformed;
+        return Protocol::None;
+    }
+    const size_t count = be16(data + 123);
+    if (count == 0 || count - 1 > 512 || E131::HEADER_SIZE + count - 1 > len) {
+        ++_stats.malformed;
+        return Protocol::None;
+    }
+
+    const uint16_t universe = be16(data + 113);
+    const uint8_t options = data[112];
+    if (data[125] != 0 || (options & (E131_OPT_PREVIEW | E131_OPT_TERMINATED))
+        || universe < _config.e131_universe || static_cast<size_t>(universe - _config.e131_universe) >= _universes) {
+        ++_stats.ignored;               // Alternate start codes, preview data, unmapped universes
+        return Protocol::E131;
+    }
+
+    // Sequence check from the spec: drop packets up to 20 behind the last one
+    const size_t index = universe - _config.e131_universe;
+    const uint8_t seq = data[111];
+    if (_e131_seq[index] >= 0) {
+        const int8_t diff = static_cast<int8_t>(seq - static_cast<uint8_t>(_e131_seq[index]));
+        if (diff <= 0 && diff > -20) {
+            ++_stats.out_of_order;
+            return Protocol::E131;
+        }
+    }
+    _e131_seq[index] = seq;
+
+    _sync_address = be16(data + 109);
+    _sync_mode = _sync_address != 0 && _sync_recent;
+    handleDmx(index, data + E131::HEADER_SIZE, count - 1);
+    return Protocol::E131;
+}
+
+NetworkIngest::Protocol NetworkIngest::handleOpc(const uint8_t* data, size_t len) {
+    // A datagram may carry several messages back to back
+    bool any = false;
+    while (len >= Opc::HEADER_SIZE) {
+        const uint8_t channel = data[0];
+        const size_t length = be16(data + 2);
+        if (Opc::HEADER_SIZE + length > len) break;
+        if (data[1] == OPC_SET_PIXELS && (channel == 0 || _config.opc_channel == 0 || channel == _config.opc_channel)) {
+            const size_t count = std::min(length / 3, _back.size());
+            copyRgb(_back.data(), data + Opc::HEADER_SIZE, count);
+            completeFrame();
+        } else {
+            ++_stats.ignored;
+        }
+        any = true;
+        data += Opc::HEADER_SIZE + length;
+        len -= Opc::HEADER_SIZE + length;
+    }
+    if (!any || len != 0) {
+        ++_stats.malformed;
+        return any ? Protocol::Opc : Protocol::None;
+    }
+    return Protocol::Opc;
+}
+
+void NetworkIngest::handleDmx(size_t index, const uint8_t* slots, size_t count) {
+    if (_sync_mode && ++_unsynced_packets > SYNC_FALLBACK_FRAMES * _universes) {
+        _sync_mode = false;             // Sender stopped syncing
+        _sync_recent = false;
+    }
+    // A repeated universe means a new frame started before the last one finished
+    if (!_sync_mode && _received[index]) completeFrame();
+
+    const size_t first = index * _config.leds_per_universe;
+    const size_t leds = std::min({count / 3, size_t(_config.leds_per_universe), _back.size() - first});
+    copyRgb(_back.data() + first, slots, leds);
+    if (!_received[index]) {
+        _received[index] = 1;
+        ++_received_count;
+    }
+
+    if (!_sync_mode && _received_count == _universes) completeFrame();
+}
+
+void NetworkIngest::handleSync() {
+    ++_stats.syncs;
+    _sync_recent = true;
+    _sync_mode = true;
+    _unsynced_packets = 0;
+    if (_received_count > 0) completeFrame();
+}
+
+void NetworkIngest::completeFrame() {
+    std::copy(_back.begin(), _back.end(), _front.begin());
+    std::fill(_received.begin(), _received.end(), 0);
+    _received_count = 0;
+    ++_stats.frames;
+}
+
+} // namespace PixelTheater
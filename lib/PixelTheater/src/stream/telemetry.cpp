@@ -0,0 +1,533 @@
+#include "PixelTheater/stream/telemetry.h"
+#include "PixelTheater/stream/frame_codec.h"
+#include "PixelTheater/params/param_protocol.h"
+#include "PixelTheater/params/param_schema.h"
+#include "PixelTheater/scene.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace PixelTheater {
+
+namespace {
+
+void put16(uint8_t* p, uint16_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+void put32(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+uint16_t get16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t get32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// len:u8 | text, cut to limit bytes; returns bytes written
+size_t put_name(uint8_t* p, const char* text, size_t length, size_t limit) {
+    const size_t n = std::min(length, limit);
+    p[0] = static_cast<uint8_t>(n);
+    std::memcpy(p + 1, text, n);
+    return 1 + n;
+}
+
+uint32_t saturate(float value, float scale) {
+    const float scaled = value * scale;
+    if (scaled <= 0.0f) return 0;
+    if (scaled >= 4294967040.0f) return UINT32_MAX;
+    return static_cast<uint32_t>(scaled + 0.5f);
+}
+
+constexpr size_t MAX_SCENE_NAME = 63;
+constexpr size_t ZONE_ENTRY = 17;
+
+} // namespace
+
+namespace Telemetry {
+    const char* typeName(Type type) {
+        switch (type) {
+            case Type::Frames: return "frames";
+            case Type::ZoneName: return "zone_name";
+            case Type::Zones: return "zones";
+            case Type::System: return "system";
+            case Type::Scene: return "scene";
+            case Type::Params: return "params";
+            case Type::Status: return "status";
+        }
+        return "unknown";
+    }
+}
+
+// --- TelemetryEncoder ---
+
+TelemetryEncoder::TelemetryEncoder() : TelemetryEncoder(Config()) {}
+
+TelemetryEncoder::TelemetryEncoder(const Config& config) : _config(config) {
+    if (_config.bucket_us == 0) _config.bucket_us = 1;
+}
+
+void TelemetryEncoder::recordFrame(uint32_t frame_us) {
+    const size_t bucket = std::min<size_t>(frame_us / _config.bucket_us, Telemetry::BUCKETS - 1);
+    if (_buckets[bucket] < UINT16_MAX) _buckets[bucket]++;
+    _frames++;
+    _total_us += frame_us;
+    if (frame_us < _min_us) _min_us = frame_us;
+    if (frame_us > _max_us) _max_us = frame_us;
+}
+
+bool TelemetryEncoder::statsDue(uint32_t now_ms) const {
+    return _started && now_ms - _last_stats_ms >= _config.stats_interval_ms;
+}
+
+void TelemetryEncoder::setZone(const char* name, uint32_t calls, uint32_t total_us, uint32_t min_us, uint32_t max_us) {
+    Zone* zone = nullptr;
+    for (size_t i = 0; i < _zone_count; ++i) {
+        if (std::strncmp(_zones[i].name, name, Telemetry::MAX_NAME) == 0) {
+            zone = &_zones[i];
+            break;
+        }
+    }
+    if (!zone) {
+        if (_zone_count >= Telemetry::MAX_ZONES) return;
+        zone = &_zones[_zone_count++];
+        std::strncpy(zone->name, name, Telemetry::MAX_NAME);
+        zone->name[Telemetry::MAX_NAME] = '\0';
+        zone->announced = false;
+        zone->dirty = true;
+    } else if (zone->calls == calls && zone->total_us == total_us) {
+        return;     // Nothing ran since the last update
+    }
+    zone->calls = calls;
+    zone->total_us = total_us;
+    zone->min_us = min_us;
+    zone->max_us = max_us;
+    zone->dirty = true;
+}
+
+void TelemetryEncoder::setSystem(float temp_c, float power_mw, uint8_t brightness, uint32_t log_dropped) {
+    const float centi = std::max(-32768.0f, std::min(32767.0f, temp_c * 100.0f));
+    _temp_centi_c = static_cast<int16_t>(centi);
+    _power_mw = saturate(power_mw, 1.0f);
+    _brightness = brightness;
+    _log_dropped = log_dropped;
+}
+
+void TelemetryEncoder::setQuality(uint16_t level, uint16_t max) {
+    _quality = static_cast<uint8_t>(std::min<uint16_t>(level, 255));
+    _quality_max = static_cast<uint8_t>(std::min<uint16_t>(max, 255));
+}
+
+void TelemetryEncoder::setStatus(const char* text) {
+    if (std::strncmp(_status, text, Telemetry::MAX_STATUS) == 0) return;
+    std::strncpy(_status, text, Telemetry::MAX_STATUS);
+    _status[Telemetry::MAX_STATUS] = '\0';
+    _status_due = true;
+}
+
+void TelemetryEncoder::setScene(const Scene* scene, size_t index) {
+    if (scene != _scene || index != _scene_index) {
+        _scene = scene;
+        _scene_index = index;
+        _scene_schema = 0;      // Checked, and the scene sent, by the next next()
+        _last_params_ms -= _config.params_interval_ms;
+    }
+}
+
+void TelemetryEncoder::forceKeyframe() {
+    _last_keyframe_ms -= _config.keyframe_interval_ms;
+}
+
+void TelemetryEncoder::scheduleStats(uint32_t now_ms) {
+    _last_stats_ms = now_ms;
+    closeWindow(now_ms);
+    _frames_due = true;
+    _zones_due = true;
+    _system_due = true;
+}
+
+size_t TelemetryEncoder::next(uint32_t now_ms, uint8_t* out, size_t max) {
+    if (max < Telemetry::MAX_PACKET) return 0;
+    if (!_started) {
+        _started = true;
+        _window_start_ms = now_ms;
+        _last_stats_ms = now_ms;
+        _last_params_ms = now_ms - _config.params_interval_ms;
+        _last_keyframe_ms = now_ms - _config.keyframe_interval_ms;
+    }
+
+    if (now_ms - _last_keyframe_ms >= _config.keyframe_interval_ms) {
+        _last_keyframe_ms = now_ms;
+        for (size_t i = 0; i < _zone_count; ++i) _zones[i].announced = false;
+        _scene_due = _scene != nullptr;
+        _params_due = _scene != nullptr;
+        _status_due = _status[0] != '\0';
+    }
+    if (now_ms - _last_stats_ms >= _config.stats_interval_ms) scheduleStats(now_ms);
+    if (_scene && now_ms - _last_params_ms >= _config.params_interval_ms) {
+        _last_params_ms = now_ms;
+        const uint32_t schema = _scene->schema_version();
+        if (schema != _scene_schema) {
+            _scene_schema = schema;
+            _scene_due = true;
+            _params_due = true;
+        } else if (paramsChanged()) {
+            _params_due = true;
+        }
+    }
+
+    uint8_t* payload = out + Telemetry::HEADER_SIZE;
+
+    // Names before the values that refer to them
+    for (size_t i = 0; i < _zone_count; ++i) {
+        Zone& zone = _zones[i];
+        if (zone.announced) continue;
+        zone.announced = true;
+        payload[0] = static_cast<uint8_t>(i);
+        const size_t len = 1 + put_name(payload + 1, zone.name, std::strlen(zone.name), Telemetry::MAX_NAME);
+        return finish(Telemetry::Type::ZoneName, now_ms, out, len);
+    }
+    if (_scene_due) {
+        _scene_due = false;
+        if (_scene) return finish(Telemetry::Type::Scene, now_ms, out, scenePayload(payload));
+    }
+    if (_params_due) {
+        _params_due = false;
+        if (_scene) {
+            _param_len = paramsPayload(payload);
+            std::memcpy(_param_bytes, payload, _param_len);
+            return finish(Telemetry::Type::Params, now_ms, out, _param_len);
+        }
+    }
+    if (_status_due) {
+        _status_due = false;
+        const size_t len = put_name(payload, _status, std::strlen(_status), Telemetry::MAX_STATUS);
+        return finish(Telemetry::Type::Status, now_ms, out, len);
+    }
+    if (_frames_due) {
+        _frames_due = false;
+        std::memcpy(payload, _frames_payload, _frames_len);
+        return finish(Telemetry::Type::Frames, now_ms, out, _frames_len);
+    }
+    if (_zones_due) {
+        _zones_due = false;
+        const size_t len = zonesPayload(payload);
+        if (len > 1) return finish(Telemetry::Type::Zones, now_ms, out, len);
+    }
+    if (_system_due) {
+        _system_due = false;
+        put16(payload, static_cast<uint16_t>(_temp_centi_c));
+        put32(payload + 2, _power_mw);
+        payload[6] = _brightness;
+        put32(payload + 7, _log_dropped);
+        payload[11] = _quality;
+        payload[12] = _quality_max;
+        return finish(Telemetry::Type::System, now_ms, out, 13);
+    }
+    return 0;
+}
+
+size_t TelemetryEncoder::finish(Telemetry::Type type, uint32_t now_ms, uint8_t* out, size_t payload_len) {
+    out[0] = Telemetry::MAGIC_0;
+    out[1] = Telemetry::MAGIC_1;
+    out[2] = static_cast<uint8_t>(type);
+    put16(out + 3, _seq++);
+    put32(out + 5, now_ms);
+    put16(out + 9, static_cast<uint16_t>(payload_len));
+    const size_t body = Telemetry::HEADER_SIZE - 2 + payload_len;
+    put16(out + Telemetry::HEADER_SIZE + payload_len, FrameStream::crc16(out + 2, body));
+    return Telemetry::HEADER_SIZE + payload_len + Telemetry::CRC_SIZE;
+}
+
+void TelemetryEncoder::closeWindow(uint32_t now_ms) {
+    uint8_t* payload = _frames_payload;
+    size_t used = Telemetry::BUCKETS;
+    while (used > 0 && _buckets[used - 1] == 0) --used;
+
+    put16(payload, static_cast<uint16_t>(std::min<uint32_t>(_frames, UINT16_MAX)));
+    put32(payload + 2, now_ms - _window_start_ms);
+    put32(payload + 6, _frames ? _min_us : 0);
+    put32(payload + 10, _max_us);
+    put32(payload + 14, _total_us);
+    put16(payload + 18, _config.bucket_us);
+    payload[20] = static_cast<uint8_t>(used);
+    for (size_t i = 0; i < used; ++i) put16(payload + 21 + i * 2, _buckets[i]);
+
+    // Start the next window
+    std::memset(_buckets, 0, sizeof(_buckets));
+    _frames = 0;
+    _total_us = 0;
+    _min_us = UINT32_MAX;
+    _max_us = 0;
+    _window_start_ms = now_ms;
+    _frames_len = 21 + used * 2;
+}
+
+size_t TelemetryEncoder::zonesPayload(uint8_t* payload) {
+    size_t count = 0;
+    uint8_t* p = payload + 1;
+    for (size_t i = 0; i < _zone_count; ++i) {
+        Zone& zone = _zones[i];
+        if (!zone.dirty) continue;
+        zone.dirty = false;
+        p[0] = static_cast<uint8_t>(i);
+        put32(p + 1, zone.calls);
+        put32(p + 5, zone.total_us);
+        put32(p + 9, zone.min_us);
+        put32(p + 13, zone.max_us);
+        p += ZONE_ENTRY;
+        ++count;
+    }
+    payload[0] = static_cast<uint8_t>(count);
+    return 1 + count * ZONE_ENTRY;
+}
+
+size_t TelemetryEncoder::scenePayload(uint8_t* payload) const {
+    const SceneParameterSchema& schema = _scene->parameter_schema();
+    payload[0] = static_cast<uint8_t>(_scene_index);
+    put32(payload + 1, schema.version);
+    size_t pos = 5;
+    pos += put_name(payload + pos, _scene->name().c_str(), _scene->name().size(), MAX_SCENE_NAME);
+
+    // As many parameters as fit; the decoder names the rest by index
+    const size_t count_at = pos++;
+    size_t count = 0;
+    for (const ParameterSchema& param : schema.parameters) {
+        const size_t length = std::min(param.name.size(), Telemetry::MAX_NAME);
+        if (count == UINT8_MAX || pos + 2 + length > Telemetry::MAX_PAYLOAD) break;
+        payload[pos++] = static_cast<uint8_t>(param.param_type);
+        pos += put_name(payload + pos, param.name.c_str(), length, Telemetry::MAX_NAME);
+        ++count;
+    }
+    payload[count_at] = static_cast<uint8_t>(count);
+    return pos;
+}
+
+size_t TelemetryEncoder::paramsPayload(uint8_t* payload) const {
+    const SceneParameterSchema& schema = _scene->parameter_schema();
+    payload[0] = static_cast<uint8_t>(_scene_index);
+    put32(payload + 1, schema.version);
+    size_t pos = 6;
+    size_t count = 0;
+    for (size_t i = 0; i < schema.parameters.size() && count < UINT8_MAX; ++i) {
+        const ParamType type = schema.parameters[i].param_type;
+        const size_t size = ParamProtocol::value_size(type);
+        if (pos + 1 + size > Telemetry::MAX_PAYLOAD) break;
+        payload[pos++] = static_cast<uint8_t>(type);
+        ParamProtocol::encode_value(payload + pos, type, _scene->_settings_storage.value_at(i));
+        pos += size;
+        ++count;
+    }
+    payload[5] = static_cast<uint8_t>(count);
+    return pos;
+}
+
+bool TelemetryEncoder::paramsChanged() {
+    uint8_t current[Telemetry::MAX_PAYLOAD];
+    const size_t len = paramsPayload(current);
+    return len != _param_len || std::memcmp(current, _param_bytes, len) != 0;
+}
+
+// --- TelemetryDecoder ---
+
+void TelemetryDecoder::feed(const uint8_t* data, size_t len) {
+    if (_offset > 0 && _offset * 2 >= _buf.size()) {
+        _buf.erase(_buf.begin(), _buf.begin() + static_cast<std::ptrdiff_t>(_offset));
+        _offset = 0;
+    }
+    _buf.insert(_buf.end(), data, data + len);
+}
+
+void TelemetryDecoder::skip(size_t count) {
+    _text.append(reinterpret_cast<const char*>(_buf.data() + _offset), count);
+    _stats.other_bytes += static_cast<uint32_t>(count);
+    _offset += count;
+}
+
+std::string TelemetryDecoder::takeText() {
+    std::string text;
+    text.swap(_text);
+    return text;
+}
+
+bool TelemetryDecoder::next(Packet& packet) {
+    for (;;) {
+        // Find the magic; everything before it is text
+        const uint8_t* start = _buf.data() + _offset;
+        const size_t available = _buf.size() - _offset;
+        size_t at = 0;
+        while (at < available && start[at] != Telemetry::MAGIC_0) ++at;
+        if (at > 0) skip(at);
+        if (available - at < Telemetry::HEADER_SIZE) return false;
+
+        const uint8_t* p = _buf.data() + _offset;
+        const size_t payload_len = get16(p + 9);
+        if (p[1] != Telemetry::MAGIC_1 || payload_len > Telemetry::MAX_PAYLOAD) {
+            skip(1);
+            continue;
+        }
+        const size_t total = Telemetry::HEADER_SIZE + payload_len + Telemetry::CRC_SIZE;
+        if (available - at < total) return false;
+
+        const size_t body = Telemetry::HEADER_SIZE - 2 + payload_len;
+        if (FrameStream::crc16(p + 2, body) != get16(p + Telemetry::HEADER_SIZE + payload_len)) {
+            ++_stats.checksum_errors;
+            skip(1);
+            continue;
+        }
+
+        const uint16_t seq = get16(p + 3);
+        if (_have_seq && seq != static_cast<uint16_t>(_last_seq + 1)) {
+            _stats.lost += static_cast<uint16_t>(seq - _last_seq - 1);
+        }
+        _have_seq = true;
+        _last_seq = seq;
+        _stats.packets++;
+
+        packet.type = static_cast<Telemetry::Type>(p[2]);
+        packet.seq = seq;
+        packet.millis = get32(p + 5);
+        packet.text.clear();
+        packet.fields.clear();
+        decode(packet.type, p + Telemetry::HEADER_SIZE, payload_len, packet);
+        _offset += total;
+        return true;
+    }
+}
+
+void TelemetryDecoder::decode(Telemetry::Type type, const uint8_t* payload, size_t len, Packet& packet) {
+    auto add = [&packet](std::string key, double value) { packet.fields.push_back({std::move(key), value}); };
+    auto zone_name = [this](size_t id) {
+        return id < _zone_names.size() && !_zone_names[id].empty() ? _zone_names[id] : "zone" + std::to_string(id);
+    };
+
+    switch (type) {
+        case Telemetry::Type::Frames: {
+            if (len < 21) return;
+            const uint32_t frames = get16(payload);
+            const uint32_t window_ms = get32(payload + 2);
+            const uint32_t total_us = get32(payload + 14);
+            const uint16_t bucket_us = get16(payload + 18);
+            const size_t used = std::min<size_t>(payload[20], (len - 21) / 2);
+            add("frames", frames);
+            add("fps", window_ms ? frames * 1000.0 / window_ms : 0.0);
+            add("frame_us.min", get32(payload + 6));
+            add("frame_us.avg", frames ? static_cast<double>(total_us) / frames : 0.0);
+            add("frame_us.max", get32(payload + 10));
+
+            // Percentiles from the histogram, at each bucket's upper edge
+            const double marks[] = {0.50, 0.95, 0.99};
+            const char* names[] = {"frame_us.p50", "frame_us.p95", "frame_us.p99"};
+            for (size_t m = 0; m < 3; ++m) {
+                uint32_t seen = 0;
+                size_t bucket = used;
+                for (size_t i = 0; i < used; ++i) {
+                    seen += get16(payload + 21 + i * 2);
+                    if (seen >= marks[m] * frames) {
+                        bucket = i;
+                        break;
+                    }
+                }
+                if (bucket < used) add(names[m], (bucket + 1.0) * bucket_us);
+            }
+            for (size_t i = 0; i < used; ++i) {
+                const uint16_t count = get16(payload + 21 + i * 2);
+                if (count) add("hist." + std::to_string(i * bucket_us), count);
+            }
+            return;
+        }
+        case Telemetry::Type::ZoneName: {
+            if (len < 2 || len < 2u + payload[1]) return;
+            const size_t id = payload[0];
+            if (_zone_names.size() <= id) _zone_names.resize(id + 1);
+            _zone_names[id].assign(reinterpret_cast<const char*>(payload + 2), payload[1]);
+            packet.text = _zone_names[id];
+            add("zone.id", static_cast<double>(id));
+            return;
+        }
+        case Telemetry::Type::Zones: {
+            if (len < 1) return;
+            const size_t count = std::min<size_t>(payload[0], (len - 1) / ZONE_ENTRY);
+            for (size_t i = 0; i < count; ++i) {
+                const uint8_t* e = payload + 1 + i * ZONE_ENTRY;
+                const std::string prefix = "zone." + zone_name(e[0]) + ".";
+                const uint32_t calls = get32(e + 1);
+                const uint32_t total = get32(e + 5);
+                add(prefix + "calls", calls);
+                add(prefix + "avg_us", calls ? static_cast<double>(total) / calls : 0.0);
+                add(prefix + "min_us", get32(e + 9));
+                add(prefix + "max_us", get32(e + 13));
+            }
+            return;
+        }
+        case Telemetry::Type::System: {
+            if (len < 11) return;
+            add("cpu_temp_c", static_cast<int16_t>(get16(payload)) / 100.0);
+            add("power_w", get32(payload + 2) / 1000.0);
+            add("brightness", payload[6]);
+            add("log_dropped", get32(payload + 7));
+            if (len >= 13) {
+                add("quality", payload[11]);
+                add("quality_max", payload[12]);
+            }
+            return;
+        }
+        case Telemetry::Type::Scene: {
+            if (len < 7) return;
+            add("scene.index", payload[0]);
+            _params_schema = get32(payload + 1);
+            add("scene.schema", _params_schema);
+            size_t pos = 5;
+            const size_t name_len = payload[pos++];
+            if (pos + name_len + 1 > len) return;
+            packet.text.assign(reinterpret_cast<const char*>(payload + pos), name_len);
+            pos += name_len;
+            const size_t count = payload[pos++];
+            _params.clear();
+            for (size_t i = 0; i < count && pos + 2 <= len; ++i) {
+                const ParamType param_type = static_cast<ParamType>(payload[pos++]);
+                const size_t n = payload[pos++];
+                if (pos + n > len) break;
+                _params.push_back({std::string(reinterpret_cast<const char*>(payload + pos), n), param_type});
+                pos += n;
+            }
+            add("scene.params", static_cast<double>(_params.size()));
+            return;
+        }
+        case Telemetry::Type::Status: {
+            if (len < 1 || len < 1u + payload[0]) return;
+            packet.text.assign(reinterpret_cast<const char*>(payload + 1), payload[0]);
+            return;
+        }
+        case Telemetry::Type::Params: {
+            if (len < 6) return;
+            add("scene.index", payload[0]);
+            const bool named = get32(payload + 1) == _params_schema;
+            size_t pos = 6;
+            for (size_t i = 0; i < payload[5] && pos < len; ++i) {
+                const ParamType param_type = static_cast<ParamType>(payload[pos++]);
+                const size_t size = ParamProtocol::value_size(param_type);
+                if (pos + size > len) break;
+                const ParamValue value = ParamProtocol::decode_value(payload + pos, param_type);
+                pos += size;
+                const std::string key = named && i < _params.size() ? _params[i].name : "param" + std::to_string(i);
+                const bool is_float = param_type != ParamType::count && param_type != ParamType::select &&
+                                      param_type != ParamType::switch_type;
+                add("param." + key, is_float ? value.as_float()
+                                  : param_type == ParamType::switch_type ? (value.as_bool() ? 1.0 : 0.0)
+                                  : static_cast<double>(value.as_int()));
+            }
+            return;
+        }
+    }
+}
+
+} // namespace PixelTheater
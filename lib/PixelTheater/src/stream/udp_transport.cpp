@@ -0,0 +1,81 @@
+#if !defined(PLATFORM_TEENSY) && !defined(PLATFORM_WEB) && !defined(EMSCRIPTEN)
+
+#include "PixelTheater/stream/udp_transport.h"
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace PixelTheater {
+
+static_assert(sizeof(sockaddr_in) <= 16, "UdpTransport::_remote is too small for sockaddr_in");
+
+UdpTransport::UdpTransport() : _fd(::socket(AF_INET, SOCK_DGRAM, 0)) {
+    std::memset(_remote, 0, sizeof(_remote));
+    if (_fd < 0) return;
+    // Room for a few frames' worth of universes arriving in a burst
+    const int buffer = 1 << 20;
+    setsockopt(_fd, SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer));
+}
+
+UdpTransport::~UdpTransport() {
+    if (_fd >= 0) ::close(_fd);
+}
+
+bool UdpTransport::bind(uint16_t port, const char* address) {
+    if (_fd < 0) return false;
+    const int reuse = 1;
+    setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, address, &addr.sin_addr) != 1) return false;
+    return ::bind(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+}
+
+bool UdpTransport::setRemote(const char* host, uint16_t port) {
+    if (_fd < 0) return false;
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) return false;
+    if ((ntohl(addr.sin_addr.s_addr) & 0xFF) == 0xFF) {
+        const int broadcast = 1;
+        setsockopt(_fd, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast));
+    }
+    std::memcpy(_remote, &addr, sizeof(addr));
+    _has_remote = true;
+    return true;
+}
+
+bool UdpTransport::waitReadable(int timeout_ms) const {
+    if (_fd < 0) return false;
+    pollfd p = {_fd, POLLIN, 0};
+    return ::poll(&p, 1, timeout_ms) > 0 && (p.revents & POLLIN);
+}
+
+size_t UdpTransport::receive(uint8_t* dst, size_t max) {
+    if (_fd < 0) return 0;
+    const ssize_t n = ::recv(_fd, dst, max, MSG_DONTWAIT);
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+size_t UdpTransport::send(const uint8_t* src, size_t len) {
+    if (_fd < 0 || !_has_remote) return 0;
+    const ssize_t n = ::sendto(_fd, src, len, 0, reinterpret_cast<const sockaddr*>(_remote), sizeof(sockaddr_in));
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+uint16_t UdpTransport::localPort() const {
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (_fd < 0 || getsockname(_fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) return 0;
+    return ntohs(addr.sin_port);
+}
+
+} // namespace PixelTheater
+
+#endif // !defined(PLATFORM_TEENSY) && !defined(PLATFORM_WEB) && !defined(EMSCRIPTEN)
@@ -3,6 +3,8 @@
 // Includes needed only for non-template method implementations
 #include "PixelTheater/scene.h" 
 #include "PixelTheater/core/log.h" // Needed for logging
+#include "PixelTheater/core/time.h" // Switch latency
+#include "PixelTheater/core/cycle_counter.h" // Frame time for the quality governor
 
 
 namespace PixelTheater {
@@ -18,18 +20,54 @@ public:
 static DummyScene dummy_scene_instance;
 
 Theater::Theater() {
-    // Constructor implementation (currently empty)
+    for (size_t slot = 0; slot < MAX_RESIDENT_SCENES; ++slot) slot_entry_[slot] = NO_ENTRY;
 }
 
 Theater::~Theater() {
-    // Destructor implementation
-    // unique_ptrs will handle cleanup automatically
+    // unique_ptrs clean up addScene() scenes; list scenes live in static storage
+    for (size_t slot = 0; slot < resident_slots_; ++slot) {
+        if (slot_entry_[slot] != NO_ENTRY) evict(slot);
+    }
+    if (scene_storage_claim_) *scene_storage_claim_ = false;
 }
 
 // --- Template Implementations moved to theater.h --- 
 
 // --- Non-template implementations for Theater methods --- 
 
+void Theater::useNativePlatform(std::unique_ptr<RuntimeModel> model) {
+    if (initialized_ || !model || !model->loaded()) return;
+    auto platform = std::make_unique<NativePlatform>(model->pointCount());
+    internal_prepare_runtime(std::move(platform), std::move(model));
+}
+
+#ifdef PLATFORM_TEENSY
+void Theater::useFastLEDPlatform(::CRGB* leds, size_t num_leds, std::unique_ptr<RuntimeModel> model) {
+    if (initialized_ || !model || !model->loaded()) return;
+    if (num_leds < model->pointCount()) {
+        Log::warning("Model has more points than LEDs. Ignoring call.");
+        return;
+    }
+    auto platform_leds = reinterpret_cast<PixelTheater::CRGB*>(leds);
+    auto platform = std::make_unique<FastLEDPlatform>(platform_leds, num_leds);
+    internal_prepare_runtime(std::move(platform), std::move(model));
+}
+#endif
+
+void Theater::internal_prepare_runtime(std::unique_ptr<Platform> platform, std::unique_ptr<RuntimeModel> model) {
+    if (initialized_) {
+        Log::warning("Theater already initialized. Ignoring call.");
+        return;
+    }
+    platform_ = std::move(platform);
+    model->attachLeds(platform_->getLEDs());
+    leds_ = std::make_unique<LedBufferWrapper>(platform_->getLEDs(), platform_->getNumLEDs());
+    model_ = std::move(model);
+
+    initialized_ = true;
+    Log::info("Theater initialized.");
+}
+
 void Theater::start() {
     if (!initialized_) { 
         // Cannot log reliably before platform is set.
@@ -38,68 +76,206 @@ void Theater::start() {
     }
     if (!current_scene_) {
         if (!scenes_.empty()) {
-            current_scene_ = scenes_[0].get();
+            current_scene_ = instantiate(0, true);
+            if (!current_scene_) return;
+            scenes_[0].last_used = ++activations_;
         } else {
             if (platform_) platform_->logWarning("Theater::start() called with no scenes added.");
             return; 
         }
     }
-    // TODO: Add setup_called flag to Scene?
     if (platform_) platform_->logInfo("Theater started.");
-    current_scene_->setup(); 
+    if (!current_scene_->_prepared) {
+        current_scene_->setup();
+        current_scene_->_prepared = true;
+    }
+    syncDirtyTracking();
 }
 
 void Theater::update() {
     if (!initialized_ || !current_scene_ || !platform_) return; // Nothing to do
-    
+
+    const bool governed = quality_governor_.enabled();
+    const CycleCounter::Ticks start = governed ? CycleCounter::now() : 0;
+
+    // Own clock rather than platform deltaTime(), which scenes consume.
+    // Capped so a stall (or a scene switch) doesn't jump the modulators or trails.
+    const uint32_t now = platform_->millis();
+    float dt = last_update_ms_ ? static_cast<float>(now - last_update_ms_) / 1000.0f : 0.0f;
+    if (dt > 0.1f) dt = 0.1f;
+    last_update_ms_ = now;
+    current_scene_->update_modulation(dt);
+
     current_scene_->tick();
+    current_scene_->apply_post_process(dt);
+    if (dirty_tracking_) dirty_tracker_->capture(*leds_);
+
+    if (governed) {
+        last_frame_us_ = CycleCounter::elapsedNs(start, CycleCounter::now()) / 1000;
+        const int step = quality_governor_.record(last_frame_us_, current_scene_->quality_knobs());
+        if (step && platform_) {
+            const QualityKnobs& knobs = current_scene_->quality_knobs();
+            platform_->logInfo("Theater quality %s to %u/%u (%u us frames, budget %u us)",
+                               step < 0 ? "down" : "up", static_cast<unsigned>(knobs.total()),
+                               static_cast<unsigned>(knobs.maxTotal()), static_cast<unsigned>(last_frame_us_),
+                               static_cast<unsigned>(quality_governor_.config().target_us));
+        }
+    }
     platform_->show();
 }
 
-void Theater::nextScene() {
-    if (scenes_.size() < 2) return; 
-    
-    size_t current_index = scenes_.size(); // Initialize to invalid index
-    for(size_t i = 0; i < scenes_.size(); ++i) {
-        if (scenes_[i].get() == current_scene_) {
-            current_index = i;
-            break;
+QualityGovernor& Theater::qualityGovernor() {
+    return quality_governor_;
+}
+
+const QualityGovernor& Theater::qualityGovernor() const {
+    return quality_governor_;
+}
+
+uint32_t Theater::lastFrameUs() const {
+    return last_frame_us_;
+}
+
+void Theater::syncDirtyTracking() {
+    if (!leds_) return;
+    dirty_tracking_ = current_scene_ && current_scene_->dirty_tracking();
+    if (dirty_tracking_) {
+        if (!dirty_tracker_) {
+            dirty_tracker_ = std::make_unique<DirtyTracker>();
+            dirty_tracker_->reset(leds_->ledCount());
+            if (model_) dirty_tracker_->setFaces(*model_);
         }
+        // Whatever consumers saw last belongs to another scene (or nothing)
+        dirty_tracker_->invalidate();
     }
+    if (platform_) platform_->setDirtyTracker(dirtyTracker());
+}
 
-    if (current_index < scenes_.size()) { // Check if found
-        size_t next_index = (current_index + 1) % scenes_.size();
-        current_scene_ = scenes_[next_index].get();
-        current_scene_->reset(); 
-        current_scene_->setup(); 
-    } else if (!scenes_.empty()) {
-        current_scene_ = scenes_[0].get();
-        current_scene_->reset();
-        current_scene_->setup();
+const DirtyTracker* Theater::dirtyTracker() const {
+    return dirty_tracking_ ? dirty_tracker_.get() : nullptr;
+}
+
+size_t Theater::currentSceneIndex() const {
+    if (!current_scene_) return scenes_.size();
+    for (size_t i = 0; i < scenes_.size(); ++i) {
+        if (scenes_[i].instance == current_scene_) return i;
     }
+    return scenes_.size();
 }
 
-void Theater::previousScene() {
-     if (scenes_.size() < 2) return;
-    
-    size_t current_index = scenes_.size(); // Initialize to invalid index
-    for(size_t i = 0; i < scenes_.size(); ++i) {
-        if (scenes_[i].get() == current_scene_) {
-            current_index = i;
+bool Theater::isResident(size_t index) const {
+    return index < scenes_.size() && scenes_[index].instance != nullptr;
+}
+
+size_t Theater::sceneStorageBytes() const {
+    return slot_size_ * resident_slots_;
+}
+
+Scene* Theater::instantiate(size_t index, bool evict_current) {
+    SceneEntry& entry = scenes_[index];
+    if (entry.instance || !entry.factory) return entry.instance;
+
+    // A free slot, else the least recently used scene that may go
+    size_t slot = NO_ENTRY;
+    for (size_t s = 0; s < resident_slots_; ++s) {
+        const size_t occupant = slot_entry_[s];
+        if (occupant == NO_ENTRY) {
+            slot = s;
             break;
         }
+        if (!evict_current && scenes_[occupant].instance == current_scene_) continue;
+        if (slot == NO_ENTRY || scenes_[occupant].last_used < scenes_[slot_entry_[slot]].last_used) slot = s;
     }
+    if (slot == NO_ENTRY) return nullptr;
+    if (slot_entry_[slot] != NO_ENTRY) evict(slot);
+
+    Scene* scene = entry.factory(scene_storage_ + slot * slot_size_);
+    scene->connect(*model_, *leds_, *platform_);
+    entry.instance = scene;
+    entry.slot = static_cast<int>(slot);
+    slot_entry_[slot] = index;
+    return scene;
+}
 
-    if (current_index < scenes_.size()) { // Check if found
-        size_t prev_index = (current_index == 0) ? (scenes_.size() - 1) : (current_index - 1);
-        current_scene_ = scenes_[prev_index].get();
-        current_scene_->reset(); 
-        current_scene_->setup();
-    } else if (!scenes_.empty()) {
-        current_scene_ = scenes_[0].get();
-        current_scene_->reset();
-        current_scene_->setup();
+void Theater::evict(size_t slot) {
+    SceneEntry& entry = scenes_[slot_entry_[slot]];
+    if (entry.instance == current_scene_) current_scene_ = nullptr;
+    entry.instance->~Scene();
+    entry.instance = nullptr;
+    entry.slot = -1;
+    slot_entry_[slot] = NO_ENTRY;
+}
+
+void Theater::prepare(Scene& scene) {
+    scene.reset();
+    scene.setup();
+    scene._prepared = true;
+}
+
+void Theater::activate(size_t index, bool restart) {
+    const uint32_t start_us = getSystemTimeProvider().micros();
+
+    // A scene that doesn't retain state starts over next time
+    if (current_scene_ && current_scene_ != scenes_[index].instance && !current_scene_->retain_state()) {
+        current_scene_->_prepared = false;
+    }
+    // Construction of a list scene (and eviction of the outgoing one) counts as switch time
+    Scene* scene = instantiate(index, true);
+    if (!scene) return;
+    current_scene_ = scene;
+    scenes_[index].last_used = ++activations_;
+    if (restart || !scene->_prepared) {
+        prepare(*scene);
+    } else if (scene->retain_state()) {
+        scene->resume();
+    }
+    // else: prewarmed, setup() already ran
+    syncDirtyTracking();
+    quality_governor_.reset();     // The average was the outgoing scene's
+
+    switch_stats_.last_us = getSystemTimeProvider().micros() - start_us;
+    if (switch_stats_.last_us > switch_stats_.max_us) switch_stats_.max_us = switch_stats_.last_us;
+    switch_stats_.count++;
+}
+
+void Theater::nextScene() {
+    if (scenes_.size() < 2) return; 
+
+    const size_t current_index = currentSceneIndex();
+    const size_t next_index = current_index < scenes_.size() ? (current_index + 1) % scenes_.size() : 0;
+    activate(next_index);
+}
+
+void Theater::previousScene() {
+    if (scenes_.size() < 2) return;
+
+    const size_t current_index = currentSceneIndex();
+    size_t prev_index = 0;
+    if (current_index < scenes_.size()) {
+        prev_index = (current_index == 0) ? (scenes_.size() - 1) : (current_index - 1);
     }
+    activate(prev_index);
+}
+
+bool Theater::prewarm(size_t index) {
+    if (!initialized_ || index >= scenes_.size()) return false;
+    Scene* existing = scenes_[index].instance;
+    if (existing && (existing == current_scene_ || existing->_prepared)) return false;
+    Scene* scene = instantiate(index, false);  // No slot to spare: leave it for the switch
+    if (!scene) return false;
+    scenes_[index].last_used = ++activations_;
+    prepare(*scene);
+    return true;
+}
+
+bool Theater::prewarmNext() {
+    if (scenes_.size() < 2) return false;
+    const size_t current_index = currentSceneIndex();
+    return prewarm(current_index < scenes_.size() ? (current_index + 1) % scenes_.size() : 0);
+}
+
+const Theater::SwitchStats& Theater::switchStats() const {
+    return switch_stats_;
 }
 
 // --- Accessors ---
@@ -116,17 +292,17 @@ const Scene* Theater::currentScene() const {
     return current_scene_;
 }
 
-const std::vector<std::unique_ptr<Scene>>& Theater::scenes() const {
-    return scenes_;
-}
-
 Scene& Theater::scene(size_t index) {
     if (index >= scenes_.size()) {
         if (platform_) platform_->logError("Theater::scene index out of range");
         // Return dummy reference for graceful failure
         return dummy_scene_instance; 
     }
-    return *scenes_[index];
+    if (!scenes_[index].instance) {
+        if (platform_) platform_->logError("Theater::scene %zu is not resident", index);
+        return dummy_scene_instance;
+    }
+    return *scenes_[index].instance;
 }
 
 const Scene& Theater::scene(size_t index) const {
@@ -135,7 +311,11 @@ const Scene& Theater::scene(size_t index) const {
         // Return dummy reference for graceful failure
         return dummy_scene_instance; 
     }
-    return *scenes_[index];
+    if (!scenes_[index].instance) {
+        if (platform_) platform_->logError("Theater::scene %zu is not resident", index);
+        return dummy_scene_instance;
+    }
+    return *scenes_[index].instance;
 }
 
 // --- ADDED: Platform Accessor ---
@@ -147,6 +327,10 @@ const Platform* Theater::platform() const {
     return platform_.get();
 }
 
+const IModel* Theater::model() const {
+    return model_.get();
+}
+
 // --- ADDED: Scene Control ---
 bool Theater::setScene(size_t index) {
     if (!initialized_) {
@@ -159,27 +343,17 @@ bool Theater::setScene(size_t index) {
         return false;
     }
 
-    // Get the target scene pointer before potentially changing current_scene_
-    Scene* target_scene = scenes_[index].get(); 
-    
-    // Log whether it's a change or a re-selection
-    if (target_scene == current_scene_) {
-        if (platform_) platform_->logInfo("Theater::setScene re-selected current scene index: %zu", index);
-    } else {
-         if (platform_) platform_->logInfo("Theater::setScene changing to scene index: %zu", index);
-         current_scene_ = target_scene; 
-    }
-    // ALWAYS reset and setup
-    if (current_scene_) { 
-        current_scene_->reset(); 
-        current_scene_->setup(); 
-        if (platform_) platform_->logInfo("Theater scene changed to index %zu: %s", index, current_scene_->name().c_str());
-        return true;
-    } else {
-        // This case should ideally not happen if index check passed
-        if (platform_) platform_->logError("Theater::setScene failed to set scene pointer for index %zu", index);
-        return false; 
+    // Re-selecting the current scene restarts it; otherwise a scene that
+    // retains its state resumes
+    const bool restart = current_scene_ && scenes_[index].instance == current_scene_;
+    if (platform_) {
+        platform_->logInfo(restart ? "Theater::setScene re-selected current scene index: %zu"
+                                   : "Theater::setScene changing to scene index: %zu", index);
     }
+    activate(index, restart);
+    if (platform_) platform_->logInfo("Theater scene changed to index %zu: %s (%u us)", index,
+                                      current_scene_->name().c_str(), static_cast<unsigned>(switch_stats_.last_us));
+    return true;
 }
 
 // --- Implementation and instantiation moved back to theater.h ---
@@ -3,17 +3,13 @@
 namespace Benchmark {
 
 // Global benchmark data storage
-std::map<std::string, BenchmarkData> benchmarks;
+std::map<std::string, BenchmarkData, std::less<>> benchmarks;
 
 // Current active benchmark name
-std::string current_benchmark;
+const char* current_benchmark = nullptr;
 
 // Start time for current benchmark
-#if defined(PLATFORM_NATIVE) || defined(PLATFORM_WEB)
-std::chrono::time_point<std::chrono::high_resolution_clock> benchmark_start_time;
-#else
-uint32_t benchmark_start_time;
-#endif
+PixelTheater::CycleCounter::Ticks benchmark_start_time = 0;
 
 // Whether benchmarking is enabled
 bool enabled = true;
@@ -26,6 +26,9 @@
 #include "scenes/orientation_grid/orientation_grid_scene.h" // ADDED
 #include "scenes/sparkles/sparkles_scene.h" // UPDATED
 #include "scenes/texture_map/texture_map_scene.h" // ADDED NEW SCENE
+#include "scenes/stream_receiver/stream_receiver_scene.h" // Host-streamed frames
+#include "PixelTheater/stream/serial_byte_stream.h"
+#include "PixelTheater/stream/telemetry.h"
 #include "benchmark.h" 
 
 #ifndef PROJECT_VERSION
@@ -37,9 +40,11 @@
 #define VERSION PROJECT_VERSION
 #define USER_BUTTON 2
 // https://github.com/FastLED/FastLED/wiki/Parallel-Output#parallel-output-on-the-teensy-4
-// pins 19+18 are used to control two strips of 624 LEDs, for a total of 1248 LEDs
-#define LED_CHANNEL_1_PIN 19  // Teensy 4.1/fastled pin order: .. ,19,18,14,15,17, ..
-#define LED_CHANNEL_2_PIN 18  // Teensy 4.1/fastled pin order: .. ,19,18,14,15,17, ..
+// One LED channel per pin; faces are split between them so the longest strip
+// (which bounds the frame's transmit time) is as short as possible. Pins 19+18
+// drive two strips of 624 LEDs (faces 0-5 and 6-11), for a total of 1248 LEDs.
+// Bigger builds add pins here, up to PixelTheater::OutputMap::MAX_CHANNELS.
+#define LED_PINS 19, 18  // Teensy 4.1/fastled pin order: .. ,19,18,14,15,17, ..
 #define ANALOG_PIN_A 24
 #define ANALOG_PIN_B 25
 #define ON_BOARD_LED 13
@@ -50,62 +55,93 @@
 
 #define BRIGHTNESS  15      // global brightness, should be used by all animations
 #define USE_IMU true        // enable orientation sensor (currently: LSM6DSOX)
+// Scene time per frame before the quality governor steps quality down. Writing
+// 2 x 624 WS2812 LEDs already takes ~37 ms a frame, whatever the scene does.
+#define SCENE_BUDGET_US 12000
 
 // model settings (replace with generated model params)
 #define NUM_LEDS 1248
 #define NUM_SIDES 12
 #define LEDS_PER_SIDE 104
 
-::CRGB leds[NUM_LEDS];
+// One FastLED controller per pin, each on its channel of the output buffer
+template <uint8_t... PINS>
+struct LedPins {
+  static constexpr size_t count = sizeof...(PINS);
+  static_assert(count >= 1 && count <= PixelTheater::OutputMap::MAX_CHANNELS, "1 to 16 LED pins");
+  static void addLeds(::CRGB* output, const PixelTheater::OutputMap& map) {
+    size_t channel = 0;
+    ((FastLED.addLeds<WS2812, PINS, GRB>(output + channel * map.stride(), map.channelLength(channel)), ++channel), ...);
+  }
+};
+using OutputPins = LedPins<LED_PINS>;
+
+::CRGB leds[NUM_LEDS];    // What scenes draw, in model order
+// Channel-major copy sent to the pins. Whole faces per channel, so no
+// channel is more than a face longer than an even share.
+::CRGB output_leds[NUM_LEDS + OutputPins::count * LEDS_PER_SIDE];
+PixelTheater::OutputMap output_map;
 
 PixelTheater::Theater theater; // Global Theater instance
 
+// Scenes in button order. Built on activation into static storage; two slots
+// so the next scene can be prewarmed while the button is held.
+using FirmwareScenes = PixelTheater::SceneList<
+  Scenes::SparklesScene,
+  Scenes::SatellitesScene,
+  Scenes::WanderingParticlesScene,
+  Scenes::TextureMapScene,
+  Scenes::OrientationGridScene,
+  Scenes::BlobScene,
+  Scenes::XYZScannerScene,
+  Scenes::BoidsScene,
+  Scenes::GeographyScene,
+  Scenes::StreamReceiverScene  // Frames from util/stream_sender
+>;
+constexpr size_t RESIDENT_SCENES = 2;
+PixelTheater::SerialByteStream usbStream(Serial); // Frame source for StreamReceiverScene
+
 long random_seed = 0;
 int seed1,seed2 = 0;
 int mode = 0;
 
+PixelTheater::TelemetryEncoder telemetry; // Binary status, read with util/telemetry_decoder
+
+// Estimated LED power in mW: FastLED's per-channel model at full brightness, scaled to ours
 float calculate_power_usage() {
-  // todo
-  return 0.0f;
+  return calculate_unscaled_power_mW(leds, NUM_LEDS) * (BRIGHTNESS / 255.0f);
 }
 
-void timerStatusMessage(){
-  // uint8_t scene_number = 0; // TODO: Get current scene index from Theater?
-  size_t scene_number = 0; // Default to 0 if no scene
-  String scene_name = "Unknown";
-  std::string scene_status = "(No Scene)"; // Default status
-  
-  // Get current scene name and status from Theater
-  PixelTheater::Scene* current = theater.currentScene();
-  if (current) { 
-    scene_name = current->name().c_str(); 
-    scene_status = current->status(); // Get status from the current scene
-    if (scene_status.empty()) { scene_status = "(empty)"; } // Handle empty status
-    
-    // Find the index of the current scene
-    const auto& all_scenes = theater.scenes();
-    for(size_t i = 0; i < all_scenes.size(); ++i) {
-        if (all_scenes[i].get() == current) {
-            scene_number = i;
-            break;
-        }
+// Called once per loop with the time since the previous loop. Writes at most
+// one small packet; zones, temperature and power are sampled once a second.
+void sendTelemetry(uint32_t frame_us) {
+  const uint32_t now = millis();
+  telemetry.recordFrame(frame_us);
+  telemetry.setScene(theater.currentScene(), theater.currentSceneIndex());
+
+  if (telemetry.statsDue(now)) {
+    for (const auto& zone : Benchmark::benchmarks) {
+      const Benchmark::BenchmarkData& data = zone.second;
+      telemetry.setZone(zone.first.c_str(), data.count, static_cast<uint32_t>(data.total_time_ns / 1000),
+                        data.min_time_ns / 1000, data.max_time_ns / 1000);
+    }
+    uint32_t log_dropped = 0;
+#ifdef PIXELTHEATER_LOG_DEFERRED
+    log_dropped = PixelTheater::Log::deferred().dropped();
+#endif
+    telemetry.setSystem(InternalTemperature.readTemperatureC(), calculate_power_usage(), BRIGHTNESS, log_dropped);
+    if (const auto* scene = theater.currentScene()) {
+      telemetry.setQuality(scene->quality_knobs().total(), scene->quality_knobs().maxTotal());
+      const std::string status = scene->status();
+      telemetry.setStatus(status.empty() ? "(empty)" : status.c_str());
+    } else {
+      telemetry.setStatus("(No Scene)");
     }
   }
-  
-  Serial.printf("--> mode:%d (%s) @ %d FPS <--\n", 
-    scene_number,
-    scene_name.c_str(),
-    FastLED.getFPS() 
-  );
-
-  // Print the fetched scene status
-  Serial.printf("Status: %s\n", scene_status.c_str());
 
-  Serial.printf("Est Power: %0.1f W (%.1f%% brightness)\n", 
-    calculate_power_usage()/1000.0,
-    (BRIGHTNESS/ 255.0f) * 100);
-    
-  BENCHMARK_REPORT(FastLED.getFPS());
+  uint8_t packet[PixelTheater::Telemetry::MAX_PACKET];
+  const size_t len = telemetry.next(now, packet, sizeof(packet));
+  if (len > 0) Serial.write(packet, len);
 }
 
 void fadeInSide(int side, int start_led, int end_led, int duration_ms) {
@@ -116,7 +152,7 @@ void fadeInSide(int side, int start_led, int end_led, int duration_ms) {
             leds[index] = side_color;
             leds[index].fadeToBlackBy(255 - brightness);
         }
-        FastLED.show();
+        theater.platform()->show();  // Through the output map
         delay(duration_ms);  // Adjust delay to complete fade-in within the specified duration
     }
 }
@@ -153,10 +189,25 @@ void setup() {
   pinMode(ANALOG_PIN_B, INPUT);
   pinMode(USER_BUTTON, INPUT_PULLUP);
 
-  // set up fastled - two strips on two pins
+  // Initialize Theater with FastLED platform and specific model; the faces
+  // decide how LEDs are split between the pins
+  theater.useFastLEDPlatform<PixelTheater::Models::DodecaRGBv2>(
+    leds,
+    NUM_LEDS
+  );
+  if (!output_map.splitByFace(*theater.model(), OutputPins::count) ||
+      output_map.bufferSize() > sizeof(output_leds) / sizeof(output_leds[0])) {
+    Serial.println("LED output map does not fit; splitting evenly");
+    output_map.splitEvenly(NUM_LEDS, OutputPins::count);
+  }
+  Serial.printf("LED output: %u channels, longest %u LEDs\n",
+    (unsigned)output_map.channels(), (unsigned)output_map.stride());
+
+  // set up fastled - one strip per pin
   // see https://github.com/FastLED/FastLED/wiki/Parallel-Output#parallel-output-on-the-teensy-4
-  FastLED.addLeds<WS2812, LED_CHANNEL_1_PIN, GRB>(leds, NUM_LEDS/2);
-  FastLED.addLeds<WS2812, LED_CHANNEL_2_PIN, GRB>(leds, NUM_LEDS/2, NUM_LEDS/2);
+  OutputPins::addLeds(output_leds, output_map);
+  static_cast<PixelTheater::FastLEDPlatform*>(theater.platform())->setOutput(
+    &output_map, reinterpret_cast<PixelTheater::CRGB*>(output_leds));
   FastLED.setBrightness(BRIGHTNESS);
   FastLED.setDither(0);
   FastLED.setMaxRefreshRate(90);
@@ -172,45 +223,34 @@ void setup() {
   // Initialize PixelTheater Theater
   Serial.println("Initializing PixelTheater Theater...");
   Benchmark::enabled = true;  
+  const auto& timer = PixelTheater::CycleCounter::calibrate(); // Before the first frame is timed
+  Serial.printf("Profiler timer: %s, %.2f ns/tick, overhead %.1f ns\n",
+    timer.source, timer.ns_per_tick, timer.overhead_ns());
 
-  // Initialize Theater with FastLED platform and specific model
-  theater.useFastLEDPlatform<PixelTheater::Models::DodecaRGBv2>(
-    leds,
-    NUM_LEDS
-  );
-  
-  // Add scenes 
-  //theater.addScene<Scenes::TestScene>(); // Add Test Scene first
-  theater.addScene<Scenes::SparklesScene>(); // UPDATED
-  theater.addScene<Scenes::SatellitesScene>(); // <<< ADDED Satellites Scene
-  theater.addScene<Scenes::WanderingParticlesScene>(); // Add Wandering Particles
-  theater.addScene<Scenes::TextureMapScene>(); // TextureMapScene moved to Scenes namespace
-  theater.addScene<Scenes::OrientationGridScene>(); // ADDED
-  theater.addScene<Scenes::BlobScene>(); 
-  theater.addScene<Scenes::XYZScannerScene>(); 
-  theater.addScene<Scenes::BoidsScene>(); // Add Boids Scene
-  theater.addScene<Scenes::GeographyScene>(); // Add the new scene instance
+  // Register scenes; none is constructed until it is shown
+  Scenes::StreamReceiverScene::setSource(&usbStream);
+  theater.useSceneList<FirmwareScenes, RESIDENT_SCENES>();
+  theater.qualityGovernor().setTarget(SCENE_BUDGET_US);
+  Serial.printf("Scene storage: %u bytes static for %u scenes (%u bytes if all were resident)\n",
+    (unsigned)theater.sceneStorageBytes(), (unsigned)FirmwareScenes::count,
+    (unsigned)FirmwareScenes::total_size);
   
   // Start the theater 
   theater.start();
 
   Serial.println("Init done");
 
-  FastLED.clear();
-  FastLED.show();
+  theater.platform()->clear();
+  theater.platform()->show();
 
   delay(100);
 }
 
-long interval, last_interval = 0;
-const long max_interval = 3000;
-
 void updateOnboardLED() {
     static uint8_t led_brightness = 0;
     static uint32_t last_update = 0;
     const uint32_t update_interval = 16;  // ~60Hz updates
     
-    interval = millis()/max_interval;
     if (millis() - last_update >= update_interval) {
         // Create smooth sine wave breathing (4 second cycle)
         float breath = (sin(millis() * PI / 2000.0) + 1.0) / 2.0;
@@ -221,16 +261,12 @@ void updateOnboardLED() {
 }
 
 void loop() {  
+  static uint32_t last_loop_us = micros();
   updateOnboardLED();  
   
-  // Check interval timer *before* update, but log *after*
-  bool log_status_this_frame = (interval != last_interval);
-  if (log_status_this_frame) {
-    last_interval = interval;
-  }
-  
   // handle button press for mode change
   if (digitalRead(USER_BUTTON) == LOW){
+    theater.prewarmNext(); // Idle time: do the next scene's setup() now
     while (digitalRead(USER_BUTTON) == LOW){
       ::CRGB c = ::CRGB::White;
       c.setHSV(millis()/500 % 255, 255, 64);
@@ -243,9 +279,8 @@ void loop() {
     Serial.printf("Button pressed, advancing scene...\n");
     BENCHMARK_RESET();
     theater.nextScene(); // Use Theater to switch scene
-    // Immediately log status after scene change
-    timerStatusMessage(); 
-    log_status_this_frame = false; // Don't log again immediately
+    Serial.printf("Scene switch: %u us (max %u us)\n",
+      (unsigned)theater.switchStats().last_us, (unsigned)theater.switchStats().max_us);
   }
 
   // Update the Theater (calls current scene's tick() and platform->show())
@@ -253,8 +288,15 @@ void loop() {
   theater.update();
   BENCHMARK_END();
 
-  // Log status *after* the update, if the interval passed
-  if (log_status_this_frame) {
-    timerStatusMessage();
-  }
+  // Frame time is loop to loop, so it includes show() and everything below
+  const uint32_t now_us = micros();
+  sendTelemetry(now_us - last_loop_us);
+  last_loop_us = now_us;
+
+#ifdef PIXELTHEATER_LOG_DEFERRED
+  // Scene logs were queued raw during update(); format a few per frame here
+  PixelTheater::Log::deferred().drain([](PixelTheater::Log::Level level, uint32_t, const char* text) {
+    Serial.printf("[%s] %s\n", PixelTheater::Log::levelName(level), text);
+  }, 8);
+#endif
 }
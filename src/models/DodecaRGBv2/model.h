@@ -2,10 +2,13 @@
 #include "PixelTheater/model_def.h"
 #include "PixelTheater/model/face_type.h"
 
-// Generated on: 2025-04-25 03:21:38
-// Generated using: generate_model.py -d src/models/DodecaRGBv2 -y
+// Generated on: 2026-10-18 21:30:40
+// Generated using: model_compiler -d src/models/DodecaRGBv2
 // Model source: https://somebox.com/projects/
 // Author: Jeremy Seitz, https://github.com/somebox
+//
+// Points, faces, neighbours and LED groups are a ModelBlob (PixelTheater/model/model_blob.h),
+// the same bytes as model.bin. Regenerate with util/model_compiler; do not edit.
 
 namespace PixelTheater {
 namespace Models {
@@ -18,5133 +21,2145 @@ struct DodecaRGBv2 : public ModelDefinition<1248, 12> {
     static constexpr const char* VERSION = "2.0.0";
     static constexpr const char* DESCRIPTION = "Dodecahedron with 12 pentagon PCBs, 1248 LEDs";
     static constexpr const char* MODEL_TYPE = "Dodecahedron";
-    static constexpr const char* GENERATED_DATE = "2025-04-25 03:21:38";
+    static constexpr const char* GENERATED_DATE = "2026-10-18 21:30:40";
 
     static constexpr size_t LED_COUNT = 1248;
     static constexpr size_t FACE_COUNT = 12;
     static constexpr float SPHERE_RADIUS = 312.257f;
 
-    // Face type definitions with vertex geometry
-    static constexpr std::array<FaceTypeData, 1> FACE_TYPES{{
-        {
-            .id = 0,
-            .type = FaceType::Pentagon,
-            .num_leds = 104,
-            .edge_length_mm = 60.0f
-        }
-    }};
-
-    // Face instances with transformed vertices
-    static constexpr std::array<FaceData, FACE_COUNT> FACES{{
-        {.id = 0, .type_id = 0, .rotation = 1,
-            .vertices = {
-                {.x = -200.000f, .y = 0.000f, .z = 262.000f},
-                {.x = -61.803f, .y = -190.211f, .z = 262.000f},
-                {.x = 161.803f, .y = -117.557f, .z = 262.000f},
-                {.x = 161.803f, .y = 117.557f, .z = 262.000f},
-                {.x = -61.803f, .y = 190.211f, .z = 262.000f}
-            }
-        },
-        {.id = 1, .type_id = 0, .rotation = 2,
-            .vertices = {
-                {.x = -99.947f, .y = -307.933f, .z = 61.904f},
-                {.x = 100.055f, .y = -307.938f, .z = -61.700f},
-                {.x = 261.857f, .y = -190.376f, .z = 61.904f},
-                {.x = 161.854f, .y = -117.712f, .z = 261.899f},
-                {.x = -61.753f, .y = -190.366f, .z = 261.899f}
-            }
-        },
-        {.id = 2, .type_id = 0, .rotation = 1,
-            .vertices = {
-                {.x = 323.786f, .y = -0.000f, .z = -61.700f},
-                {.x = 261.976f, .y = 190.211f, .z = 61.904f},
-                {.x = 161.966f, .y = 117.557f, .z = 261.899f},
-                {.x = 161.966f, .y = -117.557f, .z = 261.899f},
-                {.x = 261.976f, .y = -190.211f, .z = 61.904f}
-            }
-        },
-        {.id = 3, .type_id = 0, .rotation = 3,
-            .vertices = {
-                {.x = 100.055f, .y = 307.938f, .z = -61.700f},
-                {.x = -99.947f, .y = 307.933f, .z = 61.904f},
-                {.x = -61.753f, .y = 190.366f, .z = 261.899f},
-                {.x = 161.854f, .y = 117.712f, .z = 261.899f},
-                {.x = 261.857f, .y = 190.376f, .z = 61.904f}
-            }
-        },
-        {.id = 4, .type_id = 0, .rotation = 2,
-            .vertices = {
-                {.x = -261.948f, .y = 190.316f, .z = -61.700f},
-                {.x = -323.747f, .y = 0.102f, .z = 61.904f},
-                {.x = -200.132f, .y = 0.096f, .z = 261.899f},
-                {.x = -61.935f, .y = 190.307f, .z = 261.899f},
-                {.x = -100.140f, .y = 307.870f, .z = 61.904f}
-            }
-        },
-        {.id = 5, .type_id = 0, .rotation = 1,
-            .vertices = {
-                {.x = -261.948f, .y = -190.316f, .z = -61.700f},
-                {.x = -100.140f, .y = -307.870f, .z = 61.904f},
-                {.x = -61.935f, .y = -190.307f, .z = 261.899f},
-                {.x = -200.132f, .y = -0.096f, .z = 261.899f},
-                {.x = -323.747f, .y = -0.102f, .z = 61.904f}
-            }
-        },
-        {.id = 6, .type_id = 0, .rotation = 2,
-            .vertices = {
-                {.x = -261.976f, .y = 190.211f, .z = -61.904f},
-                {.x = -161.966f, .y = 117.557f, .z = -261.899f},
-                {.x = -161.966f, .y = -117.557f, .z = -261.899f},
-                {.x = -261.976f, .y = -190.211f, .z = -61.904f},
-                {.x = -323.786f, .y = 0.000f, .z = 61.700f}
-            }
-        },
-        {.id = 7, .type_id = 0, .rotation = 3,
-            .vertices = {
-                {.x = -261.857f, .y = -190.376f, .z = -61.904f},
-                {.x = -161.854f, .y = -117.712f, .z = -261.899f},
-                {.x = 61.753f, .y = -190.366f, .z = -261.899f},
-                {.x = 99.947f, .y = -307.933f, .z = -61.904f},
-                {.x = -100.055f, .y = -307.938f, .z = 61.700f}
-            }
-        },
-        {.id = 8, .type_id = 0, .rotation = 1,
-            .vertices = {
-                {.x = 100.140f, .y = -307.870f, .z = -61.904f},
-                {.x = 61.935f, .y = -190.307f, .z = -261.899f},
-                {.x = 200.132f, .y = -0.096f, .z = -261.899f},
-                {.x = 323.747f, .y = -0.102f, .z = -61.904f},
-                {.x = 261.948f, .y = -190.316f, .z = 61.700f}
-            }
-        },
-        {.id = 9, .type_id = 0, .rotation = 2,
-            .vertices = {
-                {.x = 323.747f, .y = 0.102f, .z = -61.904f},
-                {.x = 200.132f, .y = 0.096f, .z = -261.899f},
-                {.x = 61.935f, .y = 190.307f, .z = -261.899f},
-                {.x = 100.140f, .y = 307.870f, .z = -61.904f},
-                {.x = 261.948f, .y = 190.316f, .z = 61.700f}
-            }
-        },
-        {.id = 10, .type_id = 0, .rotation = 1,
-            .vertices = {
-                {.x = 99.947f, .y = 307.933f, .z = -61.904f},
-                {.x = 61.753f, .y = 190.366f, .z = -261.899f},
-                {.x = -161.854f, .y = 117.712f, .z = -261.899f},
-                {.x = -261.857f, .y = 190.376f, .z = -61.904f},
-                {.x = -100.055f, .y = 307.938f, .z = 61.700f}
-            }
-        },
-        {.id = 11, .type_id = 0, .rotation = 3,
-            .vertices = {
-                {.x = 200.000f, .y = -0.000f, .z = -262.000f},
-                {.x = 61.803f, .y = -190.211f, .z = -262.000f},
-                {.x = -161.803f, .y = -117.557f, .z = -262.000f},
-                {.x = -161.803f, .y = 117.557f, .z = -262.000f},
-                {.x = 61.803f, .y = 190.211f, .z = -262.000f}
-            }
-        }
-    }};
-
-    // Point geometry - define all points with correct face assignments
-    static constexpr PointData POINTS[] = {
-        {0, 0, -1.427f, -0.442f, 262.000f},
-        {1, 0, 19.145f, -15.093f, 262.000f},
-        {2, 0, -10.095f, -24.594f, 262.000f},
-        {3, 0, -27.073f, 0.160f, 262.000f},
-        {4, 0, -9.702f, 25.027f, 262.000f},
-        {5, 0, 19.555f, 15.310f, 262.000f},
-        {6, 0, 52.553f, 0.581f, 262.000f},
-        {7, 0, 42.184f, -31.000f, 262.000f},
-        {8, 0, 15.984f, -51.859f, 262.000f},
-        {9, 0, -18.540f, -51.434f, 262.000f},
-        {10, 0, -45.086f, -32.064f, 262.000f},
-        {11, 0, -55.010f, -0.687f, 262.000f},
-        {12, 0, -45.038f, 32.120f, 262.000f},
-        {13, 0, -17.167f, 52.168f, 262.000f},
-        {14, 0, 15.304f, 51.726f, 262.000f},
-        {15, 0, 43.085f, 31.890f, 262.000f},
-        {16, 0, 78.023f, 26.023f, 262.000f},
-        {17, 0, 81.652f, -6.480f, 262.000f},
-        {18, 0, 72.556f, -37.648f, 262.000f},
-        {19, 0, 53.324f, -63.120f, 262.000f},
-        {20, 0, 25.468f, -79.048f, 262.000f},
-        {21, 0, -7.655f, -82.933f, 262.000f},
-        {22, 0, -38.887f, -73.641f, 262.000f},
-        {23, 0, -64.502f, -53.968f, 262.000f},
-        {24, 0, -80.056f, -26.098f, 262.000f},
-        {25, 0, -84.746f, 6.168f, 262.000f},
-        {26, 0, -75.155f, 38.146f, 262.000f},
-        {27, 0, -55.028f, 63.530f, 262.000f},
-        {28, 0, -26.651f, 79.357f, 262.000f},
-        {29, 0, 4.404f, 83.274f, 262.000f},
-        {30, 0, 36.501f, 74.317f, 262.000f},
-        {31, 0, 62.324f, 54.007f, 262.000f},
-        {32, 0, 99.068f, 50.080f, 262.000f},
-        {33, 0, 109.174f, 18.978f, 262.000f},
-        {34, 0, 110.163f, -13.732f, 262.000f},
-        {35, 0, 101.878f, -43.228f, 262.000f},
-        {36, 0, 85.971f, -70.436f, 262.000f},
-        {37, 0, 61.551f, -92.774f, 262.000f},
-        {38, 0, 33.569f, -105.982f, 262.000f},
-        {39, 0, 1.845f, -112.174f, 262.000f},
-        {40, 0, -30.355f, -108.232f, 262.000f},
-        {41, 0, -59.331f, -95.716f, 262.000f},
-        {42, 0, -83.719f, -75.320f, 262.000f},
-        {43, 0, -101.683f, -49.533f, 262.000f},
-        {44, 0, -111.677f, -18.774f, 262.000f},
-        {45, 0, -112.495f, 12.909f, 262.000f},
-        {46, 0, -103.873f, 43.869f, 262.000f},
-        {47, 0, -87.933f, 71.141f, 262.000f},
-        {48, 0, -64.008f, 92.669f, 262.000f},
-        {49, 0, -36.184f, 106.529f, 262.000f},
-        {50, 0, -4.890f, 111.878f, 262.000f},
-        {51, 0, 26.483f, 108.317f, 262.000f},
-        {52, 0, 56.601f, 96.118f, 262.000f},
-        {53, 0, 81.056f, 75.852f, 262.000f},
-        {54, 0, 120.847f, 59.215f, 262.000f},
-        {55, 0, 143.809f, 29.041f, 262.000f},
-        {56, 0, 143.262f, -0.107f, 262.000f},
-        {57, 0, 143.781f, -28.368f, 262.000f},
-        {58, 0, 120.177f, -59.051f, 262.000f},
-        {59, 0, 143.724f, -57.357f, 262.000f},
-        {60, 0, 117.689f, -86.393f, 262.000f},
-        {61, 0, 143.507f, -85.856f, 262.000f},
-        {62, 0, 125.726f, -111.127f, 262.000f},
-        {63, 0, 92.592f, -97.147f, 262.000f},
-        {64, 0, 97.483f, -120.033f, 262.000f},
-        {65, 0, 70.379f, -129.111f, 262.000f},
-        {66, 0, 43.606f, -137.539f, 262.000f},
-        {67, 0, 16.178f, -146.451f, 262.000f},
-        {68, 0, -11.496f, -155.443f, 262.000f},
-        {69, 0, -19.961f, -133.555f, 262.000f},
-        {70, 0, -38.189f, -164.116f, 262.000f},
-        {71, 0, -46.134f, -140.164f, 262.000f},
-        {72, 0, -67.919f, -154.281f, 262.000f},
-        {73, 0, -65.210f, -119.287f, 262.000f},
-        {74, 0, -84.521f, -131.518f, 262.000f},
-        {75, 0, -101.282f, -108.264f, 262.000f},
-        {76, 0, -118.288f, -85.090f, 262.000f},
-        {77, 0, -135.049f, -61.836f, 262.000f},
-        {78, 0, -152.134f, -38.417f, 262.000f},
-        {79, 0, -134.924f, -23.890f, 262.000f},
-        {80, 0, -169.220f, -14.998f, 262.000f},
-        {81, 0, -148.421f, 0.153f, 262.000f},
-        {82, 0, -168.906f, 15.699f, 262.000f},
-        {83, 0, -134.565f, 23.337f, 262.000f},
-        {84, 0, -152.037f, 38.779f, 262.000f},
-        {85, 0, -135.200f, 61.956f, 262.000f},
-        {86, 0, -118.379f, 85.183f, 262.000f},
-        {87, 0, -101.921f, 107.859f, 262.000f},
-        {88, 0, -84.557f, 131.912f, 262.000f},
-        {89, 0, -64.538f, 119.464f, 262.000f},
-        {90, 0, -67.443f, 155.071f, 262.000f},
-        {91, 0, -46.953f, 140.340f, 262.000f},
-        {92, 0, -38.300f, 164.540f, 262.000f},
-        {93, 0, -20.046f, 134.191f, 262.000f},
-        {94, 0, -11.577f, 155.624f, 262.000f},
-        {95, 0, 15.881f, 146.947f, 262.000f},
-        {96, 0, 43.173f, 137.945f, 262.000f},
-        {97, 0, 70.709f, 128.860f, 262.000f},
-        {98, 0, 97.923f, 120.266f, 262.000f},
-        {99, 0, 92.540f, 97.669f, 262.000f},
-        {100, 0, 125.822f, 111.732f, 262.000f},
-        {101, 0, 117.702f, 86.892f, 262.000f},
-        {102, 0, 143.514f, 86.615f, 262.000f},
-        {103, 0, 143.615f, 57.136f, 262.000f},
-        {104, 1, 71.372f, -223.609f, 116.411f},
-        {105, 1, 95.332f, -219.386f, 109.635f},
-        {106, 1, 74.174f, -234.760f, 93.471f},
-        {107, 1, 49.014f, -234.331f, 109.835f},
-        {108, 1, 53.407f, -219.257f, 135.789f},
-        {109, 1, 82.754f, -209.816f, 135.610f},
-        {110, 1, 117.456f, -200.332f, 132.201f},
-        {111, 1, 121.953f, -214.504f, 102.471f},
-        {112, 1, 108.246f, -232.094f, 77.486f},
-        {113, 1, 78.313f, -246.647f, 68.306f},
-        {114, 1, 47.196f, -251.951f, 77.446f},
-        {115, 1, 25.298f, -246.475f, 101.393f},
-        {116, 1, 19.938f, -232.095f, 132.055f},
-        {117, 1, 35.430f, -214.044f, 156.812f},
-        {118, 1, 63.601f, -200.369f, 165.411f},
-        {119, 1, 95.979f, -194.684f, 156.216f},
-        {120, 1, 128.585f, -181.637f, 160.881f},
-        {121, 1, 145.537f, -190.138f, 134.237f},
-        {122, 1, 150.955f, -203.640f, 105.211f},
-        {123, 1, 145.215f, -219.692f, 78.228f},
-        {124, 1, 127.983f, -236.463f, 56.980f},
-        {125, 1, 101.090f, -251.752f, 44.520f},
-        {126, 1, 70.223f, -262.164f, 43.792f},
-        {127, 1, 39.780f, -266.980f, 53.447f},
-        {128, 1, 14.522f, -264.982f, 72.855f},
-        {129, 1, -3.244f, -257.005f, 99.005f},
-        {130, 1, -8.580f, -243.042f, 128.858f},
-        {131, 1, -2.031f, -226.636f, 156.013f},
-        {132, 1, 15.692f, -209.675f, 177.318f},
-        {133, 1, 40.789f, -195.256f, 189.234f},
-        {134, 1, 72.260f, -184.372f, 190.486f},
-        {135, 1, 103.152f, -179.665f, 180.347f},
-        {136, 1, 136.489f, -165.250f, 187.162f},
-        {137, 1, 158.427f, -170.564f, 163.499f},
-        {138, 1, 173.192f, -180.252f, 135.948f},
-        {139, 1, 178.598f, -192.893f, 108.568f},
-        {140, 1, 176.462f, -208.067f, 81.028f},
-        {141, 1, 164.919f, -225.357f, 55.277f},
-        {142, 1, 146.421f, -241.341f, 36.308f},
-        {143, 1, 121.715f, -256.748f, 22.273f},
-        {144, 1, 92.289f, -269.226f, 16.726f},
-        {145, 1, 61.994f, -277.683f, 19.364f},
-        {146, 1, 32.300f, -281.752f, 29.973f},
-        {147, 1, 5.851f, -281.423f, 46.943f},
-        {148, 1, -15.845f, -276.168f, 70.346f},
-        {149, 1, -30.026f, -266.724f, 97.070f},
-        {150, 1, -35.763f, -253.488f, 125.789f},
-        {151, 1, -33.626f, -238.280f, 153.393f},
-        {152, 1, -22.165f, -221.450f, 178.317f},
-        {153, 1, -4.081f, -205.332f, 197.798f},
-        {154, 1, 20.613f, -190.368f, 210.996f},
-        {155, 1, 49.165f, -178.125f, 216.639f},
-        {156, 1, 80.309f, -169.085f, 214.586f},
-        {157, 1, 110.004f, -164.947f, 204.106f},
-        {158, 1, 151.373f, -153.164f, 200.951f},
-        {159, 1, 183.996f, -152.722f, 181.631f},
-        {160, 1, 195.922f, -161.963f, 156.686f},
-        {161, 1, 208.389f, -170.477f, 132.790f},
-        {162, 1, 201.098f, -189.999f, 100.166f},
-        {163, 1, 220.670f, -179.460f, 108.115f},
-        {164, 1, 210.584f, -199.507f, 76.221f},
-        {165, 1, 232.605f, -188.360f, 83.813f},
-        {166, 1, 228.031f, -203.734f, 57.402f},
-        {167, 1, 193.529f, -213.506f, 60.137f},
-        {168, 1, 207.479f, -218.499f, 42.021f},
-        {169, 1, 187.982f, -232.832f, 26.808f},
-        {170, 1, 168.494f, -246.825f, 12.239f},
-        {171, 1, 148.646f, -261.246f, -2.923f},
-        {172, 1, 128.622f, -275.795f, -18.220f},
-        {173, 1, 112.017f, -272.631f, -1.941f},
-        {174, 1, 109.306f, -289.830f, -32.976f},
-        {175, 1, 92.272f, -285.806f, -14.797f},
-        {176, 1, 79.503f, -299.435f, -32.827f},
-        {177, 1, 66.953f, -287.468f, -2.311f},
-        {178, 1, 55.513f, -299.461f, -18.052f},
-        {179, 1, 31.178f, -299.404f, -2.904f},
-        {180, 1, 6.665f, -299.475f, 12.108f},
-        {181, 1, -17.670f, -299.417f, 27.256f},
-        {182, 1, -42.356f, -299.447f, 42.455f},
-        {183, 1, -33.702f, -287.637f, 59.568f},
-        {184, 1, -67.041f, -299.476f, 57.653f},
-        {185, 1, -55.561f, -285.947f, 76.290f},
-        {186, 1, -79.827f, -289.855f, 83.852f},
-        {187, 1, -53.481f, -272.888f, 99.840f},
-        {188, 1, -75.106f, -275.547f, 108.147f},
-        {189, 1, -70.455f, -261.223f, 132.516f},
-        {190, 1, -65.838f, -246.890f, 156.922f},
-        {191, 1, -61.299f, -232.882f, 180.760f},
-        {192, 1, -56.565f, -218.062f, 206.019f},
-        {193, 1, -34.018f, -213.394f, 200.964f},
-        {194, 1, -51.667f, -203.625f, 230.449f},
-        {195, 1, -27.742f, -199.463f, 223.581f},
-        {196, 1, -30.579f, -188.303f, 246.559f},
-        {197, 1, -1.939f, -189.919f, 225.788f},
-        {198, 1, -3.757f, -179.693f, 246.360f},
-        {199, 1, 23.597f, -170.696f, 246.568f},
-        {200, 1, 50.946f, -161.869f, 246.454f},
-        {201, 1, 78.541f, -152.965f, 246.337f},
-        {202, 1, 105.650f, -144.045f, 246.548f},
-        {203, 1, 110.622f, -153.319f, 225.839f},
-        {204, 1, 133.323f, -134.817f, 247.000f},
-        {205, 1, 136.890f, -145.947f, 223.626f},
-        {206, 1, 159.252f, -135.054f, 230.524f},
-        {207, 1, 171.879f, -144.122f, 205.477f},
-        {208, 2, 234.972f, 0.442f, 115.905f},
-        {209, 2, 225.771f, 15.093f, 134.305f},
-        {210, 2, 238.849f, 24.594f, 108.152f},
-        {211, 2, 246.443f, -0.160f, 92.967f},
-        {212, 2, 238.674f, -25.027f, 108.504f},
-        {213, 2, 225.588f, -15.310f, 134.672f},
-        {214, 2, 210.829f, -0.581f, 164.185f},
-        {215, 2, 215.467f, 31.000f, 154.911f},
-        {216, 2, 227.185f, 51.859f, 131.477f},
-        {217, 2, 242.626f, 51.434f, 100.599f},
-        {218, 2, 254.499f, 32.064f, 76.856f},
-        {219, 2, 258.938f, 0.687f, 67.980f},
-        {220, 2, 254.478f, -32.120f, 76.899f},
-        {221, 2, 242.012f, -52.168f, 101.827f},
-        {222, 2, 227.489f, -51.726f, 130.870f},
-        {223, 2, 215.064f, -31.890f, 155.716f},
-        {224, 2, 199.438f, -26.023f, 186.965f},
-        {225, 2, 197.815f, 6.480f, 190.212f},
-        {226, 2, 201.883f, 37.648f, 182.076f},
-        {227, 2, 210.485f, 63.120f, 164.875f},
-        {228, 2, 222.944f, 79.048f, 139.960f},
-        {229, 2, 237.758f, 82.933f, 110.334f},
-        {230, 2, 251.727f, 73.641f, 82.401f},
-        {231, 2, 263.183f, 53.968f, 59.490f},
-        {232, 2, 270.140f, 26.098f, 45.579f},
-        {233, 2, 272.237f, -6.168f, 41.384f},
-        {234, 2, 267.948f, -38.146f, 49.963f},
-        {235, 2, 258.946f, -63.530f, 67.964f},
-        {236, 2, 246.254f, -79.357f, 93.345f},
-        {237, 2, 232.364f, -83.274f, 121.120f},
-        {238, 2, 218.009f, -74.317f, 149.828f},
-        {239, 2, 206.460f, -54.007f, 172.924f},
-        {240, 2, 190.025f, -50.080f, 205.788f},
-        {241, 2, 185.506f, -18.978f, 214.827f},
-        {242, 2, 185.063f, 13.732f, 215.712f},
-        {243, 2, 188.769f, 43.228f, 208.301f},
-        {244, 2, 195.883f, 70.436f, 194.074f},
-        {245, 2, 206.805f, 92.774f, 172.233f},
-        {246, 2, 219.320f, 105.982f, 147.206f},
-        {247, 2, 233.509f, 112.174f, 118.832f},
-        {248, 2, 247.911f, 108.232f, 90.032f},
-        {249, 2, 260.870f, 95.716f, 64.116f},
-        {250, 2, 271.778f, 75.320f, 42.302f},
-        {251, 2, 279.813f, 49.533f, 26.236f},
-        {252, 2, 284.283f, 18.774f, 17.297f},
-        {253, 2, 284.648f, -12.909f, 16.565f},
-        {254, 2, 280.792f, -43.869f, 24.277f},
-        {255, 2, 273.663f, -71.141f, 38.534f},
-        {256, 2, 262.962f, -92.669f, 59.932f},
-        {257, 2, 250.518f, -106.529f, 84.818f},
-        {258, 2, 236.521f, -111.878f, 112.808f},
-        {259, 2, 222.490f, -108.317f, 140.868f},
-        {260, 2, 209.019f, -96.118f, 167.806f},
-        {261, 2, 198.081f, -75.852f, 189.678f},
-        {262, 2, 180.285f, -59.215f, 225.267f},
-        {263, 2, 170.014f, -29.041f, 245.805f},
-        {264, 2, 170.259f, 0.107f, 245.316f},
-        {265, 2, 170.027f, 28.368f, 245.780f},
-        {266, 2, 180.584f, 59.051f, 224.668f},
-        {267, 2, 170.053f, 57.357f, 245.728f},
-        {268, 2, 181.697f, 86.393f, 222.443f},
-        {269, 2, 170.150f, 85.856f, 245.535f},
-        {270, 2, 178.102f, 111.127f, 229.632f},
-        {271, 2, 192.922f, 97.147f, 199.996f},
-        {272, 2, 190.734f, 120.033f, 204.371f},
-        {273, 2, 202.856f, 129.111f, 180.129f},
-        {274, 2, 214.831f, 137.539f, 156.183f},
-        {275, 2, 227.099f, 146.451f, 131.651f},
-        {276, 2, 239.476f, 155.443f, 106.900f},
-        {277, 2, 243.262f, 133.555f, 99.328f},
-        {278, 2, 251.415f, 164.116f, 83.024f},
-        {279, 2, 254.968f, 140.164f, 75.918f},
-        {280, 2, 264.711f, 154.281f, 56.435f},
-        {281, 2, 263.500f, 119.287f, 58.857f},
-        {282, 2, 272.137f, 131.518f, 41.586f},
-        {283, 2, 279.633f, 108.264f, 26.595f},
-        {284, 2, 287.239f, 85.090f, 11.384f},
-        {285, 2, 294.736f, 61.836f, -3.607f},
-        {286, 2, 302.377f, 38.417f, -18.888f},
-        {287, 2, 294.680f, 23.890f, -3.495f},
-        {288, 2, 310.019f, 14.998f, -34.170f},
-        {289, 2, 300.717f, -0.153f, -15.568f},
-        {290, 2, 309.878f, -15.699f, -33.889f},
-        {291, 2, 294.519f, -23.337f, -3.174f},
-        {292, 2, 302.334f, -38.779f, -18.801f},
-        {293, 2, 294.803f, -61.956f, -3.742f},
-        {294, 2, 287.280f, -85.183f, 11.302f},
-        {295, 2, 279.919f, -107.859f, 26.023f},
-        {296, 2, 272.153f, -131.912f, 41.554f},
-        {297, 2, 263.199f, -119.464f, 59.459f},
-        {298, 2, 264.499f, -155.071f, 56.860f},
-        {299, 2, 255.334f, -140.340f, 75.186f},
-        {300, 2, 251.464f, -164.540f, 82.925f},
-        {301, 2, 243.300f, -134.191f, 99.252f},
-        {302, 2, 239.512f, -155.624f, 106.827f},
-        {303, 2, 227.231f, -146.947f, 131.385f},
-        {304, 2, 215.025f, -137.945f, 155.796f},
-        {305, 2, 202.709f, -128.860f, 180.424f},
-        {306, 2, 190.537f, -120.266f, 204.765f},
-        {307, 2, 192.945f, -97.669f, 199.950f},
-        {308, 2, 178.059f, -111.732f, 229.717f},
-        {309, 2, 181.691f, -86.892f, 222.455f},
-        {310, 2, 170.147f, -86.615f, 245.541f},
-        {311, 2, 170.101f, -57.136f, 245.632f},
-        {312, 3, 72.190f, 223.609f, 115.905f},
-        {313, 3, 55.413f, 219.385f, 134.305f},
-        {314, 3, 50.419f, 234.759f, 108.152f},
-        {315, 3, 76.307f, 234.332f, 92.967f},
-        {316, 3, 97.557f, 219.258f, 108.504f},
-        {317, 3, 84.272f, 209.816f, 134.672f},
-        {318, 3, 65.703f, 200.331f, 164.185f},
-        {319, 3, 37.100f, 214.501f, 154.911f},
-        {320, 3, 20.883f, 232.092f, 131.477f},
-        {321, 3, 26.059f, 246.645f, 100.599f},
-        {322, 3, 48.150f, 251.951f, 76.856f},
-        {323, 3, 79.363f, 246.477f, 67.980f},
-        {324, 3, 109.185f, 232.097f, 76.899f},
-        {325, 3, 124.401f, 214.047f, 101.827f},
-        {326, 3, 119.492f, 200.371f, 130.870f},
-        {327, 3, 96.788f, 194.684f, 155.716f},
-        {328, 3, 86.379f, 181.635f, 186.965f},
-        {329, 3, 54.966f, 190.135f, 190.212f},
-        {330, 3, 26.580f, 203.636f, 182.076f},
-        {331, 3, 5.013f, 219.688f, 164.875f},
-        {332, 3, -6.286f, 236.459f, 139.960f},
-        {333, 3, -5.403f, 251.749f, 110.334f},
-        {334, 3, 7.751f, 262.163f, 82.401f},
-        {335, 3, 30.001f, 266.979f, 59.490f},
-        {336, 3, 58.657f, 264.983f, 45.579f},
-        {337, 3, 89.992f, 257.007f, 41.384f},
-        {338, 3, 119.079f, 243.046f, 49.963f},
-        {339, 3, 140.439f, 226.640f, 67.964f},
-        {340, 3, 151.569f, 209.679f, 93.345f},
-        {341, 3, 151.003f, 195.259f, 121.120f},
-        {342, 3, 138.048f, 184.373f, 149.828f},
-        {343, 3, 115.164f, 179.665f, 172.924f},
-        {344, 3, 106.350f, 165.249f, 205.788f},
-        {345, 3, 75.374f, 170.562f, 214.827f},
-        {346, 3, 44.128f, 180.249f, 215.712f},
-        {347, 3, 17.220f, 192.888f, 208.301f},
-        {348, 3, -6.457f, 208.062f, 194.074f},
-        {349, 3, -24.327f, 225.352f, 172.233f},
-        {350, 3, -33.021f, 241.336f, 147.206f},
-        {351, 3, -34.525f, 256.744f, 118.832f},
-        {352, 3, -26.326f, 269.223f, 90.032f},
-        {353, 3, -10.418f, 277.680f, 64.116f},
-        {354, 3, 12.351f, 281.752f, 42.302f},
-        {355, 3, 39.358f, 281.424f, 26.236f},
-        {356, 3, 69.993f, 276.170f, 17.297f},
-        {357, 3, 100.238f, 266.728f, 16.565f},
-        {358, 3, 128.491f, 253.493f, 24.277f},
-        {359, 3, 152.226f, 238.285f, 38.534f},
-        {360, 3, 169.393f, 221.456f, 59.932f},
-        {361, 3, 178.729f, 205.337f, 84.818f},
-        {362, 3, 179.491f, 190.373f, 112.808f},
-        {363, 3, 171.769f, 178.128f, 140.868f},
-        {364, 3, 156.004f, 169.087f, 167.806f},
-        {365, 3, 133.350f, 164.947f, 189.678f},
-        {366, 3, 112.027f, 153.163f, 225.267f},
-        {367, 3, 80.157f, 152.719f, 245.805f},
-        {368, 3, 52.511f, 161.959f, 245.316f},
-        {369, 3, 25.562f, 170.472f, 245.780f},
-        {370, 3, -0.357f, 189.993f, 224.668f},
-        {371, 3, -2.000f, 179.454f, 245.728f},
-        {372, 3, -26.017f, 199.501f, 222.443f},
-        {373, 3, -29.075f, 188.353f, 245.535f},
-        {374, 3, -50.652f, 203.726f, 229.632f},
-        {375, 3, -32.776f, 213.499f, 199.996f},
-        {376, 3, -55.218f, 218.491f, 204.371f},
-        {377, 3, -60.105f, 232.825f, 180.129f},
-        {378, 3, -64.421f, 246.818f, 156.183f},
-        {379, 3, -69.106f, 261.240f, 131.651f},
-        {380, 3, -73.833f, 275.789f, 106.900f},
-        {381, 3, -51.846f, 272.627f, 99.328f},
-        {382, 3, -78.392f, 289.824f, 83.024f},
-        {383, 3, -54.514f, 285.802f, 75.918f},
-        {384, 3, -64.930f, 299.431f, 56.435f},
-        {385, 3, -32.022f, 287.465f, 58.857f},
-        {386, 3, -40.986f, 299.459f, 41.586f},
-        {387, 3, -16.554f, 299.402f, 26.595f},
-        {388, 3, 7.836f, 299.475f, 11.384f},
-        {389, 3, 32.269f, 299.419f, -3.607f},
-        {390, 3, 56.903f, 299.450f, -18.888f},
-        {391, 3, 68.340f, 287.640f, -3.495f},
-        {392, 3, 81.537f, 299.480f, -34.170f},
-        {393, 3, 93.072f, 285.951f, -15.568f},
-        {394, 3, 110.688f, 289.861f, -33.889f},
-        {395, 3, 113.206f, 272.893f, -3.174f},
-        {396, 3, 130.307f, 275.553f, -18.801f},
-        {397, 3, 150.023f, 261.229f, -3.742f},
-        {398, 3, 169.788f, 246.897f, 11.302f},
-        {399, 3, 189.080f, 232.889f, 26.023f},
-        {400, 3, 209.556f, 218.070f, 41.554f},
-        {401, 3, 194.950f, 213.401f, 59.459f},
-        {402, 3, 229.216f, 203.633f, 56.860f},
-        {403, 3, 212.373f, 199.470f, 75.186f},
-        {404, 3, 234.194f, 188.311f, 82.925f},
-        {405, 3, 202.807f, 189.925f, 99.252f},
-        {406, 3, 222.021f, 179.699f, 106.827f},
-        {407, 3, 209.973f, 170.701f, 131.385f},
-        {408, 3, 197.640f, 161.873f, 155.796f},
-        {409, 3, 185.194f, 152.968f, 180.424f},
-        {410, 3, 173.259f, 144.047f, 204.765f},
-        {411, 3, 152.512f, 153.320f, 199.950f},
-        {412, 3, 161.287f, 134.817f, 229.717f},
-        {413, 3, 138.785f, 145.947f, 222.455f},
-        {414, 3, 134.954f, 135.054f, 245.541f},
-        {415, 3, 106.904f, 144.120f, 245.632f},
-        {416, 4, -190.356f, 137.756f, 115.905f},
-        {417, 4, -191.524f, 120.495f, 134.305f},
-        {418, 4, -207.689f, 120.495f, 108.152f},
-        {419, 4, -199.282f, 144.985f, 92.967f},
-        {420, 4, -178.380f, 160.536f, 108.504f},
-        {421, 4, -173.505f, 144.984f, 134.672f},
-        {422, 4, -170.223f, 124.393f, 164.185f},
-        {423, 4, -192.538f, 101.569f, 154.911f},
-        {424, 4, -214.279f, 91.581f, 131.477f},
-        {425, 4, -226.521f, 101.001f, 100.599f},
-        {426, 4, -224.741f, 123.651f, 76.856f},
-        {427, 4, -209.889f, 151.644f, 67.980f},
-        {428, 4, -186.998f, 175.564f, 76.899f},
-        {429, 4, -165.128f, 184.456f, 101.827f},
-        {430, 4, -153.639f, 175.562f, 130.870f},
-        {431, 4, -155.246f, 152.211f, 155.716f},
-        {432, 4, -146.053f, 138.279f, 186.965f},
-        {433, 4, -163.844f, 111.030f, 190.212f},
-        {434, 4, -185.455f, 88.206f, 182.076f},
-        {435, 4, -207.387f, 72.655f, 164.875f},
-        {436, 4, -226.828f, 67.092f, 139.960f},
-        {437, 4, -241.097f, 72.656f, 110.334f},
-        {438, 4, -246.936f, 88.385f, 82.401f},
-        {439, 4, -244.641f, 111.034f, 59.490f},
-        {440, 4, -233.888f, 137.670f, 45.579f},
-        {441, 4, -216.619f, 165.007f, 41.384f},
-        {442, 4, -194.353f, 188.356f, 49.963f},
-        {443, 4, -172.149f, 203.601f, 67.964f},
-        {444, 4, -152.579f, 208.945f, 93.345f},
-        {445, 4, -139.040f, 203.950f, 121.120f},
-        {446, 4, -132.690f, 188.266f, 149.828f},
-        {447, 4, -135.284f, 165.047f, 172.924f},
-        {448, 4, -124.297f, 152.210f, 205.788f},
-        {449, 4, -138.922f, 124.391f, 214.827f},
-        {450, 4, -157.790f, 97.668f, 215.712f},
-        {451, 4, -178.126f, 75.983f, 208.301f},
-        {452, 4, -199.874f, 58.153f, 194.074f},
-        {453, 4, -221.840f, 46.501f, 172.233f},
-        {454, 4, -239.728f, 43.172f, 147.206f},
-        {455, 4, -254.847f, 46.503f, 118.832f},
-        {456, 4, -264.181f, 58.156f, 90.032f},
-        {457, 4, -267.309f, 75.900f, 64.116f},
-        {458, 4, -264.145f, 98.812f, 42.302f},
-        {459, 4, -255.488f, 124.397f, 26.236f},
-        {460, 4, -241.024f, 151.909f, 17.297f},
-        {461, 4, -222.698f, 177.756f, 16.565f},
-        {462, 4, -201.380f, 200.536f, 24.277f},
-        {463, 4, -179.582f, 218.409f, 38.534f},
-        {464, 4, -158.271f, 229.536f, 59.932f},
-        {465, 4, -140.057f, 233.434f, 84.818f},
-        {466, 4, -125.590f, 229.535f, 112.808f},
-        {467, 4, -116.331f, 218.407f, 140.868f},
-        {468, 4, -112.603f, 200.619f, 167.806f},
-        {469, 4, -115.667f, 177.795f, 189.678f},
-        {470, 4, -111.048f, 153.874f, 225.267f},
-        {471, 4, -120.475f, 123.427f, 245.805f},
-        {472, 4, -137.805f, 99.989f, 245.316f},
-        {473, 4, -154.229f, 76.990f, 245.780f},
-        {474, 4, -180.805f, 58.372f, 224.668f},
-        {475, 4, -171.289f, 53.552f, 245.728f},
-        {476, 4, -197.776f, 36.905f, 222.443f},
-        {477, 4, -188.119f, 30.553f, 245.535f},
-        {478, 4, -209.407f, 14.782f, 229.632f},
-        {479, 4, -213.178f, 34.803f, 199.996f},
-        {480, 4, -224.861f, 15.002f, 204.371f},
-        {481, 4, -240.004f, 14.783f, 180.129f},
-        {482, 4, -254.645f, 15.003f, 156.183f},
-        {483, 4, -269.808f, 15.004f, 131.651f},
-        {484, 4, -285.107f, 15.005f, 106.900f},
-        {485, 4, -275.305f, 34.938f, 99.328f},
-        {486, 4, -299.864f, 15.005f, 83.024f},
-        {487, 4, -288.660f, 36.472f, 75.918f},
-        {488, 4, -304.840f, 30.777f, 56.435f},
-        {489, 4, -283.291f, 58.376f, 58.857f},
-        {490, 4, -297.467f, 53.558f, 41.586f},
-        {491, 4, -289.864f, 76.777f, 26.595f},
-        {492, 4, -282.396f, 99.996f, 11.384f},
-        {493, 4, -274.793f, 123.215f, -3.607f},
-        {494, 4, -267.210f, 146.653f, -18.888f},
-        {495, 4, -252.443f, 153.881f, -3.495f},
-        {496, 4, -259.626f, 170.091f, -34.170f},
-        {497, 4, -243.195f, 176.881f, -15.568f},
-        {498, 4, -241.469f, 194.843f, -33.889f},
-        {499, 4, -224.554f, 191.994f, -3.174f},
-        {500, 4, -221.800f, 209.080f, -18.801f},
-        {501, 4, -202.084f, 223.405f, -3.742f},
-        {502, 4, -182.345f, 237.774f, 11.302f},
-        {503, 4, -163.062f, 251.792f, 26.023f},
-        {504, 4, -142.640f, 266.686f, 41.554f},
-        {505, 4, -142.713f, 251.353f, 59.459f},
-        {506, 4, -122.835f, 280.924f, 56.860f},
-        {507, 4, -124.080f, 263.619f, 75.186f},
-        {508, 4, -106.725f, 280.923f, 82.925f},
-        {509, 4, -117.958f, 251.571f, 99.252f},
-        {510, 4, -102.296f, 266.684f, 106.827f},
-        {511, 4, -97.461f, 252.446f, 131.385f},
-        {512, 4, -92.876f, 237.988f, 155.796f},
-        {513, 4, -88.253f, 223.400f, 180.424f},
-        {514, 4, -83.457f, 209.293f, 204.765f},
-        {515, 4, -98.687f, 192.426f, 199.950f},
-        {516, 4, -78.379f, 195.054f, 229.717f},
-        {517, 4, -95.917f, 177.093f, 222.455f},
-        {518, 4, -86.741f, 170.083f, 245.541f},
-        {519, 4, -104.031f, 146.207f, 245.632f},
-        {520, 5, -189.837f, -138.471f, 115.905f},
-        {521, 5, -173.781f, -144.915f, 134.305f},
-        {522, 5, -178.777f, -160.289f, 108.152f},
-        {523, 5, -199.470f, -144.726f, 92.967f},
-        {524, 5, -207.802f, -120.041f, 108.504f},
-        {525, 5, -191.504f, -120.211f, 134.672f},
-        {526, 5, -170.906f, -123.452f, 164.185f},
-        {527, 5, -156.095f, -151.728f, 154.911f},
-        {528, 5, -153.315f, -175.491f, 131.477f},
-        {529, 5, -166.056f, -184.223f, 100.599f},
-        {530, 5, -187.047f, -175.531f, 76.856f},
-        {531, 5, -209.082f, -152.755f, 67.980f},
-        {532, 5, -224.756f, -123.593f, 76.899f},
-        {533, 5, -226.456f, -100.046f, 101.827f},
-        {534, 5, -214.446f, -91.868f, 130.870f},
-        {535, 5, -192.735f, -100.612f, 155.716f},
-        {536, 5, -176.644f, -96.174f, 186.965f},
-        {537, 5, -156.227f, -121.515f, 190.212f},
-        {538, 5, -141.198f, -149.121f, 182.076f},
-        {539, 5, -133.185f, -174.785f, 164.875f},
-        {540, 5, -133.902f, -194.994f, 139.960f},
-        {541, 5, -143.604f, -206.845f, 110.334f},
-        {542, 5, -160.366f, -207.538f, 82.401f},
-        {543, 5, -181.198f, -198.356f, 59.490f},
-        {544, 5, -203.207f, -179.898f, 45.579f},
-        {545, 5, -223.870f, -155.027f, 41.384f},
-        {546, 5, -239.196f, -126.635f, 49.963f},
-        {547, 5, -246.833f, -100.808f, 67.964f},
-        {548, 5, -245.868f, -80.544f, 93.345f},
-        {549, 5, -236.934f, -69.211f, 121.120f},
-        {550, 5, -220.055f, -68.019f, 149.828f},
-        {551, 5, -198.774f, -77.661f, 172.924f},
-        {552, 5, -183.170f, -71.178f, 205.788f},
-        {553, 5, -161.232f, -93.683f, 214.827f},
-        {554, 5, -141.648f, -119.886f, 215.712f},
-        {555, 5, -127.308f, -145.928f, 208.301f},
-        {556, 5, -117.072f, -172.121f, 194.074f},
-        {557, 5, -112.777f, -196.613f, 172.233f},
-        {558, 5, -115.139f, -214.654f, 147.206f},
-        {559, 5, -122.979f, -228.004f, 118.832f},
-        {560, 5, -136.947f, -233.280f, 90.032f},
-        {561, 5, -154.788f, -230.772f, 64.116f},
-        {562, 5, -175.601f, -220.682f, 42.302f},
-        {563, 5, -197.258f, -204.543f, 26.236f},
-        {564, 5, -218.954f, -182.285f, 17.297f},
-        {565, 5, -237.873f, -156.869f, 16.565f},
-        {566, 5, -252.951f, -129.555f, 24.277f},
-        {567, 5, -263.214f, -103.301f, 38.534f},
-        {568, 5, -267.210f, -79.595f, 59.932f},
-        {569, 5, -265.289f, -61.067f, 84.818f},
-        {570, 5, -257.110f, -48.513f, 112.808f},
-        {571, 5, -243.665f, -43.146f, 140.868f},
-        {572, 5, -225.597f, -45.097f, 167.806f},
-        {573, 5, -204.836f, -55.064f, 189.678f},
-        {574, 5, -180.659f, -58.063f, 225.267f},
-        {575, 5, -154.614f, -76.437f, 245.805f},
-        {576, 5, -137.680f, -100.162f, 245.316f},
-        {577, 5, -120.881f, -122.889f, 245.780f},
-        {578, 5, -111.386f, -153.918f, 224.668f},
-        {579, 5, -103.862f, -146.357f, 245.728f},
-        {580, 5, -96.215f, -176.692f, 222.443f},
-        {581, 5, -87.189f, -169.470f, 245.535f},
-        {582, 5, -78.769f, -194.590f, 229.632f},
-        {583, 5, -98.976f, -191.990f, 199.996f},
-        {584, 5, -83.753f, -209.220f, 204.371f},
-        {585, 5, -88.225f, -223.689f, 180.129f},
-        {586, 5, -92.959f, -237.546f, 156.183f},
-        {587, 5, -97.645f, -251.967f, 131.651f},
-        {588, 5, -102.373f, -266.516f, 106.900f},
-        {589, 5, -118.302f, -251.034f, 99.328f},
-        {590, 5, -106.934f, -280.551f, 83.024f},
-        {591, 5, -123.887f, -263.261f, 75.918f},
-        {592, 5, -123.472f, -280.410f, 56.435f},
-        {593, 5, -143.061f, -251.386f, 58.857f},
-        {594, 5, -142.859f, -266.358f, 41.586f},
-        {595, 5, -162.592f, -251.952f, 26.595f},
-        {596, 5, -182.367f, -237.674f, 11.384f},
-        {597, 5, -202.100f, -223.268f, -3.607f},
-        {598, 5, -222.047f, -208.813f, -18.888f},
-        {599, 5, -224.359f, -192.536f, -3.495f},
-        {600, 5, -241.995f, -194.359f, -34.170f},
-        {601, 5, -243.375f, -176.633f, -15.568f},
-        {602, 5, -259.924f, -169.441f, -33.889f},
-        {603, 5, -251.988f, -154.234f, -3.174f},
-        {604, 5, -267.387f, -146.335f, -18.801f},
-        {605, 5, -274.918f, -123.157f, -3.742f},
-        {606, 5, -282.484f, -99.945f, 11.302f},
-        {607, 5, -289.857f, -77.273f, 26.023f},
-        {608, 5, -297.712f, -53.248f, 41.554f},
-        {609, 5, -283.152f, -58.056f, 59.459f},
-        {610, 5, -305.132f, -30.013f, 56.860f},
-        {611, 5, -289.059f, -36.545f, 75.186f},
-        {612, 5, -300.153f, -14.691f, 82.925f},
-        {613, 5, -275.709f, -34.445f, 99.252f},
-        {614, 5, -285.243f, -14.879f, 106.827f},
-        {615, 5, -270.207f, -14.681f, 131.385f},
-        {616, 5, -255.041f, -14.788f, 155.796f},
-        {617, 5, -239.737f, -14.899f, 180.424f},
-        {618, 5, -224.839f, -14.697f, 204.765f},
-        {619, 5, -213.504f, -34.394f, 199.950f},
-        {620, 5, -209.728f, -14.267f, 229.717f},
-        {621, 5, -198.065f, -36.498f, 222.455f},
-        {622, 5, -188.563f, -29.937f, 245.541f},
-        {623, 5, -171.199f, -53.759f, 245.632f},
-        {624, 6, -234.343f, 1.494f, -117.163f},
-        {625, 6, -225.268f, -13.544f, -135.311f},
-        {626, 6, -225.268f, 17.201f, -135.311f},
-        {627, 6, -238.144f, 25.699f, -109.563f},
-        {628, 6, -246.321f, 1.494f, -93.211f},
-        {629, 6, -238.144f, -23.329f, -109.563f},
-        {630, 6, -227.318f, -50.161f, -131.212f},
-        {631, 6, -215.318f, -30.539f, -155.210f},
-        {632, 6, -210.066f, 0.824f, -165.712f},
-        {633, 6, -215.018f, 33.527f, -155.809f},
-        {634, 6, -226.927f, 52.788f, -131.995f},
-        {635, 6, -241.645f, 52.530f, -102.561f},
-        {636, 6, -254.222f, 32.909f, -77.412f},
-        {637, 6, -258.897f, 0.206f, -68.061f},
-        {638, 6, -254.222f, -30.539f, -77.412f},
-        {639, 6, -241.945f, -50.830f, -101.963f},
-        {640, 6, -234.620f, -82.245f, -116.610f},
-        {641, 6, -220.293f, -75.653f, -145.261f},
-        {642, 6, -208.292f, -57.371f, -169.259f},
-        {643, 6, -200.115f, -31.209f, -185.611f},
-        {644, 6, -197.190f, 0.206f, -191.461f},
-        {645, 6, -200.115f, 32.909f, -185.611f},
-        {646, 6, -208.384f, 59.740f, -169.075f},
-        {647, 6, -220.293f, 78.023f, -145.261f},
-        {648, 6, -234.297f, 84.203f, -117.255f},
-        {649, 6, -248.670f, 78.692f, -88.512f},
-        {650, 6, -260.947f, 59.689f, -63.961f},
-        {651, 6, -268.963f, 32.703f, -47.932f},
-        {652, 6, -271.773f, 0.824f, -42.312f},
-        {653, 6, -269.147f, -29.921f, -47.563f},
-        {654, 6, -260.901f, -57.680f, -64.054f},
-        {655, 6, -248.693f, -75.962f, -88.466f},
-        {656, 6, -241.945f, -109.695f, -101.963f},
-        {657, 6, -227.318f, -109.695f, -131.212f},
-        {658, 6, -213.268f, -100.528f, -159.310f},
-        {659, 6, -201.866f, -83.533f, -182.110f},
-        {660, 6, -192.491f, -59.997f, -200.857f},
-        {661, 6, -186.364f, -29.870f, -213.110f},
-        {662, 6, -184.614f, 0.824f, -216.611f},
-        {663, 6, -186.364f, 32.909f, -213.110f},
-        {664, 6, -192.491f, 62.315f, -200.857f},
-        {665, 6, -201.820f, 86.005f, -182.202f},
-        {666, 6, -213.866f, 102.897f, -158.112f},
-        {667, 6, -227.318f, 112.013f, -131.212f},
-        {668, 6, -241.783f, 112.013f, -102.285f},
-        {669, 6, -255.373f, 103.000f, -75.108f},
-        {670, 6, -267.351f, 85.233f, -51.156f},
-        {671, 6, -276.749f, 61.646f, -32.363f},
-        {672, 6, -282.599f, 32.239f, -20.663f},
-        {673, 6, -284.649f, 1.494f, -16.564f},
-        {674, 6, -282.599f, -29.921f, -20.663f},
-        {675, 6, -276.749f, -58.658f, -32.363f},
-        {676, 6, -267.397f, -83.533f, -51.064f},
-        {677, 6, -255.396f, -100.528f, -75.062f},
-        {678, 6, -242.820f, -133.230f, -100.212f},
-        {679, 6, -226.811f, -145.745f, -132.225f},
-        {680, 6, -214.488f, -136.217f, -156.868f},
-        {681, 6, -202.396f, -127.977f, -181.051f},
-        {682, 6, -192.606f, -96.047f, -200.627f},
-        {683, 6, -190.073f, -118.965f, -205.694f},
-        {684, 6, -181.320f, -85.232f, -223.197f},
-        {685, 6, -177.980f, -109.952f, -229.876f},
-        {686, 6, -169.688f, -85.232f, -246.459f},
-        {687, 6, -180.214f, -58.040f, -225.408f},
-        {688, 6, -169.803f, -55.620f, -246.228f},
-        {689, 6, -169.688f, -27.037f, -246.459f},
-        {690, 6, -169.803f, 1.030f, -246.228f},
-        {691, 6, -169.803f, 29.870f, -246.228f},
-        {692, 6, -169.803f, 58.968f, -246.228f},
-        {693, 6, -180.283f, 60.255f, -225.270f},
-        {694, 6, -169.803f, 87.035f, -246.228f},
-        {695, 6, -181.089f, 87.190f, -223.658f},
-        {696, 6, -178.095f, 112.270f, -229.646f},
-        {697, 6, -192.606f, 98.880f, -200.627f},
-        {698, 6, -190.073f, 121.025f, -205.694f},
-        {699, 6, -202.280f, 129.780f, -181.281f},
-        {700, 6, -214.488f, 138.793f, -156.868f},
-        {701, 6, -226.696f, 147.548f, -132.455f},
-        {702, 6, -239.019f, 156.560f, -107.812f},
-        {703, 6, -242.820f, 135.703f, -100.212f},
-        {704, 6, -251.342f, 165.573f, -83.169f},
-        {705, 6, -254.913f, 141.110f, -76.030f},
-        {706, 6, -264.356f, 155.788f, -57.144f},
-        {707, 6, -262.859f, 120.768f, -60.138f},
-        {708, 6, -271.842f, 132.613f, -42.174f},
-        {709, 6, -279.374f, 109.438f, -27.112f},
-        {710, 6, -286.929f, 86.263f, -12.004f},
-        {711, 6, -294.300f, 63.603f, 2.736f},
-        {712, 6, -302.132f, 39.655f, 18.397f},
-        {713, 6, -294.070f, 24.463f, 2.275f},
-        {714, 6, -309.618f, 16.223f, 33.367f},
-        {715, 6, -300.519f, 1.288f, 15.173f},
-        {716, 6, -309.618f, -14.420f, 33.367f},
-        {717, 6, -294.185f, -22.402f, 2.506f},
-        {718, 6, -302.132f, -37.080f, 18.397f},
-        {719, 6, -294.646f, -60.512f, 3.427f},
-        {720, 6, -287.045f, -83.687f, -11.773f},
-        {721, 6, -279.374f, -107.068f, -27.112f},
-        {722, 6, -271.958f, -130.295f, -41.944f},
-        {723, 6, -263.090f, -118.192f, -59.678f},
-        {724, 6, -264.472f, -154.191f, -56.914f},
-        {725, 6, -255.028f, -138.792f, -75.799f},
-        {726, 6, -251.342f, -163.255f, -83.169f},
-        {727, 6, -238.789f, -154.242f, -108.273f},
-        {728, 7, -73.837f, -222.412f, -117.163f},
-        {729, 7, -56.730f, -218.428f, -135.311f},
-        {730, 7, -85.971f, -208.927f, -135.311f},
-        {731, 7, -98.031f, -218.547f, -109.563f},
-        {732, 7, -77.538f, -233.804f, -93.211f},
-        {733, 7, -51.403f, -233.698f, -109.563f},
-        {734, 7, -22.539f, -231.693f, -131.212f},
-        {735, 7, -37.492f, -214.216f, -155.210f},
-        {736, 7, -65.698f, -199.530f, -165.712f},
-        {737, 7, -98.330f, -194.134f, -155.809f},
-        {738, 7, -120.328f, -199.508f, -131.995f},
-        {739, 7, -124.631f, -213.586f, -102.561f},
-        {740, 7, -109.857f, -231.610f, -77.412f},
-        {741, 7, -80.200f, -246.162f, -68.061f},
-        {742, 7, -49.514f, -251.216f, -77.412f},
-        {743, 7, -26.422f, -245.810f, -101.963f},
-        {744, 7, 5.719f, -248.552f, -116.610f},
-        {745, 7, 3.877f, -232.889f, -145.261f},
-        {746, 7, -9.803f, -215.826f, -169.259f},
-        {747, 7, -32.158f, -199.965f, -185.611f},
-        {748, 7, -61.131f, -187.475f, -191.461f},
-        {749, 7, -93.137f, -180.152f, -185.611f},
-        {750, 7, -121.210f, -179.725f, -169.075f},
-        {751, 7, -142.278f, -185.401f, -145.261f},
-        {752, 7, -152.483f, -196.810f, -117.255f},
-        {753, 7, -151.684f, -212.182f, -88.512f},
-        {754, 7, -137.404f, -229.731f, -63.961f},
-        {755, 7, -114.216f, -245.694f, -47.932f},
-        {756, 7, -84.766f, -258.217f, -42.312f},
-        {757, 7, -54.714f, -265.221f, -47.563f},
-        {758, 7, -25.766f, -265.956f, -64.054f},
-        {759, 7, -4.606f, -259.995f, -88.466f},
-        {760, 7, 29.561f, -264.001f, -101.963f},
-        {761, 7, 34.081f, -250.090f, -131.212f},
-        {762, 7, 29.705f, -233.894f, -159.310f},
-        {763, 7, 17.065f, -217.799f, -182.110f},
-        {764, 7, -2.422f, -201.610f, -200.857f},
-        {765, 7, -29.182f, -186.473f, -213.110f},
-        {766, 7, -57.832f, -175.323f, -216.611f},
-        {767, 7, -88.888f, -167.074f, -213.110f},
-        {768, 7, -118.748f, -163.814f, -200.857f},
-        {769, 7, -144.161f, -165.365f, -182.202f},
-        {770, 7, -163.949f, -171.602f, -158.112f},
-        {771, 7, -176.775f, -181.579f, -131.212f},
-        {772, 7, -181.245f, -195.336f, -102.285f},
-        {773, 7, -176.873f, -211.046f, -75.108f},
-        {774, 7, -163.677f, -227.927f, -51.156f},
-        {775, 7, -144.148f, -244.154f, -32.363f},
-        {776, 7, -117.989f, -258.805f, -20.663f},
-        {777, 7, -89.382f, -270.256f, -16.564f},
-        {778, 7, -58.871f, -278.014f, -20.663f},
-        {779, 7, -29.732f, -281.330f, -32.363f},
-        {780, 7, -3.186f, -280.123f, -51.064f},
-        {781, 7, 16.686f, -273.961f, -75.062f},
-        {782, 7, 51.674f, -272.106f, -100.212f},
-        {783, 7, 68.523f, -260.748f, -132.225f},
-        {784, 7, 63.270f, -246.084f, -156.868f},
-        {785, 7, 59.170f, -232.037f, -181.051f},
-        {786, 7, 31.828f, -212.860f, -200.627f},
-        {787, 7, 54.407f, -217.532f, -205.694f},
-        {788, 7, 25.030f, -198.784f, -223.197f},
-        {789, 7, 49.572f, -203.246f, -229.876f},
-        {790, 7, 28.625f, -187.721f, -246.459f},
-        {791, 7, -0.489f, -189.329f, -225.408f},
-        {792, 7, 0.426f, -178.680f, -246.228f},
-        {793, 7, -26.722f, -169.738f, -246.459f},
-        {794, 7, -53.452f, -161.174f, -246.228f},
-        {795, 7, -80.880f, -152.262f, -246.228f},
-        {796, 7, -108.553f, -143.270f, -246.228f},
-        {797, 7, -113.016f, -152.840f, -225.270f},
-        {798, 7, -135.247f, -134.597f, -246.228f},
-        {799, 7, -138.882f, -145.283f, -223.658f},
-        {800, 7, -161.810f, -134.685f, -229.646f},
-        {801, 7, -153.559f, -152.624f, -200.627f},
-        {802, 7, -173.837f, -143.371f, -205.694f},
-        {803, 7, -185.936f, -152.276f, -181.281f},
-        {804, 7, -198.280f, -161.101f, -156.868f},
-        {805, 7, -210.379f, -170.006f, -132.455f},
-        {806, 7, -222.758f, -178.941f, -107.812f},
-        {807, 7, -204.096f, -189.001f, -100.212f},
-        {808, 7, -235.138f, -187.876f, -83.169f},
-        {809, 7, -212.976f, -198.831f, -76.030f},
-        {810, 7, -229.853f, -203.277f, -57.144f},
-        {811, 7, -196.085f, -212.675f, -60.138f},
-        {812, 7, -210.126f, -217.558f, -42.174f},
-        {813, 7, -190.413f, -231.883f, -27.112f},
-        {814, 7, -170.707f, -246.230f, -12.004f},
-        {815, 7, -151.433f, -260.242f, 2.736f},
-        {816, 7, -131.078f, -275.090f, 18.397f},
-        {817, 7, -114.138f, -272.118f, 2.275f},
-        {818, 7, -111.106f, -289.451f, 33.367f},
-        {819, 7, -94.090f, -285.413f, 15.173f},
-        {820, 7, -81.963f, -298.920f, 33.367f},
-        {821, 7, -69.602f, -286.709f, 2.506f},
-        {822, 7, -58.099f, -298.803f, 18.397f},
-        {823, 7, -33.500f, -298.924f, 3.427f},
-        {824, 7, -9.110f, -298.857f, -11.773f},
-        {825, 7, 15.497f, -298.787f, -27.112f},
-        {826, 7, 39.878f, -298.910f, -41.944f},
-        {827, 7, 31.109f, -286.737f, -59.678f},
-        {828, 7, 64.918f, -299.175f, -56.914f},
-        {829, 7, 53.192f, -285.435f, -75.799f},
-        {830, 7, 77.596f, -289.489f, -83.169f},
-        {831, 7, 72.903f, -274.765f, -108.273f},
-        {832, 8, 188.710f, -138.952f, -117.163f},
-        {833, 8, 190.207f, -121.452f, -135.311f},
-        {834, 8, 172.135f, -146.325f, -135.311f},
-        {835, 8, 177.557f, -160.768f, -109.563f},
-        {836, 8, 198.400f, -145.992f, -93.211f},
-        {837, 8, 206.375f, -121.104f, -109.563f},
-        {838, 8, 213.388f, -93.033f, -131.212f},
-        {839, 8, 192.146f, -101.854f, -155.210f},
-        {840, 8, 169.463f, -124.140f, -165.712f},
-        {841, 8, 154.247f, -153.508f, -155.809f},
-        {842, 8, 152.560f, -176.090f, -131.995f},
-        {843, 8, 164.619f, -184.533f, -102.561f},
-        {844, 8, 186.326f, -176.051f, -77.412f},
-        {845, 8, 209.331f, -152.343f, -68.061f},
-        {846, 8, 223.620f, -124.721f, -77.412f},
-        {847, 8, 225.615f, -101.089f, -101.963f},
-        {848, 8, 238.154f, -71.368f, -116.610f},
-        {849, 8, 222.689f, -68.280f, -145.261f},
-        {850, 8, 202.234f, -76.017f, -169.259f},
-        {851, 8, 180.241f, -92.376f, -185.611f},
-        {852, 8, 159.409f, -116.072f, -191.461f},
-        {853, 8, 142.554f, -144.248f, -185.611f},
-        {854, 8, 133.472f, -170.816f, -169.075f},
-        {855, 8, 132.360f, -192.606f, -145.261f},
-        {856, 8, 140.058f, -205.838f, -117.255f},
-        {857, 8, 154.925f, -209.828f, -88.512f},
-        {858, 8, 176.027f, -201.670f, -63.961f},
-        {859, 8, 198.374f, -184.549f, -47.932f},
-        {860, 8, 219.385f, -160.411f, -42.312f},
-        {861, 8, 235.332f, -133.994f, -47.563f},
-        {862, 8, 244.977f, -106.690f, -64.054f},
-        {863, 8, 245.847f, -84.723f, -88.466f},
-        {864, 8, 260.214f, -53.466f, -101.963f},
-        {865, 8, 248.381f, -44.869f, -131.212f},
-        {866, 8, 231.626f, -44.027f, -159.310f},
-        {867, 8, 212.412f, -51.074f, -182.110f},
-        {868, 8, 190.994f, -64.604f, -200.857f},
-        {869, 8, 168.329f, -85.377f, -213.110f},
-        {870, 8, 148.871f, -109.180f, -216.611f},
-        {871, 8, 131.429f, -136.166f, -213.110f},
-        {872, 8, 119.101f, -163.557f, -200.857f},
-        {873, 8, 112.723f, -188.206f, -182.202f},
-        {874, 8, 112.540f, -208.953f, -158.112f},
-        {875, 8, 118.065f, -224.234f, -131.212f},
-        {876, 8, 129.768f, -232.737f, -102.285f},
-        {877, 8, 146.059f, -233.433f, -75.108f},
-        {878, 8, 166.193f, -226.099f, -51.156f},
-        {879, 8, 187.660f, -212.541f, -32.363f},
-        {880, 8, 209.678f, -192.189f, -20.663f},
-        {881, 8, 229.408f, -168.521f, -16.564f},
-        {882, 8, 246.215f, -141.901f, -20.663f},
-        {883, 8, 258.373f, -115.213f, -32.363f},
-        {884, 8, 265.428f, -89.592f, -51.064f},
-        {885, 8, 265.709f, -68.789f, -75.062f},
-        {886, 8, 274.756f, -34.940f, -100.212f},
-        {887, 8, 269.161f, -15.406f, -132.225f},
-        {888, 8, 253.591f, -15.871f, -156.868f},
-        {889, 8, 238.965f, -15.429f, -181.051f},
-        {890, 8, 212.277f, -35.507f, -200.627f},
-        {891, 8, 223.698f, -15.477f, -205.694f},
-        {892, 8, 196.789f, -37.623f, -223.197f},
-        {893, 8, 208.617f, -15.660f, -229.876f},
-        {894, 8, 187.379f, -30.785f, -246.459f},
-        {895, 8, 179.912f, -58.971f, -225.408f},
-        {896, 8, 170.066f, -54.810f, -246.228f},
-        {897, 8, 153.172f, -77.866f, -246.459f},
-        {898, 8, 136.768f, -100.641f, -246.228f},
-        {899, 8, 119.816f, -123.973f, -246.228f},
-        {900, 8, 102.713f, -147.513f, -246.228f},
-        {901, 8, 110.435f, -154.715f, -225.270f},
-        {902, 8, 86.216f, -170.220f, -246.228f},
-        {903, 8, 95.256f, -176.979f, -223.658f},
-        {904, 8, 78.091f, -195.510f, -229.646f},
-        {905, 8, 97.702f, -193.207f, -200.627f},
-        {906, 8, 82.635f, -209.633f, -205.694f},
-        {907, 8, 87.366f, -223.892f, -181.281f},
-        {908, 8, 91.945f, -238.359f, -156.868f},
-        {909, 8, 96.675f, -252.617f, -132.455f},
-        {910, 8, 101.347f, -267.152f, -107.812f},
-        {911, 8, 116.681f, -252.512f, -100.212f},
-        {912, 8, 106.019f, -281.686f, -83.169f},
-        {913, 8, 123.286f, -263.994f, -76.030f},
-        {914, 8, 122.299f, -281.420f, -57.144f},
-        {915, 8, 141.672f, -252.208f, -60.138f},
-        {916, 8, 141.977f, -267.071f, -42.174f},
-        {917, 8, 161.693f, -252.749f, -27.112f},
-        {918, 8, 181.427f, -238.441f, -12.004f},
-        {919, 8, 200.709f, -224.441f, 2.736f},
-        {920, 8, 221.121f, -209.670f, 18.397f},
-        {921, 8, 223.529f, -192.641f, 2.275f},
-        {922, 8, 240.951f, -195.113f, 33.367f},
-        {923, 8, 242.369f, -177.682f, 15.173f},
-        {924, 8, 258.962f, -170.323f, 33.367f},
-        {925, 8, 251.169f, -154.794f, 2.506f},
-        {926, 8, 266.225f, -147.590f, 18.397f},
-        {927, 8, 273.942f, -124.233f, 3.427f},
-        {928, 8, 281.414f, -101.016f, -11.773f},
-        {929, 8, 288.952f, -77.592f, -27.112f},
-        {930, 8, 296.604f, -54.442f, -41.944f},
-        {931, 8, 282.316f, -59.020f, -59.678f},
-        {932, 8, 304.593f, -30.709f, -56.914f},
-        {933, 8, 287.902f, -37.616f, -75.799f},
-        {934, 8, 299.299f, -15.659f, -83.169f},
-        {935, 8, 283.846f, -15.572f, -108.273f},
-        {936, 9, 190.466f, 136.535f, -117.163f},
-        {937, 9, 174.284f, 143.367f, -135.311f},
-        {938, 9, 192.356f, 118.493f, -135.311f},
-        {939, 9, 207.768f, 119.187f, -109.563f},
-        {940, 9, 200.156f, 143.576f, -93.211f},
-        {941, 9, 178.950f, 158.851f, -109.563f},
-        {942, 9, 154.420f, 174.195f, -131.212f},
-        {943, 9, 156.245f, 151.267f, -155.210f},
-        {944, 9, 170.431f, 122.807f, -165.712f},
-        {945, 9, 193.660f, 99.261f, -155.809f},
-        {946, 9, 214.615f, 90.678f, -131.995f},
-        {947, 9, 226.371f, 99.538f, -102.561f},
-        {948, 9, 225.013f, 122.804f, -77.412f},
-        {949, 9, 209.573f, 152.009f, -68.061f},
-        {950, 9, 187.719f, 174.135f, -77.412f},
-        {951, 9, 165.860f, 183.334f, -101.963f},
-        {952, 9, 141.469f, 204.444f, -116.610f},
-        {953, 9, 133.753f, 190.690f, -145.261f},
-        {954, 9, 134.790f, 168.845f, -169.259f},
-        {955, 9, 143.552f, 142.873f, -185.611f},
-        {956, 9, 159.651f, 115.739f, -191.461f},
-        {957, 9, 181.240f, 91.001f, -185.611f},
-        {958, 9, 203.701f, 74.155f, -169.075f},
-        {959, 9, 224.081f, 66.363f, -145.261f},
-        {960, 9, 239.044f, 69.595f, -117.255f},
-        {961, 9, 247.433f, 82.502f, -88.512f},
-        {962, 9, 246.195f, 105.092f, -63.961f},
-        {963, 9, 236.818f, 131.636f, -47.932f},
-        {964, 9, 220.354f, 159.078f, -42.312f},
-        {965, 9, 200.157f, 182.408f, -47.563f},
-        {966, 9, 177.170f, 200.018f, -64.054f},
-        {967, 9, 156.548f, 207.633f, -88.466f},
-        {968, 9, 131.260f, 230.957f, -101.963f},
-        {969, 9, 119.427f, 222.359f, -131.212f},
-        {970, 9, 113.448f, 206.684f, -159.310f},
-        {971, 9, 114.213f, 186.233f, -182.110f},
-        {972, 9, 120.463f, 161.682f, -200.857f},
-        {973, 9, 133.215f, 133.707f, -213.110f},
-        {974, 9, 149.840f, 107.847f, -216.611f},
-        {975, 9, 170.115f, 82.919f, -213.110f},
-        {976, 9, 192.356f, 62.730f, -200.857f},
-        {977, 9, 213.828f, 49.047f, -182.202f},
-        {978, 9, 233.503f, 42.462f, -158.112f},
-        {979, 9, 249.744f, 42.994f, -131.212f},
-        {980, 9, 261.446f, 51.497f, -102.285f},
-        {981, 9, 267.143f, 66.776f, -75.108f},
-        {982, 9, 266.390f, 88.190f, -51.156f},
-        {983, 9, 260.129f, 112.796f, -32.363f},
-        {984, 9, 247.577f, 140.026f, -20.663f},
-        {985, 9, 231.164f, 166.104f, -16.564f},
-        {986, 9, 211.040f, 190.315f, -20.663f},
-        {987, 9, 189.416f, 210.124f, -32.363f},
-        {988, 9, 167.229f, 224.752f, -51.064f},
-        {989, 9, 147.531f, 231.447f, -75.062f},
-        {990, 9, 118.134f, 250.512f, -100.212f},
-        {991, 9, 97.828f, 251.227f, -132.225f},
-        {992, 9, 93.458f, 236.275f, -156.868f},
-        {993, 9, 88.518f, 222.501f, -181.051f},
-        {994, 9, 99.366f, 190.915f, -200.627f},
-        {995, 9, 83.846f, 207.967f, -205.694f},
-        {996, 9, 96.592f, 175.532f, -223.197f},
-        {997, 9, 79.360f, 193.567f, -229.876f},
-        {998, 9, 87.182f, 168.694f, -246.459f},
-        {999, 9, 111.681f, 152.883f, -225.408f},
-        {1000, 9, 104.681f, 144.805f, -246.228f},
-        {1001, 9, 121.388f, 121.614f, -246.459f},
-        {1002, 9, 137.979f, 98.974f, -246.228f},
-        {1003, 9, 154.931f, 75.642f, -246.228f},
-        {1004, 9, 172.034f, 52.102f, -246.228f},
-        {1005, 9, 181.269f, 57.221f, -225.270f},
-        {1006, 9, 188.531f, 29.395f, -246.228f},
-        {1007, 9, 197.753f, 35.904f, -223.658f},
-        {1008, 9, 210.073f, 13.853f, -229.646f},
-        {1009, 9, 213.942f, 33.216f, -200.627f},
-        {1010, 9, 224.909f, 13.811f, -205.694f},
-        {1011, 9, 239.931f, 13.903f, -181.281f},
-        {1012, 9, 255.105f, 13.788f, -156.868f},
-        {1013, 9, 270.127f, 13.880f, -132.455f},
-        {1014, 9, 285.394f, 13.832f, -107.812f},
-        {1015, 9, 276.209f, 32.940f, -100.212f},
-        {1016, 9, 300.661f, 13.784f, -83.169f},
-        {1017, 9, 289.171f, 35.673f, -76.030f},
-        {1018, 9, 305.438f, 29.350f, -57.144f},
-        {1019, 9, 283.643f, 56.802f, -60.138f},
-        {1020, 9, 297.873f, 52.499f, -42.174f},
-        {1021, 9, 290.344f, 75.675f, -27.112f},
-        {1022, 9, 282.835f, 98.865f, -12.004f},
-        {1023, 9, 275.479f, 121.530f, 2.736f},
-        {1024, 9, 267.738f, 145.507f, 18.397f},
-        {1025, 9, 252.286f, 153.059f, 2.275f},
-        {1026, 9, 260.021f, 168.864f, 33.367f},
-        {1027, 9, 243.882f, 175.599f, 15.173f},
-        {1028, 9, 242.010f, 193.655f, 33.367f},
-        {1029, 9, 224.833f, 191.042f, 2.506f},
-        {1030, 9, 222.635f, 207.587f, 18.397f},
-        {1031, 9, 202.805f, 222.144f, 3.427f},
-        {1032, 9, 183.034f, 236.425f, -11.773f},
-        {1033, 9, 163.085f, 250.832f, -27.112f},
-        {1034, 9, 143.433f, 265.263f, -41.944f},
-        {1035, 9, 143.372f, 250.260f, -59.678f},
-        {1036, 9, 123.331f, 280.196f, -56.914f},
-        {1037, 9, 124.742f, 262.187f, -75.799f},
-        {1038, 9, 107.381f, 279.811f, -83.169f},
-        {1039, 9, 102.523f, 265.141f, -108.273f},
-        {1040, 10, -70.996f, 223.335f, -117.163f},
-        {1041, 10, -82.493f, 210.057f, -135.311f},
-        {1042, 10, -53.253f, 219.558f, -135.311f},
-        {1043, 10, -49.150f, 234.430f, -109.563f},
-        {1044, 10, -74.697f, 234.727f, -93.211f},
-        {1045, 10, -95.778f, 219.279f, -109.563f},
-        {1046, 10, -117.951f, 200.692f, -131.212f},
-        {1047, 10, -95.582f, 195.342f, -155.210f},
-        {1048, 10, -64.130f, 200.039f, -165.712f},
-        {1049, 10, -34.559f, 214.855f, -155.809f},
-        {1050, 10, -19.920f, 232.132f, -131.995f},
-        {1051, 10, -24.713f, 246.051f, -102.561f},
-        {1052, 10, -47.261f, 251.948f, -77.412f},
-        {1053, 10, -79.808f, 246.290f, -68.061f},
-        {1054, 10, -107.604f, 232.342f, -77.412f},
-        {1055, 10, -123.108f, 214.395f, -101.963f},
-        {1056, 10, -150.722f, 197.721f, -116.610f},
-        {1057, 10, -140.025f, 186.133f, -145.261f},
-        {1058, 10, -118.929f, 180.369f, -169.259f},
-        {1059, 10, -91.521f, 180.677f, -185.611f},
-        {1060, 10, -60.739f, 187.602f, -191.461f},
-        {1061, 10, -30.541f, 200.490f, -185.611f},
-        {1062, 10, -7.578f, 216.646f, -169.075f},
-        {1063, 10, 6.130f, 233.621f, -145.261f},
-        {1064, 10, 7.679f, 248.850f, -117.255f},
-        {1065, 10, -2.003f, 260.817f, -88.512f},
-        {1066, 10, -23.870f, 266.620f, -63.961f},
-        {1067, 10, -52.012f, 265.905f, -47.932f},
-        {1068, 10, -83.199f, 258.726f, -42.312f},
-        {1069, 10, -111.628f, 246.728f, -47.563f},
-        {1070, 10, -135.480f, 230.308f, -64.054f},
-        {1071, 10, -149.095f, 213.048f, -88.466f},
-        {1072, 10, -179.091f, 196.205f, -101.963f},
-        {1073, 10, -174.571f, 182.295f, -131.212f},
-        {1074, 10, -161.511f, 171.765f, -159.310f},
-        {1075, 10, -141.825f, 166.173f, -182.110f},
-        {1076, 10, -116.544f, 164.530f, -200.857f},
-        {1077, 10, -85.998f, 168.012f, -213.110f},
-        {1078, 10, -56.265f, 175.833f, -216.611f},
-        {1079, 10, -26.292f, 187.412f, -213.110f},
-        {1080, 10, -0.218f, 202.326f, -200.857f},
-        {1081, 10, 19.430f, 218.519f, -182.202f},
-        {1082, 10, 31.773f, 235.196f, -158.112f},
-        {1083, 10, 36.285f, 250.806f, -131.212f},
-        {1084, 10, 31.815f, 264.563f, -102.285f},
-        {1085, 10, 19.044f, 274.703f, -75.108f},
-        {1086, 10, -1.555f, 280.604f, -51.156f},
-        {1087, 10, -26.892f, 282.253f, -32.363f},
-        {1088, 10, -56.667f, 278.730f, -20.663f},
-        {1089, 10, -86.541f, 271.179f, -16.564f},
-        {1090, 10, -115.785f, 259.521f, -20.663f},
-        {1091, 10, -141.308f, 245.077f, -32.363f},
-        {1092, 10, -162.075f, 228.496f, -51.064f},
-        {1093, 10, -174.530f, 211.831f, -75.062f},
-        {1094, 10, -201.745f, 189.765f, -100.212f},
-        {1095, 10, -208.700f, 170.673f, -132.225f},
-        {1096, 10, -195.831f, 161.897f, -156.868f},
-        {1097, 10, -184.258f, 152.942f, -181.051f},
-        {1098, 10, -150.865f, 153.499f, -200.627f},
-        {1099, 10, -171.878f, 144.008f, -205.694f},
-        {1100, 10, -137.092f, 146.107f, -223.197f},
-        {1101, 10, -159.570f, 135.292f, -229.876f},
-        {1102, 10, -133.497f, 135.044f, -246.459f},
-        {1103, 10, -110.889f, 153.458f, -225.408f},
-        {1104, 10, -105.370f, 144.305f, -246.228f},
-        {1105, 10, -78.151f, 153.028f, -246.459f},
-        {1106, 10, -51.492f, 161.810f, -246.228f},
-        {1107, 10, -24.064f, 170.722f, -246.228f},
-        {1108, 10, 3.609f, 179.714f, -246.228f},
-        {1109, 10, 1.595f, 190.079f, -225.270f},
-        {1110, 10, 30.303f, 188.387f, -246.228f},
-        {1111, 10, 26.962f, 199.169f, -223.658f},
-        {1112, 10, 51.741f, 204.072f, -229.646f},
-        {1113, 10, 34.522f, 213.735f, -200.627f},
-        {1114, 10, 56.366f, 218.169f, -205.694f},
-        {1115, 10, 60.920f, 232.484f, -181.281f},
-        {1116, 10, 65.719f, 246.880f, -156.868f},
-        {1117, 10, 70.273f, 261.196f, -132.455f},
-        {1118, 10, 75.036f, 275.701f, -107.812f},
-        {1119, 10, 54.025f, 272.870f, -100.212f},
-        {1120, 10, 79.800f, 290.205f, -83.169f},
-        {1121, 10, 55.431f, 286.042f, -76.030f},
-        {1122, 10, 66.472f, 299.559f, -57.144f},
-        {1123, 10, 33.629f, 287.313f, -60.138f},
-        {1124, 10, 42.118f, 299.517f, -42.174f},
-        {1125, 10, 17.750f, 299.519f, -27.112f},
-        {1126, 10, -6.626f, 299.543f, -12.004f},
-        {1127, 10, -30.454f, 299.550f, 2.736f},
-        {1128, 10, -55.650f, 299.598f, 18.397f},
-        {1129, 10, -67.607f, 287.236f, 2.275f},
-        {1130, 10, -80.249f, 299.477f, 33.367f},
-        {1131, 10, -91.641f, 286.209f, 15.173f},
-        {1132, 10, -109.391f, 290.008f, 33.367f},
-        {1133, 10, -112.214f, 272.864f, 2.506f},
-        {1134, 10, -128.629f, 275.886f, 18.397f},
-        {1135, 10, -148.601f, 261.525f, 3.427f},
-        {1136, 10, -168.293f, 247.135f, -11.773f},
-        {1137, 10, -188.160f, 232.615f, -27.112f},
-        {1138, 10, -207.957f, 218.384f, -41.944f},
-        {1139, 10, -193.707f, 213.690f, -59.678f},
-        {1140, 10, -228.371f, 203.880f, -56.914f},
-        {1141, 10, -210.807f, 199.657f, -75.799f},
-        {1142, 10, -232.934f, 188.592f, -83.169f},
-        {1143, 10, -220.483f, 179.438f, -108.273f},
-        {1144, 11, 1.427f, -0.442f, -262.000f},
-        {1145, 11, -19.145f, -15.093f, -262.000f},
-        {1146, 11, 10.095f, -24.594f, -262.000f},
-        {1147, 11, 27.073f, 0.160f, -262.000f},
-        {1148, 11, 9.702f, 25.027f, -262.000f},
-        {1149, 11, -19.555f, 15.310f, -262.000f},
-        {1150, 11, -52.553f, 0.581f, -262.000f},
-        {1151, 11, -42.184f, -31.000f, -262.000f},
-        {1152, 11, -15.984f, -51.859f, -262.000f},
-        {1153, 11, 18.540f, -51.434f, -262.000f},
-        {1154, 11, 45.086f, -32.064f, -262.000f},
-        {1155, 11, 55.010f, -0.687f, -262.000f},
-        {1156, 11, 45.038f, 32.120f, -262.000f},
-        {1157, 11, 17.167f, 52.168f, -262.000f},
-        {1158, 11, -15.304f, 51.726f, -262.000f},
-        {1159, 11, -43.085f, 31.890f, -262.000f},
-        {1160, 11, -78.023f, 26.023f, -262.000f},
-        {1161, 11, -81.652f, -6.480f, -262.000f},
-        {1162, 11, -72.556f, -37.648f, -262.000f},
-        {1163, 11, -53.324f, -63.120f, -262.000f},
-        {1164, 11, -25.468f, -79.048f, -262.000f},
-        {1165, 11, 7.655f, -82.933f, -262.000f},
-        {1166, 11, 38.887f, -73.641f, -262.000f},
-        {1167, 11, 64.502f, -53.968f, -262.000f},
-        {1168, 11, 80.056f, -26.098f, -262.000f},
-        {1169, 11, 84.746f, 6.168f, -262.000f},
-        {1170, 11, 75.155f, 38.146f, -262.000f},
-        {1171, 11, 55.028f, 63.530f, -262.000f},
-        {1172, 11, 26.651f, 79.357f, -262.000f},
-        {1173, 11, -4.404f, 83.274f, -262.000f},
-        {1174, 11, -36.501f, 74.317f, -262.000f},
-        {1175, 11, -62.324f, 54.007f, -262.000f},
-        {1176, 11, -99.068f, 50.080f, -262.000f},
-        {1177, 11, -109.174f, 18.978f, -262.000f},
-        {1178, 11, -110.163f, -13.732f, -262.000f},
-        {1179, 11, -101.878f, -43.228f, -262.000f},
-        {1180, 11, -85.971f, -70.436f, -262.000f},
-        {1181, 11, -61.551f, -92.774f, -262.000f},
-        {1182, 11, -33.569f, -105.982f, -262.000f},
-        {1183, 11, -1.845f, -112.174f, -262.000f},
-        {1184, 11, 30.355f, -108.232f, -262.000f},
-        {1185, 11, 59.331f, -95.716f, -262.000f},
-        {1186, 11, 83.719f, -75.320f, -262.000f},
-        {1187, 11, 101.683f, -49.533f, -262.000f},
-        {1188, 11, 111.677f, -18.774f, -262.000f},
-        {1189, 11, 112.495f, 12.909f, -262.000f},
-        {1190, 11, 103.873f, 43.869f, -262.000f},
-        {1191, 11, 87.933f, 71.141f, -262.000f},
-        {1192, 11, 64.008f, 92.669f, -262.000f},
-        {1193, 11, 36.184f, 106.529f, -262.000f},
-        {1194, 11, 4.890f, 111.878f, -262.000f},
-        {1195, 11, -26.483f, 108.317f, -262.000f},
-        {1196, 11, -56.601f, 96.118f, -262.000f},
-        {1197, 11, -81.056f, 75.852f, -262.000f},
-        {1198, 11, -120.847f, 59.215f, -262.000f},
-        {1199, 11, -143.809f, 29.041f, -262.000f},
-        {1200, 11, -143.262f, -0.107f, -262.000f},
-        {1201, 11, -143.781f, -28.368f, -262.000f},
-        {1202, 11, -120.177f, -59.051f, -262.000f},
-        {1203, 11, -143.724f, -57.357f, -262.000f},
-        {1204, 11, -117.689f, -86.393f, -262.000f},
-        {1205, 11, -143.507f, -85.856f, -262.000f},
-        {1206, 11, -125.726f, -111.127f, -262.000f},
-        {1207, 11, -92.592f, -97.147f, -262.000f},
-        {1208, 11, -97.483f, -120.033f, -262.000f},
-        {1209, 11, -70.379f, -129.111f, -262.000f},
-        {1210, 11, -43.606f, -137.539f, -262.000f},
-        {1211, 11, -16.178f, -146.451f, -262.000f},
-        {1212, 11, 11.496f, -155.443f, -262.000f},
-        {1213, 11, 19.961f, -133.555f, -262.000f},
-        {1214, 11, 38.189f, -164.116f, -262.000f},
-        {1215, 11, 46.134f, -140.164f, -262.000f},
-        {1216, 11, 67.919f, -154.281f, -262.000f},
-        {1217, 11, 65.210f, -119.287f, -262.000f},
-        {1218, 11, 84.521f, -131.518f, -262.000f},
-        {1219, 11, 101.282f, -108.264f, -262.000f},
-        {1220, 11, 118.288f, -85.090f, -262.000f},
-        {1221, 11, 135.049f, -61.836f, -262.000f},
-        {1222, 11, 152.134f, -38.417f, -262.000f},
-        {1223, 11, 134.924f, -23.890f, -262.000f},
-        {1224, 11, 169.220f, -14.998f, -262.000f},
-        {1225, 11, 148.421f, 0.153f, -262.000f},
-        {1226, 11, 168.906f, 15.699f, -262.000f},
-        {1227, 11, 134.565f, 23.337f, -262.000f},
-        {1228, 11, 152.037f, 38.779f, -262.000f},
-        {1229, 11, 135.200f, 61.956f, -262.000f},
-        {1230, 11, 118.379f, 85.183f, -262.000f},
-        {1231, 11, 101.921f, 107.859f, -262.000f},
-        {1232, 11, 84.557f, 131.912f, -262.000f},
-        {1233, 11, 64.538f, 119.464f, -262.000f},
-        {1234, 11, 67.443f, 155.071f, -262.000f},
-        {1235, 11, 46.953f, 140.340f, -262.000f},
-        {1236, 11, 38.300f, 164.540f, -262.000f},
-        {1237, 11, 20.046f, 134.191f, -262.000f},
-        {1238, 11, 11.577f, 155.624f, -262.000f},
-        {1239, 11, -15.881f, 146.947f, -262.000f},
-        {1240, 11, -43.173f, 137.945f, -262.000f},
-        {1241, 11, -70.709f, 128.860f, -262.000f},
-        {1242, 11, -97.923f, 120.266f, -262.000f},
-        {1243, 11, -92.540f, 97.669f, -262.000f},
-        {1244, 11, -125.822f, 111.732f, -262.000f},
-        {1245, 11, -117.702f, 86.892f, -262.000f},
-        {1246, 11, -143.514f, 86.615f, -262.000f},
-        {1247, 11, -143.615f, 57.136f, -262.000f}
-    };
-
-    // Define neighbor relationships
-    static constexpr NeighborData NEIGHBORS[] = {
-        {0, {
-            {.id = 1, .distance = 25.256f}, {.id = 3, .distance = 25.653f}, {.id = 2, .distance = 25.660f}, {.id = 5, .distance = 26.237f}, {.id = 4, .distance = 26.780f}, {.id = 7, .distance = 53.251f}, {.id = 11, .distance = 53.584f}
-        }},
-        {1, {
-            {.id = 0, .distance = 25.256f}, {.id = 7, .distance = 27.996f}, {.id = 5, .distance = 30.406f}, {.id = 2, .distance = 30.746f}, {.id = 8, .distance = 36.902f}, {.id = 6, .distance = 36.902f}, {.id = 3, .distance = 48.670f}
-        }},
-        {2, {
-            {.id = 0, .distance = 25.660f}, {.id = 9, .distance = 28.138f}, {.id = 3, .distance = 30.016f}, {.id = 1, .distance = 30.746f}, {.id = 10, .distance = 35.779f}, {.id = 8, .distance = 37.730f}, {.id = 4, .distance = 49.623f}
-        }},
-        {3, {
-            {.id = 0, .distance = 25.653f}, {.id = 11, .distance = 27.950f}, {.id = 2, .distance = 30.016f}, {.id = 4, .distance = 30.334f}, {.id = 12, .distance = 36.663f}, {.id = 10, .distance = 36.917f}, {.id = 1, .distance = 48.670f}
-        }},
-        {4, {
-            {.id = 0, .distance = 26.780f}, {.id = 13, .distance = 28.148f}, {.id = 3, .distance = 30.334f}, {.id = 5, .distance = 30.829f}, {.id = 12, .distance = 36.041f}, {.id = 14, .distance = 36.581f}, {.id = 1, .distance = 49.415f}
-        }},
-        {5, {
-            {.id = 0, .distance = 26.237f}, {.id = 15, .distance = 28.784f}, {.id = 1, .distance = 30.406f}, {.id = 4, .distance = 30.829f}, {.id = 6, .distance = 36.136f}, {.id = 14, .distance = 36.663f}, {.id = 3, .distance = 49.028f}
-        }},
-        {6, {
-            {.id = 17, .distance = 29.943f}, {.id = 15, .distance = 32.709f}, {.id = 7, .distance = 33.241f}, {.id = 16, .distance = 35.999f}, {.id = 5, .distance = 36.136f}, {.id = 1, .distance = 36.902f}, {.id = 18, .distance = 43.146f}
-        }},
-        {7, {
-            {.id = 1, .distance = 27.996f}, {.id = 18, .distance = 31.091f}, {.id = 6, .distance = 33.241f}, {.id = 8, .distance = 33.489f}, {.id = 19, .distance = 33.997f}, {.id = 17, .distance = 46.465f}, {.id = 20, .distance = 50.872f}
-        }},
-        {8, {
-            {.id = 20, .distance = 28.795f}, {.id = 7, .distance = 33.489f}, {.id = 9, .distance = 34.526f}, {.id = 1, .distance = 36.902f}, {.id = 2, .distance = 37.730f}, {.id = 19, .distance = 39.001f}, {.id = 21, .distance = 39.043f}
-        }},
-        {9, {
-            {.id = 2, .distance = 28.138f}, {.id = 22, .distance = 30.119f}, {.id = 10, .distance = 32.862f}, {.id = 21, .distance = 33.326f}, {.id = 8, .distance = 34.526f}, {.id = 23, .distance = 46.032f}, {.id = 20, .distance = 51.953f}
-        }},
-        {10, {
-            {.id = 23, .distance = 29.271f}, {.id = 9, .distance = 32.862f}, {.id = 11, .distance = 32.910f}, {.id = 24, .distance = 35.475f}, {.id = 2, .distance = 35.779f}, {.id = 3, .distance = 36.917f}, {.id = 22, .distance = 42.036f}
-        }},
-        {11, {
-            {.id = 3, .distance = 27.950f}, {.id = 25, .distance = 30.515f}, {.id = 10, .distance = 32.910f}, {.id = 12, .distance = 34.288f}, {.id = 24, .distance = 35.680f}, {.id = 26, .distance = 43.747f}, {.id = 2, .distance = 50.881f}
-        }},
-        {12, {
-            {.id = 26, .distance = 30.713f}, {.id = 27, .distance = 32.961f}, {.id = 11, .distance = 34.288f}, {.id = 13, .distance = 34.333f}, {.id = 4, .distance = 36.041f}, {.id = 3, .distance = 36.663f}, {.id = 25, .distance = 47.436f}
-        }},
-        {13, {
-            {.id = 4, .distance = 28.148f}, {.id = 28, .distance = 28.795f}, {.id = 14, .distance = 32.474f}, {.id = 12, .distance = 34.333f}, {.id = 29, .distance = 37.853f}, {.id = 27, .distance = 39.529f}, {.id = 5, .distance = 52.029f}
-        }},
-        {14, {
-            {.id = 30, .distance = 30.978f}, {.id = 13, .distance = 32.474f}, {.id = 29, .distance = 33.378f}, {.id = 15, .distance = 34.135f}, {.id = 4, .distance = 36.581f}, {.id = 5, .distance = 36.663f}, {.id = 31, .distance = 47.075f}
-        }},
-        {15, {
-            {.id = 5, .distance = 28.784f}, {.id = 31, .distance = 29.314f}, {.id = 6, .distance = 32.709f}, {.id = 14, .distance = 34.135f}, {.id = 16, .distance = 35.428f}, {.id = 30, .distance = 42.934f}, {.id = 1, .distance = 52.730f}
-        }},
-        {16, {
-            {.id = 33, .distance = 31.937f}, {.id = 32, .distance = 31.964f}, {.id = 31, .distance = 32.088f}, {.id = 17, .distance = 32.704f}, {.id = 15, .distance = 35.428f}, {.id = 6, .distance = 35.999f}, {.id = 53, .distance = 49.921f}
-        }},
-        {17, {
-            {.id = 34, .distance = 29.419f}, {.id = 6, .distance = 29.943f}, {.id = 18, .distance = 32.468f}, {.id = 16, .distance = 32.704f}, {.id = 33, .distance = 37.491f}, {.id = 35, .distance = 41.947f}, {.id = 7, .distance = 46.465f}
-        }},
-        {18, {
-            {.id = 35, .distance = 29.848f}, {.id = 7, .distance = 31.091f}, {.id = 19, .distance = 31.917f}, {.id = 17, .distance = 32.468f}, {.id = 36, .distance = 35.426f}, {.id = 6, .distance = 43.146f}, {.id = 34, .distance = 44.568f}
-        }},
-        {19, {
-            {.id = 37, .distance = 30.775f}, {.id = 18, .distance = 31.917f}, {.id = 20, .distance = 32.089f}, {.id = 36, .distance = 33.457f}, {.id = 7, .distance = 33.997f}, {.id = 8, .distance = 39.001f}, {.id = 38, .distance = 47.195f}
-        }},
-        {20, {
-            {.id = 38, .distance = 28.126f}, {.id = 8, .distance = 28.795f}, {.id = 19, .distance = 32.089f}, {.id = 21, .distance = 33.350f}, {.id = 37, .distance = 38.606f}, {.id = 39, .distance = 40.686f}, {.id = 7, .distance = 50.872f}
-        }},
-        {21, {
-            {.id = 39, .distance = 30.745f}, {.id = 22, .distance = 32.585f}, {.id = 9, .distance = 33.326f}, {.id = 20, .distance = 33.350f}, {.id = 40, .distance = 33.990f}, {.id = 8, .distance = 39.043f}, {.id = 38, .distance = 47.230f}
-        }},
-        {22, {
-            {.id = 41, .distance = 30.088f}, {.id = 9, .distance = 30.119f}, {.id = 23, .distance = 32.298f}, {.id = 21, .distance = 32.585f}, {.id = 40, .distance = 35.628f}, {.id = 10, .distance = 42.036f}, {.id = 42, .distance = 44.864f}
-        }},
-        {23, {
-            {.id = 42, .distance = 28.726f}, {.id = 10, .distance = 29.271f}, {.id = 24, .distance = 31.916f}, {.id = 22, .distance = 32.298f}, {.id = 43, .distance = 37.444f}, {.id = 41, .distance = 42.067f}, {.id = 9, .distance = 46.032f}
-        }},
-        {24, {
-            {.id = 43, .distance = 31.889f}, {.id = 23, .distance = 31.916f}, {.id = 44, .distance = 32.458f}, {.id = 25, .distance = 32.605f}, {.id = 10, .distance = 35.475f}, {.id = 11, .distance = 35.680f}, {.id = 42, .distance = 49.358f}
-        }},
-        {25, {
-            {.id = 45, .distance = 28.557f}, {.id = 11, .distance = 30.515f}, {.id = 24, .distance = 32.605f}, {.id = 26, .distance = 33.386f}, {.id = 44, .distance = 36.707f}, {.id = 46, .distance = 42.276f}, {.id = 12, .distance = 47.436f}
-        }},
-        {26, {
-            {.id = 46, .distance = 29.283f}, {.id = 12, .distance = 30.713f}, {.id = 27, .distance = 32.395f}, {.id = 25, .distance = 33.386f}, {.id = 47, .distance = 35.383f}, {.id = 11, .distance = 43.747f}, {.id = 45, .distance = 45.069f}
-        }},
-        {27, {
-            {.id = 48, .distance = 30.492f}, {.id = 26, .distance = 32.395f}, {.id = 28, .distance = 32.492f}, {.id = 12, .distance = 32.961f}, {.id = 47, .distance = 33.774f}, {.id = 13, .distance = 39.529f}, {.id = 49, .distance = 46.947f}
-        }},
-        {28, {
-            {.id = 13, .distance = 28.795f}, {.id = 49, .distance = 28.796f}, {.id = 29, .distance = 31.301f}, {.id = 27, .distance = 32.492f}, {.id = 50, .distance = 39.130f}, {.id = 48, .distance = 39.658f}, {.id = 14, .distance = 50.236f}
-        }},
-        {29, {
-            {.id = 50, .distance = 30.076f}, {.id = 28, .distance = 31.301f}, {.id = 30, .distance = 33.324f}, {.id = 14, .distance = 33.378f}, {.id = 51, .distance = 33.386f}, {.id = 13, .distance = 37.853f}, {.id = 49, .distance = 46.778f}
-        }},
-        {30, {
-            {.id = 52, .distance = 29.653f}, {.id = 14, .distance = 30.978f}, {.id = 31, .distance = 32.852f}, {.id = 29, .distance = 33.324f}, {.id = 51, .distance = 35.446f}, {.id = 15, .distance = 42.934f}, {.id = 53, .distance = 44.581f}
-        }},
-        {31, {
-            {.id = 53, .distance = 28.776f}, {.id = 15, .distance = 29.314f}, {.id = 16, .distance = 32.088f}, {.id = 30, .distance = 32.852f}, {.id = 32, .distance = 36.954f}, {.id = 52, .distance = 42.498f}, {.id = 14, .distance = 47.075f}
-        }},
-        {32, {
-            {.id = 54, .distance = 23.617f}, {.id = 53, .distance = 31.442f}, {.id = 16, .distance = 31.964f}, {.id = 33, .distance = 32.703f}, {.id = 31, .distance = 36.954f}, {.id = 101, .distance = 41.259f}, {.id = 103, .distance = 45.103f}
-        }},
-        {33, {
-            {.id = 16, .distance = 31.937f}, {.id = 32, .distance = 32.703f}, {.id = 34, .distance = 32.725f}, {.id = 55, .distance = 36.068f}, {.id = 17, .distance = 37.491f}, {.id = 56, .distance = 39.068f}, {.id = 54, .distance = 41.895f}
-        }},
-        {34, {
-            {.id = 17, .distance = 29.419f}, {.id = 35, .distance = 30.638f}, {.id = 33, .distance = 32.725f}, {.id = 56, .distance = 35.794f}, {.id = 57, .distance = 36.665f}, {.id = 18, .distance = 44.568f}, {.id = 58, .distance = 46.412f}
-        }},
-        {35, {
-            {.id = 58, .distance = 24.191f}, {.id = 18, .distance = 29.848f}, {.id = 34, .distance = 30.638f}, {.id = 36, .distance = 31.516f}, {.id = 17, .distance = 41.947f}, {.id = 59, .distance = 44.167f}, {.id = 57, .distance = 44.460f}
-        }},
-        {36, {
-            {.id = 63, .distance = 27.519f}, {.id = 35, .distance = 31.516f}, {.id = 37, .distance = 33.096f}, {.id = 19, .distance = 33.457f}, {.id = 18, .distance = 35.426f}, {.id = 60, .distance = 35.506f}, {.id = 58, .distance = 36.051f}
-        }},
-        {37, {
-            {.id = 19, .distance = 30.775f}, {.id = 38, .distance = 30.943f}, {.id = 63, .distance = 31.347f}, {.id = 36, .distance = 33.096f}, {.id = 65, .distance = 37.393f}, {.id = 20, .distance = 38.606f}, {.id = 64, .distance = 45.102f}
-        }},
-        {38, {
-            {.id = 20, .distance = 28.126f}, {.id = 37, .distance = 30.943f}, {.id = 39, .distance = 32.322f}, {.id = 66, .distance = 33.115f}, {.id = 65, .distance = 43.474f}, {.id = 67, .distance = 44.048f}, {.id = 19, .distance = 47.195f}
-        }},
-        {39, {
-            {.id = 69, .distance = 30.540f}, {.id = 21, .distance = 30.745f}, {.id = 38, .distance = 32.322f}, {.id = 40, .distance = 32.441f}, {.id = 67, .distance = 37.153f}, {.id = 20, .distance = 40.686f}, {.id = 68, .distance = 45.279f}
-        }},
-        {40, {
-            {.id = 69, .distance = 27.373f}, {.id = 41, .distance = 31.563f}, {.id = 39, .distance = 32.441f}, {.id = 21, .distance = 33.990f}, {.id = 71, .distance = 35.618f}, {.id = 22, .distance = 35.628f}, {.id = 73, .distance = 36.566f}
-        }},
-        {41, {
-            {.id = 73, .distance = 24.293f}, {.id = 22, .distance = 30.088f}, {.id = 40, .distance = 31.563f}, {.id = 42, .distance = 31.793f}, {.id = 23, .distance = 42.067f}, {.id = 74, .distance = 43.775f}, {.id = 75, .distance = 43.787f}
-        }},
-        {42, {
-            {.id = 23, .distance = 28.726f}, {.id = 43, .distance = 31.427f}, {.id = 41, .distance = 31.793f}, {.id = 76, .distance = 35.922f}, {.id = 75, .distance = 37.333f}, {.id = 22, .distance = 44.864f}, {.id = 73, .distance = 47.704f}
-        }},
-        {43, {
-            {.id = 42, .distance = 31.427f}, {.id = 24, .distance = 31.889f}, {.id = 44, .distance = 32.342f}, {.id = 77, .distance = 35.562f}, {.id = 23, .distance = 37.444f}, {.id = 76, .distance = 39.243f}, {.id = 79, .distance = 41.982f}
-        }},
-        {44, {
-            {.id = 79, .distance = 23.803f}, {.id = 45, .distance = 31.693f}, {.id = 43, .distance = 32.342f}, {.id = 24, .distance = 32.458f}, {.id = 25, .distance = 36.707f}, {.id = 81, .distance = 41.333f}, {.id = 78, .distance = 44.974f}
-        }},
-        {45, {
-            {.id = 83, .distance = 24.410f}, {.id = 25, .distance = 28.557f}, {.id = 44, .distance = 31.693f}, {.id = 46, .distance = 32.138f}, {.id = 81, .distance = 38.124f}, {.id = 79, .distance = 43.096f}, {.id = 26, .distance = 45.069f}
-        }},
-        {46, {
-            {.id = 26, .distance = 29.283f}, {.id = 47, .distance = 31.589f}, {.id = 45, .distance = 32.138f}, {.id = 85, .distance = 36.174f}, {.id = 83, .distance = 36.927f}, {.id = 25, .distance = 42.276f}, {.id = 86, .distance = 43.787f}
-        }},
-        {47, {
-            {.id = 46, .distance = 31.589f}, {.id = 48, .distance = 32.185f}, {.id = 86, .distance = 33.528f}, {.id = 27, .distance = 33.774f}, {.id = 26, .distance = 35.383f}, {.id = 87, .distance = 39.292f}, {.id = 85, .distance = 48.151f}
-        }},
-        {48, {
-            {.id = 89, .distance = 26.800f}, {.id = 27, .distance = 30.492f}, {.id = 49, .distance = 31.085f}, {.id = 47, .distance = 32.185f}, {.id = 28, .distance = 39.658f}, {.id = 87, .distance = 40.843f}, {.id = 88, .distance = 44.297f}
-        }},
-        {49, {
-            {.id = 28, .distance = 28.796f}, {.id = 48, .distance = 31.085f}, {.id = 89, .distance = 31.165f}, {.id = 50, .distance = 31.748f}, {.id = 93, .distance = 32.025f}, {.id = 91, .distance = 35.484f}, {.id = 29, .distance = 46.778f}
-        }},
-        {50, {
-            {.id = 93, .distance = 26.974f}, {.id = 29, .distance = 30.076f}, {.id = 51, .distance = 31.574f}, {.id = 49, .distance = 31.748f}, {.id = 28, .distance = 39.130f}, {.id = 95, .distance = 40.759f}, {.id = 94, .distance = 44.255f}
-        }},
-        {51, {
-            {.id = 50, .distance = 31.574f}, {.id = 52, .distance = 32.495f}, {.id = 29, .distance = 33.386f}, {.id = 96, .distance = 34.006f}, {.id = 30, .distance = 35.446f}, {.id = 95, .distance = 40.058f}, {.id = 97, .distance = 48.765f}
-        }},
-        {52, {
-            {.id = 30, .distance = 29.653f}, {.id = 53, .distance = 31.761f}, {.id = 51, .distance = 32.495f}, {.id = 97, .distance = 35.652f}, {.id = 99, .distance = 35.973f}, {.id = 31, .distance = 42.498f}, {.id = 96, .distance = 43.930f}
-        }},
-        {53, {
-            {.id = 99, .distance = 24.656f}, {.id = 31, .distance = 28.776f}, {.id = 32, .distance = 31.442f}, {.id = 52, .distance = 31.761f}, {.id = 101, .distance = 38.273f}, {.id = 54, .distance = 43.129f}, {.id = 30, .distance = 44.581f}
-        }},
-        {54, {
-            {.id = 103, .distance = 22.863f}, {.id = 32, .distance = 23.617f}, {.id = 101, .distance = 27.856f}, {.id = 102, .distance = 35.561f}, {.id = 55, .distance = 37.917f}, {.id = 33, .distance = 41.895f}, {.id = 53, .distance = 43.129f}
-        }},
-        {55, {
-            {.id = 103, .distance = 28.096f}, {.id = 56, .distance = 29.153f}, {.id = 265, .distance = 30.837f}, {.id = 33, .distance = 36.068f}, {.id = 54, .distance = 37.917f}, {.id = 267, .distance = 41.896f}, {.id = 264, .distance = 42.604f}
-        }},
-        {56, {
-            {.id = 57, .distance = 28.265f}, {.id = 55, .distance = 29.153f}, {.id = 264, .distance = 31.737f}, {.id = 34, .distance = 35.794f}, {.id = 33, .distance = 39.068f}, {.id = 265, .distance = 42.312f}, {.id = 263, .distance = 42.604f}
-        }},
-        {57, {
-            {.id = 56, .distance = 28.265f}, {.id = 59, .distance = 28.989f}, {.id = 263, .distance = 30.837f}, {.id = 34, .distance = 36.665f}, {.id = 58, .distance = 38.712f}, {.id = 311, .distance = 42.288f}, {.id = 264, .distance = 42.312f}
-        }},
-        {58, {
-            {.id = 59, .distance = 23.607f}, {.id = 35, .distance = 24.191f}, {.id = 60, .distance = 27.455f}, {.id = 61, .distance = 35.536f}, {.id = 36, .distance = 36.051f}, {.id = 57, .distance = 38.712f}, {.id = 34, .distance = 46.412f}
-        }},
-        {59, {
-            {.id = 58, .distance = 23.607f}, {.id = 61, .distance = 28.500f}, {.id = 57, .distance = 28.989f}, {.id = 311, .distance = 31.044f}, {.id = 60, .distance = 38.998f}, {.id = 263, .distance = 41.896f}, {.id = 310, .distance = 42.722f}
-        }},
-        {60, {
-            {.id = 61, .distance = 25.823f}, {.id = 62, .distance = 26.007f}, {.id = 63, .distance = 27.304f}, {.id = 58, .distance = 27.455f}, {.id = 36, .distance = 35.506f}, {.id = 59, .distance = 38.998f}, {.id = 64, .distance = 39.242f}
-        }},
-        {61, {
-            {.id = 60, .distance = 25.823f}, {.id = 59, .distance = 28.500f}, {.id = 62, .distance = 30.900f}, {.id = 310, .distance = 31.323f}, {.id = 58, .distance = 35.536f}, {.id = 311, .distance = 42.426f}, {.id = 63, .distance = 52.152f}
-        }},
-        {62, {
-            {.id = 60, .distance = 26.007f}, {.id = 204, .distance = 29.050f}, {.id = 64, .distance = 29.614f}, {.id = 61, .distance = 30.900f}, {.id = 63, .distance = 35.963f}, {.id = 202, .distance = 41.538f}, {.id = 206, .distance = 51.839f}
-        }},
-        {63, {
-            {.id = 64, .distance = 23.404f}, {.id = 60, .distance = 27.304f}, {.id = 36, .distance = 27.519f}, {.id = 37, .distance = 31.347f}, {.id = 62, .distance = 35.963f}, {.id = 65, .distance = 38.924f}, {.id = 58, .distance = 47.034f}
-        }},
-        {64, {
-            {.id = 63, .distance = 23.404f}, {.id = 65, .distance = 28.584f}, {.id = 62, .distance = 29.614f}, {.id = 202, .distance = 29.699f}, {.id = 60, .distance = 39.242f}, {.id = 201, .distance = 41.093f}, {.id = 204, .distance = 41.569f}
-        }},
-        {65, {
-            {.id = 66, .distance = 28.069f}, {.id = 64, .distance = 28.584f}, {.id = 201, .distance = 29.681f}, {.id = 37, .distance = 37.393f}, {.id = 63, .distance = 38.924f}, {.id = 200, .distance = 41.139f}, {.id = 202, .distance = 41.301f}
-        }},
-        {66, {
-            {.id = 65, .distance = 28.069f}, {.id = 67, .distance = 28.840f}, {.id = 200, .distance = 29.791f}, {.id = 38, .distance = 33.115f}, {.id = 201, .distance = 41.276f}, {.id = 199, .distance = 41.688f}, {.id = 37, .distance = 48.228f}
-        }},
-        {67, {
-            {.id = 66, .distance = 28.840f}, {.id = 68, .distance = 29.097f}, {.id = 199, .distance = 29.681f}, {.id = 39, .distance = 37.153f}, {.id = 69, .distance = 38.371f}, {.id = 200, .distance = 41.088f}, {.id = 198, .distance = 41.797f}
-        }},
-        {68, {
-            {.id = 69, .distance = 23.468f}, {.id = 70, .distance = 28.067f}, {.id = 67, .distance = 29.097f}, {.id = 198, .distance = 29.876f}, {.id = 71, .distance = 37.859f}, {.id = 196, .distance = 41.018f}, {.id = 199, .distance = 41.259f}
-        }},
-        {69, {
-            {.id = 68, .distance = 23.468f}, {.id = 71, .distance = 26.995f}, {.id = 40, .distance = 27.373f}, {.id = 39, .distance = 30.540f}, {.id = 70, .distance = 35.584f}, {.id = 67, .distance = 38.371f}, {.id = 73, .distance = 47.445f}
-        }},
-        {70, {
-            {.id = 71, .distance = 25.235f}, {.id = 68, .distance = 28.067f}, {.id = 196, .distance = 29.688f}, {.id = 72, .distance = 31.314f}, {.id = 69, .distance = 35.584f}, {.id = 198, .distance = 40.900f}, {.id = 581, .distance = 51.969f}
-        }},
-        {71, {
-            {.id = 70, .distance = 25.235f}, {.id = 72, .distance = 25.959f}, {.id = 69, .distance = 26.995f}, {.id = 73, .distance = 28.280f}, {.id = 40, .distance = 35.618f}, {.id = 68, .distance = 37.859f}, {.id = 74, .distance = 39.348f}
-        }},
-        {72, {
-            {.id = 71, .distance = 25.959f}, {.id = 74, .distance = 28.175f}, {.id = 581, .distance = 29.549f}, {.id = 70, .distance = 31.314f}, {.id = 73, .distance = 35.099f}, {.id = 579, .distance = 40.243f}, {.id = 69, .distance = 52.245f}
-        }},
-        {73, {
-            {.id = 74, .distance = 22.858f}, {.id = 41, .distance = 24.293f}, {.id = 71, .distance = 28.280f}, {.id = 72, .distance = 35.099f}, {.id = 40, .distance = 36.566f}, {.id = 75, .distance = 37.718f}, {.id = 69, .distance = 47.445f}
-        }},
-        {74, {
-            {.id = 73, .distance = 22.858f}, {.id = 72, .distance = 28.175f}, {.id = 75, .distance = 28.665f}, {.id = 579, .distance = 29.310f}, {.id = 71, .distance = 39.348f}, {.id = 577, .distance = 40.738f}, {.id = 581, .distance = 41.456f}
-        }},
-        {75, {
-            {.id = 74, .distance = 28.665f}, {.id = 76, .distance = 28.744f}, {.id = 577, .distance = 29.345f}, {.id = 42, .distance = 37.333f}, {.id = 73, .distance = 37.718f}, {.id = 576, .distance = 40.851f}, {.id = 579, .distance = 41.503f}
-        }},
-        {76, {
-            {.id = 77, .distance = 28.665f}, {.id = 75, .distance = 28.744f}, {.id = 576, .distance = 29.691f}, {.id = 42, .distance = 35.922f}, {.id = 43, .distance = 39.243f}, {.id = 575, .distance = 40.703f}, {.id = 577, .distance = 41.214f}
-        }},
-        {77, {
-            {.id = 76, .distance = 28.665f}, {.id = 78, .distance = 28.989f}, {.id = 575, .distance = 29.296f}, {.id = 43, .distance = 35.562f}, {.id = 79, .distance = 37.946f}, {.id = 623, .distance = 40.496f}, {.id = 576, .distance = 41.883f}
-        }},
-        {78, {
-            {.id = 79, .distance = 22.522f}, {.id = 80, .distance = 28.989f}, {.id = 77, .distance = 28.989f}, {.id = 623, .distance = 29.440f}, {.id = 81, .distance = 38.748f}, {.id = 622, .distance = 40.864f}, {.id = 575, .distance = 41.400f}
-        }},
-        {79, {
-            {.id = 78, .distance = 22.522f}, {.id = 44, .distance = 23.803f}, {.id = 81, .distance = 27.573f}, {.id = 80, .distance = 35.430f}, {.id = 77, .distance = 37.946f}, {.id = 43, .distance = 41.982f}, {.id = 45, .distance = 43.096f}
-        }},
-        {80, {
-            {.id = 81, .distance = 25.732f}, {.id = 78, .distance = 28.989f}, {.id = 622, .distance = 29.465f}, {.id = 82, .distance = 30.699f}, {.id = 79, .distance = 35.430f}, {.id = 623, .distance = 42.121f}, {.id = 83, .distance = 51.677f}
-        }},
-        {81, {
-            {.id = 82, .distance = 25.715f}, {.id = 80, .distance = 25.732f}, {.id = 83, .distance = 27.009f}, {.id = 79, .distance = 27.573f}, {.id = 45, .distance = 38.124f}, {.id = 78, .distance = 38.748f}, {.id = 84, .distance = 38.795f}
-        }},
-        {82, {
-            {.id = 81, .distance = 25.715f}, {.id = 84, .distance = 28.587f}, {.id = 477, .distance = 29.341f}, {.id = 80, .distance = 30.699f}, {.id = 83, .distance = 35.180f}, {.id = 475, .distance = 41.271f}, {.id = 478, .distance = 51.855f}
-        }},
-        {83, {
-            {.id = 84, .distance = 23.318f}, {.id = 45, .distance = 24.410f}, {.id = 81, .distance = 27.009f}, {.id = 82, .distance = 35.180f}, {.id = 46, .distance = 36.927f}, {.id = 85, .distance = 38.625f}, {.id = 79, .distance = 47.229f}
-        }},
-        {84, {
-            {.id = 83, .distance = 23.318f}, {.id = 82, .distance = 28.587f}, {.id = 85, .distance = 28.648f}, {.id = 475, .distance = 29.217f}, {.id = 81, .distance = 38.795f}, {.id = 477, .distance = 40.505f}, {.id = 473, .distance = 41.569f}
-        }},
-        {85, {
-            {.id = 84, .distance = 28.648f}, {.id = 86, .distance = 28.678f}, {.id = 473, .distance = 29.175f}, {.id = 46, .distance = 36.174f}, {.id = 83, .distance = 38.625f}, {.id = 475, .distance = 40.470f}, {.id = 472, .distance = 41.613f}
-        }},
-        {86, {
-            {.id = 87, .distance = 28.019f}, {.id = 85, .distance = 28.678f}, {.id = 472, .distance = 29.580f}, {.id = 47, .distance = 33.528f}, {.id = 473, .distance = 40.192f}, {.id = 471, .distance = 41.584f}, {.id = 46, .distance = 43.787f}
-        }},
-        {87, {
-            {.id = 86, .distance = 28.019f}, {.id = 471, .distance = 29.135f}, {.id = 88, .distance = 29.666f}, {.id = 89, .distance = 39.143f}, {.id = 47, .distance = 39.292f}, {.id = 472, .distance = 40.348f}, {.id = 48, .distance = 40.843f}
-        }},
-        {88, {
-            {.id = 89, .distance = 23.574f}, {.id = 90, .distance = 28.796f}, {.id = 519, .distance = 29.181f}, {.id = 87, .distance = 29.666f}, {.id = 91, .distance = 38.536f}, {.id = 471, .distance = 40.304f}, {.id = 518, .distance = 41.626f}
-        }},
-        {89, {
-            {.id = 88, .distance = 23.574f}, {.id = 48, .distance = 26.800f}, {.id = 91, .distance = 27.295f}, {.id = 49, .distance = 31.165f}, {.id = 90, .distance = 35.726f}, {.id = 87, .distance = 39.143f}, {.id = 93, .distance = 46.866f}
-        }},
-        {90, {
-            {.id = 91, .distance = 25.236f}, {.id = 88, .distance = 28.796f}, {.id = 518, .distance = 29.473f}, {.id = 92, .distance = 30.643f}, {.id = 89, .distance = 35.726f}, {.id = 519, .distance = 41.051f}, {.id = 93, .distance = 51.793f}
-        }},
-        {91, {
-            {.id = 90, .distance = 25.236f}, {.id = 92, .distance = 25.701f}, {.id = 89, .distance = 27.295f}, {.id = 93, .distance = 27.601f}, {.id = 49, .distance = 35.484f}, {.id = 88, .distance = 38.536f}, {.id = 94, .distance = 38.536f}
-        }},
-        {92, {
-            {.id = 91, .distance = 25.701f}, {.id = 94, .distance = 28.171f}, {.id = 373, .distance = 30.385f}, {.id = 90, .distance = 30.643f}, {.id = 93, .distance = 35.416f}, {.id = 371, .distance = 42.484f}, {.id = 518, .distance = 51.460f}
-        }},
-        {93, {
-            {.id = 94, .distance = 23.046f}, {.id = 50, .distance = 26.974f}, {.id = 91, .distance = 27.601f}, {.id = 49, .distance = 32.025f}, {.id = 92, .distance = 35.416f}, {.id = 95, .distance = 38.124f}, {.id = 89, .distance = 46.866f}
-        }},
-        {94, {
-            {.id = 93, .distance = 23.046f}, {.id = 92, .distance = 28.171f}, {.id = 95, .distance = 28.796f}, {.id = 371, .distance = 30.403f}, {.id = 91, .distance = 38.536f}, {.id = 373, .distance = 40.601f}, {.id = 369, .distance = 43.161f}
-        }},
-        {95, {
-            {.id = 96, .distance = 28.739f}, {.id = 94, .distance = 28.796f}, {.id = 369, .distance = 30.170f}, {.id = 93, .distance = 38.124f}, {.id = 51, .distance = 40.058f}, {.id = 371, .distance = 40.512f}, {.id = 50, .distance = 40.759f}
-        }},
-        {96, {
-            {.id = 95, .distance = 28.739f}, {.id = 97, .distance = 28.996f}, {.id = 368, .distance = 30.696f}, {.id = 51, .distance = 34.006f}, {.id = 369, .distance = 40.388f}, {.id = 367, .distance = 42.992f}, {.id = 52, .distance = 43.930f}
-        }},
-        {97, {
-            {.id = 98, .distance = 28.539f}, {.id = 96, .distance = 28.996f}, {.id = 367, .distance = 30.344f}, {.id = 52, .distance = 35.652f}, {.id = 99, .distance = 38.072f}, {.id = 368, .distance = 41.292f}, {.id = 415, .distance = 42.554f}
-        }},
-        {98, {
-            {.id = 99, .distance = 23.229f}, {.id = 97, .distance = 28.539f}, {.id = 100, .distance = 29.175f}, {.id = 415, .distance = 30.291f}, {.id = 101, .distance = 38.795f}, {.id = 367, .distance = 40.387f}, {.id = 414, .distance = 43.137f}
-        }},
-        {99, {
-            {.id = 98, .distance = 23.229f}, {.id = 53, .distance = 24.656f}, {.id = 101, .distance = 27.373f}, {.id = 52, .distance = 35.973f}, {.id = 100, .distance = 36.131f}, {.id = 97, .distance = 38.072f}, {.id = 54, .distance = 47.750f}
-        }},
-        {100, {
-            {.id = 101, .distance = 26.133f}, {.id = 98, .distance = 29.175f}, {.id = 414, .distance = 29.970f}, {.id = 102, .distance = 30.723f}, {.id = 99, .distance = 36.131f}, {.id = 415, .distance = 40.924f}, {.id = 54, .distance = 52.753f}
-        }},
-        {101, {
-            {.id = 102, .distance = 25.813f}, {.id = 100, .distance = 26.133f}, {.id = 99, .distance = 27.373f}, {.id = 54, .distance = 27.856f}, {.id = 53, .distance = 38.273f}, {.id = 98, .distance = 38.795f}, {.id = 103, .distance = 39.458f}
-        }},
-        {102, {
-            {.id = 101, .distance = 25.813f}, {.id = 103, .distance = 29.479f}, {.id = 100, .distance = 30.723f}, {.id = 269, .distance = 31.323f}, {.id = 54, .distance = 35.561f}, {.id = 267, .distance = 42.722f}, {.id = 414, .distance = 51.870f}
-        }},
-        {103, {
-            {.id = 54, .distance = 22.863f}, {.id = 55, .distance = 28.096f}, {.id = 102, .distance = 29.479f}, {.id = 267, .distance = 31.044f}, {.id = 101, .distance = 39.458f}, {.id = 265, .distance = 42.288f}, {.id = 269, .distance = 42.426f}
-        }},
-        {104, {
-            {.id = 105, .distance = 25.256f}, {.id = 107, .distance = 25.653f}, {.id = 106, .distance = 25.660f}, {.id = 109, .distance = 26.237f}, {.id = 108, .distance = 26.780f}, {.id = 111, .distance = 53.251f}, {.id = 115, .distance = 53.584f}
-        }},
-        {105, {
-            {.id = 104, .distance = 25.256f}, {.id = 111, .distance = 27.996f}, {.id = 109, .distance = 30.406f}, {.id = 106, .distance = 30.745f}, {.id = 112, .distance = 36.902f}, {.id = 110, .distance = 36.902f}, {.id = 107, .distance = 48.670f}
-        }},
-        {106, {
-            {.id = 104, .distance = 25.660f}, {.id = 113, .distance = 28.138f}, {.id = 107, .distance = 30.016f}, {.id = 105, .distance = 30.745f}, {.id = 114, .distance = 35.779f}, {.id = 112, .distance = 37.730f}, {.id = 108, .distance = 49.623f}
-        }},
-        {107, {
-            {.id = 104, .distance = 25.653f}, {.id = 115, .distance = 27.950f}, {.id = 106, .distance = 30.016f}, {.id = 108, .distance = 30.334f}, {.id = 116, .distance = 36.663f}, {.id = 114, .distance = 36.917f}, {.id = 105, .distance = 48.670f}
-        }},
-        {108, {
-            {.id = 104, .distance = 26.780f}, {.id = 117, .distance = 28.148f}, {.id = 107, .distance = 30.334f}, {.id = 109, .distance = 30.829f}, {.id = 116, .distance = 36.041f}, {.id = 118, .distance = 36.581f}, {.id = 105, .distance = 49.415f}
-        }},
-        {109, {
-            {.id = 104, .distance = 26.237f}, {.id = 119, .distance = 28.784f}, {.id = 105, .distance = 30.406f}, {.id = 108, .distance = 30.829f}, {.id = 110, .distance = 36.136f}, {.id = 118, .distance = 36.663f}, {.id = 107, .distance = 49.028f}
-        }},
-        {110, {
-            {.id = 121, .distance = 29.943f}, {.id = 119, .distance = 32.709f}, {.id = 111, .distance = 33.241f}, {.id = 120, .distance = 35.999f}, {.id = 109, .distance = 36.136f}, {.id = 105, .distance = 36.902f}, {.id = 122, .distance = 43.146f}
-        }},
-        {111, {
-            {.id = 105, .distance = 27.996f}, {.id = 122, .distance = 31.091f}, {.id = 110, .distance = 33.241f}, {.id = 112, .distance = 33.489f}, {.id = 123, .distance = 33.997f}, {.id = 121, .distance = 46.465f}, {.id = 124, .distance = 50.872f}
-        }},
-        {112, {
-            {.id = 124, .distance = 28.795f}, {.id = 111, .distance = 33.489f}, {.id = 113, .distance = 34.526f}, {.id = 105, .distance = 36.902f}, {.id = 106, .distance = 37.730f}, {.id = 123, .distance = 39.001f}, {.id = 125, .distance = 39.043f}
-        }},
-        {113, {
-            {.id = 106, .distance = 28.138f}, {.id = 126, .distance = 30.119f}, {.id = 114, .distance = 32.862f}, {.id = 125, .distance = 33.326f}, {.id = 112, .distance = 34.526f}, {.id = 127, .distance = 46.032f}, {.id = 124, .distance = 51.953f}
-        }},
-        {114, {
-            {.id = 127, .distance = 29.271f}, {.id = 113, .distance = 32.862f}, {.id = 115, .distance = 32.910f}, {.id = 128, .distance = 35.475f}, {.id = 106, .distance = 35.779f}, {.id = 107, .distance = 36.917f}, {.id = 126, .distance = 42.036f}
-        }},
-        {115, {
-            {.id = 107, .distance = 27.950f}, {.id = 129, .distance = 30.515f}, {.id = 114, .distance = 32.910f}, {.id = 116, .distance = 34.288f}, {.id = 128, .distance = 35.680f}, {.id = 130, .distance = 43.747f}, {.id = 106, .distance = 50.881f}
-        }},
-        {116, {
-            {.id = 130, .distance = 30.713f}, {.id = 131, .distance = 32.961f}, {.id = 115, .distance = 34.288f}, {.id = 117, .distance = 34.333f}, {.id = 108, .distance = 36.041f}, {.id = 107, .distance = 36.663f}, {.id = 129, .distance = 47.436f}
-        }},
-        {117, {
-            {.id = 108, .distance = 28.148f}, {.id = 132, .distance = 28.795f}, {.id = 118, .distance = 32.474f}, {.id = 116, .distance = 34.333f}, {.id = 133, .distance = 37.853f}, {.id = 131, .distance = 39.529f}, {.id = 109, .distance = 52.029f}
-        }},
-        {118, {
-            {.id = 134, .distance = 30.978f}, {.id = 117, .distance = 32.474f}, {.id = 133, .distance = 33.378f}, {.id = 119, .distance = 34.135f}, {.id = 108, .distance = 36.581f}, {.id = 109, .distance = 36.663f}, {.id = 135, .distance = 47.075f}
-        }},
-        {119, {
-            {.id = 109, .distance = 28.784f}, {.id = 135, .distance = 29.314f}, {.id = 110, .distance = 32.709f}, {.id = 118, .distance = 34.135f}, {.id = 120, .distance = 35.428f}, {.id = 134, .distance = 42.934f}, {.id = 105, .distance = 52.730f}
-        }},
-        {120, {
-            {.id = 137, .distance = 31.937f}, {.id = 136, .distance = 31.964f}, {.id = 135, .distance = 32.088f}, {.id = 121, .distance = 32.704f}, {.id = 119, .distance = 35.428f}, {.id = 110, .distance = 35.999f}, {.id = 157, .distance = 49.921f}
-        }},
-        {121, {
-            {.id = 138, .distance = 29.419f}, {.id = 110, .distance = 29.943f}, {.id = 122, .distance = 32.468f}, {.id = 120, .distance = 32.704f}, {.id = 137, .distance = 37.491f}, {.id = 139, .distance = 41.947f}, {.id = 111, .distance = 46.465f}
-        }},
-        {122, {
-            {.id = 139, .distance = 29.848f}, {.id = 111, .distance = 31.091f}, {.id = 123, .distance = 31.917f}, {.id = 121, .distance = 32.468f}, {.id = 140, .distance = 35.426f}, {.id = 110, .distance = 43.146f}, {.id = 138, .distance = 44.568f}
-        }},
-        {123, {
-            {.id = 141, .distance = 30.775f}, {.id = 122, .distance = 31.917f}, {.id = 124, .distance = 32.089f}, {.id = 140, .distance = 33.457f}, {.id = 111, .distance = 33.997f}, {.id = 112, .distance = 39.001f}, {.id = 142, .distance = 47.195f}
-        }},
-        {124, {
-            {.id = 142, .distance = 28.126f}, {.id = 112, .distance = 28.795f}, {.id = 123, .distance = 32.089f}, {.id = 125, .distance = 33.350f}, {.id = 141, .distance = 38.606f}, {.id = 143, .distance = 40.686f}, {.id = 111, .distance = 50.872f}
-        }},
-        {125, {
-            {.id = 143, .distance = 30.745f}, {.id = 126, .distance = 32.585f}, {.id = 113, .distance = 33.326f}, {.id = 124, .distance = 33.350f}, {.id = 144, .distance = 33.990f}, {.id = 112, .distance = 39.043f}, {.id = 142, .distance = 47.230f}
-        }},
-        {126, {
-            {.id = 145, .distance = 30.088f}, {.id = 113, .distance = 30.119f}, {.id = 127, .distance = 32.298f}, {.id = 125, .distance = 32.585f}, {.id = 144, .distance = 35.628f}, {.id = 114, .distance = 42.036f}, {.id = 146, .distance = 44.864f}
-        }},
-        {127, {
-            {.id = 146, .distance = 28.726f}, {.id = 114, .distance = 29.271f}, {.id = 128, .distance = 31.916f}, {.id = 126, .distance = 32.298f}, {.id = 147, .distance = 37.444f}, {.id = 145, .distance = 42.067f}, {.id = 113, .distance = 46.032f}
-        }},
-        {128, {
-            {.id = 147, .distance = 31.889f}, {.id = 127, .distance = 31.916f}, {.id = 148, .distance = 32.458f}, {.id = 129, .distance = 32.605f}, {.id = 114, .distance = 35.475f}, {.id = 115, .distance = 35.680f}, {.id = 146, .distance = 49.358f}
-        }},
-        {129, {
-            {.id = 149, .distance = 28.557f}, {.id = 115, .distance = 30.515f}, {.id = 128, .distance = 32.605f}, {.id = 130, .distance = 33.386f}, {.id = 148, .distance = 36.707f}, {.id = 150, .distance = 42.276f}, {.id = 116, .distance = 47.436f}
-        }},
-        {130, {
-            {.id = 150, .distance = 29.283f}, {.id = 116, .distance = 30.713f}, {.id = 131, .distance = 32.395f}, {.id = 129, .distance = 33.386f}, {.id = 151, .distance = 35.383f}, {.id = 115, .distance = 43.747f}, {.id = 149, .distance = 45.069f}
-        }},
-        {131, {
-            {.id = 152, .distance = 30.492f}, {.id = 130, .distance = 32.395f}, {.id = 132, .distance = 32.492f}, {.id = 116, .distance = 32.961f}, {.id = 151, .distance = 33.774f}, {.id = 117, .distance = 39.529f}, {.id = 153, .distance = 46.947f}
-        }},
-        {132, {
-            {.id = 117, .distance = 28.795f}, {.id = 153, .distance = 28.796f}, {.id = 133, .distance = 31.301f}, {.id = 131, .distance = 32.492f}, {.id = 154, .distance = 39.130f}, {.id = 152, .distance = 39.658f}, {.id = 118, .distance = 50.236f}
-        }},
-        {133, {
-            {.id = 154, .distance = 30.076f}, {.id = 132, .distance = 31.301f}, {.id = 134, .distance = 33.324f}, {.id = 118, .distance = 33.378f}, {.id = 155, .distance = 33.386f}, {.id = 117, .distance = 37.853f}, {.id = 153, .distance = 46.778f}
-        }},
-        {134, {
-            {.id = 156, .distance = 29.653f}, {.id = 118, .distance = 30.978f}, {.id = 135, .distance = 32.852f}, {.id = 133, .distance = 33.324f}, {.id = 155, .distance = 35.446f}, {.id = 119, .distance = 42.934f}, {.id = 157, .distance = 44.581f}
-        }},
-        {135, {
-            {.id = 157, .distance = 28.776f}, {.id = 119, .distance = 29.314f}, {.id = 120, .distance = 32.088f}, {.id = 134, .distance = 32.852f}, {.id = 136, .distance = 36.954f}, {.id = 156, .distance = 42.498f}, {.id = 118, .distance = 47.075f}
-        }},
-        {136, {
-            {.id = 158, .distance = 23.617f}, {.id = 157, .distance = 31.442f}, {.id = 120, .distance = 31.964f}, {.id = 137, .distance = 32.702f}, {.id = 135, .distance = 36.954f}, {.id = 205, .distance = 41.259f}, {.id = 207, .distance = 45.103f}
-        }},
-        {137, {
-            {.id = 120, .distance = 31.937f}, {.id = 136, .distance = 32.702f}, {.id = 138, .distance = 32.725f}, {.id = 159, .distance = 36.068f}, {.id = 121, .distance = 37.491f}, {.id = 160, .distance = 39.068f}, {.id = 158, .distance = 41.895f}
-        }},
-        {138, {
-            {.id = 121, .distance = 29.419f}, {.id = 139, .distance = 30.638f}, {.id = 137, .distance = 32.725f}, {.id = 160, .distance = 35.794f}, {.id = 161, .distance = 36.665f}, {.id = 122, .distance = 44.568f}, {.id = 162, .distance = 46.412f}
-        }},
-        {139, {
-            {.id = 162, .distance = 24.191f}, {.id = 122, .distance = 29.848f}, {.id = 138, .distance = 30.638f}, {.id = 140, .distance = 31.516f}, {.id = 121, .distance = 41.947f}, {.id = 163, .distance = 44.167f}, {.id = 161, .distance = 44.460f}
-        }},
-        {140, {
-            {.id = 167, .distance = 27.519f}, {.id = 139, .distance = 31.516f}, {.id = 141, .distance = 33.096f}, {.id = 123, .distance = 33.457f}, {.id = 122, .distance = 35.426f}, {.id = 164, .distance = 35.506f}, {.id = 162, .distance = 36.051f}
-        }},
-        {141, {
-            {.id = 123, .distance = 30.775f}, {.id = 142, .distance = 30.943f}, {.id = 167, .distance = 31.347f}, {.id = 140, .distance = 33.096f}, {.id = 169, .distance = 37.393f}, {.id = 124, .distance = 38.606f}, {.id = 168, .distance = 45.102f}
-        }},
-        {142, {
-            {.id = 124, .distance = 28.126f}, {.id = 141, .distance = 30.943f}, {.id = 143, .distance = 32.322f}, {.id = 170, .distance = 33.115f}, {.id = 169, .distance = 43.474f}, {.id = 171, .distance = 44.048f}, {.id = 123, .distance = 47.195f}
-        }},
-        {143, {
-            {.id = 173, .distance = 30.540f}, {.id = 125, .distance = 30.745f}, {.id = 142, .distance = 32.322f}, {.id = 144, .distance = 32.441f}, {.id = 171, .distance = 37.153f}, {.id = 124, .distance = 40.686f}, {.id = 172, .distance = 45.279f}
-        }},
-        {144, {
-            {.id = 173, .distance = 27.373f}, {.id = 145, .distance = 31.563f}, {.id = 143, .distance = 32.441f}, {.id = 125, .distance = 33.990f}, {.id = 175, .distance = 35.618f}, {.id = 126, .distance = 35.628f}, {.id = 177, .distance = 36.566f}
-        }},
-        {145, {
-            {.id = 177, .distance = 24.293f}, {.id = 126, .distance = 30.088f}, {.id = 144, .distance = 31.563f}, {.id = 146, .distance = 31.793f}, {.id = 127, .distance = 42.067f}, {.id = 178, .distance = 43.775f}, {.id = 179, .distance = 43.787f}
-        }},
-        {146, {
-            {.id = 127, .distance = 28.726f}, {.id = 147, .distance = 31.427f}, {.id = 145, .distance = 31.793f}, {.id = 180, .distance = 35.922f}, {.id = 179, .distance = 37.333f}, {.id = 126, .distance = 44.864f}, {.id = 177, .distance = 47.704f}
-        }},
-        {147, {
-            {.id = 146, .distance = 31.427f}, {.id = 128, .distance = 31.889f}, {.id = 148, .distance = 32.342f}, {.id = 181, .distance = 35.562f}, {.id = 127, .distance = 37.444f}, {.id = 180, .distance = 39.243f}, {.id = 183, .distance = 41.982f}
-        }},
-        {148, {
-            {.id = 183, .distance = 23.803f}, {.id = 149, .distance = 31.693f}, {.id = 147, .distance = 32.342f}, {.id = 128, .distance = 32.458f}, {.id = 129, .distance = 36.707f}, {.id = 185, .distance = 41.333f}, {.id = 182, .distance = 44.974f}
-        }},
-        {149, {
-            {.id = 187, .distance = 24.410f}, {.id = 129, .distance = 28.557f}, {.id = 148, .distance = 31.693f}, {.id = 150, .distance = 32.138f}, {.id = 185, .distance = 38.124f}, {.id = 183, .distance = 43.096f}, {.id = 130, .distance = 45.069f}
-        }},
-        {150, {
-            {.id = 130, .distance = 29.283f}, {.id = 151, .distance = 31.589f}, {.id = 149, .distance = 32.138f}, {.id = 189, .distance = 36.174f}, {.id = 187, .distance = 36.927f}, {.id = 129, .distance = 42.276f}, {.id = 190, .distance = 43.787f}
-        }},
-        {151, {
-            {.id = 150, .distance = 31.589f}, {.id = 152, .distance = 32.185f}, {.id = 190, .distance = 33.528f}, {.id = 131, .distance = 33.774f}, {.id = 130, .distance = 35.383f}, {.id = 191, .distance = 39.292f}, {.id = 189, .distance = 48.151f}
-        }},
-        {152, {
-            {.id = 193, .distance = 26.800f}, {.id = 131, .distance = 30.492f}, {.id = 153, .distance = 31.085f}, {.id = 151, .distance = 32.185f}, {.id = 132, .distance = 39.658f}, {.id = 191, .distance = 40.843f}, {.id = 192, .distance = 44.297f}
-        }},
-        {153, {
-            {.id = 132, .distance = 28.796f}, {.id = 152, .distance = 31.085f}, {.id = 193, .distance = 31.165f}, {.id = 154, .distance = 31.748f}, {.id = 197, .distance = 32.025f}, {.id = 195, .distance = 35.484f}, {.id = 133, .distance = 46.778f}
-        }},
-        {154, {
-            {.id = 197, .distance = 26.974f}, {.id = 133, .distance = 30.076f}, {.id = 155, .distance = 31.574f}, {.id = 153, .distance = 31.748f}, {.id = 132, .distance = 39.130f}, {.id = 199, .distance = 40.759f}, {.id = 198, .distance = 44.255f}
-        }},
-        {155, {
-            {.id = 154, .distance = 31.574f}, {.id = 156, .distance = 32.495f}, {.id = 133, .distance = 33.386f}, {.id = 200, .distance = 34.006f}, {.id = 134, .distance = 35.446f}, {.id = 199, .distance = 40.058f}, {.id = 201, .distance = 48.765f}
-        }},
-        {156, {
-            {.id = 134, .distance = 29.653f}, {.id = 157, .distance = 31.761f}, {.id = 155, .distance = 32.495f}, {.id = 201, .distance = 35.652f}, {.id = 203, .distance = 35.973f}, {.id = 135, .distance = 42.498f}, {.id = 200, .distance = 43.930f}
-        }},
-        {157, {
-            {.id = 203, .distance = 24.656f}, {.id = 135, .distance = 28.776f}, {.id = 136, .distance = 31.442f}, {.id = 156, .distance = 31.761f}, {.id = 205, .distance = 38.273f}, {.id = 158, .distance = 43.129f}, {.id = 134, .distance = 44.581f}
-        }},
-        {158, {
-            {.id = 207, .distance = 22.863f}, {.id = 136, .distance = 23.617f}, {.id = 205, .distance = 27.856f}, {.id = 206, .distance = 35.561f}, {.id = 159, .distance = 37.917f}, {.id = 137, .distance = 41.895f}, {.id = 157, .distance = 43.129f}
-        }},
-        {159, {
-            {.id = 207, .distance = 28.096f}, {.id = 160, .distance = 29.153f}, {.id = 305, .distance = 30.348f}, {.id = 137, .distance = 36.068f}, {.id = 158, .distance = 37.917f}, {.id = 306, .distance = 40.389f}, {.id = 304, .distance = 42.996f}
-        }},
-        {160, {
-            {.id = 161, .distance = 28.265f}, {.id = 159, .distance = 29.153f}, {.id = 304, .distance = 30.701f}, {.id = 138, .distance = 35.794f}, {.id = 137, .distance = 39.068f}, {.id = 305, .distance = 41.296f}, {.id = 303, .distance = 42.964f}
-        }},
-        {161, {
-            {.id = 160, .distance = 28.265f}, {.id = 163, .distance = 28.989f}, {.id = 303, .distance = 30.177f}, {.id = 138, .distance = 36.665f}, {.id = 162, .distance = 38.712f}, {.id = 304, .distance = 40.393f}, {.id = 302, .distance = 43.166f}
-        }},
-        {162, {
-            {.id = 163, .distance = 23.607f}, {.id = 139, .distance = 24.191f}, {.id = 164, .distance = 27.455f}, {.id = 165, .distance = 35.536f}, {.id = 140, .distance = 36.051f}, {.id = 161, .distance = 38.712f}, {.id = 138, .distance = 46.412f}
-        }},
-        {163, {
-            {.id = 162, .distance = 23.607f}, {.id = 165, .distance = 28.500f}, {.id = 161, .distance = 28.989f}, {.id = 302, .distance = 30.411f}, {.id = 164, .distance = 38.998f}, {.id = 303, .distance = 40.517f}, {.id = 300, .distance = 42.490f}
-        }},
-        {164, {
-            {.id = 165, .distance = 25.823f}, {.id = 166, .distance = 26.007f}, {.id = 167, .distance = 27.304f}, {.id = 162, .distance = 27.455f}, {.id = 140, .distance = 35.506f}, {.id = 163, .distance = 38.998f}, {.id = 168, .distance = 39.242f}
-        }},
-        {165, {
-            {.id = 164, .distance = 25.823f}, {.id = 163, .distance = 28.500f}, {.id = 300, .distance = 30.395f}, {.id = 166, .distance = 30.900f}, {.id = 162, .distance = 35.536f}, {.id = 302, .distance = 40.607f}, {.id = 922, .distance = 51.576f}
-        }},
-        {166, {
-            {.id = 164, .distance = 26.007f}, {.id = 922, .distance = 28.617f}, {.id = 168, .distance = 29.614f}, {.id = 165, .distance = 30.900f}, {.id = 167, .distance = 35.963f}, {.id = 920, .distance = 40.055f}, {.id = 924, .distance = 51.485f}
-        }},
-        {167, {
-            {.id = 168, .distance = 23.404f}, {.id = 164, .distance = 27.304f}, {.id = 140, .distance = 27.519f}, {.id = 141, .distance = 31.347f}, {.id = 166, .distance = 35.963f}, {.id = 169, .distance = 38.924f}, {.id = 162, .distance = 47.034f}
-        }},
-        {168, {
-            {.id = 167, .distance = 23.404f}, {.id = 169, .distance = 28.584f}, {.id = 920, .distance = 28.673f}, {.id = 166, .distance = 29.614f}, {.id = 164, .distance = 39.242f}, {.id = 919, .distance = 40.304f}, {.id = 922, .distance = 41.739f}
-        }},
-        {169, {
-            {.id = 170, .distance = 28.069f}, {.id = 919, .distance = 28.493f}, {.id = 168, .distance = 28.584f}, {.id = 141, .distance = 37.393f}, {.id = 167, .distance = 38.924f}, {.id = 918, .distance = 39.759f}, {.id = 920, .distance = 41.297f}
-        }},
-        {170, {
-            {.id = 169, .distance = 28.069f}, {.id = 918, .distance = 28.727f}, {.id = 171, .distance = 28.840f}, {.id = 142, .distance = 33.115f}, {.id = 919, .distance = 40.363f}, {.id = 917, .distance = 40.371f}, {.id = 141, .distance = 48.228f}
-        }},
-        {171, {
-            {.id = 917, .distance = 28.767f}, {.id = 170, .distance = 28.840f}, {.id = 172, .distance = 29.098f}, {.id = 143, .distance = 37.153f}, {.id = 173, .distance = 38.371f}, {.id = 916, .distance = 40.238f}, {.id = 918, .distance = 40.952f}
-        }},
-        {172, {
-            {.id = 173, .distance = 23.468f}, {.id = 174, .distance = 28.067f}, {.id = 916, .distance = 28.780f}, {.id = 171, .distance = 29.098f}, {.id = 175, .distance = 37.859f}, {.id = 914, .distance = 39.833f}, {.id = 917, .distance = 41.278f}
-        }},
-        {173, {
-            {.id = 172, .distance = 23.468f}, {.id = 175, .distance = 26.995f}, {.id = 144, .distance = 27.373f}, {.id = 143, .distance = 30.540f}, {.id = 174, .distance = 35.584f}, {.id = 171, .distance = 38.371f}, {.id = 177, .distance = 47.445f}
-        }},
-        {174, {
-            {.id = 175, .distance = 25.235f}, {.id = 172, .distance = 28.067f}, {.id = 914, .distance = 28.700f}, {.id = 176, .distance = 31.314f}, {.id = 173, .distance = 35.584f}, {.id = 916, .distance = 40.865f}, {.id = 912, .distance = 50.956f}
-        }},
-        {175, {
-            {.id = 174, .distance = 25.235f}, {.id = 176, .distance = 25.959f}, {.id = 173, .distance = 26.995f}, {.id = 177, .distance = 28.280f}, {.id = 144, .distance = 35.618f}, {.id = 172, .distance = 37.859f}, {.id = 178, .distance = 39.348f}
-        }},
-        {176, {
-            {.id = 175, .distance = 25.959f}, {.id = 828, .distance = 28.160f}, {.id = 178, .distance = 28.175f}, {.id = 174, .distance = 31.314f}, {.id = 177, .distance = 35.099f}, {.id = 826, .distance = 40.663f}, {.id = 830, .distance = 51.351f}
-        }},
-        {177, {
-            {.id = 178, .distance = 22.858f}, {.id = 145, .distance = 24.293f}, {.id = 175, .distance = 28.280f}, {.id = 176, .distance = 35.099f}, {.id = 144, .distance = 36.566f}, {.id = 179, .distance = 37.718f}, {.id = 173, .distance = 47.445f}
-        }},
-        {178, {
-            {.id = 177, .distance = 22.858f}, {.id = 176, .distance = 28.175f}, {.id = 826, .distance = 28.558f}, {.id = 179, .distance = 28.665f}, {.id = 175, .distance = 39.348f}, {.id = 828, .distance = 39.985f}, {.id = 825, .distance = 41.035f}
-        }},
-        {179, {
-            {.id = 178, .distance = 28.665f}, {.id = 180, .distance = 28.744f}, {.id = 825, .distance = 28.849f}, {.id = 146, .distance = 37.333f}, {.id = 177, .distance = 37.718f}, {.id = 826, .distance = 40.001f}, {.id = 824, .distance = 41.256f}
-        }},
-        {180, {
-            {.id = 824, .distance = 28.628f}, {.id = 181, .distance = 28.665f}, {.id = 179, .distance = 28.744f}, {.id = 146, .distance = 35.922f}, {.id = 147, .distance = 39.243f}, {.id = 825, .distance = 40.208f}, {.id = 823, .distance = 41.096f}
-        }},
-        {181, {
-            {.id = 823, .distance = 28.612f}, {.id = 180, .distance = 28.665f}, {.id = 182, .distance = 28.989f}, {.id = 147, .distance = 35.562f}, {.id = 183, .distance = 37.946f}, {.id = 824, .distance = 39.961f}, {.id = 822, .distance = 41.392f}
-        }},
-        {182, {
-            {.id = 183, .distance = 22.522f}, {.id = 822, .distance = 28.758f}, {.id = 181, .distance = 28.989f}, {.id = 184, .distance = 28.989f}, {.id = 185, .distance = 38.748f}, {.id = 823, .distance = 40.023f}, {.id = 820, .distance = 40.640f}
-        }},
-        {183, {
-            {.id = 182, .distance = 22.522f}, {.id = 148, .distance = 23.803f}, {.id = 185, .distance = 27.573f}, {.id = 184, .distance = 35.430f}, {.id = 181, .distance = 37.946f}, {.id = 147, .distance = 41.982f}, {.id = 149, .distance = 43.096f}
-        }},
-        {184, {
-            {.id = 185, .distance = 25.732f}, {.id = 820, .distance = 28.509f}, {.id = 182, .distance = 28.989f}, {.id = 186, .distance = 30.699f}, {.id = 183, .distance = 35.430f}, {.id = 822, .distance = 40.267f}, {.id = 590, .distance = 50.925f}
-        }},
-        {185, {
-            {.id = 186, .distance = 25.715f}, {.id = 184, .distance = 25.732f}, {.id = 187, .distance = 27.009f}, {.id = 183, .distance = 27.573f}, {.id = 149, .distance = 38.124f}, {.id = 182, .distance = 38.748f}, {.id = 188, .distance = 38.795f}
-        }},
-        {186, {
-            {.id = 185, .distance = 25.715f}, {.id = 188, .distance = 28.587f}, {.id = 590, .distance = 28.672f}, {.id = 184, .distance = 30.699f}, {.id = 187, .distance = 35.180f}, {.id = 588, .distance = 39.803f}, {.id = 820, .distance = 51.337f}
-        }},
-        {187, {
-            {.id = 188, .distance = 23.318f}, {.id = 149, .distance = 24.410f}, {.id = 185, .distance = 27.009f}, {.id = 186, .distance = 35.180f}, {.id = 150, .distance = 36.927f}, {.id = 189, .distance = 38.625f}, {.id = 183, .distance = 47.229f}
-        }},
-        {188, {
-            {.id = 187, .distance = 23.318f}, {.id = 186, .distance = 28.587f}, {.id = 189, .distance = 28.648f}, {.id = 588, .distance = 28.751f}, {.id = 185, .distance = 38.795f}, {.id = 587, .distance = 40.206f}, {.id = 590, .distance = 40.855f}
-        }},
-        {189, {
-            {.id = 188, .distance = 28.648f}, {.id = 190, .distance = 28.678f}, {.id = 587, .distance = 28.736f}, {.id = 150, .distance = 36.174f}, {.id = 187, .distance = 38.625f}, {.id = 586, .distance = 40.338f}, {.id = 588, .distance = 41.267f}
-        }},
-        {190, {
-            {.id = 191, .distance = 28.019f}, {.id = 189, .distance = 28.678f}, {.id = 586, .distance = 28.695f}, {.id = 151, .distance = 33.528f}, {.id = 585, .distance = 39.725f}, {.id = 587, .distance = 40.940f}, {.id = 150, .distance = 43.787f}
-        }},
-        {191, {
-            {.id = 190, .distance = 28.019f}, {.id = 585, .distance = 28.459f}, {.id = 192, .distance = 29.666f}, {.id = 193, .distance = 39.143f}, {.id = 151, .distance = 39.292f}, {.id = 584, .distance = 40.269f}, {.id = 586, .distance = 40.350f}
-        }},
-        {192, {
-            {.id = 193, .distance = 23.574f}, {.id = 584, .distance = 28.638f}, {.id = 194, .distance = 28.796f}, {.id = 191, .distance = 29.666f}, {.id = 195, .distance = 38.536f}, {.id = 582, .distance = 40.019f}, {.id = 585, .distance = 41.284f}
-        }},
-        {193, {
-            {.id = 192, .distance = 23.574f}, {.id = 152, .distance = 26.800f}, {.id = 195, .distance = 27.295f}, {.id = 153, .distance = 31.165f}, {.id = 194, .distance = 35.726f}, {.id = 191, .distance = 39.143f}, {.id = 197, .distance = 46.866f}
-        }},
-        {194, {
-            {.id = 195, .distance = 25.236f}, {.id = 582, .distance = 28.580f}, {.id = 192, .distance = 28.796f}, {.id = 196, .distance = 30.643f}, {.id = 193, .distance = 35.726f}, {.id = 584, .distance = 41.724f}, {.id = 581, .distance = 51.536f}
-        }},
-        {195, {
-            {.id = 194, .distance = 25.236f}, {.id = 196, .distance = 25.701f}, {.id = 193, .distance = 27.295f}, {.id = 197, .distance = 27.601f}, {.id = 153, .distance = 35.484f}, {.id = 192, .distance = 38.536f}, {.id = 198, .distance = 38.536f}
-        }},
-        {196, {
-            {.id = 195, .distance = 25.701f}, {.id = 198, .distance = 28.171f}, {.id = 70, .distance = 29.688f}, {.id = 194, .distance = 30.643f}, {.id = 197, .distance = 35.416f}, {.id = 68, .distance = 41.018f}, {.id = 582, .distance = 51.461f}
-        }},
-        {197, {
-            {.id = 198, .distance = 23.046f}, {.id = 154, .distance = 26.974f}, {.id = 195, .distance = 27.601f}, {.id = 153, .distance = 32.025f}, {.id = 196, .distance = 35.416f}, {.id = 199, .distance = 38.124f}, {.id = 193, .distance = 46.866f}
-        }},
-        {198, {
-            {.id = 197, .distance = 23.046f}, {.id = 196, .distance = 28.171f}, {.id = 199, .distance = 28.796f}, {.id = 68, .distance = 29.876f}, {.id = 195, .distance = 38.536f}, {.id = 70, .distance = 40.900f}, {.id = 67, .distance = 41.797f}
-        }},
-        {199, {
-            {.id = 200, .distance = 28.739f}, {.id = 198, .distance = 28.796f}, {.id = 67, .distance = 29.681f}, {.id = 197, .distance = 38.124f}, {.id = 155, .distance = 40.058f}, {.id = 154, .distance = 40.759f}, {.id = 68, .distance = 41.259f}
-        }},
-        {200, {
-            {.id = 199, .distance = 28.739f}, {.id = 201, .distance = 28.996f}, {.id = 66, .distance = 29.791f}, {.id = 155, .distance = 34.006f}, {.id = 67, .distance = 41.088f}, {.id = 65, .distance = 41.139f}, {.id = 156, .distance = 43.930f}
-        }},
-        {201, {
-            {.id = 202, .distance = 28.539f}, {.id = 200, .distance = 28.996f}, {.id = 65, .distance = 29.681f}, {.id = 156, .distance = 35.652f}, {.id = 203, .distance = 38.072f}, {.id = 64, .distance = 41.093f}, {.id = 66, .distance = 41.276f}
-        }},
-        {202, {
-            {.id = 203, .distance = 23.229f}, {.id = 201, .distance = 28.539f}, {.id = 204, .distance = 29.175f}, {.id = 64, .distance = 29.699f}, {.id = 205, .distance = 38.795f}, {.id = 65, .distance = 41.301f}, {.id = 62, .distance = 41.538f}
-        }},
-        {203, {
-            {.id = 202, .distance = 23.229f}, {.id = 157, .distance = 24.656f}, {.id = 205, .distance = 27.373f}, {.id = 156, .distance = 35.973f}, {.id = 204, .distance = 36.131f}, {.id = 201, .distance = 38.072f}, {.id = 158, .distance = 47.750f}
-        }},
-        {204, {
-            {.id = 205, .distance = 26.133f}, {.id = 62, .distance = 29.050f}, {.id = 202, .distance = 29.175f}, {.id = 206, .distance = 30.723f}, {.id = 203, .distance = 36.131f}, {.id = 64, .distance = 41.569f}, {.id = 61, .distance = 52.210f}
-        }},
-        {205, {
-            {.id = 206, .distance = 25.813f}, {.id = 204, .distance = 26.133f}, {.id = 203, .distance = 27.373f}, {.id = 158, .distance = 27.856f}, {.id = 157, .distance = 38.273f}, {.id = 202, .distance = 38.795f}, {.id = 207, .distance = 39.458f}
-        }},
-        {206, {
-            {.id = 205, .distance = 25.813f}, {.id = 207, .distance = 29.479f}, {.id = 308, .distance = 29.971f}, {.id = 204, .distance = 30.723f}, {.id = 158, .distance = 35.561f}, {.id = 306, .distance = 43.139f}, {.id = 62, .distance = 51.839f}
-        }},
-        {207, {
-            {.id = 158, .distance = 22.863f}, {.id = 159, .distance = 28.096f}, {.id = 206, .distance = 29.479f}, {.id = 306, .distance = 30.294f}, {.id = 205, .distance = 39.458f}, {.id = 308, .distance = 40.925f}, {.id = 305, .distance = 42.556f}
-        }},
-        {208, {
-            {.id = 209, .distance = 25.256f}, {.id = 211, .distance = 25.653f}, {.id = 210, .distance = 25.660f}, {.id = 213, .distance = 26.237f}, {.id = 212, .distance = 26.780f}, {.id = 215, .distance = 53.251f}, {.id = 219, .distance = 53.584f}
-        }},
-        {209, {
-            {.id = 208, .distance = 25.256f}, {.id = 215, .distance = 27.996f}, {.id = 213, .distance = 30.406f}, {.id = 210, .distance = 30.745f}, {.id = 216, .distance = 36.902f}, {.id = 214, .distance = 36.902f}, {.id = 211, .distance = 48.670f}
-        }},
-        {210, {
-            {.id = 208, .distance = 25.660f}, {.id = 217, .distance = 28.138f}, {.id = 211, .distance = 30.016f}, {.id = 209, .distance = 30.745f}, {.id = 218, .distance = 35.779f}, {.id = 216, .distance = 37.730f}, {.id = 212, .distance = 49.623f}
-        }},
-        {211, {
-            {.id = 208, .distance = 25.653f}, {.id = 219, .distance = 27.950f}, {.id = 210, .distance = 30.016f}, {.id = 212, .distance = 30.334f}, {.id = 220, .distance = 36.663f}, {.id = 218, .distance = 36.917f}, {.id = 209, .distance = 48.670f}
-        }},
-        {212, {
-            {.id = 208, .distance = 26.780f}, {.id = 221, .distance = 28.148f}, {.id = 211, .distance = 30.334f}, {.id = 213, .distance = 30.829f}, {.id = 220, .distance = 36.041f}, {.id = 222, .distance = 36.581f}, {.id = 209, .distance = 49.415f}
-        }},
-        {213, {
-            {.id = 208, .distance = 26.237f}, {.id = 223, .distance = 28.784f}, {.id = 209, .distance = 30.406f}, {.id = 212, .distance = 30.829f}, {.id = 214, .distance = 36.136f}, {.id = 222, .distance = 36.663f}, {.id = 211, .distance = 49.028f}
-        }},
-        {214, {
-            {.id = 225, .distance = 29.943f}, {.id = 223, .distance = 32.709f}, {.id = 215, .distance = 33.241f}, {.id = 224, .distance = 35.999f}, {.id = 213, .distance = 36.136f}, {.id = 209, .distance = 36.902f}, {.id = 226, .distance = 43.146f}
-        }},
-        {215, {
-            {.id = 209, .distance = 27.996f}, {.id = 226, .distance = 31.091f}, {.id = 214, .distance = 33.241f}, {.id = 216, .distance = 33.489f}, {.id = 227, .distance = 33.997f}, {.id = 225, .distance = 46.465f}, {.id = 228, .distance = 50.872f}
-        }},
-        {216, {
-            {.id = 228, .distance = 28.795f}, {.id = 215, .distance = 33.489f}, {.id = 217, .distance = 34.526f}, {.id = 209, .distance = 36.902f}, {.id = 210, .distance = 37.730f}, {.id = 227, .distance = 39.001f}, {.id = 229, .distance = 39.043f}
-        }},
-        {217, {
-            {.id = 210, .distance = 28.138f}, {.id = 230, .distance = 30.119f}, {.id = 218, .distance = 32.862f}, {.id = 229, .distance = 33.326f}, {.id = 216, .distance = 34.526f}, {.id = 231, .distance = 46.032f}, {.id = 228, .distance = 51.953f}
-        }},
-        {218, {
-            {.id = 231, .distance = 29.271f}, {.id = 217, .distance = 32.862f}, {.id = 219, .distance = 32.910f}, {.id = 232, .distance = 35.475f}, {.id = 210, .distance = 35.779f}, {.id = 211, .distance = 36.917f}, {.id = 230, .distance = 42.036f}
-        }},
-        {219, {
-            {.id = 211, .distance = 27.950f}, {.id = 233, .distance = 30.515f}, {.id = 218, .distance = 32.910f}, {.id = 220, .distance = 34.288f}, {.id = 232, .distance = 35.680f}, {.id = 234, .distance = 43.747f}, {.id = 210, .distance = 50.881f}
-        }},
-        {220, {
-            {.id = 234, .distance = 30.713f}, {.id = 235, .distance = 32.961f}, {.id = 219, .distance = 34.288f}, {.id = 221, .distance = 34.333f}, {.id = 212, .distance = 36.041f}, {.id = 211, .distance = 36.663f}, {.id = 233, .distance = 47.436f}
-        }},
-        {221, {
-            {.id = 212, .distance = 28.148f}, {.id = 236, .distance = 28.795f}, {.id = 222, .distance = 32.474f}, {.id = 220, .distance = 34.333f}, {.id = 237, .distance = 37.853f}, {.id = 235, .distance = 39.529f}, {.id = 213, .distance = 52.029f}
-        }},
-        {222, {
-            {.id = 238, .distance = 30.978f}, {.id = 221, .distance = 32.474f}, {.id = 237, .distance = 33.378f}, {.id = 223, .distance = 34.135f}, {.id = 212, .distance = 36.581f}, {.id = 213, .distance = 36.663f}, {.id = 239, .distance = 47.075f}
-        }},
-        {223, {
-            {.id = 213, .distance = 28.784f}, {.id = 239, .distance = 29.314f}, {.id = 214, .distance = 32.709f}, {.id = 222, .distance = 34.135f}, {.id = 224, .distance = 35.428f}, {.id = 238, .distance = 42.934f}, {.id = 209, .distance = 52.730f}
-        }},
-        {224, {
-            {.id = 241, .distance = 31.937f}, {.id = 240, .distance = 31.964f}, {.id = 239, .distance = 32.088f}, {.id = 225, .distance = 32.704f}, {.id = 223, .distance = 35.428f}, {.id = 214, .distance = 35.999f}, {.id = 261, .distance = 49.921f}
-        }},
-        {225, {
-            {.id = 242, .distance = 29.419f}, {.id = 214, .distance = 29.943f}, {.id = 226, .distance = 32.468f}, {.id = 224, .distance = 32.704f}, {.id = 241, .distance = 37.491f}, {.id = 243, .distance = 41.947f}, {.id = 215, .distance = 46.465f}
-        }},
-        {226, {
-            {.id = 243, .distance = 29.848f}, {.id = 215, .distance = 31.091f}, {.id = 227, .distance = 31.917f}, {.id = 225, .distance = 32.468f}, {.id = 244, .distance = 35.426f}, {.id = 214, .distance = 43.146f}, {.id = 242, .distance = 44.568f}
-        }},
-        {227, {
-            {.id = 245, .distance = 30.775f}, {.id = 226, .distance = 31.917f}, {.id = 228, .distance = 32.089f}, {.id = 244, .distance = 33.457f}, {.id = 215, .distance = 33.997f}, {.id = 216, .distance = 39.001f}, {.id = 246, .distance = 47.195f}
-        }},
-        {228, {
-            {.id = 246, .distance = 28.126f}, {.id = 216, .distance = 28.795f}, {.id = 227, .distance = 32.089f}, {.id = 229, .distance = 33.350f}, {.id = 245, .distance = 38.606f}, {.id = 247, .distance = 40.686f}, {.id = 215, .distance = 50.872f}
-        }},
-        {229, {
-            {.id = 247, .distance = 30.745f}, {.id = 230, .distance = 32.585f}, {.id = 217, .distance = 33.326f}, {.id = 228, .distance = 33.350f}, {.id = 248, .distance = 33.990f}, {.id = 216, .distance = 39.043f}, {.id = 246, .distance = 47.230f}
-        }},
-        {230, {
-            {.id = 249, .distance = 30.088f}, {.id = 217, .distance = 30.119f}, {.id = 231, .distance = 32.298f}, {.id = 229, .distance = 32.585f}, {.id = 248, .distance = 35.628f}, {.id = 218, .distance = 42.036f}, {.id = 250, .distance = 44.864f}
-        }},
-        {231, {
-            {.id = 250, .distance = 28.726f}, {.id = 218, .distance = 29.271f}, {.id = 232, .distance = 31.916f}, {.id = 230, .distance = 32.298f}, {.id = 251, .distance = 37.444f}, {.id = 249, .distance = 42.067f}, {.id = 217, .distance = 46.032f}
-        }},
-        {232, {
-            {.id = 251, .distance = 31.889f}, {.id = 231, .distance = 31.916f}, {.id = 252, .distance = 32.458f}, {.id = 233, .distance = 32.605f}, {.id = 218, .distance = 35.475f}, {.id = 219, .distance = 35.680f}, {.id = 250, .distance = 49.358f}
-        }},
-        {233, {
-            {.id = 253, .distance = 28.557f}, {.id = 219, .distance = 30.515f}, {.id = 232, .distance = 32.605f}, {.id = 234, .distance = 33.386f}, {.id = 252, .distance = 36.707f}, {.id = 254, .distance = 42.276f}, {.id = 220, .distance = 47.436f}
-        }},
-        {234, {
-            {.id = 254, .distance = 29.283f}, {.id = 220, .distance = 30.713f}, {.id = 235, .distance = 32.395f}, {.id = 233, .distance = 33.386f}, {.id = 255, .distance = 35.383f}, {.id = 219, .distance = 43.747f}, {.id = 253, .distance = 45.069f}
-        }},
-        {235, {
-            {.id = 256, .distance = 30.492f}, {.id = 234, .distance = 32.395f}, {.id = 236, .distance = 32.492f}, {.id = 220, .distance = 32.961f}, {.id = 255, .distance = 33.774f}, {.id = 221, .distance = 39.529f}, {.id = 257, .distance = 46.947f}
-        }},
-        {236, {
-            {.id = 221, .distance = 28.795f}, {.id = 257, .distance = 28.796f}, {.id = 237, .distance = 31.301f}, {.id = 235, .distance = 32.492f}, {.id = 258, .distance = 39.130f}, {.id = 256, .distance = 39.658f}, {.id = 222, .distance = 50.236f}
-        }},
-        {237, {
-            {.id = 258, .distance = 30.076f}, {.id = 236, .distance = 31.301f}, {.id = 238, .distance = 33.324f}, {.id = 222, .distance = 33.378f}, {.id = 259, .distance = 33.386f}, {.id = 221, .distance = 37.853f}, {.id = 257, .distance = 46.778f}
-        }},
-        {238, {
-            {.id = 260, .distance = 29.653f}, {.id = 222, .distance = 30.978f}, {.id = 239, .distance = 32.852f}, {.id = 237, .distance = 33.324f}, {.id = 259, .distance = 35.446f}, {.id = 223, .distance = 42.934f}, {.id = 261, .distance = 44.581f}
-        }},
-        {239, {
-            {.id = 261, .distance = 28.776f}, {.id = 223, .distance = 29.314f}, {.id = 224, .distance = 32.088f}, {.id = 238, .distance = 32.852f}, {.id = 240, .distance = 36.954f}, {.id = 260, .distance = 42.498f}, {.id = 222, .distance = 47.075f}
-        }},
-        {240, {
-            {.id = 262, .distance = 23.617f}, {.id = 261, .distance = 31.442f}, {.id = 224, .distance = 31.964f}, {.id = 241, .distance = 32.703f}, {.id = 239, .distance = 36.954f}, {.id = 309, .distance = 41.259f}, {.id = 311, .distance = 45.103f}
-        }},
-        {241, {
-            {.id = 224, .distance = 31.937f}, {.id = 240, .distance = 32.703f}, {.id = 242, .distance = 32.725f}, {.id = 263, .distance = 36.068f}, {.id = 225, .distance = 37.491f}, {.id = 264, .distance = 39.068f}, {.id = 262, .distance = 41.895f}
-        }},
-        {242, {
-            {.id = 225, .distance = 29.419f}, {.id = 243, .distance = 30.638f}, {.id = 241, .distance = 32.725f}, {.id = 264, .distance = 35.794f}, {.id = 265, .distance = 36.665f}, {.id = 226, .distance = 44.568f}, {.id = 266, .distance = 46.412f}
-        }},
-        {243, {
-            {.id = 266, .distance = 24.191f}, {.id = 226, .distance = 29.848f}, {.id = 242, .distance = 30.638f}, {.id = 244, .distance = 31.516f}, {.id = 225, .distance = 41.947f}, {.id = 267, .distance = 44.167f}, {.id = 265, .distance = 44.460f}
-        }},
-        {244, {
-            {.id = 271, .distance = 27.519f}, {.id = 243, .distance = 31.516f}, {.id = 245, .distance = 33.096f}, {.id = 227, .distance = 33.457f}, {.id = 226, .distance = 35.426f}, {.id = 268, .distance = 35.506f}, {.id = 266, .distance = 36.051f}
-        }},
-        {245, {
-            {.id = 227, .distance = 30.775f}, {.id = 246, .distance = 30.943f}, {.id = 271, .distance = 31.347f}, {.id = 244, .distance = 33.096f}, {.id = 273, .distance = 37.393f}, {.id = 228, .distance = 38.606f}, {.id = 272, .distance = 45.102f}
-        }},
-        {246, {
-            {.id = 228, .distance = 28.126f}, {.id = 245, .distance = 30.943f}, {.id = 247, .distance = 32.322f}, {.id = 274, .distance = 33.115f}, {.id = 273, .distance = 43.474f}, {.id = 275, .distance = 44.048f}, {.id = 227, .distance = 47.195f}
-        }},
-        {247, {
-            {.id = 277, .distance = 30.540f}, {.id = 229, .distance = 30.745f}, {.id = 246, .distance = 32.322f}, {.id = 248, .distance = 32.441f}, {.id = 275, .distance = 37.153f}, {.id = 228, .distance = 40.686f}, {.id = 276, .distance = 45.279f}
-        }},
-        {248, {
-            {.id = 277, .distance = 27.373f}, {.id = 249, .distance = 31.563f}, {.id = 247, .distance = 32.441f}, {.id = 229, .distance = 33.990f}, {.id = 279, .distance = 35.618f}, {.id = 230, .distance = 35.628f}, {.id = 281, .distance = 36.566f}
-        }},
-        {249, {
-            {.id = 281, .distance = 24.293f}, {.id = 230, .distance = 30.088f}, {.id = 248, .distance = 31.563f}, {.id = 250, .distance = 31.793f}, {.id = 231, .distance = 42.067f}, {.id = 282, .distance = 43.775f}, {.id = 283, .distance = 43.787f}
-        }},
-        {250, {
-            {.id = 231, .distance = 28.726f}, {.id = 251, .distance = 31.427f}, {.id = 249, .distance = 31.793f}, {.id = 284, .distance = 35.922f}, {.id = 283, .distance = 37.333f}, {.id = 230, .distance = 44.864f}, {.id = 281, .distance = 47.704f}
-        }},
-        {251, {
-            {.id = 250, .distance = 31.427f}, {.id = 232, .distance = 31.889f}, {.id = 252, .distance = 32.342f}, {.id = 285, .distance = 35.562f}, {.id = 231, .distance = 37.444f}, {.id = 284, .distance = 39.243f}, {.id = 287, .distance = 41.982f}
-        }},
-        {252, {
-            {.id = 287, .distance = 23.803f}, {.id = 253, .distance = 31.693f}, {.id = 251, .distance = 32.342f}, {.id = 232, .distance = 32.458f}, {.id = 233, .distance = 36.707f}, {.id = 289, .distance = 41.333f}, {.id = 286, .distance = 44.974f}
-        }},
-        {253, {
-            {.id = 291, .distance = 24.410f}, {.id = 233, .distance = 28.557f}, {.id = 252, .distance = 31.693f}, {.id = 254, .distance = 32.138f}, {.id = 289, .distance = 38.124f}, {.id = 287, .distance = 43.096f}, {.id = 234, .distance = 45.069f}
-        }},
-        {254, {
-            {.id = 234, .distance = 29.283f}, {.id = 255, .distance = 31.589f}, {.id = 253, .distance = 32.138f}, {.id = 293, .distance = 36.174f}, {.id = 291, .distance = 36.927f}, {.id = 233, .distance = 42.276f}, {.id = 294, .distance = 43.787f}
-        }},
-        {255, {
-            {.id = 254, .distance = 31.589f}, {.id = 256, .distance = 32.185f}, {.id = 294, .distance = 33.528f}, {.id = 235, .distance = 33.774f}, {.id = 234, .distance = 35.383f}, {.id = 295, .distance = 39.292f}, {.id = 293, .distance = 48.151f}
-        }},
-        {256, {
-            {.id = 297, .distance = 26.800f}, {.id = 235, .distance = 30.492f}, {.id = 257, .distance = 31.085f}, {.id = 255, .distance = 32.185f}, {.id = 236, .distance = 39.658f}, {.id = 295, .distance = 40.843f}, {.id = 296, .distance = 44.297f}
-        }},
-        {257, {
-            {.id = 236, .distance = 28.796f}, {.id = 256, .distance = 31.085f}, {.id = 297, .distance = 31.165f}, {.id = 258, .distance = 31.748f}, {.id = 301, .distance = 32.025f}, {.id = 299, .distance = 35.484f}, {.id = 237, .distance = 46.778f}
-        }},
-        {258, {
-            {.id = 301, .distance = 26.974f}, {.id = 237, .distance = 30.076f}, {.id = 259, .distance = 31.574f}, {.id = 257, .distance = 31.748f}, {.id = 236, .distance = 39.130f}, {.id = 303, .distance = 40.759f}, {.id = 302, .distance = 44.255f}
-        }},
-        {259, {
-            {.id = 258, .distance = 31.574f}, {.id = 260, .distance = 32.495f}, {.id = 237, .distance = 33.386f}, {.id = 304, .distance = 34.006f}, {.id = 238, .distance = 35.446f}, {.id = 303, .distance = 40.058f}, {.id = 305, .distance = 48.765f}
-        }},
-        {260, {
-            {.id = 238, .distance = 29.653f}, {.id = 261, .distance = 31.761f}, {.id = 259, .distance = 32.495f}, {.id = 305, .distance = 35.652f}, {.id = 307, .distance = 35.973f}, {.id = 239, .distance = 42.498f}, {.id = 304, .distance = 43.930f}
-        }},
-        {261, {
-            {.id = 307, .distance = 24.656f}, {.id = 239, .distance = 28.776f}, {.id = 240, .distance = 31.442f}, {.id = 260, .distance = 31.761f}, {.id = 309, .distance = 38.273f}, {.id = 262, .distance = 43.129f}, {.id = 238, .distance = 44.581f}
-        }},
-        {262, {
-            {.id = 311, .distance = 22.863f}, {.id = 240, .distance = 23.617f}, {.id = 309, .distance = 27.856f}, {.id = 310, .distance = 35.561f}, {.id = 263, .distance = 37.917f}, {.id = 241, .distance = 41.895f}, {.id = 261, .distance = 43.129f}
-        }},
-        {263, {
-            {.id = 311, .distance = 28.096f}, {.id = 264, .distance = 29.153f}, {.id = 57, .distance = 30.837f}, {.id = 241, .distance = 36.068f}, {.id = 262, .distance = 37.917f}, {.id = 59, .distance = 41.896f}, {.id = 56, .distance = 42.604f}
-        }},
-        {264, {
-            {.id = 265, .distance = 28.265f}, {.id = 263, .distance = 29.153f}, {.id = 56, .distance = 31.737f}, {.id = 242, .distance = 35.794f}, {.id = 241, .distance = 39.068f}, {.id = 57, .distance = 42.312f}, {.id = 55, .distance = 42.604f}
-        }},
-        {265, {
-            {.id = 264, .distance = 28.265f}, {.id = 267, .distance = 28.989f}, {.id = 55, .distance = 30.837f}, {.id = 242, .distance = 36.665f}, {.id = 266, .distance = 38.712f}, {.id = 103, .distance = 42.288f}, {.id = 56, .distance = 42.312f}
-        }},
-        {266, {
-            {.id = 267, .distance = 23.607f}, {.id = 243, .distance = 24.191f}, {.id = 268, .distance = 27.455f}, {.id = 269, .distance = 35.536f}, {.id = 244, .distance = 36.051f}, {.id = 265, .distance = 38.712f}, {.id = 242, .distance = 46.412f}
-        }},
-        {267, {
-            {.id = 266, .distance = 23.607f}, {.id = 269, .distance = 28.500f}, {.id = 265, .distance = 28.989f}, {.id = 103, .distance = 31.044f}, {.id = 268, .distance = 38.998f}, {.id = 55, .distance = 41.896f}, {.id = 102, .distance = 42.722f}
-        }},
-        {268, {
-            {.id = 269, .distance = 25.823f}, {.id = 270, .distance = 26.007f}, {.id = 271, .distance = 27.304f}, {.id = 266, .distance = 27.455f}, {.id = 244, .distance = 35.506f}, {.id = 267, .distance = 38.998f}, {.id = 272, .distance = 39.242f}
-        }},
-        {269, {
-            {.id = 268, .distance = 25.823f}, {.id = 267, .distance = 28.500f}, {.id = 270, .distance = 30.900f}, {.id = 102, .distance = 31.323f}, {.id = 266, .distance = 35.536f}, {.id = 103, .distance = 42.426f}, {.id = 271, .distance = 52.152f}
-        }},
-        {270, {
-            {.id = 268, .distance = 26.007f}, {.id = 412, .distance = 29.051f}, {.id = 272, .distance = 29.614f}, {.id = 269, .distance = 30.900f}, {.id = 271, .distance = 35.963f}, {.id = 410, .distance = 41.540f}, {.id = 414, .distance = 51.840f}
-        }},
-        {271, {
-            {.id = 272, .distance = 23.404f}, {.id = 268, .distance = 27.304f}, {.id = 244, .distance = 27.519f}, {.id = 245, .distance = 31.347f}, {.id = 270, .distance = 35.963f}, {.id = 273, .distance = 38.924f}, {.id = 266, .distance = 47.034f}
-        }},
-        {272, {
-            {.id = 271, .distance = 23.404f}, {.id = 273, .distance = 28.584f}, {.id = 270, .distance = 29.614f}, {.id = 410, .distance = 29.702f}, {.id = 268, .distance = 39.242f}, {.id = 409, .distance = 41.095f}, {.id = 412, .distance = 41.571f}
-        }},
-        {273, {
-            {.id = 274, .distance = 28.069f}, {.id = 272, .distance = 28.584f}, {.id = 409, .distance = 29.685f}, {.id = 245, .distance = 37.393f}, {.id = 271, .distance = 38.924f}, {.id = 408, .distance = 41.143f}, {.id = 410, .distance = 41.304f}
-        }},
-        {274, {
-            {.id = 273, .distance = 28.069f}, {.id = 275, .distance = 28.840f}, {.id = 408, .distance = 29.797f}, {.id = 246, .distance = 33.115f}, {.id = 409, .distance = 41.280f}, {.id = 407, .distance = 41.692f}, {.id = 245, .distance = 48.228f}
-        }},
-        {275, {
-            {.id = 274, .distance = 28.840f}, {.id = 276, .distance = 29.097f}, {.id = 407, .distance = 29.688f}, {.id = 247, .distance = 37.153f}, {.id = 277, .distance = 38.371f}, {.id = 408, .distance = 41.093f}, {.id = 406, .distance = 41.803f}
-        }},
-        {276, {
-            {.id = 277, .distance = 23.468f}, {.id = 278, .distance = 28.068f}, {.id = 275, .distance = 29.097f}, {.id = 406, .distance = 29.884f}, {.id = 279, .distance = 37.859f}, {.id = 404, .distance = 41.024f}, {.id = 407, .distance = 41.264f}
-        }},
-        {277, {
-            {.id = 276, .distance = 23.468f}, {.id = 279, .distance = 26.995f}, {.id = 248, .distance = 27.373f}, {.id = 247, .distance = 30.540f}, {.id = 278, .distance = 35.584f}, {.id = 275, .distance = 38.371f}, {.id = 281, .distance = 47.445f}
-        }},
-        {278, {
-            {.id = 279, .distance = 25.235f}, {.id = 276, .distance = 28.068f}, {.id = 404, .distance = 29.698f}, {.id = 280, .distance = 31.314f}, {.id = 277, .distance = 35.584f}, {.id = 406, .distance = 40.907f}, {.id = 1026, .distance = 50.621f}
-        }},
-        {279, {
-            {.id = 278, .distance = 25.235f}, {.id = 280, .distance = 25.959f}, {.id = 277, .distance = 26.995f}, {.id = 281, .distance = 28.280f}, {.id = 248, .distance = 35.618f}, {.id = 276, .distance = 37.859f}, {.id = 282, .distance = 39.348f}
-        }},
-        {280, {
-            {.id = 279, .distance = 25.959f}, {.id = 1026, .distance = 27.690f}, {.id = 282, .distance = 28.175f}, {.id = 278, .distance = 31.314f}, {.id = 281, .distance = 35.099f}, {.id = 1024, .distance = 39.154f}, {.id = 1027, .distance = 50.900f}
-        }},
-        {281, {
-            {.id = 282, .distance = 22.858f}, {.id = 249, .distance = 24.293f}, {.id = 279, .distance = 28.280f}, {.id = 280, .distance = 35.099f}, {.id = 248, .distance = 36.566f}, {.id = 283, .distance = 37.718f}, {.id = 277, .distance = 47.445f}
-        }},
-        {282, {
-            {.id = 281, .distance = 22.858f}, {.id = 1024, .distance = 27.436f}, {.id = 280, .distance = 28.175f}, {.id = 283, .distance = 28.665f}, {.id = 279, .distance = 39.348f}, {.id = 1026, .distance = 40.114f}, {.id = 1023, .distance = 40.252f}
-        }},
-        {283, {
-            {.id = 1023, .distance = 27.613f}, {.id = 282, .distance = 28.665f}, {.id = 284, .distance = 28.744f}, {.id = 250, .distance = 37.333f}, {.id = 281, .distance = 37.718f}, {.id = 1022, .distance = 39.855f}, {.id = 1024, .distance = 39.947f}
-        }},
-        {284, {
-            {.id = 1022, .distance = 27.498f}, {.id = 285, .distance = 28.665f}, {.id = 283, .distance = 28.744f}, {.id = 250, .distance = 35.922f}, {.id = 251, .distance = 39.243f}, {.id = 1023, .distance = 39.255f}, {.id = 1021, .distance = 39.752f}
-        }},
-        {285, {
-            {.id = 1021, .distance = 27.628f}, {.id = 284, .distance = 28.665f}, {.id = 286, .distance = 28.989f}, {.id = 251, .distance = 35.562f}, {.id = 287, .distance = 37.946f}, {.id = 1022, .distance = 39.790f}, {.id = 1020, .distance = 39.805f}
-        }},
-        {286, {
-            {.id = 287, .distance = 22.522f}, {.id = 1020, .distance = 27.583f}, {.id = 288, .distance = 28.989f}, {.id = 285, .distance = 28.989f}, {.id = 289, .distance = 38.748f}, {.id = 1018, .distance = 39.435f}, {.id = 1021, .distance = 40.007f}
-        }},
-        {287, {
-            {.id = 286, .distance = 22.522f}, {.id = 252, .distance = 23.803f}, {.id = 289, .distance = 27.573f}, {.id = 288, .distance = 35.430f}, {.id = 285, .distance = 37.946f}, {.id = 251, .distance = 41.982f}, {.id = 253, .distance = 43.096f}
-        }},
-        {288, {
-            {.id = 289, .distance = 25.732f}, {.id = 1018, .distance = 27.473f}, {.id = 286, .distance = 28.989f}, {.id = 290, .distance = 30.699f}, {.id = 287, .distance = 35.430f}, {.id = 1020, .distance = 40.223f}, {.id = 1016, .distance = 49.900f}
-        }},
-        {289, {
-            {.id = 290, .distance = 25.715f}, {.id = 288, .distance = 25.732f}, {.id = 291, .distance = 27.009f}, {.id = 287, .distance = 27.573f}, {.id = 253, .distance = 38.124f}, {.id = 286, .distance = 38.748f}, {.id = 292, .distance = 38.795f}
-        }},
-        {290, {
-            {.id = 289, .distance = 25.715f}, {.id = 932, .distance = 27.990f}, {.id = 292, .distance = 28.587f}, {.id = 288, .distance = 30.699f}, {.id = 291, .distance = 35.180f}, {.id = 930, .distance = 41.739f}, {.id = 934, .distance = 50.403f}
-        }},
-        {291, {
-            {.id = 292, .distance = 23.318f}, {.id = 253, .distance = 24.410f}, {.id = 289, .distance = 27.009f}, {.id = 290, .distance = 35.180f}, {.id = 254, .distance = 36.927f}, {.id = 293, .distance = 38.625f}, {.id = 287, .distance = 47.229f}
-        }},
-        {292, {
-            {.id = 291, .distance = 23.318f}, {.id = 930, .distance = 28.526f}, {.id = 290, .distance = 28.587f}, {.id = 293, .distance = 28.648f}, {.id = 289, .distance = 38.795f}, {.id = 932, .distance = 39.023f}, {.id = 929, .distance = 41.888f}
-        }},
-        {293, {
-            {.id = 292, .distance = 28.648f}, {.id = 294, .distance = 28.678f}, {.id = 929, .distance = 28.720f}, {.id = 254, .distance = 36.174f}, {.id = 291, .distance = 38.625f}, {.id = 930, .distance = 38.975f}, {.id = 928, .distance = 42.065f}
-        }},
-        {294, {
-            {.id = 295, .distance = 28.019f}, {.id = 928, .distance = 28.593f}, {.id = 293, .distance = 28.678f}, {.id = 255, .distance = 33.528f}, {.id = 929, .distance = 39.193f}, {.id = 927, .distance = 42.010f}, {.id = 254, .distance = 43.787f}
-        }},
-        {295, {
-            {.id = 294, .distance = 28.019f}, {.id = 927, .distance = 28.538f}, {.id = 296, .distance = 29.666f}, {.id = 928, .distance = 38.440f}, {.id = 297, .distance = 39.143f}, {.id = 255, .distance = 39.292f}, {.id = 256, .distance = 40.843f}
-        }},
-        {296, {
-            {.id = 297, .distance = 23.574f}, {.id = 926, .distance = 28.586f}, {.id = 298, .distance = 28.796f}, {.id = 295, .distance = 29.666f}, {.id = 299, .distance = 38.536f}, {.id = 927, .distance = 38.933f}, {.id = 924, .distance = 41.429f}
-        }},
-        {297, {
-            {.id = 296, .distance = 23.574f}, {.id = 256, .distance = 26.800f}, {.id = 299, .distance = 27.295f}, {.id = 257, .distance = 31.165f}, {.id = 298, .distance = 35.726f}, {.id = 295, .distance = 39.143f}, {.id = 301, .distance = 46.866f}
-        }},
-        {298, {
-            {.id = 299, .distance = 25.236f}, {.id = 924, .distance = 28.551f}, {.id = 296, .distance = 28.796f}, {.id = 300, .distance = 30.642f}, {.id = 297, .distance = 35.726f}, {.id = 926, .distance = 39.222f}, {.id = 301, .distance = 51.793f}
-        }},
-        {299, {
-            {.id = 298, .distance = 25.236f}, {.id = 300, .distance = 25.701f}, {.id = 297, .distance = 27.295f}, {.id = 301, .distance = 27.601f}, {.id = 257, .distance = 35.484f}, {.id = 296, .distance = 38.536f}, {.id = 302, .distance = 38.536f}
-        }},
-        {300, {
-            {.id = 299, .distance = 25.701f}, {.id = 302, .distance = 28.171f}, {.id = 165, .distance = 30.395f}, {.id = 298, .distance = 30.642f}, {.id = 301, .distance = 35.416f}, {.id = 163, .distance = 42.490f}, {.id = 924, .distance = 50.454f}
-        }},
-        {301, {
-            {.id = 302, .distance = 23.046f}, {.id = 258, .distance = 26.974f}, {.id = 299, .distance = 27.601f}, {.id = 257, .distance = 32.025f}, {.id = 300, .distance = 35.416f}, {.id = 303, .distance = 38.124f}, {.id = 297, .distance = 46.866f}
-        }},
-        {302, {
-            {.id = 301, .distance = 23.046f}, {.id = 300, .distance = 28.171f}, {.id = 303, .distance = 28.796f}, {.id = 163, .distance = 30.411f}, {.id = 299, .distance = 38.536f}, {.id = 165, .distance = 40.607f}, {.id = 161, .distance = 43.166f}
-        }},
-        {303, {
-            {.id = 304, .distance = 28.739f}, {.id = 302, .distance = 28.796f}, {.id = 161, .distance = 30.177f}, {.id = 301, .distance = 38.124f}, {.id = 259, .distance = 40.058f}, {.id = 163, .distance = 40.517f}, {.id = 258, .distance = 40.759f}
-        }},
-        {304, {
-            {.id = 303, .distance = 28.739f}, {.id = 305, .distance = 28.996f}, {.id = 160, .distance = 30.701f}, {.id = 259, .distance = 34.006f}, {.id = 161, .distance = 40.393f}, {.id = 159, .distance = 42.996f}, {.id = 260, .distance = 43.930f}
-        }},
-        {305, {
-            {.id = 306, .distance = 28.539f}, {.id = 304, .distance = 28.996f}, {.id = 159, .distance = 30.348f}, {.id = 260, .distance = 35.652f}, {.id = 307, .distance = 38.072f}, {.id = 160, .distance = 41.296f}, {.id = 207, .distance = 42.556f}
-        }},
-        {306, {
-            {.id = 307, .distance = 23.229f}, {.id = 305, .distance = 28.539f}, {.id = 308, .distance = 29.175f}, {.id = 207, .distance = 30.294f}, {.id = 309, .distance = 38.795f}, {.id = 159, .distance = 40.389f}, {.id = 206, .distance = 43.139f}
-        }},
-        {307, {
-            {.id = 306, .distance = 23.229f}, {.id = 261, .distance = 24.656f}, {.id = 309, .distance = 27.373f}, {.id = 260, .distance = 35.973f}, {.id = 308, .distance = 36.131f}, {.id = 305, .distance = 38.072f}, {.id = 262, .distance = 47.750f}
-        }},
-        {308, {
-            {.id = 309, .distance = 26.133f}, {.id = 306, .distance = 29.175f}, {.id = 206, .distance = 29.971f}, {.id = 310, .distance = 30.723f}, {.id = 307, .distance = 36.131f}, {.id = 207, .distance = 40.925f}, {.id = 262, .distance = 52.753f}
-        }},
-        {309, {
-            {.id = 310, .distance = 25.813f}, {.id = 308, .distance = 26.133f}, {.id = 307, .distance = 27.373f}, {.id = 262, .distance = 27.856f}, {.id = 261, .distance = 38.273f}, {.id = 306, .distance = 38.795f}, {.id = 311, .distance = 39.458f}
-        }},
-        {310, {
-            {.id = 309, .distance = 25.813f}, {.id = 311, .distance = 29.479f}, {.id = 308, .distance = 30.723f}, {.id = 61, .distance = 31.323f}, {.id = 262, .distance = 35.561f}, {.id = 59, .distance = 42.722f}, {.id = 206, .distance = 51.871f}
-        }},
-        {311, {
-            {.id = 262, .distance = 22.863f}, {.id = 263, .distance = 28.096f}, {.id = 310, .distance = 29.479f}, {.id = 59, .distance = 31.044f}, {.id = 309, .distance = 39.458f}, {.id = 57, .distance = 42.288f}, {.id = 61, .distance = 42.426f}
-        }},
-        {312, {
-            {.id = 313, .distance = 25.256f}, {.id = 315, .distance = 25.653f}, {.id = 314, .distance = 25.660f}, {.id = 317, .distance = 26.237f}, {.id = 316, .distance = 26.780f}, {.id = 319, .distance = 53.251f}, {.id = 323, .distance = 53.584f}
-        }},
-        {313, {
-            {.id = 312, .distance = 25.256f}, {.id = 319, .distance = 27.996f}, {.id = 317, .distance = 30.406f}, {.id = 314, .distance = 30.746f}, {.id = 320, .distance = 36.902f}, {.id = 318, .distance = 36.902f}, {.id = 315, .distance = 48.670f}
-        }},
-        {314, {
-            {.id = 312, .distance = 25.660f}, {.id = 321, .distance = 28.138f}, {.id = 315, .distance = 30.016f}, {.id = 313, .distance = 30.746f}, {.id = 322, .distance = 35.779f}, {.id = 320, .distance = 37.730f}, {.id = 316, .distance = 49.623f}
-        }},
-        {315, {
-            {.id = 312, .distance = 25.653f}, {.id = 323, .distance = 27.950f}, {.id = 314, .distance = 30.016f}, {.id = 316, .distance = 30.334f}, {.id = 324, .distance = 36.663f}, {.id = 322, .distance = 36.917f}, {.id = 313, .distance = 48.670f}
-        }},
-        {316, {
-            {.id = 312, .distance = 26.780f}, {.id = 325, .distance = 28.148f}, {.id = 315, .distance = 30.334f}, {.id = 317, .distance = 30.829f}, {.id = 324, .distance = 36.041f}, {.id = 326, .distance = 36.581f}, {.id = 313, .distance = 49.415f}
-        }},
-        {317, {
-            {.id = 312, .distance = 26.237f}, {.id = 327, .distance = 28.784f}, {.id = 313, .distance = 30.406f}, {.id = 316, .distance = 30.829f}, {.id = 318, .distance = 36.136f}, {.id = 326, .distance = 36.663f}, {.id = 315, .distance = 49.028f}
-        }},
-        {318, {
-            {.id = 329, .distance = 29.943f}, {.id = 327, .distance = 32.709f}, {.id = 319, .distance = 33.241f}, {.id = 328, .distance = 35.999f}, {.id = 317, .distance = 36.136f}, {.id = 313, .distance = 36.902f}, {.id = 330, .distance = 43.146f}
-        }},
-        {319, {
-            {.id = 313, .distance = 27.996f}, {.id = 330, .distance = 31.091f}, {.id = 318, .distance = 33.241f}, {.id = 320, .distance = 33.489f}, {.id = 331, .distance = 33.997f}, {.id = 329, .distance = 46.465f}, {.id = 332, .distance = 50.872f}
-        }},
-        {320, {
-            {.id = 332, .distance = 28.795f}, {.id = 319, .distance = 33.489f}, {.id = 321, .distance = 34.526f}, {.id = 313, .distance = 36.902f}, {.id = 314, .distance = 37.730f}, {.id = 331, .distance = 39.001f}, {.id = 333, .distance = 39.043f}
-        }},
-        {321, {
-            {.id = 314, .distance = 28.138f}, {.id = 334, .distance = 30.119f}, {.id = 322, .distance = 32.862f}, {.id = 333, .distance = 33.326f}, {.id = 320, .distance = 34.526f}, {.id = 335, .distance = 46.032f}, {.id = 332, .distance = 51.953f}
-        }},
-        {322, {
-            {.id = 335, .distance = 29.271f}, {.id = 321, .distance = 32.862f}, {.id = 323, .distance = 32.910f}, {.id = 336, .distance = 35.475f}, {.id = 314, .distance = 35.779f}, {.id = 315, .distance = 36.917f}, {.id = 334, .distance = 42.036f}
-        }},
-        {323, {
-            {.id = 315, .distance = 27.950f}, {.id = 337, .distance = 30.515f}, {.id = 322, .distance = 32.910f}, {.id = 324, .distance = 34.288f}, {.id = 336, .distance = 35.680f}, {.id = 338, .distance = 43.747f}, {.id = 314, .distance = 50.881f}
-        }},
-        {324, {
-            {.id = 338, .distance = 30.713f}, {.id = 339, .distance = 32.961f}, {.id = 323, .distance = 34.288f}, {.id = 325, .distance = 34.333f}, {.id = 316, .distance = 36.041f}, {.id = 315, .distance = 36.663f}, {.id = 337, .distance = 47.436f}
-        }},
-        {325, {
-            {.id = 316, .distance = 28.148f}, {.id = 340, .distance = 28.795f}, {.id = 326, .distance = 32.474f}, {.id = 324, .distance = 34.333f}, {.id = 341, .distance = 37.853f}, {.id = 339, .distance = 39.529f}, {.id = 317, .distance = 52.029f}
-        }},
-        {326, {
-            {.id = 342, .distance = 30.978f}, {.id = 325, .distance = 32.474f}, {.id = 341, .distance = 33.378f}, {.id = 327, .distance = 34.135f}, {.id = 316, .distance = 36.581f}, {.id = 317, .distance = 36.663f}, {.id = 343, .distance = 47.075f}
-        }},
-        {327, {
-            {.id = 317, .distance = 28.784f}, {.id = 343, .distance = 29.314f}, {.id = 318, .distance = 32.709f}, {.id = 326, .distance = 34.135f}, {.id = 328, .distance = 35.428f}, {.id = 342, .distance = 42.934f}, {.id = 313, .distance = 52.730f}
-        }},
-        {328, {
-            {.id = 345, .distance = 31.937f}, {.id = 344, .distance = 31.964f}, {.id = 343, .distance = 32.088f}, {.id = 329, .distance = 32.704f}, {.id = 327, .distance = 35.428f}, {.id = 318, .distance = 35.999f}, {.id = 365, .distance = 49.921f}
-        }},
-        {329, {
-            {.id = 346, .distance = 29.419f}, {.id = 318, .distance = 29.943f}, {.id = 330, .distance = 32.468f}, {.id = 328, .distance = 32.704f}, {.id = 345, .distance = 37.491f}, {.id = 347, .distance = 41.947f}, {.id = 319, .distance = 46.465f}
-        }},
-        {330, {
-            {.id = 347, .distance = 29.848f}, {.id = 319, .distance = 31.091f}, {.id = 331, .distance = 31.917f}, {.id = 329, .distance = 32.468f}, {.id = 348, .distance = 35.426f}, {.id = 318, .distance = 43.146f}, {.id = 346, .distance = 44.568f}
-        }},
-        {331, {
-            {.id = 349, .distance = 30.775f}, {.id = 330, .distance = 31.917f}, {.id = 332, .distance = 32.089f}, {.id = 348, .distance = 33.457f}, {.id = 319, .distance = 33.997f}, {.id = 320, .distance = 39.001f}, {.id = 350, .distance = 47.195f}
-        }},
-        {332, {
-            {.id = 350, .distance = 28.126f}, {.id = 320, .distance = 28.795f}, {.id = 331, .distance = 32.089f}, {.id = 333, .distance = 33.350f}, {.id = 349, .distance = 38.606f}, {.id = 351, .distance = 40.686f}, {.id = 319, .distance = 50.872f}
-        }},
-        {333, {
-            {.id = 351, .distance = 30.745f}, {.id = 334, .distance = 32.585f}, {.id = 321, .distance = 33.326f}, {.id = 332, .distance = 33.350f}, {.id = 352, .distance = 33.990f}, {.id = 320, .distance = 39.043f}, {.id = 350, .distance = 47.230f}
-        }},
-        {334, {
-            {.id = 353, .distance = 30.088f}, {.id = 321, .distance = 30.119f}, {.id = 335, .distance = 32.298f}, {.id = 333, .distance = 32.585f}, {.id = 352, .distance = 35.628f}, {.id = 322, .distance = 42.036f}, {.id = 354, .distance = 44.864f}
-        }},
-        {335, {
-            {.id = 354, .distance = 28.726f}, {.id = 322, .distance = 29.271f}, {.id = 336, .distance = 31.916f}, {.id = 334, .distance = 32.298f}, {.id = 355, .distance = 37.444f}, {.id = 353, .distance = 42.067f}, {.id = 321, .distance = 46.032f}
-        }},
-        {336, {
-            {.id = 355, .distance = 31.889f}, {.id = 335, .distance = 31.916f}, {.id = 356, .distance = 32.458f}, {.id = 337, .distance = 32.605f}, {.id = 322, .distance = 35.475f}, {.id = 323, .distance = 35.680f}, {.id = 354, .distance = 49.358f}
-        }},
-        {337, {
-            {.id = 357, .distance = 28.557f}, {.id = 323, .distance = 30.515f}, {.id = 336, .distance = 32.605f}, {.id = 338, .distance = 33.386f}, {.id = 356, .distance = 36.707f}, {.id = 358, .distance = 42.276f}, {.id = 324, .distance = 47.436f}
-        }},
-        {338, {
-            {.id = 358, .distance = 29.283f}, {.id = 324, .distance = 30.713f}, {.id = 339, .distance = 32.395f}, {.id = 337, .distance = 33.386f}, {.id = 359, .distance = 35.383f}, {.id = 323, .distance = 43.747f}, {.id = 357, .distance = 45.069f}
-        }},
-        {339, {
-            {.id = 360, .distance = 30.492f}, {.id = 338, .distance = 32.395f}, {.id = 340, .distance = 32.492f}, {.id = 324, .distance = 32.961f}, {.id = 359, .distance = 33.774f}, {.id = 325, .distance = 39.529f}, {.id = 361, .distance = 46.947f}
-        }},
-        {340, {
-            {.id = 325, .distance = 28.795f}, {.id = 361, .distance = 28.796f}, {.id = 341, .distance = 31.301f}, {.id = 339, .distance = 32.492f}, {.id = 362, .distance = 39.130f}, {.id = 360, .distance = 39.658f}, {.id = 326, .distance = 50.236f}
-        }},
-        {341, {
-            {.id = 362, .distance = 30.076f}, {.id = 340, .distance = 31.301f}, {.id = 342, .distance = 33.324f}, {.id = 326, .distance = 33.378f}, {.id = 363, .distance = 33.386f}, {.id = 325, .distance = 37.853f}, {.id = 361, .distance = 46.778f}
-        }},
-        {342, {
-            {.id = 364, .distance = 29.653f}, {.id = 326, .distance = 30.978f}, {.id = 343, .distance = 32.852f}, {.id = 341, .distance = 33.324f}, {.id = 363, .distance = 35.446f}, {.id = 327, .distance = 42.934f}, {.id = 365, .distance = 44.581f}
-        }},
-        {343, {
-            {.id = 365, .distance = 28.776f}, {.id = 327, .distance = 29.314f}, {.id = 328, .distance = 32.088f}, {.id = 342, .distance = 32.852f}, {.id = 344, .distance = 36.954f}, {.id = 364, .distance = 42.498f}, {.id = 326, .distance = 47.075f}
-        }},
-        {344, {
-            {.id = 366, .distance = 23.617f}, {.id = 365, .distance = 31.442f}, {.id = 328, .distance = 31.964f}, {.id = 345, .distance = 32.703f}, {.id = 343, .distance = 36.954f}, {.id = 413, .distance = 41.259f}, {.id = 415, .distance = 45.103f}
-        }},
-        {345, {
-            {.id = 328, .distance = 31.937f}, {.id = 344, .distance = 32.703f}, {.id = 346, .distance = 32.725f}, {.id = 367, .distance = 36.068f}, {.id = 329, .distance = 37.491f}, {.id = 368, .distance = 39.068f}, {.id = 366, .distance = 41.895f}
-        }},
-        {346, {
-            {.id = 329, .distance = 29.419f}, {.id = 347, .distance = 30.638f}, {.id = 345, .distance = 32.725f}, {.id = 368, .distance = 35.794f}, {.id = 369, .distance = 36.665f}, {.id = 330, .distance = 44.568f}, {.id = 370, .distance = 46.412f}
-        }},
-        {347, {
-            {.id = 370, .distance = 24.191f}, {.id = 330, .distance = 29.848f}, {.id = 346, .distance = 30.638f}, {.id = 348, .distance = 31.516f}, {.id = 329, .distance = 41.947f}, {.id = 371, .distance = 44.167f}, {.id = 369, .distance = 44.460f}
-        }},
-        {348, {
-            {.id = 375, .distance = 27.519f}, {.id = 347, .distance = 31.516f}, {.id = 349, .distance = 33.096f}, {.id = 331, .distance = 33.457f}, {.id = 330, .distance = 35.426f}, {.id = 372, .distance = 35.506f}, {.id = 370, .distance = 36.051f}
-        }},
-        {349, {
-            {.id = 331, .distance = 30.775f}, {.id = 350, .distance = 30.943f}, {.id = 375, .distance = 31.347f}, {.id = 348, .distance = 33.096f}, {.id = 377, .distance = 37.393f}, {.id = 332, .distance = 38.606f}, {.id = 376, .distance = 45.102f}
-        }},
-        {350, {
-            {.id = 332, .distance = 28.126f}, {.id = 349, .distance = 30.943f}, {.id = 351, .distance = 32.322f}, {.id = 378, .distance = 33.115f}, {.id = 377, .distance = 43.474f}, {.id = 379, .distance = 44.048f}, {.id = 331, .distance = 47.195f}
-        }},
-        {351, {
-            {.id = 381, .distance = 30.540f}, {.id = 333, .distance = 30.745f}, {.id = 350, .distance = 32.322f}, {.id = 352, .distance = 32.441f}, {.id = 379, .distance = 37.153f}, {.id = 332, .distance = 40.686f}, {.id = 380, .distance = 45.279f}
-        }},
-        {352, {
-            {.id = 381, .distance = 27.373f}, {.id = 353, .distance = 31.563f}, {.id = 351, .distance = 32.441f}, {.id = 333, .distance = 33.990f}, {.id = 383, .distance = 35.618f}, {.id = 334, .distance = 35.628f}, {.id = 385, .distance = 36.566f}
-        }},
-        {353, {
-            {.id = 385, .distance = 24.293f}, {.id = 334, .distance = 30.088f}, {.id = 352, .distance = 31.563f}, {.id = 354, .distance = 31.793f}, {.id = 335, .distance = 42.067f}, {.id = 386, .distance = 43.775f}, {.id = 387, .distance = 43.787f}
-        }},
-        {354, {
-            {.id = 335, .distance = 28.726f}, {.id = 355, .distance = 31.427f}, {.id = 353, .distance = 31.793f}, {.id = 388, .distance = 35.922f}, {.id = 387, .distance = 37.333f}, {.id = 334, .distance = 44.864f}, {.id = 385, .distance = 47.704f}
-        }},
-        {355, {
-            {.id = 354, .distance = 31.427f}, {.id = 336, .distance = 31.889f}, {.id = 356, .distance = 32.342f}, {.id = 389, .distance = 35.562f}, {.id = 335, .distance = 37.444f}, {.id = 388, .distance = 39.243f}, {.id = 391, .distance = 41.982f}
-        }},
-        {356, {
-            {.id = 391, .distance = 23.803f}, {.id = 357, .distance = 31.693f}, {.id = 355, .distance = 32.342f}, {.id = 336, .distance = 32.458f}, {.id = 337, .distance = 36.707f}, {.id = 393, .distance = 41.333f}, {.id = 390, .distance = 44.974f}
-        }},
-        {357, {
-            {.id = 395, .distance = 24.410f}, {.id = 337, .distance = 28.557f}, {.id = 356, .distance = 31.693f}, {.id = 358, .distance = 32.138f}, {.id = 393, .distance = 38.124f}, {.id = 391, .distance = 43.096f}, {.id = 338, .distance = 45.069f}
-        }},
-        {358, {
-            {.id = 338, .distance = 29.283f}, {.id = 359, .distance = 31.589f}, {.id = 357, .distance = 32.138f}, {.id = 397, .distance = 36.174f}, {.id = 395, .distance = 36.927f}, {.id = 337, .distance = 42.276f}, {.id = 398, .distance = 43.787f}
-        }},
-        {359, {
-            {.id = 358, .distance = 31.589f}, {.id = 360, .distance = 32.185f}, {.id = 398, .distance = 33.528f}, {.id = 339, .distance = 33.774f}, {.id = 338, .distance = 35.383f}, {.id = 399, .distance = 39.292f}, {.id = 397, .distance = 48.151f}
-        }},
-        {360, {
-            {.id = 401, .distance = 26.800f}, {.id = 339, .distance = 30.492f}, {.id = 361, .distance = 31.085f}, {.id = 359, .distance = 32.185f}, {.id = 340, .distance = 39.658f}, {.id = 399, .distance = 40.843f}, {.id = 400, .distance = 44.297f}
-        }},
-        {361, {
-            {.id = 340, .distance = 28.796f}, {.id = 360, .distance = 31.085f}, {.id = 401, .distance = 31.165f}, {.id = 362, .distance = 31.748f}, {.id = 405, .distance = 32.025f}, {.id = 403, .distance = 35.484f}, {.id = 341, .distance = 46.778f}
-        }},
-        {362, {
-            {.id = 405, .distance = 26.974f}, {.id = 341, .distance = 30.076f}, {.id = 363, .distance = 31.574f}, {.id = 361, .distance = 31.748f}, {.id = 340, .distance = 39.130f}, {.id = 407, .distance = 40.759f}, {.id = 406, .distance = 44.255f}
-        }},
-        {363, {
-            {.id = 362, .distance = 31.574f}, {.id = 364, .distance = 32.495f}, {.id = 341, .distance = 33.386f}, {.id = 408, .distance = 34.006f}, {.id = 342, .distance = 35.446f}, {.id = 407, .distance = 40.058f}, {.id = 409, .distance = 48.765f}
-        }},
-        {364, {
-            {.id = 342, .distance = 29.653f}, {.id = 365, .distance = 31.761f}, {.id = 363, .distance = 32.495f}, {.id = 409, .distance = 35.652f}, {.id = 411, .distance = 35.973f}, {.id = 343, .distance = 42.498f}, {.id = 408, .distance = 43.930f}
-        }},
-        {365, {
-            {.id = 411, .distance = 24.656f}, {.id = 343, .distance = 28.776f}, {.id = 344, .distance = 31.442f}, {.id = 364, .distance = 31.761f}, {.id = 413, .distance = 38.273f}, {.id = 366, .distance = 43.129f}, {.id = 342, .distance = 44.581f}
-        }},
-        {366, {
-            {.id = 415, .distance = 22.863f}, {.id = 344, .distance = 23.617f}, {.id = 413, .distance = 27.856f}, {.id = 414, .distance = 35.561f}, {.id = 367, .distance = 37.917f}, {.id = 345, .distance = 41.895f}, {.id = 365, .distance = 43.129f}
-        }},
-        {367, {
-            {.id = 415, .distance = 28.096f}, {.id = 368, .distance = 29.153f}, {.id = 97, .distance = 30.344f}, {.id = 345, .distance = 36.068f}, {.id = 366, .distance = 37.917f}, {.id = 98, .distance = 40.387f}, {.id = 96, .distance = 42.992f}
-        }},
-        {368, {
-            {.id = 369, .distance = 28.265f}, {.id = 367, .distance = 29.153f}, {.id = 96, .distance = 30.696f}, {.id = 346, .distance = 35.794f}, {.id = 345, .distance = 39.068f}, {.id = 97, .distance = 41.292f}, {.id = 95, .distance = 42.959f}
-        }},
-        {369, {
-            {.id = 368, .distance = 28.265f}, {.id = 371, .distance = 28.989f}, {.id = 95, .distance = 30.170f}, {.id = 346, .distance = 36.665f}, {.id = 370, .distance = 38.712f}, {.id = 96, .distance = 40.388f}, {.id = 94, .distance = 43.161f}
-        }},
-        {370, {
-            {.id = 371, .distance = 23.607f}, {.id = 347, .distance = 24.191f}, {.id = 372, .distance = 27.455f}, {.id = 373, .distance = 35.536f}, {.id = 348, .distance = 36.051f}, {.id = 369, .distance = 38.712f}, {.id = 346, .distance = 46.412f}
-        }},
-        {371, {
-            {.id = 370, .distance = 23.607f}, {.id = 373, .distance = 28.500f}, {.id = 369, .distance = 28.989f}, {.id = 94, .distance = 30.403f}, {.id = 372, .distance = 38.998f}, {.id = 95, .distance = 40.512f}, {.id = 92, .distance = 42.484f}
-        }},
-        {372, {
-            {.id = 373, .distance = 25.823f}, {.id = 374, .distance = 26.007f}, {.id = 375, .distance = 27.304f}, {.id = 370, .distance = 27.455f}, {.id = 348, .distance = 35.506f}, {.id = 371, .distance = 38.998f}, {.id = 376, .distance = 39.242f}
-        }},
-        {373, {
-            {.id = 372, .distance = 25.823f}, {.id = 371, .distance = 28.500f}, {.id = 92, .distance = 30.385f}, {.id = 374, .distance = 30.900f}, {.id = 370, .distance = 35.536f}, {.id = 94, .distance = 40.601f}, {.id = 375, .distance = 52.152f}
-        }},
-        {374, {
-            {.id = 372, .distance = 26.007f}, {.id = 516, .distance = 29.051f}, {.id = 376, .distance = 29.614f}, {.id = 373, .distance = 30.900f}, {.id = 375, .distance = 35.963f}, {.id = 514, .distance = 41.540f}, {.id = 518, .distance = 51.840f}
-        }},
-        {375, {
-            {.id = 376, .distance = 23.404f}, {.id = 372, .distance = 27.304f}, {.id = 348, .distance = 27.519f}, {.id = 349, .distance = 31.347f}, {.id = 374, .distance = 35.963f}, {.id = 377, .distance = 38.924f}, {.id = 370, .distance = 47.034f}
-        }},
-        {376, {
-            {.id = 375, .distance = 23.404f}, {.id = 377, .distance = 28.584f}, {.id = 374, .distance = 29.614f}, {.id = 514, .distance = 29.702f}, {.id = 372, .distance = 39.242f}, {.id = 513, .distance = 41.095f}, {.id = 516, .distance = 41.571f}
-        }},
-        {377, {
-            {.id = 378, .distance = 28.069f}, {.id = 376, .distance = 28.584f}, {.id = 513, .distance = 29.685f}, {.id = 349, .distance = 37.393f}, {.id = 375, .distance = 38.924f}, {.id = 512, .distance = 41.143f}, {.id = 514, .distance = 41.304f}
-        }},
-        {378, {
-            {.id = 377, .distance = 28.069f}, {.id = 379, .distance = 28.840f}, {.id = 512, .distance = 29.797f}, {.id = 350, .distance = 33.115f}, {.id = 513, .distance = 41.280f}, {.id = 511, .distance = 41.692f}, {.id = 349, .distance = 48.228f}
-        }},
-        {379, {
-            {.id = 378, .distance = 28.840f}, {.id = 380, .distance = 29.098f}, {.id = 511, .distance = 29.688f}, {.id = 351, .distance = 37.153f}, {.id = 381, .distance = 38.371f}, {.id = 512, .distance = 41.093f}, {.id = 510, .distance = 41.803f}
-        }},
-        {380, {
-            {.id = 381, .distance = 23.468f}, {.id = 382, .distance = 28.067f}, {.id = 379, .distance = 29.098f}, {.id = 510, .distance = 29.884f}, {.id = 383, .distance = 37.859f}, {.id = 508, .distance = 41.024f}, {.id = 511, .distance = 41.264f}
-        }},
-        {381, {
-            {.id = 380, .distance = 23.468f}, {.id = 383, .distance = 26.995f}, {.id = 352, .distance = 27.373f}, {.id = 351, .distance = 30.540f}, {.id = 382, .distance = 35.584f}, {.id = 379, .distance = 38.371f}, {.id = 385, .distance = 47.445f}
-        }},
-        {382, {
-            {.id = 383, .distance = 25.235f}, {.id = 380, .distance = 28.067f}, {.id = 508, .distance = 29.698f}, {.id = 384, .distance = 31.314f}, {.id = 381, .distance = 35.584f}, {.id = 510, .distance = 40.907f}, {.id = 1130, .distance = 50.621f}
-        }},
-        {383, {
-            {.id = 382, .distance = 25.235f}, {.id = 384, .distance = 25.959f}, {.id = 381, .distance = 26.995f}, {.id = 385, .distance = 28.280f}, {.id = 352, .distance = 35.618f}, {.id = 380, .distance = 37.859f}, {.id = 386, .distance = 39.348f}
-        }},
-        {384, {
-            {.id = 383, .distance = 25.959f}, {.id = 1130, .distance = 27.690f}, {.id = 386, .distance = 28.175f}, {.id = 382, .distance = 31.314f}, {.id = 385, .distance = 35.099f}, {.id = 1128, .distance = 39.154f}, {.id = 1131, .distance = 50.900f}
-        }},
-        {385, {
-            {.id = 386, .distance = 22.858f}, {.id = 353, .distance = 24.293f}, {.id = 383, .distance = 28.280f}, {.id = 384, .distance = 35.099f}, {.id = 352, .distance = 36.566f}, {.id = 387, .distance = 37.718f}, {.id = 381, .distance = 47.445f}
-        }},
-        {386, {
-            {.id = 385, .distance = 22.858f}, {.id = 1128, .distance = 27.436f}, {.id = 384, .distance = 28.175f}, {.id = 387, .distance = 28.665f}, {.id = 383, .distance = 39.348f}, {.id = 1130, .distance = 40.114f}, {.id = 1127, .distance = 40.252f}
-        }},
-        {387, {
-            {.id = 1127, .distance = 27.613f}, {.id = 386, .distance = 28.665f}, {.id = 388, .distance = 28.744f}, {.id = 354, .distance = 37.333f}, {.id = 385, .distance = 37.718f}, {.id = 1126, .distance = 39.855f}, {.id = 1128, .distance = 39.947f}
-        }},
-        {388, {
-            {.id = 1126, .distance = 27.498f}, {.id = 389, .distance = 28.665f}, {.id = 387, .distance = 28.744f}, {.id = 354, .distance = 35.922f}, {.id = 355, .distance = 39.243f}, {.id = 1127, .distance = 39.255f}, {.id = 1125, .distance = 39.752f}
-        }},
-        {389, {
-            {.id = 1125, .distance = 27.628f}, {.id = 388, .distance = 28.665f}, {.id = 390, .distance = 28.989f}, {.id = 355, .distance = 35.562f}, {.id = 391, .distance = 37.946f}, {.id = 1126, .distance = 39.790f}, {.id = 1124, .distance = 39.805f}
-        }},
-        {390, {
-            {.id = 391, .distance = 22.522f}, {.id = 1124, .distance = 27.583f}, {.id = 392, .distance = 28.989f}, {.id = 389, .distance = 28.989f}, {.id = 393, .distance = 38.748f}, {.id = 1122, .distance = 39.435f}, {.id = 1125, .distance = 40.007f}
-        }},
-        {391, {
-            {.id = 390, .distance = 22.522f}, {.id = 356, .distance = 23.803f}, {.id = 393, .distance = 27.573f}, {.id = 392, .distance = 35.430f}, {.id = 389, .distance = 37.946f}, {.id = 355, .distance = 41.982f}, {.id = 357, .distance = 43.096f}
-        }},
-        {392, {
-            {.id = 393, .distance = 25.732f}, {.id = 1122, .distance = 27.473f}, {.id = 390, .distance = 28.989f}, {.id = 394, .distance = 30.699f}, {.id = 391, .distance = 35.430f}, {.id = 1124, .distance = 40.223f}, {.id = 1120, .distance = 49.900f}
-        }},
-        {393, {
-            {.id = 394, .distance = 25.715f}, {.id = 392, .distance = 25.732f}, {.id = 395, .distance = 27.009f}, {.id = 391, .distance = 27.573f}, {.id = 357, .distance = 38.124f}, {.id = 390, .distance = 38.748f}, {.id = 396, .distance = 38.795f}
-        }},
-        {394, {
-            {.id = 393, .distance = 25.715f}, {.id = 1036, .distance = 27.990f}, {.id = 396, .distance = 28.587f}, {.id = 392, .distance = 30.699f}, {.id = 395, .distance = 35.180f}, {.id = 1034, .distance = 41.739f}, {.id = 1038, .distance = 50.403f}
-        }},
-        {395, {
-            {.id = 396, .distance = 23.318f}, {.id = 357, .distance = 24.410f}, {.id = 393, .distance = 27.009f}, {.id = 394, .distance = 35.180f}, {.id = 358, .distance = 36.927f}, {.id = 397, .distance = 38.625f}, {.id = 391, .distance = 47.229f}
-        }},
-        {396, {
-            {.id = 395, .distance = 23.318f}, {.id = 1034, .distance = 28.526f}, {.id = 394, .distance = 28.587f}, {.id = 397, .distance = 28.648f}, {.id = 393, .distance = 38.795f}, {.id = 1036, .distance = 39.023f}, {.id = 1033, .distance = 41.888f}
-        }},
-        {397, {
-            {.id = 396, .distance = 28.648f}, {.id = 398, .distance = 28.678f}, {.id = 1033, .distance = 28.720f}, {.id = 358, .distance = 36.174f}, {.id = 395, .distance = 38.625f}, {.id = 1034, .distance = 38.975f}, {.id = 1032, .distance = 42.065f}
-        }},
-        {398, {
-            {.id = 399, .distance = 28.019f}, {.id = 1032, .distance = 28.593f}, {.id = 397, .distance = 28.678f}, {.id = 359, .distance = 33.528f}, {.id = 1033, .distance = 39.193f}, {.id = 1031, .distance = 42.010f}, {.id = 358, .distance = 43.787f}
-        }},
-        {399, {
-            {.id = 398, .distance = 28.019f}, {.id = 1031, .distance = 28.538f}, {.id = 400, .distance = 29.666f}, {.id = 1032, .distance = 38.440f}, {.id = 401, .distance = 39.143f}, {.id = 359, .distance = 39.292f}, {.id = 360, .distance = 40.843f}
-        }},
-        {400, {
-            {.id = 401, .distance = 23.574f}, {.id = 1030, .distance = 28.586f}, {.id = 402, .distance = 28.796f}, {.id = 399, .distance = 29.666f}, {.id = 403, .distance = 38.536f}, {.id = 1031, .distance = 38.933f}, {.id = 1028, .distance = 41.429f}
-        }},
-        {401, {
-            {.id = 400, .distance = 23.574f}, {.id = 360, .distance = 26.800f}, {.id = 403, .distance = 27.295f}, {.id = 361, .distance = 31.165f}, {.id = 402, .distance = 35.726f}, {.id = 399, .distance = 39.143f}, {.id = 405, .distance = 46.866f}
-        }},
-        {402, {
-            {.id = 403, .distance = 25.236f}, {.id = 1028, .distance = 28.551f}, {.id = 400, .distance = 28.796f}, {.id = 404, .distance = 30.642f}, {.id = 401, .distance = 35.726f}, {.id = 1030, .distance = 39.222f}, {.id = 405, .distance = 51.793f}
-        }},
-        {403, {
-            {.id = 402, .distance = 25.236f}, {.id = 404, .distance = 25.701f}, {.id = 401, .distance = 27.295f}, {.id = 405, .distance = 27.601f}, {.id = 361, .distance = 35.484f}, {.id = 400, .distance = 38.536f}, {.id = 406, .distance = 38.536f}
-        }},
-        {404, {
-            {.id = 403, .distance = 25.701f}, {.id = 406, .distance = 28.171f}, {.id = 278, .distance = 29.698f}, {.id = 402, .distance = 30.642f}, {.id = 405, .distance = 35.416f}, {.id = 276, .distance = 41.024f}, {.id = 1028, .distance = 50.454f}
-        }},
-        {405, {
-            {.id = 406, .distance = 23.046f}, {.id = 362, .distance = 26.974f}, {.id = 403, .distance = 27.601f}, {.id = 361, .distance = 32.025f}, {.id = 404, .distance = 35.416f}, {.id = 407, .distance = 38.124f}, {.id = 401, .distance = 46.866f}
-        }},
-        {406, {
-            {.id = 405, .distance = 23.046f}, {.id = 404, .distance = 28.171f}, {.id = 407, .distance = 28.796f}, {.id = 276, .distance = 29.884f}, {.id = 403, .distance = 38.536f}, {.id = 278, .distance = 40.907f}, {.id = 275, .distance = 41.803f}
-        }},
-        {407, {
-            {.id = 408, .distance = 28.739f}, {.id = 406, .distance = 28.796f}, {.id = 275, .distance = 29.688f}, {.id = 405, .distance = 38.124f}, {.id = 363, .distance = 40.058f}, {.id = 362, .distance = 40.759f}, {.id = 276, .distance = 41.264f}
-        }},
-        {408, {
-            {.id = 407, .distance = 28.739f}, {.id = 409, .distance = 28.996f}, {.id = 274, .distance = 29.797f}, {.id = 363, .distance = 34.006f}, {.id = 275, .distance = 41.093f}, {.id = 273, .distance = 41.143f}, {.id = 364, .distance = 43.930f}
-        }},
-        {409, {
-            {.id = 410, .distance = 28.539f}, {.id = 408, .distance = 28.996f}, {.id = 273, .distance = 29.685f}, {.id = 364, .distance = 35.652f}, {.id = 411, .distance = 38.072f}, {.id = 272, .distance = 41.095f}, {.id = 274, .distance = 41.280f}
-        }},
-        {410, {
-            {.id = 411, .distance = 23.229f}, {.id = 409, .distance = 28.539f}, {.id = 412, .distance = 29.175f}, {.id = 272, .distance = 29.702f}, {.id = 413, .distance = 38.795f}, {.id = 273, .distance = 41.304f}, {.id = 270, .distance = 41.540f}
-        }},
-        {411, {
-            {.id = 410, .distance = 23.229f}, {.id = 365, .distance = 24.656f}, {.id = 413, .distance = 27.373f}, {.id = 364, .distance = 35.973f}, {.id = 412, .distance = 36.131f}, {.id = 409, .distance = 38.072f}, {.id = 366, .distance = 47.750f}
-        }},
-        {412, {
-            {.id = 413, .distance = 26.133f}, {.id = 270, .distance = 29.051f}, {.id = 410, .distance = 29.175f}, {.id = 414, .distance = 30.723f}, {.id = 411, .distance = 36.131f}, {.id = 272, .distance = 41.571f}, {.id = 269, .distance = 52.211f}
-        }},
-        {413, {
-            {.id = 414, .distance = 25.813f}, {.id = 412, .distance = 26.133f}, {.id = 411, .distance = 27.373f}, {.id = 366, .distance = 27.856f}, {.id = 365, .distance = 38.273f}, {.id = 410, .distance = 38.795f}, {.id = 415, .distance = 39.458f}
-        }},
-        {414, {
-            {.id = 413, .distance = 25.813f}, {.id = 415, .distance = 29.479f}, {.id = 100, .distance = 29.970f}, {.id = 412, .distance = 30.723f}, {.id = 366, .distance = 35.561f}, {.id = 98, .distance = 43.137f}, {.id = 270, .distance = 51.840f}
-        }},
-        {415, {
-            {.id = 366, .distance = 22.863f}, {.id = 367, .distance = 28.096f}, {.id = 414, .distance = 29.479f}, {.id = 98, .distance = 30.291f}, {.id = 413, .distance = 39.458f}, {.id = 100, .distance = 40.924f}, {.id = 97, .distance = 42.554f}
-        }},
-        {416, {
-            {.id = 417, .distance = 25.256f}, {.id = 419, .distance = 25.653f}, {.id = 418, .distance = 25.660f}, {.id = 421, .distance = 26.237f}, {.id = 420, .distance = 26.780f}, {.id = 423, .distance = 53.251f}, {.id = 427, .distance = 53.584f}
-        }},
-        {417, {
-            {.id = 416, .distance = 25.256f}, {.id = 423, .distance = 27.996f}, {.id = 421, .distance = 30.406f}, {.id = 418, .distance = 30.746f}, {.id = 424, .distance = 36.902f}, {.id = 422, .distance = 36.902f}, {.id = 419, .distance = 48.670f}
-        }},
-        {418, {
-            {.id = 416, .distance = 25.660f}, {.id = 425, .distance = 28.138f}, {.id = 419, .distance = 30.016f}, {.id = 417, .distance = 30.746f}, {.id = 426, .distance = 35.779f}, {.id = 424, .distance = 37.730f}, {.id = 420, .distance = 49.623f}
-        }},
-        {419, {
-            {.id = 416, .distance = 25.653f}, {.id = 427, .distance = 27.950f}, {.id = 418, .distance = 30.016f}, {.id = 420, .distance = 30.334f}, {.id = 428, .distance = 36.663f}, {.id = 426, .distance = 36.917f}, {.id = 417, .distance = 48.670f}
-        }},
-        {420, {
-            {.id = 416, .distance = 26.780f}, {.id = 429, .distance = 28.148f}, {.id = 419, .distance = 30.334f}, {.id = 421, .distance = 30.829f}, {.id = 428, .distance = 36.041f}, {.id = 430, .distance = 36.581f}, {.id = 417, .distance = 49.415f}
-        }},
-        {421, {
-            {.id = 416, .distance = 26.237f}, {.id = 431, .distance = 28.784f}, {.id = 417, .distance = 30.406f}, {.id = 420, .distance = 30.829f}, {.id = 422, .distance = 36.136f}, {.id = 430, .distance = 36.663f}, {.id = 419, .distance = 49.028f}
-        }},
-        {422, {
-            {.id = 433, .distance = 29.943f}, {.id = 431, .distance = 32.709f}, {.id = 423, .distance = 33.241f}, {.id = 432, .distance = 35.999f}, {.id = 421, .distance = 36.136f}, {.id = 417, .distance = 36.902f}, {.id = 434, .distance = 43.146f}
-        }},
-        {423, {
-            {.id = 417, .distance = 27.996f}, {.id = 434, .distance = 31.091f}, {.id = 422, .distance = 33.241f}, {.id = 424, .distance = 33.489f}, {.id = 435, .distance = 33.997f}, {.id = 433, .distance = 46.465f}, {.id = 436, .distance = 50.872f}
-        }},
-        {424, {
-            {.id = 436, .distance = 28.795f}, {.id = 423, .distance = 33.489f}, {.id = 425, .distance = 34.526f}, {.id = 417, .distance = 36.902f}, {.id = 418, .distance = 37.730f}, {.id = 435, .distance = 39.001f}, {.id = 437, .distance = 39.043f}
-        }},
-        {425, {
-            {.id = 418, .distance = 28.138f}, {.id = 438, .distance = 30.119f}, {.id = 426, .distance = 32.862f}, {.id = 437, .distance = 33.326f}, {.id = 424, .distance = 34.526f}, {.id = 439, .distance = 46.032f}, {.id = 436, .distance = 51.953f}
-        }},
-        {426, {
-            {.id = 439, .distance = 29.271f}, {.id = 425, .distance = 32.862f}, {.id = 427, .distance = 32.910f}, {.id = 440, .distance = 35.475f}, {.id = 418, .distance = 35.779f}, {.id = 419, .distance = 36.917f}, {.id = 438, .distance = 42.036f}
-        }},
-        {427, {
-            {.id = 419, .distance = 27.950f}, {.id = 441, .distance = 30.515f}, {.id = 426, .distance = 32.910f}, {.id = 428, .distance = 34.288f}, {.id = 440, .distance = 35.680f}, {.id = 442, .distance = 43.747f}, {.id = 418, .distance = 50.881f}
-        }},
-        {428, {
-            {.id = 442, .distance = 30.713f}, {.id = 443, .distance = 32.961f}, {.id = 427, .distance = 34.288f}, {.id = 429, .distance = 34.333f}, {.id = 420, .distance = 36.041f}, {.id = 419, .distance = 36.663f}, {.id = 441, .distance = 47.436f}
-        }},
-        {429, {
-            {.id = 420, .distance = 28.148f}, {.id = 444, .distance = 28.795f}, {.id = 430, .distance = 32.474f}, {.id = 428, .distance = 34.333f}, {.id = 445, .distance = 37.853f}, {.id = 443, .distance = 39.529f}, {.id = 421, .distance = 52.029f}
-        }},
-        {430, {
-            {.id = 446, .distance = 30.978f}, {.id = 429, .distance = 32.474f}, {.id = 445, .distance = 33.378f}, {.id = 431, .distance = 34.135f}, {.id = 420, .distance = 36.581f}, {.id = 421, .distance = 36.663f}, {.id = 447, .distance = 47.075f}
-        }},
-        {431, {
-            {.id = 421, .distance = 28.784f}, {.id = 447, .distance = 29.314f}, {.id = 422, .distance = 32.709f}, {.id = 430, .distance = 34.135f}, {.id = 432, .distance = 35.428f}, {.id = 446, .distance = 42.934f}, {.id = 417, .distance = 52.730f}
-        }},
-        {432, {
-            {.id = 449, .distance = 31.937f}, {.id = 448, .distance = 31.964f}, {.id = 447, .distance = 32.088f}, {.id = 433, .distance = 32.704f}, {.id = 431, .distance = 35.428f}, {.id = 422, .distance = 35.999f}, {.id = 469, .distance = 49.921f}
-        }},
-        {433, {
-            {.id = 450, .distance = 29.419f}, {.id = 422, .distance = 29.943f}, {.id = 434, .distance = 32.468f}, {.id = 432, .distance = 32.704f}, {.id = 449, .distance = 37.491f}, {.id = 451, .distance = 41.947f}, {.id = 423, .distance = 46.465f}
-        }},
-        {434, {
-            {.id = 451, .distance = 29.848f}, {.id = 423, .distance = 31.091f}, {.id = 435, .distance = 31.917f}, {.id = 433, .distance = 32.468f}, {.id = 452, .distance = 35.426f}, {.id = 422, .distance = 43.146f}, {.id = 450, .distance = 44.568f}
-        }},
-        {435, {
-            {.id = 453, .distance = 30.775f}, {.id = 434, .distance = 31.917f}, {.id = 436, .distance = 32.089f}, {.id = 452, .distance = 33.457f}, {.id = 423, .distance = 33.997f}, {.id = 424, .distance = 39.001f}, {.id = 454, .distance = 47.195f}
-        }},
-        {436, {
-            {.id = 454, .distance = 28.126f}, {.id = 424, .distance = 28.795f}, {.id = 435, .distance = 32.089f}, {.id = 437, .distance = 33.350f}, {.id = 453, .distance = 38.606f}, {.id = 455, .distance = 40.686f}, {.id = 423, .distance = 50.872f}
-        }},
-        {437, {
-            {.id = 455, .distance = 30.745f}, {.id = 438, .distance = 32.585f}, {.id = 425, .distance = 33.326f}, {.id = 436, .distance = 33.350f}, {.id = 456, .distance = 33.990f}, {.id = 424, .distance = 39.043f}, {.id = 454, .distance = 47.230f}
-        }},
-        {438, {
-            {.id = 457, .distance = 30.088f}, {.id = 425, .distance = 30.119f}, {.id = 439, .distance = 32.298f}, {.id = 437, .distance = 32.585f}, {.id = 456, .distance = 35.628f}, {.id = 426, .distance = 42.036f}, {.id = 458, .distance = 44.864f}
-        }},
-        {439, {
-            {.id = 458, .distance = 28.726f}, {.id = 426, .distance = 29.271f}, {.id = 440, .distance = 31.916f}, {.id = 438, .distance = 32.298f}, {.id = 459, .distance = 37.444f}, {.id = 457, .distance = 42.067f}, {.id = 425, .distance = 46.032f}
-        }},
-        {440, {
-            {.id = 459, .distance = 31.889f}, {.id = 439, .distance = 31.916f}, {.id = 460, .distance = 32.458f}, {.id = 441, .distance = 32.605f}, {.id = 426, .distance = 35.475f}, {.id = 427, .distance = 35.680f}, {.id = 458, .distance = 49.358f}
-        }},
-        {441, {
-            {.id = 461, .distance = 28.557f}, {.id = 427, .distance = 30.515f}, {.id = 440, .distance = 32.605f}, {.id = 442, .distance = 33.386f}, {.id = 460, .distance = 36.707f}, {.id = 462, .distance = 42.276f}, {.id = 428, .distance = 47.436f}
-        }},
-        {442, {
-            {.id = 462, .distance = 29.283f}, {.id = 428, .distance = 30.713f}, {.id = 443, .distance = 32.395f}, {.id = 441, .distance = 33.386f}, {.id = 463, .distance = 35.383f}, {.id = 427, .distance = 43.747f}, {.id = 461, .distance = 45.069f}
-        }},
-        {443, {
-            {.id = 464, .distance = 30.492f}, {.id = 442, .distance = 32.395f}, {.id = 444, .distance = 32.492f}, {.id = 428, .distance = 32.961f}, {.id = 463, .distance = 33.774f}, {.id = 429, .distance = 39.529f}, {.id = 465, .distance = 46.947f}
-        }},
-        {444, {
-            {.id = 429, .distance = 28.795f}, {.id = 465, .distance = 28.796f}, {.id = 445, .distance = 31.301f}, {.id = 443, .distance = 32.492f}, {.id = 466, .distance = 39.130f}, {.id = 464, .distance = 39.658f}, {.id = 430, .distance = 50.236f}
-        }},
-        {445, {
-            {.id = 466, .distance = 30.076f}, {.id = 444, .distance = 31.301f}, {.id = 446, .distance = 33.324f}, {.id = 430, .distance = 33.378f}, {.id = 467, .distance = 33.386f}, {.id = 429, .distance = 37.853f}, {.id = 465, .distance = 46.778f}
-        }},
-        {446, {
-            {.id = 468, .distance = 29.653f}, {.id = 430, .distance = 30.978f}, {.id = 447, .distance = 32.852f}, {.id = 445, .distance = 33.324f}, {.id = 467, .distance = 35.446f}, {.id = 431, .distance = 42.934f}, {.id = 469, .distance = 44.581f}
-        }},
-        {447, {
-            {.id = 469, .distance = 28.776f}, {.id = 431, .distance = 29.314f}, {.id = 432, .distance = 32.088f}, {.id = 446, .distance = 32.852f}, {.id = 448, .distance = 36.954f}, {.id = 468, .distance = 42.498f}, {.id = 430, .distance = 47.075f}
-        }},
-        {448, {
-            {.id = 470, .distance = 23.617f}, {.id = 469, .distance = 31.442f}, {.id = 432, .distance = 31.964f}, {.id = 449, .distance = 32.703f}, {.id = 447, .distance = 36.954f}, {.id = 517, .distance = 41.259f}, {.id = 519, .distance = 45.103f}
-        }},
-        {449, {
-            {.id = 432, .distance = 31.937f}, {.id = 448, .distance = 32.703f}, {.id = 450, .distance = 32.725f}, {.id = 471, .distance = 36.068f}, {.id = 433, .distance = 37.491f}, {.id = 472, .distance = 39.068f}, {.id = 470, .distance = 41.895f}
-        }},
-        {450, {
-            {.id = 433, .distance = 29.419f}, {.id = 451, .distance = 30.638f}, {.id = 449, .distance = 32.725f}, {.id = 472, .distance = 35.794f}, {.id = 473, .distance = 36.665f}, {.id = 434, .distance = 44.568f}, {.id = 474, .distance = 46.412f}
-        }},
-        {451, {
-            {.id = 474, .distance = 24.191f}, {.id = 434, .distance = 29.848f}, {.id = 450, .distance = 30.638f}, {.id = 452, .distance = 31.516f}, {.id = 433, .distance = 41.947f}, {.id = 475, .distance = 44.167f}, {.id = 473, .distance = 44.460f}
-        }},
-        {452, {
-            {.id = 479, .distance = 27.519f}, {.id = 451, .distance = 31.516f}, {.id = 453, .distance = 33.096f}, {.id = 435, .distance = 33.457f}, {.id = 434, .distance = 35.426f}, {.id = 476, .distance = 35.506f}, {.id = 474, .distance = 36.051f}
-        }},
-        {453, {
-            {.id = 435, .distance = 30.775f}, {.id = 454, .distance = 30.943f}, {.id = 479, .distance = 31.347f}, {.id = 452, .distance = 33.096f}, {.id = 481, .distance = 37.393f}, {.id = 436, .distance = 38.606f}, {.id = 480, .distance = 45.102f}
-        }},
-        {454, {
-            {.id = 436, .distance = 28.126f}, {.id = 453, .distance = 30.943f}, {.id = 455, .distance = 32.322f}, {.id = 482, .distance = 33.115f}, {.id = 481, .distance = 43.474f}, {.id = 483, .distance = 44.048f}, {.id = 435, .distance = 47.195f}
-        }},
-        {455, {
-            {.id = 485, .distance = 30.540f}, {.id = 437, .distance = 30.745f}, {.id = 454, .distance = 32.322f}, {.id = 456, .distance = 32.441f}, {.id = 483, .distance = 37.153f}, {.id = 436, .distance = 40.686f}, {.id = 484, .distance = 45.279f}
-        }},
-        {456, {
-            {.id = 485, .distance = 27.373f}, {.id = 457, .distance = 31.563f}, {.id = 455, .distance = 32.441f}, {.id = 437, .distance = 33.990f}, {.id = 487, .distance = 35.618f}, {.id = 438, .distance = 35.628f}, {.id = 489, .distance = 36.566f}
-        }},
-        {457, {
-            {.id = 489, .distance = 24.293f}, {.id = 438, .distance = 30.088f}, {.id = 456, .distance = 31.563f}, {.id = 458, .distance = 31.793f}, {.id = 439, .distance = 42.067f}, {.id = 490, .distance = 43.775f}, {.id = 491, .distance = 43.787f}
-        }},
-        {458, {
-            {.id = 439, .distance = 28.726f}, {.id = 459, .distance = 31.427f}, {.id = 457, .distance = 31.793f}, {.id = 492, .distance = 35.922f}, {.id = 491, .distance = 37.333f}, {.id = 438, .distance = 44.864f}, {.id = 489, .distance = 47.704f}
-        }},
-        {459, {
-            {.id = 458, .distance = 31.427f}, {.id = 440, .distance = 31.889f}, {.id = 460, .distance = 32.342f}, {.id = 493, .distance = 35.562f}, {.id = 439, .distance = 37.444f}, {.id = 492, .distance = 39.243f}, {.id = 495, .distance = 41.982f}
-        }},
-        {460, {
-            {.id = 495, .distance = 23.803f}, {.id = 461, .distance = 31.693f}, {.id = 459, .distance = 32.342f}, {.id = 440, .distance = 32.458f}, {.id = 441, .distance = 36.707f}, {.id = 497, .distance = 41.333f}, {.id = 494, .distance = 44.974f}
-        }},
-        {461, {
-            {.id = 499, .distance = 24.410f}, {.id = 441, .distance = 28.557f}, {.id = 460, .distance = 31.693f}, {.id = 462, .distance = 32.138f}, {.id = 497, .distance = 38.124f}, {.id = 495, .distance = 43.096f}, {.id = 442, .distance = 45.069f}
-        }},
-        {462, {
-            {.id = 442, .distance = 29.283f}, {.id = 463, .distance = 31.589f}, {.id = 461, .distance = 32.138f}, {.id = 501, .distance = 36.174f}, {.id = 499, .distance = 36.927f}, {.id = 441, .distance = 42.276f}, {.id = 502, .distance = 43.787f}
-        }},
-        {463, {
-            {.id = 462, .distance = 31.589f}, {.id = 464, .distance = 32.185f}, {.id = 502, .distance = 33.528f}, {.id = 443, .distance = 33.774f}, {.id = 442, .distance = 35.383f}, {.id = 503, .distance = 39.292f}, {.id = 501, .distance = 48.151f}
-        }},
-        {464, {
-            {.id = 505, .distance = 26.800f}, {.id = 443, .distance = 30.492f}, {.id = 465, .distance = 31.085f}, {.id = 463, .distance = 32.185f}, {.id = 444, .distance = 39.658f}, {.id = 503, .distance = 40.843f}, {.id = 504, .distance = 44.297f}
-        }},
-        {465, {
-            {.id = 444, .distance = 28.796f}, {.id = 464, .distance = 31.085f}, {.id = 505, .distance = 31.165f}, {.id = 466, .distance = 31.748f}, {.id = 509, .distance = 32.025f}, {.id = 507, .distance = 35.484f}, {.id = 445, .distance = 46.778f}
-        }},
-        {466, {
-            {.id = 509, .distance = 26.974f}, {.id = 445, .distance = 30.076f}, {.id = 467, .distance = 31.574f}, {.id = 465, .distance = 31.748f}, {.id = 444, .distance = 39.130f}, {.id = 511, .distance = 40.759f}, {.id = 510, .distance = 44.255f}
-        }},
-        {467, {
-            {.id = 466, .distance = 31.574f}, {.id = 468, .distance = 32.495f}, {.id = 445, .distance = 33.386f}, {.id = 512, .distance = 34.006f}, {.id = 446, .distance = 35.446f}, {.id = 511, .distance = 40.058f}, {.id = 513, .distance = 48.765f}
-        }},
-        {468, {
-            {.id = 446, .distance = 29.653f}, {.id = 469, .distance = 31.761f}, {.id = 467, .distance = 32.495f}, {.id = 513, .distance = 35.652f}, {.id = 515, .distance = 35.973f}, {.id = 447, .distance = 42.498f}, {.id = 512, .distance = 43.930f}
-        }},
-        {469, {
-            {.id = 515, .distance = 24.656f}, {.id = 447, .distance = 28.776f}, {.id = 448, .distance = 31.442f}, {.id = 468, .distance = 31.761f}, {.id = 517, .distance = 38.273f}, {.id = 470, .distance = 43.129f}, {.id = 446, .distance = 44.581f}
-        }},
-        {470, {
-            {.id = 519, .distance = 22.863f}, {.id = 448, .distance = 23.617f}, {.id = 517, .distance = 27.856f}, {.id = 518, .distance = 35.561f}, {.id = 471, .distance = 37.917f}, {.id = 449, .distance = 41.895f}, {.id = 469, .distance = 43.129f}
-        }},
-        {471, {
-            {.id = 519, .distance = 28.096f}, {.id = 87, .distance = 29.135f}, {.id = 472, .distance = 29.153f}, {.id = 449, .distance = 36.068f}, {.id = 470, .distance = 37.917f}, {.id = 88, .distance = 40.304f}, {.id = 86, .distance = 41.584f}
-        }},
-        {472, {
-            {.id = 473, .distance = 28.265f}, {.id = 471, .distance = 29.153f}, {.id = 86, .distance = 29.580f}, {.id = 450, .distance = 35.794f}, {.id = 449, .distance = 39.068f}, {.id = 87, .distance = 40.348f}, {.id = 85, .distance = 41.613f}
-        }},
-        {473, {
-            {.id = 472, .distance = 28.265f}, {.id = 475, .distance = 28.989f}, {.id = 85, .distance = 29.175f}, {.id = 450, .distance = 36.665f}, {.id = 474, .distance = 38.712f}, {.id = 86, .distance = 40.192f}, {.id = 84, .distance = 41.569f}
-        }},
-        {474, {
-            {.id = 475, .distance = 23.607f}, {.id = 451, .distance = 24.191f}, {.id = 476, .distance = 27.455f}, {.id = 477, .distance = 35.536f}, {.id = 452, .distance = 36.051f}, {.id = 473, .distance = 38.712f}, {.id = 450, .distance = 46.412f}
-        }},
-        {475, {
-            {.id = 474, .distance = 23.607f}, {.id = 477, .distance = 28.500f}, {.id = 473, .distance = 28.989f}, {.id = 84, .distance = 29.217f}, {.id = 476, .distance = 38.998f}, {.id = 85, .distance = 40.470f}, {.id = 82, .distance = 41.271f}
-        }},
-        {476, {
-            {.id = 477, .distance = 25.823f}, {.id = 478, .distance = 26.007f}, {.id = 479, .distance = 27.304f}, {.id = 474, .distance = 27.455f}, {.id = 452, .distance = 35.506f}, {.id = 475, .distance = 38.998f}, {.id = 480, .distance = 39.242f}
-        }},
-        {477, {
-            {.id = 476, .distance = 25.823f}, {.id = 475, .distance = 28.500f}, {.id = 82, .distance = 29.341f}, {.id = 478, .distance = 30.900f}, {.id = 474, .distance = 35.536f}, {.id = 84, .distance = 40.505f}, {.id = 80, .distance = 51.992f}
-        }},
-        {478, {
-            {.id = 476, .distance = 26.007f}, {.id = 620, .distance = 29.051f}, {.id = 480, .distance = 29.614f}, {.id = 477, .distance = 30.900f}, {.id = 479, .distance = 35.963f}, {.id = 618, .distance = 41.540f}, {.id = 622, .distance = 51.840f}
-        }},
-        {479, {
-            {.id = 480, .distance = 23.404f}, {.id = 476, .distance = 27.304f}, {.id = 452, .distance = 27.519f}, {.id = 453, .distance = 31.347f}, {.id = 478, .distance = 35.963f}, {.id = 481, .distance = 38.924f}, {.id = 474, .distance = 47.034f}
-        }},
-        {480, {
-            {.id = 479, .distance = 23.404f}, {.id = 481, .distance = 28.584f}, {.id = 478, .distance = 29.614f}, {.id = 618, .distance = 29.702f}, {.id = 476, .distance = 39.242f}, {.id = 617, .distance = 41.095f}, {.id = 620, .distance = 41.571f}
-        }},
-        {481, {
-            {.id = 482, .distance = 28.069f}, {.id = 480, .distance = 28.584f}, {.id = 617, .distance = 29.685f}, {.id = 453, .distance = 37.393f}, {.id = 479, .distance = 38.924f}, {.id = 616, .distance = 41.143f}, {.id = 618, .distance = 41.304f}
-        }},
-        {482, {
-            {.id = 481, .distance = 28.069f}, {.id = 483, .distance = 28.840f}, {.id = 616, .distance = 29.797f}, {.id = 454, .distance = 33.115f}, {.id = 617, .distance = 41.280f}, {.id = 615, .distance = 41.692f}, {.id = 453, .distance = 48.228f}
-        }},
-        {483, {
-            {.id = 482, .distance = 28.840f}, {.id = 484, .distance = 29.097f}, {.id = 615, .distance = 29.688f}, {.id = 455, .distance = 37.153f}, {.id = 485, .distance = 38.371f}, {.id = 616, .distance = 41.093f}, {.id = 614, .distance = 41.803f}
-        }},
-        {484, {
-            {.id = 485, .distance = 23.468f}, {.id = 486, .distance = 28.068f}, {.id = 483, .distance = 29.097f}, {.id = 614, .distance = 29.884f}, {.id = 487, .distance = 37.859f}, {.id = 612, .distance = 41.024f}, {.id = 615, .distance = 41.264f}
-        }},
-        {485, {
-            {.id = 484, .distance = 23.468f}, {.id = 487, .distance = 26.995f}, {.id = 456, .distance = 27.373f}, {.id = 455, .distance = 30.540f}, {.id = 486, .distance = 35.584f}, {.id = 483, .distance = 38.371f}, {.id = 489, .distance = 47.445f}
-        }},
-        {486, {
-            {.id = 487, .distance = 25.235f}, {.id = 484, .distance = 28.068f}, {.id = 612, .distance = 29.698f}, {.id = 488, .distance = 31.314f}, {.id = 485, .distance = 35.584f}, {.id = 614, .distance = 40.907f}, {.id = 714, .distance = 50.621f}
-        }},
-        {487, {
-            {.id = 486, .distance = 25.235f}, {.id = 488, .distance = 25.959f}, {.id = 485, .distance = 26.995f}, {.id = 489, .distance = 28.280f}, {.id = 456, .distance = 35.618f}, {.id = 484, .distance = 37.859f}, {.id = 490, .distance = 39.348f}
-        }},
-        {488, {
-            {.id = 487, .distance = 25.959f}, {.id = 714, .distance = 27.690f}, {.id = 490, .distance = 28.175f}, {.id = 486, .distance = 31.314f}, {.id = 489, .distance = 35.099f}, {.id = 712, .distance = 39.154f}, {.id = 715, .distance = 50.900f}
-        }},
-        {489, {
-            {.id = 490, .distance = 22.858f}, {.id = 457, .distance = 24.293f}, {.id = 487, .distance = 28.280f}, {.id = 488, .distance = 35.099f}, {.id = 456, .distance = 36.566f}, {.id = 491, .distance = 37.718f}, {.id = 485, .distance = 47.445f}
-        }},
-        {490, {
-            {.id = 489, .distance = 22.858f}, {.id = 712, .distance = 27.436f}, {.id = 488, .distance = 28.175f}, {.id = 491, .distance = 28.665f}, {.id = 487, .distance = 39.348f}, {.id = 714, .distance = 40.114f}, {.id = 711, .distance = 40.252f}
-        }},
-        {491, {
-            {.id = 711, .distance = 27.613f}, {.id = 490, .distance = 28.665f}, {.id = 492, .distance = 28.744f}, {.id = 458, .distance = 37.333f}, {.id = 489, .distance = 37.718f}, {.id = 710, .distance = 39.855f}, {.id = 712, .distance = 39.947f}
-        }},
-        {492, {
-            {.id = 710, .distance = 27.498f}, {.id = 493, .distance = 28.665f}, {.id = 491, .distance = 28.744f}, {.id = 458, .distance = 35.922f}, {.id = 459, .distance = 39.243f}, {.id = 711, .distance = 39.255f}, {.id = 709, .distance = 39.752f}
-        }},
-        {493, {
-            {.id = 709, .distance = 27.628f}, {.id = 492, .distance = 28.665f}, {.id = 494, .distance = 28.989f}, {.id = 459, .distance = 35.562f}, {.id = 495, .distance = 37.946f}, {.id = 710, .distance = 39.790f}, {.id = 708, .distance = 39.805f}
-        }},
-        {494, {
-            {.id = 495, .distance = 22.522f}, {.id = 708, .distance = 27.583f}, {.id = 493, .distance = 28.989f}, {.id = 496, .distance = 28.989f}, {.id = 497, .distance = 38.748f}, {.id = 706, .distance = 39.435f}, {.id = 709, .distance = 40.007f}
-        }},
-        {495, {
-            {.id = 494, .distance = 22.522f}, {.id = 460, .distance = 23.803f}, {.id = 497, .distance = 27.573f}, {.id = 496, .distance = 35.430f}, {.id = 493, .distance = 37.946f}, {.id = 459, .distance = 41.982f}, {.id = 461, .distance = 43.096f}
-        }},
-        {496, {
-            {.id = 497, .distance = 25.732f}, {.id = 706, .distance = 27.473f}, {.id = 494, .distance = 28.989f}, {.id = 498, .distance = 30.699f}, {.id = 495, .distance = 35.430f}, {.id = 708, .distance = 40.223f}, {.id = 704, .distance = 49.900f}
-        }},
-        {497, {
-            {.id = 498, .distance = 25.715f}, {.id = 496, .distance = 25.732f}, {.id = 499, .distance = 27.009f}, {.id = 495, .distance = 27.573f}, {.id = 461, .distance = 38.124f}, {.id = 494, .distance = 38.748f}, {.id = 500, .distance = 38.795f}
-        }},
-        {498, {
-            {.id = 497, .distance = 25.715f}, {.id = 1140, .distance = 27.990f}, {.id = 500, .distance = 28.587f}, {.id = 496, .distance = 30.699f}, {.id = 499, .distance = 35.180f}, {.id = 1138, .distance = 41.739f}, {.id = 1142, .distance = 50.403f}
-        }},
-        {499, {
-            {.id = 500, .distance = 23.318f}, {.id = 461, .distance = 24.410f}, {.id = 497, .distance = 27.009f}, {.id = 498, .distance = 35.180f}, {.id = 462, .distance = 36.927f}, {.id = 501, .distance = 38.625f}, {.id = 495, .distance = 47.229f}
-        }},
-        {500, {
-            {.id = 499, .distance = 23.318f}, {.id = 1138, .distance = 28.526f}, {.id = 498, .distance = 28.587f}, {.id = 501, .distance = 28.648f}, {.id = 497, .distance = 38.795f}, {.id = 1140, .distance = 39.023f}, {.id = 1137, .distance = 41.888f}
-        }},
-        {501, {
-            {.id = 500, .distance = 28.648f}, {.id = 502, .distance = 28.678f}, {.id = 1137, .distance = 28.720f}, {.id = 462, .distance = 36.174f}, {.id = 499, .distance = 38.625f}, {.id = 1138, .distance = 38.975f}, {.id = 1136, .distance = 42.065f}
-        }},
-        {502, {
-            {.id = 503, .distance = 28.019f}, {.id = 1136, .distance = 28.593f}, {.id = 501, .distance = 28.678f}, {.id = 463, .distance = 33.528f}, {.id = 1137, .distance = 39.193f}, {.id = 1135, .distance = 42.010f}, {.id = 462, .distance = 43.787f}
-        }},
-        {503, {
-            {.id = 502, .distance = 28.019f}, {.id = 1135, .distance = 28.538f}, {.id = 504, .distance = 29.666f}, {.id = 1136, .distance = 38.440f}, {.id = 505, .distance = 39.143f}, {.id = 463, .distance = 39.292f}, {.id = 464, .distance = 40.843f}
-        }},
-        {504, {
-            {.id = 505, .distance = 23.574f}, {.id = 1134, .distance = 28.586f}, {.id = 506, .distance = 28.796f}, {.id = 503, .distance = 29.666f}, {.id = 507, .distance = 38.536f}, {.id = 1135, .distance = 38.933f}, {.id = 1132, .distance = 41.429f}
-        }},
-        {505, {
-            {.id = 504, .distance = 23.574f}, {.id = 464, .distance = 26.800f}, {.id = 507, .distance = 27.295f}, {.id = 465, .distance = 31.165f}, {.id = 506, .distance = 35.726f}, {.id = 503, .distance = 39.143f}, {.id = 509, .distance = 46.866f}
-        }},
-        {506, {
-            {.id = 507, .distance = 25.236f}, {.id = 1132, .distance = 28.551f}, {.id = 504, .distance = 28.796f}, {.id = 508, .distance = 30.643f}, {.id = 505, .distance = 35.726f}, {.id = 1134, .distance = 39.222f}, {.id = 509, .distance = 51.793f}
-        }},
-        {507, {
-            {.id = 506, .distance = 25.236f}, {.id = 508, .distance = 25.701f}, {.id = 505, .distance = 27.295f}, {.id = 509, .distance = 27.601f}, {.id = 465, .distance = 35.484f}, {.id = 504, .distance = 38.536f}, {.id = 510, .distance = 38.536f}
-        }},
-        {508, {
-            {.id = 507, .distance = 25.701f}, {.id = 510, .distance = 28.171f}, {.id = 382, .distance = 29.698f}, {.id = 506, .distance = 30.643f}, {.id = 509, .distance = 35.416f}, {.id = 380, .distance = 41.024f}, {.id = 1132, .distance = 50.454f}
-        }},
-        {509, {
-            {.id = 510, .distance = 23.046f}, {.id = 466, .distance = 26.974f}, {.id = 507, .distance = 27.601f}, {.id = 465, .distance = 32.025f}, {.id = 508, .distance = 35.416f}, {.id = 511, .distance = 38.124f}, {.id = 505, .distance = 46.866f}
-        }},
-        {510, {
-            {.id = 509, .distance = 23.046f}, {.id = 508, .distance = 28.171f}, {.id = 511, .distance = 28.796f}, {.id = 380, .distance = 29.884f}, {.id = 507, .distance = 38.536f}, {.id = 382, .distance = 40.907f}, {.id = 379, .distance = 41.803f}
-        }},
-        {511, {
-            {.id = 512, .distance = 28.739f}, {.id = 510, .distance = 28.796f}, {.id = 379, .distance = 29.688f}, {.id = 509, .distance = 38.124f}, {.id = 467, .distance = 40.058f}, {.id = 466, .distance = 40.759f}, {.id = 380, .distance = 41.264f}
-        }},
-        {512, {
-            {.id = 511, .distance = 28.739f}, {.id = 513, .distance = 28.996f}, {.id = 378, .distance = 29.797f}, {.id = 467, .distance = 34.006f}, {.id = 379, .distance = 41.093f}, {.id = 377, .distance = 41.143f}, {.id = 468, .distance = 43.930f}
-        }},
-        {513, {
-            {.id = 514, .distance = 28.539f}, {.id = 512, .distance = 28.996f}, {.id = 377, .distance = 29.685f}, {.id = 468, .distance = 35.652f}, {.id = 515, .distance = 38.072f}, {.id = 376, .distance = 41.095f}, {.id = 378, .distance = 41.280f}
-        }},
-        {514, {
-            {.id = 515, .distance = 23.229f}, {.id = 513, .distance = 28.539f}, {.id = 516, .distance = 29.175f}, {.id = 376, .distance = 29.702f}, {.id = 517, .distance = 38.795f}, {.id = 377, .distance = 41.304f}, {.id = 374, .distance = 41.540f}
-        }},
-        {515, {
-            {.id = 514, .distance = 23.229f}, {.id = 469, .distance = 24.656f}, {.id = 517, .distance = 27.373f}, {.id = 468, .distance = 35.973f}, {.id = 516, .distance = 36.131f}, {.id = 513, .distance = 38.072f}, {.id = 470, .distance = 47.750f}
-        }},
-        {516, {
-            {.id = 517, .distance = 26.133f}, {.id = 374, .distance = 29.051f}, {.id = 514, .distance = 29.175f}, {.id = 518, .distance = 30.723f}, {.id = 515, .distance = 36.131f}, {.id = 376, .distance = 41.571f}, {.id = 373, .distance = 52.211f}
-        }},
-        {517, {
-            {.id = 518, .distance = 25.813f}, {.id = 516, .distance = 26.133f}, {.id = 515, .distance = 27.373f}, {.id = 470, .distance = 27.856f}, {.id = 469, .distance = 38.273f}, {.id = 514, .distance = 38.795f}, {.id = 519, .distance = 39.458f}
-        }},
-        {518, {
-            {.id = 517, .distance = 25.813f}, {.id = 90, .distance = 29.473f}, {.id = 519, .distance = 29.479f}, {.id = 516, .distance = 30.723f}, {.id = 470, .distance = 35.561f}, {.id = 88, .distance = 41.626f}, {.id = 92, .distance = 51.460f}
-        }},
-        {519, {
-            {.id = 470, .distance = 22.863f}, {.id = 471, .distance = 28.096f}, {.id = 88, .distance = 29.181f}, {.id = 518, .distance = 29.479f}, {.id = 517, .distance = 39.458f}, {.id = 90, .distance = 41.051f}, {.id = 87, .distance = 41.749f}
-        }},
-        {520, {
-            {.id = 521, .distance = 25.256f}, {.id = 523, .distance = 25.653f}, {.id = 522, .distance = 25.660f}, {.id = 525, .distance = 26.237f}, {.id = 524, .distance = 26.780f}, {.id = 527, .distance = 53.251f}, {.id = 531, .distance = 53.584f}
-        }},
-        {521, {
-            {.id = 520, .distance = 25.256f}, {.id = 527, .distance = 27.996f}, {.id = 525, .distance = 30.406f}, {.id = 522, .distance = 30.745f}, {.id = 528, .distance = 36.902f}, {.id = 526, .distance = 36.902f}, {.id = 523, .distance = 48.670f}
-        }},
-        {522, {
-            {.id = 520, .distance = 25.660f}, {.id = 529, .distance = 28.138f}, {.id = 523, .distance = 30.016f}, {.id = 521, .distance = 30.745f}, {.id = 530, .distance = 35.779f}, {.id = 528, .distance = 37.730f}, {.id = 524, .distance = 49.623f}
-        }},
-        {523, {
-            {.id = 520, .distance = 25.653f}, {.id = 531, .distance = 27.950f}, {.id = 522, .distance = 30.016f}, {.id = 524, .distance = 30.334f}, {.id = 532, .distance = 36.663f}, {.id = 530, .distance = 36.917f}, {.id = 521, .distance = 48.670f}
-        }},
-        {524, {
-            {.id = 520, .distance = 26.780f}, {.id = 533, .distance = 28.148f}, {.id = 523, .distance = 30.334f}, {.id = 525, .distance = 30.829f}, {.id = 532, .distance = 36.041f}, {.id = 534, .distance = 36.581f}, {.id = 521, .distance = 49.415f}
-        }},
-        {525, {
-            {.id = 520, .distance = 26.237f}, {.id = 535, .distance = 28.784f}, {.id = 521, .distance = 30.406f}, {.id = 524, .distance = 30.829f}, {.id = 526, .distance = 36.136f}, {.id = 534, .distance = 36.663f}, {.id = 523, .distance = 49.028f}
-        }},
-        {526, {
-            {.id = 537, .distance = 29.943f}, {.id = 535, .distance = 32.709f}, {.id = 527, .distance = 33.241f}, {.id = 536, .distance = 35.999f}, {.id = 525, .distance = 36.136f}, {.id = 521, .distance = 36.902f}, {.id = 538, .distance = 43.146f}
-        }},
-        {527, {
-            {.id = 521, .distance = 27.996f}, {.id = 538, .distance = 31.091f}, {.id = 526, .distance = 33.241f}, {.id = 528, .distance = 33.489f}, {.id = 539, .distance = 33.997f}, {.id = 537, .distance = 46.465f}, {.id = 540, .distance = 50.872f}
-        }},
-        {528, {
-            {.id = 540, .distance = 28.795f}, {.id = 527, .distance = 33.489f}, {.id = 529, .distance = 34.526f}, {.id = 521, .distance = 36.902f}, {.id = 522, .distance = 37.730f}, {.id = 539, .distance = 39.001f}, {.id = 541, .distance = 39.043f}
-        }},
-        {529, {
-            {.id = 522, .distance = 28.138f}, {.id = 542, .distance = 30.119f}, {.id = 530, .distance = 32.862f}, {.id = 541, .distance = 33.326f}, {.id = 528, .distance = 34.526f}, {.id = 543, .distance = 46.032f}, {.id = 540, .distance = 51.953f}
-        }},
-        {530, {
-            {.id = 543, .distance = 29.271f}, {.id = 529, .distance = 32.862f}, {.id = 531, .distance = 32.910f}, {.id = 544, .distance = 35.475f}, {.id = 522, .distance = 35.779f}, {.id = 523, .distance = 36.917f}, {.id = 542, .distance = 42.036f}
-        }},
-        {531, {
-            {.id = 523, .distance = 27.950f}, {.id = 545, .distance = 30.515f}, {.id = 530, .distance = 32.910f}, {.id = 532, .distance = 34.288f}, {.id = 544, .distance = 35.680f}, {.id = 546, .distance = 43.747f}, {.id = 522, .distance = 50.881f}
-        }},
-        {532, {
-            {.id = 546, .distance = 30.713f}, {.id = 547, .distance = 32.961f}, {.id = 531, .distance = 34.288f}, {.id = 533, .distance = 34.333f}, {.id = 524, .distance = 36.041f}, {.id = 523, .distance = 36.663f}, {.id = 545, .distance = 47.436f}
-        }},
-        {533, {
-            {.id = 524, .distance = 28.148f}, {.id = 548, .distance = 28.795f}, {.id = 534, .distance = 32.474f}, {.id = 532, .distance = 34.333f}, {.id = 549, .distance = 37.853f}, {.id = 547, .distance = 39.529f}, {.id = 525, .distance = 52.029f}
-        }},
-        {534, {
-            {.id = 550, .distance = 30.978f}, {.id = 533, .distance = 32.474f}, {.id = 549, .distance = 33.378f}, {.id = 535, .distance = 34.135f}, {.id = 524, .distance = 36.581f}, {.id = 525, .distance = 36.663f}, {.id = 551, .distance = 47.075f}
-        }},
-        {535, {
-            {.id = 525, .distance = 28.784f}, {.id = 551, .distance = 29.314f}, {.id = 526, .distance = 32.709f}, {.id = 534, .distance = 34.135f}, {.id = 536, .distance = 35.428f}, {.id = 550, .distance = 42.934f}, {.id = 521, .distance = 52.730f}
-        }},
-        {536, {
-            {.id = 553, .distance = 31.937f}, {.id = 552, .distance = 31.964f}, {.id = 551, .distance = 32.088f}, {.id = 537, .distance = 32.704f}, {.id = 535, .distance = 35.428f}, {.id = 526, .distance = 35.999f}, {.id = 573, .distance = 49.921f}
-        }},
-        {537, {
-            {.id = 554, .distance = 29.419f}, {.id = 526, .distance = 29.943f}, {.id = 538, .distance = 32.468f}, {.id = 536, .distance = 32.704f}, {.id = 553, .distance = 37.491f}, {.id = 555, .distance = 41.947f}, {.id = 527, .distance = 46.465f}
-        }},
-        {538, {
-            {.id = 555, .distance = 29.848f}, {.id = 527, .distance = 31.091f}, {.id = 539, .distance = 31.917f}, {.id = 537, .distance = 32.468f}, {.id = 556, .distance = 35.426f}, {.id = 526, .distance = 43.146f}, {.id = 554, .distance = 44.568f}
-        }},
-        {539, {
-            {.id = 557, .distance = 30.775f}, {.id = 538, .distance = 31.917f}, {.id = 540, .distance = 32.089f}, {.id = 556, .distance = 33.457f}, {.id = 527, .distance = 33.997f}, {.id = 528, .distance = 39.001f}, {.id = 558, .distance = 47.195f}
-        }},
-        {540, {
-            {.id = 558, .distance = 28.126f}, {.id = 528, .distance = 28.795f}, {.id = 539, .distance = 32.089f}, {.id = 541, .distance = 33.350f}, {.id = 557, .distance = 38.606f}, {.id = 559, .distance = 40.686f}, {.id = 527, .distance = 50.872f}
-        }},
-        {541, {
-            {.id = 559, .distance = 30.745f}, {.id = 542, .distance = 32.585f}, {.id = 529, .distance = 33.326f}, {.id = 540, .distance = 33.350f}, {.id = 560, .distance = 33.990f}, {.id = 528, .distance = 39.043f}, {.id = 558, .distance = 47.230f}
-        }},
-        {542, {
-            {.id = 561, .distance = 30.088f}, {.id = 529, .distance = 30.119f}, {.id = 543, .distance = 32.298f}, {.id = 541, .distance = 32.585f}, {.id = 560, .distance = 35.628f}, {.id = 530, .distance = 42.036f}, {.id = 562, .distance = 44.864f}
-        }},
-        {543, {
-            {.id = 562, .distance = 28.726f}, {.id = 530, .distance = 29.271f}, {.id = 544, .distance = 31.916f}, {.id = 542, .distance = 32.298f}, {.id = 563, .distance = 37.444f}, {.id = 561, .distance = 42.067f}, {.id = 529, .distance = 46.032f}
-        }},
-        {544, {
-            {.id = 563, .distance = 31.889f}, {.id = 543, .distance = 31.916f}, {.id = 564, .distance = 32.458f}, {.id = 545, .distance = 32.605f}, {.id = 530, .distance = 35.475f}, {.id = 531, .distance = 35.680f}, {.id = 562, .distance = 49.358f}
-        }},
-        {545, {
-            {.id = 565, .distance = 28.557f}, {.id = 531, .distance = 30.515f}, {.id = 544, .distance = 32.605f}, {.id = 546, .distance = 33.386f}, {.id = 564, .distance = 36.707f}, {.id = 566, .distance = 42.276f}, {.id = 532, .distance = 47.436f}
-        }},
-        {546, {
-            {.id = 566, .distance = 29.283f}, {.id = 532, .distance = 30.713f}, {.id = 547, .distance = 32.395f}, {.id = 545, .distance = 33.386f}, {.id = 567, .distance = 35.383f}, {.id = 531, .distance = 43.747f}, {.id = 565, .distance = 45.069f}
-        }},
-        {547, {
-            {.id = 568, .distance = 30.492f}, {.id = 546, .distance = 32.395f}, {.id = 548, .distance = 32.492f}, {.id = 532, .distance = 32.961f}, {.id = 567, .distance = 33.774f}, {.id = 533, .distance = 39.529f}, {.id = 569, .distance = 46.947f}
-        }},
-        {548, {
-            {.id = 533, .distance = 28.795f}, {.id = 569, .distance = 28.796f}, {.id = 549, .distance = 31.301f}, {.id = 547, .distance = 32.492f}, {.id = 570, .distance = 39.130f}, {.id = 568, .distance = 39.658f}, {.id = 534, .distance = 50.236f}
-        }},
-        {549, {
-            {.id = 570, .distance = 30.076f}, {.id = 548, .distance = 31.301f}, {.id = 550, .distance = 33.324f}, {.id = 534, .distance = 33.378f}, {.id = 571, .distance = 33.386f}, {.id = 533, .distance = 37.853f}, {.id = 569, .distance = 46.778f}
-        }},
-        {550, {
-            {.id = 572, .distance = 29.653f}, {.id = 534, .distance = 30.978f}, {.id = 551, .distance = 32.852f}, {.id = 549, .distance = 33.324f}, {.id = 571, .distance = 35.446f}, {.id = 535, .distance = 42.934f}, {.id = 573, .distance = 44.581f}
-        }},
-        {551, {
-            {.id = 573, .distance = 28.776f}, {.id = 535, .distance = 29.314f}, {.id = 536, .distance = 32.088f}, {.id = 550, .distance = 32.852f}, {.id = 552, .distance = 36.954f}, {.id = 572, .distance = 42.498f}, {.id = 534, .distance = 47.075f}
-        }},
-        {552, {
-            {.id = 574, .distance = 23.617f}, {.id = 573, .distance = 31.442f}, {.id = 536, .distance = 31.964f}, {.id = 553, .distance = 32.703f}, {.id = 551, .distance = 36.954f}, {.id = 621, .distance = 41.259f}, {.id = 623, .distance = 45.103f}
-        }},
-        {553, {
-            {.id = 536, .distance = 31.937f}, {.id = 552, .distance = 32.703f}, {.id = 554, .distance = 32.725f}, {.id = 575, .distance = 36.068f}, {.id = 537, .distance = 37.491f}, {.id = 576, .distance = 39.068f}, {.id = 574, .distance = 41.895f}
-        }},
-        {554, {
-            {.id = 537, .distance = 29.419f}, {.id = 555, .distance = 30.638f}, {.id = 553, .distance = 32.725f}, {.id = 576, .distance = 35.794f}, {.id = 577, .distance = 36.665f}, {.id = 538, .distance = 44.568f}, {.id = 578, .distance = 46.412f}
-        }},
-        {555, {
-            {.id = 578, .distance = 24.191f}, {.id = 538, .distance = 29.848f}, {.id = 554, .distance = 30.638f}, {.id = 556, .distance = 31.516f}, {.id = 537, .distance = 41.947f}, {.id = 579, .distance = 44.167f}, {.id = 577, .distance = 44.460f}
-        }},
-        {556, {
-            {.id = 583, .distance = 27.519f}, {.id = 555, .distance = 31.516f}, {.id = 557, .distance = 33.096f}, {.id = 539, .distance = 33.457f}, {.id = 538, .distance = 35.426f}, {.id = 580, .distance = 35.506f}, {.id = 578, .distance = 36.051f}
-        }},
-        {557, {
-            {.id = 539, .distance = 30.775f}, {.id = 558, .distance = 30.943f}, {.id = 583, .distance = 31.347f}, {.id = 556, .distance = 33.096f}, {.id = 585, .distance = 37.393f}, {.id = 540, .distance = 38.606f}, {.id = 584, .distance = 45.102f}
-        }},
-        {558, {
-            {.id = 540, .distance = 28.126f}, {.id = 557, .distance = 30.943f}, {.id = 559, .distance = 32.322f}, {.id = 586, .distance = 33.115f}, {.id = 585, .distance = 43.474f}, {.id = 587, .distance = 44.048f}, {.id = 539, .distance = 47.195f}
-        }},
-        {559, {
-            {.id = 589, .distance = 30.540f}, {.id = 541, .distance = 30.745f}, {.id = 558, .distance = 32.322f}, {.id = 560, .distance = 32.441f}, {.id = 587, .distance = 37.153f}, {.id = 540, .distance = 40.686f}, {.id = 588, .distance = 45.279f}
-        }},
-        {560, {
-            {.id = 589, .distance = 27.373f}, {.id = 561, .distance = 31.563f}, {.id = 559, .distance = 32.441f}, {.id = 541, .distance = 33.990f}, {.id = 591, .distance = 35.618f}, {.id = 542, .distance = 35.628f}, {.id = 593, .distance = 36.566f}
-        }},
-        {561, {
-            {.id = 593, .distance = 24.293f}, {.id = 542, .distance = 30.088f}, {.id = 560, .distance = 31.563f}, {.id = 562, .distance = 31.793f}, {.id = 543, .distance = 42.067f}, {.id = 594, .distance = 43.775f}, {.id = 595, .distance = 43.787f}
-        }},
-        {562, {
-            {.id = 543, .distance = 28.726f}, {.id = 563, .distance = 31.427f}, {.id = 561, .distance = 31.793f}, {.id = 596, .distance = 35.922f}, {.id = 595, .distance = 37.333f}, {.id = 542, .distance = 44.864f}, {.id = 593, .distance = 47.704f}
-        }},
-        {563, {
-            {.id = 562, .distance = 31.427f}, {.id = 544, .distance = 31.889f}, {.id = 564, .distance = 32.342f}, {.id = 597, .distance = 35.562f}, {.id = 543, .distance = 37.444f}, {.id = 596, .distance = 39.243f}, {.id = 599, .distance = 41.982f}
-        }},
-        {564, {
-            {.id = 599, .distance = 23.803f}, {.id = 565, .distance = 31.693f}, {.id = 563, .distance = 32.342f}, {.id = 544, .distance = 32.458f}, {.id = 545, .distance = 36.707f}, {.id = 601, .distance = 41.333f}, {.id = 598, .distance = 44.974f}
-        }},
-        {565, {
-            {.id = 603, .distance = 24.410f}, {.id = 545, .distance = 28.557f}, {.id = 564, .distance = 31.693f}, {.id = 566, .distance = 32.138f}, {.id = 601, .distance = 38.124f}, {.id = 599, .distance = 43.096f}, {.id = 546, .distance = 45.069f}
-        }},
-        {566, {
-            {.id = 546, .distance = 29.283f}, {.id = 567, .distance = 31.589f}, {.id = 565, .distance = 32.138f}, {.id = 605, .distance = 36.174f}, {.id = 603, .distance = 36.927f}, {.id = 545, .distance = 42.276f}, {.id = 606, .distance = 43.787f}
-        }},
-        {567, {
-            {.id = 566, .distance = 31.589f}, {.id = 568, .distance = 32.185f}, {.id = 606, .distance = 33.528f}, {.id = 547, .distance = 33.774f}, {.id = 546, .distance = 35.383f}, {.id = 607, .distance = 39.292f}, {.id = 605, .distance = 48.151f}
-        }},
-        {568, {
-            {.id = 609, .distance = 26.800f}, {.id = 547, .distance = 30.492f}, {.id = 569, .distance = 31.085f}, {.id = 567, .distance = 32.185f}, {.id = 548, .distance = 39.658f}, {.id = 607, .distance = 40.843f}, {.id = 608, .distance = 44.297f}
-        }},
-        {569, {
-            {.id = 548, .distance = 28.796f}, {.id = 568, .distance = 31.085f}, {.id = 609, .distance = 31.165f}, {.id = 570, .distance = 31.748f}, {.id = 613, .distance = 32.025f}, {.id = 611, .distance = 35.484f}, {.id = 549, .distance = 46.778f}
-        }},
-        {570, {
-            {.id = 613, .distance = 26.974f}, {.id = 549, .distance = 30.076f}, {.id = 571, .distance = 31.574f}, {.id = 569, .distance = 31.748f}, {.id = 548, .distance = 39.130f}, {.id = 615, .distance = 40.759f}, {.id = 614, .distance = 44.255f}
-        }},
-        {571, {
-            {.id = 570, .distance = 31.574f}, {.id = 572, .distance = 32.495f}, {.id = 549, .distance = 33.386f}, {.id = 616, .distance = 34.006f}, {.id = 550, .distance = 35.446f}, {.id = 615, .distance = 40.058f}, {.id = 617, .distance = 48.765f}
-        }},
-        {572, {
-            {.id = 550, .distance = 29.653f}, {.id = 573, .distance = 31.761f}, {.id = 571, .distance = 32.495f}, {.id = 617, .distance = 35.652f}, {.id = 619, .distance = 35.973f}, {.id = 551, .distance = 42.498f}, {.id = 616, .distance = 43.930f}
-        }},
-        {573, {
-            {.id = 619, .distance = 24.656f}, {.id = 551, .distance = 28.776f}, {.id = 552, .distance = 31.442f}, {.id = 572, .distance = 31.761f}, {.id = 621, .distance = 38.273f}, {.id = 574, .distance = 43.129f}, {.id = 550, .distance = 44.581f}
-        }},
-        {574, {
-            {.id = 623, .distance = 22.863f}, {.id = 552, .distance = 23.617f}, {.id = 621, .distance = 27.856f}, {.id = 622, .distance = 35.561f}, {.id = 575, .distance = 37.917f}, {.id = 553, .distance = 41.895f}, {.id = 573, .distance = 43.129f}
-        }},
-        {575, {
-            {.id = 623, .distance = 28.096f}, {.id = 576, .distance = 29.153f}, {.id = 77, .distance = 29.296f}, {.id = 553, .distance = 36.068f}, {.id = 574, .distance = 37.917f}, {.id = 76, .distance = 40.703f}, {.id = 78, .distance = 41.400f}
-        }},
-        {576, {
-            {.id = 577, .distance = 28.265f}, {.id = 575, .distance = 29.153f}, {.id = 76, .distance = 29.691f}, {.id = 554, .distance = 35.794f}, {.id = 553, .distance = 39.068f}, {.id = 75, .distance = 40.851f}, {.id = 77, .distance = 41.883f}
-        }},
-        {577, {
-            {.id = 576, .distance = 28.265f}, {.id = 579, .distance = 28.989f}, {.id = 75, .distance = 29.345f}, {.id = 554, .distance = 36.665f}, {.id = 578, .distance = 38.712f}, {.id = 74, .distance = 40.738f}, {.id = 76, .distance = 41.214f}
-        }},
-        {578, {
-            {.id = 579, .distance = 23.607f}, {.id = 555, .distance = 24.191f}, {.id = 580, .distance = 27.455f}, {.id = 581, .distance = 35.536f}, {.id = 556, .distance = 36.051f}, {.id = 577, .distance = 38.712f}, {.id = 554, .distance = 46.412f}
-        }},
-        {579, {
-            {.id = 578, .distance = 23.607f}, {.id = 581, .distance = 28.500f}, {.id = 577, .distance = 28.989f}, {.id = 74, .distance = 29.310f}, {.id = 580, .distance = 38.998f}, {.id = 72, .distance = 40.243f}, {.id = 75, .distance = 41.503f}
-        }},
-        {580, {
-            {.id = 581, .distance = 25.823f}, {.id = 582, .distance = 26.007f}, {.id = 583, .distance = 27.304f}, {.id = 578, .distance = 27.455f}, {.id = 556, .distance = 35.506f}, {.id = 579, .distance = 38.998f}, {.id = 584, .distance = 39.242f}
-        }},
-        {581, {
-            {.id = 580, .distance = 25.823f}, {.id = 579, .distance = 28.500f}, {.id = 72, .distance = 29.549f}, {.id = 582, .distance = 30.900f}, {.id = 578, .distance = 35.536f}, {.id = 74, .distance = 41.456f}, {.id = 194, .distance = 51.536f}
-        }},
-        {582, {
-            {.id = 580, .distance = 26.007f}, {.id = 194, .distance = 28.580f}, {.id = 584, .distance = 29.614f}, {.id = 581, .distance = 30.900f}, {.id = 583, .distance = 35.963f}, {.id = 192, .distance = 40.019f}, {.id = 196, .distance = 51.461f}
-        }},
-        {583, {
-            {.id = 584, .distance = 23.404f}, {.id = 580, .distance = 27.304f}, {.id = 556, .distance = 27.519f}, {.id = 557, .distance = 31.347f}, {.id = 582, .distance = 35.963f}, {.id = 585, .distance = 38.924f}, {.id = 578, .distance = 47.034f}
-        }},
-        {584, {
-            {.id = 583, .distance = 23.404f}, {.id = 585, .distance = 28.584f}, {.id = 192, .distance = 28.638f}, {.id = 582, .distance = 29.614f}, {.id = 580, .distance = 39.242f}, {.id = 191, .distance = 40.269f}, {.id = 194, .distance = 41.724f}
-        }},
-        {585, {
-            {.id = 586, .distance = 28.069f}, {.id = 191, .distance = 28.459f}, {.id = 584, .distance = 28.584f}, {.id = 557, .distance = 37.393f}, {.id = 583, .distance = 38.924f}, {.id = 190, .distance = 39.725f}, {.id = 192, .distance = 41.284f}
-        }},
-        {586, {
-            {.id = 585, .distance = 28.069f}, {.id = 190, .distance = 28.695f}, {.id = 587, .distance = 28.840f}, {.id = 558, .distance = 33.115f}, {.id = 189, .distance = 40.338f}, {.id = 191, .distance = 40.350f}, {.id = 557, .distance = 48.228f}
-        }},
-        {587, {
-            {.id = 189, .distance = 28.736f}, {.id = 586, .distance = 28.840f}, {.id = 588, .distance = 29.098f}, {.id = 559, .distance = 37.153f}, {.id = 589, .distance = 38.371f}, {.id = 188, .distance = 40.206f}, {.id = 190, .distance = 40.940f}
-        }},
-        {588, {
-            {.id = 589, .distance = 23.468f}, {.id = 590, .distance = 28.067f}, {.id = 188, .distance = 28.751f}, {.id = 587, .distance = 29.098f}, {.id = 591, .distance = 37.859f}, {.id = 186, .distance = 39.803f}, {.id = 189, .distance = 41.267f}
-        }},
-        {589, {
-            {.id = 588, .distance = 23.468f}, {.id = 591, .distance = 26.995f}, {.id = 560, .distance = 27.373f}, {.id = 559, .distance = 30.540f}, {.id = 590, .distance = 35.584f}, {.id = 587, .distance = 38.371f}, {.id = 593, .distance = 47.445f}
-        }},
-        {590, {
-            {.id = 591, .distance = 25.235f}, {.id = 588, .distance = 28.067f}, {.id = 186, .distance = 28.672f}, {.id = 592, .distance = 31.314f}, {.id = 589, .distance = 35.584f}, {.id = 188, .distance = 40.855f}, {.id = 818, .distance = 50.621f}
-        }},
-        {591, {
-            {.id = 590, .distance = 25.235f}, {.id = 592, .distance = 25.959f}, {.id = 589, .distance = 26.995f}, {.id = 593, .distance = 28.280f}, {.id = 560, .distance = 35.618f}, {.id = 588, .distance = 37.859f}, {.id = 594, .distance = 39.348f}
-        }},
-        {592, {
-            {.id = 591, .distance = 25.959f}, {.id = 818, .distance = 27.690f}, {.id = 594, .distance = 28.175f}, {.id = 590, .distance = 31.314f}, {.id = 593, .distance = 35.099f}, {.id = 816, .distance = 39.154f}, {.id = 819, .distance = 50.900f}
-        }},
-        {593, {
-            {.id = 594, .distance = 22.858f}, {.id = 561, .distance = 24.293f}, {.id = 591, .distance = 28.280f}, {.id = 592, .distance = 35.099f}, {.id = 560, .distance = 36.566f}, {.id = 595, .distance = 37.718f}, {.id = 589, .distance = 47.445f}
-        }},
-        {594, {
-            {.id = 593, .distance = 22.858f}, {.id = 816, .distance = 27.436f}, {.id = 592, .distance = 28.175f}, {.id = 595, .distance = 28.665f}, {.id = 591, .distance = 39.348f}, {.id = 818, .distance = 40.114f}, {.id = 815, .distance = 40.252f}
-        }},
-        {595, {
-            {.id = 815, .distance = 27.613f}, {.id = 594, .distance = 28.665f}, {.id = 596, .distance = 28.744f}, {.id = 562, .distance = 37.333f}, {.id = 593, .distance = 37.718f}, {.id = 814, .distance = 39.855f}, {.id = 816, .distance = 39.947f}
-        }},
-        {596, {
-            {.id = 814, .distance = 27.498f}, {.id = 597, .distance = 28.665f}, {.id = 595, .distance = 28.744f}, {.id = 562, .distance = 35.922f}, {.id = 563, .distance = 39.243f}, {.id = 815, .distance = 39.255f}, {.id = 813, .distance = 39.752f}
-        }},
-        {597, {
-            {.id = 813, .distance = 27.628f}, {.id = 596, .distance = 28.665f}, {.id = 598, .distance = 28.989f}, {.id = 563, .distance = 35.562f}, {.id = 599, .distance = 37.946f}, {.id = 814, .distance = 39.790f}, {.id = 812, .distance = 39.805f}
-        }},
-        {598, {
-            {.id = 599, .distance = 22.522f}, {.id = 812, .distance = 27.583f}, {.id = 597, .distance = 28.989f}, {.id = 600, .distance = 28.989f}, {.id = 601, .distance = 38.748f}, {.id = 810, .distance = 39.435f}, {.id = 813, .distance = 40.007f}
-        }},
-        {599, {
-            {.id = 598, .distance = 22.522f}, {.id = 564, .distance = 23.803f}, {.id = 601, .distance = 27.573f}, {.id = 600, .distance = 35.430f}, {.id = 597, .distance = 37.946f}, {.id = 563, .distance = 41.982f}, {.id = 565, .distance = 43.096f}
-        }},
-        {600, {
-            {.id = 601, .distance = 25.732f}, {.id = 810, .distance = 27.473f}, {.id = 598, .distance = 28.989f}, {.id = 602, .distance = 30.699f}, {.id = 599, .distance = 35.430f}, {.id = 812, .distance = 40.223f}, {.id = 808, .distance = 49.900f}
-        }},
-        {601, {
-            {.id = 602, .distance = 25.715f}, {.id = 600, .distance = 25.732f}, {.id = 603, .distance = 27.009f}, {.id = 599, .distance = 27.573f}, {.id = 565, .distance = 38.124f}, {.id = 598, .distance = 38.748f}, {.id = 604, .distance = 38.795f}
-        }},
-        {602, {
-            {.id = 601, .distance = 25.715f}, {.id = 724, .distance = 27.990f}, {.id = 604, .distance = 28.587f}, {.id = 600, .distance = 30.699f}, {.id = 603, .distance = 35.180f}, {.id = 722, .distance = 41.739f}, {.id = 726, .distance = 50.403f}
-        }},
-        {603, {
-            {.id = 604, .distance = 23.318f}, {.id = 565, .distance = 24.410f}, {.id = 601, .distance = 27.009f}, {.id = 602, .distance = 35.180f}, {.id = 566, .distance = 36.927f}, {.id = 605, .distance = 38.625f}, {.id = 599, .distance = 47.229f}
-        }},
-        {604, {
-            {.id = 603, .distance = 23.318f}, {.id = 722, .distance = 28.526f}, {.id = 602, .distance = 28.587f}, {.id = 605, .distance = 28.648f}, {.id = 601, .distance = 38.795f}, {.id = 724, .distance = 39.023f}, {.id = 721, .distance = 41.888f}
-        }},
-        {605, {
-            {.id = 604, .distance = 28.648f}, {.id = 606, .distance = 28.678f}, {.id = 721, .distance = 28.720f}, {.id = 566, .distance = 36.174f}, {.id = 603, .distance = 38.625f}, {.id = 722, .distance = 38.975f}, {.id = 720, .distance = 42.065f}
-        }},
-        {606, {
-            {.id = 607, .distance = 28.019f}, {.id = 720, .distance = 28.593f}, {.id = 605, .distance = 28.678f}, {.id = 567, .distance = 33.528f}, {.id = 721, .distance = 39.193f}, {.id = 719, .distance = 42.010f}, {.id = 566, .distance = 43.787f}
-        }},
-        {607, {
-            {.id = 606, .distance = 28.019f}, {.id = 719, .distance = 28.538f}, {.id = 608, .distance = 29.666f}, {.id = 720, .distance = 38.440f}, {.id = 609, .distance = 39.143f}, {.id = 567, .distance = 39.292f}, {.id = 568, .distance = 40.843f}
-        }},
-        {608, {
-            {.id = 609, .distance = 23.574f}, {.id = 718, .distance = 28.586f}, {.id = 610, .distance = 28.796f}, {.id = 607, .distance = 29.666f}, {.id = 611, .distance = 38.536f}, {.id = 719, .distance = 38.933f}, {.id = 716, .distance = 41.429f}
-        }},
-        {609, {
-            {.id = 608, .distance = 23.574f}, {.id = 568, .distance = 26.800f}, {.id = 611, .distance = 27.295f}, {.id = 569, .distance = 31.165f}, {.id = 610, .distance = 35.726f}, {.id = 607, .distance = 39.143f}, {.id = 613, .distance = 46.866f}
-        }},
-        {610, {
-            {.id = 611, .distance = 25.236f}, {.id = 716, .distance = 28.551f}, {.id = 608, .distance = 28.796f}, {.id = 612, .distance = 30.643f}, {.id = 609, .distance = 35.726f}, {.id = 718, .distance = 39.222f}, {.id = 613, .distance = 51.793f}
-        }},
-        {611, {
-            {.id = 610, .distance = 25.236f}, {.id = 612, .distance = 25.701f}, {.id = 609, .distance = 27.295f}, {.id = 613, .distance = 27.601f}, {.id = 569, .distance = 35.484f}, {.id = 608, .distance = 38.536f}, {.id = 614, .distance = 38.536f}
-        }},
-        {612, {
-            {.id = 611, .distance = 25.701f}, {.id = 614, .distance = 28.171f}, {.id = 486, .distance = 29.698f}, {.id = 610, .distance = 30.643f}, {.id = 613, .distance = 35.416f}, {.id = 484, .distance = 41.024f}, {.id = 716, .distance = 50.454f}
-        }},
-        {613, {
-            {.id = 614, .distance = 23.046f}, {.id = 570, .distance = 26.974f}, {.id = 611, .distance = 27.601f}, {.id = 569, .distance = 32.025f}, {.id = 612, .distance = 35.416f}, {.id = 615, .distance = 38.124f}, {.id = 609, .distance = 46.866f}
-        }},
-        {614, {
-            {.id = 613, .distance = 23.046f}, {.id = 612, .distance = 28.171f}, {.id = 615, .distance = 28.796f}, {.id = 484, .distance = 29.884f}, {.id = 611, .distance = 38.536f}, {.id = 486, .distance = 40.907f}, {.id = 483, .distance = 41.803f}
-        }},
-        {615, {
-            {.id = 616, .distance = 28.739f}, {.id = 614, .distance = 28.796f}, {.id = 483, .distance = 29.688f}, {.id = 613, .distance = 38.124f}, {.id = 571, .distance = 40.058f}, {.id = 570, .distance = 40.759f}, {.id = 484, .distance = 41.264f}
-        }},
-        {616, {
-            {.id = 615, .distance = 28.739f}, {.id = 617, .distance = 28.996f}, {.id = 482, .distance = 29.797f}, {.id = 571, .distance = 34.006f}, {.id = 483, .distance = 41.093f}, {.id = 481, .distance = 41.143f}, {.id = 572, .distance = 43.930f}
-        }},
-        {617, {
-            {.id = 618, .distance = 28.539f}, {.id = 616, .distance = 28.996f}, {.id = 481, .distance = 29.685f}, {.id = 572, .distance = 35.652f}, {.id = 619, .distance = 38.072f}, {.id = 480, .distance = 41.095f}, {.id = 482, .distance = 41.280f}
-        }},
-        {618, {
-            {.id = 619, .distance = 23.229f}, {.id = 617, .distance = 28.539f}, {.id = 620, .distance = 29.175f}, {.id = 480, .distance = 29.702f}, {.id = 621, .distance = 38.795f}, {.id = 481, .distance = 41.304f}, {.id = 478, .distance = 41.540f}
-        }},
-        {619, {
-            {.id = 618, .distance = 23.229f}, {.id = 573, .distance = 24.656f}, {.id = 621, .distance = 27.373f}, {.id = 572, .distance = 35.973f}, {.id = 620, .distance = 36.131f}, {.id = 617, .distance = 38.072f}, {.id = 574, .distance = 47.750f}
-        }},
-        {620, {
-            {.id = 621, .distance = 26.133f}, {.id = 478, .distance = 29.051f}, {.id = 618, .distance = 29.175f}, {.id = 622, .distance = 30.723f}, {.id = 619, .distance = 36.131f}, {.id = 480, .distance = 41.571f}, {.id = 80, .distance = 51.803f}
-        }},
-        {621, {
-            {.id = 622, .distance = 25.813f}, {.id = 620, .distance = 26.133f}, {.id = 619, .distance = 27.373f}, {.id = 574, .distance = 27.856f}, {.id = 573, .distance = 38.273f}, {.id = 618, .distance = 38.795f}, {.id = 623, .distance = 39.458f}
-        }},
-        {622, {
-            {.id = 621, .distance = 25.813f}, {.id = 80, .distance = 29.465f}, {.id = 623, .distance = 29.479f}, {.id = 620, .distance = 30.723f}, {.id = 574, .distance = 35.561f}, {.id = 78, .distance = 40.864f}, {.id = 478, .distance = 51.840f}
-        }},
-        {623, {
-            {.id = 574, .distance = 22.863f}, {.id = 575, .distance = 28.096f}, {.id = 78, .distance = 29.440f}, {.id = 622, .distance = 29.479f}, {.id = 621, .distance = 39.458f}, {.id = 77, .distance = 40.496f}, {.id = 80, .distance = 42.121f}
-        }},
-        {624, {
-            {.id = 625, .distance = 25.256f}, {.id = 627, .distance = 25.653f}, {.id = 626, .distance = 25.660f}, {.id = 629, .distance = 26.237f}, {.id = 628, .distance = 26.780f}, {.id = 631, .distance = 53.251f}, {.id = 635, .distance = 53.584f}
-        }},
-        {625, {
-            {.id = 624, .distance = 25.256f}, {.id = 631, .distance = 27.996f}, {.id = 629, .distance = 30.406f}, {.id = 626, .distance = 30.745f}, {.id = 632, .distance = 36.902f}, {.id = 630, .distance = 36.902f}, {.id = 627, .distance = 48.670f}
-        }},
-        {626, {
-            {.id = 624, .distance = 25.660f}, {.id = 633, .distance = 28.138f}, {.id = 627, .distance = 30.016f}, {.id = 625, .distance = 30.745f}, {.id = 634, .distance = 35.779f}, {.id = 632, .distance = 37.730f}, {.id = 628, .distance = 49.623f}
-        }},
-        {627, {
-            {.id = 624, .distance = 25.653f}, {.id = 635, .distance = 27.950f}, {.id = 626, .distance = 30.016f}, {.id = 628, .distance = 30.334f}, {.id = 636, .distance = 36.663f}, {.id = 634, .distance = 36.917f}, {.id = 625, .distance = 48.670f}
-        }},
-        {628, {
-            {.id = 624, .distance = 26.780f}, {.id = 637, .distance = 28.148f}, {.id = 627, .distance = 30.334f}, {.id = 629, .distance = 30.829f}, {.id = 636, .distance = 36.041f}, {.id = 638, .distance = 36.581f}, {.id = 625, .distance = 49.415f}
-        }},
-        {629, {
-            {.id = 624, .distance = 26.237f}, {.id = 639, .distance = 28.784f}, {.id = 625, .distance = 30.406f}, {.id = 628, .distance = 30.829f}, {.id = 630, .distance = 36.136f}, {.id = 638, .distance = 36.663f}, {.id = 627, .distance = 49.028f}
-        }},
-        {630, {
-            {.id = 641, .distance = 29.943f}, {.id = 639, .distance = 32.709f}, {.id = 631, .distance = 33.241f}, {.id = 640, .distance = 35.999f}, {.id = 629, .distance = 36.136f}, {.id = 625, .distance = 36.902f}, {.id = 642, .distance = 43.146f}
-        }},
-        {631, {
-            {.id = 625, .distance = 27.996f}, {.id = 642, .distance = 31.091f}, {.id = 630, .distance = 33.241f}, {.id = 632, .distance = 33.489f}, {.id = 643, .distance = 33.997f}, {.id = 641, .distance = 46.465f}, {.id = 644, .distance = 50.872f}
-        }},
-        {632, {
-            {.id = 644, .distance = 28.795f}, {.id = 631, .distance = 33.489f}, {.id = 633, .distance = 34.526f}, {.id = 625, .distance = 36.902f}, {.id = 626, .distance = 37.730f}, {.id = 643, .distance = 39.001f}, {.id = 645, .distance = 39.043f}
-        }},
-        {633, {
-            {.id = 626, .distance = 28.138f}, {.id = 646, .distance = 30.119f}, {.id = 634, .distance = 32.862f}, {.id = 645, .distance = 33.326f}, {.id = 632, .distance = 34.526f}, {.id = 647, .distance = 46.032f}, {.id = 644, .distance = 51.953f}
-        }},
-        {634, {
-            {.id = 647, .distance = 29.271f}, {.id = 633, .distance = 32.862f}, {.id = 635, .distance = 32.910f}, {.id = 648, .distance = 35.475f}, {.id = 626, .distance = 35.779f}, {.id = 627, .distance = 36.917f}, {.id = 646, .distance = 42.036f}
-        }},
-        {635, {
-            {.id = 627, .distance = 27.950f}, {.id = 649, .distance = 30.515f}, {.id = 634, .distance = 32.910f}, {.id = 636, .distance = 34.288f}, {.id = 648, .distance = 35.680f}, {.id = 650, .distance = 43.747f}, {.id = 626, .distance = 50.881f}
-        }},
-        {636, {
-            {.id = 650, .distance = 30.713f}, {.id = 651, .distance = 32.961f}, {.id = 635, .distance = 34.288f}, {.id = 637, .distance = 34.333f}, {.id = 628, .distance = 36.041f}, {.id = 627, .distance = 36.663f}, {.id = 649, .distance = 47.436f}
-        }},
-        {637, {
-            {.id = 628, .distance = 28.148f}, {.id = 652, .distance = 28.795f}, {.id = 638, .distance = 32.474f}, {.id = 636, .distance = 34.333f}, {.id = 653, .distance = 37.853f}, {.id = 651, .distance = 39.529f}, {.id = 629, .distance = 52.029f}
-        }},
-        {638, {
-            {.id = 654, .distance = 30.978f}, {.id = 637, .distance = 32.474f}, {.id = 653, .distance = 33.378f}, {.id = 639, .distance = 34.135f}, {.id = 628, .distance = 36.581f}, {.id = 629, .distance = 36.663f}, {.id = 655, .distance = 47.075f}
-        }},
-        {639, {
-            {.id = 629, .distance = 28.784f}, {.id = 655, .distance = 29.314f}, {.id = 630, .distance = 32.709f}, {.id = 638, .distance = 34.135f}, {.id = 640, .distance = 35.428f}, {.id = 654, .distance = 42.934f}, {.id = 625, .distance = 52.730f}
-        }},
-        {640, {
-            {.id = 657, .distance = 31.937f}, {.id = 656, .distance = 31.964f}, {.id = 655, .distance = 32.088f}, {.id = 641, .distance = 32.704f}, {.id = 639, .distance = 35.428f}, {.id = 630, .distance = 35.999f}, {.id = 677, .distance = 49.921f}
-        }},
-        {641, {
-            {.id = 658, .distance = 29.419f}, {.id = 630, .distance = 29.943f}, {.id = 642, .distance = 32.468f}, {.id = 640, .distance = 32.704f}, {.id = 657, .distance = 37.491f}, {.id = 659, .distance = 41.947f}, {.id = 631, .distance = 46.465f}
-        }},
-        {642, {
-            {.id = 659, .distance = 29.848f}, {.id = 631, .distance = 31.091f}, {.id = 643, .distance = 31.917f}, {.id = 641, .distance = 32.468f}, {.id = 660, .distance = 35.426f}, {.id = 630, .distance = 43.146f}, {.id = 658, .distance = 44.568f}
-        }},
-        {643, {
-            {.id = 661, .distance = 30.775f}, {.id = 642, .distance = 31.917f}, {.id = 644, .distance = 32.089f}, {.id = 660, .distance = 33.457f}, {.id = 631, .distance = 33.997f}, {.id = 632, .distance = 39.001f}, {.id = 662, .distance = 47.195f}
-        }},
-        {644, {
-            {.id = 662, .distance = 28.126f}, {.id = 632, .distance = 28.795f}, {.id = 643, .distance = 32.089f}, {.id = 645, .distance = 33.350f}, {.id = 661, .distance = 38.606f}, {.id = 663, .distance = 40.686f}, {.id = 631, .distance = 50.872f}
-        }},
-        {645, {
-            {.id = 663, .distance = 30.745f}, {.id = 646, .distance = 32.585f}, {.id = 633, .distance = 33.326f}, {.id = 644, .distance = 33.350f}, {.id = 664, .distance = 33.990f}, {.id = 632, .distance = 39.043f}, {.id = 662, .distance = 47.230f}
-        }},
-        {646, {
-            {.id = 665, .distance = 30.088f}, {.id = 633, .distance = 30.119f}, {.id = 647, .distance = 32.298f}, {.id = 645, .distance = 32.585f}, {.id = 664, .distance = 35.628f}, {.id = 634, .distance = 42.036f}, {.id = 666, .distance = 44.864f}
-        }},
-        {647, {
-            {.id = 666, .distance = 28.726f}, {.id = 634, .distance = 29.271f}, {.id = 648, .distance = 31.916f}, {.id = 646, .distance = 32.298f}, {.id = 667, .distance = 37.444f}, {.id = 665, .distance = 42.067f}, {.id = 633, .distance = 46.032f}
-        }},
-        {648, {
-            {.id = 667, .distance = 31.889f}, {.id = 647, .distance = 31.916f}, {.id = 668, .distance = 32.458f}, {.id = 649, .distance = 32.605f}, {.id = 634, .distance = 35.475f}, {.id = 635, .distance = 35.680f}, {.id = 666, .distance = 49.358f}
-        }},
-        {649, {
-            {.id = 669, .distance = 28.557f}, {.id = 635, .distance = 30.515f}, {.id = 648, .distance = 32.605f}, {.id = 650, .distance = 33.386f}, {.id = 668, .distance = 36.707f}, {.id = 670, .distance = 42.276f}, {.id = 636, .distance = 47.436f}
-        }},
-        {650, {
-            {.id = 670, .distance = 29.283f}, {.id = 636, .distance = 30.713f}, {.id = 651, .distance = 32.395f}, {.id = 649, .distance = 33.386f}, {.id = 671, .distance = 35.383f}, {.id = 635, .distance = 43.747f}, {.id = 669, .distance = 45.069f}
-        }},
-        {651, {
-            {.id = 672, .distance = 30.492f}, {.id = 650, .distance = 32.395f}, {.id = 652, .distance = 32.492f}, {.id = 636, .distance = 32.961f}, {.id = 671, .distance = 33.774f}, {.id = 637, .distance = 39.529f}, {.id = 673, .distance = 46.947f}
-        }},
-        {652, {
-            {.id = 637, .distance = 28.795f}, {.id = 673, .distance = 28.796f}, {.id = 653, .distance = 31.301f}, {.id = 651, .distance = 32.492f}, {.id = 674, .distance = 39.130f}, {.id = 672, .distance = 39.658f}, {.id = 638, .distance = 50.236f}
-        }},
-        {653, {
-            {.id = 674, .distance = 30.076f}, {.id = 652, .distance = 31.301f}, {.id = 654, .distance = 33.324f}, {.id = 638, .distance = 33.378f}, {.id = 675, .distance = 33.386f}, {.id = 637, .distance = 37.853f}, {.id = 673, .distance = 46.778f}
-        }},
-        {654, {
-            {.id = 676, .distance = 29.653f}, {.id = 638, .distance = 30.978f}, {.id = 655, .distance = 32.852f}, {.id = 653, .distance = 33.324f}, {.id = 675, .distance = 35.446f}, {.id = 639, .distance = 42.934f}, {.id = 677, .distance = 44.581f}
-        }},
-        {655, {
-            {.id = 677, .distance = 28.776f}, {.id = 639, .distance = 29.314f}, {.id = 640, .distance = 32.088f}, {.id = 654, .distance = 32.852f}, {.id = 656, .distance = 36.954f}, {.id = 676, .distance = 42.498f}, {.id = 638, .distance = 47.075f}
-        }},
-        {656, {
-            {.id = 678, .distance = 23.617f}, {.id = 677, .distance = 31.442f}, {.id = 640, .distance = 31.964f}, {.id = 657, .distance = 32.703f}, {.id = 655, .distance = 36.954f}, {.id = 725, .distance = 41.259f}, {.id = 727, .distance = 45.103f}
-        }},
-        {657, {
-            {.id = 640, .distance = 31.937f}, {.id = 656, .distance = 32.703f}, {.id = 658, .distance = 32.725f}, {.id = 679, .distance = 36.068f}, {.id = 641, .distance = 37.491f}, {.id = 680, .distance = 39.068f}, {.id = 678, .distance = 41.895f}
-        }},
-        {658, {
-            {.id = 641, .distance = 29.419f}, {.id = 659, .distance = 30.638f}, {.id = 657, .distance = 32.725f}, {.id = 680, .distance = 35.794f}, {.id = 681, .distance = 36.665f}, {.id = 642, .distance = 44.568f}, {.id = 682, .distance = 46.412f}
-        }},
-        {659, {
-            {.id = 682, .distance = 24.191f}, {.id = 642, .distance = 29.848f}, {.id = 658, .distance = 30.638f}, {.id = 660, .distance = 31.516f}, {.id = 641, .distance = 41.947f}, {.id = 683, .distance = 44.167f}, {.id = 681, .distance = 44.460f}
-        }},
-        {660, {
-            {.id = 687, .distance = 27.519f}, {.id = 659, .distance = 31.516f}, {.id = 661, .distance = 33.096f}, {.id = 643, .distance = 33.457f}, {.id = 642, .distance = 35.426f}, {.id = 684, .distance = 35.506f}, {.id = 682, .distance = 36.051f}
-        }},
-        {661, {
-            {.id = 643, .distance = 30.775f}, {.id = 662, .distance = 30.943f}, {.id = 687, .distance = 31.347f}, {.id = 660, .distance = 33.096f}, {.id = 689, .distance = 37.393f}, {.id = 644, .distance = 38.606f}, {.id = 688, .distance = 45.102f}
-        }},
-        {662, {
-            {.id = 644, .distance = 28.126f}, {.id = 661, .distance = 30.943f}, {.id = 663, .distance = 32.322f}, {.id = 690, .distance = 33.115f}, {.id = 689, .distance = 43.474f}, {.id = 691, .distance = 44.048f}, {.id = 643, .distance = 47.195f}
-        }},
-        {663, {
-            {.id = 693, .distance = 30.540f}, {.id = 645, .distance = 30.745f}, {.id = 662, .distance = 32.322f}, {.id = 664, .distance = 32.441f}, {.id = 691, .distance = 37.153f}, {.id = 644, .distance = 40.686f}, {.id = 692, .distance = 45.279f}
-        }},
-        {664, {
-            {.id = 693, .distance = 27.373f}, {.id = 665, .distance = 31.563f}, {.id = 663, .distance = 32.441f}, {.id = 645, .distance = 33.990f}, {.id = 695, .distance = 35.618f}, {.id = 646, .distance = 35.628f}, {.id = 697, .distance = 36.566f}
-        }},
-        {665, {
-            {.id = 697, .distance = 24.293f}, {.id = 646, .distance = 30.088f}, {.id = 664, .distance = 31.563f}, {.id = 666, .distance = 31.793f}, {.id = 647, .distance = 42.067f}, {.id = 698, .distance = 43.775f}, {.id = 699, .distance = 43.787f}
-        }},
-        {666, {
-            {.id = 647, .distance = 28.726f}, {.id = 667, .distance = 31.427f}, {.id = 665, .distance = 31.793f}, {.id = 700, .distance = 35.922f}, {.id = 699, .distance = 37.333f}, {.id = 646, .distance = 44.864f}, {.id = 697, .distance = 47.704f}
-        }},
-        {667, {
-            {.id = 666, .distance = 31.427f}, {.id = 648, .distance = 31.889f}, {.id = 668, .distance = 32.342f}, {.id = 701, .distance = 35.562f}, {.id = 647, .distance = 37.444f}, {.id = 700, .distance = 39.243f}, {.id = 703, .distance = 41.982f}
-        }},
-        {668, {
-            {.id = 703, .distance = 23.803f}, {.id = 669, .distance = 31.693f}, {.id = 667, .distance = 32.342f}, {.id = 648, .distance = 32.458f}, {.id = 649, .distance = 36.707f}, {.id = 705, .distance = 41.333f}, {.id = 702, .distance = 44.974f}
-        }},
-        {669, {
-            {.id = 707, .distance = 24.410f}, {.id = 649, .distance = 28.557f}, {.id = 668, .distance = 31.693f}, {.id = 670, .distance = 32.138f}, {.id = 705, .distance = 38.124f}, {.id = 703, .distance = 43.096f}, {.id = 650, .distance = 45.069f}
-        }},
-        {670, {
-            {.id = 650, .distance = 29.283f}, {.id = 671, .distance = 31.589f}, {.id = 669, .distance = 32.138f}, {.id = 709, .distance = 36.174f}, {.id = 707, .distance = 36.927f}, {.id = 649, .distance = 42.276f}, {.id = 710, .distance = 43.787f}
-        }},
-        {671, {
-            {.id = 670, .distance = 31.589f}, {.id = 672, .distance = 32.185f}, {.id = 710, .distance = 33.528f}, {.id = 651, .distance = 33.774f}, {.id = 650, .distance = 35.383f}, {.id = 711, .distance = 39.292f}, {.id = 709, .distance = 48.151f}
-        }},
-        {672, {
-            {.id = 713, .distance = 26.800f}, {.id = 651, .distance = 30.492f}, {.id = 673, .distance = 31.085f}, {.id = 671, .distance = 32.185f}, {.id = 652, .distance = 39.658f}, {.id = 711, .distance = 40.843f}, {.id = 712, .distance = 44.297f}
-        }},
-        {673, {
-            {.id = 652, .distance = 28.796f}, {.id = 672, .distance = 31.085f}, {.id = 713, .distance = 31.165f}, {.id = 674, .distance = 31.748f}, {.id = 717, .distance = 32.025f}, {.id = 715, .distance = 35.484f}, {.id = 653, .distance = 46.778f}
-        }},
-        {674, {
-            {.id = 717, .distance = 26.974f}, {.id = 653, .distance = 30.076f}, {.id = 675, .distance = 31.574f}, {.id = 673, .distance = 31.748f}, {.id = 652, .distance = 39.130f}, {.id = 719, .distance = 40.759f}, {.id = 718, .distance = 44.255f}
-        }},
-        {675, {
-            {.id = 674, .distance = 31.574f}, {.id = 676, .distance = 32.495f}, {.id = 653, .distance = 33.386f}, {.id = 720, .distance = 34.006f}, {.id = 654, .distance = 35.446f}, {.id = 719, .distance = 40.058f}, {.id = 721, .distance = 48.765f}
-        }},
-        {676, {
-            {.id = 654, .distance = 29.653f}, {.id = 677, .distance = 31.761f}, {.id = 675, .distance = 32.495f}, {.id = 721, .distance = 35.652f}, {.id = 723, .distance = 35.973f}, {.id = 655, .distance = 42.498f}, {.id = 720, .distance = 43.930f}
-        }},
-        {677, {
-            {.id = 723, .distance = 24.656f}, {.id = 655, .distance = 28.776f}, {.id = 656, .distance = 31.442f}, {.id = 676, .distance = 31.761f}, {.id = 725, .distance = 38.273f}, {.id = 678, .distance = 43.129f}, {.id = 654, .distance = 44.581f}
-        }},
-        {678, {
-            {.id = 727, .distance = 22.863f}, {.id = 656, .distance = 23.617f}, {.id = 725, .distance = 27.856f}, {.id = 726, .distance = 35.561f}, {.id = 679, .distance = 37.917f}, {.id = 657, .distance = 41.895f}, {.id = 677, .distance = 43.129f}
-        }},
-        {679, {
-            {.id = 727, .distance = 28.096f}, {.id = 680, .distance = 29.153f}, {.id = 805, .distance = 29.303f}, {.id = 657, .distance = 36.068f}, {.id = 678, .distance = 37.917f}, {.id = 804, .distance = 40.708f}, {.id = 806, .distance = 41.405f}
-        }},
-        {680, {
-            {.id = 681, .distance = 28.265f}, {.id = 679, .distance = 29.153f}, {.id = 804, .distance = 29.697f}, {.id = 658, .distance = 35.794f}, {.id = 657, .distance = 39.068f}, {.id = 803, .distance = 40.854f}, {.id = 805, .distance = 41.887f}
-        }},
-        {681, {
-            {.id = 680, .distance = 28.265f}, {.id = 683, .distance = 28.989f}, {.id = 803, .distance = 29.349f}, {.id = 658, .distance = 36.665f}, {.id = 682, .distance = 38.712f}, {.id = 802, .distance = 40.741f}, {.id = 804, .distance = 41.218f}
-        }},
-        {682, {
-            {.id = 683, .distance = 23.607f}, {.id = 659, .distance = 24.191f}, {.id = 684, .distance = 27.455f}, {.id = 685, .distance = 35.536f}, {.id = 660, .distance = 36.051f}, {.id = 681, .distance = 38.712f}, {.id = 658, .distance = 46.412f}
-        }},
-        {683, {
-            {.id = 682, .distance = 23.607f}, {.id = 685, .distance = 28.500f}, {.id = 681, .distance = 28.989f}, {.id = 802, .distance = 29.313f}, {.id = 684, .distance = 38.998f}, {.id = 800, .distance = 40.245f}, {.id = 803, .distance = 41.506f}
-        }},
-        {684, {
-            {.id = 685, .distance = 25.823f}, {.id = 686, .distance = 26.007f}, {.id = 687, .distance = 27.304f}, {.id = 682, .distance = 27.455f}, {.id = 660, .distance = 35.506f}, {.id = 683, .distance = 38.998f}, {.id = 688, .distance = 39.242f}
-        }},
-        {685, {
-            {.id = 684, .distance = 25.823f}, {.id = 683, .distance = 28.500f}, {.id = 800, .distance = 29.551f}, {.id = 686, .distance = 30.900f}, {.id = 682, .distance = 35.536f}, {.id = 802, .distance = 41.458f}, {.id = 798, .distance = 51.969f}
-        }},
-        {686, {
-            {.id = 684, .distance = 26.007f}, {.id = 688, .distance = 29.614f}, {.id = 1205, .distance = 30.452f}, {.id = 685, .distance = 30.900f}, {.id = 687, .distance = 35.963f}, {.id = 1203, .distance = 41.143f}, {.id = 682, .distance = 52.371f}
-        }},
-        {687, {
-            {.id = 688, .distance = 23.404f}, {.id = 684, .distance = 27.304f}, {.id = 660, .distance = 27.519f}, {.id = 661, .distance = 31.347f}, {.id = 686, .distance = 35.963f}, {.id = 689, .distance = 38.924f}, {.id = 682, .distance = 47.034f}
-        }},
-        {688, {
-            {.id = 687, .distance = 23.404f}, {.id = 689, .distance = 28.584f}, {.id = 686, .distance = 29.614f}, {.id = 1203, .distance = 30.527f}, {.id = 684, .distance = 39.242f}, {.id = 1201, .distance = 40.848f}, {.id = 1205, .distance = 43.063f}
-        }},
-        {689, {
-            {.id = 690, .distance = 28.069f}, {.id = 688, .distance = 28.584f}, {.id = 1201, .distance = 30.240f}, {.id = 661, .distance = 37.393f}, {.id = 687, .distance = 38.924f}, {.id = 1200, .distance = 40.805f}, {.id = 1203, .distance = 42.836f}
-        }},
-        {690, {
-            {.id = 689, .distance = 28.069f}, {.id = 691, .distance = 28.840f}, {.id = 1200, .distance = 30.894f}, {.id = 662, .distance = 33.115f}, {.id = 1199, .distance = 41.340f}, {.id = 1201, .distance = 42.310f}, {.id = 661, .distance = 48.228f}
-        }},
-        {691, {
-            {.id = 690, .distance = 28.840f}, {.id = 692, .distance = 29.098f}, {.id = 1199, .distance = 30.415f}, {.id = 663, .distance = 37.153f}, {.id = 693, .distance = 38.371f}, {.id = 1247, .distance = 40.963f}, {.id = 1200, .distance = 43.032f}
-        }},
-        {692, {
-            {.id = 693, .distance = 23.468f}, {.id = 694, .distance = 28.067f}, {.id = 691, .distance = 29.098f}, {.id = 1247, .distance = 30.625f}, {.id = 695, .distance = 37.859f}, {.id = 1246, .distance = 41.283f}, {.id = 1199, .distance = 42.661f}
-        }},
-        {693, {
-            {.id = 692, .distance = 23.468f}, {.id = 695, .distance = 26.995f}, {.id = 664, .distance = 27.373f}, {.id = 663, .distance = 30.540f}, {.id = 694, .distance = 35.584f}, {.id = 691, .distance = 38.371f}, {.id = 697, .distance = 47.445f}
-        }},
-        {694, {
-            {.id = 695, .distance = 25.235f}, {.id = 692, .distance = 28.067f}, {.id = 1246, .distance = 30.660f}, {.id = 696, .distance = 31.314f}, {.id = 693, .distance = 35.584f}, {.id = 1247, .distance = 42.761f}, {.id = 1101, .distance = 51.969f}
-        }},
-        {695, {
-            {.id = 694, .distance = 25.235f}, {.id = 696, .distance = 25.959f}, {.id = 693, .distance = 26.995f}, {.id = 697, .distance = 28.280f}, {.id = 664, .distance = 35.618f}, {.id = 692, .distance = 37.859f}, {.id = 698, .distance = 39.348f}
-        }},
-        {696, {
-            {.id = 695, .distance = 25.959f}, {.id = 698, .distance = 28.175f}, {.id = 1101, .distance = 29.551f}, {.id = 694, .distance = 31.314f}, {.id = 697, .distance = 35.099f}, {.id = 1099, .distance = 40.245f}, {.id = 693, .distance = 52.245f}
-        }},
-        {697, {
-            {.id = 698, .distance = 22.858f}, {.id = 665, .distance = 24.293f}, {.id = 695, .distance = 28.280f}, {.id = 696, .distance = 35.099f}, {.id = 664, .distance = 36.566f}, {.id = 699, .distance = 37.718f}, {.id = 693, .distance = 47.445f}
-        }},
-        {698, {
-            {.id = 697, .distance = 22.858f}, {.id = 696, .distance = 28.175f}, {.id = 699, .distance = 28.665f}, {.id = 1099, .distance = 29.313f}, {.id = 695, .distance = 39.348f}, {.id = 1097, .distance = 40.741f}, {.id = 1101, .distance = 41.458f}
-        }},
-        {699, {
-            {.id = 698, .distance = 28.665f}, {.id = 700, .distance = 28.744f}, {.id = 1097, .distance = 29.349f}, {.id = 666, .distance = 37.333f}, {.id = 697, .distance = 37.718f}, {.id = 1096, .distance = 40.854f}, {.id = 1099, .distance = 41.506f}
-        }},
-        {700, {
-            {.id = 701, .distance = 28.665f}, {.id = 699, .distance = 28.744f}, {.id = 1096, .distance = 29.697f}, {.id = 666, .distance = 35.922f}, {.id = 667, .distance = 39.243f}, {.id = 1095, .distance = 40.708f}, {.id = 1097, .distance = 41.218f}
-        }},
-        {701, {
-            {.id = 700, .distance = 28.665f}, {.id = 702, .distance = 28.989f}, {.id = 1095, .distance = 29.303f}, {.id = 667, .distance = 35.562f}, {.id = 703, .distance = 37.946f}, {.id = 1143, .distance = 40.502f}, {.id = 1096, .distance = 41.887f}
-        }},
-        {702, {
-            {.id = 703, .distance = 22.522f}, {.id = 701, .distance = 28.989f}, {.id = 704, .distance = 28.989f}, {.id = 1143, .distance = 29.448f}, {.id = 705, .distance = 38.748f}, {.id = 1142, .distance = 40.870f}, {.id = 1095, .distance = 41.405f}
-        }},
-        {703, {
-            {.id = 702, .distance = 22.522f}, {.id = 668, .distance = 23.803f}, {.id = 705, .distance = 27.573f}, {.id = 704, .distance = 35.430f}, {.id = 701, .distance = 37.946f}, {.id = 667, .distance = 41.982f}, {.id = 669, .distance = 43.096f}
-        }},
-        {704, {
-            {.id = 705, .distance = 25.732f}, {.id = 702, .distance = 28.989f}, {.id = 1142, .distance = 29.475f}, {.id = 706, .distance = 30.699f}, {.id = 703, .distance = 35.430f}, {.id = 1143, .distance = 42.128f}, {.id = 496, .distance = 49.900f}
-        }},
-        {705, {
-            {.id = 706, .distance = 25.715f}, {.id = 704, .distance = 25.732f}, {.id = 707, .distance = 27.009f}, {.id = 703, .distance = 27.573f}, {.id = 669, .distance = 38.124f}, {.id = 702, .distance = 38.748f}, {.id = 708, .distance = 38.795f}
-        }},
-        {706, {
-            {.id = 705, .distance = 25.715f}, {.id = 496, .distance = 27.473f}, {.id = 708, .distance = 28.587f}, {.id = 704, .distance = 30.699f}, {.id = 707, .distance = 35.180f}, {.id = 494, .distance = 39.435f}, {.id = 498, .distance = 50.891f}
-        }},
-        {707, {
-            {.id = 708, .distance = 23.318f}, {.id = 669, .distance = 24.410f}, {.id = 705, .distance = 27.009f}, {.id = 706, .distance = 35.180f}, {.id = 670, .distance = 36.927f}, {.id = 709, .distance = 38.625f}, {.id = 703, .distance = 47.229f}
-        }},
-        {708, {
-            {.id = 707, .distance = 23.318f}, {.id = 494, .distance = 27.583f}, {.id = 706, .distance = 28.587f}, {.id = 709, .distance = 28.648f}, {.id = 705, .distance = 38.795f}, {.id = 493, .distance = 39.805f}, {.id = 496, .distance = 40.223f}
-        }},
-        {709, {
-            {.id = 493, .distance = 27.628f}, {.id = 708, .distance = 28.648f}, {.id = 710, .distance = 28.678f}, {.id = 670, .distance = 36.174f}, {.id = 707, .distance = 38.625f}, {.id = 492, .distance = 39.752f}, {.id = 494, .distance = 40.007f}
-        }},
-        {710, {
-            {.id = 492, .distance = 27.498f}, {.id = 711, .distance = 28.019f}, {.id = 709, .distance = 28.678f}, {.id = 671, .distance = 33.528f}, {.id = 493, .distance = 39.790f}, {.id = 491, .distance = 39.855f}, {.id = 670, .distance = 43.787f}
-        }},
-        {711, {
-            {.id = 491, .distance = 27.613f}, {.id = 710, .distance = 28.019f}, {.id = 712, .distance = 29.666f}, {.id = 713, .distance = 39.143f}, {.id = 492, .distance = 39.255f}, {.id = 671, .distance = 39.292f}, {.id = 490, .distance = 40.252f}
-        }},
-        {712, {
-            {.id = 713, .distance = 23.574f}, {.id = 490, .distance = 27.436f}, {.id = 714, .distance = 28.796f}, {.id = 711, .distance = 29.666f}, {.id = 715, .distance = 38.536f}, {.id = 488, .distance = 39.154f}, {.id = 491, .distance = 39.947f}
-        }},
-        {713, {
-            {.id = 712, .distance = 23.574f}, {.id = 672, .distance = 26.800f}, {.id = 715, .distance = 27.295f}, {.id = 673, .distance = 31.165f}, {.id = 714, .distance = 35.726f}, {.id = 711, .distance = 39.143f}, {.id = 717, .distance = 46.866f}
-        }},
-        {714, {
-            {.id = 715, .distance = 25.236f}, {.id = 488, .distance = 27.690f}, {.id = 712, .distance = 28.796f}, {.id = 716, .distance = 30.642f}, {.id = 713, .distance = 35.726f}, {.id = 490, .distance = 40.114f}, {.id = 486, .distance = 50.621f}
-        }},
-        {715, {
-            {.id = 714, .distance = 25.236f}, {.id = 716, .distance = 25.701f}, {.id = 713, .distance = 27.295f}, {.id = 717, .distance = 27.601f}, {.id = 673, .distance = 35.484f}, {.id = 712, .distance = 38.536f}, {.id = 718, .distance = 38.536f}
-        }},
-        {716, {
-            {.id = 715, .distance = 25.701f}, {.id = 718, .distance = 28.171f}, {.id = 610, .distance = 28.551f}, {.id = 714, .distance = 30.642f}, {.id = 717, .distance = 35.416f}, {.id = 608, .distance = 41.429f}, {.id = 612, .distance = 50.454f}
-        }},
-        {717, {
-            {.id = 718, .distance = 23.046f}, {.id = 674, .distance = 26.974f}, {.id = 715, .distance = 27.601f}, {.id = 673, .distance = 32.025f}, {.id = 716, .distance = 35.416f}, {.id = 719, .distance = 38.124f}, {.id = 713, .distance = 46.866f}
-        }},
-        {718, {
-            {.id = 717, .distance = 23.046f}, {.id = 716, .distance = 28.171f}, {.id = 608, .distance = 28.586f}, {.id = 719, .distance = 28.796f}, {.id = 715, .distance = 38.536f}, {.id = 610, .distance = 39.222f}, {.id = 607, .distance = 42.712f}
-        }},
-        {719, {
-            {.id = 607, .distance = 28.538f}, {.id = 720, .distance = 28.739f}, {.id = 718, .distance = 28.796f}, {.id = 717, .distance = 38.124f}, {.id = 608, .distance = 38.933f}, {.id = 675, .distance = 40.058f}, {.id = 674, .distance = 40.759f}
-        }},
-        {720, {
-            {.id = 606, .distance = 28.593f}, {.id = 719, .distance = 28.739f}, {.id = 721, .distance = 28.996f}, {.id = 675, .distance = 34.006f}, {.id = 607, .distance = 38.440f}, {.id = 605, .distance = 42.065f}, {.id = 676, .distance = 43.930f}
-        }},
-        {721, {
-            {.id = 722, .distance = 28.539f}, {.id = 605, .distance = 28.720f}, {.id = 720, .distance = 28.996f}, {.id = 676, .distance = 35.652f}, {.id = 723, .distance = 38.072f}, {.id = 606, .distance = 39.193f}, {.id = 604, .distance = 41.888f}
-        }},
-        {722, {
-            {.id = 723, .distance = 23.229f}, {.id = 604, .distance = 28.526f}, {.id = 721, .distance = 28.539f}, {.id = 724, .distance = 29.175f}, {.id = 725, .distance = 38.795f}, {.id = 605, .distance = 38.975f}, {.id = 602, .distance = 41.739f}
-        }},
-        {723, {
-            {.id = 722, .distance = 23.229f}, {.id = 677, .distance = 24.656f}, {.id = 725, .distance = 27.373f}, {.id = 676, .distance = 35.973f}, {.id = 724, .distance = 36.131f}, {.id = 721, .distance = 38.072f}, {.id = 678, .distance = 47.750f}
-        }},
-        {724, {
-            {.id = 725, .distance = 26.133f}, {.id = 602, .distance = 27.990f}, {.id = 722, .distance = 29.175f}, {.id = 726, .distance = 30.723f}, {.id = 723, .distance = 36.131f}, {.id = 604, .distance = 39.023f}, {.id = 600, .distance = 51.341f}
-        }},
-        {725, {
-            {.id = 726, .distance = 25.813f}, {.id = 724, .distance = 26.133f}, {.id = 723, .distance = 27.373f}, {.id = 678, .distance = 27.856f}, {.id = 677, .distance = 38.273f}, {.id = 722, .distance = 38.795f}, {.id = 727, .distance = 39.458f}
-        }},
-        {726, {
-            {.id = 725, .distance = 25.813f}, {.id = 808, .distance = 29.475f}, {.id = 727, .distance = 29.479f}, {.id = 724, .distance = 30.723f}, {.id = 678, .distance = 35.561f}, {.id = 806, .distance = 40.870f}, {.id = 602, .distance = 50.403f}
-        }},
-        {727, {
-            {.id = 678, .distance = 22.863f}, {.id = 679, .distance = 28.096f}, {.id = 806, .distance = 29.448f}, {.id = 726, .distance = 29.479f}, {.id = 725, .distance = 39.458f}, {.id = 805, .distance = 40.502f}, {.id = 808, .distance = 42.128f}
-        }},
-        {728, {
-            {.id = 729, .distance = 25.256f}, {.id = 731, .distance = 25.653f}, {.id = 730, .distance = 25.660f}, {.id = 733, .distance = 26.237f}, {.id = 732, .distance = 26.780f}, {.id = 735, .distance = 53.251f}, {.id = 739, .distance = 53.584f}
-        }},
-        {729, {
-            {.id = 728, .distance = 25.256f}, {.id = 735, .distance = 27.996f}, {.id = 733, .distance = 30.406f}, {.id = 730, .distance = 30.745f}, {.id = 736, .distance = 36.902f}, {.id = 734, .distance = 36.902f}, {.id = 731, .distance = 48.670f}
-        }},
-        {730, {
-            {.id = 728, .distance = 25.660f}, {.id = 737, .distance = 28.138f}, {.id = 731, .distance = 30.016f}, {.id = 729, .distance = 30.745f}, {.id = 738, .distance = 35.779f}, {.id = 736, .distance = 37.730f}, {.id = 732, .distance = 49.623f}
-        }},
-        {731, {
-            {.id = 728, .distance = 25.653f}, {.id = 739, .distance = 27.950f}, {.id = 730, .distance = 30.016f}, {.id = 732, .distance = 30.334f}, {.id = 740, .distance = 36.663f}, {.id = 738, .distance = 36.917f}, {.id = 729, .distance = 48.670f}
-        }},
-        {732, {
-            {.id = 728, .distance = 26.780f}, {.id = 741, .distance = 28.148f}, {.id = 731, .distance = 30.334f}, {.id = 733, .distance = 30.829f}, {.id = 740, .distance = 36.041f}, {.id = 742, .distance = 36.581f}, {.id = 729, .distance = 49.415f}
-        }},
-        {733, {
-            {.id = 728, .distance = 26.237f}, {.id = 743, .distance = 28.784f}, {.id = 729, .distance = 30.406f}, {.id = 732, .distance = 30.829f}, {.id = 734, .distance = 36.136f}, {.id = 742, .distance = 36.663f}, {.id = 731, .distance = 49.028f}
-        }},
-        {734, {
-            {.id = 745, .distance = 29.943f}, {.id = 743, .distance = 32.709f}, {.id = 735, .distance = 33.241f}, {.id = 744, .distance = 35.999f}, {.id = 733, .distance = 36.136f}, {.id = 729, .distance = 36.902f}, {.id = 746, .distance = 43.146f}
-        }},
-        {735, {
-            {.id = 729, .distance = 27.996f}, {.id = 746, .distance = 31.091f}, {.id = 734, .distance = 33.241f}, {.id = 736, .distance = 33.489f}, {.id = 747, .distance = 33.997f}, {.id = 745, .distance = 46.465f}, {.id = 748, .distance = 50.872f}
-        }},
-        {736, {
-            {.id = 748, .distance = 28.795f}, {.id = 735, .distance = 33.489f}, {.id = 737, .distance = 34.526f}, {.id = 729, .distance = 36.902f}, {.id = 730, .distance = 37.730f}, {.id = 747, .distance = 39.001f}, {.id = 749, .distance = 39.043f}
-        }},
-        {737, {
-            {.id = 730, .distance = 28.138f}, {.id = 750, .distance = 30.119f}, {.id = 738, .distance = 32.862f}, {.id = 749, .distance = 33.326f}, {.id = 736, .distance = 34.526f}, {.id = 751, .distance = 46.032f}, {.id = 748, .distance = 51.953f}
-        }},
-        {738, {
-            {.id = 751, .distance = 29.271f}, {.id = 737, .distance = 32.862f}, {.id = 739, .distance = 32.910f}, {.id = 752, .distance = 35.475f}, {.id = 730, .distance = 35.779f}, {.id = 731, .distance = 36.917f}, {.id = 750, .distance = 42.036f}
-        }},
-        {739, {
-            {.id = 731, .distance = 27.950f}, {.id = 753, .distance = 30.515f}, {.id = 738, .distance = 32.910f}, {.id = 740, .distance = 34.288f}, {.id = 752, .distance = 35.680f}, {.id = 754, .distance = 43.747f}, {.id = 730, .distance = 50.881f}
-        }},
-        {740, {
-            {.id = 754, .distance = 30.713f}, {.id = 755, .distance = 32.961f}, {.id = 739, .distance = 34.288f}, {.id = 741, .distance = 34.333f}, {.id = 732, .distance = 36.041f}, {.id = 731, .distance = 36.663f}, {.id = 753, .distance = 47.436f}
-        }},
-        {741, {
-            {.id = 732, .distance = 28.148f}, {.id = 756, .distance = 28.795f}, {.id = 742, .distance = 32.474f}, {.id = 740, .distance = 34.333f}, {.id = 757, .distance = 37.853f}, {.id = 755, .distance = 39.529f}, {.id = 733, .distance = 52.029f}
-        }},
-        {742, {
-            {.id = 758, .distance = 30.978f}, {.id = 741, .distance = 32.474f}, {.id = 757, .distance = 33.378f}, {.id = 743, .distance = 34.135f}, {.id = 732, .distance = 36.581f}, {.id = 733, .distance = 36.663f}, {.id = 759, .distance = 47.075f}
-        }},
-        {743, {
-            {.id = 733, .distance = 28.784f}, {.id = 759, .distance = 29.314f}, {.id = 734, .distance = 32.709f}, {.id = 742, .distance = 34.135f}, {.id = 744, .distance = 35.428f}, {.id = 758, .distance = 42.934f}, {.id = 729, .distance = 52.730f}
-        }},
-        {744, {
-            {.id = 761, .distance = 31.937f}, {.id = 760, .distance = 31.964f}, {.id = 759, .distance = 32.088f}, {.id = 745, .distance = 32.704f}, {.id = 743, .distance = 35.428f}, {.id = 734, .distance = 35.999f}, {.id = 781, .distance = 49.921f}
-        }},
-        {745, {
-            {.id = 762, .distance = 29.419f}, {.id = 734, .distance = 29.943f}, {.id = 746, .distance = 32.468f}, {.id = 744, .distance = 32.704f}, {.id = 761, .distance = 37.491f}, {.id = 763, .distance = 41.947f}, {.id = 735, .distance = 46.465f}
-        }},
-        {746, {
-            {.id = 763, .distance = 29.848f}, {.id = 735, .distance = 31.091f}, {.id = 747, .distance = 31.917f}, {.id = 745, .distance = 32.468f}, {.id = 764, .distance = 35.426f}, {.id = 734, .distance = 43.146f}, {.id = 762, .distance = 44.568f}
-        }},
-        {747, {
-            {.id = 765, .distance = 30.775f}, {.id = 746, .distance = 31.917f}, {.id = 748, .distance = 32.089f}, {.id = 764, .distance = 33.457f}, {.id = 735, .distance = 33.997f}, {.id = 736, .distance = 39.001f}, {.id = 766, .distance = 47.195f}
-        }},
-        {748, {
-            {.id = 766, .distance = 28.126f}, {.id = 736, .distance = 28.795f}, {.id = 747, .distance = 32.089f}, {.id = 749, .distance = 33.350f}, {.id = 765, .distance = 38.606f}, {.id = 767, .distance = 40.686f}, {.id = 735, .distance = 50.872f}
-        }},
-        {749, {
-            {.id = 767, .distance = 30.745f}, {.id = 750, .distance = 32.585f}, {.id = 737, .distance = 33.326f}, {.id = 748, .distance = 33.350f}, {.id = 768, .distance = 33.990f}, {.id = 736, .distance = 39.043f}, {.id = 766, .distance = 47.230f}
-        }},
-        {750, {
-            {.id = 769, .distance = 30.088f}, {.id = 737, .distance = 30.119f}, {.id = 751, .distance = 32.298f}, {.id = 749, .distance = 32.585f}, {.id = 768, .distance = 35.628f}, {.id = 738, .distance = 42.036f}, {.id = 770, .distance = 44.864f}
-        }},
-        {751, {
-            {.id = 770, .distance = 28.726f}, {.id = 738, .distance = 29.271f}, {.id = 752, .distance = 31.916f}, {.id = 750, .distance = 32.298f}, {.id = 771, .distance = 37.444f}, {.id = 769, .distance = 42.067f}, {.id = 737, .distance = 46.032f}
-        }},
-        {752, {
-            {.id = 771, .distance = 31.889f}, {.id = 751, .distance = 31.916f}, {.id = 772, .distance = 32.458f}, {.id = 753, .distance = 32.605f}, {.id = 738, .distance = 35.475f}, {.id = 739, .distance = 35.680f}, {.id = 770, .distance = 49.358f}
-        }},
-        {753, {
-            {.id = 773, .distance = 28.557f}, {.id = 739, .distance = 30.515f}, {.id = 752, .distance = 32.605f}, {.id = 754, .distance = 33.386f}, {.id = 772, .distance = 36.707f}, {.id = 774, .distance = 42.276f}, {.id = 740, .distance = 47.436f}
-        }},
-        {754, {
-            {.id = 774, .distance = 29.283f}, {.id = 740, .distance = 30.713f}, {.id = 755, .distance = 32.395f}, {.id = 753, .distance = 33.386f}, {.id = 775, .distance = 35.383f}, {.id = 739, .distance = 43.747f}, {.id = 773, .distance = 45.069f}
-        }},
-        {755, {
-            {.id = 776, .distance = 30.492f}, {.id = 754, .distance = 32.395f}, {.id = 756, .distance = 32.492f}, {.id = 740, .distance = 32.961f}, {.id = 775, .distance = 33.774f}, {.id = 741, .distance = 39.529f}, {.id = 777, .distance = 46.947f}
-        }},
-        {756, {
-            {.id = 741, .distance = 28.795f}, {.id = 777, .distance = 28.796f}, {.id = 757, .distance = 31.301f}, {.id = 755, .distance = 32.492f}, {.id = 778, .distance = 39.130f}, {.id = 776, .distance = 39.658f}, {.id = 742, .distance = 50.236f}
-        }},
-        {757, {
-            {.id = 778, .distance = 30.076f}, {.id = 756, .distance = 31.301f}, {.id = 758, .distance = 33.324f}, {.id = 742, .distance = 33.378f}, {.id = 779, .distance = 33.386f}, {.id = 741, .distance = 37.853f}, {.id = 777, .distance = 46.778f}
-        }},
-        {758, {
-            {.id = 780, .distance = 29.653f}, {.id = 742, .distance = 30.978f}, {.id = 759, .distance = 32.852f}, {.id = 757, .distance = 33.324f}, {.id = 779, .distance = 35.446f}, {.id = 743, .distance = 42.934f}, {.id = 781, .distance = 44.581f}
-        }},
-        {759, {
-            {.id = 781, .distance = 28.776f}, {.id = 743, .distance = 29.314f}, {.id = 744, .distance = 32.088f}, {.id = 758, .distance = 32.852f}, {.id = 760, .distance = 36.954f}, {.id = 780, .distance = 42.498f}, {.id = 742, .distance = 47.075f}
-        }},
-        {760, {
-            {.id = 782, .distance = 23.617f}, {.id = 781, .distance = 31.442f}, {.id = 744, .distance = 31.964f}, {.id = 761, .distance = 32.703f}, {.id = 759, .distance = 36.954f}, {.id = 829, .distance = 41.259f}, {.id = 831, .distance = 45.103f}
-        }},
-        {761, {
-            {.id = 744, .distance = 31.937f}, {.id = 760, .distance = 32.703f}, {.id = 762, .distance = 32.725f}, {.id = 783, .distance = 36.068f}, {.id = 745, .distance = 37.491f}, {.id = 784, .distance = 39.068f}, {.id = 782, .distance = 41.895f}
-        }},
-        {762, {
-            {.id = 745, .distance = 29.419f}, {.id = 763, .distance = 30.638f}, {.id = 761, .distance = 32.725f}, {.id = 784, .distance = 35.794f}, {.id = 785, .distance = 36.665f}, {.id = 746, .distance = 44.568f}, {.id = 786, .distance = 46.412f}
-        }},
-        {763, {
-            {.id = 786, .distance = 24.191f}, {.id = 746, .distance = 29.848f}, {.id = 762, .distance = 30.638f}, {.id = 764, .distance = 31.516f}, {.id = 745, .distance = 41.947f}, {.id = 787, .distance = 44.167f}, {.id = 785, .distance = 44.460f}
-        }},
-        {764, {
-            {.id = 791, .distance = 27.519f}, {.id = 763, .distance = 31.516f}, {.id = 765, .distance = 33.096f}, {.id = 747, .distance = 33.457f}, {.id = 746, .distance = 35.426f}, {.id = 788, .distance = 35.506f}, {.id = 786, .distance = 36.051f}
-        }},
-        {765, {
-            {.id = 747, .distance = 30.775f}, {.id = 766, .distance = 30.943f}, {.id = 791, .distance = 31.347f}, {.id = 764, .distance = 33.096f}, {.id = 793, .distance = 37.393f}, {.id = 748, .distance = 38.606f}, {.id = 792, .distance = 45.102f}
-        }},
-        {766, {
-            {.id = 748, .distance = 28.126f}, {.id = 765, .distance = 30.943f}, {.id = 767, .distance = 32.322f}, {.id = 794, .distance = 33.115f}, {.id = 793, .distance = 43.474f}, {.id = 795, .distance = 44.048f}, {.id = 747, .distance = 47.195f}
-        }},
-        {767, {
-            {.id = 797, .distance = 30.540f}, {.id = 749, .distance = 30.745f}, {.id = 766, .distance = 32.322f}, {.id = 768, .distance = 32.441f}, {.id = 795, .distance = 37.153f}, {.id = 748, .distance = 40.686f}, {.id = 796, .distance = 45.279f}
-        }},
-        {768, {
-            {.id = 797, .distance = 27.373f}, {.id = 769, .distance = 31.563f}, {.id = 767, .distance = 32.441f}, {.id = 749, .distance = 33.990f}, {.id = 799, .distance = 35.618f}, {.id = 750, .distance = 35.628f}, {.id = 801, .distance = 36.566f}
-        }},
-        {769, {
-            {.id = 801, .distance = 24.293f}, {.id = 750, .distance = 30.088f}, {.id = 768, .distance = 31.563f}, {.id = 770, .distance = 31.793f}, {.id = 751, .distance = 42.067f}, {.id = 802, .distance = 43.775f}, {.id = 803, .distance = 43.787f}
-        }},
-        {770, {
-            {.id = 751, .distance = 28.726f}, {.id = 771, .distance = 31.427f}, {.id = 769, .distance = 31.793f}, {.id = 804, .distance = 35.922f}, {.id = 803, .distance = 37.333f}, {.id = 750, .distance = 44.864f}, {.id = 801, .distance = 47.704f}
-        }},
-        {771, {
-            {.id = 770, .distance = 31.427f}, {.id = 752, .distance = 31.889f}, {.id = 772, .distance = 32.342f}, {.id = 805, .distance = 35.562f}, {.id = 751, .distance = 37.444f}, {.id = 804, .distance = 39.243f}, {.id = 807, .distance = 41.982f}
-        }},
-        {772, {
-            {.id = 807, .distance = 23.803f}, {.id = 773, .distance = 31.693f}, {.id = 771, .distance = 32.342f}, {.id = 752, .distance = 32.458f}, {.id = 753, .distance = 36.707f}, {.id = 809, .distance = 41.333f}, {.id = 806, .distance = 44.974f}
-        }},
-        {773, {
-            {.id = 811, .distance = 24.410f}, {.id = 753, .distance = 28.557f}, {.id = 772, .distance = 31.693f}, {.id = 774, .distance = 32.138f}, {.id = 809, .distance = 38.124f}, {.id = 807, .distance = 43.096f}, {.id = 754, .distance = 45.069f}
-        }},
-        {774, {
-            {.id = 754, .distance = 29.283f}, {.id = 775, .distance = 31.589f}, {.id = 773, .distance = 32.138f}, {.id = 813, .distance = 36.174f}, {.id = 811, .distance = 36.927f}, {.id = 753, .distance = 42.276f}, {.id = 814, .distance = 43.787f}
-        }},
-        {775, {
-            {.id = 774, .distance = 31.589f}, {.id = 776, .distance = 32.185f}, {.id = 814, .distance = 33.528f}, {.id = 755, .distance = 33.774f}, {.id = 754, .distance = 35.383f}, {.id = 815, .distance = 39.292f}, {.id = 813, .distance = 48.151f}
-        }},
-        {776, {
-            {.id = 817, .distance = 26.800f}, {.id = 755, .distance = 30.492f}, {.id = 777, .distance = 31.085f}, {.id = 775, .distance = 32.185f}, {.id = 756, .distance = 39.658f}, {.id = 815, .distance = 40.843f}, {.id = 816, .distance = 44.297f}
-        }},
-        {777, {
-            {.id = 756, .distance = 28.796f}, {.id = 776, .distance = 31.085f}, {.id = 817, .distance = 31.165f}, {.id = 778, .distance = 31.748f}, {.id = 821, .distance = 32.025f}, {.id = 819, .distance = 35.484f}, {.id = 757, .distance = 46.778f}
-        }},
-        {778, {
-            {.id = 821, .distance = 26.974f}, {.id = 757, .distance = 30.076f}, {.id = 779, .distance = 31.574f}, {.id = 777, .distance = 31.748f}, {.id = 756, .distance = 39.130f}, {.id = 823, .distance = 40.759f}, {.id = 822, .distance = 44.255f}
-        }},
-        {779, {
-            {.id = 778, .distance = 31.574f}, {.id = 780, .distance = 32.495f}, {.id = 757, .distance = 33.386f}, {.id = 824, .distance = 34.006f}, {.id = 758, .distance = 35.446f}, {.id = 823, .distance = 40.058f}, {.id = 825, .distance = 48.765f}
-        }},
-        {780, {
-            {.id = 758, .distance = 29.653f}, {.id = 781, .distance = 31.761f}, {.id = 779, .distance = 32.495f}, {.id = 825, .distance = 35.652f}, {.id = 827, .distance = 35.973f}, {.id = 759, .distance = 42.498f}, {.id = 824, .distance = 43.930f}
-        }},
-        {781, {
-            {.id = 827, .distance = 24.656f}, {.id = 759, .distance = 28.776f}, {.id = 760, .distance = 31.442f}, {.id = 780, .distance = 31.761f}, {.id = 829, .distance = 38.273f}, {.id = 782, .distance = 43.129f}, {.id = 758, .distance = 44.581f}
-        }},
-        {782, {
-            {.id = 831, .distance = 22.863f}, {.id = 760, .distance = 23.617f}, {.id = 829, .distance = 27.856f}, {.id = 830, .distance = 35.561f}, {.id = 783, .distance = 37.917f}, {.id = 761, .distance = 41.895f}, {.id = 781, .distance = 43.129f}
-        }},
-        {783, {
-            {.id = 831, .distance = 28.096f}, {.id = 784, .distance = 29.153f}, {.id = 909, .distance = 29.303f}, {.id = 761, .distance = 36.068f}, {.id = 782, .distance = 37.917f}, {.id = 908, .distance = 40.708f}, {.id = 910, .distance = 41.405f}
-        }},
-        {784, {
-            {.id = 785, .distance = 28.265f}, {.id = 783, .distance = 29.153f}, {.id = 908, .distance = 29.697f}, {.id = 762, .distance = 35.794f}, {.id = 761, .distance = 39.068f}, {.id = 907, .distance = 40.854f}, {.id = 909, .distance = 41.887f}
-        }},
-        {785, {
-            {.id = 784, .distance = 28.265f}, {.id = 787, .distance = 28.989f}, {.id = 907, .distance = 29.349f}, {.id = 762, .distance = 36.665f}, {.id = 786, .distance = 38.712f}, {.id = 906, .distance = 40.741f}, {.id = 908, .distance = 41.218f}
-        }},
-        {786, {
-            {.id = 787, .distance = 23.607f}, {.id = 763, .distance = 24.191f}, {.id = 788, .distance = 27.455f}, {.id = 789, .distance = 35.536f}, {.id = 764, .distance = 36.051f}, {.id = 785, .distance = 38.712f}, {.id = 762, .distance = 46.412f}
-        }},
-        {787, {
-            {.id = 786, .distance = 23.607f}, {.id = 789, .distance = 28.500f}, {.id = 785, .distance = 28.989f}, {.id = 906, .distance = 29.313f}, {.id = 788, .distance = 38.998f}, {.id = 904, .distance = 40.245f}, {.id = 907, .distance = 41.506f}
-        }},
-        {788, {
-            {.id = 789, .distance = 25.823f}, {.id = 790, .distance = 26.007f}, {.id = 791, .distance = 27.304f}, {.id = 786, .distance = 27.455f}, {.id = 764, .distance = 35.506f}, {.id = 787, .distance = 38.998f}, {.id = 792, .distance = 39.242f}
-        }},
-        {789, {
-            {.id = 788, .distance = 25.823f}, {.id = 787, .distance = 28.500f}, {.id = 904, .distance = 29.551f}, {.id = 790, .distance = 30.900f}, {.id = 786, .distance = 35.536f}, {.id = 906, .distance = 41.458f}, {.id = 1214, .distance = 51.891f}
-        }},
-        {790, {
-            {.id = 788, .distance = 26.007f}, {.id = 792, .distance = 29.614f}, {.id = 1214, .distance = 29.836f}, {.id = 789, .distance = 30.900f}, {.id = 791, .distance = 35.963f}, {.id = 1212, .distance = 39.709f}, {.id = 786, .distance = 52.371f}
-        }},
-        {791, {
-            {.id = 792, .distance = 23.404f}, {.id = 788, .distance = 27.304f}, {.id = 764, .distance = 27.519f}, {.id = 765, .distance = 31.347f}, {.id = 790, .distance = 35.963f}, {.id = 793, .distance = 38.924f}, {.id = 786, .distance = 47.034f}
-        }},
-        {792, {
-            {.id = 791, .distance = 23.404f}, {.id = 793, .distance = 28.584f}, {.id = 790, .distance = 29.614f}, {.id = 1212, .distance = 30.187f}, {.id = 788, .distance = 39.242f}, {.id = 1211, .distance = 39.536f}, {.id = 1214, .distance = 43.439f}
-        }},
-        {793, {
-            {.id = 794, .distance = 28.069f}, {.id = 792, .distance = 28.584f}, {.id = 1211, .distance = 29.916f}, {.id = 765, .distance = 37.393f}, {.id = 791, .distance = 38.924f}, {.id = 1210, .distance = 39.539f}, {.id = 766, .distance = 43.474f}
-        }},
-        {794, {
-            {.id = 793, .distance = 28.069f}, {.id = 795, .distance = 28.840f}, {.id = 1210, .distance = 30.071f}, {.id = 766, .distance = 33.115f}, {.id = 1209, .distance = 39.539f}, {.id = 1211, .distance = 43.068f}, {.id = 765, .distance = 48.228f}
-        }},
-        {795, {
-            {.id = 794, .distance = 28.840f}, {.id = 796, .distance = 29.098f}, {.id = 1209, .distance = 29.916f}, {.id = 767, .distance = 37.153f}, {.id = 797, .distance = 38.371f}, {.id = 1208, .distance = 39.536f}, {.id = 1210, .distance = 43.068f}
-        }},
-        {796, {
-            {.id = 797, .distance = 23.468f}, {.id = 798, .distance = 28.067f}, {.id = 795, .distance = 29.098f}, {.id = 1208, .distance = 30.187f}, {.id = 799, .distance = 37.859f}, {.id = 1206, .distance = 39.709f}, {.id = 1209, .distance = 43.663f}
-        }},
-        {797, {
-            {.id = 796, .distance = 23.468f}, {.id = 799, .distance = 26.995f}, {.id = 768, .distance = 27.373f}, {.id = 767, .distance = 30.540f}, {.id = 798, .distance = 35.584f}, {.id = 795, .distance = 38.371f}, {.id = 801, .distance = 47.445f}
-        }},
-        {798, {
-            {.id = 799, .distance = 25.235f}, {.id = 796, .distance = 28.067f}, {.id = 1206, .distance = 29.836f}, {.id = 800, .distance = 31.314f}, {.id = 797, .distance = 35.584f}, {.id = 1208, .distance = 43.439f}, {.id = 1205, .distance = 51.891f}
-        }},
-        {799, {
-            {.id = 798, .distance = 25.235f}, {.id = 800, .distance = 25.959f}, {.id = 797, .distance = 26.995f}, {.id = 801, .distance = 28.280f}, {.id = 768, .distance = 35.618f}, {.id = 796, .distance = 37.859f}, {.id = 802, .distance = 39.348f}
-        }},
-        {800, {
-            {.id = 799, .distance = 25.959f}, {.id = 802, .distance = 28.175f}, {.id = 685, .distance = 29.551f}, {.id = 798, .distance = 31.314f}, {.id = 801, .distance = 35.099f}, {.id = 683, .distance = 40.245f}, {.id = 797, .distance = 52.245f}
-        }},
-        {801, {
-            {.id = 802, .distance = 22.858f}, {.id = 769, .distance = 24.293f}, {.id = 799, .distance = 28.280f}, {.id = 800, .distance = 35.099f}, {.id = 768, .distance = 36.566f}, {.id = 803, .distance = 37.718f}, {.id = 797, .distance = 47.445f}
-        }},
-        {802, {
-            {.id = 801, .distance = 22.858f}, {.id = 800, .distance = 28.175f}, {.id = 803, .distance = 28.665f}, {.id = 683, .distance = 29.313f}, {.id = 799, .distance = 39.348f}, {.id = 681, .distance = 40.741f}, {.id = 685, .distance = 41.458f}
-        }},
-        {803, {
-            {.id = 802, .distance = 28.665f}, {.id = 804, .distance = 28.744f}, {.id = 681, .distance = 29.349f}, {.id = 770, .distance = 37.333f}, {.id = 801, .distance = 37.718f}, {.id = 680, .distance = 40.854f}, {.id = 683, .distance = 41.506f}
-        }},
-        {804, {
-            {.id = 805, .distance = 28.665f}, {.id = 803, .distance = 28.744f}, {.id = 680, .distance = 29.697f}, {.id = 770, .distance = 35.922f}, {.id = 771, .distance = 39.243f}, {.id = 679, .distance = 40.708f}, {.id = 681, .distance = 41.218f}
-        }},
-        {805, {
-            {.id = 804, .distance = 28.665f}, {.id = 806, .distance = 28.989f}, {.id = 679, .distance = 29.303f}, {.id = 771, .distance = 35.562f}, {.id = 807, .distance = 37.946f}, {.id = 727, .distance = 40.502f}, {.id = 680, .distance = 41.887f}
-        }},
-        {806, {
-            {.id = 807, .distance = 22.522f}, {.id = 805, .distance = 28.989f}, {.id = 808, .distance = 28.989f}, {.id = 727, .distance = 29.448f}, {.id = 809, .distance = 38.748f}, {.id = 726, .distance = 40.870f}, {.id = 679, .distance = 41.405f}
-        }},
-        {807, {
-            {.id = 806, .distance = 22.522f}, {.id = 772, .distance = 23.803f}, {.id = 809, .distance = 27.573f}, {.id = 808, .distance = 35.430f}, {.id = 805, .distance = 37.946f}, {.id = 771, .distance = 41.982f}, {.id = 773, .distance = 43.096f}
-        }},
-        {808, {
-            {.id = 809, .distance = 25.732f}, {.id = 806, .distance = 28.989f}, {.id = 726, .distance = 29.475f}, {.id = 810, .distance = 30.699f}, {.id = 807, .distance = 35.430f}, {.id = 727, .distance = 42.128f}, {.id = 600, .distance = 49.900f}
-        }},
-        {809, {
-            {.id = 810, .distance = 25.715f}, {.id = 808, .distance = 25.732f}, {.id = 811, .distance = 27.009f}, {.id = 807, .distance = 27.573f}, {.id = 773, .distance = 38.124f}, {.id = 806, .distance = 38.748f}, {.id = 812, .distance = 38.795f}
-        }},
-        {810, {
-            {.id = 809, .distance = 25.715f}, {.id = 600, .distance = 27.473f}, {.id = 812, .distance = 28.587f}, {.id = 808, .distance = 30.699f}, {.id = 811, .distance = 35.180f}, {.id = 598, .distance = 39.435f}, {.id = 602, .distance = 50.891f}
-        }},
-        {811, {
-            {.id = 812, .distance = 23.318f}, {.id = 773, .distance = 24.410f}, {.id = 809, .distance = 27.009f}, {.id = 810, .distance = 35.180f}, {.id = 774, .distance = 36.927f}, {.id = 813, .distance = 38.625f}, {.id = 807, .distance = 47.229f}
-        }},
-        {812, {
-            {.id = 811, .distance = 23.318f}, {.id = 598, .distance = 27.583f}, {.id = 810, .distance = 28.587f}, {.id = 813, .distance = 28.648f}, {.id = 809, .distance = 38.795f}, {.id = 597, .distance = 39.805f}, {.id = 600, .distance = 40.223f}
-        }},
-        {813, {
-            {.id = 597, .distance = 27.628f}, {.id = 812, .distance = 28.648f}, {.id = 814, .distance = 28.678f}, {.id = 774, .distance = 36.174f}, {.id = 811, .distance = 38.625f}, {.id = 596, .distance = 39.752f}, {.id = 598, .distance = 40.007f}
-        }},
-        {814, {
-            {.id = 596, .distance = 27.498f}, {.id = 815, .distance = 28.019f}, {.id = 813, .distance = 28.678f}, {.id = 775, .distance = 33.528f}, {.id = 597, .distance = 39.790f}, {.id = 595, .distance = 39.855f}, {.id = 774, .distance = 43.787f}
-        }},
-        {815, {
-            {.id = 595, .distance = 27.613f}, {.id = 814, .distance = 28.019f}, {.id = 816, .distance = 29.666f}, {.id = 817, .distance = 39.143f}, {.id = 596, .distance = 39.255f}, {.id = 775, .distance = 39.292f}, {.id = 594, .distance = 40.252f}
-        }},
-        {816, {
-            {.id = 817, .distance = 23.574f}, {.id = 594, .distance = 27.436f}, {.id = 818, .distance = 28.796f}, {.id = 815, .distance = 29.666f}, {.id = 819, .distance = 38.536f}, {.id = 592, .distance = 39.154f}, {.id = 595, .distance = 39.947f}
-        }},
-        {817, {
-            {.id = 816, .distance = 23.574f}, {.id = 776, .distance = 26.800f}, {.id = 819, .distance = 27.295f}, {.id = 777, .distance = 31.165f}, {.id = 818, .distance = 35.726f}, {.id = 815, .distance = 39.143f}, {.id = 821, .distance = 46.866f}
-        }},
-        {818, {
-            {.id = 819, .distance = 25.236f}, {.id = 592, .distance = 27.690f}, {.id = 816, .distance = 28.796f}, {.id = 820, .distance = 30.642f}, {.id = 817, .distance = 35.726f}, {.id = 594, .distance = 40.114f}, {.id = 590, .distance = 50.621f}
-        }},
-        {819, {
-            {.id = 818, .distance = 25.236f}, {.id = 820, .distance = 25.701f}, {.id = 817, .distance = 27.295f}, {.id = 821, .distance = 27.601f}, {.id = 777, .distance = 35.484f}, {.id = 822, .distance = 38.536f}, {.id = 816, .distance = 38.536f}
-        }},
-        {820, {
-            {.id = 819, .distance = 25.701f}, {.id = 822, .distance = 28.171f}, {.id = 184, .distance = 28.509f}, {.id = 818, .distance = 30.642f}, {.id = 821, .distance = 35.416f}, {.id = 182, .distance = 40.640f}, {.id = 592, .distance = 50.968f}
-        }},
-        {821, {
-            {.id = 822, .distance = 23.046f}, {.id = 778, .distance = 26.974f}, {.id = 819, .distance = 27.601f}, {.id = 777, .distance = 32.025f}, {.id = 820, .distance = 35.416f}, {.id = 823, .distance = 38.124f}, {.id = 817, .distance = 46.866f}
-        }},
-        {822, {
-            {.id = 821, .distance = 23.046f}, {.id = 820, .distance = 28.171f}, {.id = 182, .distance = 28.758f}, {.id = 823, .distance = 28.796f}, {.id = 819, .distance = 38.536f}, {.id = 184, .distance = 40.267f}, {.id = 181, .distance = 41.392f}
-        }},
-        {823, {
-            {.id = 181, .distance = 28.612f}, {.id = 824, .distance = 28.739f}, {.id = 822, .distance = 28.796f}, {.id = 821, .distance = 38.124f}, {.id = 182, .distance = 40.023f}, {.id = 779, .distance = 40.058f}, {.id = 778, .distance = 40.759f}
-        }},
-        {824, {
-            {.id = 180, .distance = 28.628f}, {.id = 823, .distance = 28.739f}, {.id = 825, .distance = 28.996f}, {.id = 779, .distance = 34.006f}, {.id = 181, .distance = 39.961f}, {.id = 179, .distance = 41.256f}, {.id = 780, .distance = 43.930f}
-        }},
-        {825, {
-            {.id = 826, .distance = 28.539f}, {.id = 179, .distance = 28.849f}, {.id = 824, .distance = 28.996f}, {.id = 780, .distance = 35.652f}, {.id = 827, .distance = 38.072f}, {.id = 180, .distance = 40.208f}, {.id = 178, .distance = 41.035f}
-        }},
-        {826, {
-            {.id = 827, .distance = 23.229f}, {.id = 825, .distance = 28.539f}, {.id = 178, .distance = 28.558f}, {.id = 828, .distance = 29.175f}, {.id = 829, .distance = 38.795f}, {.id = 179, .distance = 40.001f}, {.id = 176, .distance = 40.663f}
-        }},
-        {827, {
-            {.id = 826, .distance = 23.229f}, {.id = 781, .distance = 24.656f}, {.id = 829, .distance = 27.373f}, {.id = 780, .distance = 35.973f}, {.id = 828, .distance = 36.131f}, {.id = 825, .distance = 38.072f}, {.id = 782, .distance = 47.750f}
-        }},
-        {828, {
-            {.id = 829, .distance = 26.133f}, {.id = 176, .distance = 28.160f}, {.id = 826, .distance = 29.175f}, {.id = 830, .distance = 30.723f}, {.id = 827, .distance = 36.131f}, {.id = 178, .distance = 39.985f}, {.id = 174, .distance = 51.290f}
-        }},
-        {829, {
-            {.id = 830, .distance = 25.813f}, {.id = 828, .distance = 26.133f}, {.id = 827, .distance = 27.373f}, {.id = 782, .distance = 27.856f}, {.id = 781, .distance = 38.273f}, {.id = 826, .distance = 38.795f}, {.id = 831, .distance = 39.458f}
-        }},
-        {830, {
-            {.id = 829, .distance = 25.813f}, {.id = 912, .distance = 29.475f}, {.id = 831, .distance = 29.479f}, {.id = 828, .distance = 30.723f}, {.id = 782, .distance = 35.561f}, {.id = 910, .distance = 40.870f}, {.id = 176, .distance = 51.351f}
-        }},
-        {831, {
-            {.id = 782, .distance = 22.863f}, {.id = 783, .distance = 28.096f}, {.id = 910, .distance = 29.448f}, {.id = 830, .distance = 29.479f}, {.id = 829, .distance = 39.458f}, {.id = 909, .distance = 40.502f}, {.id = 912, .distance = 42.128f}
-        }},
-        {832, {
-            {.id = 833, .distance = 25.256f}, {.id = 835, .distance = 25.653f}, {.id = 834, .distance = 25.660f}, {.id = 837, .distance = 26.237f}, {.id = 836, .distance = 26.780f}, {.id = 839, .distance = 53.251f}, {.id = 843, .distance = 53.584f}
-        }},
-        {833, {
-            {.id = 832, .distance = 25.256f}, {.id = 839, .distance = 27.996f}, {.id = 837, .distance = 30.406f}, {.id = 834, .distance = 30.746f}, {.id = 840, .distance = 36.902f}, {.id = 838, .distance = 36.902f}, {.id = 835, .distance = 48.670f}
-        }},
-        {834, {
-            {.id = 832, .distance = 25.660f}, {.id = 841, .distance = 28.138f}, {.id = 835, .distance = 30.016f}, {.id = 833, .distance = 30.746f}, {.id = 842, .distance = 35.779f}, {.id = 840, .distance = 37.730f}, {.id = 836, .distance = 49.623f}
-        }},
-        {835, {
-            {.id = 832, .distance = 25.653f}, {.id = 843, .distance = 27.950f}, {.id = 834, .distance = 30.016f}, {.id = 836, .distance = 30.334f}, {.id = 844, .distance = 36.663f}, {.id = 842, .distance = 36.917f}, {.id = 833, .distance = 48.670f}
-        }},
-        {836, {
-            {.id = 832, .distance = 26.780f}, {.id = 845, .distance = 28.148f}, {.id = 835, .distance = 30.334f}, {.id = 837, .distance = 30.829f}, {.id = 844, .distance = 36.041f}, {.id = 846, .distance = 36.581f}, {.id = 833, .distance = 49.415f}
-        }},
-        {837, {
-            {.id = 832, .distance = 26.237f}, {.id = 847, .distance = 28.784f}, {.id = 833, .distance = 30.406f}, {.id = 836, .distance = 30.829f}, {.id = 838, .distance = 36.136f}, {.id = 846, .distance = 36.663f}, {.id = 835, .distance = 49.028f}
-        }},
-        {838, {
-            {.id = 849, .distance = 29.943f}, {.id = 847, .distance = 32.709f}, {.id = 839, .distance = 33.241f}, {.id = 848, .distance = 35.999f}, {.id = 837, .distance = 36.136f}, {.id = 833, .distance = 36.902f}, {.id = 850, .distance = 43.146f}
-        }},
-        {839, {
-            {.id = 833, .distance = 27.996f}, {.id = 850, .distance = 31.091f}, {.id = 838, .distance = 33.241f}, {.id = 840, .distance = 33.489f}, {.id = 851, .distance = 33.997f}, {.id = 849, .distance = 46.465f}, {.id = 852, .distance = 50.872f}
-        }},
-        {840, {
-            {.id = 852, .distance = 28.795f}, {.id = 839, .distance = 33.489f}, {.id = 841, .distance = 34.526f}, {.id = 833, .distance = 36.902f}, {.id = 834, .distance = 37.730f}, {.id = 851, .distance = 39.001f}, {.id = 853, .distance = 39.043f}
-        }},
-        {841, {
-            {.id = 834, .distance = 28.138f}, {.id = 854, .distance = 30.119f}, {.id = 842, .distance = 32.862f}, {.id = 853, .distance = 33.326f}, {.id = 840, .distance = 34.526f}, {.id = 855, .distance = 46.032f}, {.id = 852, .distance = 51.953f}
-        }},
-        {842, {
-            {.id = 855, .distance = 29.271f}, {.id = 841, .distance = 32.862f}, {.id = 843, .distance = 32.910f}, {.id = 856, .distance = 35.475f}, {.id = 834, .distance = 35.779f}, {.id = 835, .distance = 36.917f}, {.id = 854, .distance = 42.036f}
-        }},
-        {843, {
-            {.id = 835, .distance = 27.950f}, {.id = 857, .distance = 30.515f}, {.id = 842, .distance = 32.910f}, {.id = 844, .distance = 34.288f}, {.id = 856, .distance = 35.680f}, {.id = 858, .distance = 43.747f}, {.id = 834, .distance = 50.881f}
-        }},
-        {844, {
-            {.id = 858, .distance = 30.713f}, {.id = 859, .distance = 32.961f}, {.id = 843, .distance = 34.288f}, {.id = 845, .distance = 34.333f}, {.id = 836, .distance = 36.041f}, {.id = 835, .distance = 36.663f}, {.id = 857, .distance = 47.436f}
-        }},
-        {845, {
-            {.id = 836, .distance = 28.148f}, {.id = 860, .distance = 28.795f}, {.id = 846, .distance = 32.474f}, {.id = 844, .distance = 34.333f}, {.id = 861, .distance = 37.853f}, {.id = 859, .distance = 39.529f}, {.id = 837, .distance = 52.029f}
-        }},
-        {846, {
-            {.id = 862, .distance = 30.978f}, {.id = 845, .distance = 32.474f}, {.id = 861, .distance = 33.378f}, {.id = 847, .distance = 34.135f}, {.id = 836, .distance = 36.581f}, {.id = 837, .distance = 36.663f}, {.id = 863, .distance = 47.075f}
-        }},
-        {847, {
-            {.id = 837, .distance = 28.784f}, {.id = 863, .distance = 29.314f}, {.id = 838, .distance = 32.709f}, {.id = 846, .distance = 34.135f}, {.id = 848, .distance = 35.428f}, {.id = 862, .distance = 42.934f}, {.id = 833, .distance = 52.730f}
-        }},
-        {848, {
-            {.id = 865, .distance = 31.937f}, {.id = 864, .distance = 31.964f}, {.id = 863, .distance = 32.088f}, {.id = 849, .distance = 32.704f}, {.id = 847, .distance = 35.428f}, {.id = 838, .distance = 35.999f}, {.id = 885, .distance = 49.921f}
-        }},
-        {849, {
-            {.id = 866, .distance = 29.419f}, {.id = 838, .distance = 29.943f}, {.id = 850, .distance = 32.468f}, {.id = 848, .distance = 32.704f}, {.id = 865, .distance = 37.491f}, {.id = 867, .distance = 41.947f}, {.id = 839, .distance = 46.465f}
-        }},
-        {850, {
-            {.id = 867, .distance = 29.848f}, {.id = 839, .distance = 31.091f}, {.id = 851, .distance = 31.917f}, {.id = 849, .distance = 32.468f}, {.id = 868, .distance = 35.426f}, {.id = 838, .distance = 43.146f}, {.id = 866, .distance = 44.568f}
-        }},
-        {851, {
-            {.id = 869, .distance = 30.775f}, {.id = 850, .distance = 31.917f}, {.id = 852, .distance = 32.089f}, {.id = 868, .distance = 33.457f}, {.id = 839, .distance = 33.997f}, {.id = 840, .distance = 39.001f}, {.id = 870, .distance = 47.195f}
-        }},
-        {852, {
-            {.id = 870, .distance = 28.126f}, {.id = 840, .distance = 28.795f}, {.id = 851, .distance = 32.089f}, {.id = 853, .distance = 33.350f}, {.id = 869, .distance = 38.606f}, {.id = 871, .distance = 40.686f}, {.id = 839, .distance = 50.872f}
-        }},
-        {853, {
-            {.id = 871, .distance = 30.745f}, {.id = 854, .distance = 32.585f}, {.id = 841, .distance = 33.326f}, {.id = 852, .distance = 33.350f}, {.id = 872, .distance = 33.990f}, {.id = 840, .distance = 39.043f}, {.id = 870, .distance = 47.230f}
-        }},
-        {854, {
-            {.id = 873, .distance = 30.088f}, {.id = 841, .distance = 30.119f}, {.id = 855, .distance = 32.298f}, {.id = 853, .distance = 32.585f}, {.id = 872, .distance = 35.628f}, {.id = 842, .distance = 42.036f}, {.id = 874, .distance = 44.864f}
-        }},
-        {855, {
-            {.id = 874, .distance = 28.726f}, {.id = 842, .distance = 29.271f}, {.id = 856, .distance = 31.916f}, {.id = 854, .distance = 32.298f}, {.id = 875, .distance = 37.444f}, {.id = 873, .distance = 42.067f}, {.id = 841, .distance = 46.032f}
-        }},
-        {856, {
-            {.id = 875, .distance = 31.889f}, {.id = 855, .distance = 31.916f}, {.id = 876, .distance = 32.458f}, {.id = 857, .distance = 32.605f}, {.id = 842, .distance = 35.475f}, {.id = 843, .distance = 35.680f}, {.id = 874, .distance = 49.358f}
-        }},
-        {857, {
-            {.id = 877, .distance = 28.557f}, {.id = 843, .distance = 30.515f}, {.id = 856, .distance = 32.605f}, {.id = 858, .distance = 33.386f}, {.id = 876, .distance = 36.707f}, {.id = 878, .distance = 42.276f}, {.id = 844, .distance = 47.436f}
-        }},
-        {858, {
-            {.id = 878, .distance = 29.283f}, {.id = 844, .distance = 30.713f}, {.id = 859, .distance = 32.395f}, {.id = 857, .distance = 33.386f}, {.id = 879, .distance = 35.383f}, {.id = 843, .distance = 43.747f}, {.id = 877, .distance = 45.069f}
-        }},
-        {859, {
-            {.id = 880, .distance = 30.492f}, {.id = 858, .distance = 32.395f}, {.id = 860, .distance = 32.492f}, {.id = 844, .distance = 32.961f}, {.id = 879, .distance = 33.774f}, {.id = 845, .distance = 39.529f}, {.id = 881, .distance = 46.947f}
-        }},
-        {860, {
-            {.id = 845, .distance = 28.795f}, {.id = 881, .distance = 28.796f}, {.id = 861, .distance = 31.301f}, {.id = 859, .distance = 32.492f}, {.id = 882, .distance = 39.130f}, {.id = 880, .distance = 39.658f}, {.id = 846, .distance = 50.236f}
-        }},
-        {861, {
-            {.id = 882, .distance = 30.076f}, {.id = 860, .distance = 31.301f}, {.id = 862, .distance = 33.324f}, {.id = 846, .distance = 33.378f}, {.id = 883, .distance = 33.386f}, {.id = 845, .distance = 37.853f}, {.id = 881, .distance = 46.778f}
-        }},
-        {862, {
-            {.id = 884, .distance = 29.653f}, {.id = 846, .distance = 30.978f}, {.id = 863, .distance = 32.852f}, {.id = 861, .distance = 33.324f}, {.id = 883, .distance = 35.446f}, {.id = 847, .distance = 42.934f}, {.id = 885, .distance = 44.581f}
-        }},
-        {863, {
-            {.id = 885, .distance = 28.776f}, {.id = 847, .distance = 29.314f}, {.id = 848, .distance = 32.088f}, {.id = 862, .distance = 32.852f}, {.id = 864, .distance = 36.954f}, {.id = 884, .distance = 42.498f}, {.id = 846, .distance = 47.075f}
-        }},
-        {864, {
-            {.id = 886, .distance = 23.617f}, {.id = 885, .distance = 31.442f}, {.id = 848, .distance = 31.964f}, {.id = 865, .distance = 32.702f}, {.id = 863, .distance = 36.954f}, {.id = 933, .distance = 41.259f}, {.id = 935, .distance = 45.103f}
-        }},
-        {865, {
-            {.id = 848, .distance = 31.937f}, {.id = 864, .distance = 32.702f}, {.id = 866, .distance = 32.725f}, {.id = 887, .distance = 36.068f}, {.id = 849, .distance = 37.491f}, {.id = 888, .distance = 39.068f}, {.id = 886, .distance = 41.895f}
-        }},
-        {866, {
-            {.id = 849, .distance = 29.419f}, {.id = 867, .distance = 30.638f}, {.id = 865, .distance = 32.725f}, {.id = 888, .distance = 35.794f}, {.id = 889, .distance = 36.665f}, {.id = 850, .distance = 44.568f}, {.id = 890, .distance = 46.412f}
-        }},
-        {867, {
-            {.id = 890, .distance = 24.191f}, {.id = 850, .distance = 29.848f}, {.id = 866, .distance = 30.638f}, {.id = 868, .distance = 31.516f}, {.id = 849, .distance = 41.947f}, {.id = 891, .distance = 44.167f}, {.id = 889, .distance = 44.460f}
-        }},
-        {868, {
-            {.id = 895, .distance = 27.519f}, {.id = 867, .distance = 31.516f}, {.id = 869, .distance = 33.096f}, {.id = 851, .distance = 33.457f}, {.id = 850, .distance = 35.426f}, {.id = 892, .distance = 35.506f}, {.id = 890, .distance = 36.051f}
-        }},
-        {869, {
-            {.id = 851, .distance = 30.775f}, {.id = 870, .distance = 30.943f}, {.id = 895, .distance = 31.347f}, {.id = 868, .distance = 33.096f}, {.id = 897, .distance = 37.393f}, {.id = 852, .distance = 38.606f}, {.id = 896, .distance = 45.102f}
-        }},
-        {870, {
-            {.id = 852, .distance = 28.126f}, {.id = 869, .distance = 30.943f}, {.id = 871, .distance = 32.322f}, {.id = 898, .distance = 33.115f}, {.id = 897, .distance = 43.474f}, {.id = 899, .distance = 44.048f}, {.id = 851, .distance = 47.195f}
-        }},
-        {871, {
-            {.id = 901, .distance = 30.540f}, {.id = 853, .distance = 30.745f}, {.id = 870, .distance = 32.322f}, {.id = 872, .distance = 32.441f}, {.id = 899, .distance = 37.153f}, {.id = 852, .distance = 40.686f}, {.id = 900, .distance = 45.279f}
-        }},
-        {872, {
-            {.id = 901, .distance = 27.373f}, {.id = 873, .distance = 31.563f}, {.id = 871, .distance = 32.441f}, {.id = 853, .distance = 33.990f}, {.id = 903, .distance = 35.618f}, {.id = 854, .distance = 35.628f}, {.id = 905, .distance = 36.566f}
-        }},
-        {873, {
-            {.id = 905, .distance = 24.293f}, {.id = 854, .distance = 30.088f}, {.id = 872, .distance = 31.563f}, {.id = 874, .distance = 31.793f}, {.id = 855, .distance = 42.067f}, {.id = 906, .distance = 43.775f}, {.id = 907, .distance = 43.787f}
-        }},
-        {874, {
-            {.id = 855, .distance = 28.726f}, {.id = 875, .distance = 31.427f}, {.id = 873, .distance = 31.793f}, {.id = 908, .distance = 35.922f}, {.id = 907, .distance = 37.333f}, {.id = 854, .distance = 44.864f}, {.id = 905, .distance = 47.704f}
-        }},
-        {875, {
-            {.id = 874, .distance = 31.427f}, {.id = 856, .distance = 31.889f}, {.id = 876, .distance = 32.342f}, {.id = 909, .distance = 35.562f}, {.id = 855, .distance = 37.444f}, {.id = 908, .distance = 39.243f}, {.id = 911, .distance = 41.982f}
-        }},
-        {876, {
-            {.id = 911, .distance = 23.803f}, {.id = 877, .distance = 31.693f}, {.id = 875, .distance = 32.342f}, {.id = 856, .distance = 32.458f}, {.id = 857, .distance = 36.707f}, {.id = 913, .distance = 41.333f}, {.id = 910, .distance = 44.974f}
-        }},
-        {877, {
-            {.id = 915, .distance = 24.410f}, {.id = 857, .distance = 28.557f}, {.id = 876, .distance = 31.693f}, {.id = 878, .distance = 32.138f}, {.id = 913, .distance = 38.124f}, {.id = 911, .distance = 43.096f}, {.id = 858, .distance = 45.069f}
-        }},
-        {878, {
-            {.id = 858, .distance = 29.283f}, {.id = 879, .distance = 31.589f}, {.id = 877, .distance = 32.138f}, {.id = 917, .distance = 36.174f}, {.id = 915, .distance = 36.927f}, {.id = 857, .distance = 42.276f}, {.id = 918, .distance = 43.787f}
-        }},
-        {879, {
-            {.id = 878, .distance = 31.589f}, {.id = 880, .distance = 32.185f}, {.id = 918, .distance = 33.528f}, {.id = 859, .distance = 33.774f}, {.id = 858, .distance = 35.383f}, {.id = 919, .distance = 39.292f}, {.id = 917, .distance = 48.151f}
-        }},
-        {880, {
-            {.id = 921, .distance = 26.800f}, {.id = 859, .distance = 30.492f}, {.id = 881, .distance = 31.085f}, {.id = 879, .distance = 32.185f}, {.id = 860, .distance = 39.658f}, {.id = 919, .distance = 40.843f}, {.id = 920, .distance = 44.297f}
-        }},
-        {881, {
-            {.id = 860, .distance = 28.796f}, {.id = 880, .distance = 31.085f}, {.id = 921, .distance = 31.165f}, {.id = 882, .distance = 31.748f}, {.id = 925, .distance = 32.025f}, {.id = 923, .distance = 35.484f}, {.id = 861, .distance = 46.778f}
-        }},
-        {882, {
-            {.id = 925, .distance = 26.974f}, {.id = 861, .distance = 30.076f}, {.id = 883, .distance = 31.574f}, {.id = 881, .distance = 31.748f}, {.id = 860, .distance = 39.130f}, {.id = 927, .distance = 40.759f}, {.id = 926, .distance = 44.255f}
-        }},
-        {883, {
-            {.id = 882, .distance = 31.574f}, {.id = 884, .distance = 32.495f}, {.id = 861, .distance = 33.386f}, {.id = 928, .distance = 34.006f}, {.id = 862, .distance = 35.446f}, {.id = 927, .distance = 40.058f}, {.id = 929, .distance = 48.765f}
-        }},
-        {884, {
-            {.id = 862, .distance = 29.653f}, {.id = 885, .distance = 31.761f}, {.id = 883, .distance = 32.495f}, {.id = 929, .distance = 35.652f}, {.id = 931, .distance = 35.973f}, {.id = 863, .distance = 42.498f}, {.id = 928, .distance = 43.930f}
-        }},
-        {885, {
-            {.id = 931, .distance = 24.656f}, {.id = 863, .distance = 28.776f}, {.id = 864, .distance = 31.442f}, {.id = 884, .distance = 31.761f}, {.id = 933, .distance = 38.273f}, {.id = 886, .distance = 43.129f}, {.id = 862, .distance = 44.581f}
-        }},
-        {886, {
-            {.id = 935, .distance = 22.863f}, {.id = 864, .distance = 23.617f}, {.id = 933, .distance = 27.856f}, {.id = 934, .distance = 35.561f}, {.id = 887, .distance = 37.917f}, {.id = 865, .distance = 41.895f}, {.id = 885, .distance = 43.129f}
-        }},
-        {887, {
-            {.id = 935, .distance = 28.096f}, {.id = 888, .distance = 29.153f}, {.id = 1013, .distance = 29.303f}, {.id = 865, .distance = 36.068f}, {.id = 886, .distance = 37.917f}, {.id = 1012, .distance = 40.708f}, {.id = 1014, .distance = 41.405f}
-        }},
-        {888, {
-            {.id = 889, .distance = 28.265f}, {.id = 887, .distance = 29.153f}, {.id = 1012, .distance = 29.697f}, {.id = 866, .distance = 35.794f}, {.id = 865, .distance = 39.068f}, {.id = 1011, .distance = 40.854f}, {.id = 1013, .distance = 41.887f}
-        }},
-        {889, {
-            {.id = 888, .distance = 28.265f}, {.id = 891, .distance = 28.989f}, {.id = 1011, .distance = 29.349f}, {.id = 866, .distance = 36.665f}, {.id = 890, .distance = 38.712f}, {.id = 1010, .distance = 40.741f}, {.id = 1012, .distance = 41.218f}
-        }},
-        {890, {
-            {.id = 891, .distance = 23.607f}, {.id = 867, .distance = 24.191f}, {.id = 892, .distance = 27.455f}, {.id = 893, .distance = 35.536f}, {.id = 868, .distance = 36.051f}, {.id = 889, .distance = 38.712f}, {.id = 866, .distance = 46.412f}
-        }},
-        {891, {
-            {.id = 890, .distance = 23.607f}, {.id = 893, .distance = 28.500f}, {.id = 889, .distance = 28.989f}, {.id = 1010, .distance = 29.313f}, {.id = 892, .distance = 38.998f}, {.id = 1008, .distance = 40.245f}, {.id = 1011, .distance = 41.506f}
-        }},
-        {892, {
-            {.id = 893, .distance = 25.823f}, {.id = 894, .distance = 26.007f}, {.id = 895, .distance = 27.304f}, {.id = 890, .distance = 27.455f}, {.id = 868, .distance = 35.506f}, {.id = 891, .distance = 38.998f}, {.id = 896, .distance = 39.242f}
-        }},
-        {893, {
-            {.id = 892, .distance = 25.823f}, {.id = 891, .distance = 28.500f}, {.id = 1008, .distance = 29.551f}, {.id = 894, .distance = 30.900f}, {.id = 890, .distance = 35.536f}, {.id = 1010, .distance = 41.458f}, {.id = 1224, .distance = 50.838f}
-        }},
-        {894, {
-            {.id = 892, .distance = 26.007f}, {.id = 1224, .distance = 28.644f}, {.id = 896, .distance = 29.614f}, {.id = 893, .distance = 30.900f}, {.id = 895, .distance = 35.963f}, {.id = 1222, .distance = 39.268f}, {.id = 1225, .distance = 52.119f}
-        }},
-        {895, {
-            {.id = 896, .distance = 23.404f}, {.id = 892, .distance = 27.304f}, {.id = 868, .distance = 27.519f}, {.id = 869, .distance = 31.347f}, {.id = 894, .distance = 35.963f}, {.id = 897, .distance = 38.924f}, {.id = 890, .distance = 47.034f}
-        }},
-        {896, {
-            {.id = 895, .distance = 23.404f}, {.id = 897, .distance = 28.584f}, {.id = 1222, .distance = 28.966f}, {.id = 894, .distance = 29.614f}, {.id = 1221, .distance = 39.043f}, {.id = 892, .distance = 39.242f}, {.id = 1224, .distance = 42.830f}
-        }},
-        {897, {
-            {.id = 898, .distance = 28.069f}, {.id = 896, .distance = 28.584f}, {.id = 1221, .distance = 28.757f}, {.id = 869, .distance = 37.393f}, {.id = 1220, .distance = 38.867f}, {.id = 895, .distance = 38.924f}, {.id = 1222, .distance = 42.413f}
-        }},
-        {898, {
-            {.id = 897, .distance = 28.069f}, {.id = 899, .distance = 28.840f}, {.id = 1220, .distance = 28.846f}, {.id = 870, .distance = 33.115f}, {.id = 1219, .distance = 39.574f}, {.id = 1221, .distance = 41.923f}, {.id = 869, .distance = 48.228f}
-        }},
-        {899, {
-            {.id = 898, .distance = 28.840f}, {.id = 1219, .distance = 28.966f}, {.id = 900, .distance = 29.098f}, {.id = 871, .distance = 37.153f}, {.id = 901, .distance = 38.371f}, {.id = 1218, .distance = 39.389f}, {.id = 1220, .distance = 41.988f}
-        }},
-        {900, {
-            {.id = 901, .distance = 23.468f}, {.id = 902, .distance = 28.068f}, {.id = 1218, .distance = 28.906f}, {.id = 899, .distance = 29.098f}, {.id = 903, .distance = 37.859f}, {.id = 1216, .distance = 38.797f}, {.id = 1219, .distance = 42.324f}
-        }},
-        {901, {
-            {.id = 900, .distance = 23.468f}, {.id = 903, .distance = 26.995f}, {.id = 872, .distance = 27.373f}, {.id = 871, .distance = 30.540f}, {.id = 902, .distance = 35.584f}, {.id = 899, .distance = 38.371f}, {.id = 905, .distance = 47.445f}
-        }},
-        {902, {
-            {.id = 903, .distance = 25.235f}, {.id = 900, .distance = 28.068f}, {.id = 1216, .distance = 28.941f}, {.id = 904, .distance = 31.314f}, {.id = 901, .distance = 35.584f}, {.id = 1218, .distance = 41.827f}, {.id = 1214, .distance = 50.917f}
-        }},
-        {903, {
-            {.id = 902, .distance = 25.235f}, {.id = 904, .distance = 25.959f}, {.id = 901, .distance = 26.995f}, {.id = 905, .distance = 28.280f}, {.id = 872, .distance = 35.618f}, {.id = 900, .distance = 37.859f}, {.id = 906, .distance = 39.348f}
-        }},
-        {904, {
-            {.id = 903, .distance = 25.959f}, {.id = 906, .distance = 28.175f}, {.id = 789, .distance = 29.551f}, {.id = 902, .distance = 31.314f}, {.id = 905, .distance = 35.099f}, {.id = 787, .distance = 40.245f}, {.id = 901, .distance = 52.245f}
-        }},
-        {905, {
-            {.id = 906, .distance = 22.858f}, {.id = 873, .distance = 24.293f}, {.id = 903, .distance = 28.280f}, {.id = 904, .distance = 35.099f}, {.id = 872, .distance = 36.566f}, {.id = 907, .distance = 37.718f}, {.id = 901, .distance = 47.445f}
-        }},
-        {906, {
-            {.id = 905, .distance = 22.858f}, {.id = 904, .distance = 28.175f}, {.id = 907, .distance = 28.665f}, {.id = 787, .distance = 29.313f}, {.id = 903, .distance = 39.348f}, {.id = 785, .distance = 40.741f}, {.id = 789, .distance = 41.458f}
-        }},
-        {907, {
-            {.id = 906, .distance = 28.665f}, {.id = 908, .distance = 28.744f}, {.id = 785, .distance = 29.349f}, {.id = 874, .distance = 37.333f}, {.id = 905, .distance = 37.718f}, {.id = 784, .distance = 40.854f}, {.id = 787, .distance = 41.506f}
-        }},
-        {908, {
-            {.id = 909, .distance = 28.665f}, {.id = 907, .distance = 28.744f}, {.id = 784, .distance = 29.697f}, {.id = 874, .distance = 35.922f}, {.id = 875, .distance = 39.243f}, {.id = 783, .distance = 40.708f}, {.id = 785, .distance = 41.218f}
-        }},
-        {909, {
-            {.id = 908, .distance = 28.665f}, {.id = 910, .distance = 28.989f}, {.id = 783, .distance = 29.303f}, {.id = 875, .distance = 35.562f}, {.id = 911, .distance = 37.946f}, {.id = 831, .distance = 40.502f}, {.id = 784, .distance = 41.887f}
-        }},
-        {910, {
-            {.id = 911, .distance = 22.522f}, {.id = 912, .distance = 28.989f}, {.id = 909, .distance = 28.989f}, {.id = 831, .distance = 29.448f}, {.id = 913, .distance = 38.748f}, {.id = 830, .distance = 40.870f}, {.id = 783, .distance = 41.405f}
-        }},
-        {911, {
-            {.id = 910, .distance = 22.522f}, {.id = 876, .distance = 23.803f}, {.id = 913, .distance = 27.573f}, {.id = 912, .distance = 35.430f}, {.id = 909, .distance = 37.946f}, {.id = 875, .distance = 41.982f}, {.id = 877, .distance = 43.096f}
-        }},
-        {912, {
-            {.id = 913, .distance = 25.732f}, {.id = 910, .distance = 28.989f}, {.id = 830, .distance = 29.475f}, {.id = 914, .distance = 30.699f}, {.id = 911, .distance = 35.430f}, {.id = 831, .distance = 42.128f}, {.id = 174, .distance = 50.956f}
-        }},
-        {913, {
-            {.id = 914, .distance = 25.715f}, {.id = 912, .distance = 25.732f}, {.id = 915, .distance = 27.009f}, {.id = 911, .distance = 27.573f}, {.id = 877, .distance = 38.124f}, {.id = 910, .distance = 38.748f}, {.id = 916, .distance = 38.795f}
-        }},
-        {914, {
-            {.id = 913, .distance = 25.715f}, {.id = 916, .distance = 28.587f}, {.id = 174, .distance = 28.700f}, {.id = 912, .distance = 30.699f}, {.id = 915, .distance = 35.180f}, {.id = 172, .distance = 39.833f}, {.id = 175, .distance = 52.098f}
-        }},
-        {915, {
-            {.id = 916, .distance = 23.318f}, {.id = 877, .distance = 24.410f}, {.id = 913, .distance = 27.009f}, {.id = 914, .distance = 35.180f}, {.id = 878, .distance = 36.927f}, {.id = 917, .distance = 38.625f}, {.id = 911, .distance = 47.229f}
-        }},
-        {916, {
-            {.id = 915, .distance = 23.318f}, {.id = 914, .distance = 28.587f}, {.id = 917, .distance = 28.648f}, {.id = 172, .distance = 28.780f}, {.id = 913, .distance = 38.795f}, {.id = 171, .distance = 40.238f}, {.id = 174, .distance = 40.865f}
-        }},
-        {917, {
-            {.id = 916, .distance = 28.648f}, {.id = 918, .distance = 28.678f}, {.id = 171, .distance = 28.767f}, {.id = 878, .distance = 36.174f}, {.id = 915, .distance = 38.625f}, {.id = 170, .distance = 40.371f}, {.id = 172, .distance = 41.278f}
-        }},
-        {918, {
-            {.id = 919, .distance = 28.019f}, {.id = 917, .distance = 28.678f}, {.id = 170, .distance = 28.727f}, {.id = 879, .distance = 33.528f}, {.id = 169, .distance = 39.759f}, {.id = 171, .distance = 40.952f}, {.id = 878, .distance = 43.787f}
-        }},
-        {919, {
-            {.id = 918, .distance = 28.019f}, {.id = 169, .distance = 28.493f}, {.id = 920, .distance = 29.666f}, {.id = 921, .distance = 39.143f}, {.id = 879, .distance = 39.292f}, {.id = 168, .distance = 40.304f}, {.id = 170, .distance = 40.363f}
-        }},
-        {920, {
-            {.id = 921, .distance = 23.574f}, {.id = 168, .distance = 28.673f}, {.id = 922, .distance = 28.796f}, {.id = 919, .distance = 29.666f}, {.id = 923, .distance = 38.536f}, {.id = 166, .distance = 40.055f}, {.id = 169, .distance = 41.297f}
-        }},
-        {921, {
-            {.id = 920, .distance = 23.574f}, {.id = 880, .distance = 26.800f}, {.id = 923, .distance = 27.295f}, {.id = 881, .distance = 31.165f}, {.id = 922, .distance = 35.726f}, {.id = 919, .distance = 39.143f}, {.id = 925, .distance = 46.866f}
-        }},
-        {922, {
-            {.id = 923, .distance = 25.236f}, {.id = 166, .distance = 28.617f}, {.id = 920, .distance = 28.796f}, {.id = 924, .distance = 30.642f}, {.id = 921, .distance = 35.726f}, {.id = 168, .distance = 41.739f}, {.id = 165, .distance = 51.576f}
-        }},
-        {923, {
-            {.id = 922, .distance = 25.236f}, {.id = 924, .distance = 25.701f}, {.id = 921, .distance = 27.295f}, {.id = 925, .distance = 27.601f}, {.id = 881, .distance = 35.484f}, {.id = 920, .distance = 38.536f}, {.id = 926, .distance = 38.536f}
-        }},
-        {924, {
-            {.id = 923, .distance = 25.701f}, {.id = 926, .distance = 28.171f}, {.id = 298, .distance = 28.551f}, {.id = 922, .distance = 30.642f}, {.id = 925, .distance = 35.416f}, {.id = 296, .distance = 41.429f}, {.id = 300, .distance = 50.454f}
-        }},
-        {925, {
-            {.id = 926, .distance = 23.046f}, {.id = 882, .distance = 26.974f}, {.id = 923, .distance = 27.601f}, {.id = 881, .distance = 32.025f}, {.id = 924, .distance = 35.416f}, {.id = 927, .distance = 38.124f}, {.id = 921, .distance = 46.866f}
-        }},
-        {926, {
-            {.id = 925, .distance = 23.046f}, {.id = 924, .distance = 28.171f}, {.id = 296, .distance = 28.586f}, {.id = 927, .distance = 28.796f}, {.id = 923, .distance = 38.536f}, {.id = 298, .distance = 39.222f}, {.id = 295, .distance = 42.712f}
-        }},
-        {927, {
-            {.id = 295, .distance = 28.538f}, {.id = 928, .distance = 28.739f}, {.id = 926, .distance = 28.796f}, {.id = 925, .distance = 38.124f}, {.id = 296, .distance = 38.933f}, {.id = 883, .distance = 40.058f}, {.id = 882, .distance = 40.759f}
-        }},
-        {928, {
-            {.id = 294, .distance = 28.593f}, {.id = 927, .distance = 28.739f}, {.id = 929, .distance = 28.996f}, {.id = 883, .distance = 34.006f}, {.id = 295, .distance = 38.440f}, {.id = 293, .distance = 42.065f}, {.id = 884, .distance = 43.930f}
-        }},
-        {929, {
-            {.id = 930, .distance = 28.539f}, {.id = 293, .distance = 28.720f}, {.id = 928, .distance = 28.996f}, {.id = 884, .distance = 35.652f}, {.id = 931, .distance = 38.072f}, {.id = 294, .distance = 39.193f}, {.id = 292, .distance = 41.888f}
-        }},
-        {930, {
-            {.id = 931, .distance = 23.229f}, {.id = 292, .distance = 28.526f}, {.id = 929, .distance = 28.539f}, {.id = 932, .distance = 29.175f}, {.id = 933, .distance = 38.795f}, {.id = 293, .distance = 38.975f}, {.id = 290, .distance = 41.739f}
-        }},
-        {931, {
-            {.id = 930, .distance = 23.229f}, {.id = 885, .distance = 24.656f}, {.id = 933, .distance = 27.373f}, {.id = 884, .distance = 35.973f}, {.id = 932, .distance = 36.131f}, {.id = 929, .distance = 38.072f}, {.id = 886, .distance = 47.750f}
-        }},
-        {932, {
-            {.id = 933, .distance = 26.133f}, {.id = 290, .distance = 27.990f}, {.id = 930, .distance = 29.175f}, {.id = 934, .distance = 30.723f}, {.id = 931, .distance = 36.131f}, {.id = 292, .distance = 39.023f}, {.id = 288, .distance = 51.341f}
-        }},
-        {933, {
-            {.id = 934, .distance = 25.813f}, {.id = 932, .distance = 26.133f}, {.id = 931, .distance = 27.373f}, {.id = 886, .distance = 27.856f}, {.id = 885, .distance = 38.273f}, {.id = 930, .distance = 38.795f}, {.id = 935, .distance = 39.458f}
-        }},
-        {934, {
-            {.id = 933, .distance = 25.813f}, {.id = 1016, .distance = 29.475f}, {.id = 935, .distance = 29.479f}, {.id = 932, .distance = 30.723f}, {.id = 886, .distance = 35.561f}, {.id = 1014, .distance = 40.870f}, {.id = 290, .distance = 50.403f}
-        }},
-        {935, {
-            {.id = 886, .distance = 22.863f}, {.id = 887, .distance = 28.096f}, {.id = 1014, .distance = 29.448f}, {.id = 934, .distance = 29.479f}, {.id = 933, .distance = 39.458f}, {.id = 1013, .distance = 40.502f}, {.id = 1016, .distance = 42.128f}
-        }},
-        {936, {
-            {.id = 937, .distance = 25.256f}, {.id = 939, .distance = 25.653f}, {.id = 938, .distance = 25.660f}, {.id = 941, .distance = 26.237f}, {.id = 940, .distance = 26.780f}, {.id = 943, .distance = 53.251f}, {.id = 947, .distance = 53.584f}
-        }},
-        {937, {
-            {.id = 936, .distance = 25.256f}, {.id = 943, .distance = 27.996f}, {.id = 941, .distance = 30.406f}, {.id = 938, .distance = 30.745f}, {.id = 944, .distance = 36.902f}, {.id = 942, .distance = 36.902f}, {.id = 939, .distance = 48.670f}
-        }},
-        {938, {
-            {.id = 936, .distance = 25.660f}, {.id = 945, .distance = 28.138f}, {.id = 939, .distance = 30.016f}, {.id = 937, .distance = 30.745f}, {.id = 946, .distance = 35.779f}, {.id = 944, .distance = 37.730f}, {.id = 940, .distance = 49.623f}
-        }},
-        {939, {
-            {.id = 936, .distance = 25.653f}, {.id = 947, .distance = 27.950f}, {.id = 938, .distance = 30.016f}, {.id = 940, .distance = 30.334f}, {.id = 948, .distance = 36.663f}, {.id = 946, .distance = 36.917f}, {.id = 937, .distance = 48.670f}
-        }},
-        {940, {
-            {.id = 936, .distance = 26.780f}, {.id = 949, .distance = 28.148f}, {.id = 939, .distance = 30.334f}, {.id = 941, .distance = 30.829f}, {.id = 948, .distance = 36.041f}, {.id = 950, .distance = 36.581f}, {.id = 937, .distance = 49.415f}
-        }},
-        {941, {
-            {.id = 936, .distance = 26.237f}, {.id = 951, .distance = 28.784f}, {.id = 937, .distance = 30.406f}, {.id = 940, .distance = 30.829f}, {.id = 942, .distance = 36.136f}, {.id = 950, .distance = 36.663f}, {.id = 939, .distance = 49.028f}
-        }},
-        {942, {
-            {.id = 953, .distance = 29.943f}, {.id = 951, .distance = 32.709f}, {.id = 943, .distance = 33.241f}, {.id = 952, .distance = 35.999f}, {.id = 941, .distance = 36.136f}, {.id = 937, .distance = 36.902f}, {.id = 954, .distance = 43.146f}
-        }},
-        {943, {
-            {.id = 937, .distance = 27.996f}, {.id = 954, .distance = 31.091f}, {.id = 942, .distance = 33.241f}, {.id = 944, .distance = 33.489f}, {.id = 955, .distance = 33.997f}, {.id = 953, .distance = 46.465f}, {.id = 956, .distance = 50.872f}
-        }},
-        {944, {
-            {.id = 956, .distance = 28.795f}, {.id = 943, .distance = 33.489f}, {.id = 945, .distance = 34.526f}, {.id = 937, .distance = 36.902f}, {.id = 938, .distance = 37.730f}, {.id = 955, .distance = 39.001f}, {.id = 957, .distance = 39.043f}
-        }},
-        {945, {
-            {.id = 938, .distance = 28.138f}, {.id = 958, .distance = 30.119f}, {.id = 946, .distance = 32.862f}, {.id = 957, .distance = 33.326f}, {.id = 944, .distance = 34.526f}, {.id = 959, .distance = 46.032f}, {.id = 956, .distance = 51.953f}
-        }},
-        {946, {
-            {.id = 959, .distance = 29.271f}, {.id = 945, .distance = 32.862f}, {.id = 947, .distance = 32.910f}, {.id = 960, .distance = 35.475f}, {.id = 938, .distance = 35.779f}, {.id = 939, .distance = 36.917f}, {.id = 958, .distance = 42.036f}
-        }},
-        {947, {
-            {.id = 939, .distance = 27.950f}, {.id = 961, .distance = 30.515f}, {.id = 946, .distance = 32.910f}, {.id = 948, .distance = 34.288f}, {.id = 960, .distance = 35.680f}, {.id = 962, .distance = 43.747f}, {.id = 938, .distance = 50.881f}
-        }},
-        {948, {
-            {.id = 962, .distance = 30.713f}, {.id = 963, .distance = 32.961f}, {.id = 947, .distance = 34.288f}, {.id = 949, .distance = 34.333f}, {.id = 940, .distance = 36.041f}, {.id = 939, .distance = 36.663f}, {.id = 961, .distance = 47.436f}
-        }},
-        {949, {
-            {.id = 940, .distance = 28.148f}, {.id = 964, .distance = 28.795f}, {.id = 950, .distance = 32.474f}, {.id = 948, .distance = 34.333f}, {.id = 965, .distance = 37.853f}, {.id = 963, .distance = 39.529f}, {.id = 941, .distance = 52.029f}
-        }},
-        {950, {
-            {.id = 966, .distance = 30.978f}, {.id = 949, .distance = 32.474f}, {.id = 965, .distance = 33.378f}, {.id = 951, .distance = 34.135f}, {.id = 940, .distance = 36.581f}, {.id = 941, .distance = 36.663f}, {.id = 967, .distance = 47.075f}
-        }},
-        {951, {
-            {.id = 941, .distance = 28.784f}, {.id = 967, .distance = 29.314f}, {.id = 942, .distance = 32.709f}, {.id = 950, .distance = 34.135f}, {.id = 952, .distance = 35.428f}, {.id = 966, .distance = 42.934f}, {.id = 937, .distance = 52.730f}
-        }},
-        {952, {
-            {.id = 969, .distance = 31.937f}, {.id = 968, .distance = 31.964f}, {.id = 967, .distance = 32.088f}, {.id = 953, .distance = 32.704f}, {.id = 951, .distance = 35.428f}, {.id = 942, .distance = 35.999f}, {.id = 989, .distance = 49.921f}
-        }},
-        {953, {
-            {.id = 970, .distance = 29.419f}, {.id = 942, .distance = 29.943f}, {.id = 954, .distance = 32.468f}, {.id = 952, .distance = 32.704f}, {.id = 969, .distance = 37.491f}, {.id = 971, .distance = 41.947f}, {.id = 943, .distance = 46.465f}
-        }},
-        {954, {
-            {.id = 971, .distance = 29.848f}, {.id = 943, .distance = 31.091f}, {.id = 955, .distance = 31.917f}, {.id = 953, .distance = 32.468f}, {.id = 972, .distance = 35.426f}, {.id = 942, .distance = 43.146f}, {.id = 970, .distance = 44.568f}
-        }},
-        {955, {
-            {.id = 973, .distance = 30.775f}, {.id = 954, .distance = 31.917f}, {.id = 956, .distance = 32.089f}, {.id = 972, .distance = 33.457f}, {.id = 943, .distance = 33.997f}, {.id = 944, .distance = 39.001f}, {.id = 974, .distance = 47.195f}
-        }},
-        {956, {
-            {.id = 974, .distance = 28.126f}, {.id = 944, .distance = 28.795f}, {.id = 955, .distance = 32.089f}, {.id = 957, .distance = 33.350f}, {.id = 973, .distance = 38.606f}, {.id = 975, .distance = 40.686f}, {.id = 943, .distance = 50.872f}
-        }},
-        {957, {
-            {.id = 975, .distance = 30.745f}, {.id = 958, .distance = 32.585f}, {.id = 945, .distance = 33.326f}, {.id = 956, .distance = 33.350f}, {.id = 976, .distance = 33.990f}, {.id = 944, .distance = 39.043f}, {.id = 974, .distance = 47.230f}
-        }},
-        {958, {
-            {.id = 977, .distance = 30.088f}, {.id = 945, .distance = 30.119f}, {.id = 959, .distance = 32.298f}, {.id = 957, .distance = 32.585f}, {.id = 976, .distance = 35.628f}, {.id = 946, .distance = 42.036f}, {.id = 978, .distance = 44.864f}
-        }},
-        {959, {
-            {.id = 978, .distance = 28.726f}, {.id = 946, .distance = 29.271f}, {.id = 960, .distance = 31.916f}, {.id = 958, .distance = 32.298f}, {.id = 979, .distance = 37.444f}, {.id = 977, .distance = 42.067f}, {.id = 945, .distance = 46.032f}
-        }},
-        {960, {
-            {.id = 979, .distance = 31.889f}, {.id = 959, .distance = 31.916f}, {.id = 980, .distance = 32.458f}, {.id = 961, .distance = 32.605f}, {.id = 946, .distance = 35.475f}, {.id = 947, .distance = 35.680f}, {.id = 978, .distance = 49.358f}
-        }},
-        {961, {
-            {.id = 981, .distance = 28.557f}, {.id = 947, .distance = 30.515f}, {.id = 960, .distance = 32.605f}, {.id = 962, .distance = 33.386f}, {.id = 980, .distance = 36.707f}, {.id = 982, .distance = 42.276f}, {.id = 948, .distance = 47.436f}
-        }},
-        {962, {
-            {.id = 982, .distance = 29.283f}, {.id = 948, .distance = 30.713f}, {.id = 963, .distance = 32.395f}, {.id = 961, .distance = 33.386f}, {.id = 983, .distance = 35.383f}, {.id = 947, .distance = 43.747f}, {.id = 981, .distance = 45.069f}
-        }},
-        {963, {
-            {.id = 984, .distance = 30.492f}, {.id = 962, .distance = 32.395f}, {.id = 964, .distance = 32.492f}, {.id = 948, .distance = 32.961f}, {.id = 983, .distance = 33.774f}, {.id = 949, .distance = 39.529f}, {.id = 985, .distance = 46.947f}
-        }},
-        {964, {
-            {.id = 949, .distance = 28.795f}, {.id = 985, .distance = 28.796f}, {.id = 965, .distance = 31.301f}, {.id = 963, .distance = 32.492f}, {.id = 986, .distance = 39.130f}, {.id = 984, .distance = 39.658f}, {.id = 950, .distance = 50.236f}
-        }},
-        {965, {
-            {.id = 986, .distance = 30.076f}, {.id = 964, .distance = 31.301f}, {.id = 966, .distance = 33.324f}, {.id = 950, .distance = 33.378f}, {.id = 987, .distance = 33.386f}, {.id = 949, .distance = 37.853f}, {.id = 985, .distance = 46.778f}
-        }},
-        {966, {
-            {.id = 988, .distance = 29.653f}, {.id = 950, .distance = 30.978f}, {.id = 967, .distance = 32.852f}, {.id = 965, .distance = 33.324f}, {.id = 987, .distance = 35.446f}, {.id = 951, .distance = 42.934f}, {.id = 989, .distance = 44.581f}
-        }},
-        {967, {
-            {.id = 989, .distance = 28.776f}, {.id = 951, .distance = 29.314f}, {.id = 952, .distance = 32.088f}, {.id = 966, .distance = 32.852f}, {.id = 968, .distance = 36.954f}, {.id = 988, .distance = 42.498f}, {.id = 950, .distance = 47.075f}
-        }},
-        {968, {
-            {.id = 990, .distance = 23.617f}, {.id = 989, .distance = 31.442f}, {.id = 952, .distance = 31.964f}, {.id = 969, .distance = 32.703f}, {.id = 967, .distance = 36.954f}, {.id = 1037, .distance = 41.259f}, {.id = 1039, .distance = 45.103f}
-        }},
-        {969, {
-            {.id = 952, .distance = 31.937f}, {.id = 968, .distance = 32.703f}, {.id = 970, .distance = 32.725f}, {.id = 991, .distance = 36.068f}, {.id = 953, .distance = 37.491f}, {.id = 992, .distance = 39.068f}, {.id = 990, .distance = 41.895f}
-        }},
-        {970, {
-            {.id = 953, .distance = 29.419f}, {.id = 971, .distance = 30.638f}, {.id = 969, .distance = 32.725f}, {.id = 992, .distance = 35.794f}, {.id = 993, .distance = 36.665f}, {.id = 954, .distance = 44.568f}, {.id = 994, .distance = 46.412f}
-        }},
-        {971, {
-            {.id = 994, .distance = 24.191f}, {.id = 954, .distance = 29.848f}, {.id = 970, .distance = 30.638f}, {.id = 972, .distance = 31.516f}, {.id = 953, .distance = 41.947f}, {.id = 995, .distance = 44.167f}, {.id = 993, .distance = 44.460f}
-        }},
-        {972, {
-            {.id = 999, .distance = 27.519f}, {.id = 971, .distance = 31.516f}, {.id = 973, .distance = 33.096f}, {.id = 955, .distance = 33.457f}, {.id = 954, .distance = 35.426f}, {.id = 996, .distance = 35.506f}, {.id = 994, .distance = 36.051f}
-        }},
-        {973, {
-            {.id = 955, .distance = 30.775f}, {.id = 974, .distance = 30.943f}, {.id = 999, .distance = 31.347f}, {.id = 972, .distance = 33.096f}, {.id = 1001, .distance = 37.393f}, {.id = 956, .distance = 38.606f}, {.id = 1000, .distance = 45.102f}
-        }},
-        {974, {
-            {.id = 956, .distance = 28.126f}, {.id = 973, .distance = 30.943f}, {.id = 975, .distance = 32.322f}, {.id = 1002, .distance = 33.115f}, {.id = 1001, .distance = 43.474f}, {.id = 1003, .distance = 44.048f}, {.id = 955, .distance = 47.195f}
-        }},
-        {975, {
-            {.id = 1005, .distance = 30.540f}, {.id = 957, .distance = 30.745f}, {.id = 974, .distance = 32.322f}, {.id = 976, .distance = 32.441f}, {.id = 1003, .distance = 37.153f}, {.id = 956, .distance = 40.686f}, {.id = 1004, .distance = 45.279f}
-        }},
-        {976, {
-            {.id = 1005, .distance = 27.373f}, {.id = 977, .distance = 31.563f}, {.id = 975, .distance = 32.441f}, {.id = 957, .distance = 33.990f}, {.id = 1007, .distance = 35.618f}, {.id = 958, .distance = 35.628f}, {.id = 1009, .distance = 36.566f}
-        }},
-        {977, {
-            {.id = 1009, .distance = 24.293f}, {.id = 958, .distance = 30.088f}, {.id = 976, .distance = 31.563f}, {.id = 978, .distance = 31.793f}, {.id = 959, .distance = 42.067f}, {.id = 1010, .distance = 43.775f}, {.id = 1011, .distance = 43.787f}
-        }},
-        {978, {
-            {.id = 959, .distance = 28.726f}, {.id = 979, .distance = 31.427f}, {.id = 977, .distance = 31.793f}, {.id = 1012, .distance = 35.922f}, {.id = 1011, .distance = 37.333f}, {.id = 958, .distance = 44.864f}, {.id = 1009, .distance = 47.704f}
-        }},
-        {979, {
-            {.id = 978, .distance = 31.427f}, {.id = 960, .distance = 31.889f}, {.id = 980, .distance = 32.342f}, {.id = 1013, .distance = 35.562f}, {.id = 959, .distance = 37.444f}, {.id = 1012, .distance = 39.243f}, {.id = 1015, .distance = 41.982f}
-        }},
-        {980, {
-            {.id = 1015, .distance = 23.803f}, {.id = 981, .distance = 31.693f}, {.id = 979, .distance = 32.342f}, {.id = 960, .distance = 32.458f}, {.id = 961, .distance = 36.707f}, {.id = 1017, .distance = 41.333f}, {.id = 1014, .distance = 44.974f}
-        }},
-        {981, {
-            {.id = 1019, .distance = 24.410f}, {.id = 961, .distance = 28.557f}, {.id = 980, .distance = 31.693f}, {.id = 982, .distance = 32.138f}, {.id = 1017, .distance = 38.124f}, {.id = 1015, .distance = 43.096f}, {.id = 962, .distance = 45.069f}
-        }},
-        {982, {
-            {.id = 962, .distance = 29.283f}, {.id = 983, .distance = 31.589f}, {.id = 981, .distance = 32.138f}, {.id = 1021, .distance = 36.174f}, {.id = 1019, .distance = 36.927f}, {.id = 961, .distance = 42.276f}, {.id = 1022, .distance = 43.787f}
-        }},
-        {983, {
-            {.id = 982, .distance = 31.589f}, {.id = 984, .distance = 32.185f}, {.id = 1022, .distance = 33.528f}, {.id = 963, .distance = 33.774f}, {.id = 962, .distance = 35.383f}, {.id = 1023, .distance = 39.292f}, {.id = 1021, .distance = 48.151f}
-        }},
-        {984, {
-            {.id = 1025, .distance = 26.800f}, {.id = 963, .distance = 30.492f}, {.id = 985, .distance = 31.085f}, {.id = 983, .distance = 32.185f}, {.id = 964, .distance = 39.658f}, {.id = 1023, .distance = 40.843f}, {.id = 1024, .distance = 44.297f}
-        }},
-        {985, {
-            {.id = 964, .distance = 28.796f}, {.id = 984, .distance = 31.085f}, {.id = 1025, .distance = 31.165f}, {.id = 986, .distance = 31.748f}, {.id = 1029, .distance = 32.025f}, {.id = 1027, .distance = 35.484f}, {.id = 965, .distance = 46.778f}
-        }},
-        {986, {
-            {.id = 1029, .distance = 26.974f}, {.id = 965, .distance = 30.076f}, {.id = 987, .distance = 31.574f}, {.id = 985, .distance = 31.748f}, {.id = 964, .distance = 39.130f}, {.id = 1031, .distance = 40.759f}, {.id = 1030, .distance = 44.255f}
-        }},
-        {987, {
-            {.id = 986, .distance = 31.574f}, {.id = 988, .distance = 32.495f}, {.id = 965, .distance = 33.386f}, {.id = 1032, .distance = 34.006f}, {.id = 966, .distance = 35.446f}, {.id = 1031, .distance = 40.058f}, {.id = 1033, .distance = 48.765f}
-        }},
-        {988, {
-            {.id = 966, .distance = 29.653f}, {.id = 989, .distance = 31.761f}, {.id = 987, .distance = 32.495f}, {.id = 1033, .distance = 35.652f}, {.id = 1035, .distance = 35.973f}, {.id = 967, .distance = 42.498f}, {.id = 1032, .distance = 43.930f}
-        }},
-        {989, {
-            {.id = 1035, .distance = 24.656f}, {.id = 967, .distance = 28.776f}, {.id = 968, .distance = 31.442f}, {.id = 988, .distance = 31.761f}, {.id = 1037, .distance = 38.273f}, {.id = 990, .distance = 43.129f}, {.id = 966, .distance = 44.581f}
-        }},
-        {990, {
-            {.id = 1039, .distance = 22.863f}, {.id = 968, .distance = 23.617f}, {.id = 1037, .distance = 27.856f}, {.id = 1038, .distance = 35.561f}, {.id = 991, .distance = 37.917f}, {.id = 969, .distance = 41.895f}, {.id = 989, .distance = 43.129f}
-        }},
-        {991, {
-            {.id = 1039, .distance = 28.096f}, {.id = 992, .distance = 29.153f}, {.id = 1117, .distance = 29.303f}, {.id = 969, .distance = 36.068f}, {.id = 990, .distance = 37.917f}, {.id = 1116, .distance = 40.708f}, {.id = 1118, .distance = 41.405f}
-        }},
-        {992, {
-            {.id = 993, .distance = 28.265f}, {.id = 991, .distance = 29.153f}, {.id = 1116, .distance = 29.697f}, {.id = 970, .distance = 35.794f}, {.id = 969, .distance = 39.068f}, {.id = 1115, .distance = 40.854f}, {.id = 1117, .distance = 41.887f}
-        }},
-        {993, {
-            {.id = 992, .distance = 28.265f}, {.id = 995, .distance = 28.989f}, {.id = 1115, .distance = 29.349f}, {.id = 970, .distance = 36.665f}, {.id = 994, .distance = 38.712f}, {.id = 1114, .distance = 40.741f}, {.id = 1116, .distance = 41.218f}
-        }},
-        {994, {
-            {.id = 995, .distance = 23.607f}, {.id = 971, .distance = 24.191f}, {.id = 996, .distance = 27.455f}, {.id = 997, .distance = 35.536f}, {.id = 972, .distance = 36.051f}, {.id = 993, .distance = 38.712f}, {.id = 970, .distance = 46.412f}
-        }},
-        {995, {
-            {.id = 994, .distance = 23.607f}, {.id = 997, .distance = 28.500f}, {.id = 993, .distance = 28.989f}, {.id = 1114, .distance = 29.313f}, {.id = 996, .distance = 38.998f}, {.id = 1112, .distance = 40.245f}, {.id = 1115, .distance = 41.506f}
-        }},
-        {996, {
-            {.id = 997, .distance = 25.823f}, {.id = 998, .distance = 26.008f}, {.id = 999, .distance = 27.304f}, {.id = 994, .distance = 27.455f}, {.id = 972, .distance = 35.506f}, {.id = 995, .distance = 38.998f}, {.id = 1000, .distance = 39.242f}
-        }},
-        {997, {
-            {.id = 996, .distance = 25.823f}, {.id = 995, .distance = 28.500f}, {.id = 1112, .distance = 29.551f}, {.id = 998, .distance = 30.900f}, {.id = 994, .distance = 35.536f}, {.id = 1114, .distance = 41.458f}, {.id = 1234, .distance = 51.535f}
-        }},
-        {998, {
-            {.id = 996, .distance = 26.008f}, {.id = 1234, .distance = 28.579f}, {.id = 1000, .distance = 29.614f}, {.id = 997, .distance = 30.900f}, {.id = 999, .distance = 35.963f}, {.id = 1232, .distance = 40.017f}, {.id = 1236, .distance = 51.461f}
-        }},
-        {999, {
-            {.id = 1000, .distance = 23.404f}, {.id = 996, .distance = 27.304f}, {.id = 972, .distance = 27.519f}, {.id = 973, .distance = 31.347f}, {.id = 998, .distance = 35.963f}, {.id = 1001, .distance = 38.924f}, {.id = 994, .distance = 47.034f}
-        }},
-        {1000, {
-            {.id = 999, .distance = 23.404f}, {.id = 1001, .distance = 28.584f}, {.id = 1232, .distance = 28.635f}, {.id = 998, .distance = 29.614f}, {.id = 996, .distance = 39.242f}, {.id = 1231, .distance = 40.267f}, {.id = 1234, .distance = 41.723f}
-        }},
-        {1001, {
-            {.id = 1002, .distance = 28.069f}, {.id = 1231, .distance = 28.455f}, {.id = 1000, .distance = 28.584f}, {.id = 973, .distance = 37.393f}, {.id = 999, .distance = 38.924f}, {.id = 1230, .distance = 39.721f}, {.id = 1232, .distance = 41.281f}
-        }},
-        {1002, {
-            {.id = 1001, .distance = 28.069f}, {.id = 1230, .distance = 28.689f}, {.id = 1003, .distance = 28.840f}, {.id = 974, .distance = 33.115f}, {.id = 1229, .distance = 40.334f}, {.id = 1231, .distance = 40.347f}, {.id = 973, .distance = 48.228f}
-        }},
-        {1003, {
-            {.id = 1229, .distance = 28.729f}, {.id = 1002, .distance = 28.840f}, {.id = 1004, .distance = 29.098f}, {.id = 975, .distance = 37.153f}, {.id = 1005, .distance = 38.371f}, {.id = 1228, .distance = 40.200f}, {.id = 1230, .distance = 40.936f}
-        }},
-        {1004, {
-            {.id = 1005, .distance = 23.468f}, {.id = 1006, .distance = 28.067f}, {.id = 1228, .distance = 28.742f}, {.id = 1003, .distance = 29.098f}, {.id = 1007, .distance = 37.859f}, {.id = 1226, .distance = 39.796f}, {.id = 1229, .distance = 41.262f}
-        }},
-        {1005, {
-            {.id = 1004, .distance = 23.468f}, {.id = 1007, .distance = 26.995f}, {.id = 976, .distance = 27.373f}, {.id = 975, .distance = 30.540f}, {.id = 1006, .distance = 35.584f}, {.id = 1003, .distance = 38.371f}, {.id = 1009, .distance = 47.445f}
-        }},
-        {1006, {
-            {.id = 1007, .distance = 25.235f}, {.id = 1004, .distance = 28.067f}, {.id = 1226, .distance = 28.662f}, {.id = 1008, .distance = 31.314f}, {.id = 1005, .distance = 35.584f}, {.id = 1228, .distance = 40.849f}, {.id = 1224, .distance = 50.916f}
-        }},
-        {1007, {
-            {.id = 1006, .distance = 25.235f}, {.id = 1008, .distance = 25.959f}, {.id = 1005, .distance = 26.995f}, {.id = 1009, .distance = 28.280f}, {.id = 976, .distance = 35.618f}, {.id = 1004, .distance = 37.859f}, {.id = 1010, .distance = 39.348f}
-        }},
-        {1008, {
-            {.id = 1007, .distance = 25.959f}, {.id = 1010, .distance = 28.175f}, {.id = 893, .distance = 29.551f}, {.id = 1006, .distance = 31.314f}, {.id = 1009, .distance = 35.099f}, {.id = 891, .distance = 40.245f}, {.id = 1005, .distance = 52.245f}
-        }},
-        {1009, {
-            {.id = 1010, .distance = 22.858f}, {.id = 977, .distance = 24.293f}, {.id = 1007, .distance = 28.280f}, {.id = 1008, .distance = 35.099f}, {.id = 976, .distance = 36.566f}, {.id = 1011, .distance = 37.718f}, {.id = 1005, .distance = 47.445f}
-        }},
-        {1010, {
-            {.id = 1009, .distance = 22.858f}, {.id = 1008, .distance = 28.175f}, {.id = 1011, .distance = 28.665f}, {.id = 891, .distance = 29.313f}, {.id = 1007, .distance = 39.348f}, {.id = 889, .distance = 40.741f}, {.id = 893, .distance = 41.458f}
-        }},
-        {1011, {
-            {.id = 1010, .distance = 28.665f}, {.id = 1012, .distance = 28.744f}, {.id = 889, .distance = 29.349f}, {.id = 978, .distance = 37.333f}, {.id = 1009, .distance = 37.718f}, {.id = 888, .distance = 40.854f}, {.id = 891, .distance = 41.506f}
-        }},
-        {1012, {
-            {.id = 1013, .distance = 28.665f}, {.id = 1011, .distance = 28.744f}, {.id = 888, .distance = 29.697f}, {.id = 978, .distance = 35.922f}, {.id = 979, .distance = 39.243f}, {.id = 887, .distance = 40.708f}, {.id = 889, .distance = 41.218f}
-        }},
-        {1013, {
-            {.id = 1012, .distance = 28.665f}, {.id = 1014, .distance = 28.989f}, {.id = 887, .distance = 29.303f}, {.id = 979, .distance = 35.562f}, {.id = 1015, .distance = 37.946f}, {.id = 935, .distance = 40.502f}, {.id = 888, .distance = 41.887f}
-        }},
-        {1014, {
-            {.id = 1015, .distance = 22.522f}, {.id = 1016, .distance = 28.989f}, {.id = 1013, .distance = 28.989f}, {.id = 935, .distance = 29.448f}, {.id = 1017, .distance = 38.748f}, {.id = 934, .distance = 40.870f}, {.id = 887, .distance = 41.405f}
-        }},
-        {1015, {
-            {.id = 1014, .distance = 22.522f}, {.id = 980, .distance = 23.803f}, {.id = 1017, .distance = 27.573f}, {.id = 1016, .distance = 35.430f}, {.id = 1013, .distance = 37.946f}, {.id = 979, .distance = 41.982f}, {.id = 981, .distance = 43.096f}
-        }},
-        {1016, {
-            {.id = 1017, .distance = 25.732f}, {.id = 1014, .distance = 28.989f}, {.id = 934, .distance = 29.475f}, {.id = 1018, .distance = 30.699f}, {.id = 1015, .distance = 35.430f}, {.id = 935, .distance = 42.128f}, {.id = 288, .distance = 49.900f}
-        }},
-        {1017, {
-            {.id = 1018, .distance = 25.715f}, {.id = 1016, .distance = 25.732f}, {.id = 1019, .distance = 27.009f}, {.id = 1015, .distance = 27.573f}, {.id = 981, .distance = 38.124f}, {.id = 1014, .distance = 38.748f}, {.id = 1020, .distance = 38.795f}
-        }},
-        {1018, {
-            {.id = 1017, .distance = 25.715f}, {.id = 288, .distance = 27.473f}, {.id = 1020, .distance = 28.587f}, {.id = 1016, .distance = 30.699f}, {.id = 1019, .distance = 35.180f}, {.id = 286, .distance = 39.435f}, {.id = 290, .distance = 50.891f}
-        }},
-        {1019, {
-            {.id = 1020, .distance = 23.318f}, {.id = 981, .distance = 24.410f}, {.id = 1017, .distance = 27.009f}, {.id = 1018, .distance = 35.180f}, {.id = 982, .distance = 36.927f}, {.id = 1021, .distance = 38.625f}, {.id = 1015, .distance = 47.229f}
-        }},
-        {1020, {
-            {.id = 1019, .distance = 23.318f}, {.id = 286, .distance = 27.583f}, {.id = 1018, .distance = 28.587f}, {.id = 1021, .distance = 28.648f}, {.id = 1017, .distance = 38.795f}, {.id = 285, .distance = 39.805f}, {.id = 288, .distance = 40.223f}
-        }},
-        {1021, {
-            {.id = 285, .distance = 27.628f}, {.id = 1020, .distance = 28.648f}, {.id = 1022, .distance = 28.678f}, {.id = 982, .distance = 36.174f}, {.id = 1019, .distance = 38.625f}, {.id = 284, .distance = 39.752f}, {.id = 286, .distance = 40.007f}
-        }},
-        {1022, {
-            {.id = 284, .distance = 27.498f}, {.id = 1023, .distance = 28.019f}, {.id = 1021, .distance = 28.678f}, {.id = 983, .distance = 33.528f}, {.id = 285, .distance = 39.790f}, {.id = 283, .distance = 39.855f}, {.id = 982, .distance = 43.787f}
-        }},
-        {1023, {
-            {.id = 283, .distance = 27.613f}, {.id = 1022, .distance = 28.019f}, {.id = 1024, .distance = 29.666f}, {.id = 1025, .distance = 39.143f}, {.id = 284, .distance = 39.255f}, {.id = 983, .distance = 39.292f}, {.id = 282, .distance = 40.252f}
-        }},
-        {1024, {
-            {.id = 1025, .distance = 23.574f}, {.id = 282, .distance = 27.436f}, {.id = 1026, .distance = 28.796f}, {.id = 1023, .distance = 29.666f}, {.id = 1027, .distance = 38.536f}, {.id = 280, .distance = 39.154f}, {.id = 283, .distance = 39.947f}
-        }},
-        {1025, {
-            {.id = 1024, .distance = 23.574f}, {.id = 984, .distance = 26.800f}, {.id = 1027, .distance = 27.295f}, {.id = 985, .distance = 31.165f}, {.id = 1026, .distance = 35.726f}, {.id = 1023, .distance = 39.143f}, {.id = 1029, .distance = 46.866f}
-        }},
-        {1026, {
-            {.id = 1027, .distance = 25.236f}, {.id = 280, .distance = 27.690f}, {.id = 1024, .distance = 28.796f}, {.id = 1028, .distance = 30.642f}, {.id = 1025, .distance = 35.726f}, {.id = 282, .distance = 40.114f}, {.id = 278, .distance = 50.621f}
-        }},
-        {1027, {
-            {.id = 1026, .distance = 25.236f}, {.id = 1028, .distance = 25.701f}, {.id = 1025, .distance = 27.295f}, {.id = 1029, .distance = 27.601f}, {.id = 985, .distance = 35.484f}, {.id = 1030, .distance = 38.536f}, {.id = 1024, .distance = 38.536f}
-        }},
-        {1028, {
-            {.id = 1027, .distance = 25.701f}, {.id = 1030, .distance = 28.171f}, {.id = 402, .distance = 28.551f}, {.id = 1026, .distance = 30.642f}, {.id = 1029, .distance = 35.416f}, {.id = 400, .distance = 41.429f}, {.id = 404, .distance = 50.454f}
-        }},
-        {1029, {
-            {.id = 1030, .distance = 23.046f}, {.id = 986, .distance = 26.974f}, {.id = 1027, .distance = 27.601f}, {.id = 985, .distance = 32.025f}, {.id = 1028, .distance = 35.416f}, {.id = 1031, .distance = 38.124f}, {.id = 1025, .distance = 46.866f}
-        }},
-        {1030, {
-            {.id = 1029, .distance = 23.046f}, {.id = 1028, .distance = 28.171f}, {.id = 400, .distance = 28.586f}, {.id = 1031, .distance = 28.796f}, {.id = 1027, .distance = 38.536f}, {.id = 402, .distance = 39.222f}, {.id = 399, .distance = 42.712f}
-        }},
-        {1031, {
-            {.id = 399, .distance = 28.538f}, {.id = 1032, .distance = 28.739f}, {.id = 1030, .distance = 28.796f}, {.id = 1029, .distance = 38.124f}, {.id = 400, .distance = 38.933f}, {.id = 987, .distance = 40.058f}, {.id = 986, .distance = 40.759f}
-        }},
-        {1032, {
-            {.id = 398, .distance = 28.593f}, {.id = 1031, .distance = 28.739f}, {.id = 1033, .distance = 28.996f}, {.id = 987, .distance = 34.006f}, {.id = 399, .distance = 38.440f}, {.id = 397, .distance = 42.065f}, {.id = 988, .distance = 43.930f}
-        }},
-        {1033, {
-            {.id = 1034, .distance = 28.539f}, {.id = 397, .distance = 28.720f}, {.id = 1032, .distance = 28.996f}, {.id = 988, .distance = 35.652f}, {.id = 1035, .distance = 38.072f}, {.id = 398, .distance = 39.193f}, {.id = 396, .distance = 41.888f}
-        }},
-        {1034, {
-            {.id = 1035, .distance = 23.229f}, {.id = 396, .distance = 28.526f}, {.id = 1033, .distance = 28.539f}, {.id = 1036, .distance = 29.175f}, {.id = 1037, .distance = 38.795f}, {.id = 397, .distance = 38.975f}, {.id = 394, .distance = 41.739f}
-        }},
-        {1035, {
-            {.id = 1034, .distance = 23.229f}, {.id = 989, .distance = 24.656f}, {.id = 1037, .distance = 27.373f}, {.id = 988, .distance = 35.973f}, {.id = 1036, .distance = 36.131f}, {.id = 1033, .distance = 38.072f}, {.id = 990, .distance = 47.750f}
-        }},
-        {1036, {
-            {.id = 1037, .distance = 26.133f}, {.id = 394, .distance = 27.990f}, {.id = 1034, .distance = 29.175f}, {.id = 1038, .distance = 30.723f}, {.id = 1035, .distance = 36.131f}, {.id = 396, .distance = 39.023f}, {.id = 392, .distance = 51.341f}
-        }},
-        {1037, {
-            {.id = 1038, .distance = 25.813f}, {.id = 1036, .distance = 26.133f}, {.id = 1035, .distance = 27.373f}, {.id = 990, .distance = 27.856f}, {.id = 989, .distance = 38.273f}, {.id = 1034, .distance = 38.795f}, {.id = 1039, .distance = 39.458f}
-        }},
-        {1038, {
-            {.id = 1037, .distance = 25.813f}, {.id = 1120, .distance = 29.475f}, {.id = 1039, .distance = 29.479f}, {.id = 1036, .distance = 30.723f}, {.id = 990, .distance = 35.561f}, {.id = 1118, .distance = 40.870f}, {.id = 394, .distance = 50.403f}
-        }},
-        {1039, {
-            {.id = 990, .distance = 22.863f}, {.id = 991, .distance = 28.096f}, {.id = 1118, .distance = 29.448f}, {.id = 1038, .distance = 29.479f}, {.id = 1037, .distance = 39.458f}, {.id = 1117, .distance = 40.502f}, {.id = 1120, .distance = 42.128f}
-        }},
-        {1040, {
-            {.id = 1041, .distance = 25.256f}, {.id = 1043, .distance = 25.653f}, {.id = 1042, .distance = 25.660f}, {.id = 1045, .distance = 26.237f}, {.id = 1044, .distance = 26.780f}, {.id = 1047, .distance = 53.251f}, {.id = 1051, .distance = 53.584f}
-        }},
-        {1041, {
-            {.id = 1040, .distance = 25.256f}, {.id = 1047, .distance = 27.996f}, {.id = 1045, .distance = 30.406f}, {.id = 1042, .distance = 30.746f}, {.id = 1048, .distance = 36.902f}, {.id = 1046, .distance = 36.902f}, {.id = 1043, .distance = 48.670f}
-        }},
-        {1042, {
-            {.id = 1040, .distance = 25.660f}, {.id = 1049, .distance = 28.138f}, {.id = 1043, .distance = 30.016f}, {.id = 1041, .distance = 30.746f}, {.id = 1050, .distance = 35.779f}, {.id = 1048, .distance = 37.730f}, {.id = 1044, .distance = 49.623f}
-        }},
-        {1043, {
-            {.id = 1040, .distance = 25.653f}, {.id = 1051, .distance = 27.950f}, {.id = 1042, .distance = 30.016f}, {.id = 1044, .distance = 30.334f}, {.id = 1052, .distance = 36.663f}, {.id = 1050, .distance = 36.917f}, {.id = 1041, .distance = 48.670f}
-        }},
-        {1044, {
-            {.id = 1040, .distance = 26.780f}, {.id = 1053, .distance = 28.148f}, {.id = 1043, .distance = 30.334f}, {.id = 1045, .distance = 30.829f}, {.id = 1052, .distance = 36.041f}, {.id = 1054, .distance = 36.581f}, {.id = 1041, .distance = 49.415f}
-        }},
-        {1045, {
-            {.id = 1040, .distance = 26.237f}, {.id = 1055, .distance = 28.784f}, {.id = 1041, .distance = 30.406f}, {.id = 1044, .distance = 30.829f}, {.id = 1046, .distance = 36.136f}, {.id = 1054, .distance = 36.663f}, {.id = 1043, .distance = 49.028f}
-        }},
-        {1046, {
-            {.id = 1057, .distance = 29.943f}, {.id = 1055, .distance = 32.709f}, {.id = 1047, .distance = 33.241f}, {.id = 1056, .distance = 35.999f}, {.id = 1045, .distance = 36.136f}, {.id = 1041, .distance = 36.902f}, {.id = 1058, .distance = 43.146f}
-        }},
-        {1047, {
-            {.id = 1041, .distance = 27.996f}, {.id = 1058, .distance = 31.091f}, {.id = 1046, .distance = 33.241f}, {.id = 1048, .distance = 33.489f}, {.id = 1059, .distance = 33.997f}, {.id = 1057, .distance = 46.465f}, {.id = 1060, .distance = 50.872f}
-        }},
-        {1048, {
-            {.id = 1060, .distance = 28.795f}, {.id = 1047, .distance = 33.489f}, {.id = 1049, .distance = 34.526f}, {.id = 1041, .distance = 36.902f}, {.id = 1042, .distance = 37.730f}, {.id = 1059, .distance = 39.001f}, {.id = 1061, .distance = 39.043f}
-        }},
-        {1049, {
-            {.id = 1042, .distance = 28.138f}, {.id = 1062, .distance = 30.119f}, {.id = 1050, .distance = 32.862f}, {.id = 1061, .distance = 33.326f}, {.id = 1048, .distance = 34.526f}, {.id = 1063, .distance = 46.032f}, {.id = 1060, .distance = 51.953f}
-        }},
-        {1050, {
-            {.id = 1063, .distance = 29.271f}, {.id = 1049, .distance = 32.862f}, {.id = 1051, .distance = 32.910f}, {.id = 1064, .distance = 35.475f}, {.id = 1042, .distance = 35.779f}, {.id = 1043, .distance = 36.917f}, {.id = 1062, .distance = 42.036f}
-        }},
-        {1051, {
-            {.id = 1043, .distance = 27.950f}, {.id = 1065, .distance = 30.515f}, {.id = 1050, .distance = 32.910f}, {.id = 1052, .distance = 34.288f}, {.id = 1064, .distance = 35.680f}, {.id = 1066, .distance = 43.747f}, {.id = 1042, .distance = 50.881f}
-        }},
-        {1052, {
-            {.id = 1066, .distance = 30.713f}, {.id = 1067, .distance = 32.961f}, {.id = 1051, .distance = 34.288f}, {.id = 1053, .distance = 34.333f}, {.id = 1044, .distance = 36.041f}, {.id = 1043, .distance = 36.663f}, {.id = 1065, .distance = 47.436f}
-        }},
-        {1053, {
-            {.id = 1044, .distance = 28.148f}, {.id = 1068, .distance = 28.795f}, {.id = 1054, .distance = 32.474f}, {.id = 1052, .distance = 34.333f}, {.id = 1069, .distance = 37.853f}, {.id = 1067, .distance = 39.529f}, {.id = 1045, .distance = 52.029f}
-        }},
-        {1054, {
-            {.id = 1070, .distance = 30.978f}, {.id = 1053, .distance = 32.474f}, {.id = 1069, .distance = 33.378f}, {.id = 1055, .distance = 34.135f}, {.id = 1044, .distance = 36.581f}, {.id = 1045, .distance = 36.663f}, {.id = 1071, .distance = 47.075f}
-        }},
-        {1055, {
-            {.id = 1045, .distance = 28.784f}, {.id = 1071, .distance = 29.314f}, {.id = 1046, .distance = 32.709f}, {.id = 1054, .distance = 34.135f}, {.id = 1056, .distance = 35.428f}, {.id = 1070, .distance = 42.934f}, {.id = 1041, .distance = 52.730f}
-        }},
-        {1056, {
-            {.id = 1073, .distance = 31.937f}, {.id = 1072, .distance = 31.964f}, {.id = 1071, .distance = 32.088f}, {.id = 1057, .distance = 32.704f}, {.id = 1055, .distance = 35.428f}, {.id = 1046, .distance = 35.999f}, {.id = 1093, .distance = 49.921f}
-        }},
-        {1057, {
-            {.id = 1074, .distance = 29.419f}, {.id = 1046, .distance = 29.943f}, {.id = 1058, .distance = 32.468f}, {.id = 1056, .distance = 32.704f}, {.id = 1073, .distance = 37.491f}, {.id = 1075, .distance = 41.947f}, {.id = 1047, .distance = 46.465f}
-        }},
-        {1058, {
-            {.id = 1075, .distance = 29.848f}, {.id = 1047, .distance = 31.091f}, {.id = 1059, .distance = 31.917f}, {.id = 1057, .distance = 32.468f}, {.id = 1076, .distance = 35.426f}, {.id = 1046, .distance = 43.146f}, {.id = 1074, .distance = 44.568f}
-        }},
-        {1059, {
-            {.id = 1077, .distance = 30.775f}, {.id = 1058, .distance = 31.917f}, {.id = 1060, .distance = 32.089f}, {.id = 1076, .distance = 33.457f}, {.id = 1047, .distance = 33.997f}, {.id = 1048, .distance = 39.001f}, {.id = 1078, .distance = 47.195f}
-        }},
-        {1060, {
-            {.id = 1078, .distance = 28.126f}, {.id = 1048, .distance = 28.795f}, {.id = 1059, .distance = 32.089f}, {.id = 1061, .distance = 33.350f}, {.id = 1077, .distance = 38.606f}, {.id = 1079, .distance = 40.686f}, {.id = 1047, .distance = 50.872f}
-        }},
-        {1061, {
-            {.id = 1079, .distance = 30.745f}, {.id = 1062, .distance = 32.585f}, {.id = 1049, .distance = 33.326f}, {.id = 1060, .distance = 33.350f}, {.id = 1080, .distance = 33.990f}, {.id = 1048, .distance = 39.043f}, {.id = 1078, .distance = 47.230f}
-        }},
-        {1062, {
-            {.id = 1081, .distance = 30.088f}, {.id = 1049, .distance = 30.119f}, {.id = 1063, .distance = 32.298f}, {.id = 1061, .distance = 32.585f}, {.id = 1080, .distance = 35.628f}, {.id = 1050, .distance = 42.036f}, {.id = 1082, .distance = 44.864f}
-        }},
-        {1063, {
-            {.id = 1082, .distance = 28.726f}, {.id = 1050, .distance = 29.271f}, {.id = 1064, .distance = 31.916f}, {.id = 1062, .distance = 32.298f}, {.id = 1083, .distance = 37.444f}, {.id = 1081, .distance = 42.067f}, {.id = 1049, .distance = 46.032f}
-        }},
-        {1064, {
-            {.id = 1083, .distance = 31.889f}, {.id = 1063, .distance = 31.916f}, {.id = 1084, .distance = 32.458f}, {.id = 1065, .distance = 32.605f}, {.id = 1050, .distance = 35.475f}, {.id = 1051, .distance = 35.680f}, {.id = 1082, .distance = 49.358f}
-        }},
-        {1065, {
-            {.id = 1085, .distance = 28.557f}, {.id = 1051, .distance = 30.515f}, {.id = 1064, .distance = 32.605f}, {.id = 1066, .distance = 33.386f}, {.id = 1084, .distance = 36.707f}, {.id = 1086, .distance = 42.276f}, {.id = 1052, .distance = 47.436f}
-        }},
-        {1066, {
-            {.id = 1086, .distance = 29.283f}, {.id = 1052, .distance = 30.713f}, {.id = 1067, .distance = 32.395f}, {.id = 1065, .distance = 33.386f}, {.id = 1087, .distance = 35.383f}, {.id = 1051, .distance = 43.747f}, {.id = 1085, .distance = 45.069f}
-        }},
-        {1067, {
-            {.id = 1088, .distance = 30.492f}, {.id = 1066, .distance = 32.395f}, {.id = 1068, .distance = 32.492f}, {.id = 1052, .distance = 32.961f}, {.id = 1087, .distance = 33.774f}, {.id = 1053, .distance = 39.529f}, {.id = 1089, .distance = 46.947f}
-        }},
-        {1068, {
-            {.id = 1053, .distance = 28.795f}, {.id = 1089, .distance = 28.796f}, {.id = 1069, .distance = 31.301f}, {.id = 1067, .distance = 32.492f}, {.id = 1090, .distance = 39.130f}, {.id = 1088, .distance = 39.658f}, {.id = 1054, .distance = 50.236f}
-        }},
-        {1069, {
-            {.id = 1090, .distance = 30.076f}, {.id = 1068, .distance = 31.301f}, {.id = 1070, .distance = 33.324f}, {.id = 1054, .distance = 33.378f}, {.id = 1091, .distance = 33.386f}, {.id = 1053, .distance = 37.853f}, {.id = 1089, .distance = 46.778f}
-        }},
-        {1070, {
-            {.id = 1092, .distance = 29.653f}, {.id = 1054, .distance = 30.978f}, {.id = 1071, .distance = 32.852f}, {.id = 1069, .distance = 33.324f}, {.id = 1091, .distance = 35.446f}, {.id = 1055, .distance = 42.934f}, {.id = 1093, .distance = 44.581f}
-        }},
-        {1071, {
-            {.id = 1093, .distance = 28.776f}, {.id = 1055, .distance = 29.314f}, {.id = 1056, .distance = 32.088f}, {.id = 1070, .distance = 32.852f}, {.id = 1072, .distance = 36.954f}, {.id = 1092, .distance = 42.498f}, {.id = 1054, .distance = 47.075f}
-        }},
-        {1072, {
-            {.id = 1094, .distance = 23.617f}, {.id = 1093, .distance = 31.442f}, {.id = 1056, .distance = 31.964f}, {.id = 1073, .distance = 32.703f}, {.id = 1071, .distance = 36.954f}, {.id = 1141, .distance = 41.259f}, {.id = 1143, .distance = 45.103f}
-        }},
-        {1073, {
-            {.id = 1056, .distance = 31.937f}, {.id = 1072, .distance = 32.703f}, {.id = 1074, .distance = 32.725f}, {.id = 1095, .distance = 36.068f}, {.id = 1057, .distance = 37.491f}, {.id = 1096, .distance = 39.068f}, {.id = 1094, .distance = 41.895f}
-        }},
-        {1074, {
-            {.id = 1057, .distance = 29.419f}, {.id = 1075, .distance = 30.638f}, {.id = 1073, .distance = 32.725f}, {.id = 1096, .distance = 35.794f}, {.id = 1097, .distance = 36.665f}, {.id = 1058, .distance = 44.568f}, {.id = 1098, .distance = 46.412f}
-        }},
-        {1075, {
-            {.id = 1098, .distance = 24.191f}, {.id = 1058, .distance = 29.848f}, {.id = 1074, .distance = 30.638f}, {.id = 1076, .distance = 31.516f}, {.id = 1057, .distance = 41.947f}, {.id = 1099, .distance = 44.167f}, {.id = 1097, .distance = 44.460f}
-        }},
-        {1076, {
-            {.id = 1103, .distance = 27.519f}, {.id = 1075, .distance = 31.516f}, {.id = 1077, .distance = 33.096f}, {.id = 1059, .distance = 33.457f}, {.id = 1058, .distance = 35.426f}, {.id = 1100, .distance = 35.506f}, {.id = 1098, .distance = 36.051f}
-        }},
-        {1077, {
-            {.id = 1059, .distance = 30.775f}, {.id = 1078, .distance = 30.943f}, {.id = 1103, .distance = 31.347f}, {.id = 1076, .distance = 33.096f}, {.id = 1105, .distance = 37.393f}, {.id = 1060, .distance = 38.606f}, {.id = 1104, .distance = 45.102f}
-        }},
-        {1078, {
-            {.id = 1060, .distance = 28.126f}, {.id = 1077, .distance = 30.943f}, {.id = 1079, .distance = 32.322f}, {.id = 1106, .distance = 33.115f}, {.id = 1105, .distance = 43.474f}, {.id = 1107, .distance = 44.048f}, {.id = 1059, .distance = 47.195f}
-        }},
-        {1079, {
-            {.id = 1109, .distance = 30.540f}, {.id = 1061, .distance = 30.745f}, {.id = 1078, .distance = 32.322f}, {.id = 1080, .distance = 32.441f}, {.id = 1107, .distance = 37.153f}, {.id = 1060, .distance = 40.686f}, {.id = 1108, .distance = 45.279f}
-        }},
-        {1080, {
-            {.id = 1109, .distance = 27.373f}, {.id = 1081, .distance = 31.563f}, {.id = 1079, .distance = 32.441f}, {.id = 1061, .distance = 33.990f}, {.id = 1111, .distance = 35.618f}, {.id = 1062, .distance = 35.628f}, {.id = 1113, .distance = 36.566f}
-        }},
-        {1081, {
-            {.id = 1113, .distance = 24.293f}, {.id = 1062, .distance = 30.088f}, {.id = 1080, .distance = 31.563f}, {.id = 1082, .distance = 31.793f}, {.id = 1063, .distance = 42.067f}, {.id = 1114, .distance = 43.775f}, {.id = 1115, .distance = 43.787f}
-        }},
-        {1082, {
-            {.id = 1063, .distance = 28.726f}, {.id = 1083, .distance = 31.427f}, {.id = 1081, .distance = 31.793f}, {.id = 1116, .distance = 35.922f}, {.id = 1115, .distance = 37.333f}, {.id = 1062, .distance = 44.864f}, {.id = 1113, .distance = 47.704f}
-        }},
-        {1083, {
-            {.id = 1082, .distance = 31.427f}, {.id = 1064, .distance = 31.889f}, {.id = 1084, .distance = 32.342f}, {.id = 1117, .distance = 35.562f}, {.id = 1063, .distance = 37.444f}, {.id = 1116, .distance = 39.243f}, {.id = 1119, .distance = 41.982f}
-        }},
-        {1084, {
-            {.id = 1119, .distance = 23.803f}, {.id = 1085, .distance = 31.693f}, {.id = 1083, .distance = 32.342f}, {.id = 1064, .distance = 32.458f}, {.id = 1065, .distance = 36.707f}, {.id = 1121, .distance = 41.333f}, {.id = 1118, .distance = 44.974f}
-        }},
-        {1085, {
-            {.id = 1123, .distance = 24.410f}, {.id = 1065, .distance = 28.557f}, {.id = 1084, .distance = 31.693f}, {.id = 1086, .distance = 32.138f}, {.id = 1121, .distance = 38.124f}, {.id = 1119, .distance = 43.096f}, {.id = 1066, .distance = 45.069f}
-        }},
-        {1086, {
-            {.id = 1066, .distance = 29.283f}, {.id = 1087, .distance = 31.589f}, {.id = 1085, .distance = 32.138f}, {.id = 1125, .distance = 36.174f}, {.id = 1123, .distance = 36.927f}, {.id = 1065, .distance = 42.276f}, {.id = 1126, .distance = 43.787f}
-        }},
-        {1087, {
-            {.id = 1086, .distance = 31.589f}, {.id = 1088, .distance = 32.185f}, {.id = 1126, .distance = 33.528f}, {.id = 1067, .distance = 33.774f}, {.id = 1066, .distance = 35.383f}, {.id = 1127, .distance = 39.292f}, {.id = 1125, .distance = 48.151f}
-        }},
-        {1088, {
-            {.id = 1129, .distance = 26.800f}, {.id = 1067, .distance = 30.492f}, {.id = 1089, .distance = 31.085f}, {.id = 1087, .distance = 32.185f}, {.id = 1068, .distance = 39.658f}, {.id = 1127, .distance = 40.843f}, {.id = 1128, .distance = 44.297f}
-        }},
-        {1089, {
-            {.id = 1068, .distance = 28.796f}, {.id = 1088, .distance = 31.085f}, {.id = 1129, .distance = 31.165f}, {.id = 1090, .distance = 31.748f}, {.id = 1133, .distance = 32.025f}, {.id = 1131, .distance = 35.484f}, {.id = 1069, .distance = 46.778f}
-        }},
-        {1090, {
-            {.id = 1133, .distance = 26.974f}, {.id = 1069, .distance = 30.076f}, {.id = 1091, .distance = 31.574f}, {.id = 1089, .distance = 31.748f}, {.id = 1068, .distance = 39.130f}, {.id = 1135, .distance = 40.759f}, {.id = 1134, .distance = 44.255f}
-        }},
-        {1091, {
-            {.id = 1090, .distance = 31.574f}, {.id = 1092, .distance = 32.495f}, {.id = 1069, .distance = 33.386f}, {.id = 1136, .distance = 34.006f}, {.id = 1070, .distance = 35.446f}, {.id = 1135, .distance = 40.058f}, {.id = 1137, .distance = 48.765f}
-        }},
-        {1092, {
-            {.id = 1070, .distance = 29.653f}, {.id = 1093, .distance = 31.761f}, {.id = 1091, .distance = 32.495f}, {.id = 1137, .distance = 35.652f}, {.id = 1139, .distance = 35.973f}, {.id = 1071, .distance = 42.498f}, {.id = 1136, .distance = 43.930f}
-        }},
-        {1093, {
-            {.id = 1139, .distance = 24.656f}, {.id = 1071, .distance = 28.776f}, {.id = 1072, .distance = 31.442f}, {.id = 1092, .distance = 31.761f}, {.id = 1141, .distance = 38.273f}, {.id = 1094, .distance = 43.129f}, {.id = 1070, .distance = 44.581f}
-        }},
-        {1094, {
-            {.id = 1143, .distance = 22.863f}, {.id = 1072, .distance = 23.617f}, {.id = 1141, .distance = 27.856f}, {.id = 1142, .distance = 35.561f}, {.id = 1095, .distance = 37.917f}, {.id = 1073, .distance = 41.895f}, {.id = 1093, .distance = 43.129f}
-        }},
-        {1095, {
-            {.id = 1143, .distance = 28.096f}, {.id = 1096, .distance = 29.153f}, {.id = 701, .distance = 29.303f}, {.id = 1073, .distance = 36.068f}, {.id = 1094, .distance = 37.917f}, {.id = 700, .distance = 40.708f}, {.id = 702, .distance = 41.405f}
-        }},
-        {1096, {
-            {.id = 1097, .distance = 28.265f}, {.id = 1095, .distance = 29.153f}, {.id = 700, .distance = 29.697f}, {.id = 1074, .distance = 35.794f}, {.id = 1073, .distance = 39.068f}, {.id = 699, .distance = 40.854f}, {.id = 701, .distance = 41.887f}
-        }},
-        {1097, {
-            {.id = 1096, .distance = 28.265f}, {.id = 1099, .distance = 28.989f}, {.id = 699, .distance = 29.349f}, {.id = 1074, .distance = 36.665f}, {.id = 1098, .distance = 38.712f}, {.id = 698, .distance = 40.741f}, {.id = 700, .distance = 41.218f}
-        }},
-        {1098, {
-            {.id = 1099, .distance = 23.607f}, {.id = 1075, .distance = 24.191f}, {.id = 1100, .distance = 27.455f}, {.id = 1101, .distance = 35.536f}, {.id = 1076, .distance = 36.051f}, {.id = 1097, .distance = 38.712f}, {.id = 1074, .distance = 46.412f}
-        }},
-        {1099, {
-            {.id = 1098, .distance = 23.607f}, {.id = 1101, .distance = 28.500f}, {.id = 1097, .distance = 28.989f}, {.id = 698, .distance = 29.313f}, {.id = 1100, .distance = 38.998f}, {.id = 696, .distance = 40.245f}, {.id = 699, .distance = 41.506f}
-        }},
-        {1100, {
-            {.id = 1101, .distance = 25.823f}, {.id = 1102, .distance = 26.007f}, {.id = 1103, .distance = 27.304f}, {.id = 1098, .distance = 27.455f}, {.id = 1076, .distance = 35.506f}, {.id = 1099, .distance = 38.998f}, {.id = 1104, .distance = 39.242f}
-        }},
-        {1101, {
-            {.id = 1100, .distance = 25.823f}, {.id = 1099, .distance = 28.500f}, {.id = 696, .distance = 29.551f}, {.id = 1102, .distance = 30.900f}, {.id = 1098, .distance = 35.536f}, {.id = 698, .distance = 41.458f}, {.id = 694, .distance = 51.969f}
-        }},
-        {1102, {
-            {.id = 1100, .distance = 26.007f}, {.id = 1244, .distance = 29.050f}, {.id = 1104, .distance = 29.614f}, {.id = 1101, .distance = 30.900f}, {.id = 1103, .distance = 35.963f}, {.id = 1242, .distance = 41.538f}, {.id = 1246, .distance = 51.839f}
-        }},
-        {1103, {
-            {.id = 1104, .distance = 23.404f}, {.id = 1100, .distance = 27.304f}, {.id = 1076, .distance = 27.519f}, {.id = 1077, .distance = 31.347f}, {.id = 1102, .distance = 35.963f}, {.id = 1105, .distance = 38.924f}, {.id = 1098, .distance = 47.034f}
-        }},
-        {1104, {
-            {.id = 1103, .distance = 23.404f}, {.id = 1105, .distance = 28.584f}, {.id = 1102, .distance = 29.614f}, {.id = 1242, .distance = 29.699f}, {.id = 1100, .distance = 39.242f}, {.id = 1241, .distance = 41.093f}, {.id = 1244, .distance = 41.569f}
-        }},
-        {1105, {
-            {.id = 1106, .distance = 28.069f}, {.id = 1104, .distance = 28.584f}, {.id = 1241, .distance = 29.681f}, {.id = 1077, .distance = 37.393f}, {.id = 1103, .distance = 38.924f}, {.id = 1240, .distance = 41.139f}, {.id = 1242, .distance = 41.301f}
-        }},
-        {1106, {
-            {.id = 1105, .distance = 28.069f}, {.id = 1107, .distance = 28.840f}, {.id = 1240, .distance = 29.791f}, {.id = 1078, .distance = 33.115f}, {.id = 1241, .distance = 41.276f}, {.id = 1239, .distance = 41.688f}, {.id = 1077, .distance = 48.228f}
-        }},
-        {1107, {
-            {.id = 1106, .distance = 28.840f}, {.id = 1108, .distance = 29.098f}, {.id = 1239, .distance = 29.681f}, {.id = 1079, .distance = 37.153f}, {.id = 1109, .distance = 38.371f}, {.id = 1240, .distance = 41.088f}, {.id = 1238, .distance = 41.797f}
-        }},
-        {1108, {
-            {.id = 1109, .distance = 23.468f}, {.id = 1110, .distance = 28.067f}, {.id = 1107, .distance = 29.098f}, {.id = 1238, .distance = 29.876f}, {.id = 1111, .distance = 37.859f}, {.id = 1236, .distance = 41.018f}, {.id = 1239, .distance = 41.259f}
-        }},
-        {1109, {
-            {.id = 1108, .distance = 23.468f}, {.id = 1111, .distance = 26.995f}, {.id = 1080, .distance = 27.373f}, {.id = 1079, .distance = 30.540f}, {.id = 1110, .distance = 35.584f}, {.id = 1107, .distance = 38.371f}, {.id = 1113, .distance = 47.445f}
-        }},
-        {1110, {
-            {.id = 1111, .distance = 25.235f}, {.id = 1108, .distance = 28.067f}, {.id = 1236, .distance = 29.688f}, {.id = 1112, .distance = 31.314f}, {.id = 1109, .distance = 35.584f}, {.id = 1238, .distance = 40.900f}, {.id = 997, .distance = 51.969f}
-        }},
-        {1111, {
-            {.id = 1110, .distance = 25.235f}, {.id = 1112, .distance = 25.959f}, {.id = 1109, .distance = 26.995f}, {.id = 1113, .distance = 28.280f}, {.id = 1080, .distance = 35.618f}, {.id = 1108, .distance = 37.859f}, {.id = 1114, .distance = 39.348f}
-        }},
-        {1112, {
-            {.id = 1111, .distance = 25.959f}, {.id = 1114, .distance = 28.175f}, {.id = 997, .distance = 29.551f}, {.id = 1110, .distance = 31.314f}, {.id = 1113, .distance = 35.099f}, {.id = 995, .distance = 40.245f}, {.id = 1109, .distance = 52.245f}
-        }},
-        {1113, {
-            {.id = 1114, .distance = 22.858f}, {.id = 1081, .distance = 24.293f}, {.id = 1111, .distance = 28.280f}, {.id = 1112, .distance = 35.099f}, {.id = 1080, .distance = 36.566f}, {.id = 1115, .distance = 37.718f}, {.id = 1109, .distance = 47.445f}
-        }},
-        {1114, {
-            {.id = 1113, .distance = 22.858f}, {.id = 1112, .distance = 28.175f}, {.id = 1115, .distance = 28.665f}, {.id = 995, .distance = 29.313f}, {.id = 1111, .distance = 39.348f}, {.id = 993, .distance = 40.741f}, {.id = 997, .distance = 41.458f}
-        }},
-        {1115, {
-            {.id = 1114, .distance = 28.665f}, {.id = 1116, .distance = 28.744f}, {.id = 993, .distance = 29.349f}, {.id = 1082, .distance = 37.333f}, {.id = 1113, .distance = 37.718f}, {.id = 992, .distance = 40.854f}, {.id = 995, .distance = 41.506f}
-        }},
-        {1116, {
-            {.id = 1117, .distance = 28.665f}, {.id = 1115, .distance = 28.744f}, {.id = 992, .distance = 29.697f}, {.id = 1082, .distance = 35.922f}, {.id = 1083, .distance = 39.243f}, {.id = 991, .distance = 40.708f}, {.id = 993, .distance = 41.218f}
-        }},
-        {1117, {
-            {.id = 1116, .distance = 28.665f}, {.id = 1118, .distance = 28.989f}, {.id = 991, .distance = 29.303f}, {.id = 1083, .distance = 35.562f}, {.id = 1119, .distance = 37.946f}, {.id = 1039, .distance = 40.502f}, {.id = 992, .distance = 41.887f}
-        }},
-        {1118, {
-            {.id = 1119, .distance = 22.522f}, {.id = 1117, .distance = 28.989f}, {.id = 1120, .distance = 28.989f}, {.id = 1039, .distance = 29.448f}, {.id = 1121, .distance = 38.748f}, {.id = 1038, .distance = 40.870f}, {.id = 991, .distance = 41.405f}
-        }},
-        {1119, {
-            {.id = 1118, .distance = 22.522f}, {.id = 1084, .distance = 23.803f}, {.id = 1121, .distance = 27.573f}, {.id = 1120, .distance = 35.430f}, {.id = 1117, .distance = 37.946f}, {.id = 1083, .distance = 41.982f}, {.id = 1085, .distance = 43.096f}
-        }},
-        {1120, {
-            {.id = 1121, .distance = 25.732f}, {.id = 1118, .distance = 28.989f}, {.id = 1038, .distance = 29.475f}, {.id = 1122, .distance = 30.699f}, {.id = 1119, .distance = 35.430f}, {.id = 1039, .distance = 42.128f}, {.id = 392, .distance = 49.900f}
-        }},
-        {1121, {
-            {.id = 1122, .distance = 25.715f}, {.id = 1120, .distance = 25.732f}, {.id = 1123, .distance = 27.009f}, {.id = 1119, .distance = 27.573f}, {.id = 1085, .distance = 38.124f}, {.id = 1118, .distance = 38.748f}, {.id = 1124, .distance = 38.795f}
-        }},
-        {1122, {
-            {.id = 1121, .distance = 25.715f}, {.id = 392, .distance = 27.473f}, {.id = 1124, .distance = 28.587f}, {.id = 1120, .distance = 30.699f}, {.id = 1123, .distance = 35.180f}, {.id = 390, .distance = 39.435f}, {.id = 394, .distance = 50.891f}
-        }},
-        {1123, {
-            {.id = 1124, .distance = 23.318f}, {.id = 1085, .distance = 24.410f}, {.id = 1121, .distance = 27.009f}, {.id = 1122, .distance = 35.180f}, {.id = 1086, .distance = 36.927f}, {.id = 1125, .distance = 38.625f}, {.id = 1119, .distance = 47.229f}
-        }},
-        {1124, {
-            {.id = 1123, .distance = 23.318f}, {.id = 390, .distance = 27.583f}, {.id = 1122, .distance = 28.587f}, {.id = 1125, .distance = 28.648f}, {.id = 1121, .distance = 38.795f}, {.id = 389, .distance = 39.805f}, {.id = 392, .distance = 40.223f}
-        }},
-        {1125, {
-            {.id = 389, .distance = 27.628f}, {.id = 1124, .distance = 28.648f}, {.id = 1126, .distance = 28.678f}, {.id = 1086, .distance = 36.174f}, {.id = 1123, .distance = 38.625f}, {.id = 388, .distance = 39.752f}, {.id = 390, .distance = 40.007f}
-        }},
-        {1126, {
-            {.id = 388, .distance = 27.498f}, {.id = 1127, .distance = 28.019f}, {.id = 1125, .distance = 28.678f}, {.id = 1087, .distance = 33.528f}, {.id = 389, .distance = 39.790f}, {.id = 387, .distance = 39.855f}, {.id = 1086, .distance = 43.787f}
-        }},
-        {1127, {
-            {.id = 387, .distance = 27.613f}, {.id = 1126, .distance = 28.019f}, {.id = 1128, .distance = 29.666f}, {.id = 1129, .distance = 39.143f}, {.id = 388, .distance = 39.255f}, {.id = 1087, .distance = 39.292f}, {.id = 386, .distance = 40.252f}
-        }},
-        {1128, {
-            {.id = 1129, .distance = 23.574f}, {.id = 386, .distance = 27.436f}, {.id = 1130, .distance = 28.796f}, {.id = 1127, .distance = 29.666f}, {.id = 1131, .distance = 38.536f}, {.id = 384, .distance = 39.154f}, {.id = 387, .distance = 39.947f}
-        }},
-        {1129, {
-            {.id = 1128, .distance = 23.574f}, {.id = 1088, .distance = 26.800f}, {.id = 1131, .distance = 27.295f}, {.id = 1089, .distance = 31.165f}, {.id = 1130, .distance = 35.726f}, {.id = 1127, .distance = 39.143f}, {.id = 1133, .distance = 46.866f}
-        }},
-        {1130, {
-            {.id = 1131, .distance = 25.236f}, {.id = 384, .distance = 27.690f}, {.id = 1128, .distance = 28.796f}, {.id = 1132, .distance = 30.642f}, {.id = 1129, .distance = 35.726f}, {.id = 386, .distance = 40.114f}, {.id = 382, .distance = 50.621f}
-        }},
-        {1131, {
-            {.id = 1130, .distance = 25.236f}, {.id = 1132, .distance = 25.701f}, {.id = 1129, .distance = 27.295f}, {.id = 1133, .distance = 27.601f}, {.id = 1089, .distance = 35.484f}, {.id = 1128, .distance = 38.536f}, {.id = 1134, .distance = 38.536f}
-        }},
-        {1132, {
-            {.id = 1131, .distance = 25.701f}, {.id = 1134, .distance = 28.171f}, {.id = 506, .distance = 28.551f}, {.id = 1130, .distance = 30.642f}, {.id = 1133, .distance = 35.416f}, {.id = 504, .distance = 41.429f}, {.id = 508, .distance = 50.454f}
-        }},
-        {1133, {
-            {.id = 1134, .distance = 23.046f}, {.id = 1090, .distance = 26.974f}, {.id = 1131, .distance = 27.601f}, {.id = 1089, .distance = 32.025f}, {.id = 1132, .distance = 35.416f}, {.id = 1135, .distance = 38.124f}, {.id = 1129, .distance = 46.866f}
-        }},
-        {1134, {
-            {.id = 1133, .distance = 23.046f}, {.id = 1132, .distance = 28.171f}, {.id = 504, .distance = 28.586f}, {.id = 1135, .distance = 28.796f}, {.id = 1131, .distance = 38.536f}, {.id = 506, .distance = 39.222f}, {.id = 503, .distance = 42.712f}
-        }},
-        {1135, {
-            {.id = 503, .distance = 28.538f}, {.id = 1136, .distance = 28.739f}, {.id = 1134, .distance = 28.796f}, {.id = 1133, .distance = 38.124f}, {.id = 504, .distance = 38.933f}, {.id = 1091, .distance = 40.058f}, {.id = 1090, .distance = 40.759f}
-        }},
-        {1136, {
-            {.id = 502, .distance = 28.593f}, {.id = 1135, .distance = 28.739f}, {.id = 1137, .distance = 28.996f}, {.id = 1091, .distance = 34.006f}, {.id = 503, .distance = 38.440f}, {.id = 501, .distance = 42.065f}, {.id = 1092, .distance = 43.930f}
-        }},
-        {1137, {
-            {.id = 1138, .distance = 28.539f}, {.id = 501, .distance = 28.720f}, {.id = 1136, .distance = 28.996f}, {.id = 1092, .distance = 35.652f}, {.id = 1139, .distance = 38.072f}, {.id = 502, .distance = 39.193f}, {.id = 500, .distance = 41.888f}
-        }},
-        {1138, {
-            {.id = 1139, .distance = 23.229f}, {.id = 500, .distance = 28.526f}, {.id = 1137, .distance = 28.539f}, {.id = 1140, .distance = 29.175f}, {.id = 1141, .distance = 38.795f}, {.id = 501, .distance = 38.975f}, {.id = 498, .distance = 41.739f}
-        }},
-        {1139, {
-            {.id = 1138, .distance = 23.229f}, {.id = 1093, .distance = 24.656f}, {.id = 1141, .distance = 27.373f}, {.id = 1092, .distance = 35.973f}, {.id = 1140, .distance = 36.131f}, {.id = 1137, .distance = 38.072f}, {.id = 1094, .distance = 47.750f}
-        }},
-        {1140, {
-            {.id = 1141, .distance = 26.133f}, {.id = 498, .distance = 27.990f}, {.id = 1138, .distance = 29.175f}, {.id = 1142, .distance = 30.723f}, {.id = 1139, .distance = 36.131f}, {.id = 500, .distance = 39.023f}, {.id = 496, .distance = 51.341f}
-        }},
-        {1141, {
-            {.id = 1142, .distance = 25.813f}, {.id = 1140, .distance = 26.133f}, {.id = 1139, .distance = 27.373f}, {.id = 1094, .distance = 27.856f}, {.id = 1093, .distance = 38.273f}, {.id = 1138, .distance = 38.795f}, {.id = 1143, .distance = 39.458f}
-        }},
-        {1142, {
-            {.id = 1141, .distance = 25.813f}, {.id = 704, .distance = 29.475f}, {.id = 1143, .distance = 29.479f}, {.id = 1140, .distance = 30.723f}, {.id = 1094, .distance = 35.561f}, {.id = 702, .distance = 40.870f}, {.id = 498, .distance = 50.403f}
-        }},
-        {1143, {
-            {.id = 1094, .distance = 22.863f}, {.id = 1095, .distance = 28.096f}, {.id = 702, .distance = 29.448f}, {.id = 1142, .distance = 29.479f}, {.id = 1141, .distance = 39.458f}, {.id = 701, .distance = 40.502f}, {.id = 704, .distance = 42.128f}
-        }},
-        {1144, {
-            {.id = 1145, .distance = 25.256f}, {.id = 1147, .distance = 25.653f}, {.id = 1146, .distance = 25.660f}, {.id = 1149, .distance = 26.237f}, {.id = 1148, .distance = 26.780f}, {.id = 1151, .distance = 53.251f}, {.id = 1155, .distance = 53.584f}
-        }},
-        {1145, {
-            {.id = 1144, .distance = 25.256f}, {.id = 1151, .distance = 27.996f}, {.id = 1149, .distance = 30.406f}, {.id = 1146, .distance = 30.746f}, {.id = 1152, .distance = 36.902f}, {.id = 1150, .distance = 36.902f}, {.id = 1147, .distance = 48.670f}
-        }},
-        {1146, {
-            {.id = 1144, .distance = 25.660f}, {.id = 1153, .distance = 28.138f}, {.id = 1147, .distance = 30.016f}, {.id = 1145, .distance = 30.746f}, {.id = 1154, .distance = 35.779f}, {.id = 1152, .distance = 37.730f}, {.id = 1148, .distance = 49.623f}
-        }},
-        {1147, {
-            {.id = 1144, .distance = 25.653f}, {.id = 1155, .distance = 27.950f}, {.id = 1146, .distance = 30.016f}, {.id = 1148, .distance = 30.334f}, {.id = 1156, .distance = 36.663f}, {.id = 1154, .distance = 36.917f}, {.id = 1145, .distance = 48.670f}
-        }},
-        {1148, {
-            {.id = 1144, .distance = 26.780f}, {.id = 1157, .distance = 28.148f}, {.id = 1147, .distance = 30.334f}, {.id = 1149, .distance = 30.829f}, {.id = 1156, .distance = 36.041f}, {.id = 1158, .distance = 36.581f}, {.id = 1145, .distance = 49.415f}
-        }},
-        {1149, {
-            {.id = 1144, .distance = 26.237f}, {.id = 1159, .distance = 28.784f}, {.id = 1145, .distance = 30.406f}, {.id = 1148, .distance = 30.829f}, {.id = 1150, .distance = 36.136f}, {.id = 1158, .distance = 36.663f}, {.id = 1147, .distance = 49.028f}
-        }},
-        {1150, {
-            {.id = 1161, .distance = 29.943f}, {.id = 1159, .distance = 32.709f}, {.id = 1151, .distance = 33.241f}, {.id = 1160, .distance = 35.999f}, {.id = 1149, .distance = 36.136f}, {.id = 1145, .distance = 36.902f}, {.id = 1162, .distance = 43.146f}
-        }},
-        {1151, {
-            {.id = 1145, .distance = 27.996f}, {.id = 1162, .distance = 31.091f}, {.id = 1150, .distance = 33.241f}, {.id = 1152, .distance = 33.489f}, {.id = 1163, .distance = 33.997f}, {.id = 1161, .distance = 46.465f}, {.id = 1164, .distance = 50.872f}
-        }},
-        {1152, {
-            {.id = 1164, .distance = 28.795f}, {.id = 1151, .distance = 33.489f}, {.id = 1153, .distance = 34.526f}, {.id = 1145, .distance = 36.902f}, {.id = 1146, .distance = 37.730f}, {.id = 1163, .distance = 39.001f}, {.id = 1165, .distance = 39.043f}
-        }},
-        {1153, {
-            {.id = 1146, .distance = 28.138f}, {.id = 1166, .distance = 30.119f}, {.id = 1154, .distance = 32.862f}, {.id = 1165, .distance = 33.326f}, {.id = 1152, .distance = 34.526f}, {.id = 1167, .distance = 46.032f}, {.id = 1164, .distance = 51.953f}
-        }},
-        {1154, {
-            {.id = 1167, .distance = 29.271f}, {.id = 1153, .distance = 32.862f}, {.id = 1155, .distance = 32.910f}, {.id = 1168, .distance = 35.475f}, {.id = 1146, .distance = 35.779f}, {.id = 1147, .distance = 36.917f}, {.id = 1166, .distance = 42.036f}
-        }},
-        {1155, {
-            {.id = 1147, .distance = 27.950f}, {.id = 1169, .distance = 30.515f}, {.id = 1154, .distance = 32.910f}, {.id = 1156, .distance = 34.288f}, {.id = 1168, .distance = 35.680f}, {.id = 1170, .distance = 43.747f}, {.id = 1146, .distance = 50.881f}
-        }},
-        {1156, {
-            {.id = 1170, .distance = 30.713f}, {.id = 1171, .distance = 32.961f}, {.id = 1155, .distance = 34.288f}, {.id = 1157, .distance = 34.333f}, {.id = 1148, .distance = 36.041f}, {.id = 1147, .distance = 36.663f}, {.id = 1169, .distance = 47.436f}
-        }},
-        {1157, {
-            {.id = 1148, .distance = 28.148f}, {.id = 1172, .distance = 28.795f}, {.id = 1158, .distance = 32.474f}, {.id = 1156, .distance = 34.333f}, {.id = 1173, .distance = 37.853f}, {.id = 1171, .distance = 39.529f}, {.id = 1149, .distance = 52.029f}
-        }},
-        {1158, {
-            {.id = 1174, .distance = 30.978f}, {.id = 1157, .distance = 32.474f}, {.id = 1173, .distance = 33.378f}, {.id = 1159, .distance = 34.135f}, {.id = 1148, .distance = 36.581f}, {.id = 1149, .distance = 36.663f}, {.id = 1175, .distance = 47.075f}
-        }},
-        {1159, {
-            {.id = 1149, .distance = 28.784f}, {.id = 1175, .distance = 29.314f}, {.id = 1150, .distance = 32.709f}, {.id = 1158, .distance = 34.135f}, {.id = 1160, .distance = 35.428f}, {.id = 1174, .distance = 42.934f}, {.id = 1145, .distance = 52.730f}
-        }},
-        {1160, {
-            {.id = 1177, .distance = 31.937f}, {.id = 1176, .distance = 31.964f}, {.id = 1175, .distance = 32.088f}, {.id = 1161, .distance = 32.704f}, {.id = 1159, .distance = 35.428f}, {.id = 1150, .distance = 35.999f}, {.id = 1197, .distance = 49.921f}
-        }},
-        {1161, {
-            {.id = 1178, .distance = 29.419f}, {.id = 1150, .distance = 29.943f}, {.id = 1162, .distance = 32.468f}, {.id = 1160, .distance = 32.704f}, {.id = 1177, .distance = 37.491f}, {.id = 1179, .distance = 41.947f}, {.id = 1151, .distance = 46.465f}
-        }},
-        {1162, {
-            {.id = 1179, .distance = 29.848f}, {.id = 1151, .distance = 31.091f}, {.id = 1163, .distance = 31.917f}, {.id = 1161, .distance = 32.468f}, {.id = 1180, .distance = 35.426f}, {.id = 1150, .distance = 43.146f}, {.id = 1178, .distance = 44.568f}
-        }},
-        {1163, {
-            {.id = 1181, .distance = 30.775f}, {.id = 1162, .distance = 31.917f}, {.id = 1164, .distance = 32.089f}, {.id = 1180, .distance = 33.457f}, {.id = 1151, .distance = 33.997f}, {.id = 1152, .distance = 39.001f}, {.id = 1182, .distance = 47.195f}
-        }},
-        {1164, {
-            {.id = 1182, .distance = 28.126f}, {.id = 1152, .distance = 28.795f}, {.id = 1163, .distance = 32.089f}, {.id = 1165, .distance = 33.350f}, {.id = 1181, .distance = 38.606f}, {.id = 1183, .distance = 40.686f}, {.id = 1151, .distance = 50.872f}
-        }},
-        {1165, {
-            {.id = 1183, .distance = 30.745f}, {.id = 1166, .distance = 32.585f}, {.id = 1153, .distance = 33.326f}, {.id = 1164, .distance = 33.350f}, {.id = 1184, .distance = 33.990f}, {.id = 1152, .distance = 39.043f}, {.id = 1182, .distance = 47.230f}
-        }},
-        {1166, {
-            {.id = 1185, .distance = 30.088f}, {.id = 1153, .distance = 30.119f}, {.id = 1167, .distance = 32.298f}, {.id = 1165, .distance = 32.585f}, {.id = 1184, .distance = 35.628f}, {.id = 1154, .distance = 42.036f}, {.id = 1186, .distance = 44.864f}
-        }},
-        {1167, {
-            {.id = 1186, .distance = 28.726f}, {.id = 1154, .distance = 29.271f}, {.id = 1168, .distance = 31.916f}, {.id = 1166, .distance = 32.298f}, {.id = 1187, .distance = 37.444f}, {.id = 1185, .distance = 42.067f}, {.id = 1153, .distance = 46.032f}
-        }},
-        {1168, {
-            {.id = 1187, .distance = 31.889f}, {.id = 1167, .distance = 31.916f}, {.id = 1188, .distance = 32.458f}, {.id = 1169, .distance = 32.605f}, {.id = 1154, .distance = 35.475f}, {.id = 1155, .distance = 35.680f}, {.id = 1186, .distance = 49.358f}
-        }},
-        {1169, {
-            {.id = 1189, .distance = 28.557f}, {.id = 1155, .distance = 30.515f}, {.id = 1168, .distance = 32.605f}, {.id = 1170, .distance = 33.386f}, {.id = 1188, .distance = 36.707f}, {.id = 1190, .distance = 42.276f}, {.id = 1156, .distance = 47.436f}
-        }},
-        {1170, {
-            {.id = 1190, .distance = 29.283f}, {.id = 1156, .distance = 30.713f}, {.id = 1171, .distance = 32.395f}, {.id = 1169, .distance = 33.386f}, {.id = 1191, .distance = 35.383f}, {.id = 1155, .distance = 43.747f}, {.id = 1189, .distance = 45.069f}
-        }},
-        {1171, {
-            {.id = 1192, .distance = 30.492f}, {.id = 1170, .distance = 32.395f}, {.id = 1172, .distance = 32.492f}, {.id = 1156, .distance = 32.961f}, {.id = 1191, .distance = 33.774f}, {.id = 1157, .distance = 39.529f}, {.id = 1193, .distance = 46.947f}
-        }},
-        {1172, {
-            {.id = 1157, .distance = 28.795f}, {.id = 1193, .distance = 28.796f}, {.id = 1173, .distance = 31.301f}, {.id = 1171, .distance = 32.492f}, {.id = 1194, .distance = 39.130f}, {.id = 1192, .distance = 39.658f}, {.id = 1158, .distance = 50.236f}
-        }},
-        {1173, {
-            {.id = 1194, .distance = 30.076f}, {.id = 1172, .distance = 31.301f}, {.id = 1174, .distance = 33.324f}, {.id = 1158, .distance = 33.378f}, {.id = 1195, .distance = 33.386f}, {.id = 1157, .distance = 37.853f}, {.id = 1193, .distance = 46.778f}
-        }},
-        {1174, {
-            {.id = 1196, .distance = 29.653f}, {.id = 1158, .distance = 30.978f}, {.id = 1175, .distance = 32.852f}, {.id = 1173, .distance = 33.324f}, {.id = 1195, .distance = 35.446f}, {.id = 1159, .distance = 42.934f}, {.id = 1197, .distance = 44.581f}
-        }},
-        {1175, {
-            {.id = 1197, .distance = 28.776f}, {.id = 1159, .distance = 29.314f}, {.id = 1160, .distance = 32.088f}, {.id = 1174, .distance = 32.852f}, {.id = 1176, .distance = 36.954f}, {.id = 1196, .distance = 42.498f}, {.id = 1158, .distance = 47.075f}
-        }},
-        {1176, {
-            {.id = 1198, .distance = 23.617f}, {.id = 1197, .distance = 31.442f}, {.id = 1160, .distance = 31.964f}, {.id = 1177, .distance = 32.703f}, {.id = 1175, .distance = 36.954f}, {.id = 1245, .distance = 41.259f}, {.id = 1247, .distance = 45.103f}
-        }},
-        {1177, {
-            {.id = 1160, .distance = 31.937f}, {.id = 1176, .distance = 32.703f}, {.id = 1178, .distance = 32.725f}, {.id = 1199, .distance = 36.068f}, {.id = 1161, .distance = 37.491f}, {.id = 1200, .distance = 39.068f}, {.id = 1198, .distance = 41.895f}
-        }},
-        {1178, {
-            {.id = 1161, .distance = 29.419f}, {.id = 1179, .distance = 30.638f}, {.id = 1177, .distance = 32.725f}, {.id = 1200, .distance = 35.794f}, {.id = 1201, .distance = 36.665f}, {.id = 1162, .distance = 44.568f}, {.id = 1202, .distance = 46.412f}
-        }},
-        {1179, {
-            {.id = 1202, .distance = 24.191f}, {.id = 1162, .distance = 29.848f}, {.id = 1178, .distance = 30.638f}, {.id = 1180, .distance = 31.516f}, {.id = 1161, .distance = 41.947f}, {.id = 1203, .distance = 44.167f}, {.id = 1201, .distance = 44.460f}
-        }},
-        {1180, {
-            {.id = 1207, .distance = 27.519f}, {.id = 1179, .distance = 31.516f}, {.id = 1181, .distance = 33.096f}, {.id = 1163, .distance = 33.457f}, {.id = 1162, .distance = 35.426f}, {.id = 1204, .distance = 35.506f}, {.id = 1202, .distance = 36.051f}
-        }},
-        {1181, {
-            {.id = 1163, .distance = 30.775f}, {.id = 1182, .distance = 30.943f}, {.id = 1207, .distance = 31.347f}, {.id = 1180, .distance = 33.096f}, {.id = 1209, .distance = 37.393f}, {.id = 1164, .distance = 38.606f}, {.id = 1208, .distance = 45.102f}
-        }},
-        {1182, {
-            {.id = 1164, .distance = 28.126f}, {.id = 1181, .distance = 30.943f}, {.id = 1183, .distance = 32.322f}, {.id = 1210, .distance = 33.115f}, {.id = 1209, .distance = 43.474f}, {.id = 1211, .distance = 44.048f}, {.id = 1163, .distance = 47.195f}
-        }},
-        {1183, {
-            {.id = 1213, .distance = 30.540f}, {.id = 1165, .distance = 30.745f}, {.id = 1182, .distance = 32.322f}, {.id = 1184, .distance = 32.441f}, {.id = 1211, .distance = 37.153f}, {.id = 1164, .distance = 40.686f}, {.id = 1212, .distance = 45.279f}
-        }},
-        {1184, {
-            {.id = 1213, .distance = 27.373f}, {.id = 1185, .distance = 31.563f}, {.id = 1183, .distance = 32.441f}, {.id = 1165, .distance = 33.990f}, {.id = 1215, .distance = 35.618f}, {.id = 1166, .distance = 35.628f}, {.id = 1217, .distance = 36.566f}
-        }},
-        {1185, {
-            {.id = 1217, .distance = 24.293f}, {.id = 1166, .distance = 30.088f}, {.id = 1184, .distance = 31.563f}, {.id = 1186, .distance = 31.793f}, {.id = 1167, .distance = 42.067f}, {.id = 1218, .distance = 43.775f}, {.id = 1219, .distance = 43.787f}
-        }},
-        {1186, {
-            {.id = 1167, .distance = 28.726f}, {.id = 1187, .distance = 31.427f}, {.id = 1185, .distance = 31.793f}, {.id = 1220, .distance = 35.922f}, {.id = 1219, .distance = 37.333f}, {.id = 1166, .distance = 44.864f}, {.id = 1217, .distance = 47.704f}
-        }},
-        {1187, {
-            {.id = 1186, .distance = 31.427f}, {.id = 1168, .distance = 31.889f}, {.id = 1188, .distance = 32.342f}, {.id = 1221, .distance = 35.562f}, {.id = 1167, .distance = 37.444f}, {.id = 1220, .distance = 39.243f}, {.id = 1223, .distance = 41.982f}
-        }},
-        {1188, {
-            {.id = 1223, .distance = 23.803f}, {.id = 1189, .distance = 31.693f}, {.id = 1187, .distance = 32.342f}, {.id = 1168, .distance = 32.458f}, {.id = 1169, .distance = 36.707f}, {.id = 1225, .distance = 41.333f}, {.id = 1222, .distance = 44.974f}
-        }},
-        {1189, {
-            {.id = 1227, .distance = 24.410f}, {.id = 1169, .distance = 28.557f}, {.id = 1188, .distance = 31.693f}, {.id = 1190, .distance = 32.138f}, {.id = 1225, .distance = 38.124f}, {.id = 1223, .distance = 43.096f}, {.id = 1170, .distance = 45.069f}
-        }},
-        {1190, {
-            {.id = 1170, .distance = 29.283f}, {.id = 1191, .distance = 31.589f}, {.id = 1189, .distance = 32.138f}, {.id = 1229, .distance = 36.174f}, {.id = 1227, .distance = 36.927f}, {.id = 1169, .distance = 42.276f}, {.id = 1230, .distance = 43.787f}
-        }},
-        {1191, {
-            {.id = 1190, .distance = 31.589f}, {.id = 1192, .distance = 32.185f}, {.id = 1230, .distance = 33.528f}, {.id = 1171, .distance = 33.774f}, {.id = 1170, .distance = 35.383f}, {.id = 1231, .distance = 39.292f}, {.id = 1229, .distance = 48.151f}
-        }},
-        {1192, {
-            {.id = 1233, .distance = 26.800f}, {.id = 1171, .distance = 30.492f}, {.id = 1193, .distance = 31.085f}, {.id = 1191, .distance = 32.185f}, {.id = 1172, .distance = 39.658f}, {.id = 1231, .distance = 40.843f}, {.id = 1232, .distance = 44.297f}
-        }},
-        {1193, {
-            {.id = 1172, .distance = 28.796f}, {.id = 1192, .distance = 31.085f}, {.id = 1233, .distance = 31.165f}, {.id = 1194, .distance = 31.748f}, {.id = 1237, .distance = 32.025f}, {.id = 1235, .distance = 35.484f}, {.id = 1173, .distance = 46.778f}
-        }},
-        {1194, {
-            {.id = 1237, .distance = 26.974f}, {.id = 1173, .distance = 30.076f}, {.id = 1195, .distance = 31.574f}, {.id = 1193, .distance = 31.748f}, {.id = 1172, .distance = 39.130f}, {.id = 1239, .distance = 40.759f}, {.id = 1238, .distance = 44.255f}
-        }},
-        {1195, {
-            {.id = 1194, .distance = 31.574f}, {.id = 1196, .distance = 32.495f}, {.id = 1173, .distance = 33.386f}, {.id = 1240, .distance = 34.006f}, {.id = 1174, .distance = 35.446f}, {.id = 1239, .distance = 40.058f}, {.id = 1241, .distance = 48.765f}
-        }},
-        {1196, {
-            {.id = 1174, .distance = 29.653f}, {.id = 1197, .distance = 31.761f}, {.id = 1195, .distance = 32.495f}, {.id = 1241, .distance = 35.652f}, {.id = 1243, .distance = 35.973f}, {.id = 1175, .distance = 42.498f}, {.id = 1240, .distance = 43.930f}
-        }},
-        {1197, {
-            {.id = 1243, .distance = 24.656f}, {.id = 1175, .distance = 28.776f}, {.id = 1176, .distance = 31.442f}, {.id = 1196, .distance = 31.761f}, {.id = 1245, .distance = 38.273f}, {.id = 1198, .distance = 43.129f}, {.id = 1174, .distance = 44.581f}
-        }},
-        {1198, {
-            {.id = 1247, .distance = 22.863f}, {.id = 1176, .distance = 23.617f}, {.id = 1245, .distance = 27.856f}, {.id = 1246, .distance = 35.561f}, {.id = 1199, .distance = 37.917f}, {.id = 1177, .distance = 41.895f}, {.id = 1197, .distance = 43.129f}
-        }},
-        {1199, {
-            {.id = 1247, .distance = 28.096f}, {.id = 1200, .distance = 29.153f}, {.id = 691, .distance = 30.415f}, {.id = 1177, .distance = 36.068f}, {.id = 1198, .distance = 37.917f}, {.id = 690, .distance = 41.340f}, {.id = 692, .distance = 42.661f}
-        }},
-        {1200, {
-            {.id = 1201, .distance = 28.265f}, {.id = 1199, .distance = 29.153f}, {.id = 690, .distance = 30.894f}, {.id = 1178, .distance = 35.794f}, {.id = 1177, .distance = 39.068f}, {.id = 689, .distance = 40.805f}, {.id = 691, .distance = 43.032f}
-        }},
-        {1201, {
-            {.id = 1200, .distance = 28.265f}, {.id = 1203, .distance = 28.989f}, {.id = 689, .distance = 30.240f}, {.id = 1178, .distance = 36.665f}, {.id = 1202, .distance = 38.712f}, {.id = 688, .distance = 40.848f}, {.id = 690, .distance = 42.310f}
-        }},
-        {1202, {
-            {.id = 1203, .distance = 23.607f}, {.id = 1179, .distance = 24.191f}, {.id = 1204, .distance = 27.455f}, {.id = 1205, .distance = 35.536f}, {.id = 1180, .distance = 36.051f}, {.id = 1201, .distance = 38.712f}, {.id = 1178, .distance = 46.412f}
-        }},
-        {1203, {
-            {.id = 1202, .distance = 23.607f}, {.id = 1205, .distance = 28.500f}, {.id = 1201, .distance = 28.989f}, {.id = 688, .distance = 30.527f}, {.id = 1204, .distance = 38.998f}, {.id = 686, .distance = 41.143f}, {.id = 689, .distance = 42.836f}
-        }},
-        {1204, {
-            {.id = 1205, .distance = 25.823f}, {.id = 1206, .distance = 26.007f}, {.id = 1207, .distance = 27.304f}, {.id = 1202, .distance = 27.455f}, {.id = 1180, .distance = 35.506f}, {.id = 1203, .distance = 38.998f}, {.id = 1208, .distance = 39.242f}
-        }},
-        {1205, {
-            {.id = 1204, .distance = 25.823f}, {.id = 1203, .distance = 28.500f}, {.id = 686, .distance = 30.452f}, {.id = 1206, .distance = 30.900f}, {.id = 1202, .distance = 35.536f}, {.id = 688, .distance = 43.063f}, {.id = 798, .distance = 51.891f}
-        }},
-        {1206, {
-            {.id = 1204, .distance = 26.007f}, {.id = 1208, .distance = 29.614f}, {.id = 798, .distance = 29.836f}, {.id = 1205, .distance = 30.900f}, {.id = 1207, .distance = 35.963f}, {.id = 796, .distance = 39.709f}, {.id = 1202, .distance = 52.371f}
-        }},
-        {1207, {
-            {.id = 1208, .distance = 23.404f}, {.id = 1204, .distance = 27.304f}, {.id = 1180, .distance = 27.519f}, {.id = 1181, .distance = 31.347f}, {.id = 1206, .distance = 35.963f}, {.id = 1209, .distance = 38.924f}, {.id = 1202, .distance = 47.034f}
-        }},
-        {1208, {
-            {.id = 1207, .distance = 23.404f}, {.id = 1209, .distance = 28.584f}, {.id = 1206, .distance = 29.614f}, {.id = 796, .distance = 30.187f}, {.id = 1204, .distance = 39.242f}, {.id = 795, .distance = 39.536f}, {.id = 798, .distance = 43.439f}
-        }},
-        {1209, {
-            {.id = 1210, .distance = 28.069f}, {.id = 1208, .distance = 28.584f}, {.id = 795, .distance = 29.916f}, {.id = 1181, .distance = 37.393f}, {.id = 1207, .distance = 38.924f}, {.id = 794, .distance = 39.539f}, {.id = 1182, .distance = 43.474f}
-        }},
-        {1210, {
-            {.id = 1209, .distance = 28.069f}, {.id = 1211, .distance = 28.840f}, {.id = 794, .distance = 30.071f}, {.id = 1182, .distance = 33.115f}, {.id = 793, .distance = 39.539f}, {.id = 795, .distance = 43.068f}, {.id = 1181, .distance = 48.228f}
-        }},
-        {1211, {
-            {.id = 1210, .distance = 28.840f}, {.id = 1212, .distance = 29.097f}, {.id = 793, .distance = 29.916f}, {.id = 1183, .distance = 37.153f}, {.id = 1213, .distance = 38.371f}, {.id = 792, .distance = 39.536f}, {.id = 794, .distance = 43.068f}
-        }},
-        {1212, {
-            {.id = 1213, .distance = 23.468f}, {.id = 1214, .distance = 28.067f}, {.id = 1211, .distance = 29.097f}, {.id = 792, .distance = 30.187f}, {.id = 1215, .distance = 37.859f}, {.id = 790, .distance = 39.709f}, {.id = 793, .distance = 43.663f}
-        }},
-        {1213, {
-            {.id = 1212, .distance = 23.468f}, {.id = 1215, .distance = 26.995f}, {.id = 1184, .distance = 27.373f}, {.id = 1183, .distance = 30.540f}, {.id = 1214, .distance = 35.584f}, {.id = 1211, .distance = 38.371f}, {.id = 1217, .distance = 47.445f}
-        }},
-        {1214, {
-            {.id = 1215, .distance = 25.235f}, {.id = 1212, .distance = 28.067f}, {.id = 790, .distance = 29.836f}, {.id = 1216, .distance = 31.314f}, {.id = 1213, .distance = 35.584f}, {.id = 792, .distance = 43.439f}, {.id = 902, .distance = 50.917f}
-        }},
-        {1215, {
-            {.id = 1214, .distance = 25.235f}, {.id = 1216, .distance = 25.959f}, {.id = 1213, .distance = 26.995f}, {.id = 1217, .distance = 28.280f}, {.id = 1184, .distance = 35.618f}, {.id = 1212, .distance = 37.859f}, {.id = 1218, .distance = 39.348f}
-        }},
-        {1216, {
-            {.id = 1215, .distance = 25.959f}, {.id = 1218, .distance = 28.175f}, {.id = 902, .distance = 28.941f}, {.id = 1214, .distance = 31.314f}, {.id = 1217, .distance = 35.099f}, {.id = 900, .distance = 38.797f}, {.id = 1213, .distance = 52.245f}
-        }},
-        {1217, {
-            {.id = 1218, .distance = 22.858f}, {.id = 1185, .distance = 24.293f}, {.id = 1215, .distance = 28.280f}, {.id = 1216, .distance = 35.099f}, {.id = 1184, .distance = 36.566f}, {.id = 1219, .distance = 37.718f}, {.id = 1213, .distance = 47.445f}
-        }},
-        {1218, {
-            {.id = 1217, .distance = 22.858f}, {.id = 1216, .distance = 28.175f}, {.id = 1219, .distance = 28.665f}, {.id = 900, .distance = 28.906f}, {.id = 1215, .distance = 39.348f}, {.id = 899, .distance = 39.389f}, {.id = 902, .distance = 41.827f}
-        }},
-        {1219, {
-            {.id = 1218, .distance = 28.665f}, {.id = 1220, .distance = 28.744f}, {.id = 899, .distance = 28.966f}, {.id = 1186, .distance = 37.333f}, {.id = 1217, .distance = 37.718f}, {.id = 898, .distance = 39.574f}, {.id = 900, .distance = 42.324f}
-        }},
-        {1220, {
-            {.id = 1221, .distance = 28.665f}, {.id = 1219, .distance = 28.744f}, {.id = 898, .distance = 28.846f}, {.id = 1186, .distance = 35.922f}, {.id = 897, .distance = 38.867f}, {.id = 1187, .distance = 39.243f}, {.id = 899, .distance = 41.988f}
-        }},
-        {1221, {
-            {.id = 1220, .distance = 28.665f}, {.id = 897, .distance = 28.757f}, {.id = 1222, .distance = 28.989f}, {.id = 1187, .distance = 35.562f}, {.id = 1223, .distance = 37.946f}, {.id = 896, .distance = 39.043f}, {.id = 898, .distance = 41.923f}
-        }},
-        {1222, {
-            {.id = 1223, .distance = 22.522f}, {.id = 896, .distance = 28.966f}, {.id = 1221, .distance = 28.989f}, {.id = 1224, .distance = 28.989f}, {.id = 1225, .distance = 38.748f}, {.id = 894, .distance = 39.268f}, {.id = 897, .distance = 42.413f}
-        }},
-        {1223, {
-            {.id = 1222, .distance = 22.522f}, {.id = 1188, .distance = 23.803f}, {.id = 1225, .distance = 27.573f}, {.id = 1224, .distance = 35.430f}, {.id = 1221, .distance = 37.946f}, {.id = 1187, .distance = 41.982f}, {.id = 1189, .distance = 43.096f}
-        }},
-        {1224, {
-            {.id = 1225, .distance = 25.732f}, {.id = 894, .distance = 28.644f}, {.id = 1222, .distance = 28.989f}, {.id = 1226, .distance = 30.699f}, {.id = 1223, .distance = 35.430f}, {.id = 896, .distance = 42.830f}, {.id = 893, .distance = 50.838f}
-        }},
-        {1225, {
-            {.id = 1226, .distance = 25.715f}, {.id = 1224, .distance = 25.732f}, {.id = 1227, .distance = 27.009f}, {.id = 1223, .distance = 27.573f}, {.id = 1189, .distance = 38.124f}, {.id = 1222, .distance = 38.748f}, {.id = 1228, .distance = 38.795f}
-        }},
-        {1226, {
-            {.id = 1225, .distance = 25.715f}, {.id = 1228, .distance = 28.587f}, {.id = 1006, .distance = 28.662f}, {.id = 1224, .distance = 30.699f}, {.id = 1227, .distance = 35.180f}, {.id = 1004, .distance = 39.796f}, {.id = 1007, .distance = 52.063f}
-        }},
-        {1227, {
-            {.id = 1228, .distance = 23.318f}, {.id = 1189, .distance = 24.410f}, {.id = 1225, .distance = 27.009f}, {.id = 1226, .distance = 35.180f}, {.id = 1190, .distance = 36.927f}, {.id = 1229, .distance = 38.625f}, {.id = 1223, .distance = 47.229f}
-        }},
-        {1228, {
-            {.id = 1227, .distance = 23.318f}, {.id = 1226, .distance = 28.587f}, {.id = 1229, .distance = 28.648f}, {.id = 1004, .distance = 28.742f}, {.id = 1225, .distance = 38.795f}, {.id = 1003, .distance = 40.200f}, {.id = 1006, .distance = 40.849f}
-        }},
-        {1229, {
-            {.id = 1228, .distance = 28.648f}, {.id = 1230, .distance = 28.678f}, {.id = 1003, .distance = 28.729f}, {.id = 1190, .distance = 36.174f}, {.id = 1227, .distance = 38.625f}, {.id = 1002, .distance = 40.334f}, {.id = 1004, .distance = 41.262f}
-        }},
-        {1230, {
-            {.id = 1231, .distance = 28.019f}, {.id = 1229, .distance = 28.678f}, {.id = 1002, .distance = 28.689f}, {.id = 1191, .distance = 33.528f}, {.id = 1001, .distance = 39.721f}, {.id = 1003, .distance = 40.936f}, {.id = 1190, .distance = 43.787f}
-        }},
-        {1231, {
-            {.id = 1230, .distance = 28.019f}, {.id = 1001, .distance = 28.455f}, {.id = 1232, .distance = 29.666f}, {.id = 1233, .distance = 39.143f}, {.id = 1191, .distance = 39.292f}, {.id = 1000, .distance = 40.267f}, {.id = 1002, .distance = 40.347f}
-        }},
-        {1232, {
-            {.id = 1233, .distance = 23.574f}, {.id = 1000, .distance = 28.635f}, {.id = 1234, .distance = 28.796f}, {.id = 1231, .distance = 29.666f}, {.id = 1235, .distance = 38.536f}, {.id = 998, .distance = 40.017f}, {.id = 1001, .distance = 41.281f}
-        }},
-        {1233, {
-            {.id = 1232, .distance = 23.574f}, {.id = 1192, .distance = 26.800f}, {.id = 1235, .distance = 27.295f}, {.id = 1193, .distance = 31.165f}, {.id = 1234, .distance = 35.726f}, {.id = 1231, .distance = 39.143f}, {.id = 1237, .distance = 46.866f}
-        }},
-        {1234, {
-            {.id = 1235, .distance = 25.236f}, {.id = 998, .distance = 28.579f}, {.id = 1232, .distance = 28.796f}, {.id = 1236, .distance = 30.643f}, {.id = 1233, .distance = 35.726f}, {.id = 1000, .distance = 41.723f}, {.id = 997, .distance = 51.535f}
-        }},
-        {1235, {
-            {.id = 1234, .distance = 25.236f}, {.id = 1236, .distance = 25.701f}, {.id = 1233, .distance = 27.295f}, {.id = 1237, .distance = 27.601f}, {.id = 1193, .distance = 35.484f}, {.id = 1232, .distance = 38.536f}, {.id = 1238, .distance = 38.536f}
-        }},
-        {1236, {
-            {.id = 1235, .distance = 25.701f}, {.id = 1238, .distance = 28.171f}, {.id = 1110, .distance = 29.688f}, {.id = 1234, .distance = 30.643f}, {.id = 1237, .distance = 35.416f}, {.id = 1108, .distance = 41.018f}, {.id = 998, .distance = 51.461f}
-        }},
-        {1237, {
-            {.id = 1238, .distance = 23.046f}, {.id = 1194, .distance = 26.974f}, {.id = 1235, .distance = 27.601f}, {.id = 1193, .distance = 32.025f}, {.id = 1236, .distance = 35.416f}, {.id = 1239, .distance = 38.124f}, {.id = 1233, .distance = 46.866f}
-        }},
-        {1238, {
-            {.id = 1237, .distance = 23.046f}, {.id = 1236, .distance = 28.171f}, {.id = 1239, .distance = 28.796f}, {.id = 1108, .distance = 29.876f}, {.id = 1235, .distance = 38.536f}, {.id = 1110, .distance = 40.900f}, {.id = 1107, .distance = 41.797f}
-        }},
-        {1239, {
-            {.id = 1240, .distance = 28.739f}, {.id = 1238, .distance = 28.796f}, {.id = 1107, .distance = 29.681f}, {.id = 1237, .distance = 38.124f}, {.id = 1195, .distance = 40.058f}, {.id = 1194, .distance = 40.759f}, {.id = 1108, .distance = 41.259f}
-        }},
-        {1240, {
-            {.id = 1239, .distance = 28.739f}, {.id = 1241, .distance = 28.996f}, {.id = 1106, .distance = 29.791f}, {.id = 1195, .distance = 34.006f}, {.id = 1107, .distance = 41.088f}, {.id = 1105, .distance = 41.139f}, {.id = 1196, .distance = 43.930f}
-        }},
-        {1241, {
-            {.id = 1242, .distance = 28.539f}, {.id = 1240, .distance = 28.996f}, {.id = 1105, .distance = 29.681f}, {.id = 1196, .distance = 35.652f}, {.id = 1243, .distance = 38.072f}, {.id = 1104, .distance = 41.093f}, {.id = 1106, .distance = 41.276f}
-        }},
-        {1242, {
-            {.id = 1243, .distance = 23.229f}, {.id = 1241, .distance = 28.539f}, {.id = 1244, .distance = 29.175f}, {.id = 1104, .distance = 29.699f}, {.id = 1245, .distance = 38.795f}, {.id = 1105, .distance = 41.301f}, {.id = 1102, .distance = 41.538f}
-        }},
-        {1243, {
-            {.id = 1242, .distance = 23.229f}, {.id = 1197, .distance = 24.656f}, {.id = 1245, .distance = 27.373f}, {.id = 1196, .distance = 35.973f}, {.id = 1244, .distance = 36.131f}, {.id = 1241, .distance = 38.072f}, {.id = 1198, .distance = 47.750f}
-        }},
-        {1244, {
-            {.id = 1245, .distance = 26.133f}, {.id = 1102, .distance = 29.050f}, {.id = 1242, .distance = 29.175f}, {.id = 1246, .distance = 30.723f}, {.id = 1243, .distance = 36.131f}, {.id = 1104, .distance = 41.569f}, {.id = 1101, .distance = 52.210f}
-        }},
-        {1245, {
-            {.id = 1246, .distance = 25.813f}, {.id = 1244, .distance = 26.133f}, {.id = 1243, .distance = 27.373f}, {.id = 1198, .distance = 27.856f}, {.id = 1197, .distance = 38.273f}, {.id = 1242, .distance = 38.795f}, {.id = 1247, .distance = 39.458f}
-        }},
-        {1246, {
-            {.id = 1245, .distance = 25.813f}, {.id = 1247, .distance = 29.479f}, {.id = 694, .distance = 30.660f}, {.id = 1244, .distance = 30.723f}, {.id = 1198, .distance = 35.561f}, {.id = 692, .distance = 41.283f}, {.id = 1102, .distance = 51.839f}
-        }},
-        {1247, {
-            {.id = 1198, .distance = 22.863f}, {.id = 1199, .distance = 28.096f}, {.id = 1246, .distance = 29.479f}, {.id = 692, .distance = 30.625f}, {.id = 1245, .distance = 39.458f}, {.id = 691, .distance = 40.963f}, {.id = 694, .distance = 42.761f}
-        }}
-    };
+    // Model geometry
+    static constexpr size_t BLOB_SIZE = 73922;
+    static constexpr char BLOB[] =
+        "PTMB\002\000 \000\340\004\014\001\007\000\003\000\345 \234C`\000\000\000\302 \001\000 9+\313\005\000"
+        "h\000\000\000pB\000\000\001\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000H\303\000\000"
+        "\000\000\000\000\203CF6w\302\0046>\303\000\000\203C\221\315!C/\035\353\302\000\000\203C\221\315!C/\035"
+        "\353B\000\000\203CF6w\302\0046>C\000\000\203C\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\002"
+        "\005\000\000\000\000\000\000\000\000\000\000\000\000\335\344\307\302m\367\231\303\262\235wB)\034\310"
+        "B\020\370\231\303\315\314v\302\262\355\202CB`>\303\262\235wB\240\332!C\213l\353\302\022\363\202C\022"
+        "\003w\302\262]>\303\022\363\202C\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\001\005\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\234\344\241C\000\000\000\200\315\314v\302\356\374\202C\0046"
+        ">C\262\235wBL\367!C/\035\353B\022\363\202CL\367!C/\035\353\302\022\363\202C\356\374\202C\0046>\303\262"
+        "\235wB\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\003\000\003\005\000\000\000\000\000\000\000\000\000"
+        "\000\000\000)\034\310B\020\370\231C\315\314v\302\335\344\307\302m\367\231C\262\235wB\022\003w\302\262"
+        "]>C\022\363\202C\240\332!C\213l\353B\022\363\202C\262\355\202CB`>C\262\235wB\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\004\000\002\005\000\000\000\000\000\000\000\000\000\000\000\000X\371\202\303\345"
+        "P>C\315\314v\302\236\337\241\303`\345\320=\262\235wB\313!H\303\246\233\304=\022\363\202Cq\275w\302\230"
+        "N>C\022\363\202C\256G\310\302\134\357\231C\262\235wB\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\005"
+        "\000\001\005\000\000\000\000\000\000\000\000\000\000\000\000X\371\202\303\345P>\303\315\314v\302\256"
+        "G\310\302\134\357\231\303\262\235wBq\275w\302\230N>\303\022\363\202C\313!H\303\246\233\304\275\022\363"
+        "\202C\236\337\241\303`\345\320\275\262\235wB\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\006\000\002"
+        "\005\000\000\000\000\000\000\000\000\000\000\000\000\356\374\202\303\0046>C\262\235w\302L\367!\303/\035"
+        "\353B\022\363\202\303L\367!\303/\035\353\302\022\363\202\303\356\374\202\303\0046>\303\262\235w\302\234"
+        "\344\241\303\000\000\000\000\315\314vB\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\007\000\003\005\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\262\355\202\303B`>\303\262\235w\302\240\332!\303\213l\353"
+        "\302\022\363\202\303\022\003wB\262]>\303\022\363\202\303\335\344\307Bm\367\231\303\262\235w\302)\034"
+        "\310\302\020\370\231\303\315\314vB\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\001\005\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\256G\310B\134\357\231\303\262\235w\302q\275wB\230N>\303\022"
+        "\363\202\303\313!HC\246\233\304\275\022\363\202\303\236\337\241C`\345\320\275\262\235w\302X\371\202C"
+        "\345P>\303\315\314vB\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\011\000\002\005\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\236\337\241C`\345\320=\262\235w\302\313!HC\246\233\304=\022\363\202\303"
+        "q\275wB\230N>C\022\363\202\303\256G\310B\134\357\231C\262\235w\302X\371\202C\345P>C\315\314vB\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\012\000\001\005\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\335\344\307Bm\367\231C\262\235w\302\022\003wB\262]>C\022\363\202\303\240\332!\303\213l\353B\022\363"
+        "\202\303\262\355\202\303B`>C\262\235w\302)\034\310\302\020\370\231C\315\314vB\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\013\000\003\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000HC\000\000"
+        "\000\200\000\000\203\303F6wB\0046>\303\000\000\203\303\221\315!\303/\035\353\302\000\000\203\303\221"
+        "\315!\303/\035\353B\000\000\203\303F6wB\0046>C\000\000\203\303\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+        "\000\000\000\000\000\360\247\266\277\323M\342\276\000\000\203C\001\000\000\000\366(\231A\356|q\301\000"
+        "\000\203C\002\000\000\000\037\205!\301\203\300\304\301\000\000\203C\003\000\000\000\201\225\330\301\012"
+        "\327#>\000\000\203C\004\000\000\000d;\033\301L7\310A\000\000\203C\005\000\000\000\244p\234A\303\365t"
+        "A\000\000\203C\006\000\000\000F6RBj\274\024\077\000\000\203C\007\000\000\000j\274(B\000\000\370\301\000"
+        "\000\203C\010\000\000\000w\276\177A\236oO\302\000\000\203C\011\000\000\000\354Q\224\301j\274M\302\000"
+        "\000\203C\012\000\000\000\020X4\302\211A\000\302\000\000\203C\013\000\000\000=\012\134\302;\337/\277"
+        "\000\000\203C\014\000\000\000\351&4\302\341z\000B\000\000\203C\015\000\000\000\004V\211\301\010\254P"
+        "B\000\000\203C\016\000\000\000/\335tAm\347NB\000\000\203C\017\000\000\000\012W,B\270\036\377A\000\000"
+        "\203C\020\000\000\000\307\013\234B\033/\320A\000\000\203C\021\000\000\000\323M\243B)\134\317\300\000"
+        "\000\203C\022\000\000\000\254\034\221B\215\227\026\302\000\000\203C\023\000\000\000\307KUB\341z|\302"
+        "\000\000\203C\024\000\000\000w\276\313A\223\030\236\302\000\000\203C\025\000\000\000\303\365\364\300"
+        "\262\335\245\302\000\000\203C\026\000\000\000J\214\033\3021H\223\302\000\000\203C\027\000\000\000\006"
+        "\001\201\302;\337W\302\000\000\203C\030\000\000\000\254\034\240\302\264\310\320\301\000\000\203C\031"
+        "\000\000\000\364}\251\302B`\305@\000\000\203C\032\000\000\000\134O\226\302\201\225\030B\000\000\203C"
+        "\033\000\000\000\254\034\134\302\270\036~B\000\000\203C\034\000\000\000\0775\325\301\311\266\236B\000"
+        "\000\203C\035\000\000\000\221\355\214@J\214\246B\000\000\203C\036\000\000\000\006\001\022BN\242\224B"
+        "\000\000\203C\037\000\000\000\307KyB+\007XB\000\000\203C \000\000\000\321\042\306B\354QHB\000\000\203"
+        "C!\000\000\000\027Y\332B\362\322\227A\000\000\203C\042\000\000\000uS\334BF\266[\301\000\000\203C#\000"
+        "\000\000\211\301\313By\351,\302\000\000\203C$\000\000\000'\361\253B;\337\214\302\000\000\203C%\000\000"
+        "\00094vBJ\214\271\302\000\000\203C&\000\000\000\250F\006B\311\366\323\302\000\000\203C'\000\000\000\366"
+        "(\354\077\027Y\340\302\000\000\203C(\000\000\000\012\327\362\301\311v\330\302\000\000\203C)\000\000\000"
+        "\362Rm\302\230n\277\302\000\000\203C*\000\000\000!p\247\302\327\243\226\302\000\000\203C+\000\000\000"
+        "\262]\313\302\313!F\302\000\000\203C,\000\000\000\240Z\337\302'1\226\301\000\000\203C-\000\000\000q\375"
+        "\340\302D\213NA\000\000\203C.\000\000\000\372\276\317\302\333y/B\000\000\203C/\000\000\000\262\335\257"
+        "\3021H\216B\000\000\203C0\000\000\000\031\004\200\302\207V\271B\000\000\203C1\000\000\000j\274\020\302"
+        "\331\016\325B\000\000\203C2\000\000\000\341z\234\300\211\301\337B\000\000\203C3\000\000\000/\335\323"
+        "AN\242\330B\000\000\203C4\000\000\000mgbBj<\300B\000\000\203C5\000\000\000\254\034\242B9\264\227B\000"
+        "\000\203C6\000\000\000\252\261\361B)\334lB\000\000\203C7\000\000\000\033\317\017C\370S\350A\000\000\203"
+        "C8\000\000\000\022C\017C\321\042\333\275\000\000\203C9\000\000\000\360\307\017C\252\361\342\301\000\000"
+        "\203C:\000\000\000\240Z\360B94l\302\000\000\203C;\000\000\000X\271\017C\221me\302\000\000\203C<\000\000"
+        "\000\305`\353B7\311\254\302\000\000\203C=\000\000\000\313\201\017CF\266\253\302\000\000\203C>\000\000"
+        "\000\266s\373B\006A\336\302\000\000\203C\077\000\000\000\033/\271BDK\302\302\000\000\203C@\000\000\000"
+        "L\367\302B\345\020\360\302\000\000\203CA\000\000\000\014\302\214Bj\034\001\303\000\000\203CB\000\000"
+        "\000\213l.B\374\211\011\303\000\000\203CC\000\000\000\213l\201Aus\022\303\000\000\203CD\000\000\000\236"
+        "\3577\301hq\033\303\000\000\203CE\000\000\000!\260\237\301\024\216\005\303\000\000\203CF\000\000\000"
+        "\211\301\030\302\262\035$\303\000\000\203CG\000\000\0007\2118\302\374)\014\303\000\000\203CH\000\000"
+        "\000\207\326\207\302\360G\032\303\000\000\203CI\000\000\000\205k\202\302\362\222\356\302\000\000\203"
+        "CJ\000\000\000\301\012\251\302\234\204\003\303\000\000\203CK\000\000\000b\220\312\302+\207\330\302\000"
+        "\000\203CL\000\000\000u\223\354\302\024.\252\302\000\000\203CM\000\000\000\213\014\007\303\020Xw\302"
+        "\000\000\203CN\000\000\000N\042\030\303\002\253\031\302\000\000\203CO\000\000\000\213\354\006\303\270"
+        "\036\277\301\000\000\203CP\000\000\000R8)\303\317\367o\301\000\000\203CQ\000\000\000\307k\024\303\010"
+        "\254\034>\000\000\203CR\000\000\000\360\347(\303\033/{A\000\000\203CS\000\000\000\244\220\006\303-\262"
+        "\272A\000\000\203CT\000\000\000y\011\030\303\262\035\033B\000\000\203CU\000\000\00033\007\303\362\322"
+        "wB\000\000\203CV\000\000\000\014\302\354\302\262]\252B\000\000\203CW\000\000\000\215\327\313\302\317"
+        "\267\327B\000\000\203CX\000\000\000/\035\251\302y\351\003C\000\000\203CY\000\000\000u\023\201\302\221"
+        "\355\356B\000\000\203CZ\000\000\000\321\342\206\302-\022\033C\000\000\203C[\000\000\000\337\317;\302"
+        "\012W\014C\000\000\203C\134\000\000\00033\031\302=\212$C\000\000\203C]\000\000\0005^\240\301\3450\006"
+        "C\000\000\203C^\000\000\000d;9\301\276\237\033C\000\000\203C_\000\000\000\223\030~Ao\362\022C\000\000"
+        "\203C`\000\000\000'\261,B\354\361\011C\000\000\203Ca\000\000\000\002k\215B)\334\000C\000\000\203Cb\000"
+        "\000\000\223\330\303B1\210\360B\000\000\203Cc\000\000\000{\024\271B\207V\303B\000\000\203Cd\000\000\000"
+        "\335\244\373B\311v\337B\000\000\203Ce\000\000\000mg\353B\264\310\255B\000\000\203Cf\000\000\000\226\203"
+        "\017C\341:\255B\000\000\203Cg\000\000\000q\235\017CD\213dB\000\000\203Ch\000\001\000w\276\216B\347\233"
+        "_\303o\322\350Bi\000\001\000\374\251\276B\321b[\303\037E\333Bj\000\001\000\027Y\224B\217\302j\303'\361"
+        "\272Bk\000\001\000V\016DB\274Tj\303\205\253\333Bl\000\001\000\305\240UB\313A[\303\374\311\007Cm\000\001"
+        "\000\014\202\245B\345\320Q\303)\234\007Cn\000\001\000y\351\352B\376TH\303u3\004Co\000\001\000\360\347"
+        "\363B\006\201V\303'\361\314Bp\000\001\000\364}\330B\020\030h\303\325\370\232Bq\000\001\000B\240\234B"
+        "\242\245v\303\254\234\210Br\000\001\000\264\310<Bu\363{\303Z\344\232Bs\000\001\000Nb\312A\232yv\3037"
+        "\311\312Bt\000\001\000\006\201\237AR\030h\303\024\016\004Cu\000\001\000R\270\015BD\013V\303\337\317\034"
+        "Cv\000\001\000mg~Bw^H\3037i%Cw\000\001\000\077\365\277B\033\257B\303L7\034Cx\000\001\000\303\225\000"
+        "C\022\2435\303\211\341 Cy\000\001\000y\211\021CT#>\303\254<\006Cz\000\001\000{\364\026C\327\243K\303"
+        "\010l\322B{\000\001\000\0127\021C'\261[\303\274t\234B|\000\001\000L\367\377B\207vl\303\205\353cB}\000"
+        "\001\000\024.\312B\203\300{\303{\0242B~\000\001\000-r\214B\376\024\203\303\002+/B\177\000\001\000\270"
+        "\036\037Bq}\205\303\272\311UB\200\000\001\000\035ZhA\262}\204\303\303\265\221B\201\000\001\000\262\235"
+        "O\300\244\200\200\303\217\002\306B\202\000\001\000\256G\011\301\301\012s\303\246\333\000C\203\000\001"
+        "\000\347\373\001\300\321\242b\303T\003\034C\204\000\001\000o\022{A\315\254Q\303hQ1C\205\000\001\000\360"
+        "'#B\211AC\303\347;=C\206\000\001\000\037\205\220B;_8\303j|>C\207\000\001\000\323M\316B=\2523\303\325"
+        "X4C\210\000\001\000/}\010C\000@%\303y);C\211\000\001\000Pm\036Cb\220*\303\276\177#C\212\000\001\000'"
+        "1-C\203@4\303\260\362\007C\213\000\001\000\027\2312C\234\344@\303\321\042\331B\214\000\001\000Fv0C'\021"
+        "P\303V\016\242B\215\000\001\000D\353$Cd[a\303\246\033]B\216\000\001\000\307k\022CLWq\303d;\021B\217\000"
+        "\001\000\024n\363B\276_\200\303\033/\262A\220\000\001\000\370\223\270B\356\234\206\303\331\316\205A\221"
+        "\000\001\000\333\371wBm\327\212\303y\351\232A\222\000\001\00033\001BB\340\214\303\264\310\357A\223\000"
+        "\001\000d;\273@%\266\214\303\242\305;B\224\000\001\000\037\205}\301\201\025\212\303'\261\214B\225\000"
+        "\001\000\0775\360\301\254\134\205\303\327#\302B\226\000\001\000P\015\017\302\356|}\303\370\223\373B\227"
+        "\000\001\000\006\201\006\302\256Gn\303\234d\031C\230\000\001\000\354Q\261\3013s]\303'Q2C\231\000\001"
+        "\000\215\227\202\300\376TM\303J\314EC\232\000\001\000m\347\244A5^>\303\372\376RC\233\000\001\000\366"
+        "\250DB\000 2\303\226\243XC\234\000\001\0005\236\240B\303\025)\303\004\226VC\235\000\001\000\014\002\334"
+        "Bo\362$\303#\033LC\236\000\001\000}_\027C\374)\031\303u\363HC\237\000\001\000\372\3767C\325\270\030\303"
+        "\211\2415C\240\000\001\000\010\354CC\207\366!\303\236\257\034C\241\000\001\000\226cPC\035z*\303=\312"
+        "\004C\242\000\001\000\027\031IC\276\377=\303\376T\310B\243\000\001\000\205\253\134C\303u3\303\341:\330"
+        "B\244\000\001\000\201\225RC\313\201G\303'q\230B\245\000\001\000\341\232hC)\134<\303B\240\247B\246\000"
+        "\001\000\360\007dC\347\273K\303\246\233eB\247\000\001\000m\207AC\211\201U\303J\214pB\250\000\001\000"
+        "\240zOC\276\177Z\303\201\025(B\251\000\001\000d\373;C\376\324h\303\311v\326A\252\000\001\000w~(C3\323"
+        "v\303\362\322CA\253\000\001\000`\245\024C}\237\202\303o\022;\300\254\000\001\000;\237\000C\303\345\211"
+        "\303\217\302\221\301\255\000\001\000\264\010\340B\305P\210\303\260r\370\277\256\000\001\000\254\234\332"
+        "B=\352\220\303m\347\003\302\257\000\001\000D\213\270B+\347\216\303\203\300l\301\260\000\001\000\211\001"
+        "\237B\256\267\225\303\331N\003\302\261\000\001\000\360\347\205B\347\273\217\303m\347\023\300\262\000"
+        "\001\000P\015^B\002\273\225\303\177j\220\301\263\000\001\000\213l\371A\266\263\225\303#\3339\300\264"
+        "\000\001\000\256G\325@\315\274\225\303^\272AA\265\000\001\000)\134\215\301`\265\225\303J\014\332A\266"
+        "\000\001\000\213l)\3027\271\225\303\354\321)B\267\000\001\000\331\316\006\302\211\321\217\303\242EnB"
+        "\270\000\001\000\376\024\206\302\356\274\225\303\254\234fB\271\000\001\000w>^\3027\371\216\303{\224\230"
+        "B\272\000\001\000m\247\237\302q\355\220\3039\264\247B\273\000\001\000\213\354U\302\252q\210\303\024\256"
+        "\307B\274\000\001\000F6\226\302\004\306\211\303DK\330B\275\000\001\000\366\350\214\302\213\234\202\303"
+        "\031\204\004C\276\000\001\000\016\255\203\302\327\343v\303\010\354\034C\277\000\001\000-2u\302\313\341"
+        "h\303\217\3024C\300\000\001\000\217Bb\302\337\017Z\303\335\004NC\301\000\001\000o\022\010\302\335dU\303"
+        "\311\366HC\302\000\001\000\002\253N\302\000\240K\303\362rfC\303\000\001\000\236\357\335\301\207vG\303"
+        "\274\224_C\304\000\001\000\313\241\364\301\221M<\303\033\217vC\305\000\001\000'1\370\277D\353=\303\272"
+        "\311aC\306\000\001\000\260rp\300h\2613\303)\134vC\307\000\001\000\250\306\274A-\262*\303h\221vC\310\000"
+        "\001\000\264\310KBw\336!\3039tvC\311\000\001\000\376\024\235B\012\367\030\303FVvC\312\000\001\000\315"
+        "L\323B\205\013\020\303J\214vC\313\000\001\000w>\335B\252Q\031\303\311\326aC\314\000\001\000\260R\005"
+        "C'\321\006\303\000\000wC\315\000\001\000\327\343\010Co\362\021\303B\240_C\316\000\001\000\203@\037C\323"
+        "\015\007\303%\206fC\317\000\001\000\006\341+C;\037\020\303\035zMC\320\000\002\000\325\370jC\323M\342"
+        ">\134\317\347B\321\000\002\000`\305aC\356|qA\024N\006C\322\000\002\000X\331nC\203\300\304A\323M\330B"
+        "\323\000\002\000hqvC\012\327#\276\033\357\271B\324\000\002\000\213\254nCL7\310\301\014\002\331B\325\000"
+        "\002\000\207\226aC\303\365t\301\010\254\006C\326\000\002\0009\324RCj\274\024\277\134/$C\327\000\002\000"
+        "\215wWC\000\000\370A7\351\032C\330\000\002\000\134/cC\236oOB\035z\003C\331\000\002\000B\240rCj\274MB"
+        "\2602\311B\332\000\002\000\276\177~C\211A\000BF\266\231B\333\000\002\000\020x\201C;\337/\077\303\365"
+        "\207B\334\000\002\000^z~C\341z\000\302J\314\231B\335\000\002\000\022\003rC\010\254P\302m\247\313B\336"
+        "\000\002\000/}cCm\347N\302\270\336\002C\337\000\002\000b\020WC\270\036\377\301L\267\033C\340\000\002"
+        "\000!pGC\033/\320\301\012\367:C\341\000\002\000\244\320EC)\134\317@F6>C\342\000\002\000\014\342IC\215"
+        "\227\026Bu\0236C\343\000\002\000)|RC\341z|B\000\340$C\344\000\002\000\252\361^C\223\030\236B\303\365"
+        "\013C\345\000\002\000\014\302mC\262\335\245B\002\253\334B\346\000\002\000\035\272{C1H\223BP\315\244B"
+        "\347\000\002\000m\227\203C;\337WB\303\365mB\350\000\002\000\354\021\207C\264\310\320A\345P6B\351\000"
+        "\002\000V\036\210CB`\305\3007\211%B\352\000\002\000X\371\205C\201\225\030\302\035\332GB\353\000\002\000"
+        "\027y\201C\270\036~\302\221\355\207B\354\000\002\000\006AvC\311\266\236\302\244\260\272B\355\000\002"
+        "\000/]hCJ\214\246\302q=\362B\356\000\002\000N\002ZCN\242\224\302\370\323\025C\357\000\002\000\303uNC"
+        "+\007X\302\213\354,C\360\000\002\000f\006>C\354QH\302\272\311MC\361\000\002\000\211\2019C\362\322\227"
+        "\301\266\323VC\362\000\002\000!\0209CF\266[AF\266WC\363\000\002\000\335\304<Cy\351,B\016MPC\364\000\002"
+        "\000\014\342CC;\337\214B\362\022BC\365\000\002\000\024\316NCJ\214\271B\246;,C\366\000\002\000\354Q[C"
+        "\311\366\323B\2744\023C\367\000\002\000N\202iC\027Y\340B\374\251\355B\370\000\002\0007\351wC\311v\330"
+        "Bb\020\264B\371\000\002\000\134o\202C\230n\277Bd;\200B\372\000\002\000\226\343\207C\327\243\226B\077"
+        "5)B\373\000\002\000\020\350\213C\313!FBT\343\321A\374\000\002\0009$\216C'1\226AB`\212A\375\000\002\000"
+        "\362R\216CD\213N\301\037\205\204A\376\000\002\000`e\214C\333y/\302L7\302A\377\000\002\000\335\324\210"
+        "C1H\216\302\321\042\032B\000\001\002\000#{\203C\207V\271\302^\272oB\001\001\002\000\234\204zC\331\016"
+        "\325\302\321\242\251B\002\001\002\000`\205lC\211\301\337\302\262\235\341B\003\001\002\000q}^CN\242\330"
+        "\3025\336\014C\004\001\002\000\335\004QCj<\300\302V\316'C\005\001\002\000\274\024FC9\264\227\302\221"
+        "\255=C\006\001\002\000\366H4C)\334l\302ZDaC\007\001\002\000\226\003*C\370S\350\301\024\316uC\010\001"
+        "\002\000NB*C\321\042\333=\345PuC\011\001\002\000\351\006*C\252\361\342A\256\307uC\012\001\002\000\201"
+        "\2254C94lB\002\253`C\013\001\002\000\221\015*C\221meB^\272uC\014\001\002\000o\2625C7\311\254Bhq^C\015"
+        "\001\002\000f&*CF\266\253B\366\210uC\016\001\002\000\035\0322C\006A\336B\313\241eC\017\001\002\000\010"
+        "\354@CDK\302B\372\376GC\020\001\002\000\347\273>C\345\020\360B\372^LC\021\001\002\000#\333JCj\034\001"
+        "C\006!4C\022\001\002\000\274\324VC\374\211\011C\331.\034C\023\001\002\000X\031cCus\022C\250\246\003C"
+        "\024\001\002\000\333yoChq\033C\315\314\325B\025\001\002\000\022CsC\024\216\005C\360\247\306B\026\001"
+        "\002\000=j{C\262\035$CJ\014\246B\027\001\002\000\317\367~C\374)\014C\004\326\227B\030\001\002\000\002"
+        "[\204C\360G\032Cq\275aB\031\001\002\000\000\300\203C\362\222\356B\221mkB\032\001\002\000\211\021\210"
+        "C\234\204\003C\020X&B\033\001\002\000\006\321\213C+\207\330B\217\302\324A\034\001\002\000\230\236\217"
+        "C\024.\252B\335$6A\035\001\002\0005^\223C\020XwB\027\331f\300\036\001\002\000B0\227C\002\253\031B\240"
+        "\032\227\301\037\001\002\000\012W\223C\270\036\277A\024\256_\300 \001\002\000o\002\233C\317\367oA\024"
+        "\256\010\302!\001\002\000\307[\226C\010\254\034\276\207\026y\301\042\001\002\000b\360\232C\033/{\301"
+        "V\216\007\302#\001\002\000oB\223C-\262\272\301\321\042K\300$\001\002\000\301*\227C\262\035\033\302sh"
+        "\226\301%\001\002\000\311f\223C\362\322w\302\356|o\300&\001\002\000\327\243\217C\262]\252\302\376\324"
+        "4A'\001\002\000\242\365\213C\317\267\327\302\033/\320A(\001\002\000\226\023\210Cy\351\003\303L7&B)\001"
+        "\002\000y\231\203C\221\355\356\302\004\326mB*\001\002\000\337\077\204C-\022\033\303\244pcB+\001\002\000"
+        "\201U\177C\012W\014\303;_\226B,\001\002\000\311v{C=\212$\303\232\331\245B-\001\002\000\315LsC\3450\006"
+        "\303\006\201\306B.\001\002\000\022\203oC\276\237\033\303m\247\325B/\001\002\000#;cCo\362\022\303\217"
+        "b\003C0\001\002\000f\006WC\354\361\011\303\307\313\033C1\001\002\000\201\265JC)\334\000\303\213l4C2\001"
+        "\002\000y\211>C1\210\360\302\327\303LC3\001\002\000\354\361@C\207V\303\3023\363GC4\001\002\000\033\017"
+        "2C\311v\337\302\215\267eC5\001\002\000\345\2605C\264\310\255\302{t^C6\001\002\000\242%*C\341:\255\302"
+        "\177\212uC7\001\002\000\333\031*CD\213d\302\313\241uC8\001\003\000Ha\220B\347\233_C\134\317\347B9\001"
+        "\003\000\351\246]B\217b[C\024N\006C:\001\003\000\016\255IBN\302jC\323M\330B;\001\003\000/\235\230B\376"
+        "TjC\033\357\271B<\001\003\000/\035\303B\014B[C\014\002\331B=\001\003\000D\213\250B\345\320QC\010\254"
+        "\006C>\001\003\000\360g\203B\274THC\134/$C\077\001\003\000ff\024BB\200VC7\351\032C@\001\003\000b\020"
+        "\247A\215\027hC\035z\003CA\001\003\000\325x\320A\037\245vC\2602\311BB\001\003\000\232\231@Bu\363{CF\266"
+        "\231BC\001\003\000\333\271\236B\035zvC\303\365\207BD\001\003\000\270^\332B\325\030hCJ\314\231BE\001\003"
+        "\000P\315\370B\010\014VCm\247\313BF\001\003\000\347\373\356B\372^HC\270\336\002CG\001\003\000u\223\301"
+        "B\033\257BCL\267\033CH\001\003\000\014\302\254B\217\2425C\012\367:CI\001\003\000/\335[B\217\042>CF6>"
+        "CJ\001\003\000\327\243\324A\321\242KCu\0236CK\001\003\000\177j\240@!\260[C\000\340$CL\001\003\000\351"
+        "&\311\300\201ulC\303\365\013CM\001\003\000`\345\254\300\276\277{C\002\253\334BN\001\003\0001\010\370"
+        "@\335\024\203CP\315\244BO\001\003\000\014\002\360AP}\205C\303\365mBP\001\003\000\305\240jB\323}\204C"
+        "\345P6BQ\001\003\000\347\373\263B\345\200\200C7\211%BR\001\003\000s(\356B\307\013sC\035\332GBS\001\003"
+        "\000bp\014C\327\243bC\221\355\207BT\001\003\000\252\221\027C\323\255QC\244\260\272BU\001\003\000\305"
+        "\000\027CNBCCq=\362BV\001\003\000J\014\012C}_8C\370\323\025CW\001\003\000\370S\346B=\2523C\213\354,C"
+        "X\001\003\0003\263\324B\276\077%C\272\311MCY\001\003\000}\277\226B\337\217*C\266\323VCZ\001\003\000\022"
+        "\2030B\276\0774CF\266WC[\001\003\000\217\302\211AT\343@C\016MPC\134\001\003\000\276\237\316\300\337\017"
+        "PC\362\022BC]\001\003\000\262\235\302\301\035ZaC\246;,C^\001\003\000\201\025\004\302\004VqC\2744\023"
+        "C_\001\003\000\232\031\012\302;_\200C\374\251\355B`\001\003\000\246\233\322\301\213\234\206Cb\020\264"
+        "Ba\001\003\000!\260&\301\012\327\212Cd;\200Bb\001\003\000\262\235EAB\340\214C\0775)Bc\001\003\000\230"
+        "n\035BF\266\214CT\343\321Ad\001\003\000j\374\213B\303\025\212CB`\212Ae\001\003\000\333y\310B/]\205C\037"
+        "\205\204Af\001\003\000\262}\000C5~}CL7\302Ag\001\003\000\3339\030C\366HnC\321\042\032Bh\001\003\000\234"
+        "d)C\274t]C^\272oBi\001\003\000\240\2722CFVMC\321\242\251Bj\001\003\000\262}3C}_>C\262\235\341Bk\001\003"
+        "\000\335\304+C\305 2C5\336\014Cl\001\003\000\006\001\034CF\026)CV\316'Cm\001\003\000\232Y\005Co\362$"
+        "C\221\255=Cn\001\003\000\323\015\340B\272)\031CZDaCo\001\003\000bP\240B\020\270\030C\024\316uCp\001\003"
+        "\000D\013RB\201\365!C\345PuCq\001\003\000\372~\314A\325x*C\256\307uCr\001\003\000\264\310\266\2765\376"
+        "=C\002\253`Cs\001\003\000\000\000\000\3009t3C^\272uCt\001\003\000\321\042\320\301B\200GChq^Cu\001\003"
+        "\000\232\231\350\301^Z<C\366\210uCv\001\003\000\246\233J\302\333\271KC\313\241eCw\001\003\000\240\032"
+        "\003\302\276\177UC\372\376GCx\001\003\000;\337\134\302\262}ZC\372^LCy\001\003\000\205kp\3023\323hC\006"
+        "!4Cz\001\003\000\215\327\200\302h\321vC\331.\034C{\001\003\000F6\212\302\270\236\202C\250\246\003C|\001"
+        "\003\000\177\252\223\302\376\344\211C\315\314\325B}\001\003\000NbO\302BP\210C\360\247\306B~\001\003\000"
+        "\264\310\234\302y\351\220CJ\014\246B\177\001\003\000V\016Z\302\250\346\216C\004\326\227B\200\001\003"
+        "\000)\334\201\302+\267\225Cq\275aB\201\001\003\000\207\026\000\302\205\273\217C\221mkB\202\001\003\000"
+        "\252\361#\302\301\272\225C\020X&B\203\001\003\000\230n\204\301u\263\225C\217\302\324A\204\001\003\000"
+        "\203\300\372@\315\274\225C\335$6A\205\001\003\000u\023\001B\242\265\225C\027\331f\300\206\001\003\000"
+        "\254\234cB\232\271\225C\240\032\227\301\207\001\003\000\024\256\210B\354\321\217C\024\256_\300\210\001"
+        "\003\000\362\022\243Bq\275\225C\024\256\010\302\211\001\003\000\335$\272B\272\371\216C\207\026y\301\212"
+        "\001\003\000B`\335B5\356\220CV\216\007\302\213\001\003\000yi\342BNr\210C\321\042K\300\214\001\003\000"
+        "\230N\002C\311\306\211Csh\226\301\215\001\003\000\343\005\026CP\235\202C\356|o\300\216\001\003\000\272"
+        "\311)C\242\345vC\376\3244A\217\001\003\000{\024=C\226\343hC\033/\320A\220\001\003\000V\216QC\354\021"
+        "ZCL7&B\221\001\003\0003\363BC\250fUC\004\326mB\222\001\003\000L7eC\014\242KC\244pcB\223\001\003\000}"
+        "_TCRxGC;_\226B\224\001\003\000\2521jC\236O<C\232\331\245B\225\001\003\000\230\316JC\315\354=C\006\201"
+        "\306B\226\001\003\000`\005^C\362\2623Cm\247\325B\227\001\003\000\027\371QCu\263*C\217b\003C\230\001\003"
+        "\000\327\243EC}\337!C\307\313\033C\231\001\003\000\25219C\317\367\030C\213l4C\232\001\003\000NB-C\010"
+        "\014\020C\327\303LC\233\001\003\000\022\203\030C\354Q\031C3\363GC\234\001\003\000yI!C'\321\006C\215\267"
+        "eC\235\001\003\000\366\310\012Co\362\021C{t^C\236\001\003\0009\364\006C\323\015\007C\177\212uC\237\001"
+        "\003\000\331\316\325B\270\036\020C\313\241uC\240\001\004\000#[>\303\211\301\011C\134\317\347B\241\001"
+        "\004\000%\206\077\303q\375\360B\024N\006C\242\001\004\000b\260O\303q\375\360B\323M\330B\243\001\004\000"
+        "1HG\303)\374\020C\033\357\271B\244\001\004\000Ha2\3037\211 C\014\002\331B\245\001\004\000H\201-\303\347"
+        "\373\020C\010\254\006C\246\001\004\000\0279*\3037\311\370B\134/$C\247\001\004\000\272\211@\303T#\313"
+        "B7\351\032C\250\001\004\000mGV\303y)\267B\035z\003C\251\001\004\000`\205b\303\203\000\312B\2602\311B"
+        "\252\001\004\000\262\275`\303PM\367BF\266\231B\253\001\004\000\226\343Q\303\335\244\027C\303\365\207"
+        "B\254\001\004\000}\377:\303b\220/CJ\314\231B\255\001\004\000\305 %\303\274t8Cm\247\313B\256\001\004\000"
+        "\226\243\031\303\337\217/C\270\336\002C\257\001\004\000\372>\033\303\0046\030CL\267\033C\260\001\004"
+        "\000\221\015\022\303mG\012C\012\367:C\261\001\004\000\020\330#\303\134\017\336BF6>C\262\001\004\000{"
+        "t9\303yi\260Bu\0236C\263\001\004\000\022cO\303\134O\221B\000\340$C\264\001\004\000\370\323b\303\033/"
+        "\206B\303\365\013C\265\001\004\000\325\030q\303\337O\221B\002\253\334B\266\001\004\000\236\357v\303\037"
+        "\305\260BP\315\244B\267\001\004\000\031\244t\303h\021\336B\303\365mB\270\001\004\000T\343i\303\205\253"
+        "\011C\345P6B\271\001\004\000w\236X\303\313\001%C7\211%B\272\001\004\000^ZB\303#[<C\035\332GB\273\001"
+        "\004\000%&,\303\333\231KC\221\355\207B\274\001\004\0009\224\030\303\354\361PC\244\260\272B\275\001\004"
+        "\000=\012\013\3033\363KCq=\362B\276\001\004\000\244\260\004\303\031D<C\370\323\025C\277\001\004\000\264"
+        "H\007\303\010\014%C\213\354,C\300\001\004\000\020\230\370\302\3035\030C\272\311MC\301\001\004\000\010"
+        "\354\012\3031\310\370B\266\323VC\302\001\004\000=\312\035\303\004V\303BF\266WC\303\001\004\000B 2\303"
+        "L\367\227B\016MPC\304\001\004\000\276\337G\303\254\234hB\362\022BC\305\001\004\000\012\327]\303\006\001"
+        ":B\246;,C\306\001\004\000^\272o\303!\260,B\2744\023C\307\001\004\000\325\330~\303\022\003:B\374\251\355"
+        "B\310\001\004\000+\027\204\303\276\237hBb\020\264B\311\001\004\000\215\247\205\303\315\314\227Bd;\200"
+        "B\312\001\004\000\217\022\204\303\276\237\305B\0775)B\313\001\004\000\356|\177\303D\313\370BT\343\321"
+        "A\314\001\004\000%\006q\303\264\350\027CB`\212A\315\001\004\000\260\262^\303\211\3011C\037\205\204A\316"
+        "\001\004\000HaI\3037\211HCL7\302A\317\001\004\000\376\2243\303\264hZC\321\042\032B\320\001\004\000`E"
+        "\036\3037\211eC^\272oB\321\001\004\000\230\016\014\303\033oiC\321\242\251B\322\001\004\000\024.\373\302"
+        "\366\210eC\262\235\341B\323\001\004\000y\251\350\3021hZC5\336\014C\324\001\004\000\2744\341\302w\236"
+        "HCV\316'C\325\001\004\000\201U\347\302\205\3131C\221\255=C\326\001\004\000\223\030\336\302\276\337\031"
+        "CZDaC\327\001\004\0003\363\360\302\240\332\366B\024\316uC\330\001\004\000\024\316\011\303^\372\307B\345"
+        "PuC\331\001\004\000\240:\032\303\341\372\231B\256\307uC\332\001\004\000\024\3164\303\356|iB\002\253`"
+        "C\333\001\004\000\374I+\303\0775VB^\272uC\334\001\004\000\250\306E\303\270\236\023Bhq^C\335\001\004\000"
+        "w\036<\303\213l\364A\366\210uC\336\001\004\0001hQ\303\022\203lA\313\241eC\337\001\004\000\221-U\303F"
+        "6\013B\372\376GC\340\001\004\000j\334`\3031\010pA\372^LC\341\001\004\000\006\001p\303+\207lA\006!4C\342"
+        "\001\004\000\037\245~\303J\014pA\331.\034C\343\001\004\000m\347\206\303b\020pA\250\246\003C\344\001\004"
+        "\000\262\215\216\303{\024pA\315\314\325B\345\001\004\000\012\247\211\303\203\300\013B\360\247\306B\346"
+        "\001\004\000\230\356\225\303{\024pAJ\014\246B\347\001\004\000{T\220\303T\343\021B\004\326\227B\350\001"
+        "\004\000\205k\230\303L7\366Aq\275aB\351\001\004\000\077\245\215\303\006\201iB\221mkB\352\001\004\000"
+        "\307\273\224\303d;VB\020X&B\353\001\004\000\230\356\220\303\323\215\231B\217\302\324A\354\001\004\000"
+        "\2602\215\303\364\375\307B\335$6A\355\001\004\000\201e\211\303\024n\366B\027\331f\300\356\001\004\000"
+        "\341\232\205\303+\247\022C\240\032\227\301\357\001\004\000hq|\303\211\341\031C\024\256_\300\360\001\004"
+        "\000!\320\201\303L\027*C\024\256\010\302\361\001\004\000\3541s\303\211\3410C\207\026y\301\362\001\004"
+        "\000\020xq\303\317\327BCV\216\007\302\363\001\004\000\323\215`\303w\376\077C\321\042K\300\364\001\004"
+        "\000\315\314]\303{\024QCsh\226\301\365\001\004\000\201\025J\303\256g_C\356|o\300\366\001\004\000RX6\303"
+        "%\306mC\376\3244A\367\001\004\000\337\017#\303\301\312{C\033/\320A\370\001\004\000\327\243\016\303\317"
+        "W\205CL7&B\371\001\004\000\207\266\016\303^Z{C\004\326mB\372\001\004\000\205\253\365\302Fv\214C\244p"
+        "cB\373\001\004\000\366(\370\302;\317\203C;_\226B\374\001\004\0003s\325\302%v\214C\232\331\245B\375\001"
+        "\004\000\177\352\353\302-\222{C\006\201\306B\376\001\004\000\215\227\314\302\215W\205Cm\247\325B\377"
+        "\001\004\000\010\354\302\302-r|C\217b\003C\000\002\004\000\203\300\271\302\356\374mC\307\313\033C\001"
+        "\002\004\000\211\201\260\302ff_C\213l4C\002\002\004\000\374\351\246\302\002KQC\327\303LC\003\002\004"
+        "\000\276_\305\302\016m@C3\363GC\004\002\004\000\014\302\234\302\323\015CC\215\267eC\005\002\004\000\201"
+        "\325\277\302\317\0271C{t^C\006\002\004\000d{\255\302\077\025*C\177\212uC\007\002\004\000\337\017\320"
+        "\302\3764\022C\313\241uC\010\002\005\000F\326=\303\223x\012\303\134\317\347B\011\002\005\000\360\307"
+        "-\303=\352\020\303\024N\006C\012\002\005\000\351\3062\303\374I \303\323M\330B\013\002\005\000RxG\303"
+        "\333\271\020\303\033\357\271B\014\002\005\000P\315O\303\376\024\360\302\014\002\331B\015\002\005\000"
+        "\006\201\077\303\010l\360\302\010\254\006C\016\002\005\000\360\347*\303m\347\366\302\134/$C\017\002\005"
+        "\000R\030\034\303^\272\027\3037\351\032C\020\002\005\000\244P\031\303\262}/\303\035z\003C\021\002\005"
+        "\000V\016&\303\02798\303\2602\311B\022\002\005\000\010\014;\303\360\207/\303F\266\231B\023\002\005\000"
+        "\376\024Q\303H\301\030\303\303\365\207B\024\002\005\000\211\301`\303\236/\367\302J\314\231B\025\002\005"
+        "\000\274tb\303\215\027\310\302m\247\313B\026\002\005\000-rV\303j\274\267\302\270\336\002C\027\002\005"
+        "\000)\274@\303X9\311\302L\267\033C\030\002\005\000\335\2440\303\027Y\300\302\012\367:C\031\002\005\000"
+        "\035:\034\303\256\007\363\302F6>C\032\002\005\000\2602\015\303\372\036\025\303u\0236C\033\002\005\000"
+        "\134/\005\303\366\310.\303\000\340$C\034\002\005\000\351\346\005\303w\376B\303\303\365\013C\035\002\005"
+        "\000\240\232\017\303R\330N\303\002\253\334B\036\002\005\000\262] \303\272\211O\303P\315\244B\037\002"
+        "\005\000\26025\303#[F\303\303\365mB \002\005\000\3764K\303\343\3453\303\345P6B!\002\005\000\270\336_"
+        "\303\351\006\033\3037\211%B\042\002\005\000-2o\303\037E\375\302\035\332GB#\002\005\000\077\325v\303\262"
+        "\235\311\302\221\355\207B$\002\005\0005\336u\303\207\026\241\302\244\260\272B%\002\005\000\033\357l\303"
+        "\010l\212\302q=\362B&\002\005\000\024\016\134\303\272\011\210\302\370\323\025C'\002\005\000%\306F\303"
+        "oR\233\302\213\354,C(\002\005\000\205+7\303#[\216\302\272\311MC)\002\005\000d;!\303\262]\273\302\266"
+        "\323VC*\002\005\000\343\245\015\303\242\305\357\302F\266WC+\002\005\000\262\235\376\302\221\355\021\303"
+        "\016MPC,\002\005\000\335$\352\302\372\036,\303\362\022BC-\002\005\000\323\215\341\302\356\234D\303\246"
+        ";,C.\002\005\000+G\346\302m\247V\303\2744\023C/\002\005\000\077\365\365\302\006\001d\303\374\251\355"
+        "B0\002\005\000o\362\010\303\256Gi\303b\020\264B1\002\005\000\272\311\032\303\242\305f\303d;\200B2\002"
+        "\005\000\333\231/\303\230\256\134\303\0775)B3\002\005\000\014BE\303\002\213L\303T\343\321A4\002\005\000"
+        "9\364Z\303\366H6\303B`\212A5\002\005\000}\337m\303w\336\034\303\037\205\204A6\002\005\000u\363|\303\024"
+        "\216\001\303L7\302A7\002\005\000d\233\203\303\035\232\316\302\321\042\032B8\002\005\000\341\232\205\303"
+        "\2440\237\302^\272oB9\002\005\000\376\244\204\303\234Dt\302\321\242\251B:\002\005\000\024\216\200\303"
+        "P\015B\302\262\235\341B;\002\005\000=\252s\303\201\225,\3025\336\014C<\002\005\000\325\230a\303Tc4\302"
+        "V\316'C=\002\005\000\004\326L\303\211A\134\302\221\255=C>\002\005\000\264\2504\303\203@h\302ZDaC\077"
+        "\002\005\000/\235\032\303\276\337\230\302\024\316uC@\002\005\000\024\256\011\303\362R\310\302\345PuC"
+        "A\002\005\000\022\303\361\302+\307\365\302\256\307uCB\002\005\000\242\305\336\302\002\353\031\303\002"
+        "\253`CC\002\005\000X\271\317\302d[\022\303^\272uCD\002\005\000\024n\300\302'\2610\303hq^CE\002\005\000"
+        "\305`\256\302Rx)\303\366\210uCF\002\005\000\272\211\235\302\012\227B\303\313\241eCG\002\005\000\266\363"
+        "\305\302q\375\077\303\372\376GCH\002\005\000\211\201\247\302R8Q\303\372^LCI\002\005\0003s\260\302b\260"
+        "_\303\006!4CJ\002\005\000\002\353\271\302\307\213m\303\331.\034CK\002\005\000=J\303\302\215\367{\303"
+        "\250\246\003CL\002\005\000\372\276\314\302\014B\205\303\315\314\325BM\002\005\000\240\232\354\302\264"
+        "\010{\303\360\247\306BN\002\005\0005\336\325\302\207F\214\303J\014\246BO\002\005\000%\306\367\302h\241"
+        "\203\303\004\326\227BP\002\005\000\252\361\366\302{4\214\303q\275aBQ\002\005\000\236\017\017\303\321"
+        "b{\303\221mkBR\002\005\000\347\333\016\303\323-\205\303\020X&BS\002\005\000\215\227\042\303\266\363{"
+        "\303\217\302\324AT\002\005\000\364]6\303\213\254m\303\335$6AU\002\005\000\232\031J\303\234D_\303\027"
+        "\331f\300V\002\005\000\010\014^\303!\320P\303\240\032\227\301W\002\005\000\347[`\3037\211@\303\024\256"
+        "_\300X\002\005\000\270\376q\303\347[B\303\024\256\010\302Y\002\005\000\000`s\303\014\2420\303\207\026"
+        "y\301Z\002\005\000F\366\201\303\345p)\303V\216\007\302[\002\005\000\356\374{\303\347;\032\303\321\042"
+        "K\300\134\002\005\000\211\261\205\303\303U\022\303sh\226\301]\002\005\000\201u\211\303bP\366\302\356"
+        "|o\300^\002\005\000\364=\215\303\327\343\307\302\376\3244A_\002\005\000\262\355\220\303\307\213\232\302"
+        "\033/\320A`\002\005\000#\333\224\303\364\375T\302L7&Ba\002\005\000u\223\215\303X9h\302\004\326mBb\002"
+        "\005\000\345\220\230\303\240\032\360\301\244pcBc\002\005\000\215\207\220\303\024.\022\302;_\226Bd\002"
+        "\005\000\226\023\226\303V\016k\301\232\331\245Be\002\005\000\301\332\211\303\256\307\011\302\006\201"
+        "\306Bf\002\005\000\033\237\216\303b\020n\301m\247\325Bg\002\005\000\177\032\207\303`\345j\301\217b\003"
+        "Ch\002\005\000\177\012\177\303\246\233l\301\307\313\033Ci\002\005\000\254\274o\303Nbn\301\213l4Cj\002"
+        "\005\000\311\326`\303\351&k\301\327\303LCk\002\005\000\006\201U\303u\223\011\3023\363GCl\002\005\000"
+        "^\272Q\303\242Ed\301\215\267eCm\002\005\000\244\020F\303\364\375\021\302{t^Cn\002\005\000!\220<\303\372"
+        "~\357\301\177\212uCo\002\005\000\3622+\3037\011W\302\313\241uCp\002\006\000\317Wj\303d;\277\077uS\352"
+        "\302q\002\006\000\234Da\3039\264X\301\236O\007\303r\002\006\000\234Da\303\246\233\211A\236O\007\303s"
+        "\002\006\000\335$n\303\215\227\315AB \333\302t\002\006\000-Rv\303d;\277\077\010l\272\302u\002\006\000"
+        "\335$n\303\313\241\272\301B \333\302v\002\006\000hQc\303\335\244H\302F6\003\303w\002\006\000hQW\303\337"
+        "O\364\301\3035\033\303x\002\006\000\345\020R\303\252\361R\077F\266%\303y\002\006\000\234\004W\303\246"
+        "\033\006B\033\317\033\303z\002\006\000P\355b\303\351&SB\270\376\003\303{\002\006\000\037\245q\303\270"
+        "\036RB;\037\315\302|\002\006\000\3258~\303\321\242\003B\362\322\232\302}\002\006\000\321r\201\303\252"
+        "\361R>;\037\210\302~\002\006\000\3258~\303\337O\364\301\362\322\232\302\177\002\006\000\354\361q\303"
+        "\354QK\302\016\355\313\302\200\002\006\000\270\236j\303q}\244\302R8\351\302\201\002\006\000\002K\134"
+        "\303VN\227\302\321B\021\303\202\002\006\000\301JP\303\347{e\302NB)\303\203\002\006\000q\035H\303\010"
+        "\254\371\301j\2349\303\204\002\006\000\2440E\303\252\361R>\004v\077\303\205\002\006\000q\035H\303\321"
+        "\242\003Bj\2349\303\206\002\006\000NbP\303\303\365nB3\023)\303\207\002\006\000\002K\134\303\307\013\234"
+        "B\321B\021\303\210\002\006\000\010Lj\303\360g\250B\217\202\352\302\211\002\006\000\205\253x\303Nb\235"
+        "B%\006\261\302\212\002\006\0007y\202\303\211\301nB\020\330\177\302\213\002\006\000D{\206\303\337\317"
+        "\002B^\272\077\302\214\002\006\000\362\342\207\303\252\361R\077}\077)\302\215\002\006\000\321\222\206"
+        "\3035^\357\301\203@>\302\216\002\006\000Ts\202\303R\270f\302\246\033\200\302\217\002\006\000h\261x\303"
+        "\213\354\227\302\230\356\260\302\220\002\006\000\354\361q\303\327c\333\302\016\355\313\302\221\002\006"
+        "\000hQc\303\327c\333\302F6\003\303\222\002\006\000\234DU\303V\016\311\302\134O\037\303\223\002\006\000"
+        "\262\335I\303\345\020\247\302)\0346\303\224\002\006\000\262}@\303\356\374o\302d\333H\303\225\002\006"
+        "\000/]:\303\303\365\356\301)\034U\303\226\002\006\000/\2358\303\252\361R\077j\234X\303\227\002\006\000"
+        "/]:\303\321\242\003B)\034U\303\230\002\006\000\262}@\303\217ByBd\333H\303\231\002\006\000\354\321I\303"
+        "\217\002\254B\26636\303\232\002\006\000\262\335U\303D\313\315B\254\034\036\303\233\002\006\000hQc\303"
+        "\250\006\340BF6\003\303\234\002\006\000s\310q\303\250\006\340B\354\221\314\302\235\002\006\000}_\177"
+        "\303\000\000\316BL7\226\302\236\002\006\000\356\254\205\303Lw\252B\276\237L\302\237\002\006\000\337_"
+        "\212\303\201\225vB\266s\001\302\240\002\006\000\254L\215\303\274\364\000B\323M\245\301\241\002\006\000"
+        "\022S\216\303d;\277\077\022\203\204\301\242\002\006\000\254L\215\3035^\357\301\323M\245\301\243\002\006"
+        "\000\337_\212\303\313\241j\302\266s\001\302\244\002\006\000\321\262\205\303\345\020\247\302\211AL\302"
+        "\245\002\006\000`e\177\303V\016\311\302\276\037\226\302\246\002\006\000\354\321r\303\341:\005\303\213"
+        "l\310\302\247\002\006\000\236\317b\303\270\276\021\303\2329\004\303\250\002\006\000\356|V\303\2157\010"
+        "\3035\336\034\303\251\002\006\000`eJ\3039\364\377\302\016\0155\303\252\002\006\000#\233@\303\020\030"
+        "\300\302\203\240H\303\253\002\006\000\260\022>\303\024\356\355\302\252\261M\303\254\002\006\000\354Q"
+        "5\303\311v\252\302o2_\303\255\002\006\000\341\3721\303m\347\333\302B\340e\303\256\002\006\000!\260)\303"
+        "\311v\252\302\201uv\303\257\002\006\000\31164\303\366(h\302sha\303\260\002\006\000\221\315)\303\341z"
+        "^\302^:v\303\261\002\006\000!\260)\303\307K\330\301\201uv\303\262\002\006\000\221\315)\303\012\327\203"
+        "\077^:v\303\263\002\006\000\221\315)\303\303\365\356A^:v\303\264\002\006\000\221\315)\303;\337kB^:v\303"
+        "\265\002\006\000sH4\303\037\005qB\037Ea\303\266\002\006\000\221\315)\303\354\021\256B^:v\303\267\002"
+        "\006\000\311\0265\303Ha\256Bs\250_\303\270\002\006\000R\0302\303=\212\340B`\245e\303\271\002\006\000"
+        "#\233@\303\217\302\305B\203\240H\303\272\002\006\000\260\022>\303\315\014\362B\252\261M\303\273\002\006"
+        "\000\256GJ\303\256\307\001C\360G5\303\274\002\006\000\356|V\303\002\313\012C5\336\034\303\275\002\006"
+        "\000-\262b\303J\214\023C{t\004\303\276\002\006\000\335\004o\303\134\217\034C\276\237\327\302\277\002"
+        "\006\000\354\321r\303\370\263\007C\213l\310\302\300\002\006\000\215W{\303\260\222%C\207V\246\302\301"
+        "\002\006\000\272\351~\303)\034\015C\134\017\230\302\302\002\006\000\221-\204\303\272\311\033Cu\223d\302"
+        "\303\002\006\000\364m\203\3037\211\361BP\215p\302\304\002\006\000\307\353\207\303\356\234\004C-\262("
+        "\302\305\002\006\000\337\257\213\303B\340\332B`\345\330\301\306\002\006\000\351v\217\303\250\206\254"
+        "Bb\020@\301\307\002\006\000f&\223\303yi~B\240\032/@\310\002\006\000\345\020\227\303\270\236\036B\016"
+        "-\223A\311\002\006\000\366\010\223\3039\264\303A\232\231\021@\312\002\006\000\033\317\232\303\264\310"
+        "\201A\317w\005B\313\002\006\000oB\226\303/\335\244\077\234\304rA\314\002\006\000\033\317\232\303R\270"
+        "f\301\317w\005B\315\002\006\000\256\027\223\303L7\263\301Nb @\316\002\006\000\345\020\227\303\354Q\024"
+        "\302\016-\223A\317\002\006\000\260R\223\303J\014r\302\370S[@\320\002\006\000\303\205\217\303\276_\247"
+        "\3025^<\301\321\002\006\000\337\257\213\303\321\042\326\302`\345\330\301\322\002\006\000\240\372\207"
+        "\303\205K\002\303\250\306'\302\323\002\006\000\205\213\203\303Nb\354\302F\266n\302\324\002\006\000j<"
+        "\204\303\3450\032\303\360\247c\302\325\002\006\000+\007\177\303\301\312\012\303\027\231\227\302\326\002"
+        "\006\000\215W{\303HA#\303\207V\246\302\327\002\006\000\374\311n\303\364=\032\303\307\213\330\302\330"
+        "\002\007\000\213\254\223\302yi^\303uS\352\302\331\002\007\000\205\353b\302\221mZ\303\236O\007\303\332"
+        "\002\007\000'\361\253\302P\355P\303\236O\007\303\333\002\007\000\337\017\304\302\010\214Z\303B \333\302"
+        "\334\002\007\000u\023\233\302\323\315i\303\010l\272\302\335\002\007\000\254\234M\302\260\262i\303B \333"
+        "\302\336\002\007\000\337O\264\301h\261g\303F6\003\303\337\002\007\000\317\367\025\302L7V\303\3035\033"
+        "\303\340\002\007\000`e\203\302\256\207G\303F\266%\303\341\002\007\000\366\250\304\302N\042B\303\033\317"
+        "\033\303\342\002\007\000\360\247\360\302\014\202G\303\270\376\003\303\343\002\007\000\022C\371\302\004"
+        "\226U\303;\037\315\302\344\002\007\000\311\266\333\302)\234g\303\362\322\232\302\345\002\007\000ff\240"
+        "\302y)v\303;\037\210\302\346\002\007\000V\016F\302L7{\303\362\322\232\302\347\002\007\000B`\323\301\134"
+        "\317u\303\016\355\313\302\350\002\007\000\014\002\267@P\215x\303R8\351\302\351\002\007\000\305 x@\226"
+        "\343h\303\321B\021\303\352\002\007\000\027\331\034\301u\323W\303NB)\303\353\002\007\000\313\241\000\302"
+        "\012\367G\303j\2349\303\354\002\007\000%\206t\302\232y;\303\004v\077\303\355\002\007\000%F\272\302\351"
+        "&4\303j\2349\303\356\002\007\000\205k\362\302\232\2713\3033\023)\303\357\002\007\000+G\016\303\250f9"
+        "\303\321B\021\303\360\002\007\000\246{\030\303\134\317D\303\217\202\352\302\361\002\007\000\033\257\027"
+        "\303\230.T\303%\006\261\302\362\002\007\000mg\011\303#\273e\303\020\330\177\302\363\002\007\000\230n"
+        "\344\302\252\261u\303^\272\077\302\364\002\007\0001\210\251\302\307\033\201\303}\077)\302\365\002\007"
+        "\000#\333Z\302J\234\204\303\203@>\302\366\002\007\000\305 \316\301^\372\204\303\246\033\200\302\367\002"
+        "\007\000Zd\223\300\134\377\201\303\230\356\260\302\370\002\007\000\356|\354A!\000\204\303\016\355\313"
+        "\302\371\002\007\000\362R\010B\012\027z\303F6\003\303\372\002\007\000\327\243\355A\335\344i\303\134O"
+        "\037\303\373\002\007\000\037\205\210A\213\314Y\303)\0346\303\374\002\007\000\014\002\033\300)\234I\303"
+        "d\333H\303\375\002\007\000\274t\351\301\027y:\303)\034U\303\376\002\007\000\370Sg\302\260R/\303j\234"
+        "X\303\377\002\007\000\250\306\261\302\362\022'\303)\034U\303\000\003\007\000\372~\355\302b\320#\303d"
+        "\333H\303\001\003\007\0007)\020\303q]%\303\26636\303\002\003\007\000\362\362#\303\035\232+\303\254\034"
+        "\036\303\003\003\007\000f\3060\3039\2245\303F6\003\303\004\003\007\000\270>5\303\004VC\303\354\221\314"
+        "\302\005\003\007\000}\3370\303\307\013S\303L7\226\302\006\003\007\000P\255#\303P\355c\303\276\237L\302"
+        "\007\003\007\000\343%\020\303m't\303\266s\001\302\010\003\007\000^\372\353\302\012g\201\303\323M\245"
+        "\301\011\003\007\000\226\303\262\302\305 \207\303\022\203\204\301\012\003\007\000\347{k\302\313\001\213"
+        "\303\323M\245\301\013\003\007\000#\333\355\301=\252\214\303\266s\001\302\014\003\007\000m\347K\300\276"
+        "\017\214\303\211AL\302\015\003\007\000\356|\205A\002\373\210\303\276\037\226\302\016\003\007\000-\262"
+        "NB\221\015\210\303\213l\310\302\017\003\007\000\307\013\211B\276_\202\303\2329\004\303\020\003\007\000"
+        "{\024}B\201\025v\3035\336\034\303\021\003\007\000\024\256lBy\011h\303\016\0155\303\022\003\007\000\276"
+        "\237\376A)\334T\303\203\240H\303\023\003\007\000\305\240YB1\210Y\303\252\261M\303\024\003\007\000q=\310"
+        "A\264\310F\303o2_\303\025\003\007\000\272IFB\372>K\303B\340e\303\026\003\007\000\000\000\345A\223\270"
+        ";\303\201uv\303\027\003\007\0005^\372\2769T=\303sha\303\030\003\007\000\254\034\332>\024\2562\303^:v"
+        "\303\031\003\007\000\250\306\325\301\356\274)\303\201uv\303\032\003\007\000\331\316U\302\213,!\303^:"
+        "v\303\033\003\007\000\217\302\241\302\022C\030\303^:v\303\034\003\007\000#\033\331\302\037E\017\303^"
+        ":v\303\035\003\007\0001\010\342\302\012\327\030\303\037Ea\303\036\003\007\000;\077\007\303\325\230\006"
+        "\303^:v\303\037\003\007\000\313\341\012\303sH\021\303s\250_\303 \003\007\000\134\317!\303\134\257\006"
+        "\303`\245e\303!\003\007\000\033\217\031\303\276\237\030\303\203\240H\303\042\003\007\000F\326-\303\372"
+        "^\017\303\252\261M\303#\003\007\000\236\3579\303\250F\030\303\360G5\303$\003\007\000\256GF\303\333\031"
+        "!\3035\336\034\303%\003\007\000\006aR\303\211\001*\303{t\004\303&\003\007\000\014\302^\303\345\3602\303"
+        "\276\237\327\302'\003\007\000\223\030L\303B\000=\303\213l\310\302(\003\007\000T#k\303B\340;\303\207V"
+        "\246\302)\003\007\000\333\371T\303\274\324F\303\134\017\230\302*\003\007\000^\332e\303\351FK\303u\223"
+        "d\302+\003\007\000\303\025D\303\315\254T\303P\215p\302,\003\007\000B R\303\331\216Y\303-\262(\302-\003"
+        "\007\000\272i>\303\014\342g\303`\345\330\301.\003\007\000\376\264*\303\341:v\303b\020@\301/\003\007\000"
+        "\331n\027\303\372\036\202\303\240\032/@0\003\007\000\370\023\003\303\205\213\211\303\016-\223A1\003\007"
+        "\000\250F\344\302\033\017\210\303\232\231\021@2\003\007\000F6\336\302\272\271\220\303\317w\005B3\003"
+        "\007\000\024.\274\302\335\264\216\303\234\304rA4\003\007\000\016\355\243\302\303u\225\303\317w\005B5"
+        "\003\007\00094\213\302\301Z\217\303Nb @6\003\007\000`eh\302\311f\225\303\016-\223A7\003\007\000\000\000"
+        "\006\302Fv\225\303\370S[@8\003\007\000\217\302\021\301\262m\225\3035^<\3019\003\007\000\266\363wA\274"
+        "d\225\303`\345\330\301:\003\007\000\022\203\037B{t\225\303\250\306'\302;\003\007\000;\337\370AV^\217"
+        "\303F\266n\302<\003\007\000\004\326\201Bf\226\225\303\360\247c\302=\003\007\000\234\304TB\256\267\216"
+        "\303\027\231\227\302>\003\007\000'1\233B\230\276\220\303\207V\246\302\077\003\007\000V\316\221B\354a"
+        "\211\303\307\213\330\302@\003\010\000\303\265<C\266\363\012\303uS\352\302A\003\010\000\3764>Cm\347\362"
+        "\302\236O\007\303B\003\010\000\217\042,C3S\022\303\236O\007\303C\003\010\000\230\2161C\234\304 \303B"
+        " \333\302D\003\010\000ffFC\364\375\021\303\010l\272\302E\003\010\000\000`NC\0775\362\302B \333\302F\003"
+        "\010\000TcUC\345\020\272\302F6\003\303G\003\010\000`%@C\077\265\313\302\3035\033\303H\003\010\000\207"
+        "v)C\256G\370\302F\266%\303I\003\010\000;\077\032C\014\202\031\303\033\317\033\303J\003\010\000\134\217"
+        "\030C\012\0270\303\270\376\003\303K\003\010\000w\236$Cs\2108\303;\037\315\302L\003\010\000uS:C\016\015"
+        "0\303\362\322\232\302M\003\010\000\274TQC\317W\030\303;\037\210\302N\003\010\000\270\236_C'q\371\302"
+        "\362\322\232\302O\003\010\000q\235aC\221-\312\302\016\355\313\302P\003\010\000m'nCj\274\216\302R8\351"
+        "\302Q\003\010\000b\260^C\134\217\210\302\321B\021\303R\003\010\000\347;JC\264\010\230\302NB)\303S\003"
+        "\010\000\262=4C\203\300\270\302j\2349\303T\003\010\000\264h\037C\335$\350\302\004v\077\303U\003\010\000"
+        "\323\215\016C}\077\020\303j\2349\303V\003\010\000\325x\005C\345\320*\3033\023)\303W\003\010\000)\134"
+        "\004C#\233@\303\321B\021\303X\003\010\000\331\016\014C\207\326M\303\217\202\352\302Y\003\010\000\315"
+        "\354\032C\370\323Q\303%\006\261\302Z\003\010\000\351\0060C\205\253I\303\020\330\177\302[\003\010\000"
+        "\276_FC\213\2148\303^\272\077\302\134\003\010\000\217b[C7i \303}\077)\302]\003\010\000\376TkCw\376\005"
+        "\303\203@>\302^\003\010\000\035\372tCHa\325\302\246\033\200\302_\003\010\000\325\330uC-r\251\302\230"
+        "\356\260\302`\003\010\000d\033\202C/\335U\302\016\355\313\302a\003\010\000\211axC\333y3\302F6\003\303"
+        "b\003\010\000B\240gC\246\0330\302\134O\037\303c\003\010\000yiTC\307KL\302)\0346\303d\003\010\000w\376"
+        ">C\0775\201\302d\333H\303e\003\010\0009T(C\006\301\252\302)\034U\303f\003\010\000\372\336\024C)\134\332"
+        "\302j\234X\303g\003\010\000\323m\003C\177*\010\303)\034U\303h\003\010\000\2663\356B\230\216#\303d\333"
+        "H\303i\003\010\000-r\341B\2744<\303\26636\303j\003\010\000{\024\341B\370\363P\303\254\034\036\303k\003"
+        "\010\000H!\354B\347;`\303F6\003\303l\003\010\000\234\304\001C\254\274h\303\354\221\314\302m\003\010\000"
+        "\033\017\022C\331ni\303L7\226\302n\003\010\000h1&CX\031b\303\276\237L\302o\003\010\000\366\250;C\177"
+        "\212T\303\266s\001\302p\003\010\000\221\255QCb0@\303\323M\245\301q\003\010\000sheC`\205(\303\022\203"
+        "\204\301r\003\010\000\0127vC\250\346\015\303\323M\245\301s\003\010\000\276/\201C\016m\346\302\266s\001"
+        "\302t\003\010\000\311\266\204C\033/\263\302\211AL\302u\003\010\000\301\332\204C\370\223\211\302\276\037"
+        "\226\302v\003\010\000\305`\211C\217\302\013\302\213l\310\302w\003\010\000\234\224\206C\372~v\301\232"
+        "9\004\303x\003\010\000L\227}C\236\357}\3015\336\034\303y\003\010\000\012\367nC/\335v\301\016\0155\303"
+        "z\003\010\000\351FTC+\007\016\302\203\240H\303{\003\010\000\260\262_C\313\241w\301\252\261M\303|\003"
+        "\010\000\374\311DC\364}\026\302o2_\303}\003\010\000\364\235PC\134\217z\301B\340e\303~\003\010\000\006"
+        "a;C\256G\366\301\201uv\303\177\003\010\000y\3513CN\342k\302sha\303\200\003\010\000\345\020*Cq=[\302^"
+        ":v\303\201\003\010\000\010,\031Cd\273\233\302\201uv\303\202\003\010\000\234\304\010C1H\311\302^:v\303"
+        "\203\003\010\000\313\241\357B-\362\367\302^:v\303\204\003\010\000\016m\315BT\203\023\303^:v\303\205\003"
+        "\010\000\270\336\334B\012\267\032\303\037Ea\303\206\003\010\000\230n\254BR8*\303^:v\303\207\003\010\000"
+        "\022\203\276B\240\3720\303s\250_\303\210\003\010\000\230.\234B\217\202C\303`\245e\303\211\003\010\000"
+        "mg\303B\3764A\303\203\240H\303\212\003\010\000\037E\245B\014\242Q\303\252\261M\303\213\003\010\000d\273"
+        "\256BZ\344_\303\360G5\303\214\003\010\000\327\343\267B\347[n\3035\336\034\303\215\003\010\000\232Y\301"
+        "B\364\235|\303{t\004\303\216\003\010\000\252\261\312Bu\223\205\303\276\237\327\302\217\003\010\000\254"
+        "\134\351B\022\203|\303\213l\310\302\220\003\010\000\272\011\324B\317\327\214\303\207V\246\302\221\003"
+        "\010\000o\222\366B;\377\203\303\134\017\230\302\222\003\010\000\027\231\364B\303\265\214\303u\223d\302"
+        "\223\003\010\000\010\254\015C\0775|\303P\215p\302\224\003\010\000\035\372\015C\027\211\205\303-\262("
+        "\302\225\003\010\000h\261!C\276\277|\303`\345\330\301\226\003\010\000Pm5C\345pn\303b\020@\301\227\003"
+        "\010\000\201\265HC\345p`\303\240\032/@\230\003\010\000\372\036]C\205\253Q\303\016-\223A\231\003\010\000"
+        "m\207_C\031\244@\303\232\231\021@\232\003\010\000u\363pC\356\034C\303\317w\005B\233\003\010\000w^rC\230"
+        "\2561\303\234\304rA\234\003\010\000#{\201C\260R*\303\317w\005B\235\003\010\000D+{CD\313\032\303Nb @\236"
+        "\003\010\000\315\034\205C\012\227\023\303\016-\223A\237\003\010\000\223\370\210CLw\370\302\370S[@\240"
+        "\003\010\000\376\264\214C1\010\312\3025^<\301\241\003\010\000\333y\220C\033/\233\302`\345\330\301\242"
+        "\003\010\000PM\224C\234\304Y\302\250\306'\302\243\003\010\000s(\215C{\024l\302F\266n\302\244\003\010"
+        "\000\347K\230C\010\254\365\301\360\247c\302\245\003\010\000u\363\217C\311v\026\302\027\231\227\302\246"
+        "\003\010\000F\246\225CD\213z\301\207V\246\302\247\003\010\000J\354\215C\351&y\301\307\213\330\302\250"
+        "\003\011\000Lw>C\366\210\010CuS\352\302\251\003\011\000\264H.C\364]\017C\236O\007\303\252\003\011\000"
+        "#[@Cj\374\354B\236O\007\303\253\003\011\000\234\304OC\276_\356BB \333\302\254\003\011\000\360'HCu\223"
+        "\017C\010l\272\302\255\003\011\0003\3632C\333\331\036CB \333\302\256\003\011\000\205k\032C\3541.CF6\003"
+        "\303\257\003\011\000\270>\034CZD\027C\3035\033\303\260\003\011\000Vn*C/\235\365BF\266%\303\261\003\011"
+        "\000\366\250AC\242\205\306B\033\317\033\303\262\003\011\000q\235VC#[\265B\270\376\003\303\263\003\011"
+        "\000\372^bCu\023\307B;\037\315\302\264\003\011\000T\003aC\246\233\365B\362\322\232\302\265\003\011\000"
+        "\260\222QCN\002\030C;\037\210\302\266\003\011\000\020\270;C\217\042.C\362\322\232\302\267\003\011\000"
+        ")\334%C\201U7C\016\355\313\302\270\003\011\000\020x\015C\252qLCR8\351\302\271\003\011\000\305\300\005"
+        "C\244\260>C\321B\021\303\272\003\011\000=\312\006CR\330(CNB)\303\273\003\011\000P\215\017C}\337\016C"
+        "j\2349\303\274\003\011\000\250\246\037C^z\347B\004v\077\303\275\003\011\000q=5C\203\000\266Bj\2349\303"
+        "\276\003\011\000u\263KC\134O\224B3\023)\303\277\003\011\000\274\024`C\333\271\204B\321B\021\303\300\003"
+        "\011\000D\013oC\2440\213B\217\202\352\302\301\003\011\000\331nwC\006\001\245B%\006\261\302\302\003\011"
+        "\000\3541vC\033/\322B\020\330\177\302\303\003\011\000h\321lC\321\242\003C^\272\077\302\304\003\011\000"
+        "\240Z\134C\370\023\037C}\077)\302\305\003\011\0001(HCsh6C\203@>\302\306\003\011\000\205+1C\234\004HC"
+        "\246\033\200\302\307\003\011\000J\214\034C\014\242OC\230\356\260\302\310\003\011\000\217B\003C\376\364"
+        "fC\016\355\313\302\311\003\011\000\240\332\356B\347[^CF6\003\303\312\003\011\000`\345\342B\033\257NC"
+        "\134O\037\303\313\003\011\000\016m\344B\246;:C)\0346\303\314\003\011\000\016\355\360B\230\256!Cd\333"
+        "H\303\315\003\011\000\0127\005C\376\264\005C)\034U\303\316\003\011\000\012\327\025C\252\261\327Bj\234"
+        "X\303\317\003\011\000q\035*C\207\326\245B)\034U\303\320\003\011\000#[@C\205\353zBd\333H\303\321\003\011"
+        "\000\370\323UC!0DB\26636\303\322\003\011\000\305\200iC\027\331)B\254\034\036\303\323\003\011\000w\276"
+        "yC\333\371+BF6\003\303\324\003\011\000\027\271\202C\356\374MB\354\221\314\302\325\003\011\000N\222\205"
+        "CP\215\205BL7\226\302\326\003\011\000\3541\205CHa\260B\276\237L\302\327\003\011\000\203\020\202C\215"
+        "\227\341B\266s\001\302\330\003\011\000\266\223wC\250\006\014C\323M\245\301\331\003\011\000\374)gC\240"
+        "\032&C\022\203\204\301\332\003\011\000=\012SC\244P>C\323M\245\301\333\003\011\000\177j=C\276\037RC\266"
+        "s\001\302\334\003\011\000\240:'C\203\300`C\211AL\302\335\003\011\000\360\207\023CorgC\276\037\226\302"
+        "\336\003\011\000\234D\354B\022\203zC\213l\310\302\337\003\011\000\360\247\303B\035:{C\2329\004\303\340"
+        "\003\011\000\177\352\272BfFlC5\336\034\303\341\003\011\0007\011\261BB\200^C\016\0155\303\342\003\011"
+        "\000d\273\306B=\352>C\203\240H\303\343\003\011\000'\261\247B\215\367OC\252\261M\303\344\003\011\000\033"
+        "/\301B1\210/Co2_\303\345\003\011\000R\270\236B'\221ACB\340e\303\346\003\011\000/]\256B\252\261(C\201"
+        "uv\303\347\003\011\000\254\134\337B\014\342\030Csha\303\350\003\011\000\254\134\321B\024\316\020C^:v"
+        "\303\351\003\011\000\250\306\362B^:\363B\201uv\303\352\003\011\000\240\372\011C\260\362\305B^:v\303\353"
+        "\003\011\000V\356\032C\264H\227B^:v\303\354\003\011\000\264\010,CshPB^:v\303\355\003\011\000\335D5CN"
+        "\342dB\037Ea\303\356\003\011\000\360\207<C\366(\353A^:v\303\357\003\011\000\305\300EC\262\235\017Bs\250"
+        "_\303\360\003\011\000\260\022RC\343\245]A`\245e\303\361\003\011\000'\361UC/\335\004B\203\240H\303\362"
+        "\003\011\000\264\350`C\333\371\134A\252\261M\303\363\003\011\000V\356oC\260r^A\360G5\303\364\003\011"
+        "\000\341\032\177C\246\233\134A5\336\034\303\365\003\011\000B\020\207C{\024^A{t\004\303\366\003\011\000"
+        "o\262\216C\337O]A\276\237\327\302\367\003\011\000\301\032\212C\217\302\003B\213l\310\302\370\003\011"
+        "\000\234T\226CD\213\134A\207V\246\302\371\003\011\000\343\225\220C'\261\016B\134\017\230\302\372\003"
+        "\011\000\020\270\230C\315\314\352Au\223d\302\373\003\011\000N\322\215C\0775cBP\215p\302\374\003\011\000"
+        "\276\357\224C\372\376QB-\262(\302\375\003\011\000\010,\221C\232Y\227B`\345\330\301\376\003\011\000\341"
+        "j\215C\341\272\305Bb\020@\301\377\003\011\000P\275\211C\134\017\363B\240\032/@\000\004\011\000w\336\205"
+        "C\313\201\021C\016-\223A\001\004\011\0007I|C\033\017\031C\232\231\021@\002\004\011\000\260\002\202C/"
+        "\335(C\317w\005B\003\004\011\000\313\341sCX\231/C\234\304rA\004\004\011\000\217\002rC\256\247AC\317w"
+        "\005B\005\004\011\000\077\325`C\301\012\077CNb @\006\004\011\000\217\242^CF\226OC\016-\223A\007\004\011"
+        "\000\024\316JC\335$^C\370S[@\010\004\011\000\264\0107C\315llC5^<\301\011\004\011\000\303\025#C\376\324"
+        "zC`\345\330\301\012\004\011\000\331n\017C\252\241\204C\250\306'\302\013\004\011\000;_\017C\217BzCF\266"
+        "n\302\014\004\011\000y\251\366B\027\031\214C\360\247c\302\015\004\011\000\347{\371B\360\027\203C\027"
+        "\231\227\302\016\004\011\000\022\303\326B\317\347\213C\207V\246\302\017\004\011\000\307\013\315B\014"
+        "\222\204C\307\213\330\302\020\004\012\000\364\375\215\302\303U_CuS\352\302\021\004\012\000j\374\244\302"
+        "\230\016RC\236O\007\303\022\004\012\000\022\003U\302\331\216[C\236O\007\303\023\004\012\000\232\231D"
+        "\302\024njCB \333\302\024\004\012\000\335d\225\302\035\272jC\010l\272\302\025\004\012\000V\216\277\302"
+        "mG[CB \333\302\026\004\012\000\351\346\353\302'\261HCF6\003\303\027\004\012\000\374)\277\302\215WCC\303"
+        "5\033\303\030\004\012\000\217B\200\302\374\011HCF\266%\303\031\004\012\000j<\012\302\341\332VC\033\317"
+        "\033\303\032\004\012\000)\134\237\301\313!hC\270\376\003\303\033\004\012\0009\264\305\301\016\015vC;"
+        "\037\315\302\034\004\012\000D\013=\302\260\362{C\362\322\232\302\035\004\012\000\262\235\237\302=JvC"
+        ";\037\210\302\036\004\012\000\0775\327\302\215WhC\362\322\232\302\037\004\012\000L7\366\302\037eVC\016"
+        "\355\313\302 \004\012\000\325\270\026\303\223\270ECR8\351\302!\004\012\000f\006\014\303\014\042:C\321"
+        "B\021\303\042\004\012\000\246\333\355\302w^4CNB)\303#\004\012\000\301\012\267\302P\2554Cj\2349\303$\004"
+        "\012\000\274\364r\302\035\232;C\004v\077\303%\004\012\000\370S\364\301q}HCj\2349\303&\004\012\000\372"
+        "~\362\300`\245XC3\023)\303'\004\012\000\366(\304@\372\236iC\321B\021\303(\004\012\000^\272\365@\232\331"
+        "xC\217\202\352\302)\004\012\000'1\000\300\223h\202C%\006\261\302*\004\012\000\303\365\276\301\134O\205"
+        "C\020\330\177\302+\004\012\000J\014P\302\327\363\204C^\272\077\302,\004\012\000\343e\246\302\356\134"
+        "\201C}\077)\302-\004\012\000\211A\337\302^\272vC\203@>\302.\004\012\000\341z\007\303\331NfC\246\033\200"
+        "\302/\004\012\000R\030\025\303J\014UC\230\356\260\3020\004\012\000L\0273\303{4DC\016\355\313\3021\004"
+        "\012\000-\222.\303\205K6CF6\003\3032\004\012\000\321\202!\303\327\303+C\134O\037\3033\004\012\0003\323"
+        "\015\303J,&C)\0346\3034\004\012\000\207\026\351\302\256\207$Cd\333H\3035\004\012\000\372\376\253\302"
+        "\022\003(C)\034U\3036\004\012\000\134\017a\302\077\325/Cj\234X\3037\004\012\000\004V\322\301yi;C)\034"
+        "U\3038\004\012\000d;_\276uSJCd\333H\3039\004\012\000\244p\233A\335\204ZC\26636\303:\004\012\000\033/"
+        "\376A-2kC\254\034\036\303;\004\012\000\327#\021BV\316zCF6\003\303<\004\012\000\037\205\376A\020H\204"
+        "C\354\221\314\302=\004\012\000\035Z\230A\374Y\211CL7\226\302>\004\012\000=\012\307\277PM\214C\276\237"
+        "L\302\077\004\012\000\321\042\327\301b \215C\266s\001\302@\004\012\000\002\253b\302q]\213C\323M\245\301"
+        "A\004\012\000\376\024\255\302\351\226\207C\022\203\204\301B\004\012\000\354\221\347\302\260\302\201C"
+        "\323M\245\301C\004\012\000\331N\015\303\266\023uC\266s\001\302D\004\012\0003\023\042\303\372~dC\211A"
+        "L\302E\004\012\000\256\207.\303\274\324SC\276\037\226\302F\004\012\000\270\276I\303\327\303=C\213l\310"
+        "\302G\004\012\0003\263P\303J\254*C\2329\004\303H\004\012\000\274\324C\303\242\345!C5\336\034\303I\004"
+        "\012\000\014B8\303'\361\030C\016\0155\303J\004\012\000q\335\026\303\276\177\031C\203\240H\303K\004\012"
+        "\000\305\340+\303\014\002\020C\252\261M\303L\004\012\000\215\027\011\303d\033\022Co2_\303M\004\012\000"
+        "\354\221\037\303\301J\007CB\340e\303N\004\012\000;\177\005\303D\013\007C\201uv\303O\004\012\000+\307"
+        "\335\302\077u\031Csha\303P\004\012\000q\275\322\302\024N\020C^:v\303Q\004\012\000PM\234\302+\007\031"
+        "C\201uv\303R\004\012\000\317\367M\302\134\317!C^:v\303S\004\012\000\022\203\300\301\325\270*C^:v\303"
+        "T\004\012\000\333\371f@\311\2663C^:v\303U\004\012\000\366(\314\0779\024>C\037Ea\303V\004\012\000\213"
+        "l\362A\022c<C^:v\303W\004\012\000-\262\327AD+GCs\250_\303X\004\012\000\311\366NBo\022LC`\245e\303Y\004"
+        "\012\000\207\026\012B)\274UC\203\240H\303Z\004\012\000\311vaBD+ZC\252\261M\303[\004\012\000\024\256s"
+        "B\347{hC\360G5\303\134\004\012\000!p\203BH\341vC5\336\034\303]\004\012\000\307\213\214B\027\231\202C"
+        "{t\004\303^\004\012\000o\022\226B\272\331\211C\276\237\327\302_\004\012\000\232\031XB\134o\210C\213l"
+        "\310\302`\004\012\000\232\231\237B=\032\221C\207V\246\302a\004\012\000X\271]B`\005\217C\134\017\230\302"
+        "b\004\012\000\252\361\204B\215\307\225Cu\223d\302c\004\012\000\031\204\006B\020\250\217CP\215p\302d\004"
+        "\012\000\325x(B-\302\225C-\262(\302e\004\012\000\000\000\216Ao\302\225C`\345\330\301f\004\012\0001\010"
+        "\324\300\201\305\225Cb\020@\301g\004\012\000\313\241\363\301f\306\225C\240\032/@h\004\012\000\232\231"
+        "^\302\213\314\225C\016-\223Ai\004\012\000\3116\207\3025\236\217C\232\231\021@j\004\012\000}\177\240\302"
+        "\016\275\225C\317w\005Bk\004\012\0001H\267\302\301\032\217C\234\304rAl\004\012\0001\310\332\302\006\001"
+        "\221C\317w\005Bm\004\012\000\221m\340\302\230n\210CNb @n\004\012\000\006\241\000\303h\361\211C\016-\223"
+        "Ao\004\012\000\333\231\024\3033\303\202C\370S[@p\004\012\000\002K(\303\217\042wC5^<\301q\004\012\000"
+        "\366(<\303q\235hC`\345\330\301r\004\012\000\376\364O\303NbZC\250\306'\302s\004\012\000\376\264A\303\244"
+        "\260UCF\266n\302t\004\012\000\372^d\303H\341KC\360\247c\302u\004\012\000\230\316R\3031\250GC\027\231"
+        "\227\302v\004\012\000\033\357h\303\215\227<C\207V\246\302w\004\012\000\246{\134\303!p3C\307\213\330\302"
+        "x\004\013\000\360\247\266\077\323M\342\276\000\000\203\303y\004\013\000\366(\231\301\356|q\301\000\000"
+        "\203\303z\004\013\000\037\205!A\203\300\304\301\000\000\203\303{\004\013\000\201\225\330A\012\327#>\000"
+        "\000\203\303|\004\013\000d;\033AL7\310A\000\000\203\303}\004\013\000\244p\234\301\303\365tA\000\000\203"
+        "\303~\004\013\000F6R\302j\274\024\077\000\000\203\303\177\004\013\000j\274(\302\000\000\370\301\000\000"
+        "\203\303\200\004\013\000w\276\177\301\236oO\302\000\000\203\303\201\004\013\000\354Q\224Aj\274M\302\000"
+        "\000\203\303\202\004\013\000\020X4B\211A\000\302\000\000\203\303\203\004\013\000=\012\134B;\337/\277"
+        "\000\000\203\303\204\004\013\000\351&4B\341z\000B\000\000\203\303\205\004\013\000\004V\211A\010\254P"
+        "B\000\000\203\303\206\004\013\000/\335t\301m\347NB\000\000\203\303\207\004\013\000\012W,\302\270\036"
+        "\377A\000\000\203\303\210\004\013\000\307\013\234\302\033/\320A\000\000\203\303\211\004\013\000\323M"
+        "\243\302)\134\317\300\000\000\203\303\212\004\013\000\254\034\221\302\215\227\026\302\000\000\203\303"
+        "\213\004\013\000\307KU\302\341z|\302\000\000\203\303\214\004\013\000w\276\313\301\223\030\236\302\000"
+        "\000\203\303\215\004\013\000\303\365\364@\262\335\245\302\000\000\203\303\216\004\013\000J\214\033B1"
+        "H\223\302\000\000\203\303\217\004\013\000\006\001\201B;\337W\302\000\000\203\303\220\004\013\000\254"
+        "\034\240B\264\310\320\301\000\000\203\303\221\004\013\000\364}\251BB`\305@\000\000\203\303\222\004\013"
+        "\000\134O\226B\201\225\030B\000\000\203\303\223\004\013\000\254\034\134B\270\036~B\000\000\203\303\224"
+        "\004\013\000\0775\325A\311\266\236B\000\000\203\303\225\004\013\000\221\355\214\300J\214\246B\000\000"
+        "\203\303\226\004\013\000\006\001\022\302N\242\224B\000\000\203\303\227\004\013\000\307Ky\302+\007XB\000"
+        "\000\203\303\230\004\013\000\321\042\306\302\354QHB\000\000\203\303\231\004\013\000\027Y\332\302\362"
+        "\322\227A\000\000\203\303\232\004\013\000uS\334\302F\266[\301\000\000\203\303\233\004\013\000\211\301"
+        "\313\302y\351,\302\000\000\203\303\234\004\013\000'\361\253\302;\337\214\302\000\000\203\303\235\004"
+        "\013\00094v\302J\214\271\302\000\000\203\303\236\004\013\000\250F\006\302\311\366\323\302\000\000\203"
+        "\303\237\004\013\000\366(\354\277\027Y\340\302\000\000\203\303\240\004\013\000\012\327\362A\311v\330"
+        "\302\000\000\203\303\241\004\013\000\362RmB\230n\277\302\000\000\203\303\242\004\013\000!p\247B\327\243"
+        "\226\302\000\000\203\303\243\004\013\000\262]\313B\313!F\302\000\000\203\303\244\004\013\000\240Z\337"
+        "B'1\226\301\000\000\203\303\245\004\013\000q\375\340BD\213NA\000\000\203\303\246\004\013\000\372\276"
+        "\317B\333y/B\000\000\203\303\247\004\013\000\262\335\257B1H\216B\000\000\203\303\250\004\013\000\031"
+        "\004\200B\207V\271B\000\000\203\303\251\004\013\000j\274\020B\331\016\325B\000\000\203\303\252\004\013"
+        "\000\341z\234@\211\301\337B\000\000\203\303\253\004\013\000/\335\323\301N\242\330B\000\000\203\303\254"
+        "\004\013\000mgb\302j<\300B\000\000\203\303\255\004\013\000\254\034\242\3029\264\227B\000\000\203\303"
+        "\256\004\013\000\252\261\361\302)\334lB\000\000\203\303\257\004\013\000\033\317\017\303\370S\350A\000"
+        "\000\203\303\260\004\013\000\022C\017\303\321\042\333\275\000\000\203\303\261\004\013\000\360\307\017"
+        "\303\252\361\342\301\000\000\203\303\262\004\013\000\240Z\360\30294l\302\000\000\203\303\263\004\013"
+        "\000X\271\017\303\221me\302\000\000\203\303\264\004\013\000\305`\353\3027\311\254\302\000\000\203\303"
+        "\265\004\013\000\313\201\017\303F\266\253\302\000\000\203\303\266\004\013\000\266s\373\302\006A\336\302"
+        "\000\000\203\303\267\004\013\000\033/\271\302DK\302\302\000\000\203\303\270\004\013\000L\367\302\302"
+        "\345\020\360\302\000\000\203\303\271\004\013\000\014\302\214\302j\034\001\303\000\000\203\303\272\004"
+        "\013\000\213l.\302\374\211\011\303\000\000\203\303\273\004\013\000\213l\201\301us\022\303\000\000\203"
+        "\303\274\004\013\000\236\3577Ahq\033\303\000\000\203\303\275\004\013\000!\260\237A\024\216\005\303\000"
+        "\000\203\303\276\004\013\000\211\301\030B\262\035$\303\000\000\203\303\277\004\013\0007\2118B\374)\014"
+        "\303\000\000\203\303\300\004\013\000\207\326\207B\360G\032\303\000\000\203\303\301\004\013\000\205k\202"
+        "B\362\222\356\302\000\000\203\303\302\004\013\000\301\012\251B\234\204\003\303\000\000\203\303\303\004"
+        "\013\000b\220\312B+\207\330\302\000\000\203\303\304\004\013\000u\223\354B\024.\252\302\000\000\203\303"
+        "\305\004\013\000\213\014\007C\020Xw\302\000\000\203\303\306\004\013\000N\042\030C\002\253\031\302\000"
+        "\000\203\303\307\004\013\000\213\354\006C\270\036\277\301\000\000\203\303\310\004\013\000R8)C\317\367"
+        "o\301\000\000\203\303\311\004\013\000\307k\024C\010\254\034>\000\000\203\303\312\004\013\000\360\347"
+        "(C\033/{A\000\000\203\303\313\004\013\000\244\220\006C-\262\272A\000\000\203\303\314\004\013\000y\011"
+        "\030C\262\035\033B\000\000\203\303\315\004\013\00033\007C\362\322wB\000\000\203\303\316\004\013\000\014"
+        "\302\354B\262]\252B\000\000\203\303\317\004\013\000\215\327\313B\317\267\327B\000\000\203\303\320\004"
+        "\013\000/\035\251By\351\003C\000\000\203\303\321\004\013\000u\023\201B\221\355\356B\000\000\203\303\322"
+        "\004\013\000\321\342\206B-\022\033C\000\000\203\303\323\004\013\000\337\317;B\012W\014C\000\000\203\303"
+        "\324\004\013\00033\031B=\212$C\000\000\203\303\325\004\013\0005^\240A\3450\006C\000\000\203\303\326\004"
+        "\013\000d;9A\276\237\033C\000\000\203\303\327\004\013\000\223\030~\301o\362\022C\000\000\203\303\330"
+        "\004\013\000'\261,\302\354\361\011C\000\000\203\303\331\004\013\000\002k\215\302)\334\000C\000\000\203"
+        "\303\332\004\013\000\223\330\303\3021\210\360B\000\000\203\303\333\004\013\000{\024\271\302\207V\303"
+        "B\000\000\203\303\334\004\013\000\335\244\373\302\311v\337B\000\000\203\303\335\004\013\000mg\353\302"
+        "\264\310\255B\000\000\203\303\336\004\013\000\226\203\017\303\341:\255B\000\000\203\303\337\004\013\000"
+        "q\235\017\303D\213dB\000\000\203\303\001\000J\014\312A\003\000X9\315A\002\000\256G\315A\005\000`\345"
+        "\321A\004\000q=\326A\007\000\006\001UB\013\000\004VVB\000\000J\014\312A\007\000\317\367\337A\005\000"
+        "}\077\363A\002\000\317\367\365A\010\000\246\233\023B\006\000\246\233\023B\003\000\024\256BB\000\000\256"
+        "G\315A\011\000\240\032\341A\003\000\305 \360A\001\000\317\367\365A\012\000\262\035\017B\010\000\205\353"
+        "\026B\004\000\364}FB\000\000X9\315A\013\000\232\231\337A\002\000\305 \360A\004\000\010\254\362A\014\000"
+        "\351\246\022B\012\000\002\253\023B\001\000\024\256BB\000\000q=\326A\015\000\033/\341A\003\000\010\254"
+        "\362A\005\000\313\241\366A\014\000\374)\020B\016\000\362R\022B\001\000\366\250EB\000\000`\345\321A\017"
+        "\000\242E\346A\001\000}\077\363A\004\000\313\241\366A\006\000D\213\020B\016\000\351\246\022B\003\000"
+        "\254\034DB\021\000D\213\357A\017\000\004\326\002B\007\000\311\366\004B\020\000\372\376\017B\005\000D"
+        "\213\020B\001\000\246\233\023B\022\000\201\225,B\001\000\317\367\337A\022\000^\272\370A\006\000\311\366"
+        "\004B\010\000\274\364\005B\023\000\356\374\007B\021\000)\3349B\024\000\356|KB\024\000)\134\346A\007\000"
+        "\274\364\005B\011\000\240\032\012B\001\000\246\233\023B\002\000\205\353\026B\023\000\006\001\034B\025"
+        "\000\010,\034B\002\000\240\032\341A\026\000\266\363\360A\012\000\260r\003B\025\000\323M\005B\010\000"
+        "\240\032\012B\027\000\305 8B\024\000\337\317OB\027\000\002+\352A\011\000\260r\003B\013\000\327\243\003"
+        "B\030\000f\346\015B\002\000\262\035\017B\003\000\002\253\023B\026\000\335$(B\003\000\232\231\337A\031"
+        "\000\270\036\364A\012\000\327\243\003B\014\000\351&\011B\030\000R\270\016B\032\000\356\374.B\002\000"
+        "%\206KB\032\0009\264\365A\033\000\020\330\003B\013\000\351&\011B\015\000\376T\011B\004\000\374)\020B"
+        "\003\000\351\246\022B\031\000w\276=B\004\000\033/\341A\034\000)\134\346A\016\000`\345\001B\014\000\376"
+        "T\011B\035\000yi\027B\033\000\262\035\036B\005\000\262\035PB\036\000\362\322\367A\015\000`\345\001B\035"
+        "\000\022\203\005B\017\000=\212\010B\004\000\362R\022B\005\000\351\246\022B\037\000\315L<B\005\000\242"
+        "E\346A\037\000\022\203\352A\006\000\004\326\002B\016\000=\212\010B\020\000F\266\015B\036\000j\274+B\001"
+        "\000\205\353RB!\000\372~\377A \000F\266\377A\037\000\035Z\000B\021\000\345\320\002B\017\000F\266\015"
+        "B\006\000\372\376\017B5\000\033\257GB\042\000\035Z\353A\006\000D\213\357A\022\000;\337\001B\020\000\345"
+        "\320\002B!\000\311\366\025B#\000\272\311'B\007\000)\3349B#\000\264\310\356A\007\000^\272\370A\023\000"
+        "\004V\377A\021\000;\337\001B$\0009\264\015B\006\000\201\225,B\042\000\242E2B%\00033\366A\022\000\004"
+        "V\377A\024\000#[\000B$\000\370\323\005B\007\000\356\374\007B\010\000\006\001\034B&\000\256\307<B&\000"
+        "\014\002\341A\010\000)\134\346A\023\000#[\000B\025\000ff\005B%\000\213l\032B'\000w\276\042B\007\000\356"
+        "|KB'\000\303\365\365A\026\000\012W\002B\011\000\323M\005B\024\000ff\005B(\000\303\365\007B\010\000\010"
+        ",\034B&\000\205\353<B)\0009\264\360A\011\000\266\363\360A\027\000'1\001B\025\000\012W\002B(\000\022\203"
+        "\016B\012\000\335$(B*\000\274t3B*\000\331\316\345A\012\000\002+\352A\030\000\370S\377A\026\000'1\001"
+        "B+\000\250\306\025B)\000\234D(B\011\000\305 8B+\000\254\034\377A\027\000\370S\377A,\000\376\324\001B"
+        "\031\000\205k\002B\012\000f\346\015B\013\000R\270\016B*\000\230nEB-\000\274t\344A\013\000\270\036\364"
+        "A\030\000\205k\002B\032\000D\213\005B,\000\370\323\022B.\000\240\032)B\014\000w\276=B.\000\226C\352A"
+        "\014\0009\264\365A\033\000{\224\001B\031\000D\213\005B/\0001\210\015B\013\000\356\374.B-\000\250F4B0"
+        "\000\236\357\363A\032\000{\224\001B\034\000\317\367\001B\014\000\020\330\003B/\000\223\030\007B\015\000"
+        "\262\035\036B1\000\272\311;B\015\000)\134\346A1\0005^\346A\035\000sh\372A\033\000\317\367\001B2\000\037"
+        "\205\034B0\000\313\241\036B\016\000\252\361HB2\000\246\233\360A\034\000sh\372A\036\000\307K\005B\016"
+        "\000\022\203\005B3\000D\213\005B\015\000yi\027B1\000\254\034;B4\000X9\355A\016\000\362\322\367A\037\000"
+        "sh\003B\035\000\307K\005B3\000\264\310\015B\017\000j\274+B5\000\362R2B5\000\0775\346A\017\000\022\203"
+        "\352A\020\000\035Z\000B\036\000sh\003B \000\345\320\023B4\000\364\375)B\016\000\315L<B6\000\236\357\274"
+        "A5\0007\211\373A\020\000F\266\377A!\000\337\317\002B\037\000\345\320\023Be\0007\011%Bg\000yi4B\020\000"
+        "\372~\377A \000\337\317\002B\042\000f\346\002B7\000\242E\020B\021\000\311\366\025B8\000\242E\034B6\000"
+        "{\224'B\021\000\035Z\353A#\000\240\032\365A!\000f\346\002B8\000\016-\017B9\000\366\250\022B\022\000\242"
+        "E2B:\000\343\2459B:\000+\207\301A\022\000\264\310\356A\042\000\240\032\365A$\000\305 \374A\021\000\272"
+        "\311'B;\000\002\2530B9\000\012\3271B\077\000\351&\334A#\000\305 \374A%\000Nb\004B\023\000\370\323\005"
+        "B\022\0009\264\015B<\000%\006\016B:\00094\020B\023\00033\366A&\000D\213\367A\077\000\250\306\372A$\000"
+        "Nb\004BA\000o\222\025B\024\000\213l\032B@\000sh4B\024\000\014\002\341A%\000D\213\367A'\000\272I\001B"
+        "B\000\303u\004BA\000`\345-BC\000'10B\023\000\256\307<BE\000\354Q\364A\025\000\303\365\365A&\000\272I"
+        "\001B(\000\226\303\001BC\000\254\234\024B\024\000w\276\042BD\000\262\0355BE\000\347\373\332A)\000\006"
+        "\201\374A'\000\226\303\001B\025\000\303\365\007BG\000\325x\016B\026\000\022\203\016BI\000\226C\022BI"
+        "\000\020X\302A\026\0009\264\360A(\000\006\201\374A*\000\020X\376A\027\000\234D(BJ\000\232\031/BK\000"
+        "\343%/B\027\000\331\316\345A+\000\177j\373A)\000\020X\376AL\000!\260\017BK\000\376T\025B\026\000\274"
+        "t3BI\000\345\320>B*\000\177j\373A\030\000\254\034\377A,\0005^\001BM\000}\077\016B\027\000\250\306\025"
+        "BL\000\325\370\034BO\000\221\355'BO\000\213l\276A-\000D\213\375A+\0005^\001B\030\000\376\324\001B\031"
+        "\000\370\323\022BQ\000\376T%BN\000`\3453BS\000\256G\303A\031\000\274t\344A,\000D\213\375A.\000P\215\000"
+        "BQ\000\372~\030BO\000Nb,B\032\000\250F4B\032\000\226C\352A/\000F\266\374A-\000P\215\000BU\000-\262\020"
+        "BS\000\077\265\023B\031\000\240\032)BV\000\343%/B.\000F\266\374A0\000q\275\000BV\000\254\034\006B\033"
+        "\000\223\030\007B\032\0001\210\015BW\000\002+\035BU\000\240\232@BY\000ff\326A\033\000\236\357\363A1\000"
+        "\024\256\370A/\000q\275\000B\034\000\313\241\036BW\000;_#BX\000!01B\034\0005^\346A0\000\024\256\370A"
+        "Y\000\354Q\371A2\000\347\373\375A]\000\232\031\000B[\000\236\357\015B\035\000\254\034;B]\000\301\312"
+        "\327A\035\000\246\233\360A3\000\215\227\374A1\000\347\373\375A\034\000\037\205\034B_\0007\011#B^\000"
+        "\037\0051B2\000\215\227\374A4\000\341\372\001B\035\000D\213\005B`\000%\006\010B\036\000\264\310\015B"
+        "_\000d; Ba\000\134\017CB\036\000X9\355A5\000\207\026\376A3\000\341\372\001Ba\000\246\233\016Bc\000Z\344"
+        "\017B\037\000\364\375)B`\000R\270/Bc\000}\077\305A\037\000\0775\346A \0007\211\373A4\000\207\026\376"
+        "Ae\000\215\027\031B6\000\031\204,B\036\000\362R2Bg\000m\347\266A \000\236\357\274Ae\000\027\331\336A"
+        "f\000w>\016B7\000\002\253\027B!\000{\224'B5\000\031\204,Bg\000\234\304\340A8\000X9\351A\011\001-\262"
+        "\366A!\000\242E\020B6\000\002\253\027B\013\001\201\225'B\010\001\177j*B9\000\270\036\342A7\000X9\351"
+        "A\010\001`\345\375A\042\000\016-\017B!\000\242E\034B\011\001}\077)B\007\001\177j*B8\000\270\036\342A"
+        ";\000y\351\347A\007\001-\262\366A\042\000\366\250\022B:\000\027\331\032B7\001\351&)B\010\001}\077)B;"
+        "\000#\333\274A#\000+\207\301A<\000\327\243\333A=\000\335$\016B$\00094\020B9\000\027\331\032B\042\000"
+        "\343\2459B:\000#\333\274A=\000\000\000\344A9\000y\351\347A7\001\035Z\370A<\000\364\375\033B\007\001\201"
+        "\225'B6\001T\343*B=\000\201\225\316A>\000V\016\320A\077\000\230n\332A:\000\327\243\333A$\000%\006\016"
+        "B;\000\364\375\033B@\000\317\367\034B<\000\201\225\316A;\000\000\000\344A>\00033\367A6\001\201\225\372"
+        "A:\000\335$\016B7\0019\264)B\077\000\246\233PB<\000V\016\320A\314\000ff\350A@\000y\351\354A=\00033\367"
+        "A\077\000\035\332\017B\312\000\351&&B\316\000#[OB@\000d;\273A<\000\230n\332A$\000\351&\334A%\000\250"
+        "\306\372A>\000\035\332\017BA\000-\262\033B:\000\321\042<B\077\000d;\273AA\000\010\254\344A>\000y\351"
+        "\354A\312\000\215\227\355A<\000\317\367\034B\311\000;_$B\314\000\250F&BB\000P\215\340A@\000\010\254\344"
+        "A\311\000\260r\355A%\000o\222\025B\077\000-\262\033B\310\000V\216$B\312\00094%BA\000P\215\340AC\000R"
+        "\270\346A\310\000\370S\356A&\000\303u\004B\311\000\240\032%B\307\000\203\300&B%\000y\351@BB\000R\270"
+        "\346AD\000\250\306\350A\307\000\260r\355A'\000\254\234\024BE\000\347{\031B\310\000\035Z$B\306\000!0'"
+        "BE\000w\276\273AF\0007\211\340AC\000\250\306\350A\306\000\014\002\357AG\000\236o\027B\304\000o\022$B"
+        "\307\0007\011%BD\000w\276\273AG\000\303\365\327A(\000\347\373\332A'\000\354Q\364AF\000\004V\016BC\000"
+        "\347{\031BI\000\256\307=BG\000H\341\311AD\0007\211\340A\304\000\006\201\355AH\000\022\203\372AE\000\004"
+        "V\016B\306\000\232\231#BE\002B\340OBF\000H\341\311AH\000\010\254\317AE\000\303\365\327AI\000q=\342A("
+        "\000\325x\016BD\000\236o\027BJ\000Zd\035BG\000\010\254\317AJ\000ff\341AE\002Zd\354AF\000\022\203\372"
+        "AI\000`e\014BC\002\325\370 BE\000\341\372PBJ\000/\335\266A)\000\020X\302AG\000q=\342AH\000`e\014B(\000"
+        "\226C\022BK\000;\337\026BE\000\256\307=BI\000/\335\266AH\000ff\341AK\000\354Q\345AC\002\341z\352AG\000"
+        "Zd\035BA\002\266\363\042BE\002\362\322%BJ\000\354Q\345AL\000\266\363\345AA\002\217\302\352A*\000\376"
+        "T\025BI\000;\337\026B@\002mg#BC\002\022\003&BM\000\354Q\345AK\000\266\363\345A@\002+\207\355A*\000!\260"
+        "\017B+\000\325\370\034B\077\002\337\317\042BA\002#\333$BL\000\354Q\345AN\000y\351\347A\077\0025^\352"
+        "A+\000}\077\016BO\000\264\310\027Bo\002\347\373!B@\0021\210'BO\000\016-\264AP\000y\351\347AM\000y\351"
+        "\347Ao\002\037\205\353AQ\000\364\375\032Bn\002\274t#B\077\002\232\231%BN\000\016-\264A,\000\213l\276"
+        "AQ\000\201\225\334AP\000R\270\015BM\000\264\310\027B+\000\221\355'B-\000Nb,BQ\000#\333\315AN\000y\351"
+        "\347An\002R\270\353AR\000\215\227\365AO\000R\270\015Bo\002\347{(BS\000\077\265NBR\000R\270\315AP\000"
+        "#\333\315AS\000o\022\330AO\000\201\225\334A-\000\372~\030BN\000\364\375\032BT\000\024.\033BQ\000R\270"
+        "\315AT\000-\262\344A\335\001^\272\352AP\000\215\227\365AS\000R\270\014B\333\001\201\025%B\336\001\205"
+        "kOBT\000D\213\272A-\000\256G\303AQ\000o\022\330AR\000R\270\014B.\000\077\265\023BU\000\000\200\032BO"
+        "\000\177\352<BS\000D\213\272AR\000-\262\344AU\000\033/\345A\333\001j\274\351AQ\000\024.\033B\335\001"
+        "\037\005\042B\331\001\250F&BT\000\033/\345AV\000\213l\345A\331\001ff\351A.\000-\262\020BS\000\000\200"
+        "\032B\333\001H\341!B\330\001\266s&BW\000\351&\340AU\000\213l\345A\330\001\327\243\354A/\000\254\034\006"
+        "B\331\001\234\304 B\327\001\004V&B.\000\343%/BV\000\351&\340A\327\001{\024\351AX\000\370S\355AY\000o"
+        "\222\034B/\000\002+\035B\330\001Zd!B0\000;_#BY\000\215\227\274AZ\0005^\346A\007\002\260r\351AW\000\370"
+        "S\355A[\000\335$\032B\327\001L7!B\006\002\006\201&BX\000\215\227\274A0\000ff\326A[\000)\134\332A1\000"
+        "\354Q\371AZ\000m\347\016BW\000o\222\034B]\000\311v;B[\000T\343\311AX\0005^\346A\006\002\264\310\353A"
+        "\134\000\335$\365AY\000m\347\016B\007\00294$B]\000\010,OBZ\000T\343\311A\134\000\246\233\315AY\000)\134"
+        "\332A]\000\331\316\334A1\000\236\357\015BX\000\335$\032B^\000\335$\032B[\000\246\233\315A^\0005^\341"
+        "Au\001{\024\363AZ\000\335$\365A]\000\374\251\015Bs\001\236\357)B\006\002\012\327MB^\0005^\270A2\000\301"
+        "\312\327A[\000\331\316\334A1\000\232\031\000B\134\000\374\251\015B_\000\372~\030BY\000\311v;B]\0005^"
+        "\270A\134\0005^\341A_\0005^\346As\001X9\363A[\000\335$\032Bu\001mg\042Bq\001\335\244,B`\000y\351\345"
+        "A^\0005^\346Aq\001)\134\361A]\000\372~\030B3\000d; Bs\001J\014\042B2\0007\011#B_\000y\351\345Aa\000\317"
+        "\367\347Ap\001h\221\365A3\000%\006\010Bq\001P\215!Bo\001\317\367+B4\000R\270/Bb\000\337O\344A`\000\317"
+        "\367\347Ao\001\203\300\362A4\000\246\233\016Bc\000\272I\030Bp\001\002+%B\237\001L7*Bc\000\376\324\271"
+        "Aa\000\337O\344Ad\000ff\351A\237\001\370S\362Ae\000\024.\033Bo\001J\214!B\236\001J\214,Bb\000\376\324"
+        "\271A5\000}\077\305Ae\000\347\373\332A4\000Z\344\017Bd\000%\206\020Ba\000\272I\030B6\000\000\000\077"
+        "Be\000b\020\321Ab\000ff\351A\236\001\217\302\357Af\000\264\310\365Ac\000%\206\020B\237\001-\262#B6\000"
+        "\022\003SBf\000\006\201\316Ad\000b\020\321Ac\000\347\373\332A6\000\027\331\336A5\000\215\027\031Bb\000"
+        "\024.\033Bg\000\376\324\035Be\000\006\201\316Ag\000\376\324\353Ad\000\264\310\365A\015\001\201\225\372"
+        "A6\000w>\016B\013\001T\343*B\236\001\341zOB6\000m\347\266A7\000\234\304\340Af\000\376\324\353A\013\001"
+        "\035Z\370Ae\000\376\324\035B\011\001\351&)B\015\0019\264)Bi\000J\014\312Ak\000X9\315Aj\000\256G\315A"
+        "m\000`\345\321Al\000q=\326Ao\000\006\001UBs\000\004VVBh\000J\014\312Ao\000\317\367\337Am\000}\077\363"
+        "Aj\000\317\367\365Ap\000\246\233\023Bn\000\246\233\023Bk\000\024\256BBh\000\256G\315Aq\000\240\032\341"
+        "Ak\000\305 \360Ai\000\317\367\365Ar\000\262\035\017Bp\000\205\353\026Bl\000\364}FBh\000X9\315As\000\232"
+        "\231\337Aj\000\305 \360Al\000\010\254\362At\000\351\246\022Br\000\002\253\023Bi\000\024\256BBh\000q="
+        "\326Au\000\033/\341Ak\000\010\254\362Am\000\313\241\366At\000\374)\020Bv\000\362R\022Bi\000\366\250E"
+        "Bh\000`\345\321Aw\000\242E\346Ai\000}\077\363Al\000\313\241\366An\000D\213\020Bv\000\351\246\022Bk\000"
+        "\254\034DBy\000D\213\357Aw\000\004\326\002Bo\000\311\366\004Bx\000\372\376\017Bm\000D\213\020Bi\000\246"
+        "\233\023Bz\000\201\225,Bi\000\317\367\337Az\000^\272\370An\000\311\366\004Bp\000\274\364\005B{\000\356"
+        "\374\007By\000)\3349B|\000\356|KB|\000)\134\346Ao\000\274\364\005Bq\000\240\032\012Bi\000\246\233\023"
+        "Bj\000\205\353\026B{\000\006\001\034B}\000\010,\034Bj\000\240\032\341A~\000\266\363\360Ar\000\260r\003"
+        "B}\000\323M\005Bp\000\240\032\012B\177\000\305 8B|\000\337\317OB\177\000\002+\352Aq\000\260r\003Bs\000"
+        "\327\243\003B\200\000f\346\015Bj\000\262\035\017Bk\000\002\253\023B~\000\335$(Bk\000\232\231\337A\201"
+        "\000\270\036\364Ar\000\327\243\003Bt\000\351&\011B\200\000R\270\016B\202\000\356\374.Bj\000%\206KB\202"
+        "\0009\264\365A\203\000\020\330\003Bs\000\351&\011Bu\000\376T\011Bl\000\374)\020Bk\000\351\246\022B\201"
+        "\000w\276=Bl\000\033/\341A\204\000)\134\346Av\000`\345\001Bt\000\376T\011B\205\000yi\027B\203\000\262"
+        "\035\036Bm\000\262\035PB\206\000\362\322\367Au\000`\345\001B\205\000\022\203\005Bw\000=\212\010Bl\000"
+        "\362R\022Bm\000\351\246\022B\207\000\315L<Bm\000\242E\346A\207\000\022\203\352An\000\004\326\002Bv\000"
+        "=\212\010Bx\000F\266\015B\206\000j\274+Bi\000\205\353RB\211\000\372~\377A\210\000F\266\377A\207\000\035"
+        "Z\000By\000\345\320\002Bw\000F\266\015Bn\000\372\376\017B\235\000\033\257GB\212\000\035Z\353An\000D\213"
+        "\357Az\000;\337\001Bx\000\345\320\002B\211\000\311\366\025B\213\000\272\311'Bo\000)\3349B\213\000\264"
+        "\310\356Ao\000^\272\370A{\000\004V\377Ay\000;\337\001B\214\0009\264\015Bn\000\201\225,B\212\000\242E"
+        "2B\215\00033\366Az\000\004V\377A|\000#[\000B\214\000\370\323\005Bo\000\356\374\007Bp\000\006\001\034"
+        "B\216\000\256\307<B\216\000\014\002\341Ap\000)\134\346A{\000#[\000B}\000ff\005B\215\000\213l\032B\217"
+        "\000w\276\042Bo\000\356|KB\217\000\303\365\365A~\000\012W\002Bq\000\323M\005B|\000ff\005B\220\000\303"
+        "\365\007Bp\000\010,\034B\216\000\205\353<B\221\0009\264\360Aq\000\266\363\360A\177\000'1\001B}\000\012"
+        "W\002B\220\000\022\203\016Br\000\335$(B\222\000\274t3B\222\000\331\316\345Ar\000\002+\352A\200\000\370"
+        "S\377A~\000'1\001B\223\000\250\306\025B\221\000\234D(Bq\000\305 8B\223\000\254\034\377A\177\000\370S"
+        "\377A\224\000\376\324\001B\201\000\205k\002Br\000f\346\015Bs\000R\270\016B\222\000\230nEB\225\000\274"
+        "t\344As\000\270\036\364A\200\000\205k\002B\202\000D\213\005B\224\000\370\323\022B\226\000\240\032)Bt"
+        "\000w\276=B\226\000\226C\352At\0009\264\365A\203\000{\224\001B\201\000D\213\005B\227\0001\210\015Bs\000"
+        "\356\374.B\225\000\250F4B\230\000\236\357\363A\202\000{\224\001B\204\000\317\367\001Bt\000\020\330\003"
+        "B\227\000\223\030\007Bu\000\262\035\036B\231\000\272\311;Bu\000)\134\346A\231\0005^\346A\205\000sh\372"
+        "A\203\000\317\367\001B\232\000\037\205\034B\230\000\313\241\036Bv\000\252\361HB\232\000\246\233\360A"
+        "\204\000sh\372A\206\000\307K\005Bv\000\022\203\005B\233\000D\213\005Bu\000yi\027B\231\000\254\034;B\234"
+        "\000X9\355Av\000\362\322\367A\207\000sh\003B\205\000\307K\005B\233\000\264\310\015Bw\000j\274+B\235\000"
+        "\362R2B\235\000\0775\346Aw\000\022\203\352Ax\000\035Z\000B\206\000sh\003B\210\000\345\320\023B\234\000"
+        "\364\375)Bv\000\315L<B\236\000\236\357\274A\235\0007\211\373Ax\000F\266\377A\211\000\337\317\002B\207"
+        "\000\345\320\023B\315\0007\011%B\317\000yi4Bx\000\372~\377A\210\000\337\317\002B\212\000f\346\002B\237"
+        "\000\242E\020By\000\311\366\025B\240\000\242E\034B\236\000{\224'By\000\035Z\353A\213\000\240\032\365"
+        "A\211\000f\346\002B\240\000\016-\017B\241\000\366\250\022Bz\000\242E2B\242\000\343\2459B\242\000+\207"
+        "\301Az\000\264\310\356A\212\000\240\032\365A\214\000\305 \374Ay\000\272\311'B\243\000\002\2530B\241\000"
+        "\012\3271B\247\000\351&\334A\213\000\305 \374A\215\000Nb\004B{\000\370\323\005Bz\0009\264\015B\244\000"
+        "%\006\016B\242\00094\020B{\00033\366A\216\000D\213\367A\247\000\250\306\372A\214\000Nb\004B\251\000o"
+        "\222\025B|\000\213l\032B\250\000sh4B|\000\014\002\341A\215\000D\213\367A\217\000\272I\001B\252\000\303"
+        "u\004B\251\000`\345-B\253\000'10B{\000\256\307<B\255\000\354Q\364A}\000\303\365\365A\216\000\272I\001"
+        "B\220\000\226\303\001B\253\000\254\234\024B|\000w\276\042B\254\000\262\0355B\255\000\347\373\332A\221"
+        "\000\006\201\374A\217\000\226\303\001B}\000\303\365\007B\257\000\325x\016B~\000\022\203\016B\261\000"
+        "\226C\022B\261\000\020X\302A~\0009\264\360A\220\000\006\201\374A\222\000\020X\376A\177\000\234D(B\262"
+        "\000\232\031/B\263\000\343%/B\177\000\331\316\345A\223\000\177j\373A\221\000\020X\376A\264\000!\260\017"
+        "B\263\000\376T\025B~\000\274t3B\261\000\345\320>B\222\000\177j\373A\200\000\254\034\377A\224\0005^\001"
+        "B\265\000}\077\016B\177\000\250\306\025B\264\000\325\370\034B\267\000\221\355'B\267\000\213l\276A\225"
+        "\000D\213\375A\223\0005^\001B\200\000\376\324\001B\201\000\370\323\022B\271\000\376T%B\266\000`\3453"
+        "B\273\000\256G\303A\201\000\274t\344A\224\000D\213\375A\226\000P\215\000B\271\000\372~\030B\267\000N"
+        "b,B\202\000\250F4B\202\000\226C\352A\227\000F\266\374A\225\000P\215\000B\275\000-\262\020B\273\000\077"
+        "\265\023B\201\000\240\032)B\276\000\343%/B\226\000F\266\374A\230\000q\275\000B\276\000\254\034\006B\203"
+        "\000\223\030\007B\202\0001\210\015B\277\000\002+\035B\275\000\240\232@B\301\000ff\326A\203\000\236\357"
+        "\363A\231\000\024\256\370A\227\000q\275\000B\204\000\313\241\036B\277\000;_#B\300\000!01B\204\0005^\346"
+        "A\230\000\024\256\370A\301\000\354Q\371A\232\000\347\373\375A\305\000\232\031\000B\303\000\236\357\015"
+        "B\205\000\254\034;B\305\000\301\312\327A\205\000\246\233\360A\233\000\215\227\374A\231\000\347\373\375"
+        "A\204\000\037\205\034B\307\0007\011#B\306\000\037\0051B\232\000\215\227\374A\234\000\341\372\001B\205"
+        "\000D\213\005B\310\000%\006\010B\206\000\264\310\015B\307\000d; B\311\000\134\017CB\206\000X9\355A\235"
+        "\000\207\026\376A\233\000\341\372\001B\311\000\246\233\016B\313\000Z\344\017B\207\000\364\375)B\310\000"
+        "R\270/B\313\000}\077\305A\207\000\0775\346A\210\0007\211\373A\234\000\207\026\376A\315\000\215\027\031"
+        "B\236\000\031\204,B\206\000\362R2B\317\000m\347\266A\210\000\236\357\274A\315\000\027\331\336A\316\000"
+        "w>\016B\237\000\002\253\027B\211\000{\224'B\235\000\031\204,B\317\000\234\304\340A\240\000X9\351A1\001"
+        "\264\310\362A\211\000\242E\020B\236\000\002\253\027B2\001V\216!B0\001\347\373+B\241\000\270\036\342A"
+        "\237\000X9\351A0\001\246\233\365A\212\000\016-\017B\211\000\242E\034B1\001\033/%B/\001#\333+B\240\000"
+        "\270\036\342A\243\000y\351\347A/\001\177j\361A\212\000\366\250\022B\242\000\027\331\032B0\001o\222!B"
+        ".\001\374\251,B\243\000#\333\274A\213\000+\207\301A\244\000\327\243\333A\245\000\335$\016B\214\00094"
+        "\020B\241\000\027\331\032B\212\000\343\2459B\242\000#\333\274A\245\000\000\000\344A\241\000y\351\347"
+        "A.\001\272I\363A\244\000\364\375\033B/\001h\021\042B,\001\303\365)B\245\000\201\225\316A\246\000V\016"
+        "\320A\247\000\230n\332A\242\000\327\243\333A\214\000%\006\016B\243\000\364\375\033B\250\000\317\367\034"
+        "B\244\000\201\225\316A\243\000\000\000\344A,\001\366(\363A\246\00033\367A\242\000\335$\016B.\001\221"
+        "m\042B\232\003\323MNB\244\000V\016\320A\232\003\236\357\344A\250\000y\351\354A\245\00033\367A\247\000"
+        "\035\332\017B\230\003R8 B\234\003\244\360MB\250\000d;\273A\244\000\230n\332A\214\000\351&\334A\215\000"
+        "\250\306\372A\246\000\035\332\017B\251\000-\262\033B\242\000\321\042<B\247\000d;\273A\251\000\010\254"
+        "\344A\230\003Nb\345A\246\000y\351\354A\244\000\317\367\034B\227\003L7!B\232\003\274\364&B\252\000P\215"
+        "\340A\227\003\252\361\343A\250\000\010\254\344A\215\000o\222\025B\247\000-\262\033B\226\0037\011\037"
+        "B\230\003!0%B\251\000P\215\340A\226\003\345\320\345A\253\000R\270\346A\216\000\303u\004B\227\003\266"
+        "s!B\225\003\347{!B\215\000y\351@B\225\003\321\042\346A\252\000R\270\346A\254\000\264\310\350A\217\000"
+        "\254\234\024B\255\000\347{\031B\224\003\266\363 B\226\003\331\316#B\255\000w\276\273A\256\0007\211\340"
+        "A\224\003q=\346A\253\000\264\310\350A\257\000\236o\027B\222\003\376T\037B\225\003\254\034%B\254\000w"
+        "\276\273A\257\000\303\365\327A\220\000\347\373\332A\217\000\354Q\364A\256\000\004V\016B\253\000\347{"
+        "\031B\261\000\256\307=B\257\000H\341\311A\254\0007\211\340A\222\003\232\231\345A\260\000\022\203\372"
+        "A\255\000\004V\016B\224\003\303u#B\220\003\362\322KB\256\000H\341\311A\260\000\010\254\317A\255\000\303"
+        "\365\327A\261\000q=\342A\220\000\325x\016B\254\000\236o\027B\262\000Zd\035B\257\000\010\254\317A<\003"
+        "\256G\341A\262\000ff\341A\256\000\022\203\372A\261\000`e\014B:\003\351\246\042B>\003mgMB\262\000/\335"
+        "\266A\221\000\020X\302A\257\000q=\342A\260\000`e\014B\220\000\226C\022B\263\000;\337\026B\255\000\256"
+        "\307=B\261\000/\335\266A\260\000ff\341A:\003\311v\344A\263\000\354Q\345A\257\000Zd\035B<\003\244\360"
+        "\037B9\003\327#$B\262\000\354Q\345A\264\000\266\363\345A9\003\301\312\346A\222\000\376T\025B\261\000"
+        ";\337\026B:\003\006\001 B8\003%\006%B8\003%\006\345A\265\000\354Q\345A\263\000\266\363\345A\222\000!"
+        "\260\017B\223\000\325\370\034B9\003\376\324 B7\003Nb$B7\003`\345\344A\264\000\354Q\345A\266\000y\351"
+        "\347A\223\000}\077\016B\267\000\264\310\027B8\003\020\330\037B6\003h\221%B\267\000\016-\264A6\003b\020"
+        "\346A\265\000y\351\347A\270\000y\351\347A\271\000\364\375\032B7\003\215\027 B4\003\134\217\042B\266\000"
+        "\016-\264A\224\000\213l\276A\271\000\201\225\334A\270\000R\270\015B\265\000\264\310\027B\223\000\221"
+        "\355'B\225\000Nb,B\271\000#\333\315A4\003o\022\344A\266\000y\351\347A\272\000\215\227\365A\267\000R\270"
+        "\015B6\003h\021!BN\0023\263KB\272\000R\270\315A\270\000#\333\315A\273\000o\022\330A\267\000\201\225\334"
+        "A\225\000\372~\030B\266\000\364\375\032B\274\000\024.\033B\271\000R\270\315A\274\000-\262\344AN\002B"
+        "`\345A\270\000\215\227\365A\273\000R\270\014BL\002F6\037B4\003\027YMB\274\000D\213\272A\225\000\256G"
+        "\303A\271\000o\022\330A\272\000R\270\014B\226\000\077\265\023B\275\000\000\200\032B\267\000\177\352<"
+        "B\273\000D\213\272A\272\000-\262\344A\275\000\033/\345AL\002\014\002\346A\271\000\024.\033BK\002\362"
+        "\322 BN\002\205k#B\274\000\033/\345A\276\000\213l\345AK\002T\343\345A\226\000-\262\020B\273\000\000\200"
+        "\032BJ\002\035Z!BL\002h\021%B\277\000\351&\340A\275\000\213l\345AJ\002\134\217\345A\227\000\254\034\006"
+        "BI\002f\346\036BK\002\217\302#B\226\000\343%/B\276\000\351&\340AI\002\010\254\343A\300\000\370S\355A"
+        "\301\000o\222\034B\227\000\002+\035BH\002u\023!BJ\002ff!B\301\000\215\227\274AH\002\240\032\345A\302"
+        "\0005^\346A\277\000\370S\355A\303\000\335$\032BF\002u\023 BI\002\321\042%B\300\000\215\227\274A\230\000"
+        "ff\326A\303\000)\134\332A\231\000\354Q\371A\302\000m\347\016B\277\000o\222\034B\305\000\311v;B\303\000"
+        "T\343\311AF\002\327\243\344A\300\0005^\346A\304\000\335$\365A\301\000m\347\016BH\002`\345&BE\002\335"
+        "$NB\302\000T\343\311A\304\000\246\233\315A\301\000)\134\332A\305\000\331\316\334A\231\000\236\357\015"
+        "B\300\000\335$\032B\306\000\335$\032B\303\000\246\233\315A\306\0005^\341AF\000\006\201\355A\302\000\335"
+        "$\365A\305\000\374\251\015BD\000o\022$BF\002\020\330MB\306\0005^\270A\232\000\301\312\327A\303\000\331"
+        "\316\334A\231\000\232\031\000B\304\000\374\251\015B\307\000\372~\030B\301\000\311v;B\305\0005^\270A\304"
+        "\0005^\341A\307\0005^\346AD\000\014\002\357A\303\000\335$\032BF\000\232\231#BC\000!0'B\310\000y\351\345"
+        "A\306\0005^\346AC\000\260r\355A\305\000\372~\030B\233\000d; B\232\0007\011#BD\0007\011%B\307\000y\351"
+        "\345A\311\000\317\367\347AB\000\370S\356A\233\000%\006\010BC\000\035Z$BA\000V\216$B\234\000R\270/B\312"
+        "\000\337O\344A\310\000\317\367\347AA\000\260r\355A\234\000\246\233\016B\313\000\272I\030B@\000;_$BB\000"
+        "\240\032%B\313\000\376\324\271A\311\000\337O\344A\314\000ff\351A@\000\215\227\355A\315\000\024.\033B"
+        "A\00094%B>\000\351&&B\312\000\376\324\271A\235\000}\077\305A\315\000\347\373\332A\234\000Z\344\017B\314"
+        "\000%\206\020B\311\000\272I\030B\236\000\000\000\077B\315\000b\020\321A>\000ff\350A\312\000ff\351A\316"
+        "\000\264\310\365A\313\000%\206\020B@\000\250F&B=\000\012\327PB\316\000\006\201\316A\314\000b\020\321"
+        "A\313\000\347\373\332A\236\000\027\331\336A\235\000\215\027\031B\312\000\024.\033B\317\000\376\324\035"
+        "B\315\000\006\201\316A\317\000\376\324\353A4\001\234\304\357A\314\000\264\310\365A\236\000w>\016B2\001"
+        "V\216,B>\000#[OB\236\000m\347\266A\237\000\234\304\340A\316\000\376\324\353A2\001\035Z\362A\315\000\376"
+        "\324\035B4\0013\263#B1\001X9*B\321\000J\014\312A\323\000X9\315A\322\000\256G\315A\325\000`\345\321A\324"
+        "\000q=\326A\327\000\006\001UB\333\000\004VVB\320\000J\014\312A\327\000\317\367\337A\325\000}\077\363"
+        "A\322\000\303\365\365A\330\000\246\233\023B\326\000\246\233\023B\323\000\024\256BB\320\000\256G\315A"
+        "\331\000\240\032\341A\323\000\305 \360A\321\000\303\365\365A\332\000\262\035\017B\330\000\205\353\026"
+        "B\324\000\364}FB\320\000X9\315A\333\000\232\231\337A\322\000\305 \360A\324\000\010\254\362A\334\000\351"
+        "\246\022B\332\000\002\253\023B\321\000\024\256BB\320\000q=\326A\335\000\033/\341A\323\000\010\254\362"
+        "A\325\000\313\241\366A\334\000\374)\020B\336\000\362R\022B\321\000\366\250EB\320\000`\345\321A\337\000"
+        "\242E\346A\321\000}\077\363A\324\000\313\241\366A\326\000D\213\020B\336\000\351\246\022B\323\000\254"
+        "\034DB\341\000D\213\357A\337\000\004\326\002B\327\000\311\366\004B\340\000\372\376\017B\325\000D\213"
+        "\020B\321\000\246\233\023B\342\000\201\225,B\321\000\317\367\337A\342\000^\272\370A\326\000\311\366\004"
+        "B\330\000\274\364\005B\343\000\356\374\007B\341\000)\3349B\344\000\356|KB\344\000)\134\346A\327\000\274"
+        "\364\005B\331\000\240\032\012B\321\000\246\233\023B\322\000\205\353\026B\343\000\006\001\034B\345\000"
+        "\010,\034B\322\000\240\032\341A\346\000\266\363\360A\332\000\260r\003B\345\000\323M\005B\330\000\240"
+        "\032\012B\347\000\305 8B\344\000\337\317OB\347\000\002+\352A\331\000\260r\003B\333\000\327\243\003B\350"
+        "\000f\346\015B\322\000\262\035\017B\323\000\002\253\023B\346\000\335$(B\323\000\232\231\337A\351\000"
+        "\270\036\364A\332\000\327\243\003B\334\000\351&\011B\350\000R\270\016B\352\000\356\374.B\322\000%\206"
+        "KB\352\0009\264\365A\353\000\020\330\003B\333\000\351&\011B\335\000\376T\011B\324\000\374)\020B\323\000"
+        "\351\246\022B\351\000w\276=B\324\000\033/\341A\354\000)\134\346A\336\000`\345\001B\334\000\376T\011B"
+        "\355\000yi\027B\353\000\262\035\036B\325\000\262\035PB\356\000\362\322\367A\335\000`\345\001B\355\000"
+        "\022\203\005B\337\000=\212\010B\324\000\362R\022B\325\000\351\246\022B\357\000\315L<B\325\000\242E\346"
+        "A\357\000\022\203\352A\326\000\004\326\002B\336\000=\212\010B\340\000F\266\015B\356\000j\274+B\321\000"
+        "\205\353RB\361\000\372~\377A\360\000F\266\377A\357\000\035Z\000B\341\000\345\320\002B\337\000F\266\015"
+        "B\326\000\372\376\017B\005\001\033\257GB\362\000\035Z\353A\326\000D\213\357A\342\000;\337\001B\340\000"
+        "\345\320\002B\361\000\311\366\025B\363\000\272\311'B\327\000)\3349B\363\000\264\310\356A\327\000^\272"
+        "\370A\343\000\004V\377A\341\000;\337\001B\364\0009\264\015B\326\000\201\225,B\362\000\242E2B\365\000"
+        "33\366A\342\000\004V\377A\344\000#[\000B\364\000\370\323\005B\327\000\356\374\007B\330\000\006\001\034"
+        "B\366\000\256\307<B\366\000\014\002\341A\330\000)\134\346A\343\000#[\000B\345\000ff\005B\365\000\213"
+        "l\032B\367\000w\276\042B\327\000\356|KB\367\000\303\365\365A\346\000\012W\002B\331\000\323M\005B\344"
+        "\000ff\005B\370\000\303\365\007B\330\000\010,\034B\366\000\205\353<B\371\0009\264\360A\331\000\266\363"
+        "\360A\347\000'1\001B\345\000\012W\002B\370\000\022\203\016B\332\000\335$(B\372\000\274t3B\372\000\331"
+        "\316\345A\332\000\002+\352A\350\000\370S\377A\346\000'1\001B\373\000\250\306\025B\371\000\234D(B\331"
+        "\000\305 8B\373\000\254\034\377A\347\000\370S\377A\374\000\376\324\001B\351\000\205k\002B\332\000f\346"
+        "\015B\333\000R\270\016B\372\000\230nEB\375\000\274t\344A\333\000\270\036\364A\350\000\205k\002B\352\000"
+        "D\213\005B\374\000\370\323\022B\376\000\240\032)B\334\000w\276=B\376\000\226C\352A\334\0009\264\365A"
+        "\353\000{\224\001B\351\000D\213\005B\377\0001\210\015B\333\000\356\374.B\375\000\250F4B\000\001\236\357"
+        "\363A\352\000{\224\001B\354\000\317\367\001B\334\000\020\330\003B\377\000\223\030\007B\335\000\262\035"
+        "\036B\001\001\272\311;B\335\000)\134\346A\001\0015^\346A\355\000sh\372A\353\000\317\367\001B\002\001"
+        "\037\205\034B\000\001\313\241\036B\336\000\252\361HB\002\001\246\233\360A\354\000sh\372A\356\000\307"
+        "K\005B\336\000\022\203\005B\003\001D\213\005B\335\000yi\027B\001\001\254\034;B\004\001X9\355A\336\000"
+        "\362\322\367A\357\000sh\003B\355\000\307K\005B\003\001\264\310\015B\337\000j\274+B\005\001\362R2B\005"
+        "\001\0775\346A\337\000\022\203\352A\340\000\035Z\000B\356\000sh\003B\360\000\345\320\023B\004\001\364"
+        "\375)B\336\000\315L<B\006\001\236\357\274A\005\0017\211\373A\340\000F\266\377A\361\000\337\317\002B\357"
+        "\000\345\320\023B5\0017\011%B7\001yi4B\340\000\372~\377A\360\000\337\317\002B\362\000f\346\002B\007\001"
+        "\242E\020B\341\000\311\366\025B\010\001\242E\034B\006\001{\224'B\341\000\035Z\353A\363\000\240\032\365"
+        "A\361\000f\346\002B\010\001\016-\017B\011\001\366\250\022B\342\000\242E2B\012\001\343\2459B\012\001+"
+        "\207\301A\342\000\264\310\356A\362\000\240\032\365A\364\000\305 \374A\341\000\272\311'B\013\001\002\253"
+        "0B\011\001\012\3271B\017\001\351&\334A\363\000\305 \374A\365\000Nb\004B\343\000\370\323\005B\342\000"
+        "9\264\015B\014\001%\006\016B\012\00194\020B\343\00033\366A\366\000D\213\367A\017\001\250\306\372A\364"
+        "\000Nb\004B\021\001o\222\025B\344\000\213l\032B\020\001sh4B\344\000\014\002\341A\365\000D\213\367A\367"
+        "\000\272I\001B\022\001\303u\004B\021\001`\345-B\023\001'10B\343\000\256\307<B\025\001\354Q\364A\345\000"
+        "\303\365\365A\366\000\272I\001B\370\000\226\303\001B\023\001\254\234\024B\344\000w\276\042B\024\001\262"
+        "\0355B\025\001\347\373\332A\371\000\006\201\374A\367\000\226\303\001B\345\000\303\365\007B\027\001\325"
+        "x\016B\346\000\022\203\016B\031\001\226C\022B\031\001\020X\302A\346\0009\264\360A\370\000\006\201\374"
+        "A\372\000\020X\376A\347\000\234D(B\032\001\232\031/B\033\001\343%/B\347\000\331\316\345A\373\000\177"
+        "j\373A\371\000\020X\376A\034\001!\260\017B\033\001\376T\025B\346\000\274t3B\031\001\345\320>B\372\000"
+        "\177j\373A\350\000\254\034\377A\374\0005^\001B\035\001}\077\016B\347\000\250\306\025B\034\001\325\370"
+        "\034B\037\001\221\355'B\037\001\213l\276A\375\000D\213\375A\373\0005^\001B\350\000\376\324\001B\351\000"
+        "\370\323\022B!\001\376T%B\036\001`\3453B#\001\256G\303A\351\000\274t\344A\374\000D\213\375A\376\000P"
+        "\215\000B!\001\372~\030B\037\001Nb,B\352\000\250F4B\352\000\226C\352A\377\000F\266\374A\375\000P\215"
+        "\000B%\001-\262\020B#\001\077\265\023B\351\000\240\032)B&\001\343%/B\376\000F\266\374A\000\001q\275\000"
+        "B&\001\254\034\006B\353\000\223\030\007B\352\0001\210\015B'\001\002+\035B%\001\240\232@B)\001ff\326A"
+        "\353\000\236\357\363A\001\001\024\256\370A\377\000q\275\000B\354\000\313\241\036B'\001;_#B(\001!01B\354"
+        "\0005^\346A\000\001\024\256\370A)\001\354Q\371A\002\001\347\373\375A-\001\232\031\000B+\001\236\357\015"
+        "B\355\000\254\034;B-\001\301\312\327A\355\000\246\233\360A\003\001\215\227\374A\001\001\347\373\375A"
+        "\354\000\037\205\034B/\0017\011#B.\001\037\0051B\002\001\215\227\374A\004\001\341\372\001B\355\000D\213"
+        "\005B0\001%\006\010B\356\000\264\310\015B/\001d; B1\001\134\017CB\356\000X9\355A\005\001\207\026\376"
+        "A\003\001\341\372\001B1\001\246\233\016B3\001Z\344\017B\357\000\364\375)B0\001R\270/B3\001}\077\305A"
+        "\357\000\0775\346A\360\0007\211\373A\004\001\207\026\376A5\001\215\027\031B\006\001\031\204,B\356\000"
+        "\362R2B7\001m\347\266A\360\000\236\357\274A5\001\027\331\336A6\001w>\016B\007\001\002\253\027B\361\000"
+        "{\224'B\005\001\031\204,B7\001\234\304\340A\010\001X9\351A9\000-\262\366A\361\000\242E\020B\006\001\002"
+        "\253\027B;\000\201\225'B8\000\177j*B\011\001\270\036\342A\007\001X9\351A8\000`\345\375A\362\000\016-"
+        "\017B\361\000\242E\034B9\000}\077)B7\000\177j*B\010\001\270\036\342A\013\001y\351\347A7\000-\262\366"
+        "A\362\000\366\250\022B\012\001\027\331\032Bg\000\351&)B8\000}\077)B\013\001#\333\274A\363\000+\207\301"
+        "A\014\001\327\243\333A\015\001\335$\016B\364\00094\020B\011\001\027\331\032B\362\000\343\2459B\012\001"
+        "#\333\274A\015\001\000\000\344A\011\001y\351\347Ag\000\035Z\370A\014\001\364\375\033B7\000\201\225'B"
+        "f\000T\343*B\015\001\201\225\316A\016\001V\016\320A\017\001\230n\332A\012\001\327\243\333A\364\000%\006"
+        "\016B\013\001\364\375\033B\020\001\317\367\034B\014\001\201\225\316A\013\001\000\000\344A\016\00133\367"
+        "Af\000\201\225\372A\012\001\335$\016Bg\0009\264)B\017\001\246\233PB\014\001V\016\320A\234\001sh\350A"
+        "\020\001y\351\354A\015\00133\367A\017\001\035\332\017B\232\001\366(&B\236\001)\134OB\020\001d;\273A\014"
+        "\001\230n\332A\364\000\351&\334A\365\000\250\306\372A\016\001\035\332\017B\021\001-\262\033B\012\001"
+        "\321\042<B\017\001d;\273A\021\001\010\254\344A\016\001y\351\354A\232\001\262\235\355A\014\001\317\367"
+        "\034B\231\001Ha$B\234\001\264H&B\022\001P\215\340A\020\001\010\254\344A\231\001\341z\355A\365\000o\222"
+        "\025B\017\001-\262\033B\230\001o\222$B\232\001L7%B\021\001P\215\340A\023\001R\270\346A\230\001B`\356"
+        "A\366\000\303u\004B\231\001\270\036%B\227\001\234\304&B\365\000y\351@B\022\001R\270\346A\024\001\250"
+        "\306\350A\227\001\006\201\355A\367\000\254\234\024B\025\001\347{\031B\230\001;_$B\226\001F6'B\025\001"
+        "w\276\273A\026\001D\213\340A\023\001\250\306\350A\226\001o\022\357A\027\001\236o\027B\224\001\223\030"
+        "$B\227\001V\016%B\024\001w\276\273A\027\001\303\365\327A\370\000\347\373\332A\367\000\354Q\364A\026\001"
+        "\004V\016B\023\001\347{\031B\031\001\256\307=B\027\001H\341\311A\024\001D\213\340A\224\001\201\225\355"
+        "A\030\001\022\203\372A\025\001\004V\016B\226\001\305\240#B\002\004\347{JB\026\001H\341\311A\030\001\010"
+        "\254\317A\025\001\303\365\327A\031\001q=\342A\370\000\325x\016B\024\001\236o\027B\032\001Zd\035B\027"
+        "\001\010\254\317A\002\004\037\205\335A\032\001ff\341A\026\001\022\203\372A\031\001`e\014B\000\004\262"
+        "\235\034B\003\004\232\231KB\032\001/\335\266A\371\000\020X\302A\027\001q=\342A\030\001`e\014B\370\000"
+        "\226C\022B\033\001;\337\026B\025\001\256\307=B\031\001/\335\266A\000\004\356|\333A\030\001ff\341A\033"
+        "\001\354Q\345A\027\001Zd\035B\002\004\274t B\377\003\014\002!B\377\003m\347\334A\032\001\354Q\345A\034"
+        "\001\266\363\345A\372\000\376T\025B\031\001;\337\026B\376\003\205k\037B\000\004\272\311\037B\376\003"
+        "\347\373\333A\035\001\354Q\345A\033\001\266\363\345A\372\000!\260\017B\373\000\325\370\034B\377\003\037"
+        "\005\035B\375\003\014\002\037B\375\003%\006\335A\034\001\354Q\345A\036\001y\351\347A\373\000}\077\016"
+        "B\037\001\264\310\027B\376\003\366(\037B\374\003R8\037B\037\001\016-\264A\374\003\374\251\334A \001y"
+        "\351\347A\035\001y\351\347A!\001\364\375\032B\372\003q\275\035B\375\003+\007 B\036\001\016-\264A\374"
+        "\000\213l\276A!\001\201\225\334A \001R\270\015B\035\001\264\310\027B\373\000\221\355'B\375\000Nb,B!\001"
+        "#\333\315A\372\003\264\310\333A\036\001y\351\347A\042\001\215\227\365A\037\001R\270\015B\374\003Z\344"
+        " B\370\003\232\231GB\042\001R\270\315A \001#\333\315A#\001o\022\330A\037\001\201\225\334A\375\000\372"
+        "~\030B\036\001\364\375\032B$\001\024.\033B!\001R\270\315A\244\003\205\353\337A$\001-\262\344A \001\215"
+        "\227\365A#\001R\270\014B\242\003\274\364&B\246\003\254\234IB$\001D\213\272A\375\000\256G\303A!\001o\022"
+        "\330A\042\001R\270\014B\376\000\077\265\023B%\001\000\200\032B\037\001\177\352<B#\001D\213\272A\242\003"
+        "\0775\344A\042\001-\262\344A%\001\033/\345A!\001\024.\033B\244\003\215\027\034B\241\003P\215'B$\001\033"
+        "/\345A&\001\213l\345A\241\003\217\302\345A\376\000-\262\020B#\001\000\200\032B\242\003f\346\033B\240"
+        "\003\217B(B'\001\351&\340A\240\003w\276\344A%\001\213l\345A\377\000\254\034\006B\241\003\242\305\034"
+        "B\237\003=\012(B\376\000\343%/B&\001\351&\340A\237\003\323M\344A(\001\370S\355A\240\003\217\302\031B"
+        ")\001o\222\034B\377\000\002+\035B\000\001;_#B)\001\215\227\274A\236\003!\260\344A*\0015^\346A'\001\370"
+        "S\355A+\001\335$\032B\237\003d\273\033B\234\003L\267%B(\001\215\227\274A\000\001ff\326A+\001)\134\332"
+        "A\001\001\354Q\371A*\001m\347\016B'\001o\222\034B-\001\311v;B+\001T\343\311A\234\003sh\344A(\0015^\346"
+        "A,\001\321\042\365A)\001m\347\016B\236\003T\343\034B-\001\010,OB*\001T\343\311A,\001\246\233\315A)\001"
+        ")\134\332A-\001\331\316\334A\001\001\236\357\015B(\001\335$\032B.\001\335$\032B+\001\246\233\315A.\001"
+        "5^\341A\245\000\366(\363A*\001\321\042\365A-\001\374\251\015B\243\000\303\365)B\234\003\345\320IB.\001"
+        "5^\270A\002\001\301\312\327A+\001\331\316\334A\001\001\232\031\000B,\001\374\251\015B/\001\372~\030B"
+        ")\001\311v;B-\0015^\270A,\0015^\341A/\0015^\346A\243\000\272I\363A+\001\335$\032B\245\000\221m\042B\241"
+        "\000\374\251,B0\001y\351\345A.\0015^\346A\241\000\177j\361A-\001\372~\030B\003\001d; B\243\000h\021\042"
+        "B\002\0017\011#B/\001y\351\345A1\001\317\367\347A\240\000\246\233\365A\003\001%\006\010B\241\000o\222"
+        "!B\237\000\347\373+B\004\001R\270/B2\001\337O\344A0\001\317\367\347A\237\000\264\310\362A\004\001\246"
+        "\233\016B3\001\272I\030B\240\000\033/%B\317\000X9*B3\001\376\324\271A1\001\337O\344A4\001ff\351A\317"
+        "\000\035Z\362A5\001\024.\033B\237\000V\216!B\316\000V\216,B2\001\376\324\271A\005\001}\077\305A5\001"
+        "\347\373\332A\004\001Z\344\017B4\001%\206\020B1\001\272I\030B\006\001\000\000\077B5\001b\020\321A2\001"
+        "ff\351A\316\000\234\304\357A6\001\264\310\365A3\001%\206\020B\317\0003\263#B\006\001\022\003SB6\001\006"
+        "\201\316A4\001b\020\321A3\001\347\373\332A\006\001\027\331\336A\005\001\215\027\031B2\001\024.\033B7"
+        "\001\376\324\035B5\001\006\201\316A7\001\376\324\353A4\001\264\310\365A=\000\201\225\372A\006\001w>\016"
+        "B;\000T\343*B\316\000\347{OB\006\001m\347\266A\007\001\234\304\340A6\001\376\324\353A;\000\035Z\370A"
+        "5\001\376\324\035B9\000\351&)B=\0009\264)B9\001J\014\312A;\001X9\315A:\001\256G\315A=\001`\345\321A<"
+        "\001q=\326A\077\001\006\001UBC\001\004VVB8\001J\014\312A\077\001\317\367\337A=\001}\077\363A:\001\317"
+        "\367\365A@\001\246\233\023B>\001\246\233\023B;\001\024\256BB8\001\256G\315AA\001\240\032\341A;\001\305"
+        " \360A9\001\317\367\365AB\001\262\035\017B@\001\205\353\026B<\001\364}FB8\001X9\315AC\001\232\231\337"
+        "A:\001\305 \360A<\001\010\254\362AD\001\351\246\022BB\001\002\253\023B9\001\024\256BB8\001q=\326AE\001"
+        "\033/\341A;\001\010\254\362A=\001\313\241\366AD\001\374)\020BF\001\362R\022B9\001\366\250EB8\001`\345"
+        "\321AG\001\242E\346A9\001}\077\363A<\001\313\241\366A>\001D\213\020BF\001\351\246\022B;\001\254\034D"
+        "BI\001D\213\357AG\001\004\326\002B\077\001\311\366\004BH\001\372\376\017B=\001D\213\020B9\001\246\233"
+        "\023BJ\001\201\225,B9\001\317\367\337AJ\001^\272\370A>\001\311\366\004B@\001\274\364\005BK\001\356\374"
+        "\007BI\001)\3349BL\001\356|KBL\001)\134\346A\077\001\274\364\005BA\001\240\032\012B9\001\246\233\023"
+        "B:\001\205\353\026BK\001\006\001\034BM\001\010,\034B:\001\240\032\341AN\001\266\363\360AB\001\260r\003"
+        "BM\001\323M\005B@\001\240\032\012BO\001\305 8BL\001\337\317OBO\001\002+\352AA\001\260r\003BC\001\327"
+        "\243\003BP\001f\346\015B:\001\262\035\017B;\001\002\253\023BN\001\335$(B;\001\232\231\337AQ\001\270\036"
+        "\364AB\001\327\243\003BD\001\351&\011BP\001R\270\016BR\001\356\374.B:\001%\206KBR\0019\264\365AS\001"
+        "\020\330\003BC\001\351&\011BE\001\376T\011B<\001\374)\020B;\001\351\246\022BQ\001w\276=B<\001\033/\341"
+        "AT\001)\134\346AF\001`\345\001BD\001\376T\011BU\001yi\027BS\001\262\035\036B=\001\262\035PBV\001\362"
+        "\322\367AE\001`\345\001BU\001\022\203\005BG\001=\212\010B<\001\362R\022B=\001\351\246\022BW\001\315L"
+        "<B=\001\242E\346AW\001\022\203\352A>\001\004\326\002BF\001=\212\010BH\001F\266\015BV\001j\274+B9\001"
+        "\205\353RBY\001\372~\377AX\001F\266\377AW\001\035Z\000BI\001\345\320\002BG\001F\266\015B>\001\372\376"
+        "\017Bm\001\033\257GBZ\001\035Z\353A>\001D\213\357AJ\001;\337\001BH\001\345\320\002BY\001\311\366\025"
+        "B[\001\272\311'B\077\001)\3349B[\001\264\310\356A\077\001^\272\370AK\001\004V\377AI\001;\337\001B\134"
+        "\0019\264\015B>\001\201\225,BZ\001\242E2B]\00133\366AJ\001\004V\377AL\001#[\000B\134\001\370\323\005"
+        "B\077\001\356\374\007B@\001\006\001\034B^\001\256\307<B^\001\014\002\341A@\001)\134\346AK\001#[\000B"
+        "M\001ff\005B]\001\213l\032B_\001w\276\042B\077\001\356|KB_\001\303\365\365AN\001\012W\002BA\001\323M"
+        "\005BL\001ff\005B`\001\303\365\007B@\001\010,\034B^\001\205\353<Ba\0019\264\360AA\001\266\363\360AO\001"
+        "'1\001BM\001\012W\002B`\001\022\203\016BB\001\335$(Bb\001\274t3Bb\001\331\316\345AB\001\002+\352AP\001"
+        "\370S\377AN\001'1\001Bc\001\250\306\025Ba\001\234D(BA\001\305 8Bc\001\254\034\377AO\001\370S\377Ad\001"
+        "\376\324\001BQ\001\205k\002BB\001f\346\015BC\001R\270\016Bb\001\230nEBe\001\274t\344AC\001\270\036\364"
+        "AP\001\205k\002BR\001D\213\005Bd\001\370\323\022Bf\001\240\032)BD\001w\276=Bf\001\226C\352AD\0019\264"
+        "\365AS\001{\224\001BQ\001D\213\005Bg\0011\210\015BC\001\356\374.Be\001\250F4Bh\001\236\357\363AR\001"
+        "{\224\001BT\001\317\367\001BD\001\020\330\003Bg\001\223\030\007BE\001\262\035\036Bi\001\272\311;BE\001"
+        ")\134\346Ai\0015^\346AU\001sh\372AS\001\317\367\001Bj\001\037\205\034Bh\001\313\241\036BF\001\252\361"
+        "HBj\001\246\233\360AT\001sh\372AV\001\307K\005BF\001\022\203\005Bk\001D\213\005BE\001yi\027Bi\001\254"
+        "\034;Bl\001X9\355AF\001\362\322\367AW\001sh\003BU\001\307K\005Bk\001\264\310\015BG\001j\274+Bm\001\362"
+        "R2Bm\001\0775\346AG\001\022\203\352AH\001\035Z\000BV\001sh\003BX\001\345\320\023Bl\001\364\375)BF\001"
+        "\315L<Bn\001\236\357\274Am\0017\211\373AH\001F\266\377AY\001\337\317\002BW\001\345\320\023B\235\0017"
+        "\011%B\237\001yi4BH\001\372~\377AX\001\337\317\002BZ\001f\346\002Bo\001\242E\020BI\001\311\366\025Bp"
+        "\001\242E\034Bn\001{\224'BI\001\035Z\353A[\001\240\032\365AY\001f\346\002Bp\001\016-\017Bq\001\366\250"
+        "\022BJ\001\242E2Br\001\343\2459Br\001+\207\301AJ\001\264\310\356AZ\001\240\032\365A\134\001\305 \374"
+        "AI\001\272\311'Bs\001\002\2530Bq\001\012\3271Bw\001\351&\334A[\001\305 \374A]\001Nb\004BK\001\370\323"
+        "\005BJ\0019\264\015Bt\001%\006\016Br\00194\020BK\00133\366A^\001D\213\367Aw\001\250\306\372A\134\001"
+        "Nb\004By\001o\222\025BL\001\213l\032Bx\001sh4BL\001\014\002\341A]\001D\213\367A_\001\272I\001Bz\001\303"
+        "u\004By\001`\345-B{\001'10BK\001\256\307<B}\001\354Q\364AM\001\303\365\365A^\001\272I\001B`\001\226\303"
+        "\001B{\001\254\234\024BL\001w\276\042B|\001\262\0355B}\001\347\373\332Aa\001\006\201\374A_\001\226\303"
+        "\001BM\001\303\365\007B\177\001\325x\016BN\001\022\203\016B\201\001\226C\022B\201\001\020X\302AN\001"
+        "9\264\360A`\001\006\201\374Ab\001\020X\376AO\001\234D(B\202\001\232\031/B\203\001\343%/BO\001\331\316"
+        "\345Ac\001\177j\373Aa\001\020X\376A\204\001!\260\017B\203\001\376T\025BN\001\274t3B\201\001\345\320>"
+        "Bb\001\177j\373AP\001\254\034\377Ad\0015^\001B\205\001}\077\016BO\001\250\306\025B\204\001\325\370\034"
+        "B\207\001\221\355'B\207\001\213l\276Ae\001D\213\375Ac\0015^\001BP\001\376\324\001BQ\001\370\323\022B"
+        "\211\001\376T%B\206\001`\3453B\213\001\256G\303AQ\001\274t\344Ad\001D\213\375Af\001P\215\000B\211\001"
+        "\372~\030B\207\001Nb,BR\001\250F4BR\001\226C\352Ag\001F\266\374Ae\001P\215\000B\215\001-\262\020B\213"
+        "\001\077\265\023BQ\001\240\032)B\216\001\343%/Bf\001F\266\374Ah\001q\275\000B\216\001\254\034\006BS\001"
+        "\223\030\007BR\0011\210\015B\217\001\002+\035B\215\001\240\232@B\221\001ff\326AS\001\236\357\363Ai\001"
+        "\024\256\370Ag\001q\275\000BT\001\313\241\036B\217\001;_#B\220\001!01BT\0015^\346Ah\001\024\256\370A"
+        "\221\001\354Q\371Aj\001\347\373\375A\225\001\232\031\000B\223\001\236\357\015BU\001\254\034;B\225\001"
+        "\301\312\327AU\001\246\233\360Ak\001\215\227\374Ai\001\347\373\375AT\001\037\205\034B\227\0017\011#B"
+        "\226\001\037\0051Bj\001\215\227\374Al\001\341\372\001BU\001D\213\005B\230\001%\006\010BV\001\264\310"
+        "\015B\227\001d; B\231\001\134\017CBV\001X9\355Am\001\207\026\376Ak\001\341\372\001B\231\001\246\233\016"
+        "B\233\001Z\344\017BW\001\364\375)B\230\001R\270/B\233\001}\077\305AW\001\0775\346AX\0017\211\373Al\001"
+        "\207\026\376A\235\001\215\027\031Bn\001\031\204,BV\001\362R2B\237\001m\347\266AX\001\236\357\274A\235"
+        "\001\027\331\336A\236\001w>\016Bo\001\002\253\027BY\001{\224'Bm\001\031\204,B\237\001\234\304\340Ap\001"
+        "X9\351Aa\000\203\300\362AY\001\242E\020Bn\001\002\253\027Bb\000J\214!B`\000\317\367+Bq\001\270\036\342"
+        "Ao\001X9\351A`\000h\221\365AZ\001\016-\017BY\001\242E\034Ba\000\002+%B_\000\004\326+Bp\001\270\036\342"
+        "As\001y\351\347A_\000)\134\361AZ\001\366\250\022Br\001\027\331\032B`\000P\215!B^\000\335\244,Bs\001#"
+        "\333\274A[\001+\207\301At\001\327\243\333Au\001\335$\016B\134\00194\020Bq\001\027\331\032BZ\001\343\245"
+        "9Br\001#\333\274Au\001\000\000\344Aq\001y\351\347A^\000X9\363At\001\364\375\033B_\000J\014\042B\134\000"
+        "\236\357)Bu\001\201\225\316Av\001V\016\320Aw\001\230n\332Ar\001\327\243\333A\134\001%\006\016Bs\001\364"
+        "\375\033Bx\001\317\367\034Bt\001\201\225\316As\001\000\000\344A\134\000{\024\363Av\00133\367Ar\001\335"
+        "$\016B^\000mg\042Bw\001\246\233PBt\001V\016\320A\004\002sh\350Ax\001y\351\354Au\00133\367Aw\001\035\332"
+        "\017B\002\002\366(&B\006\002)\134OBx\001d;\273At\001\230n\332A\134\001\351&\334A]\001\250\306\372Av\001"
+        "\035\332\017By\001-\262\033Br\001\321\042<Bw\001d;\273Ay\001\010\254\344Av\001y\351\354A\002\002\262"
+        "\235\355At\001\317\367\034B\001\002Ha$B\004\002\264H&Bz\001P\215\340Ax\001\010\254\344A\001\002\341z"
+        "\355A]\001o\222\025Bw\001-\262\033B\000\002o\222$B\002\002L7%By\001P\215\340A{\001R\270\346A\000\002"
+        "B`\356A^\001\303u\004B\001\002\270\036%B\377\001\234\304&B]\001y\351@Bz\001R\270\346A|\001\264\310\350"
+        "A\377\001\006\201\355A_\001\254\234\024B}\001\347{\031B\000\002;_$B\376\001F6'B}\001w\276\273A~\0017"
+        "\211\340A{\001\264\310\350A\376\001o\022\357A\177\001\236o\027B\374\001\223\030$B\377\001V\016%B|\001"
+        "w\276\273A\177\001\303\365\327A`\001\347\373\332A_\001\354Q\364A~\001\004V\016B{\001\347{\031B\201\001"
+        "\256\307=B\177\001H\341\311A|\0017\211\340A\374\001\201\225\355A\200\001\022\203\372A}\001\004V\016B"
+        "\376\001\305\240#Bj\004\347{JB~\001H\341\311A\200\001\010\254\317A}\001\303\365\327A\201\001q=\342A`"
+        "\001\325x\016B|\001\236o\027B\202\001Zd\035B\177\001\010\254\317Aj\004\037\205\335A\202\001ff\341A~\001"
+        "\022\203\372A\201\001`e\014Bh\004\262\235\034Bk\004\232\231KB\202\001/\335\266Aa\001\020X\302A\177\001"
+        "q=\342A\200\001`e\014B`\001\226C\022B\203\001;\337\026B}\001\256\307=B\201\001/\335\266Ah\004\356|\333"
+        "A\200\001ff\341A\203\001\354Q\345A\177\001Zd\035Bj\004\274t Bg\004\014\002!Bg\004m\347\334A\202\001\354"
+        "Q\345A\204\001\266\363\345Ab\001\376T\025B\201\001;\337\026Bf\004\205k\037Bh\004\272\311\037Bf\004\347"
+        "\373\333A\205\001\354Q\345A\203\001\266\363\345Ab\001!\260\017Bc\001\325\370\034Bg\004\037\005\035Be"
+        "\004\014\002\037Be\004%\006\335A\204\001\354Q\345A\206\001y\351\347Ac\001}\077\016B\207\001\264\310\027"
+        "Bf\004\366(\037Bd\004R8\037B\207\001\016-\264Ad\004\374\251\334A\210\001y\351\347A\205\001y\351\347A"
+        "\211\001\364\375\032Bb\004q\275\035Be\004+\007 B\206\001\016-\264Ad\001\213l\276A\211\001\201\225\334"
+        "A\210\001R\270\015B\205\001\264\310\027Bc\001\221\355'Be\001Nb,B\211\001#\333\315Ab\004\264\310\333A"
+        "\206\001y\351\347A\212\001\215\227\365A\207\001R\270\015Bd\004Z\344 B`\004\232\231GB\212\001R\270\315"
+        "A\210\001#\333\315A\213\001o\022\330A\207\001\201\225\334Ae\001\372~\030B\206\001\364\375\032B\214\001"
+        "\024.\033B\211\001R\270\315A\014\004\205\353\337A\214\001-\262\344A\210\001\215\227\365A\213\001R\270"
+        "\014B\012\004\274\364&B\016\004\254\234IB\214\001D\213\272Ae\001\256G\303A\211\001o\022\330A\212\001"
+        "R\270\014Bf\001\077\265\023B\215\001\000\200\032B\207\001\177\352<B\213\001D\213\272A\012\004\0775\344"
+        "A\212\001-\262\344A\215\001\033/\345A\211\001\024.\033B\014\004\215\027\034B\011\004P\215'B\214\001\033"
+        "/\345A\216\001\213l\345A\011\004\217\302\345Af\001-\262\020B\213\001\000\200\032B\012\004f\346\033B\010"
+        "\004\217B(B\217\001\351&\340A\010\004w\276\344A\215\001\213l\345Ag\001\254\034\006B\011\004\242\305\034"
+        "B\007\004=\012(Bf\001\343%/B\216\001\351&\340A\007\004\323M\344A\220\001\370S\355A\010\004\217\302\031"
+        "B\221\001o\222\034Bg\001\002+\035Bh\001;_#B\221\001\215\227\274A\006\004!\260\344A\222\0015^\346A\217"
+        "\001\370S\355A\223\001\335$\032B\007\004d\273\033B\004\004L\267%B\220\001\215\227\274Ah\001ff\326A\223"
+        "\001)\134\332Ai\001\354Q\371A\222\001m\347\016B\217\001o\222\034B\225\001\311v;B\223\001T\343\311A\004"
+        "\004sh\344A\220\0015^\346A\224\001\321\042\365A\221\001m\347\016B\006\004T\343\034B\225\001\010,OB\222"
+        "\001T\343\311A\224\001\246\233\315A\221\001)\134\332A\225\001\331\316\334Ai\001\236\357\015B\220\001"
+        "\335$\032B\226\001\335$\032B\223\001\246\233\315A\226\0015^\341A\026\001\201\225\355A\222\001\321\042"
+        "\365A\225\001\374\251\015B\024\001\223\030$B\004\004\345\320IB\226\0015^\270Aj\001\301\312\327A\223\001"
+        "\331\316\334Ai\001\232\031\000B\224\001\374\251\015B\227\001\372~\030B\221\001\311v;B\225\0015^\270A"
+        "\224\0015^\341A\227\0015^\346A\024\001o\022\357A\223\001\335$\032B\026\001\305\240#B\023\001F6'B\230"
+        "\001y\351\345A\226\0015^\346A\023\001\006\201\355A\225\001\372~\030Bk\001d; Bj\0017\011#B\024\001V\016"
+        "%B\227\001y\351\345A\231\001\317\367\347A\022\001B`\356Ak\001%\006\010B\023\001;_$B\021\001o\222$Bl\001"
+        "R\270/B\232\001\337O\344A\230\001\317\367\347A\021\001\341z\355Al\001\246\233\016B\233\001\272I\030B"
+        "\020\001Ha$B\022\001\270\036%B\233\001\376\324\271A\231\001\337O\344A\234\001ff\351A\020\001\262\235"
+        "\355A\235\001\024.\033B\021\001L7%B\016\001\366(&B\232\001\376\324\271Am\001}\077\305A\235\001\347\373"
+        "\332Al\001Z\344\017B\234\001%\206\020B\231\001\272I\030Bn\001\000\000\077B\235\001b\020\321A\016\001"
+        "sh\350A\232\001ff\351A\236\001\264\310\365A\233\001%\206\020B\020\001\264H&B\015\001\020\330PB\236\001"
+        "\006\201\316A\234\001b\020\321A\233\001\347\373\332An\001\027\331\336Am\001\215\027\031B\232\001\024"
+        ".\033B\237\001\376\324\035B\235\001\006\201\316A\237\001\376\324\353Ad\000\217\302\357A\234\001\264\310"
+        "\365An\001w>\016Bb\000J\214,B\016\001)\134OBn\001m\347\266Ao\001\234\304\340A\236\001\376\324\353Ab\000"
+        "\370S\362A\235\001\376\324\035Bd\000-\262#Ba\000L7*B\241\001J\014\312A\243\001X9\315A\242\001\256G\315"
+        "A\245\001`\345\321A\244\001q=\326A\247\001\006\001UB\253\001\004VVB\240\001J\014\312A\247\001\317\367"
+        "\337A\245\001}\077\363A\242\001\317\367\365A\250\001\246\233\023B\246\001\246\233\023B\243\001\024\256"
+        "BB\240\001\256G\315A\251\001\240\032\341A\243\001\305 \360A\241\001\317\367\365A\252\001\262\035\017"
+        "B\250\001\205\353\026B\244\001\364}FB\240\001X9\315A\253\001\232\231\337A\242\001\305 \360A\244\001\010"
+        "\254\362A\254\001\351\246\022B\252\001\002\253\023B\241\001\024\256BB\240\001q=\326A\255\001\033/\341"
+        "A\243\001\010\254\362A\245\001\313\241\366A\254\001\374)\020B\256\001\362R\022B\241\001\366\250EB\240"
+        "\001`\345\321A\257\001\242E\346A\241\001}\077\363A\244\001\313\241\366A\246\001D\213\020B\256\001\351"
+        "\246\022B\243\001\254\034DB\261\001D\213\357A\257\001\004\326\002B\247\001\311\366\004B\260\001\372\376"
+        "\017B\245\001D\213\020B\241\001\246\233\023B\262\001\201\225,B\241\001\317\367\337A\262\001^\272\370"
+        "A\246\001\311\366\004B\250\001\274\364\005B\263\001\356\374\007B\261\001)\3349B\264\001\356|KB\264\001"
+        ")\134\346A\247\001\274\364\005B\251\001\240\032\012B\241\001\246\233\023B\242\001\205\353\026B\263\001"
+        "\006\001\034B\265\001\010,\034B\242\001\240\032\341A\266\001\266\363\360A\252\001\260r\003B\265\001\323"
+        "M\005B\250\001\240\032\012B\267\001\305 8B\264\001\337\317OB\267\001\002+\352A\251\001\260r\003B\253"
+        "\001\327\243\003B\270\001f\346\015B\242\001\262\035\017B\243\001\002\253\023B\266\001\335$(B\243\001"
+        "\232\231\337A\271\001\270\036\364A\252\001\327\243\003B\254\001\351&\011B\270\001R\270\016B\272\001\356"
+        "\374.B\242\001%\206KB\272\0019\264\365A\273\001\020\330\003B\253\001\351&\011B\255\001\376T\011B\244"
+        "\001\374)\020B\243\001\351\246\022B\271\001w\276=B\244\001\033/\341A\274\001)\134\346A\256\001`\345\001"
+        "B\254\001\376T\011B\275\001yi\027B\273\001\262\035\036B\245\001\262\035PB\276\001\362\322\367A\255\001"
+        "`\345\001B\275\001\022\203\005B\257\001=\212\010B\244\001\362R\022B\245\001\351\246\022B\277\001\315"
+        "L<B\245\001\242E\346A\277\001\022\203\352A\246\001\004\326\002B\256\001=\212\010B\260\001F\266\015B\276"
+        "\001j\274+B\241\001\205\353RB\301\001\372~\377A\300\001F\266\377A\277\001\035Z\000B\261\001\345\320\002"
+        "B\257\001F\266\015B\246\001\372\376\017B\325\001\033\257GB\302\001\035Z\353A\246\001D\213\357A\262\001"
+        ";\337\001B\260\001\345\320\002B\301\001\311\366\025B\303\001\272\311'B\247\001)\3349B\303\001\264\310"
+        "\356A\247\001^\272\370A\263\001\004V\377A\261\001;\337\001B\304\0019\264\015B\246\001\201\225,B\302\001"
+        "\242E2B\305\00133\366A\262\001\004V\377A\264\001#[\000B\304\001\370\323\005B\247\001\356\374\007B\250"
+        "\001\006\001\034B\306\001\256\307<B\306\001\014\002\341A\250\001)\134\346A\263\001#[\000B\265\001ff\005"
+        "B\305\001\213l\032B\307\001w\276\042B\247\001\356|KB\307\001\303\365\365A\266\001\012W\002B\251\001\323"
+        "M\005B\264\001ff\005B\310\001\303\365\007B\250\001\010,\034B\306\001\205\353<B\311\0019\264\360A\251"
+        "\001\266\363\360A\267\001'1\001B\265\001\012W\002B\310\001\022\203\016B\252\001\335$(B\312\001\274t3"
+        "B\312\001\331\316\345A\252\001\002+\352A\270\001\370S\377A\266\001'1\001B\313\001\250\306\025B\311\001"
+        "\234D(B\251\001\305 8B\313\001\254\034\377A\267\001\370S\377A\314\001\376\324\001B\271\001\205k\002B"
+        "\252\001f\346\015B\253\001R\270\016B\312\001\230nEB\315\001\274t\344A\253\001\270\036\364A\270\001\205"
+        "k\002B\272\001D\213\005B\314\001\370\323\022B\316\001\240\032)B\254\001w\276=B\316\001\226C\352A\254"
+        "\0019\264\365A\273\001{\224\001B\271\001D\213\005B\317\0011\210\015B\253\001\356\374.B\315\001\250F4"
+        "B\320\001\236\357\363A\272\001{\224\001B\274\001\317\367\001B\254\001\020\330\003B\317\001\223\030\007"
+        "B\255\001\262\035\036B\321\001\272\311;B\255\001)\134\346A\321\0015^\346A\275\001sh\372A\273\001\317"
+        "\367\001B\322\001\037\205\034B\320\001\313\241\036B\256\001\252\361HB\322\001\246\233\360A\274\001sh"
+        "\372A\276\001\307K\005B\256\001\022\203\005B\323\001D\213\005B\255\001yi\027B\321\001\254\034;B\324\001"
+        "X9\355A\256\001\362\322\367A\277\001sh\003B\275\001\307K\005B\323\001\264\310\015B\257\001j\274+B\325"
+        "\001\362R2B\325\001\0775\346A\257\001\022\203\352A\260\001\035Z\000B\276\001sh\003B\300\001\345\320\023"
+        "B\324\001\364\375)B\256\001\315L<B\326\001\236\357\274A\325\0017\211\373A\260\001F\266\377A\301\001\337"
+        "\317\002B\277\001\345\320\023B\005\0027\011%B\007\002yi4B\260\001\372~\377A\300\001\337\317\002B\302"
+        "\001f\346\002B\327\001\242E\020B\261\001\311\366\025B\330\001\242E\034B\326\001{\224'B\261\001\035Z\353"
+        "A\303\001\240\032\365A\301\001f\346\002B\330\001\016-\017B\331\001\366\250\022B\262\001\242E2B\332\001"
+        "\343\2459B\332\001+\207\301A\262\001\264\310\356A\302\001\240\032\365A\304\001\305 \374A\261\001\272"
+        "\311'B\333\001\002\2530B\331\001\012\3271B\337\001\351&\334A\303\001\305 \374A\305\001Nb\004B\263\001"
+        "\370\323\005B\262\0019\264\015B\334\001%\006\016B\332\00194\020B\263\00133\366A\306\001D\213\367A\337"
+        "\001\250\306\372A\304\001Nb\004B\341\001o\222\025B\264\001\213l\032B\340\001sh4B\264\001\014\002\341"
+        "A\305\001D\213\367A\307\001\272I\001B\342\001\303u\004B\341\001`\345-B\343\001'10B\263\001\256\307<B"
+        "\345\001\354Q\364A\265\001\303\365\365A\306\001\272I\001B\310\001\226\303\001B\343\001\254\234\024B\264"
+        "\001w\276\042B\344\001\262\0355B\345\001\347\373\332A\311\001\006\201\374A\307\001\226\303\001B\265\001"
+        "\303\365\007B\347\001\325x\016B\266\001\022\203\016B\351\001\226C\022B\351\001\020X\302A\266\0019\264"
+        "\360A\310\001\006\201\374A\312\001\020X\376A\267\001\234D(B\352\001\232\031/B\353\001\343%/B\267\001"
+        "\331\316\345A\313\001\177j\373A\311\001\020X\376A\354\001!\260\017B\353\001\376T\025B\266\001\274t3B"
+        "\351\001\345\320>B\312\001\177j\373A\270\001\254\034\377A\314\0015^\001B\355\001}\077\016B\267\001\250"
+        "\306\025B\354\001\325\370\034B\357\001\221\355'B\357\001\213l\276A\315\001D\213\375A\313\0015^\001B\270"
+        "\001\376\324\001B\271\001\370\323\022B\361\001\376T%B\356\001`\3453B\363\001\256G\303A\271\001\274t\344"
+        "A\314\001D\213\375A\316\001P\215\000B\361\001\372~\030B\357\001Nb,B\272\001\250F4B\272\001\226C\352A"
+        "\317\001F\266\374A\315\001P\215\000B\365\001-\262\020B\363\001\077\265\023B\271\001\240\032)B\366\001"
+        "\343%/B\316\001F\266\374A\320\001q\275\000B\366\001\254\034\006B\273\001\223\030\007B\272\0011\210\015"
+        "B\367\001\002+\035B\365\001\240\232@B\371\001ff\326A\273\001\236\357\363A\321\001\024\256\370A\317\001"
+        "q\275\000B\274\001\313\241\036B\367\001;_#B\370\001!01B\274\0015^\346A\320\001\024\256\370A\371\001\354"
+        "Q\371A\322\001\347\373\375A\375\001\232\031\000B\373\001\236\357\015B\275\001\254\034;B\375\001\301\312"
+        "\327A\275\001\246\233\360A\323\001\215\227\374A\321\001\347\373\375A\274\001\037\205\034B\377\0017\011"
+        "#B\376\001\037\0051B\322\001\215\227\374A\324\001\341\372\001B\275\001D\213\005B\000\002%\006\010B\276"
+        "\001\264\310\015B\377\001d; B\001\002\134\017CB\276\001X9\355A\325\001\207\026\376A\323\001\341\372\001"
+        "B\001\002\246\233\016B\003\002Z\344\017B\277\001\364\375)B\000\002R\270/B\003\002}\077\305A\277\001\077"
+        "5\346A\300\0017\211\373A\324\001\207\026\376A\005\002\215\027\031B\326\001\031\204,B\276\001\362R2B\007"
+        "\002m\347\266A\300\001\236\357\274A\005\002\027\331\336A\006\002w>\016B\327\001\002\253\027B\301\001"
+        "{\224'B\325\001\031\204,B\007\002\234\304\340AW\000{\024\351A\330\001X9\351A\301\001\242E\020B\326\001"
+        "\002\253\027BX\000L7!BV\000\004V&B\331\001\270\036\342A\327\001X9\351AV\000\327\243\354A\302\001\016"
+        "-\017B\301\001\242E\034BW\000Zd!BU\000\266s&B\330\001\270\036\342A\333\001y\351\347AU\000ff\351A\302"
+        "\001\366\250\022B\332\001\027\331\032BV\000\234\304 BT\000\250F&B\333\001#\333\274A\303\001+\207\301"
+        "A\334\001\327\243\333A\335\001\335$\016B\304\00194\020B\331\001\027\331\032B\302\001\343\2459B\332\001"
+        "#\333\274A\335\001\000\000\344A\331\001y\351\347AT\000j\274\351A\334\001\364\375\033BU\000H\341!BR\000"
+        "\201\025%B\335\001\201\225\316A\336\001V\016\320A\337\001\230n\332A\332\001\327\243\333A\304\001%\006"
+        "\016B\333\001\364\375\033B\340\001\317\367\034B\334\001\201\225\316A\333\001\000\000\344AR\000^\272\352"
+        "A\336\00133\367A\332\001\335$\016BT\000\037\005\042BP\000\317\367OB\334\001V\016\320Al\002sh\350A\340"
+        "\001y\351\354A\335\00133\367A\337\001\035\332\017Bj\002\366(&Bn\002)\134OB\340\001d;\273A\334\001\230"
+        "n\332A\304\001\351&\334A\305\001\250\306\372A\336\001\035\332\017B\341\001-\262\033B\332\001\321\042"
+        "<B\337\001d;\273A\341\001\010\254\344A\336\001y\351\354Aj\002\262\235\355A\334\001\317\367\034Bi\002"
+        "Ha$Bl\002\264H&B\342\001P\215\340A\340\001\010\254\344Ai\002\341z\355A\305\001o\222\025B\337\001-\262"
+        "\033Bh\002o\222$Bj\002L7%B\341\001P\215\340A\343\001R\270\346Ah\002B`\356A\306\001\303u\004Bi\002\270"
+        "\036%Bg\002\234\304&B\305\001y\351@B\342\001R\270\346A\344\001\250\306\350Ag\002\006\201\355A\307\001"
+        "\254\234\024B\345\001\347{\031Bh\002;_$Bf\002F6'B\345\001w\276\273A\346\001D\213\340A\343\001\250\306"
+        "\350Af\002o\022\357A\347\001\236o\027Bd\002\223\030$Bg\002V\016%B\344\001w\276\273A\347\001\303\365\327"
+        "A\310\001\347\373\332A\307\001\354Q\364A\346\001\004V\016B\343\001\347{\031B\351\001\256\307=B\347\001"
+        "H\341\311A\344\001D\213\340Ad\002\201\225\355A\350\001\022\203\372A\345\001\004V\016Bf\002\305\240#B"
+        "\312\002\347{JB\346\001H\341\311A\350\001\010\254\317A\345\001\303\365\327A\351\001q=\342A\310\001\325"
+        "x\016B\344\001\236o\027B\352\001Zd\035B\347\001\010\254\317A\312\002\037\205\335A\352\001ff\341A\346"
+        "\001\022\203\372A\351\001`e\014B\310\002\262\235\034B\313\002\232\231KB\352\001/\335\266A\311\001\020"
+        "X\302A\347\001q=\342A\350\001`e\014B\310\001\226C\022B\353\001;\337\026B\345\001\256\307=B\351\001/\335"
+        "\266A\310\002\356|\333A\350\001ff\341A\353\001\354Q\345A\347\001Zd\035B\312\002\274t B\307\002\014\002"
+        "!B\307\002m\347\334A\352\001\354Q\345A\354\001\266\363\345A\312\001\376T\025B\351\001;\337\026B\306\002"
+        "\205k\037B\310\002\272\311\037B\306\002\347\373\333A\355\001\354Q\345A\353\001\266\363\345A\312\001!"
+        "\260\017B\313\001\325\370\034B\307\002\037\005\035B\305\002\014\002\037B\305\002%\006\335A\354\001\354"
+        "Q\345A\356\001y\351\347A\313\001}\077\016B\357\001\264\310\027B\306\002\366(\037B\304\002R8\037B\357"
+        "\001\016-\264A\304\002\374\251\334A\355\001y\351\347A\360\001y\351\347A\361\001\364\375\032B\302\002"
+        "q\275\035B\305\002+\007 B\356\001\016-\264A\314\001\213l\276A\361\001\201\225\334A\360\001R\270\015B"
+        "\355\001\264\310\027B\313\001\221\355'B\315\001Nb,B\361\001#\333\315A\302\002\264\310\333A\356\001y\351"
+        "\347A\362\001\215\227\365A\357\001R\270\015B\304\002Z\344 B\300\002\232\231GB\362\001R\270\315A\360\001"
+        "#\333\315A\363\001o\022\330A\357\001\201\225\334A\315\001\372~\030B\356\001\364\375\032B\364\001\024"
+        ".\033B\361\001R\270\315At\004\205\353\337A\364\001-\262\344A\360\001\215\227\365A\363\001R\270\014Br"
+        "\004\274\364&Bv\004\254\234IB\364\001D\213\272A\315\001\256G\303A\361\001o\022\330A\362\001R\270\014"
+        "B\316\001\077\265\023B\365\001\000\200\032B\357\001\177\352<B\363\001D\213\272Ar\004\0775\344A\362\001"
+        "-\262\344A\365\001\033/\345A\361\001\024.\033Bt\004\215\027\034Bq\004P\215'B\364\001\033/\345A\366\001"
+        "\213l\345Aq\004\217\302\345A\316\001-\262\020B\363\001\000\200\032Br\004f\346\033Bp\004\217B(B\367\001"
+        "\351&\340Ap\004w\276\344A\365\001\213l\345A\317\001\254\034\006Bq\004\242\305\034Bo\004=\012(B\316\001"
+        "\343%/B\366\001\351&\340Ao\004\323M\344A\370\001\370S\355Ap\004\217\302\031B\371\001o\222\034B\317\001"
+        "\002+\035B\320\001;_#B\371\001\215\227\274An\004!\260\344A\372\0015^\346A\367\001\370S\355A\373\001\335"
+        "$\032Bo\004d\273\033Bl\004L\267%B\370\001\215\227\274A\320\001ff\326A\373\001)\134\332A\321\001\354Q"
+        "\371A\372\001m\347\016B\367\001o\222\034B\375\001\311v;B\373\001T\343\311Al\004sh\344A\370\0015^\346"
+        "A\374\001\335$\365A\371\001m\347\016Bn\004T\343\034B\375\001\010,OB\372\001T\343\311A\374\001\246\233"
+        "\315A\371\001)\134\332A\375\001\331\316\334A\321\001\236\357\015B\370\001\335$\032B\376\001\335$\032"
+        "B\373\001\246\233\315A\376\0015^\341A~\001\201\225\355A\372\001\335$\365A\375\001\374\251\015B|\001\223"
+        "\030$Bl\004\345\320IB\376\0015^\270A\322\001\301\312\327A\373\001\331\316\334A\321\001\232\031\000B\374"
+        "\001\374\251\015B\377\001\372~\030B\371\001\311v;B\375\0015^\270A\374\0015^\341A\377\0015^\346A|\001"
+        "o\022\357A\373\001\335$\032B~\001\305\240#B{\001F6'B\000\002y\351\345A\376\0015^\346A{\001\006\201\355"
+        "A\375\001\372~\030B\323\001d; B\322\0017\011#B|\001V\016%B\377\001y\351\345A\001\002\317\367\347Az\001"
+        "B`\356A\323\001%\006\010B{\001;_$By\001o\222$B\324\001R\270/B\002\002\337O\344A\000\002\317\367\347A"
+        "y\001\341z\355A\324\001\246\233\016B\003\002\272I\030Bx\001Ha$Bz\001\270\036%B\003\002\376\324\271A\001"
+        "\002\337O\344A\004\002ff\351Ax\001\262\235\355A\005\002\024.\033By\001L7%Bv\001\366(&B\002\002\376\324"
+        "\271A\325\001}\077\305A\005\002\347\373\332A\324\001Z\344\017B\004\002%\206\020B\001\002\272I\030B\326"
+        "\001\000\000\077B\005\002b\020\321Av\001sh\350A\002\002ff\351A\006\002\264\310\365A\003\002%\206\020"
+        "Bx\001\264H&Bu\001\020\330PB\006\002\006\201\316A\004\002b\020\321A\003\002\347\373\332A\326\001\027"
+        "\331\336A\325\001\215\027\031B\002\002\024.\033B\007\002\376\324\035B\005\002\006\201\316AZ\000\264\310"
+        "\353A\007\002\376\324\353A\004\002\264\310\365A\326\001w>\016BX\000\006\201&B\134\000\012\327MB\326\001"
+        "m\347\266A\327\001\234\304\340AX\000\260r\351A\006\002\376\324\353A\005\002\376\324\035BZ\00094$BW\000"
+        "\372\376&B\011\002J\014\312A\013\002X9\315A\012\002\256G\315A\015\002`\345\321A\014\002q=\326A\017\002"
+        "\006\001UB\023\002\004VVB\010\002J\014\312A\017\002\317\367\337A\015\002}\077\363A\012\002\303\365\365"
+        "A\020\002\246\233\023B\016\002\246\233\023B\013\002\024\256BB\010\002\256G\315A\021\002\240\032\341A"
+        "\013\002\305 \360A\011\002\303\365\365A\022\002\262\035\017B\020\002\205\353\026B\014\002\364}FB\010"
+        "\002X9\315A\023\002\232\231\337A\012\002\305 \360A\014\002\010\254\362A\024\002\351\246\022B\022\002"
+        "\002\253\023B\011\002\024\256BB\010\002q=\326A\025\002\033/\341A\013\002\010\254\362A\015\002\313\241"
+        "\366A\024\002\374)\020B\026\002\362R\022B\011\002\366\250EB\010\002`\345\321A\027\002\242E\346A\011\002"
+        "}\077\363A\014\002\313\241\366A\016\002D\213\020B\026\002\351\246\022B\013\002\254\034DB\031\002D\213"
+        "\357A\027\002\004\326\002B\017\002\311\366\004B\030\002\372\376\017B\015\002D\213\020B\011\002\246\233"
+        "\023B\032\002\201\225,B\011\002\317\367\337A\032\002^\272\370A\016\002\311\366\004B\020\002\274\364\005"
+        "B\033\002\356\374\007B\031\002)\3349B\034\002\356|KB\034\002)\134\346A\017\002\274\364\005B\021\002\240"
+        "\032\012B\011\002\246\233\023B\012\002\205\353\026B\033\002\006\001\034B\035\002\010,\034B\012\002\240"
+        "\032\341A\036\002\266\363\360A\022\002\260r\003B\035\002\323M\005B\020\002\240\032\012B\037\002\305 "
+        "8B\034\002\337\317OB\037\002\002+\352A\021\002\260r\003B\023\002\327\243\003B \002f\346\015B\012\002"
+        "\262\035\017B\013\002\002\253\023B\036\002\335$(B\013\002\232\231\337A!\002\270\036\364A\022\002\327"
+        "\243\003B\024\002\351&\011B \002R\270\016B\042\002\356\374.B\012\002%\206KB\042\0029\264\365A#\002\020"
+        "\330\003B\023\002\351&\011B\025\002\376T\011B\014\002\374)\020B\013\002\351\246\022B!\002w\276=B\014"
+        "\002\033/\341A$\002)\134\346A\026\002`\345\001B\024\002\376T\011B%\002yi\027B#\002\262\035\036B\015\002"
+        "\262\035PB&\002\362\322\367A\025\002`\345\001B%\002\022\203\005B\027\002=\212\010B\014\002\362R\022B"
+        "\015\002\351\246\022B'\002\315L<B\015\002\242E\346A'\002\022\203\352A\016\002\004\326\002B\026\002=\212"
+        "\010B\030\002F\266\015B&\002j\274+B\011\002\205\353RB)\002\372~\377A(\002F\266\377A'\002\035Z\000B\031"
+        "\002\345\320\002B\027\002F\266\015B\016\002\372\376\017B=\002\033\257GB*\002\035Z\353A\016\002D\213\357"
+        "A\032\002;\337\001B\030\002\345\320\002B)\002\311\366\025B+\002\272\311'B\017\002)\3349B+\002\264\310"
+        "\356A\017\002^\272\370A\033\002\004V\377A\031\002;\337\001B,\0029\264\015B\016\002\201\225,B*\002\242"
+        "E2B-\00233\366A\032\002\004V\377A\034\002#[\000B,\002\370\323\005B\017\002\356\374\007B\020\002\006\001"
+        "\034B.\002\256\307<B.\002\014\002\341A\020\002)\134\346A\033\002#[\000B\035\002ff\005B-\002\213l\032"
+        "B/\002w\276\042B\017\002\356|KB/\002\303\365\365A\036\002\012W\002B\021\002\323M\005B\034\002ff\005B"
+        "0\002\303\365\007B\020\002\010,\034B.\002\205\353<B1\0029\264\360A\021\002\266\363\360A\037\002'1\001"
+        "B\035\002\012W\002B0\002\022\203\016B\022\002\335$(B2\002\274t3B2\002\331\316\345A\022\002\002+\352A"
+        " \002\370S\377A\036\002'1\001B3\002\250\306\025B1\002\234D(B\021\002\305 8B3\002\254\034\377A\037\002"
+        "\370S\377A4\002\376\324\001B!\002\205k\002B\022\002f\346\015B\023\002R\270\016B2\002\230nEB5\002\274"
+        "t\344A\023\002\270\036\364A \002\205k\002B\042\002D\213\005B4\002\370\323\022B6\002\240\032)B\024\002"
+        "w\276=B6\002\226C\352A\024\0029\264\365A#\002{\224\001B!\002D\213\005B7\0021\210\015B\023\002\356\374"
+        ".B5\002\250F4B8\002\236\357\363A\042\002{\224\001B$\002\317\367\001B\024\002\020\330\003B7\002\223\030"
+        "\007B\025\002\262\035\036B9\002\272\311;B\025\002)\134\346A9\0025^\346A%\002sh\372A#\002\317\367\001"
+        "B:\002\037\205\034B8\002\313\241\036B\026\002\252\361HB:\002\246\233\360A$\002sh\372A&\002\307K\005B"
+        "\026\002\022\203\005B;\002D\213\005B\025\002yi\027B9\002\254\034;B<\002X9\355A\026\002\362\322\367A'"
+        "\002sh\003B%\002\307K\005B;\002\264\310\015B\027\002j\274+B=\002\362R2B=\002\0775\346A\027\002\022\203"
+        "\352A\030\002\035Z\000B&\002sh\003B(\002\345\320\023B<\002\364\375)B\026\002\315L<B>\002\236\357\274"
+        "A=\0027\211\373A\030\002F\266\377A)\002\337\317\002B'\002\345\320\023Bm\0027\011%Bo\002yi4B\030\002\372"
+        "~\377A(\002\337\317\002B*\002f\346\002B\077\002\242E\020B\031\002\311\366\025B@\002\242E\034B>\002{\224"
+        "'B\031\002\035Z\353A+\002\240\032\365A)\002f\346\002B@\002\016-\017BA\002\366\250\022B\032\002\242E2"
+        "BB\002\343\2459BB\002+\207\301A\032\002\264\310\356A*\002\240\032\365A,\002\305 \374A\031\002\272\311"
+        "'BC\002\002\2530BA\002\012\3271BG\002\351&\334A+\002\305 \374A-\002Nb\004B\033\002\370\323\005B\032\002"
+        "9\264\015BD\002%\006\016BB\00294\020B\033\00233\366A.\002D\213\367AG\002\250\306\372A,\002Nb\004BI\002"
+        "o\222\025B\034\002\213l\032BH\002sh4B\034\002\014\002\341A-\002D\213\367A/\002\272I\001BJ\002\303u\004"
+        "BI\002`\345-BK\002'10B\033\002\256\307<BM\002\354Q\364A\035\002\303\365\365A.\002\272I\001B0\002\226"
+        "\303\001BK\002\254\234\024B\034\002w\276\042BL\002\262\0355BM\002\347\373\332A1\002\006\201\374A/\002"
+        "\226\303\001B\035\002\303\365\007BO\002\325x\016B\036\002\022\203\016BQ\002\226C\022BQ\002\020X\302A"
+        "\036\0029\264\360A0\002\006\201\374A2\002\020X\376A\037\002\234D(BR\002\232\031/BS\002\343%/B\037\002"
+        "\331\316\345A3\002\177j\373A1\002\020X\376AT\002!\260\017BS\002\376T\025B\036\002\274t3BQ\002\345\320"
+        ">B2\002\177j\373A \002\254\034\377A4\0025^\001BU\002}\077\016B\037\002\250\306\025BT\002\325\370\034"
+        "BW\002\221\355'BW\002\213l\276A5\002D\213\375A3\0025^\001B \002\376\324\001B!\002\370\323\022BY\002\376"
+        "T%BV\002`\3453B[\002\256G\303A!\002\274t\344A4\002D\213\375A6\002P\215\000BY\002\372~\030BW\002Nb,B\042"
+        "\002\250F4B\042\002\226C\352A7\002F\266\374A5\002P\215\000B]\002-\262\020B[\002\077\265\023B!\002\240"
+        "\032)B^\002\343%/B6\002F\266\374A8\002q\275\000B^\002\254\034\006B#\002\223\030\007B\042\0021\210\015"
+        "B_\002\002+\035B]\002\240\232@Ba\002ff\326A#\002\236\357\363A9\002\024\256\370A7\002q\275\000B$\002\313"
+        "\241\036B_\002;_#B`\002!01B$\0025^\346A8\002\024\256\370Aa\002\354Q\371A:\002\347\373\375Ae\002\232\031"
+        "\000Bc\002\236\357\015B%\002\254\034;Be\002\301\312\327A%\002\246\233\360A;\002\215\227\374A9\002\347"
+        "\373\375A$\002\037\205\034Bg\0027\011#Bf\002\037\0051B:\002\215\227\374A<\002\341\372\001B%\002D\213"
+        "\005Bh\002%\006\010B&\002\264\310\015Bg\002d; Bi\002\134\017CB&\002X9\355A=\002\207\026\376A;\002\341"
+        "\372\001Bi\002\246\233\016Bk\002Z\344\017B'\002\364\375)Bh\002R\270/Bk\002}\077\305A'\002\0775\346A("
+        "\0027\211\373A<\002\207\026\376Am\002\215\027\031B>\002\031\204,B&\002\362R2Bo\002m\347\266A(\002\236"
+        "\357\274Am\002\027\331\336An\002w>\016B\077\002\002\253\027B)\002{\224'B=\002\031\204,Bo\002\234\304"
+        "\340A@\002X9\351AM\0005^\352A)\002\242E\020B>\002\002\253\027BL\000\337\317\042BN\000\232\231%BA\002"
+        "\270\036\342A\077\002X9\351AL\000+\207\355A*\002\016-\017B)\002\242E\034BK\000mg#BM\0001\210'B@\002\270"
+        "\036\342AC\002y\351\347AK\000\217\302\352A*\002\366\250\022BB\002\027\331\032BJ\000\266\363\042BL\000"
+        "#\333$BC\002#\333\274A+\002+\207\301AD\002\327\243\333AE\002\335$\016B,\00294\020BA\002\027\331\032B"
+        "*\002\343\2459BB\002#\333\274AE\002\000\000\344AA\002y\351\347AJ\000\341z\352AD\002\364\375\033BH\000"
+        "\325\370 BK\000\022\003&BE\002\201\225\316AF\002V\016\320AG\002\230n\332AB\002\327\243\333A,\002%\006"
+        "\016BC\002\364\375\033BH\002\317\367\034BD\002\201\225\316AC\002\000\000\344AH\000Zd\354AF\00233\367"
+        "AB\002\335$\016BJ\000\362\322%B\302\000\335$NBD\002V\016\320A\302\000\327\243\344AH\002y\351\354AE\002"
+        "33\367AG\002\035\332\017B\300\000u\023 B\304\000\020\330MBH\002d;\273AD\002\230n\332A,\002\351&\334A"
+        "-\002\250\306\372AF\002\035\332\017BI\002-\262\033BB\002\321\042<BG\002d;\273AI\002\010\254\344A\300"
+        "\000\240\032\345AF\002y\351\354AD\002\317\367\034B\277\000u\023!B\302\000`\345&BJ\002P\215\340A\277\000"
+        "\010\254\343AH\002\010\254\344A-\002o\222\025BG\002-\262\033B\276\000f\346\036B\300\000\321\042%BI\002"
+        "P\215\340A\276\000\134\217\345AK\002R\270\346A.\002\303u\004B\275\000\035Z!B\277\000ff!B-\002y\351@B"
+        "\275\000T\343\345AJ\002R\270\346AL\002\264\310\350A/\002\254\234\024BM\002\347{\031B\274\000\362\322"
+        " B\276\000\217\302#BM\002w\276\273AN\0027\211\340A\274\000\014\002\346AK\002\264\310\350AO\002\236o\027"
+        "B\272\000F6\037B\275\000h\021%BL\002w\276\273AO\002\303\365\327A0\002\347\373\332A/\002\354Q\364AN\002"
+        "\004V\016BK\002\347{\031BQ\002\256\307=BO\002H\341\311AL\0027\211\340A\272\000B`\345AP\002\022\203\372"
+        "AM\002\004V\016B\274\000\205k#B2\003\347{JBN\002H\341\311AP\002\010\254\317AM\002\303\365\327AQ\002q"
+        "=\342A0\002\325x\016BL\002\236o\027BR\002Zd\035BO\002\010\254\317A2\003\037\205\335AR\002ff\341AN\002"
+        "\022\203\372AQ\002`e\014B0\003\262\235\034B3\003\232\231KBR\002/\335\266A1\002\020X\302AO\002q=\342A"
+        "P\002`e\014B0\002\226C\022BS\002;\337\026BM\002\256\307=BQ\002/\335\266A0\003\356|\333AP\002ff\341AS"
+        "\002\354Q\345AO\002Zd\035B2\003\274t B/\003\014\002!B/\003m\347\334AR\002\354Q\345AT\002\266\363\345"
+        "A2\002\376T\025BQ\002;\337\026B.\003\205k\037B0\003\272\311\037B.\003\347\373\333AU\002\354Q\345AS\002"
+        "\266\363\345A2\002!\260\017B3\002\325\370\034B/\003\037\005\035B-\003\014\002\037B-\003%\006\335AT\002"
+        "\354Q\345AV\002y\351\347A3\002}\077\016BW\002\264\310\027B.\003\366(\037B,\003R8\037BW\002\016-\264A"
+        ",\003\374\251\334AU\002y\351\347AX\002y\351\347AY\002\364\375\032B*\003q\275\035B-\003+\007 BV\002\016"
+        "-\264A4\002\213l\276AY\002\201\225\334AX\002R\270\015BU\002\264\310\027B3\002\221\355'B5\002Nb,BY\002"
+        "#\333\315A*\003\264\310\333AV\002y\351\347AZ\002\215\227\365AW\002R\270\015B,\003Z\344 B(\003\232\231"
+        "GBZ\002R\270\315AX\002#\333\315A[\002o\022\330AW\002\201\225\334A5\002\372~\030BV\002\364\375\032B\134"
+        "\002\024.\033BY\002R\270\315A\324\002\205\353\337A\134\002-\262\344AX\002\215\227\365A[\002R\270\014"
+        "B\322\002\274\364&B\326\002\254\234IB\134\002D\213\272A5\002\256G\303AY\002o\022\330AZ\002R\270\014B"
+        "6\002\077\265\023B]\002\000\200\032BW\002\177\352<B[\002D\213\272A\322\002\0775\344AZ\002-\262\344A]"
+        "\002\033/\345AY\002\024.\033B\324\002\215\027\034B\321\002P\215'B\134\002\033/\345A^\002\213l\345A\321"
+        "\002\217\302\345A6\002-\262\020B[\002\000\200\032B\322\002f\346\033B\320\002\217B(B_\002\351&\340A\320"
+        "\002w\276\344A]\002\213l\345A7\002\254\034\006B\321\002\242\305\034B\317\002=\012(B6\002\343%/B^\002"
+        "\351&\340A\317\002\323M\344A`\002\370S\355A\320\002\217\302\031Ba\002o\222\034B7\002\002+\035B8\002;"
+        "_#Ba\002\215\227\274A\316\002!\260\344Ab\0025^\346A_\002\370S\355Ac\002\335$\032B\317\002d\273\033B\314"
+        "\002L\267%B`\002\215\227\274A8\002ff\326Ac\002)\134\332A9\002\354Q\371Ab\002m\347\016B_\002o\222\034"
+        "Be\002\311v;Bc\002T\343\311A\314\002sh\344A`\0025^\346Ad\002\335$\365Aa\002m\347\016B\316\002T\343\034"
+        "Be\002\010,OBb\002T\343\311Ad\002\246\233\315Aa\002)\134\332Ae\002\331\316\334A9\002\236\357\015B`\002"
+        "\335$\032Bf\002\335$\032Bc\002\246\233\315Af\0025^\341A\346\001\201\225\355Ab\002\335$\365Ae\002\374"
+        "\251\015B\344\001\223\030$B\314\002\345\320IBf\0025^\270A:\002\301\312\327Ac\002\331\316\334A9\002\232"
+        "\031\000Bd\002\374\251\015Bg\002\372~\030Ba\002\311v;Be\0025^\270Ad\0025^\341Ag\0025^\346A\344\001o\022"
+        "\357Ac\002\335$\032B\346\001\305\240#B\343\001F6'Bh\002y\351\345Af\0025^\346A\343\001\006\201\355Ae\002"
+        "\372~\030B;\002d; B:\0027\011#B\344\001V\016%Bg\002y\351\345Ai\002\317\367\347A\342\001B`\356A;\002%"
+        "\006\010B\343\001;_$B\341\001o\222$B<\002R\270/Bj\002\337O\344Ah\002\317\367\347A\341\001\341z\355A<"
+        "\002\246\233\016Bk\002\272I\030B\340\001Ha$B\342\001\270\036%Bk\002\376\324\271Ai\002\337O\344Al\002"
+        "ff\351A\340\001\262\235\355Am\002\024.\033B\341\001L7%B\336\001\366(&Bj\002\376\324\271A=\002}\077\305"
+        "Am\002\347\373\332A<\002Z\344\017Bl\002%\206\020Bi\002\272I\030B>\002\000\000\077Bm\002b\020\321A\336"
+        "\001sh\350Aj\002ff\351An\002\264\310\365Ak\002%\206\020B\340\001\264H&BP\000F6OBn\002\006\201\316Al\002"
+        "b\020\321Ak\002\347\373\332A>\002\027\331\336A=\002\215\027\031Bj\002\024.\033Bo\002\376\324\035Bm\002"
+        "\006\201\316AP\000R\270\353Ao\002\376\324\353Al\002\264\310\365A>\002w>\016BN\000\274t#B\336\001)\134"
+        "OB>\002m\347\266A\077\002\234\304\340AN\000\037\205\353An\002\376\324\353Am\002\376\324\035BM\000\347"
+        "\373!BP\000\347{(Bq\002J\014\312As\002X9\315Ar\002\256G\315Au\002`\345\321At\002q=\326Aw\002\006\001"
+        "UB{\002\004VVBp\002J\014\312Aw\002\317\367\337Au\002}\077\363Ar\002\303\365\365Ax\002\246\233\023Bv\002"
+        "\246\233\023Bs\002\024\256BBp\002\256G\315Ay\002\240\032\341As\002\305 \360Aq\002\303\365\365Az\002\262"
+        "\035\017Bx\002\205\353\026Bt\002\364}FBp\002X9\315A{\002\232\231\337Ar\002\305 \360At\002\010\254\362"
+        "A|\002\351\246\022Bz\002\002\253\023Bq\002\024\256BBp\002q=\326A}\002\033/\341As\002\010\254\362Au\002"
+        "\313\241\366A|\002\374)\020B~\002\362R\022Bq\002\366\250EBp\002`\345\321A\177\002\242E\346Aq\002}\077"
+        "\363At\002\313\241\366Av\002D\213\020B~\002\351\246\022Bs\002\254\034DB\201\002D\213\357A\177\002\004"
+        "\326\002Bw\002\311\366\004B\200\002\372\376\017Bu\002D\213\020Bq\002\246\233\023B\202\002\201\225,Bq"
+        "\002\317\367\337A\202\002^\272\370Av\002\311\366\004Bx\002\274\364\005B\203\002\356\374\007B\201\002"
+        ")\3349B\204\002\356|KB\204\002)\134\346Aw\002\274\364\005By\002\240\032\012Bq\002\246\233\023Br\002\205"
+        "\353\026B\203\002\006\001\034B\205\002\010,\034Br\002\240\032\341A\206\002\266\363\360Az\002\260r\003"
+        "B\205\002\323M\005Bx\002\240\032\012B\207\002\305 8B\204\002\337\317OB\207\002\002+\352Ay\002\260r\003"
+        "B{\002\327\243\003B\210\002f\346\015Br\002\262\035\017Bs\002\002\253\023B\206\002\335$(Bs\002\232\231"
+        "\337A\211\002\270\036\364Az\002\327\243\003B|\002\351&\011B\210\002R\270\016B\212\002\356\374.Br\002"
+        "%\206KB\212\0029\264\365A\213\002\020\330\003B{\002\351&\011B}\002\376T\011Bt\002\374)\020Bs\002\351"
+        "\246\022B\211\002w\276=Bt\002\033/\341A\214\002)\134\346A~\002`\345\001B|\002\376T\011B\215\002yi\027"
+        "B\213\002\262\035\036Bu\002\262\035PB\216\002\362\322\367A}\002`\345\001B\215\002\022\203\005B\177\002"
+        "=\212\010Bt\002\362R\022Bu\002\351\246\022B\217\002\315L<Bu\002\242E\346A\217\002\022\203\352Av\002\004"
+        "\326\002B~\002=\212\010B\200\002F\266\015B\216\002j\274+Bq\002\205\353RB\221\002\372~\377A\220\002F\266"
+        "\377A\217\002\035Z\000B\201\002\345\320\002B\177\002F\266\015Bv\002\372\376\017B\245\002\033\257GB\222"
+        "\002\035Z\353Av\002D\213\357A\202\002;\337\001B\200\002\345\320\002B\221\002\311\366\025B\223\002\272"
+        "\311'Bw\002)\3349B\223\002\264\310\356Aw\002^\272\370A\203\002\004V\377A\201\002;\337\001B\224\0029\264"
+        "\015Bv\002\201\225,B\222\002\242E2B\225\00233\366A\202\002\004V\377A\204\002#[\000B\224\002\370\323\005"
+        "Bw\002\356\374\007Bx\002\006\001\034B\226\002\256\307<B\226\002\014\002\341Ax\002)\134\346A\203\002#"
+        "[\000B\205\002ff\005B\225\002\213l\032B\227\002w\276\042Bw\002\356|KB\227\002\303\365\365A\206\002\012"
+        "W\002By\002\323M\005B\204\002ff\005B\230\002\303\365\007Bx\002\010,\034B\226\002\205\353<B\231\0029\264"
+        "\360Ay\002\266\363\360A\207\002'1\001B\205\002\012W\002B\230\002\022\203\016Bz\002\335$(B\232\002\274"
+        "t3B\232\002\331\316\345Az\002\002+\352A\210\002\370S\377A\206\002'1\001B\233\002\250\306\025B\231\002"
+        "\234D(By\002\305 8B\233\002\254\034\377A\207\002\370S\377A\234\002\376\324\001B\211\002\205k\002Bz\002"
+        "f\346\015B{\002R\270\016B\232\002\230nEB\235\002\274t\344A{\002\270\036\364A\210\002\205k\002B\212\002"
+        "D\213\005B\234\002\370\323\022B\236\002\240\032)B|\002w\276=B\236\002\226C\352A|\0029\264\365A\213\002"
+        "{\224\001B\211\002D\213\005B\237\0021\210\015B{\002\356\374.B\235\002\250F4B\240\002\236\357\363A\212"
+        "\002{\224\001B\214\002\317\367\001B|\002\020\330\003B\237\002\223\030\007B}\002\262\035\036B\241\002"
+        "\272\311;B}\002)\134\346A\241\0025^\346A\215\002sh\372A\213\002\317\367\001B\242\002\037\205\034B\240"
+        "\002\313\241\036B~\002\252\361HB\242\002\246\233\360A\214\002sh\372A\216\002\307K\005B~\002\022\203\005"
+        "B\243\002D\213\005B}\002yi\027B\241\002\254\034;B\244\002X9\355A~\002\362\322\367A\217\002sh\003B\215"
+        "\002\307K\005B\243\002\264\310\015B\177\002j\274+B\245\002\362R2B\245\002\0775\346A\177\002\022\203\352"
+        "A\200\002\035Z\000B\216\002sh\003B\220\002\345\320\023B\244\002\364\375)B~\002\315L<B\246\002\236\357"
+        "\274A\245\0027\211\373A\200\002F\266\377A\221\002\337\317\002B\217\002\345\320\023B\325\0027\011%B\327"
+        "\002yi4B\200\002\372~\377A\220\002\337\317\002B\222\002f\346\002B\247\002\242E\020B\201\002\311\366\025"
+        "B\250\002\242E\034B\246\002{\224'B\201\002\035Z\353A\223\002\240\032\365A\221\002f\346\002B\250\002\016"
+        "-\017B\251\002\366\250\022B\202\002\242E2B\252\002\343\2459B\252\002+\207\301A\202\002\264\310\356A\222"
+        "\002\240\032\365A\224\002\305 \374A\201\002\272\311'B\253\002\002\2530B\251\002\012\3271B\257\002\351"
+        "&\334A\223\002\305 \374A\225\002Nb\004B\203\002\370\323\005B\202\0029\264\015B\254\002%\006\016B\252"
+        "\00294\020B\203\00233\366A\226\002D\213\367A\257\002\250\306\372A\224\002Nb\004B\261\002o\222\025B\204"
+        "\002\213l\032B\260\002sh4B\204\002\014\002\341A\225\002D\213\367A\227\002\272I\001B\262\002\303u\004"
+        "B\261\002`\345-B\263\002'10B\203\002\256\307<B\265\002\354Q\364A\205\002\303\365\365A\226\002\272I\001"
+        "B\230\002\226\303\001B\263\002\254\234\024B\204\002w\276\042B\264\002\262\0355B\265\002\347\373\332A"
+        "\231\002\006\201\374A\227\002\226\303\001B\205\002\303\365\007B\267\002\325x\016B\206\002\022\203\016"
+        "B\271\002\226C\022B\271\002\020X\302A\206\0029\264\360A\230\002\006\201\374A\232\002\020X\376A\207\002"
+        "\234D(B\272\002\232\031/B\273\002\343%/B\207\002\331\316\345A\233\002\177j\373A\231\002\020X\376A\274"
+        "\002!\260\017B\273\002\376T\025B\206\002\274t3B\271\002\345\320>B\232\002\177j\373A\210\002\254\034\377"
+        "A\234\0025^\001B\275\002}\077\016B\207\002\250\306\025B\274\002\325\370\034B\277\002\221\355'B\277\002"
+        "\213l\276A\235\002D\213\375A\233\0025^\001B\210\002\376\324\001B\211\002\370\323\022B\301\002\376T%B"
+        "\276\002`\3453B\303\002\256G\303A\211\002\274t\344A\234\002D\213\375A\236\002P\215\000B\301\002\372~"
+        "\030B\277\002Nb,B\212\002\250F4B\212\002\226C\352A\237\002F\266\374A\235\002P\215\000B\305\002-\262\020"
+        "B\303\002\077\265\023B\211\002\240\032)B\306\002\343%/B\236\002F\266\374A\240\002q\275\000B\306\002\254"
+        "\034\006B\213\002\223\030\007B\212\0021\210\015B\307\002\002+\035B\305\002\240\232@B\311\002ff\326A\213"
+        "\002\236\357\363A\241\002\024\256\370A\237\002q\275\000B\214\002\313\241\036B\307\002;_#B\310\002!01"
+        "B\214\0025^\346A\240\002\024\256\370A\311\002\354Q\371A\242\002\347\373\375A\315\002\232\031\000B\313"
+        "\002\236\357\015B\215\002\254\034;B\315\002\301\312\327A\215\002\246\233\360A\243\002\215\227\374A\241"
+        "\002\347\373\375A\214\002\037\205\034B\317\0027\011#B\316\002\037\0051B\242\002\215\227\374A\244\002"
+        "\341\372\001B\215\002D\213\005B\320\002%\006\010B\216\002\264\310\015B\317\002d; B\321\002\134\017CB"
+        "\216\002X9\355A\245\002\207\026\376A\243\002\341\372\001B\321\002\246\233\016B\323\002Z\344\017B\217"
+        "\002\364\375)B\320\002R\270/B\323\002}\077\305A\217\002\0775\346A\220\0027\211\373A\244\002\207\026\376"
+        "A\325\002\215\027\031B\246\002\031\204,B\216\002\362R2B\327\002m\347\266A\220\002\236\357\274A\325\002"
+        "\027\331\336A\326\002w>\016B\247\002\002\253\027B\221\002{\224'B\245\002\031\204,B\327\002\234\304\340"
+        "A\250\002X9\351A%\003\213l\352A\221\002\242E\020B\246\002\002\253\027B$\003\376\324\042B&\003\270\236"
+        "%B\251\002\270\036\342A\247\002X9\351A$\003u\223\355A\222\002\016-\017B\221\002\242E\034B#\003\177j#"
+        "B%\003J\214'B\250\002\270\036\342A\253\002y\351\347A#\003\301\312\352A\222\002\366\250\022B\252\002\027"
+        "\331\032B\042\003\311\366\042B$\003;\337$B\253\002#\333\274A\223\002+\207\301A\254\002\327\243\333A\255"
+        "\002\335$\016B\224\00294\020B\251\002\027\331\032B\222\002\343\2459B\252\002#\333\274A\255\002\000\000"
+        "\344A\251\002y\351\347A\042\003\006\201\352A\254\002\364\375\033B \003\341\372 B#\003%\006&B\255\002"
+        "\201\225\316A\256\002V\016\320A\257\002\230n\332A\252\002\327\243\333A\224\002%\006\016B\253\002\364"
+        "\375\033B\260\002\317\367\034B\254\002\201\225\316A\253\002\000\000\344A \003sh\354A\256\00233\367A\252"
+        "\002\335$\016B\042\003\376\324%B\036\003B\340OB\254\002V\016\320A\260\002y\351\354A\265\004\262\235\363"
+        "A\255\00233\367A\257\002\035\332\017B\263\004o\222$B\252\002\347{QB\260\002d;\273A\254\002\230n\332A"
+        "\224\002\351&\334A\225\002\250\306\372A\256\002\035\332\017B\261\002-\262\033B\252\002\321\042<B\257"
+        "\002d;\273A\261\002\010\254\344A\256\002y\351\354A\263\004L7\364A\254\002\317\367\034B\261\004Zd#B\265"
+        "\004\203@,B\262\002P\215\340A\260\002\010\254\344A\261\004\205\353\361A\225\002o\222\025B\257\002-\262"
+        "\033B\260\004R8#B\263\004\020X+B\261\002P\215\340A\263\002R\270\346A\260\004\351&\367A\226\002\303u\004"
+        "B\257\004)\134%B\261\004q=)B\225\002y\351@B\262\002R\270\346A\264\002\264\310\350A\257\004\354Q\363A"
+        "\227\002\254\234\024B\265\002\347{\031B\337\004\035\332#B\260\004\305 ,B\265\002w\276\273A\266\0027\211"
+        "\340A\263\002\264\310\350A\337\004\000\000\365A\267\002\236o\027B\336\004\313!%B\257\004\335\244*B\264"
+        "\002w\276\273A\267\002\303\365\327A\230\002\347\373\332A\227\002\354Q\364A\266\002\004V\016B\263\002"
+        "\347{\031B\271\002\256\307=B\267\002H\341\311A\264\0027\211\340A\336\004\256G\365A\270\002\022\203\372"
+        "A\265\002\004V\016B\337\004D\013+BM\004B\340OB\266\002H\341\311A\270\002\010\254\317A\265\002\303\365"
+        "\327A\271\002q=\342A\230\002\325x\016B\264\002\236o\027B\272\002Zd\035B\267\002\010\254\317A\272\002"
+        "ff\341AM\004sh\354A\266\002\022\203\372A\271\002`e\014BK\004\341\372 B\265\002\341\372PB\272\002/\335"
+        "\266A\231\002\020X\302A\267\002q=\342A\270\002`e\014B\230\002\226C\022B\273\002;\337\026B\265\002\256"
+        "\307=B\271\002/\335\266A\270\002ff\341A\273\002\354Q\345AK\004\006\201\352A\267\002Zd\035BI\004\311\366"
+        "\042BM\004\376\324%B\272\002\354Q\345A\274\002\266\363\345AI\004\301\312\352A\232\002\376T\025B\271\002"
+        ";\337\026BH\004\177j#BK\004%\006&B\275\002\354Q\345A\273\002\266\363\345AH\004u\223\355A\232\002!\260"
+        "\017B\233\002\325\370\034BG\004\376\324\042BI\004;\337$B\274\002\354Q\345A\276\002y\351\347AG\004\213"
+        "l\352A\233\002}\077\016B\277\002\264\310\027Bw\004\014\002\042BH\004J\214'B\277\002\016-\264A\275\002"
+        "y\351\347A\300\002y\351\347Aw\004\201\225\353A\301\002\364\375\032Bv\004\341z#BG\004\270\236%B\276\002"
+        "\016-\264A\234\002\213l\276A\301\002\201\225\334A\300\002R\270\015B\275\002\264\310\027B\233\002\221"
+        "\355'B\235\002Nb,B\301\002#\333\315A\276\002y\351\347Av\004\315\314\353A\302\002\215\227\365A\277\002"
+        "R\270\015Bw\004\022\203(B\360\001\232\231GB\302\002R\270\315A\300\002#\333\315A\303\002o\022\330A\277"
+        "\002\201\225\334A\235\002\372~\030B\276\002\364\375\032B\304\002\024.\033B\301\002R\270\315A\360\001"
+        "\264\310\333A\304\002-\262\344A\300\002\215\227\365A\303\002R\270\014B\356\001q\275\035B\362\001b\220"
+        "KB\304\002D\213\272A\235\002\256G\303A\301\002o\022\330A\302\002R\270\014B\236\002\077\265\023B\305\002"
+        "\000\200\032B\277\002\177\352<B\303\002D\213\272A\356\001\374\251\334A\302\002-\262\344A\305\002\033"
+        "/\345A\301\002\024.\033B\355\001R8\037B\360\001Z\344 B\355\001%\006\335A\304\002\033/\345A\306\002\213"
+        "l\345A\236\002-\262\020B\303\002\000\200\032B\354\001\014\002\037B\356\001+\007 B\354\001\347\373\333"
+        "A\307\002\351&\340A\305\002\213l\345A\237\002\254\034\006B\355\001\366(\037B\353\001\205k\037B\236\002"
+        "\343%/B\353\001m\347\334A\306\002\351&\340A\310\002\370S\355A\311\002o\222\034B\354\001\037\005\035B"
+        "\237\002\002+\035B\352\001\014\002!B\311\002\215\227\274A\352\001\356|\333A\312\0025^\346A\307\002\370"
+        "S\355A\313\002\335$\032B\350\001\262\235\034B\353\001\272\311\037B\310\002\215\227\274A\240\002ff\326"
+        "A\313\002)\134\332A\241\002\354Q\371A\312\002m\347\016B\307\002o\222\034B\315\002\311v;B\313\002T\343"
+        "\311A\350\001\037\205\335A\310\0025^\346A\314\002\321\042\365A\311\002m\347\016B\352\001\274t B\346\001"
+        "\347{JB\312\002T\343\311A\314\002\246\233\315A\311\002)\134\332A\315\002\331\316\334A\241\002\236\357"
+        "\015B\310\002\335$\032B\316\002\335$\032B\313\002\246\233\315A\316\0025^\341Ab\002sh\344A\312\002\321"
+        "\042\365A\315\002\374\251\015B`\002L\267%Bd\002\345\320IB\316\0025^\270A\242\002\301\312\327A\313\002"
+        "\331\316\334A\241\002\232\031\000B\314\002\374\251\015B\317\002\372~\030B\311\002\311v;B\315\0025^\270"
+        "A\314\0025^\341A`\002!\260\344A\317\0025^\346A\313\002\335$\032Bb\002T\343\034B_\002\027\331*B_\002\323"
+        "M\344A\320\002y\351\345A\316\0025^\346A\315\002\372~\030B`\002d\273\033B\243\002d; B\242\0027\011#B^"
+        "\002w\276\344A\317\002y\351\345A\321\002\317\367\347A\243\002%\006\010B_\002\217\302\031B]\002\217B("
+        "B\244\002R\270/B\322\002\337O\344A]\002\217\302\345A\320\002\317\367\347A\244\002\246\233\016B\323\002"
+        "\272I\030B^\002\242\305\034B\134\002P\215'B\323\002\376\324\271A\134\002\0775\344A\321\002\337O\344A"
+        "\324\002ff\351A\325\002\024.\033B]\002f\346\033BZ\002\274\364&B\322\002\376\324\271A\245\002}\077\305"
+        "A\325\002\347\373\332A\244\002Z\344\017B\324\002%\206\020B\321\002\272I\030B\246\002\000\000\077B\325"
+        "\002b\020\321AZ\002\205\353\337A\322\002ff\351A\326\002\264\310\365A\323\002%\206\020B\134\002\215\027"
+        "\034BX\002/]MB\326\002\006\201\316A\324\002b\020\321A\323\002\347\373\332A\246\002\027\331\336A\245\002"
+        "\215\027\031B\322\002\024.\033B\327\002\376\324\035B\325\002\006\201\316A(\003\315\314\353A\327\002\376"
+        "\324\353A\324\002\264\310\365A\246\002w>\016B&\003\341z#BZ\002\254\234IB\246\002m\347\266A\247\002\234"
+        "\304\340A&\003\201\225\353A\326\002\376\324\353A\325\002\376\324\035B%\003\014\002\042B(\003\022\203"
+        "(B\331\002J\014\312A\333\002X9\315A\332\002\256G\315A\335\002`\345\321A\334\002q=\326A\337\002\006\001"
+        "UB\343\002\004VVB\330\002J\014\312A\337\002\317\367\337A\335\002}\077\363A\332\002\303\365\365A\340\002"
+        "\246\233\023B\336\002\246\233\023B\333\002\024\256BB\330\002\256G\315A\341\002\240\032\341A\333\002\305"
+        " \360A\331\002\303\365\365A\342\002\262\035\017B\340\002\205\353\026B\334\002\364}FB\330\002X9\315A\343"
+        "\002\232\231\337A\332\002\305 \360A\334\002\010\254\362A\344\002\351\246\022B\342\002\002\253\023B\331"
+        "\002\024\256BB\330\002q=\326A\345\002\033/\341A\333\002\010\254\362A\335\002\313\241\366A\344\002\374"
+        ")\020B\346\002\362R\022B\331\002\366\250EB\330\002`\345\321A\347\002\242E\346A\331\002}\077\363A\334"
+        "\002\313\241\366A\336\002D\213\020B\346\002\351\246\022B\333\002\254\034DB\351\002D\213\357A\347\002"
+        "\004\326\002B\337\002\311\366\004B\350\002\372\376\017B\335\002D\213\020B\331\002\246\233\023B\352\002"
+        "\201\225,B\331\002\317\367\337A\352\002^\272\370A\336\002\311\366\004B\340\002\274\364\005B\353\002\356"
+        "\374\007B\351\002)\3349B\354\002\356|KB\354\002)\134\346A\337\002\274\364\005B\341\002\240\032\012B\331"
+        "\002\246\233\023B\332\002\205\353\026B\353\002\006\001\034B\355\002\010,\034B\332\002\240\032\341A\356"
+        "\002\266\363\360A\342\002\260r\003B\355\002\323M\005B\340\002\240\032\012B\357\002\305 8B\354\002\337"
+        "\317OB\357\002\002+\352A\341\002\260r\003B\343\002\327\243\003B\360\002f\346\015B\332\002\262\035\017"
+        "B\333\002\002\253\023B\356\002\335$(B\333\002\232\231\337A\361\002\270\036\364A\342\002\327\243\003B"
+        "\344\002\351&\011B\360\002R\270\016B\362\002\356\374.B\332\002%\206KB\362\0029\264\365A\363\002\020\330"
+        "\003B\343\002\351&\011B\345\002\376T\011B\334\002\374)\020B\333\002\351\246\022B\361\002w\276=B\334\002"
+        "\033/\341A\364\002)\134\346A\346\002`\345\001B\344\002\376T\011B\365\002yi\027B\363\002\262\035\036B"
+        "\335\002\262\035PB\366\002\362\322\367A\345\002`\345\001B\365\002\022\203\005B\347\002=\212\010B\334"
+        "\002\362R\022B\335\002\351\246\022B\367\002\315L<B\335\002\242E\346A\367\002\022\203\352A\336\002\004"
+        "\326\002B\346\002=\212\010B\350\002F\266\015B\366\002j\274+B\331\002\205\353RB\371\002\372~\377A\370"
+        "\002F\266\377A\367\002\035Z\000B\351\002\345\320\002B\347\002F\266\015B\336\002\372\376\017B\015\003"
+        "\033\257GB\372\002\035Z\353A\336\002D\213\357A\352\002;\337\001B\350\002\345\320\002B\371\002\311\366"
+        "\025B\373\002\272\311'B\337\002)\3349B\373\002\264\310\356A\337\002^\272\370A\353\002\004V\377A\351\002"
+        ";\337\001B\374\0029\264\015B\336\002\201\225,B\372\002\242E2B\375\00233\366A\352\002\004V\377A\354\002"
+        "#[\000B\374\002\370\323\005B\337\002\356\374\007B\340\002\006\001\034B\376\002\256\307<B\376\002\014"
+        "\002\341A\340\002)\134\346A\353\002#[\000B\355\002ff\005B\375\002\213l\032B\377\002w\276\042B\337\002"
+        "\356|KB\377\002\303\365\365A\356\002\012W\002B\341\002\323M\005B\354\002ff\005B\000\003\303\365\007B"
+        "\340\002\010,\034B\376\002\205\353<B\001\0039\264\360A\341\002\266\363\360A\357\002'1\001B\355\002\012"
+        "W\002B\000\003\022\203\016B\342\002\335$(B\002\003\274t3B\002\003\331\316\345A\342\002\002+\352A\360"
+        "\002\370S\377A\356\002'1\001B\003\003\250\306\025B\001\003\234D(B\341\002\305 8B\003\003\254\034\377"
+        "A\357\002\370S\377A\004\003\376\324\001B\361\002\205k\002B\342\002f\346\015B\343\002R\270\016B\002\003"
+        "\230nEB\005\003\274t\344A\343\002\270\036\364A\360\002\205k\002B\362\002D\213\005B\004\003\370\323\022"
+        "B\006\003\240\032)B\344\002w\276=B\006\003\226C\352A\344\0029\264\365A\363\002{\224\001B\361\002D\213"
+        "\005B\007\0031\210\015B\343\002\356\374.B\005\003\250F4B\010\003\236\357\363A\362\002{\224\001B\364\002"
+        "\317\367\001B\344\002\020\330\003B\007\003\223\030\007B\345\002\262\035\036B\011\003\272\311;B\345\002"
+        ")\134\346A\011\0035^\346A\365\002sh\372A\363\002\317\367\001B\012\003\037\205\034B\010\003\313\241\036"
+        "B\346\002\252\361HB\012\003\246\233\360A\364\002sh\372A\366\002\307K\005B\346\002\022\203\005B\013\003"
+        "D\213\005B\345\002yi\027B\011\003\254\034;B\014\003X9\355A\346\002\362\322\367A\367\002sh\003B\365\002"
+        "\307K\005B\013\003\264\310\015B\347\002j\274+B\015\003\362R2B\015\003\0775\346A\347\002\022\203\352A"
+        "\350\002\035Z\000B\366\002sh\003B\370\002\345\320\023B\014\003\364\375)B\346\002\315L<B\016\003\236\357"
+        "\274A\015\0037\211\373A\350\002F\266\377A\371\002\337\317\002B\367\002\345\320\023B=\0037\011%B\077\003"
+        "yi4B\350\002\372~\377A\370\002\337\317\002B\372\002f\346\002B\017\003\242E\020B\351\002\311\366\025B"
+        "\020\003\242E\034B\016\003{\224'B\351\002\035Z\353A\373\002\240\032\365A\371\002f\346\002B\020\003\016"
+        "-\017B\021\003\366\250\022B\352\002\242E2B\022\003\343\2459B\022\003+\207\301A\352\002\264\310\356A\372"
+        "\002\240\032\365A\374\002\305 \374A\351\002\272\311'B\023\003\002\2530B\021\003\012\3271B\027\003\351"
+        "&\334A\373\002\305 \374A\375\002Nb\004B\353\002\370\323\005B\352\0029\264\015B\024\003%\006\016B\022"
+        "\00394\020B\353\00233\366A\376\002D\213\367A\027\003\250\306\372A\374\002Nb\004B\031\003o\222\025B\354"
+        "\002\213l\032B\030\003sh4B\354\002\014\002\341A\375\002D\213\367A\377\002\272I\001B\032\003\303u\004"
+        "B\031\003`\345-B\033\003'10B\353\002\256\307<B\035\003\354Q\364A\355\002\303\365\365A\376\002\272I\001"
+        "B\000\003\226\303\001B\033\003\254\234\024B\354\002w\276\042B\034\003\262\0355B\035\003\347\373\332A"
+        "\001\003\006\201\374A\377\002\226\303\001B\355\002\303\365\007B\037\003\325x\016B\356\002\022\203\016"
+        "B!\003\226C\022B!\003\020X\302A\356\0029\264\360A\000\003\006\201\374A\002\003\020X\376A\357\002\234"
+        "D(B\042\003\232\031/B#\003\343%/B\357\002\331\316\345A\003\003\177j\373A\001\003\020X\376A$\003!\260"
+        "\017B#\003\376T\025B\356\002\274t3B!\003\345\320>B\002\003\177j\373A\360\002\254\034\377A\004\0035^\001"
+        "B%\003}\077\016B\357\002\250\306\025B$\003\325\370\034B'\003\221\355'B'\003\213l\276A\005\003D\213\375"
+        "A\003\0035^\001B\360\002\376\324\001B\361\002\370\323\022B)\003\376T%B&\003`\3453B+\003\256G\303A\361"
+        "\002\274t\344A\004\003D\213\375A\006\003P\215\000B)\003\372~\030B'\003Nb,B\362\002\250F4B\362\002\226"
+        "C\352A\007\003F\266\374A\005\003P\215\000B-\003-\262\020B+\003\077\265\023B\361\002\240\032)B.\003\343"
+        "%/B\006\003F\266\374A\010\003q\275\000B.\003\254\034\006B\363\002\223\030\007B\362\0021\210\015B/\003"
+        "\002+\035B-\003\240\232@B1\003ff\326A\363\002\236\357\363A\011\003\024\256\370A\007\003q\275\000B\364"
+        "\002\313\241\036B/\003;_#B0\003!01B\364\0025^\346A\010\003\024\256\370A1\003\354Q\371A\012\003\347\373"
+        "\375A5\003\232\031\000B3\003\236\357\015B\365\002\254\034;B5\003\301\312\327A\365\002\246\233\360A\013"
+        "\003\215\227\374A\011\003\347\373\375A\364\002\037\205\034B7\0037\011#B6\003\037\0051B\012\003\215\227"
+        "\374A\014\003\341\372\001B\365\002D\213\005B8\003%\006\010B\366\002\264\310\015B7\003d; B9\003\134\017"
+        "CB\366\002X9\355A\015\003\207\026\376A\013\003\341\372\001B9\003\246\233\016B;\003Z\344\017B\367\002"
+        "\364\375)B8\003R\270/B;\003}\077\305A\367\002\0775\346A\370\0027\211\373A\014\003\207\026\376A=\003\215"
+        "\027\031B\016\003\031\204,B\366\002\362R2B\077\003m\347\266A\370\002\236\357\274A=\003\027\331\336A>"
+        "\003w>\016B\017\003\002\253\027B\371\002{\224'B\015\003\031\204,B\077\003\234\304\340A\020\003X9\351"
+        "A\215\003\213l\352A\371\002\242E\020B\016\003\002\253\027B\214\003\376\324\042B\216\003\270\236%B\021"
+        "\003\270\036\342A\017\003X9\351A\214\003u\223\355A\372\002\016-\017B\371\002\242E\034B\213\003\177j#"
+        "B\215\003J\214'B\020\003\270\036\342A\023\003y\351\347A\213\003\301\312\352A\372\002\366\250\022B\022"
+        "\003\027\331\032B\212\003\311\366\042B\214\003;\337$B\023\003#\333\274A\373\002+\207\301A\024\003\327"
+        "\243\333A\025\003\335$\016B\374\00294\020B\021\003\027\331\032B\372\002\343\2459B\022\003#\333\274A\025"
+        "\003\000\000\344A\021\003y\351\347A\212\003\006\201\352A\024\003\364\375\033B\210\003\341\372 B\213\003"
+        "%\006&B\025\003\201\225\316A\026\003V\016\320A\027\003\230n\332A\022\003\327\243\333A\374\002%\006\016"
+        "B\023\003\364\375\033B\030\003\317\367\034B\024\003\201\225\316A\023\003\000\000\344A\210\003sh\354A"
+        "\026\00333\367A\022\003\335$\016B\212\003\376\324%B\276\004b\220OB\024\003V\016\320A\030\003y\351\354"
+        "A\276\004!\260\356A\025\00333\367A\027\003\035\332\017B\274\004\004\326\036B\022\003\347{QB\030\003d"
+        ";\273A\024\003\230n\332A\374\002\351&\334A\375\002\250\306\372A\026\003\035\332\017B\031\003-\262\033"
+        "B\022\003\321\042<B\027\003d;\273A\031\003\010\254\344A\026\003y\351\354A\274\004\372~\361A\024\003\317"
+        "\367\034B\273\004\335$\036B\276\004\211\301-B\032\003P\215\340A\030\003\010\254\344A\273\004\370S\357"
+        "A\375\002o\222\025B\027\003-\262\033B\272\004\360'\036B\376\002`\345-B\031\003P\215\340A\033\003R\270"
+        "\346A\272\004h\221\360A\376\002\303u\004B\271\004\360'\036B\273\004\242E,B\375\002y\351@B\032\003R\270"
+        "\346A\034\003\264\310\350A\271\004\370S\357A\377\002\254\234\024B\035\003\347{\031B\270\004\335$\036"
+        "B\272\004\242E,B\035\003w\276\273A\036\0037\211\340A\033\003\264\310\350A\270\004\372~\361A\037\003\236"
+        "o\027B\266\004\004\326\036B\271\004\351\246.B\034\003w\276\273A\037\003\303\365\327A\000\003\347\373"
+        "\332A\377\002\354Q\364A\036\003\004V\016B\033\003\347{\031B!\003\256\307=B\037\003H\341\311A\034\003"
+        "7\211\340A\266\004!\260\356A \003\022\203\372A\035\003\004V\016B\270\004\211\301-B\265\004b\220OB\036"
+        "\003H\341\311A \003\010\254\317A\035\003\303\365\327A!\003q=\342A\000\003\325x\016B\034\003\236o\027"
+        "B\042\003Zd\035B\037\003\010\254\317A\042\003ff\341A\255\002sh\354A\036\003\022\203\372A!\003`e\014B"
+        "\253\002\341\372 B\035\003\341\372PB\042\003/\335\266A\001\003\020X\302A\037\003q=\342A \003`e\014B\000"
+        "\003\226C\022B#\003;\337\026B\035\003\256\307=B!\003/\335\266A \003ff\341A#\003\354Q\345A\253\002\006"
+        "\201\352A\037\003Zd\035B\251\002\311\366\042B\255\002\376\324%B\042\003\354Q\345A$\003\266\363\345A\251"
+        "\002\301\312\352A\002\003\376T\025B!\003;\337\026B\250\002\177j#B\253\002%\006&B%\003\354Q\345A#\003"
+        "\266\363\345A\250\002u\223\355A\002\003!\260\017B\003\003\325\370\034B\247\002\376\324\042B\251\002;"
+        "\337$B$\003\354Q\345A&\003y\351\347A\247\002\213l\352A\003\003}\077\016B'\003\264\310\027B\327\002\014"
+        "\002\042B\250\002J\214'B'\003\016-\264A%\003y\351\347A(\003y\351\347A\327\002\201\225\353A)\003\364\375"
+        "\032B\326\002\341z#B\247\002\270\236%B&\003\016-\264A\004\003\213l\276A)\003\201\225\334A(\003R\270\015"
+        "B%\003\264\310\027B\003\003\221\355'B\005\003Nb,B)\003#\333\315A&\003y\351\347A\326\002\315\314\353A"
+        "*\003\215\227\365A'\003R\270\015B\327\002\022\203(BX\002\232\231GB*\003R\270\315A(\003#\333\315A+\003"
+        "o\022\330A'\003\201\225\334A\005\003\372~\030B&\003\364\375\032B,\003\024.\033B)\003R\270\315AX\002\264"
+        "\310\333A,\003-\262\344A(\003\215\227\365A+\003R\270\014BV\002q\275\035BZ\002b\220KB,\003D\213\272A\005"
+        "\003\256G\303A)\003o\022\330A*\003R\270\014B\006\003\077\265\023B-\003\000\200\032B'\003\177\352<B+\003"
+        "D\213\272AV\002\374\251\334A*\003-\262\344A-\003\033/\345A)\003\024.\033BU\002R8\037BX\002Z\344 BU\002"
+        "%\006\335A,\003\033/\345A.\003\213l\345A\006\003-\262\020B+\003\000\200\032BT\002\014\002\037BV\002+"
+        "\007 BT\002\347\373\333A/\003\351&\340A-\003\213l\345A\007\003\254\034\006BU\002\366(\037BS\002\205k"
+        "\037B\006\003\343%/BS\002m\347\334A.\003\351&\340A0\003\370S\355A1\003o\222\034BT\002\037\005\035B\007"
+        "\003\002+\035BR\002\014\002!B1\003\215\227\274AR\002\356|\333A2\0035^\346A/\003\370S\355A3\003\335$\032"
+        "BP\002\262\235\034BS\002\272\311\037B0\003\215\227\274A\010\003ff\326A3\003)\134\332A\011\003\354Q\371"
+        "A2\003m\347\016B/\003o\222\034B5\003\311v;B3\003T\343\311AP\002\037\205\335A0\0035^\346A4\003\321\042"
+        "\365A1\003m\347\016BR\002\274t BN\002\347{JB2\003T\343\311A4\003\246\233\315A1\003)\134\332A5\003\331"
+        "\316\334A\011\003\236\357\015B6\003\335$\032B0\003\335$\032B3\003\246\233\315A6\0035^\341A\270\000o\022"
+        "\344A2\003\321\042\365A5\003\374\251\015B\266\000\134\217\042BP\002;\337KB6\0035^\270A\012\003\301\312"
+        "\327A3\003\331\316\334A\011\003\232\031\000B4\003\374\251\015B7\003\372~\030B1\003\311v;B5\0035^\270"
+        "A4\0035^\341A\266\000b\020\346A7\0035^\346A3\003\335$\032B\270\000h\021!B\265\000h\221%B\265\000`\345"
+        "\344A8\003y\351\345A6\0035^\346A5\003\372~\030B\266\000\215\027 B\013\003d; B\012\0037\011#B\264\000"
+        "%\006\345A7\003y\351\345A9\003\317\367\347A\013\003%\006\010B\265\000\020\330\037B\263\000%\006%B\014"
+        "\003R\270/B:\003\337O\344A\263\000\301\312\346A8\003\317\367\347A\014\003\246\233\016B;\003\272I\030"
+        "B\264\000\376\324 B\262\000\327#$B;\003\376\324\271A9\003\337O\344A\262\000\311v\344A<\003ff\351A=\003"
+        "\024.\033B\263\000\006\001 B\260\000\351\246\042B:\003\376\324\271A\015\003}\077\305A=\003\347\373\332"
+        "A\014\003Z\344\017B<\003%\206\020B9\003\272I\030B\016\003\000\000\077B=\003b\020\321A\260\000\256G\341"
+        "A:\003ff\351A>\003\264\310\365A;\003%\206\020B\262\000\244\360\037B\256\000\366(MB>\003\006\201\316A"
+        "<\003b\020\321A;\003\347\373\332A\016\003\027\331\336A\015\003\215\027\031B:\003\024.\033B\077\003\376"
+        "\324\035B=\003\006\201\316A\220\003\315\314\353A\077\003\376\324\353A<\003\264\310\365A\016\003w>\016"
+        "B\216\003\341z#B\260\000mgMB\016\003m\347\266A\017\003\234\304\340A\216\003\201\225\353A>\003\376\324"
+        "\353A=\003\376\324\035B\215\003\014\002\042B\220\003\022\203(BA\003J\014\312AC\003X9\315AB\003\256G\315"
+        "AE\003`\345\321AD\003q=\326AG\003\006\001UBK\003\004VVB@\003J\014\312AG\003\317\367\337AE\003}\077\363"
+        "AB\003\317\367\365AH\003\246\233\023BF\003\246\233\023BC\003\024\256BB@\003\256G\315AI\003\240\032\341"
+        "AC\003\305 \360AA\003\317\367\365AJ\003\262\035\017BH\003\205\353\026BD\003\364}FB@\003X9\315AK\003\232"
+        "\231\337AB\003\305 \360AD\003\010\254\362AL\003\351\246\022BJ\003\002\253\023BA\003\024\256BB@\003q="
+        "\326AM\003\033/\341AC\003\010\254\362AE\003\313\241\366AL\003\374)\020BN\003\362R\022BA\003\366\250E"
+        "B@\003`\345\321AO\003\242E\346AA\003}\077\363AD\003\313\241\366AF\003D\213\020BN\003\351\246\022BC\003"
+        "\254\034DBQ\003D\213\357AO\003\004\326\002BG\003\311\366\004BP\003\372\376\017BE\003D\213\020BA\003\246"
+        "\233\023BR\003\201\225,BA\003\317\367\337AR\003^\272\370AF\003\311\366\004BH\003\274\364\005BS\003\356"
+        "\374\007BQ\003)\3349BT\003\356|KBT\003)\134\346AG\003\274\364\005BI\003\240\032\012BA\003\246\233\023"
+        "BB\003\205\353\026BS\003\006\001\034BU\003\010,\034BB\003\240\032\341AV\003\266\363\360AJ\003\260r\003"
+        "BU\003\323M\005BH\003\240\032\012BW\003\305 8BT\003\337\317OBW\003\002+\352AI\003\260r\003BK\003\327"
+        "\243\003BX\003f\346\015BB\003\262\035\017BC\003\002\253\023BV\003\335$(BC\003\232\231\337AY\003\270\036"
+        "\364AJ\003\327\243\003BL\003\351&\011BX\003R\270\016BZ\003\356\374.BB\003%\206KBZ\0039\264\365A[\003"
+        "\020\330\003BK\003\351&\011BM\003\376T\011BD\003\374)\020BC\003\351\246\022BY\003w\276=BD\003\033/\341"
+        "A\134\003)\134\346AN\003`\345\001BL\003\376T\011B]\003yi\027B[\003\262\035\036BE\003\262\035PB^\003\362"
+        "\322\367AM\003`\345\001B]\003\022\203\005BO\003=\212\010BD\003\362R\022BE\003\351\246\022B_\003\315L"
+        "<BE\003\242E\346A_\003\022\203\352AF\003\004\326\002BN\003=\212\010BP\003F\266\015B^\003j\274+BA\003"
+        "\205\353RBa\003\372~\377A`\003F\266\377A_\003\035Z\000BQ\003\345\320\002BO\003F\266\015BF\003\372\376"
+        "\017Bu\003\033\257GBb\003\035Z\353AF\003D\213\357AR\003;\337\001BP\003\345\320\002Ba\003\311\366\025"
+        "Bc\003\272\311'BG\003)\3349Bc\003\264\310\356AG\003^\272\370AS\003\004V\377AQ\003;\337\001Bd\0039\264"
+        "\015BF\003\201\225,Bb\003\242E2Be\00333\366AR\003\004V\377AT\003#[\000Bd\003\370\323\005BG\003\356\374"
+        "\007BH\003\006\001\034Bf\003\256\307<Bf\003\014\002\341AH\003)\134\346AS\003#[\000BU\003ff\005Be\003"
+        "\213l\032Bg\003w\276\042BG\003\356|KBg\003\303\365\365AV\003\012W\002BI\003\323M\005BT\003ff\005Bh\003"
+        "\303\365\007BH\003\010,\034Bf\003\205\353<Bi\0039\264\360AI\003\266\363\360AW\003'1\001BU\003\012W\002"
+        "Bh\003\022\203\016BJ\003\335$(Bj\003\274t3Bj\003\331\316\345AJ\003\002+\352AX\003\370S\377AV\003'1\001"
+        "Bk\003\250\306\025Bi\003\234D(BI\003\305 8Bk\003\254\034\377AW\003\370S\377Al\003\376\324\001BY\003\205"
+        "k\002BJ\003f\346\015BK\003R\270\016Bj\003\230nEBm\003\274t\344AK\003\270\036\364AX\003\205k\002BZ\003"
+        "D\213\005Bl\003\370\323\022Bn\003\240\032)BL\003w\276=Bn\003\226C\352AL\0039\264\365A[\003{\224\001B"
+        "Y\003D\213\005Bo\0031\210\015BK\003\356\374.Bm\003\250F4Bp\003\236\357\363AZ\003{\224\001B\134\003\317"
+        "\367\001BL\003\020\330\003Bo\003\223\030\007BM\003\262\035\036Bq\003\272\311;BM\003)\134\346Aq\0035^"
+        "\346A]\003sh\372A[\003\317\367\001Br\003\037\205\034Bp\003\313\241\036BN\003\252\361HBr\003\246\233\360"
+        "A\134\003sh\372A^\003\307K\005BN\003\022\203\005Bs\003D\213\005BM\003yi\027Bq\003\254\034;Bt\003X9\355"
+        "AN\003\362\322\367A_\003sh\003B]\003\307K\005Bs\003\264\310\015BO\003j\274+Bu\003\362R2Bu\003\0775\346"
+        "AO\003\022\203\352AP\003\035Z\000B^\003sh\003B`\003\345\320\023Bt\003\364\375)BN\003\315L<Bv\003\236"
+        "\357\274Au\0037\211\373AP\003F\266\377Aa\003\331\316\002B_\003\345\320\023B\245\0037\011%B\247\003yi"
+        "4BP\003\372~\377A`\003\331\316\002Bb\003f\346\002Bw\003\242E\020BQ\003\311\366\025Bx\003\242E\034Bv\003"
+        "{\224'BQ\003\035Z\353Ac\003\240\032\365Aa\003f\346\002Bx\003\016-\017By\003\366\250\022BR\003\242E2B"
+        "z\003\343\2459Bz\003+\207\301AR\003\264\310\356Ab\003\240\032\365Ad\003\305 \374AQ\003\272\311'B{\003"
+        "\002\2530By\003\012\3271B\177\003\351&\334Ac\003\305 \374Ae\003Nb\004BS\003\370\323\005BR\0039\264\015"
+        "B|\003%\006\016Bz\00394\020BS\00333\366Af\003D\213\367A\177\003\250\306\372Ad\003Nb\004B\201\003o\222"
+        "\025BT\003\213l\032B\200\003sh4BT\003\014\002\341Ae\003D\213\367Ag\003\272I\001B\202\003\303u\004B\201"
+        "\003`\345-B\203\003'10BS\003\256\307<B\205\003\354Q\364AU\003\303\365\365Af\003\272I\001Bh\003\226\303"
+        "\001B\203\003\254\234\024BT\003w\276\042B\204\003\262\0355B\205\003\347\373\332Ai\003\006\201\374Ag\003"
+        "\226\303\001BU\003\303\365\007B\207\003\325x\016BV\003\022\203\016B\211\003\226C\022B\211\003\020X\302"
+        "AV\0039\264\360Ah\003\006\201\374Aj\003\020X\376AW\003\234D(B\212\003\232\031/B\213\003\343%/BW\003\331"
+        "\316\345Ak\003\177j\373Ai\003\020X\376A\214\003!\260\017B\213\003\376T\025BV\003\274t3B\211\003\345\320"
+        ">Bj\003\177j\373AX\003\254\034\377Al\0035^\001B\215\003}\077\016BW\003\250\306\025B\214\003\325\370\034"
+        "B\217\003\221\355'B\217\003\213l\276Am\003D\213\375Ak\0035^\001BX\003\376\324\001BY\003\370\323\022B"
+        "\221\003\376T%B\216\003`\3453B\223\003\256G\303AY\003\274t\344Al\003D\213\375An\003P\215\000B\221\003"
+        "\372~\030B\217\003Nb,BZ\003\250F4BZ\003\226C\352Ao\003F\266\374Am\003P\215\000B\225\003-\262\020B\223"
+        "\003\077\265\023BY\003\240\032)B\226\003\343%/Bn\003F\266\374Ap\003q\275\000B\226\003\254\034\006B[\003"
+        "\223\030\007BZ\0031\210\015B\227\003\002+\035B\225\003\240\232@B\231\003ff\326A[\003\236\357\363Aq\003"
+        "\024\256\370Ao\003q\275\000B\134\003\313\241\036B\227\003;_#B\230\003!01B\134\0035^\346Ap\003\024\256"
+        "\370A\231\003\354Q\371Ar\003\347\373\375A\235\003\232\031\000B\233\003\236\357\015B]\003\254\034;B\235"
+        "\003\301\312\327A]\003\246\233\360As\003\215\227\374Aq\003\347\373\375A\134\003\037\205\034B\237\003"
+        "7\011#B\236\003\037\0051Br\003\215\227\374At\003\341\372\001B]\003D\213\005B\240\003%\006\010B^\003\264"
+        "\310\015B\237\003d; B\241\003\134\017CB^\003X9\355Au\003\207\026\376As\003\341\372\001B\241\003\246\233"
+        "\016B\243\003Z\344\017B_\003\364\375)B\240\003R\270/B\243\003}\077\305A_\003\0775\346A`\0037\211\373"
+        "At\003\207\026\376A\245\003\215\027\031Bv\003\031\204,B^\003\362R2B\247\003m\347\266A`\003\236\357\274"
+        "A\245\003\027\331\336A\246\003w>\016Bw\003\002\253\027Ba\003{\224'Bu\003\031\204,B\247\003\234\304\340"
+        "Ax\003X9\351A\365\003\213l\352Aa\003\242E\020Bv\003\002\253\027B\364\003\376\324\042B\366\003\270\236"
+        "%By\003\270\036\342Aw\003X9\351A\364\003u\223\355Ab\003\016-\017Ba\003\242E\034B\363\003\177j#B\365\003"
+        "J\214'Bx\003\270\036\342A{\003y\351\347A\363\003\301\312\352Ab\003\366\250\022Bz\003\027\331\032B\362"
+        "\003\311\366\042B\364\003;\337$B{\003#\333\274Ac\003+\207\301A|\003\327\243\333A}\003\335$\016Bd\003"
+        "94\020By\003\027\331\032Bb\003\343\2459Bz\003#\333\274A}\003\000\000\344Ay\003y\351\347A\362\003\006"
+        "\201\352A|\003\364\375\033B\360\003\341\372 B\363\003%\006&B}\003\201\225\316A~\003V\016\320A\177\003"
+        "\230n\332Az\003\327\243\333Ad\003%\006\016B{\003\364\375\033B\200\003\317\367\034B|\003\201\225\316A"
+        "{\003\000\000\344A\360\003sh\354A~\00333\367Az\003\335$\016B\362\003\376\324%B\310\004\035ZKB|\003V\016"
+        "\320A\310\004\351&\345A\200\003y\351\354A}\00333\367A\177\003\035\332\017B\306\004o\022\035B\311\004"
+        "\333yPB\200\003d;\273A|\003\230n\332Ad\003\351&\334Ae\003\250\306\372A~\003\035\332\017B\201\003-\262"
+        "\033Bz\003\321\042<B\177\003d;\273A\201\003\010\254\344A\306\004^\272\347A~\003y\351\354A\305\004\010"
+        ",\034B|\003\317\367\034B\310\004\354Q+B\202\003P\215\340A\200\003\010\254\344A\305\004V\016\346Ae\003"
+        "o\222\025B\304\004\317w\033B\177\003-\262\033B\306\004\351\246)B\201\003P\215\340A\203\003R\270\346A"
+        "\304\004\234\304\346Af\003\303u\004B\303\004\307K\036B\305\004'\261'Be\003y\351@B\202\003R\270\346A\303"
+        "\004^\272\347A\204\003\264\310\350Ag\003\254\234\024B\205\003\347{\031B\302\004V\216\035B\304\004\266"
+        "\363'B\205\003w\276\273A\206\003D\213\340A\302\004}\077\347A\203\003\264\310\350A\207\003\236o\027B\300"
+        "\004!0\033B\303\004\307K)B\204\003w\276\273A\207\003\303\365\327Ah\003\347\373\332Ag\003\354Q\364A\206"
+        "\003\004V\016B\203\003\347{\031B\211\003\256\307=B\207\003H\341\311A\204\003D\213\340A\300\004+\207\347"
+        "A\210\003\022\203\372A\205\003\004V\016B\302\004\331N'B\276\004\002\253KB\206\003H\341\311A\210\003\010"
+        "\254\317A\205\003\303\365\327A\211\003q=\342Ah\003\325x\016B\204\003\236o\027B\212\003Zd\035B\207\003"
+        "\010\254\317A\212\003ff\341A\025\003sh\354A\206\003\022\203\372A\211\003`e\014B\023\003\341\372 B\205"
+        "\003\341\372PB\212\003/\335\266Ai\003\020X\302A\207\003q=\342A\210\003`e\014Bh\003\226C\022B\213\003"
+        ";\337\026B\205\003\256\307=B\211\003/\335\266A\210\003ff\341A\213\003\354Q\345A\023\003\006\201\352A"
+        "\207\003Zd\035B\021\003\311\366\042B\025\003\376\324%B\212\003\354Q\345A\214\003\266\363\345A\021\003"
+        "\301\312\352Aj\003\376T\025B\211\003;\337\026B\020\003\177j#B\023\003%\006&B\215\003\354Q\345A\213\003"
+        "\266\363\345A\020\003u\223\355Aj\003!\260\017Bk\003\325\370\034B\017\003\376\324\042B\021\003;\337$B"
+        "\214\003\354Q\345A\216\003y\351\347A\017\003\213l\352Ak\003}\077\016B\217\003\264\310\027B\077\003\014"
+        "\002\042B\020\003J\214'B\217\003\016-\264A\220\003y\351\347A\215\003y\351\347A\077\003\201\225\353A\221"
+        "\003\364\375\032B>\003\341z#B\017\003\270\236%B\216\003\016-\264Al\003\213l\276A\221\003\201\225\334"
+        "A\220\003R\270\015B\215\003\264\310\027Bk\003\221\355'Bm\003Nb,B\221\003#\333\315A\216\003y\351\347A"
+        ">\003\315\314\353A\222\003\215\227\365A\217\003R\270\015B\077\003\022\203(B\256\000\362\322KB\222\003"
+        "R\270\315A\220\003#\333\315A\223\003o\022\330A\217\003\201\225\334Am\003\372~\030B\216\003\364\375\032"
+        "B\224\003\024.\033B\221\003R\270\315A\224\003-\262\344A\256\000\232\231\345A\220\003\215\227\365A\223"
+        "\003R\270\014B\254\000\376T\037B\257\000ZdPB\224\003D\213\272Am\003\256G\303A\221\003o\022\330A\222\003"
+        "R\270\014Bn\003\077\265\023B\225\003\000\200\032B\217\003\177\352<B\223\003D\213\272A\222\003-\262\344"
+        "A\225\003\033/\345A\254\000q=\346A\221\003\024.\033B\253\000\266\363 B\256\000\303u#B\224\003\033/\345"
+        "A\226\003\213l\345A\253\000\321\042\346An\003-\262\020B\223\003\000\200\032B\252\000\347{!B\254\000\254"
+        "\034%B\227\003\351&\340A\225\003\213l\345A\252\000\345\320\345Ao\003\254\034\006B\251\0007\011\037B\253"
+        "\000\331\316#Bn\003\343%/B\226\003\351&\340A\251\000\252\361\343A\230\003\370S\355A\231\003o\222\034"
+        "Bo\003\002+\035B\250\000L7!B\252\000\266s!B\231\003\215\227\274A\250\000Nb\345A\232\0035^\346A\227\003"
+        "\370S\355A\233\003\335$\032B\246\000R8 B\251\000!0%B\230\003\215\227\274Ap\003ff\326A\233\003)\134\332"
+        "Aq\003\354Q\371A\232\003m\347\016B\227\003o\222\034B\235\003\311v;B\233\003T\343\311A\246\000\236\357"
+        "\344A\230\0035^\346A\234\003\321\042\365A\231\003m\347\016B\250\000\274\364&B\245\000\323MNB\232\003"
+        "T\343\311A\234\003\246\233\315A\231\003)\134\332A\235\003\331\316\334Aq\003\236\357\015B\230\003\335"
+        "$\032B\236\003\335$\032B\233\003\246\233\315A\236\0035^\341A*\001sh\344A\232\003\321\042\365A\235\003"
+        "\374\251\015B(\001L\267%B,\001\345\320IB\236\0035^\270Ar\003\301\312\327A\233\003\331\316\334Aq\003\232"
+        "\031\000B\234\003\374\251\015B\237\003\372~\030B\231\003\311v;B\235\0035^\270A\234\0035^\341A(\001!\260"
+        "\344A\237\0035^\346A\233\003\335$\032B*\001T\343\034B'\001\027\331*B'\001\323M\344A\240\003y\351\345"
+        "A\236\0035^\346A\235\003\372~\030B(\001d\273\033Bs\003d; Br\0037\011#B&\001w\276\344A\237\003y\351\345"
+        "A\241\003\317\367\347As\003%\006\010B'\001\217\302\031B%\001\217B(Bt\003R\270/B\242\003\337O\344A%\001"
+        "\217\302\345A\240\003\317\367\347At\003\246\233\016B\243\003\272I\030B&\001\242\305\034B$\001P\215'B"
+        "\243\003\376\324\271A$\001\0775\344A\241\003\337O\344A\244\003ff\351A\245\003\024.\033B%\001f\346\033"
+        "B\042\001\274\364&B\242\003\376\324\271Au\003}\077\305A\245\003\347\373\332At\003Z\344\017B\244\003%"
+        "\206\020B\241\003\272I\030Bv\003\000\000\077B\245\003b\020\321A\042\001\205\353\337A\242\003ff\351A\246"
+        "\003\264\310\365A\243\003%\206\020B$\001\215\027\034B \001/]MB\246\003\006\201\316A\244\003b\020\321"
+        "A\243\003\347\373\332Av\003\027\331\336Au\003\215\027\031B\242\003\024.\033B\247\003\376\324\035B\245"
+        "\003\006\201\316A\370\003\315\314\353A\247\003\376\324\353A\244\003\264\310\365Av\003w>\016B\366\003"
+        "\341z#B\042\001\254\234IBv\003m\347\266Aw\003\234\304\340A\366\003\201\225\353A\246\003\376\324\353A"
+        "\245\003\376\324\035B\365\003\014\002\042B\370\003\022\203(B\251\003J\014\312A\253\003X9\315A\252\003"
+        "\256G\315A\255\003`\345\321A\254\003q=\326A\257\003\006\001UB\263\003\004VVB\250\003J\014\312A\257\003"
+        "\317\367\337A\255\003}\077\363A\252\003\303\365\365A\260\003\246\233\023B\256\003\246\233\023B\253\003"
+        "\024\256BB\250\003\256G\315A\261\003\240\032\341A\253\003\305 \360A\251\003\303\365\365A\262\003\262"
+        "\035\017B\260\003\205\353\026B\254\003\364}FB\250\003X9\315A\263\003\232\231\337A\252\003\305 \360A\254"
+        "\003\010\254\362A\264\003\351\246\022B\262\003\002\253\023B\251\003\024\256BB\250\003q=\326A\265\003"
+        "\033/\341A\253\003\010\254\362A\255\003\313\241\366A\264\003\374)\020B\266\003\362R\022B\251\003\366"
+        "\250EB\250\003`\345\321A\267\003\242E\346A\251\003}\077\363A\254\003\313\241\366A\256\003D\213\020B\266"
+        "\003\351\246\022B\253\003\254\034DB\271\003D\213\357A\267\003\004\326\002B\257\003\311\366\004B\270\003"
+        "\372\376\017B\255\003D\213\020B\251\003\246\233\023B\272\003\201\225,B\251\003\317\367\337A\272\003^"
+        "\272\370A\256\003\311\366\004B\260\003\274\364\005B\273\003\356\374\007B\271\003)\3349B\274\003\356|"
+        "KB\274\003)\134\346A\257\003\274\364\005B\261\003\240\032\012B\251\003\246\233\023B\252\003\205\353\026"
+        "B\273\003\006\001\034B\275\003\010,\034B\252\003\240\032\341A\276\003\266\363\360A\262\003\260r\003B"
+        "\275\003\323M\005B\260\003\240\032\012B\277\003\305 8B\274\003\337\317OB\277\003\002+\352A\261\003\260"
+        "r\003B\263\003\327\243\003B\300\003f\346\015B\252\003\262\035\017B\253\003\002\253\023B\276\003\335$"
+        "(B\253\003\232\231\337A\301\003\270\036\364A\262\003\327\243\003B\264\003\351&\011B\300\003R\270\016"
+        "B\302\003\356\374.B\252\003%\206KB\302\0039\264\365A\303\003\020\330\003B\263\003\351&\011B\265\003\376"
+        "T\011B\254\003\374)\020B\253\003\351\246\022B\301\003w\276=B\254\003\033/\341A\304\003)\134\346A\266"
+        "\003`\345\001B\264\003\376T\011B\305\003yi\027B\303\003\262\035\036B\255\003\262\035PB\306\003\362\322"
+        "\367A\265\003`\345\001B\305\003\022\203\005B\267\003=\212\010B\254\003\362R\022B\255\003\351\246\022"
+        "B\307\003\315L<B\255\003\242E\346A\307\003\022\203\352A\256\003\004\326\002B\266\003=\212\010B\270\003"
+        "F\266\015B\306\003j\274+B\251\003\205\353RB\311\003\372~\377A\310\003F\266\377A\307\003\035Z\000B\271"
+        "\003\345\320\002B\267\003F\266\015B\256\003\372\376\017B\335\003\033\257GB\312\003\035Z\353A\256\003"
+        "D\213\357A\272\003;\337\001B\270\003\345\320\002B\311\003\311\366\025B\313\003\272\311'B\257\003)\334"
+        "9B\313\003\264\310\356A\257\003^\272\370A\273\003\004V\377A\271\003;\337\001B\314\0039\264\015B\256\003"
+        "\201\225,B\312\003\242E2B\315\00333\366A\272\003\004V\377A\274\003#[\000B\314\003\370\323\005B\257\003"
+        "\356\374\007B\260\003\006\001\034B\316\003\256\307<B\316\003\014\002\341A\260\003)\134\346A\273\003#"
+        "[\000B\275\003ff\005B\315\003\213l\032B\317\003w\276\042B\257\003\356|KB\317\003\303\365\365A\276\003"
+        "\012W\002B\261\003\323M\005B\274\003ff\005B\320\003\303\365\007B\260\003\010,\034B\316\003\205\353<B"
+        "\321\0039\264\360A\261\003\266\363\360A\277\003'1\001B\275\003\012W\002B\320\003\022\203\016B\262\003"
+        "\335$(B\322\003\274t3B\322\003\331\316\345A\262\003\002+\352A\300\003\370S\377A\276\003'1\001B\323\003"
+        "\250\306\025B\321\003\234D(B\261\003\305 8B\323\003\254\034\377A\277\003\370S\377A\324\003\376\324\001"
+        "B\301\003\205k\002B\262\003f\346\015B\263\003R\270\016B\322\003\230nEB\325\003\274t\344A\263\003\270"
+        "\036\364A\300\003\205k\002B\302\003D\213\005B\324\003\370\323\022B\326\003\240\032)B\264\003w\276=B\326"
+        "\003\226C\352A\264\0039\264\365A\303\003{\224\001B\301\003D\213\005B\327\0031\210\015B\263\003\356\374"
+        ".B\325\003\250F4B\330\003\236\357\363A\302\003{\224\001B\304\003\317\367\001B\264\003\020\330\003B\327"
+        "\003\223\030\007B\265\003\262\035\036B\331\003\272\311;B\265\003)\134\346A\331\0035^\346A\305\003sh\372"
+        "A\303\003\317\367\001B\332\003\037\205\034B\330\003\313\241\036B\266\003\252\361HB\332\003\246\233\360"
+        "A\304\003sh\372A\306\003\307K\005B\266\003\022\203\005B\333\003D\213\005B\265\003yi\027B\331\003\254"
+        "\034;B\334\003X9\355A\266\003\362\322\367A\307\003sh\003B\305\003\307K\005B\333\003\264\310\015B\267"
+        "\003j\274+B\335\003\362R2B\335\003\0775\346A\267\003\022\203\352A\270\003\035Z\000B\306\003sh\003B\310"
+        "\003\345\320\023B\334\003\364\375)B\266\003\315L<B\336\003\236\357\274A\335\0037\211\373A\270\003F\266"
+        "\377A\311\003\337\317\002B\307\003\345\320\023B\015\0047\011%B\017\004yi4B\270\003\372~\377A\310\003"
+        "\337\317\002B\312\003f\346\002B\337\003\242E\020B\271\003\311\366\025B\340\003\242E\034B\336\003{\224"
+        "'B\271\003\035Z\353A\313\003\240\032\365A\311\003f\346\002B\340\003\016-\017B\341\003\366\250\022B\272"
+        "\003\242E2B\342\003\343\2459B\342\003+\207\301A\272\003\264\310\356A\312\003\240\032\365A\314\003\305"
+        " \374A\271\003\272\311'B\343\003\002\2530B\341\003\012\3271B\347\003\351&\334A\313\003\305 \374A\315"
+        "\003Nb\004B\273\003\370\323\005B\272\0039\264\015B\344\003%\006\016B\342\00394\020B\273\00333\366A\316"
+        "\003D\213\367A\347\003\250\306\372A\314\003Nb\004B\351\003o\222\025B\274\003\213l\032B\350\003sh4B\274"
+        "\003\014\002\341A\315\003D\213\367A\317\003\272I\001B\352\003\303u\004B\351\003`\345-B\353\003'10B\273"
+        "\003\256\307<B\355\003\354Q\364A\275\003\303\365\365A\316\003\272I\001B\320\003\226\303\001B\353\003"
+        "\254\234\024B\274\003w\276\042B\354\003\262\0355B\355\003\347\373\332A\321\003\006\201\374A\317\003\226"
+        "\303\001B\275\003\303\365\007B\357\003\325x\016B\276\003\022\203\016B\361\003\226C\022B\361\003\020X"
+        "\302A\276\0039\264\360A\320\003\006\201\374A\322\003\020X\376A\277\003\234D(B\362\003\232\031/B\363\003"
+        "\343%/B\277\003\331\316\345A\323\003\177j\373A\321\003\020X\376A\364\003!\260\017B\363\003\376T\025B"
+        "\276\003\274t3B\361\003\345\320>B\322\003\177j\373A\300\003\254\034\377A\324\0035^\001B\365\003}\077"
+        "\016B\277\003\250\306\025B\364\003\325\370\034B\367\003\221\355'B\367\003\213l\276A\325\003D\213\375"
+        "A\323\0035^\001B\300\003\376\324\001B\301\003\370\323\022B\371\003\376T%B\366\003`\3453B\373\003\256"
+        "G\303A\301\003\274t\344A\324\003D\213\375A\326\003P\215\000B\371\003\372~\030B\367\003Nb,B\302\003\250"
+        "F4B\302\003\226C\352A\327\003F\266\374A\325\003P\215\000B\375\003-\262\020B\373\003\077\265\023B\301"
+        "\003\240\032)B\376\003\343%/B\326\003F\266\374A\330\003q\275\000B\376\003\254\034\006B\303\003\223\030"
+        "\007B\302\0031\210\015B\377\003\002+\035B\375\003\240\232@B\001\004ff\326A\303\003\236\357\363A\331\003"
+        "\024\256\370A\327\003q\275\000B\304\003\313\241\036B\377\003;_#B\000\004!01B\304\0035^\346A\330\003\024"
+        "\256\370A\001\004\354Q\371A\332\003\347\373\375A\005\004\232\031\000B\003\004\236\357\015B\305\003\254"
+        "\034;B\005\004\301\312\327A\305\003\246\233\360A\333\003\215\227\374A\331\003\347\373\375A\304\003\037"
+        "\205\034B\007\0047\011#B\006\004\037\0051B\332\003\215\227\374A\334\003\341\372\001B\305\003D\213\005"
+        "B\010\004%\006\010B\306\003\264\310\015B\007\004d; B\011\004\134\017CB\306\003X9\355A\335\003\207\026"
+        "\376A\333\003\341\372\001B\011\004\246\233\016B\013\004Z\344\017B\307\003\364\375)B\010\004R\270/B\013"
+        "\004}\077\305A\307\003\0775\346A\310\0037\211\373A\334\003\207\026\376A\015\004\215\027\031B\336\003"
+        "\031\204,B\306\003\362R2B\017\004m\347\266A\310\003\236\357\274A\015\004\027\331\336A\016\004w>\016B"
+        "\337\003\002\253\027B\311\003{\224'B\335\003\031\204,B\017\004\234\304\340A\340\003X9\351A]\004\213l"
+        "\352A\311\003\242E\020B\336\003\002\253\027B\134\004\376\324\042B^\004\270\236%B\341\003\270\036\342"
+        "A\337\003X9\351A\134\004u\223\355A\312\003\016-\017B\311\003\242E\034B[\004\177j#B]\004J\214'B\340\003"
+        "\270\036\342A\343\003y\351\347A[\004\301\312\352A\312\003\366\250\022B\342\003\027\331\032BZ\004\311"
+        "\366\042B\134\004;\337$B\343\003#\333\274A\313\003+\207\301A\344\003\327\243\333A\345\003\335$\016B\314"
+        "\00394\020B\341\003\027\331\032B\312\003\343\2459B\342\003#\333\274A\345\003\000\000\344A\341\003y\351"
+        "\347AZ\004\006\201\352A\344\003\364\375\033BX\004\341\372 B[\004%\006&B\345\003\201\225\316A\346\003"
+        "b\020\320A\347\003\230n\332A\342\003\327\243\333A\314\003%\006\016B\343\003\364\375\033B\350\003\317"
+        "\367\034B\344\003\201\225\316A\343\003\000\000\344AX\004sh\354A\346\00333\367A\342\003\335$\016BZ\004"
+        "\376\324%B\322\004\327#NB\344\003b\020\320A\322\004\313\241\344A\350\003y\351\354A\345\00333\367A\347"
+        "\003\035\332\017B\320\004h\021 B\324\004\020\330MB\350\003d;\273A\344\003\230n\332A\314\003\351&\334"
+        "A\315\003\250\306\372A\346\003\035\332\017B\351\003-\262\033B\342\003\321\042<B\347\003d;\273A\351\003"
+        "\010\254\344A\320\004{\024\345A\346\003y\351\354A\344\003\317\367\034B\317\004h\021!B\322\004Z\344&B"
+        "\352\003P\215\340A\317\004\327\243\343A\350\003\010\254\344A\315\003o\222\025B\347\003-\262\033B\316"
+        "\004N\342\036B\320\004\276\037%B\351\003P\215\340A\316\004\022\203\345A\353\003R\270\346A\316\003\303"
+        "u\004B\315\004\004V!B\317\004Tc!B\315\003y\351@B\315\004\376\324\345A\352\003R\270\346A\354\003\264\310"
+        "\350A\317\003\254\234\024B\355\003\347{\031B\314\004\315\314 B\316\004w\276#B\355\003w\276\273A\356\003"
+        "7\211\340A\314\004\236\357\345A\353\003\264\310\350A\357\003\236o\027B\312\004\033/\037B\315\004J\014"
+        "%B\354\003w\276\273A\357\003\303\365\327A\320\003\347\373\332A\317\003\354Q\364A\356\003\004V\016B\353"
+        "\003\347{\031B\361\003\256\307=B\357\003H\341\311A\354\0037\211\340A\312\004\307K\345A\360\003\022\203"
+        "\372A\355\003\004V\016B\314\004`e#B\310\004\374\251KB\356\003H\341\311A\360\003\010\254\317A\355\003"
+        "\303\365\327A\361\003q=\342A\320\003\325x\016B\354\003\236o\027B\362\003Zd\035B\357\003\010\254\317A"
+        "\362\003ff\341A}\003sh\354A\356\003\022\203\372A\361\003`e\014B{\003\341\372 B\355\003\341\372PB\362"
+        "\003/\335\266A\321\003\020X\302A\357\003q=\342A\360\003`e\014B\320\003\226C\022B\363\003;\337\026B\355"
+        "\003\256\307=B\361\003/\335\266A\360\003ff\341A\363\003\354Q\345A{\003\006\201\352A\357\003Zd\035By\003"
+        "\311\366\042B}\003\376\324%B\362\003\354Q\345A\364\003\266\363\345Ay\003\301\312\352A\322\003\376T\025"
+        "B\361\003;\337\026Bx\003\177j#B{\003%\006&B\365\003\354Q\345A\363\003\266\363\345Ax\003u\223\355A\322"
+        "\003!\260\017B\323\003\325\370\034Bw\003\376\324\042By\003;\337$B\364\003\354Q\345A\366\003y\351\347"
+        "Aw\003\213l\352A\323\003}\077\016B\367\003\264\310\027B\247\003\014\002\042Bx\003J\214'B\367\003\016"
+        "-\264A\370\003y\351\347A\365\003y\351\347A\247\003\201\225\353A\371\003\364\375\032B\246\003\341z#Bw"
+        "\003\270\236%B\366\003\016-\264A\324\003\213l\276A\371\003\201\225\334A\370\003R\270\015B\365\003\264"
+        "\310\027B\323\003\221\355'B\325\003Nb,B\371\003#\333\315A\366\003y\351\347A\246\003\315\314\353A\372"
+        "\003\215\227\365A\367\003R\270\015B\247\003\022\203(B \001\232\231GB\372\003R\270\315A\370\003#\333\315"
+        "A\373\003o\022\330A\367\003\201\225\334A\325\003\372~\030B\366\003\364\375\032B\374\003\024.\033B\371"
+        "\003R\270\315A \001\264\310\333A\374\003-\262\344A\370\003\215\227\365A\373\003R\270\014B\036\001q\275"
+        "\035B\042\001b\220KB\374\003D\213\272A\325\003\256G\303A\371\003o\022\330A\372\003R\270\014B\326\003"
+        "\077\265\023B\375\003\000\200\032B\367\003\177\352<B\373\003D\213\272A\036\001\374\251\334A\372\003-"
+        "\262\344A\375\003\033/\345A\371\003\024.\033B\035\001R8\037B \001Z\344 B\035\001%\006\335A\374\003\033"
+        "/\345A\376\003\213l\345A\326\003-\262\020B\373\003\000\200\032B\034\001\014\002\037B\036\001+\007 B\034"
+        "\001\347\373\333A\377\003\351&\340A\375\003\213l\345A\327\003\254\034\006B\035\001\366(\037B\033\001"
+        "\205k\037B\326\003\343%/B\033\001m\347\334A\376\003\351&\340A\000\004\370S\355A\001\004o\222\034B\034"
+        "\001\037\005\035B\327\003\002+\035B\032\001\014\002!B\001\004\215\227\274A\032\001\356|\333A\002\004"
+        "5^\346A\377\003\370S\355A\003\004\335$\032B\030\001\262\235\034B\033\001\272\311\037B\000\004\215\227"
+        "\274A\330\003ff\326A\003\004)\134\332A\331\003\354Q\371A\002\004m\347\016B\377\003o\222\034B\005\004"
+        "\311v;B\003\004T\343\311A\030\001\037\205\335A\000\0045^\346A\004\004\321\042\365A\001\004m\347\016B"
+        "\032\001\274t B\026\001\347{JB\002\004T\343\311A\004\004\246\233\315A\001\004)\134\332A\005\004\331\316"
+        "\334A\331\003\236\357\015B\006\004\335$\032B\000\004\335$\032B\003\004\246\233\315A\006\0045^\341A\222"
+        "\001sh\344A\002\004\321\042\365A\005\004\374\251\015B\220\001L\267%B\224\001\345\320IB\006\0045^\270"
+        "A\332\003\301\312\327A\003\004\331\316\334A\331\003\232\031\000B\004\004\374\251\015B\007\004\372~\030"
+        "B\001\004\311v;B\005\0045^\270A\004\0045^\341A\220\001!\260\344A\007\0045^\346A\003\004\335$\032B\222"
+        "\001T\343\034B\217\001\027\331*B\217\001\323M\344A\010\004y\351\345A\006\0045^\346A\005\004\372~\030"
+        "B\220\001d\273\033B\333\003d; B\332\0037\011#B\216\001w\276\344A\007\004y\351\345A\011\004\317\367\347"
+        "A\333\003%\006\010B\217\001\217\302\031B\215\001\217B(B\334\003R\270/B\012\004\337O\344A\215\001\217"
+        "\302\345A\010\004\317\367\347A\334\003\246\233\016B\013\004\272I\030B\216\001\242\305\034B\214\001P\215"
+        "'B\013\004\376\324\271A\214\001\0775\344A\011\004\337O\344A\014\004ff\351A\015\004\024.\033B\215\001"
+        "f\346\033B\212\001\274\364&B\012\004\376\324\271A\335\003}\077\305A\015\004\347\373\332A\334\003Z\344"
+        "\017B\014\004%\206\020B\011\004\272I\030B\336\003\000\000\077B\015\004b\020\321A\212\001\205\353\337"
+        "A\012\004ff\351A\016\004\264\310\365A\013\004%\206\020B\214\001\215\027\034B\210\001/]MB\016\004\006"
+        "\201\316A\014\004b\020\321A\013\004\347\373\332A\336\003\027\331\336A\335\003\215\027\031B\012\004\024"
+        ".\033B\017\004\376\324\035B\015\004\006\201\316A`\004\315\314\353A\017\004\376\324\353A\014\004\264\310"
+        "\365A\336\003w>\016B^\004\341z#B\212\001\254\234IB\336\003m\347\266A\337\003\234\304\340A^\004\201\225"
+        "\353A\016\004\376\324\353A\015\004\376\324\035B]\004\014\002\042B`\004\022\203(B\021\004J\014\312A\023"
+        "\004X9\315A\022\004\256G\315A\025\004`\345\321A\024\004q=\326A\027\004\006\001UB\033\004\004VVB\020\004"
+        "J\014\312A\027\004\317\367\337A\025\004}\077\363A\022\004\317\367\365A\030\004\246\233\023B\026\004\246"
+        "\233\023B\023\004\024\256BB\020\004\256G\315A\031\004\240\032\341A\023\004\305 \360A\021\004\317\367"
+        "\365A\032\004\262\035\017B\030\004\205\353\026B\024\004\364}FB\020\004X9\315A\033\004\232\231\337A\022"
+        "\004\305 \360A\024\004\010\254\362A\034\004\351\246\022B\032\004\002\253\023B\021\004\024\256BB\020\004"
+        "q=\326A\035\004\033/\341A\023\004\010\254\362A\025\004\313\241\366A\034\004\374)\020B\036\004\362R\022"
+        "B\021\004\366\250EB\020\004`\345\321A\037\004\242E\346A\021\004}\077\363A\024\004\313\241\366A\026\004"
+        "D\213\020B\036\004\351\246\022B\023\004\254\034DB!\004D\213\357A\037\004\004\326\002B\027\004\311\366"
+        "\004B \004\372\376\017B\025\004D\213\020B\021\004\246\233\023B\042\004\201\225,B\021\004\317\367\337"
+        "A\042\004^\272\370A\026\004\311\366\004B\030\004\274\364\005B#\004\356\374\007B!\004)\3349B$\004\356"
+        "|KB$\004)\134\346A\027\004\274\364\005B\031\004\240\032\012B\021\004\246\233\023B\022\004\205\353\026"
+        "B#\004\006\001\034B%\004\010,\034B\022\004\240\032\341A&\004\266\363\360A\032\004\260r\003B%\004\323"
+        "M\005B\030\004\240\032\012B'\004\305 8B$\004\337\317OB'\004\002+\352A\031\004\260r\003B\033\004\327\243"
+        "\003B(\004f\346\015B\022\004\262\035\017B\023\004\002\253\023B&\004\335$(B\023\004\232\231\337A)\004"
+        "\270\036\364A\032\004\327\243\003B\034\004\351&\011B(\004R\270\016B*\004\356\374.B\022\004%\206KB*\004"
+        "9\264\365A+\004\020\330\003B\033\004\351&\011B\035\004\376T\011B\024\004\374)\020B\023\004\351\246\022"
+        "B)\004w\276=B\024\004\033/\341A,\004)\134\346A\036\004`\345\001B\034\004\376T\011B-\004yi\027B+\004\262"
+        "\035\036B\025\004\262\035PB.\004\362\322\367A\035\004`\345\001B-\004\022\203\005B\037\004=\212\010B\024"
+        "\004\362R\022B\025\004\351\246\022B/\004\315L<B\025\004\242E\346A/\004\022\203\352A\026\004\004\326\002"
+        "B\036\004=\212\010B \004F\266\015B.\004j\274+B\021\004\205\353RB1\004\372~\377A0\004F\266\377A/\004\035"
+        "Z\000B!\004\345\320\002B\037\004F\266\015B\026\004\372\376\017BE\004\033\257GB2\004\035Z\353A\026\004"
+        "D\213\357A\042\004;\337\001B \004\345\320\002B1\004\311\366\025B3\004\272\311'B\027\004)\3349B3\004\264"
+        "\310\356A\027\004^\272\370A#\004\004V\377A!\004;\337\001B4\0049\264\015B\026\004\201\225,B2\004\242E"
+        "2B5\00433\366A\042\004\004V\377A$\004#[\000B4\004\370\323\005B\027\004\356\374\007B\030\004\006\001\034"
+        "B6\004\256\307<B6\004\014\002\341A\030\004)\134\346A#\004#[\000B%\004ff\005B5\004\213l\032B7\004w\276"
+        "\042B\027\004\356|KB7\004\303\365\365A&\004\012W\002B\031\004\323M\005B$\004ff\005B8\004\303\365\007"
+        "B\030\004\010,\034B6\004\205\353<B9\0049\264\360A\031\004\266\363\360A'\004'1\001B%\004\012W\002B8\004"
+        "\022\203\016B\032\004\335$(B:\004\274t3B:\004\331\316\345A\032\004\002+\352A(\004\370S\377A&\004'1\001"
+        "B;\004\250\306\025B9\004\234D(B\031\004\305 8B;\004\254\034\377A'\004\370S\377A<\004\376\324\001B)\004"
+        "\205k\002B\032\004f\346\015B\033\004R\270\016B:\004\230nEB=\004\274t\344A\033\004\270\036\364A(\004\205"
+        "k\002B*\004D\213\005B<\004\370\323\022B>\004\240\032)B\034\004w\276=B>\004\226C\352A\034\0049\264\365"
+        "A+\004{\224\001B)\004D\213\005B\077\0041\210\015B\033\004\356\374.B=\004\250F4B@\004\236\357\363A*\004"
+        "{\224\001B,\004\317\367\001B\034\004\020\330\003B\077\004\223\030\007B\035\004\262\035\036BA\004\272"
+        "\311;B\035\004)\134\346AA\0045^\346A-\004sh\372A+\004\317\367\001BB\004\037\205\034B@\004\313\241\036"
+        "B\036\004\252\361HBB\004\246\233\360A,\004sh\372A.\004\307K\005B\036\004\022\203\005BC\004D\213\005B"
+        "\035\004yi\027BA\004\254\034;BD\004X9\355A\036\004\362\322\367A/\004sh\003B-\004\307K\005BC\004\264\310"
+        "\015B\037\004j\274+BE\004\362R2BE\004\0775\346A\037\004\022\203\352A \004\035Z\000B.\004sh\003B0\004"
+        "\345\320\023BD\004\364\375)B\036\004\315L<BF\004\236\357\274AE\0047\211\373A \004F\266\377A1\004\337"
+        "\317\002B/\004\345\320\023Bu\0047\011%Bw\004yi4B \004\372~\377A0\004\337\317\002B2\004f\346\002BG\004"
+        "\242E\020B!\004\311\366\025BH\004\242E\034BF\004{\224'B!\004\035Z\353A3\004\240\032\365A1\004f\346\002"
+        "BH\004\016-\017BI\004\366\250\022B\042\004\242E2BJ\004\343\2459BJ\004+\207\301A\042\004\264\310\356A"
+        "2\004\240\032\365A4\004\305 \374A!\004\272\311'BK\004\002\2530BI\004\012\3271BO\004\351&\334A3\004\305"
+        " \374A5\004Nb\004B#\004\370\323\005B\042\0049\264\015BL\004%\006\016BJ\00494\020B#\00433\366A6\004D\213"
+        "\367AO\004\250\306\372A4\004Nb\004BQ\004o\222\025B$\004\213l\032BP\004sh4B$\004\014\002\341A5\004D\213"
+        "\367A7\004\272I\001BR\004\303u\004BQ\004`\345-BS\004'10B#\004\256\307<BU\004\354Q\364A%\004\303\365\365"
+        "A6\004\272I\001B8\004\226\303\001BS\004\254\234\024B$\004w\276\042BT\004\262\0355BU\004\347\373\332A"
+        "9\004\006\201\374A7\004\226\303\001B%\004\303\365\007BW\004\325x\016B&\004\022\203\016BY\004\226C\022"
+        "BY\004\020X\302A&\0049\264\360A8\004\006\201\374A:\004\020X\376A'\004\234D(BZ\004\232\031/B[\004\343"
+        "%/B'\004\331\316\345A;\004\177j\373A9\004\020X\376A\134\004!\260\017B[\004\376T\025B&\004\274t3BY\004"
+        "\345\320>B:\004\177j\373A(\004\254\034\377A<\0045^\001B]\004}\077\016B'\004\250\306\025B\134\004\325"
+        "\370\034B_\004\221\355'B_\004\213l\276A=\004D\213\375A;\0045^\001B(\004\376\324\001B)\004\370\323\022"
+        "Ba\004\376T%B^\004`\3453Bc\004\256G\303A)\004\274t\344A<\004D\213\375A>\004P\215\000Ba\004\372~\030B"
+        "_\004Nb,B*\004\250F4B*\004\226C\352A\077\004F\266\374A=\004P\215\000Be\004-\262\020Bc\004\077\265\023"
+        "B)\004\240\032)Bf\004\343%/B>\004F\266\374A@\004q\275\000Bf\004\254\034\006B+\004\223\030\007B*\0041"
+        "\210\015Bg\004\002+\035Be\004\240\232@Bi\004ff\326A+\004\236\357\363AA\004\024\256\370A\077\004q\275"
+        "\000B,\004\313\241\036Bg\004;_#Bh\004!01B,\0045^\346A@\004\024\256\370Ai\004\354Q\371AB\004\347\373\375"
+        "Am\004\232\031\000Bk\004\236\357\015B-\004\254\034;Bm\004\301\312\327A-\004\246\233\360AC\004\215\227"
+        "\374AA\004\347\373\375A,\004\037\205\034Bo\0047\011#Bn\004\037\0051BB\004\215\227\374AD\004\341\372\001"
+        "B-\004D\213\005Bp\004%\006\010B.\004\264\310\015Bo\004d; Bq\004\134\017CB.\004X9\355AE\004\207\026\376"
+        "AC\004\341\372\001Bq\004\246\233\016Bs\004Z\344\017B/\004\364\375)Bp\004R\270/Bs\004}\077\305A/\004\077"
+        "5\346A0\0047\211\373AD\004\207\026\376Au\004\215\027\031BF\004\031\204,B.\004\362R2Bw\004m\347\266A0"
+        "\004\236\357\274Au\004\027\331\336Av\004w>\016BG\004\002\253\027B1\004{\224'BE\004\031\204,Bw\004\234"
+        "\304\340AH\004X9\351A\275\002\213l\352A1\004\242E\020BF\004\002\253\027B\274\002\376\324\042B\276\002"
+        "\270\236%BI\004\270\036\342AG\004X9\351A\274\002u\223\355A2\004\016-\017B1\004\242E\034B\273\002\177"
+        "j#B\275\002J\214'BH\004\270\036\342AK\004y\351\347A\273\002\301\312\352A2\004\366\250\022BJ\004\027\331"
+        "\032B\272\002\311\366\042B\274\002;\337$BK\004#\333\274A3\004+\207\301AL\004\327\243\333AM\004\335$\016"
+        "B4\00494\020BI\004\027\331\032B2\004\343\2459BJ\004#\333\274AM\004\000\000\344AI\004y\351\347A\272\002"
+        "\006\201\352AL\004\364\375\033B\270\002\341\372 B\273\002%\006&BM\004\201\225\316AN\004V\016\320AO\004"
+        "\230n\332AJ\004\327\243\333A4\004%\006\016BK\004\364\375\033BP\004\317\367\034BL\004\201\225\316AK\004"
+        "\000\000\344A\270\002sh\354AN\00433\367AJ\004\335$\016B\272\002\376\324%B\266\002B\340OBL\004V\016\320"
+        "A\334\004ff\350AP\004y\351\354AM\00433\367AO\004\035\332\017B\332\004\351&&B\336\004#[OBP\004d;\273A"
+        "L\004\230n\332A4\004\351&\334A5\004\250\306\372AN\004\035\332\017BQ\004-\262\033BJ\004\321\042<BO\004"
+        "d;\273AQ\004\010\254\344AN\004y\351\354A\332\004\215\227\355AL\004\317\367\034B\331\004;_$B\334\004\250"
+        "F&BR\004P\215\340AP\004\010\254\344A\331\004\260r\355A5\004o\222\025BO\004-\262\033B\330\004V\216$B\332"
+        "\00494%BQ\004P\215\340AS\004R\270\346A\330\004\370S\356A6\004\303u\004B\331\004\240\032%B\327\004\203"
+        "\300&B5\004y\351@BR\004R\270\346AT\004\264\310\350A\327\004\260r\355A7\004\254\234\024BU\004\347{\031"
+        "B\330\004\035Z$B\326\004!0'BU\004w\276\273AV\0047\211\340AS\004\264\310\350A\326\004\014\002\357AW\004"
+        "\236o\027B\324\004o\022$B\327\0047\011%BT\004w\276\273AW\004\303\365\327A8\004\347\373\332A7\004\354"
+        "Q\364AV\004\004V\016BS\004\347{\031BY\004\256\307=BW\004H\341\311AT\0047\211\340A\324\004\006\201\355"
+        "AX\004\022\203\372AU\004\004V\016B\326\004\232\231#B\345\003B\340OBV\004H\341\311AX\004\010\254\317A"
+        "U\004\303\365\327AY\004q=\342A8\004\325x\016BT\004\236o\027BZ\004Zd\035BW\004\010\254\317AZ\004ff\341"
+        "A\345\003sh\354AV\004\022\203\372AY\004`e\014B\343\003\341\372 BU\004\341\372PBZ\004/\335\266A9\004\020"
+        "X\302AW\004q=\342AX\004`e\014B8\004\226C\022B[\004;\337\026BU\004\256\307=BY\004/\335\266AX\004ff\341"
+        "A[\004\354Q\345A\343\003\006\201\352AW\004Zd\035B\341\003\311\366\042B\345\003\376\324%BZ\004\354Q\345"
+        "A\134\004\266\363\345A\341\003\301\312\352A:\004\376T\025BY\004;\337\026B\340\003\177j#B\343\003%\006"
+        "&B]\004\354Q\345A[\004\266\363\345A\340\003u\223\355A:\004!\260\017B;\004\325\370\034B\337\003\376\324"
+        "\042B\341\003;\337$B\134\004\354Q\345A^\004y\351\347A\337\003\213l\352A;\004}\077\016B_\004\264\310\027"
+        "B\017\004\014\002\042B\340\003J\214'B_\004\016-\264A]\004y\351\347A`\004y\351\347A\017\004\201\225\353"
+        "Aa\004\364\375\032B\016\004\341z#B\337\003\270\236%B^\004\016-\264A<\004\213l\276Aa\004\201\225\334A"
+        "`\004R\270\015B]\004\264\310\027B;\004\221\355'B=\004Nb,Ba\004#\333\315A^\004y\351\347A\016\004\315\314"
+        "\353Ab\004\215\227\365A_\004R\270\015B\017\004\022\203(B\210\001\232\231GBb\004R\270\315A`\004#\333\315"
+        "Ac\004o\022\330A_\004\201\225\334A=\004\372~\030B^\004\364\375\032Bd\004\024.\033Ba\004R\270\315A\210"
+        "\001\264\310\333Ad\004-\262\344A`\004\215\227\365Ac\004R\270\014B\206\001q\275\035B\212\001b\220KBd\004"
+        "D\213\272A=\004\256G\303Aa\004o\022\330Ab\004R\270\014B>\004\077\265\023Be\004\000\200\032B_\004\177"
+        "\352<Bc\004D\213\272A\206\001\374\251\334Ab\004-\262\344Ae\004\033/\345Aa\004\024.\033B\205\001R8\037"
+        "B\210\001Z\344 B\205\001%\006\335Ad\004\033/\345Af\004\213l\345A>\004-\262\020Bc\004\000\200\032B\204"
+        "\001\014\002\037B\206\001+\007 B\204\001\347\373\333Ag\004\351&\340Ae\004\213l\345A\077\004\254\034\006"
+        "B\205\001\366(\037B\203\001\205k\037B>\004\343%/B\203\001m\347\334Af\004\351&\340Ah\004\370S\355Ai\004"
+        "o\222\034B\204\001\037\005\035B\077\004\002+\035B\202\001\014\002!Bi\004\215\227\274A\202\001\356|\333"
+        "Aj\0045^\346Ag\004\370S\355Ak\004\335$\032B\200\001\262\235\034B\203\001\272\311\037Bh\004\215\227\274"
+        "A@\004ff\326Ak\004)\134\332AA\004\354Q\371Aj\004m\347\016Bg\004o\222\034Bm\004\311v;Bk\004T\343\311A"
+        "\200\001\037\205\335Ah\0045^\346Al\004\321\042\365Ai\004m\347\016B\202\001\274t B~\001\347{JBj\004T\343"
+        "\311Al\004\246\233\315Ai\004)\134\332Am\004\331\316\334AA\004\236\357\015Bh\004\335$\032Bn\004\335$\032"
+        "Bk\004\246\233\315An\0045^\341A\372\001sh\344Aj\004\321\042\365Am\004\374\251\015B\370\001L\267%B\374"
+        "\001\345\320IBn\0045^\270AB\004\301\312\327Ak\004\331\316\334AA\004\232\031\000Bl\004\374\251\015Bo\004"
+        "\372~\030Bi\004\311v;Bm\0045^\270Al\0045^\341A\370\001!\260\344Ao\0045^\346Ak\004\335$\032B\372\001T"
+        "\343\034B\367\001\027\331*B\367\001\323M\344Ap\004y\351\345An\0045^\346Am\004\372~\030B\370\001d\273"
+        "\033BC\004d; BB\0047\011#B\366\001w\276\344Ao\004y\351\345Aq\004\317\367\347AC\004%\006\010B\367\001"
+        "\217\302\031B\365\001\217B(BD\004R\270/Br\004\337O\344A\365\001\217\302\345Ap\004\317\367\347AD\004\246"
+        "\233\016Bs\004\272I\030B\366\001\242\305\034B\364\001P\215'Bs\004\376\324\271A\364\001\0775\344Aq\004"
+        "\337O\344At\004ff\351Au\004\024.\033B\365\001f\346\033B\362\001\274\364&Br\004\376\324\271AE\004}\077"
+        "\305Au\004\347\373\332AD\004Z\344\017Bt\004%\206\020Bq\004\272I\030BF\004\000\000\077Bu\004b\020\321"
+        "A\362\001\205\353\337Ar\004ff\351Av\004\264\310\365As\004%\206\020B\364\001\215\027\034B\360\001/]MB"
+        "v\004\006\201\316At\004b\020\321As\004\347\373\332AF\004\027\331\336AE\004\215\027\031Br\004\024.\033"
+        "Bw\004\376\324\035Bu\004\006\201\316A\300\002\315\314\353Aw\004\376\324\353At\004\264\310\365AF\004w"
+        ">\016B\276\002\341z#B\362\001\254\234IBF\004m\347\266AG\004\234\304\340A\276\002\201\225\353Av\004\376"
+        "\324\353Au\004\376\324\035B\275\002\014\002\042B\300\002\022\203(By\004J\014\312A{\004X9\315Az\004\256"
+        "G\315A}\004`\345\321A|\004q=\326A\177\004\006\001UB\203\004\004VVBx\004J\014\312A\177\004\317\367\337"
+        "A}\004}\077\363Az\004\317\367\365A\200\004\246\233\023B~\004\246\233\023B{\004\024\256BBx\004\256G\315"
+        "A\201\004\240\032\341A{\004\305 \360Ay\004\317\367\365A\202\004\262\035\017B\200\004\205\353\026B|\004"
+        "\364}FBx\004X9\315A\203\004\232\231\337Az\004\305 \360A|\004\010\254\362A\204\004\351\246\022B\202\004"
+        "\002\253\023By\004\024\256BBx\004q=\326A\205\004\033/\341A{\004\010\254\362A}\004\313\241\366A\204\004"
+        "\374)\020B\206\004\362R\022By\004\366\250EBx\004`\345\321A\207\004\242E\346Ay\004}\077\363A|\004\313"
+        "\241\366A~\004D\213\020B\206\004\351\246\022B{\004\254\034DB\211\004D\213\357A\207\004\004\326\002B\177"
+        "\004\311\366\004B\210\004\372\376\017B}\004D\213\020By\004\246\233\023B\212\004\201\225,By\004\317\367"
+        "\337A\212\004^\272\370A~\004\311\366\004B\200\004\274\364\005B\213\004\356\374\007B\211\004)\3349B\214"
+        "\004\356|KB\214\004)\134\346A\177\004\274\364\005B\201\004\240\032\012By\004\246\233\023Bz\004\205\353"
+        "\026B\213\004\006\001\034B\215\004\010,\034Bz\004\240\032\341A\216\004\266\363\360A\202\004\260r\003"
+        "B\215\004\323M\005B\200\004\240\032\012B\217\004\305 8B\214\004\337\317OB\217\004\002+\352A\201\004\260"
+        "r\003B\203\004\327\243\003B\220\004f\346\015Bz\004\262\035\017B{\004\002\253\023B\216\004\335$(B{\004"
+        "\232\231\337A\221\004\270\036\364A\202\004\327\243\003B\204\004\351&\011B\220\004R\270\016B\222\004\356"
+        "\374.Bz\004%\206KB\222\0049\264\365A\223\004\020\330\003B\203\004\351&\011B\205\004\376T\011B|\004\374"
+        ")\020B{\004\351\246\022B\221\004w\276=B|\004\033/\341A\224\004)\134\346A\206\004`\345\001B\204\004\376"
+        "T\011B\225\004yi\027B\223\004\262\035\036B}\004\262\035PB\226\004\362\322\367A\205\004`\345\001B\225"
+        "\004\022\203\005B\207\004=\212\010B|\004\362R\022B}\004\351\246\022B\227\004\315L<B}\004\242E\346A\227"
+        "\004\022\203\352A~\004\004\326\002B\206\004=\212\010B\210\004F\266\015B\226\004j\274+By\004\205\353R"
+        "B\231\004\372~\377A\230\004F\266\377A\227\004\035Z\000B\211\004\345\320\002B\207\004F\266\015B~\004\372"
+        "\376\017B\255\004\033\257GB\232\004\035Z\353A~\004D\213\357A\212\004;\337\001B\210\004\345\320\002B\231"
+        "\004\311\366\025B\233\004\272\311'B\177\004)\3349B\233\004\264\310\356A\177\004^\272\370A\213\004\004"
+        "V\377A\211\004;\337\001B\234\0049\264\015B~\004\201\225,B\232\004\242E2B\235\00433\366A\212\004\004V"
+        "\377A\214\004#[\000B\234\004\370\323\005B\177\004\356\374\007B\200\004\006\001\034B\236\004\256\307<"
+        "B\236\004\014\002\341A\200\004)\134\346A\213\004#[\000B\215\004ff\005B\235\004\213l\032B\237\004w\276"
+        "\042B\177\004\356|KB\237\004\303\365\365A\216\004\012W\002B\201\004\323M\005B\214\004ff\005B\240\004"
+        "\303\365\007B\200\004\010,\034B\236\004\205\353<B\241\0049\264\360A\201\004\266\363\360A\217\004'1\001"
+        "B\215\004\012W\002B\240\004\022\203\016B\202\004\335$(B\242\004\274t3B\242\004\331\316\345A\202\004\002"
+        "+\352A\220\004\370S\377A\216\004'1\001B\243\004\250\306\025B\241\004\234D(B\201\004\305 8B\243\004\254"
+        "\034\377A\217\004\370S\377A\244\004\376\324\001B\221\004\205k\002B\202\004f\346\015B\203\004R\270\016"
+        "B\242\004\230nEB\245\004\274t\344A\203\004\270\036\364A\220\004\205k\002B\222\004D\213\005B\244\004\370"
+        "\323\022B\246\004\240\032)B\204\004w\276=B\246\004\226C\352A\204\0049\264\365A\223\004{\224\001B\221"
+        "\004D\213\005B\247\0041\210\015B\203\004\356\374.B\245\004\250F4B\250\004\236\357\363A\222\004{\224\001"
+        "B\224\004\317\367\001B\204\004\020\330\003B\247\004\223\030\007B\205\004\262\035\036B\251\004\272\311"
+        ";B\205\004)\134\346A\251\0045^\346A\225\004sh\372A\223\004\317\367\001B\252\004\037\205\034B\250\004"
+        "\313\241\036B\206\004\252\361HB\252\004\246\233\360A\224\004sh\372A\226\004\307K\005B\206\004\022\203"
+        "\005B\253\004D\213\005B\205\004yi\027B\251\004\254\034;B\254\004X9\355A\206\004\362\322\367A\227\004"
+        "sh\003B\225\004\307K\005B\253\004\264\310\015B\207\004j\274+B\255\004\362R2B\255\004\0775\346A\207\004"
+        "\022\203\352A\210\004\035Z\000B\226\004sh\003B\230\004\345\320\023B\254\004\364\375)B\206\004\315L<B"
+        "\256\004\236\357\274A\255\0047\211\373A\210\004F\266\377A\231\004\337\317\002B\227\004\345\320\023B\335"
+        "\0047\011%B\337\004yi4B\210\004\372~\377A\230\004\337\317\002B\232\004f\346\002B\257\004\242E\020B\211"
+        "\004\311\366\025B\260\004\242E\034B\256\004{\224'B\211\004\035Z\353A\233\004\240\032\365A\231\004f\346"
+        "\002B\260\004\016-\017B\261\004\366\250\022B\212\004\242E2B\262\004\343\2459B\262\004+\207\301A\212\004"
+        "\264\310\356A\232\004\240\032\365A\234\004\305 \374A\211\004\272\311'B\263\004\002\2530B\261\004\012"
+        "\3271B\267\004\351&\334A\233\004\305 \374A\235\004Nb\004B\213\004\370\323\005B\212\0049\264\015B\264"
+        "\004%\006\016B\262\00494\020B\213\00433\366A\236\004D\213\367A\267\004\250\306\372A\234\004Nb\004B\271"
+        "\004o\222\025B\214\004\213l\032B\270\004sh4B\214\004\014\002\341A\235\004D\213\367A\237\004\272I\001"
+        "B\272\004\303u\004B\271\004`\345-B\273\004'10B\213\004\256\307<B\275\004\354Q\364A\215\004\303\365\365"
+        "A\236\004\272I\001B\240\004\226\303\001B\273\004\254\234\024B\214\004w\276\042B\274\004\262\0355B\275"
+        "\004\347\373\332A\241\004\006\201\374A\237\004\226\303\001B\215\004\303\365\007B\277\004\325x\016B\216"
+        "\004\022\203\016B\301\004\226C\022B\301\004\020X\302A\216\0049\264\360A\240\004\006\201\374A\242\004"
+        "\020X\376A\217\004\234D(B\302\004\232\031/B\303\004\343%/B\217\004\331\316\345A\243\004\177j\373A\241"
+        "\004\020X\376A\304\004!\260\017B\303\004\376T\025B\216\004\274t3B\301\004\345\320>B\242\004\177j\373"
+        "A\220\004\254\034\377A\244\0045^\001B\305\004}\077\016B\217\004\250\306\025B\304\004\325\370\034B\307"
+        "\004\221\355'B\307\004\213l\276A\245\004D\213\375A\243\0045^\001B\220\004\376\324\001B\221\004\370\323"
+        "\022B\311\004\376T%B\306\004`\3453B\313\004\256G\303A\221\004\274t\344A\244\004D\213\375A\246\004P\215"
+        "\000B\311\004\372~\030B\307\004Nb,B\222\004\250F4B\222\004\226C\352A\247\004F\266\374A\245\004P\215\000"
+        "B\315\004-\262\020B\313\004\077\265\023B\221\004\240\032)B\316\004\343%/B\246\004F\266\374A\250\004q"
+        "\275\000B\316\004\254\034\006B\223\004\223\030\007B\222\0041\210\015B\317\004\002+\035B\315\004\240\232"
+        "@B\321\004ff\326A\223\004\236\357\363A\251\004\024\256\370A\247\004q\275\000B\224\004\313\241\036B\317"
+        "\004;_#B\320\004!01B\224\0045^\346A\250\004\024\256\370A\321\004\354Q\371A\252\004\347\373\375A\325\004"
+        "\232\031\000B\323\004\236\357\015B\225\004\254\034;B\325\004\301\312\327A\225\004\246\233\360A\253\004"
+        "\215\227\374A\251\004\347\373\375A\224\004\037\205\034B\327\0047\011#B\326\004\037\0051B\252\004\215"
+        "\227\374A\254\004\341\372\001B\225\004D\213\005B\330\004%\006\010B\226\004\264\310\015B\327\004d; B\331"
+        "\004\134\017CB\226\004X9\355A\255\004\207\026\376A\253\004\341\372\001B\331\004\246\233\016B\333\004"
+        "Z\344\017B\227\004\364\375)B\330\004R\270/B\333\004}\077\305A\227\004\0775\346A\230\0047\211\373A\254"
+        "\004\207\026\376A\335\004\215\027\031B\256\004\031\204,B\226\004\362R2B\337\004m\347\266A\230\004\236"
+        "\357\274A\335\004\027\331\336A\336\004w>\016B\257\004\002\253\027B\231\004{\224'B\255\004\031\204,B\337"
+        "\004\234\304\340A\260\004X9\351A\263\002\354Q\363A\231\004\242E\020B\256\004\002\253\027B\262\002)\134"
+        "%B\264\002\335\244*B\261\004\270\036\342A\257\004X9\351A\262\002\351&\367A\232\004\016-\017B\231\004"
+        "\242E\034B\261\002R8#B\263\002\305 ,B\260\004\270\036\342A\263\004y\351\347A\261\002\205\353\361A\232"
+        "\004\366\250\022B\262\004\027\331\032B\260\002Zd#B\262\002q=)B\263\004#\333\274A\233\004+\207\301A\264"
+        "\004\327\243\333A\265\004\335$\016B\234\00494\020B\261\004\027\331\032B\232\004\343\2459B\262\004#\333"
+        "\274A\265\004\000\000\344A\261\004y\351\347A\260\002L7\364A\264\004\364\375\033B\256\002o\222$B\261\002"
+        "\020X+B\265\004\201\225\316A\266\004V\016\320A\267\004\230n\332A\262\004\327\243\333A\234\004%\006\016"
+        "B\263\004\364\375\033B\270\004\317\367\034B\264\004\201\225\316A\263\004\000\000\344A\256\002\262\235"
+        "\363A\266\00433\367A\262\004\335$\016B\260\002\203@,B\036\003b\220OB\264\004V\016\320A\270\004y\351\354"
+        "A\036\003!\260\356A\265\00433\367A\267\004\035\332\017B\034\003\004\326\036B\262\004\347{QB\270\004d"
+        ";\273A\264\004\230n\332A\234\004\351&\334A\235\004\250\306\372A\266\004\035\332\017B\271\004-\262\033"
+        "B\262\004\321\042<B\267\004d;\273A\271\004\010\254\344A\266\004y\351\354A\034\003\372~\361A\264\004\317"
+        "\367\034B\033\003\335$\036B\036\003\211\301-B\272\004P\215\340A\270\004\010\254\344A\033\003\370S\357"
+        "A\235\004o\222\025B\267\004-\262\033B\032\003\360'\036B\236\004`\345-B\271\004P\215\340A\273\004R\270"
+        "\346A\032\003h\221\360A\236\004\303u\004B\031\003\360'\036B\033\003\242E,B\235\004y\351@B\272\004R\270"
+        "\346A\274\004\250\306\350A\031\003\370S\357A\237\004\254\234\024B\275\004\347{\031B\030\003\335$\036"
+        "B\032\003\242E,B\275\004w\276\273A\276\0047\211\340A\273\004\250\306\350A\030\003\372~\361A\277\004\236"
+        "o\027B\026\003\004\326\036B\031\003\351\246.B\274\004w\276\273A\277\004\303\365\327A\240\004\347\373"
+        "\332A\237\004\354Q\364A\276\004\004V\016B\273\004\347{\031B\301\004\256\307=B\277\004H\341\311A\274\004"
+        "7\211\340A\026\003!\260\356A\300\004\022\203\372A\275\004\004V\016B\030\003\211\301-B\206\003\002\253"
+        "KB\276\004H\341\311A\300\004\010\254\317A\275\004\303\365\327A\301\004q=\342A\240\004\325x\016B\274\004"
+        "\236o\027B\302\004Zd\035B\277\004\010\254\317A\302\004ff\341A\206\003+\207\347A\276\004\022\203\372A"
+        "\301\004`e\014B\204\003!0\033B\275\004\341\372PB\302\004/\335\266A\241\004\020X\302A\277\004q=\342A\300"
+        "\004`e\014B\240\004\226C\022B\303\004;\337\026B\275\004\256\307=B\301\004/\335\266A\300\004ff\341A\303"
+        "\004\354Q\345A\204\003}\077\347A\277\004Zd\035B\203\003V\216\035B\206\003\331N'B\302\004\354Q\345A\304"
+        "\004\266\363\345A\203\003^\272\347A\242\004\376T\025B\301\004;\337\026B\202\003\307K\036B\204\003\307"
+        "K)B\305\004\354Q\345A\303\004\266\363\345A\202\003\234\304\346A\242\004!\260\017B\201\003\317w\033B\243"
+        "\004\325\370\034B\203\003\266\363'B\304\004\354Q\345A\201\003V\016\346A\306\004y\351\347A\243\004}\077"
+        "\016B\307\004\264\310\027B\200\003\010,\034B\202\003'\261'B\307\004\016-\264A\200\003^\272\347A\305\004"
+        "y\351\347A\310\004y\351\347A\311\004\364\375\032B~\003o\022\035B\201\003\351\246)B\306\004\016-\264A"
+        "\244\004\213l\276A\311\004\201\225\334A\310\004R\270\015B\305\004\264\310\027B\243\004\221\355'B\245"
+        "\004Nb,B\311\004#\333\315A~\003\351&\345A\306\004y\351\347A\312\004\215\227\365A\307\004R\270\015B\200"
+        "\003\354Q+B}\003\035ZKB\312\004R\270\315A\310\004#\333\315A\313\004o\022\330A\307\004\201\225\334A\245"
+        "\004\372~\030B\306\004\364\375\032B\314\004\024.\033B\311\004R\270\315A\314\004-\262\344A\356\003\307"
+        "K\345A\310\004\215\227\365A\313\004R\270\014B\354\003\033/\037B\357\003\203@PB\314\004D\213\272A\245"
+        "\004\256G\303A\311\004o\022\330A\312\004R\270\014B\246\004\077\265\023B\315\004\000\200\032B\307\004"
+        "\177\352<B\313\004D\213\272A\312\004-\262\344A\315\004\033/\345A\354\003\236\357\345A\311\004\024.\033"
+        "B\353\003\315\314 B\356\003`e#B\314\004\033/\345A\316\004\213l\345A\353\003\376\324\345A\246\004-\262"
+        "\020B\313\004\000\200\032B\352\003\004V!B\354\003J\014%B\317\004\351&\340A\315\004\213l\345A\352\003"
+        "\022\203\345A\247\004\254\034\006B\351\003N\342\036B\353\003w\276#B\246\004\343%/B\316\004\351&\340A"
+        "\351\003\327\243\343A\320\004\370S\355A\321\004o\222\034B\247\004\002+\035B\350\003h\021!B\352\003Tc"
+        "!B\321\004\215\227\274A\350\003{\024\345A\322\0045^\346A\317\004\370S\355A\323\004\335$\032B\346\003"
+        "h\021 B\351\003\276\037%B\320\004\215\227\274A\250\004ff\326A\323\004)\134\332A\251\004\354Q\371A\322"
+        "\004m\347\016B\317\004o\222\034B\325\004\311v;B\323\004T\343\311A\346\003\313\241\344A\320\0045^\346"
+        "A\324\004\335$\365A\321\004m\347\016B\350\003Z\344&B\345\003\327#NB\322\004T\343\311A\324\004\246\233"
+        "\315A\321\004)\134\332A\325\004\331\316\334A\251\004\236\357\015B\320\004\335$\032B\326\004\335$\032"
+        "B\323\004\246\233\315A\326\0045^\341AV\004\006\201\355A\322\004\335$\365A\325\004\374\251\015BT\004o"
+        "\022$B\346\003\020\330MB\326\0045^\270A\252\004\301\312\327A\323\004\331\316\334A\251\004\232\031\000"
+        "B\324\004\374\251\015B\327\004\372~\030B\321\004\311v;B\325\0045^\270A\324\0045^\341A\327\0045^\346A"
+        "T\004\014\002\357A\323\004\335$\032BV\004\232\231#BS\004!0'B\330\004y\351\345A\326\0045^\346AS\004\260"
+        "r\355A\325\004\372~\030B\253\004d; B\252\0047\011#BT\0047\011%B\327\004y\351\345A\331\004\317\367\347"
+        "AR\004\370S\356A\253\004%\006\010BS\004\035Z$BQ\004V\216$B\254\004R\270/B\332\004\337O\344A\330\004\317"
+        "\367\347AQ\004\260r\355A\254\004\246\233\016B\333\004\272I\030BP\004;_$BR\004\240\032%B\333\004\376\324"
+        "\271A\331\004\337O\344A\334\004ff\351AP\004\215\227\355A\335\004\024.\033BQ\00494%BN\004\351&&B\332\004"
+        "\376\324\271A\255\004}\077\305A\335\004\347\373\332A\254\004Z\344\017B\334\004%\206\020B\331\004\272"
+        "I\030B\256\004\000\000\077B\335\004b\020\321AN\004ff\350A\332\004ff\351A\336\004\264\310\365A\333\004"
+        "%\206\020BP\004\250F&BM\004\012\327PB\336\004\006\201\316A\334\004b\020\321A\333\004\347\373\332A\256"
+        "\004\027\331\336A\255\004\215\027\031B\332\004\024.\033B\337\004\376\324\035B\335\004\006\201\316A\337"
+        "\004\376\324\353A\266\002\256G\365A\334\004\264\310\365A\256\004w>\016B\264\002\313!%BN\004#[OB\256\004"
+        "m\347\266A\257\004\234\304\340A\336\004\376\324\353A\264\002\000\000\365A\335\004\376\324\035B\263\002"
+        "\035\332#B\266\002D\013+B\000\000\001\000\000\000\000\000M\000\000\000\000\000\005\000\001\000\000\000"
+        "T\000\000\000\000\000\005\000\006\000\000\000Z\000\000\000\000\000\001\000\002\000\003\000\004\000\005"
+        "\000\006\000\007\000\010\000\011\000\012\000DodecaRGBv2\0002.0.0\000Dodecahedron with 12 pentagon PC"
+        "Bs, 1248 LEDs\000Dodecahedron\000center\000ring0\000ring1\000"
+        ;
 };
 
 }} // namespace PixelTheater::Models
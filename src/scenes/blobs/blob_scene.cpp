@@ -5,6 +5,7 @@
 // Include standard libraries used by the implementations
 #include <vector>
 #include <memory>
+#include <new>
 #include <cmath>
 #include <algorithm>
 
@@ -36,6 +37,8 @@ void BlobScene::setup() {
     logInfo("BlobScene Parameters defined"); 
 
     BENCHMARK_RESET(); // Reset benchmark counters if used
+    buildFalloff();
+    ledIndex.indexModel(model());
     initBlobs(); // Initialize blobs after parameters are defined
     logInfo("BlobScene setup complete");
 }
@@ -50,32 +53,39 @@ void BlobScene::initBlobs() {
         
     logInfo("Creating %d blobs...", num_blobs);
     
-    blobs.clear(); // Clear any existing blobs
-    blobs.reserve(num_blobs); // Pre-allocate vector space for efficiency
+    // Blobs are the only thing in the scene arena, so start it over
+    const int capacity = std::max(num_blobs, 3); // Room for the fallback blobs too
+    arena().reset();
+    arena().reserve(sizeof(Blob) * capacity + alignof(Blob));
+    blobs = arena().allocate_uninitialized<Blob>(capacity);
+    blob_count = 0;
+    blobIndex.reserve(capacity);
+    centers.reserve(capacity);
+    neighbors.reserve(capacity);
+    if (!blobs) {
+        logError("BlobScene: no arena space for %d blobs", capacity);
+        return;
+    }
 
     for (int i = 0; i < num_blobs; i++) {
-        // Create a new Blob using unique_ptr for automatic memory management
-        auto blob = std::make_unique<Blob>(*this, i, min_radius, max_radius, max_age, speed);
+        Blob* blob = new (&blobs[blob_count++]) Blob(*this, i, min_radius, max_radius, max_age, speed);
         
         // Assign a unique color to each blob
         CHSV hsv(random8(), 255, 255);
         blob->color = hsv; // Assign CHSV, relies on CRGB(CHSV) constructor in CRGB class
-        
-        blobs.push_back(std::move(blob)); // Move ownership to the vector
     }
-    logInfo("%d Blobs created.", (int)blobs.size());
+    logInfo("%d Blobs created.", (int)blob_count);
         
     // Fallback if parameter parsing failed or resulted in zero blobs
-    if (blobs.empty() && num_blobs == 0) { 
+    if (blob_count == 0 && num_blobs == 0) { 
         logWarning("No blobs created based on parameters, creating fallback blobs.");
         num_blobs = 3; // Create a small number of fallback blobs
         for (int i = 0; i < num_blobs; i++) { 
-            auto blob = std::make_unique<Blob>(*this, i, 50, 80, 4000, 1.0f);
+            Blob* blob = new (&blobs[blob_count++]) Blob(*this, i, 50, 80, 4000, 1.0f);
             CHSV hsv(i * 85, 255, 255); // Spread hues for fallback blobs
             blob->color = hsv; 
-            blobs.push_back(std::move(blob));
         }
-        logWarning("%d Fallback blobs created.", (int)blobs.size());
+        logWarning("%d Fallback blobs created.", (int)blob_count);
     }
 }
 
@@ -107,22 +117,46 @@ void BlobScene::tick() {
 
 void BlobScene::updateBlobs() {
     // Update each blob's internal state (position, velocity, age, etc.)
-    for (auto& blob : blobs) {
-        blob->tick();
+    for (size_t i = 0; i < blob_count; ++i) {
+        blobs[i].tick();
     }
 
+    // Positions are fixed for the rest of the update, so compute each centre once
+    centers.resize(blob_count);
+    blobIndex.clear();
+    int largest_radius = 0;
+    for (size_t i = 0; i < blob_count; ++i) {
+        centers[i] = Eigen::Vector3i(blobs[i].x(), blobs[i].y(), blobs[i].z());
+        blobIndex.insert(static_cast<uint16_t>(i), centers[i].x(), centers[i].y(), centers[i].z());
+        largest_radius = std::max(largest_radius, blobs[i].radius);
+    }
+    blobIndex.build();
+    const float sphere_radius = model().getSphereRadius();
+    if (sphere_radius <= 0.0f) return; // All blobs sit at the origin, nothing to repel
+
     // Apply pairwise repulsion between blobs
     static const float forceStrength = 0.000002f; // Strength of repulsion
-    for (size_t i = 0; i < blobs.size(); ++i) {
-        for (size_t j = i + 1; j < blobs.size(); ++j) { // Avoid self-comparison and duplicate pairs
+    for (size_t i = 0; i < blob_count; ++i) {
+        // Candidates within the largest possible min_dist of blob i. The chord is turned
+        // into an angle on the sphere, widened to cover integer rounding of the centres.
+        const float max_chord = (blobs[i].radius + largest_radius) / 2.0f;
+        const float search_angle = 2.0f * std::asin(std::min(1.0f, max_chord / (2.0f * sphere_radius))) + 4.0f / sphere_radius;
+        neighbors.clear();
+        blobIndex.query(centers[i].x(), centers[i].y(), centers[i].z(), search_angle, [&](uint16_t j, float) {
+            if (j > i) neighbors.push_back(j); // Each pair once
+        });
+        // Forces are clamped as they accumulate, so keep the original pair order
+        std::sort(neighbors.begin(), neighbors.end());
+
+        for (uint16_t j : neighbors) {
             // Calculate desired minimum distance based on radii
-            float min_dist = (blobs[i]->radius + blobs[j]->radius) / 2.0f; 
+            float min_dist = (blobs[i].radius + blobs[j].radius) / 2.0f; 
             float min_dist_sq = min_dist * min_dist;
             
             // Calculate vector and squared distance between blob centers
-            float dx = static_cast<float>(blobs[i]->x() - blobs[j]->x());
-            float dy = static_cast<float>(blobs[i]->y() - blobs[j]->y());
-            float dz = static_cast<float>(blobs[i]->z() - blobs[j]->z());
+            float dx = static_cast<float>(centers[i].x() - centers[j].x());
+            float dy = static_cast<float>(centers[i].y() - centers[j].y());
+            float dz = static_cast<float>(centers[i].z() - centers[j].z());
             float dist_sq = dx*dx + dy*dy + dz*dz;
             
             // Apply repulsion only if closer than min_dist and not exactly overlapping
@@ -137,63 +171,68 @@ void BlobScene::updateBlobs() {
                 float nz = dz / dist;
                 
                 // Apply force to both blobs in opposite directions (using Cartesian force application)
-                blobs[i]->applyForce(nx * force, ny * force, nz * force);
-                blobs[j]->applyForce(-nx * force, -ny * force, -nz * force);
+                blobs[i].applyForce(nx * force, ny * force, nz * force);
+                blobs[j].applyForce(-nx * force, -ny * force, -nz * force);
             }
         }
     }
 }
 
+void BlobScene::buildFalloff() {
+    // Eased blend falloff: maps (dist/radius)^2 in [0, 1) to blend amount (100 -> 4).
+    // Each entry is sampled at the middle of its bucket.
+    for (int k = 0; k < FALLOFF_STEPS; ++k) {
+        float t = (k + 0.5f) / FALLOFF_STEPS;
+        // Invert t for falloff (1=center, 0=edge), then ease for softer edges
+        float eased_falloff = PixelTheater::Easing::outSineF(1.0f - t);
+        uint8_t blend_amount = static_cast<uint8_t>(4.0f + eased_falloff * (100.0f - 4.0f));
+        falloff[k] = std::max((uint8_t)4, std::min((uint8_t)100, blend_amount));
+    }
+}
+
 void BlobScene::drawBlobs() {
-    size_t count = ledCount();
-    // For each LED, check its proximity to each blob and blend colors
-    for (size_t i = 0; i < count; ++i) {
-        const auto& p = model().point(i); // Get the 3D position of the current LED
-        CRGB& current_led = leds[i]; // Get reference to the LED's color object
-
-        for (auto& blob : blobs) {
-            // Calculate squared distance from LED to blob center
-            auto rad_sq = blob->radius * blob->radius;
-            int dx = p.x() - blob->x();
-            int dy = p.y() - blob->y();
-            int dz = p.z() - blob->z();
+    const float sphere_radius = model().getSphereRadius();
+    if (sphere_radius <= 0.0f) return;
+
+    // Blob by blob, visiting only LEDs near each blob. Every LED still sees the
+    // blobs in the same order, so the blended result matches an LED-by-LED pass.
+    for (size_t b = 0; b < blob_count; ++b) {
+        const Blob& blob = blobs[b];
+        const Eigen::Vector3i& center = centers[b];
+        const int rad_sq = blob.radius * blob.radius;
+        if (rad_sq <= 0) continue;
+
+        CRGB blob_draw_color = blob.color;
+        // --- Eased Fade-In --- 
+        if (blob.age < FADE_IN_DURATION) { 
+            float t = static_cast<float>(blob.age) / static_cast<float>(FADE_IN_DURATION);
+            // Use a specific easing function directly
+            float progress = PixelTheater::Easing::outSineF(t);
+            uint8_t brightness = static_cast<uint8_t>(progress * 255.0f);
+            blob_draw_color.nscale8(brightness); // Apply brightness instead of fade
+        }
+        // --- End Eased Fade-In ---
+
+        // An LED within radius of a centre on the sphere lies within asin(radius / R)
+        // of it by direction, whatever its own distance from the origin. The extra
+        // 2 units cover integer rounding of the centre.
+        const float reach = (blob.radius + 2.0f) / sphere_radius;
+        const float cull_angle = reach >= 1.0f ? PixelTheater::Constants::PT_PI : std::asin(reach);
+
+        ledIndex.query(center.x(), center.y(), center.z(), cull_angle, [&](uint16_t i, float) {
+            const auto& p = model().point(i);
+            int dx = p.x() - center.x();
+            int dy = p.y() - center.y();
+            int dz = p.z() - center.z();
             int dist_sq = dx*dx + dy*dy + dz*dz;
 
             // If the LED is within the blob's radius...
             if (dist_sq < rad_sq) {
-                CRGB blob_draw_color = blob->color;
-                
-                // --- Eased Fade-In --- 
-                if (blob->age < FADE_IN_DURATION) { 
-                    float t = static_cast<float>(blob->age) / static_cast<float>(FADE_IN_DURATION);
-                    // Use a specific easing function directly
-                    float progress = PixelTheater::Easing::outSineF(t);
-                    uint8_t brightness = static_cast<uint8_t>(progress * 255.0f);
-                    blob_draw_color.nscale8(brightness); // Apply brightness instead of fade
-                }
-                // --- End Eased Fade-In ---
-                
-                // --- Eased Blend Falloff ---
-                // Map distance squared (0-rad_sq) to blend amount (100 -> 4)
-                uint8_t blend_amount = 4; // Default to minimum blend
-                if (rad_sq > 0) { // Avoid division by zero
-                    float t = static_cast<float>(dist_sq) / static_cast<float>(rad_sq);
-                    // Invert t for falloff (1=center, 0=edge), then ease
-                    float inverted_t = 1.0f - t;
-                    // Use an ease-out function for softer edges
-                    float eased_falloff = PixelTheater::Easing::outSineF(inverted_t);
-                    
-                    // Map eased falloff [0, 1] back to blend range [4, 100]
-                    blend_amount = static_cast<uint8_t>(4.0f + eased_falloff * (100.0f - 4.0f));
-                    blend_amount = std::max((uint8_t)4, std::min((uint8_t)100, blend_amount)); // Clamp just in case
-                }
-                // --- End Eased Blend Falloff ---
-                
                 // Use nblend for efficient blending of the whole color
-                nblend(current_led, blob_draw_color, blend_amount);
+                nblend(leds[i], blob_draw_color, falloff[dist_sq * FALLOFF_STEPS / rad_sq]);
             }
-        } 
+        });
     }
 }
 
-} // namespace Scenes 
\ No newline at end of file
+} // namespace Scenes
\ No newline at end of file
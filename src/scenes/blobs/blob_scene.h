@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PixelTheater/SceneKit.h" 
+#include "PixelTheater/core/sphere_hash.h"
 #include "benchmark.h"
 #include "blob.h" // Individual Blob class definition
 
@@ -25,6 +26,7 @@ public:
     static constexpr float DEFAULT_SPEED = 0.25f;
     static constexpr uint8_t DEFAULT_FADE = 8; // Reverted type to uint8_t
     static constexpr int FADE_IN_DURATION = 150; // Frames for fade-in
+    static constexpr int FALLOFF_STEPS = 256; // Resolution of the falloff table over (dist/radius)^2
     
     // Scene lifecycle methods (Declarations only)
     void setup() override;
@@ -39,7 +41,15 @@ public:
     friend class Blob;
 
 private:
-    std::vector<std::unique_ptr<Blob>> blobs;
+    Blob* blobs = nullptr;                    // blob_count Blobs in the scene arena
+    size_t blob_count = 0;
+    std::vector<Eigen::Vector3i> centers;     // Blob centres for this tick (as Blob::x/y/z)
+    std::vector<uint16_t> neighbors;          // Scratch list of repulsion partners
+    PixelTheater::SphereHash<> blobIndex;     // Blob centres, rebuilt every tick
+    PixelTheater::SphereHash<> ledIndex;      // LED directions, built once in setup()
+    uint8_t falloff[FALLOFF_STEPS];           // Blend amount by (dist/radius)^2, see buildFalloff()
+
+    void buildFalloff();
 };
 
 // Implementations moved to blob_scene.cpp
@@ -1,5 +1,5 @@
 #include "boids_scene.h"
-#include <memory> // For std::make_unique
+#include <new> // Placement new into the scene arena
 #include <cmath> // For std::clamp, std::sqrt, std::acos
 #include <cstdio>
 #include "PixelTheater/SceneKit.h"
@@ -16,12 +16,13 @@ void BoidsScene::setup() {
     set_description("Flocking simulation on a sphere");
     set_version("2.1");
     set_author("PixelTheater Team (Refactored)");
+    set_retain_state(true); // initBoids() allocates every boid; keep the flock across switches
 
     // Estimate radius based on model
     // estimateSphereRadius(); // Removed call
 
     // Define parameters using the base class method
-    param("num_boids", "count", 10, 200, DEFAULT_NUM_BOIDS, "clamp", "Number of boids");
+    param("num_boids", "count", 10, MAX_NUM_BOIDS, DEFAULT_NUM_BOIDS, "clamp", "Number of boids");
     param("visual_range", "range", 0.1f, 2.0f, DEFAULT_VISUAL_RANGE, "clamp", "Boid sight distance (radians)");
     param("protected_range", "range", 0.05f, 1.0f, DEFAULT_PROTECTED_RANGE, "clamp", "Min distance between boids (radians)");
     param("centering_factor", "range", 0.0f, 1.0f, DEFAULT_CENTERING_FACTOR, "clamp", "Flock centering strength");
@@ -32,46 +33,53 @@ void BoidsScene::setup() {
     param("chaos", "range", 0.0f, 1.0f, DEFAULT_CHAOS, "clamp", "Probability of random movement");
     param("intensity", "range", 0.1f, 1.0f, DEFAULT_INTENSITY, "clamp", "LED brightness multiplier");
 
+    // Fewer boids when frames run long: all of them, 3/4, 1/2 or 1/4
+    boids_knob = quality_knob("boids", 4);
+
+    ledIndex.indexModel(model());
     initBoids(); // Call initialization after params are set
 }
 
 void BoidsScene::initBoids() {
-    logInfo("BoidsScene::initBoids() called");
-    boids.clear(); // Clear existing boids if any
     int num_boids_setting = settings["num_boids"]; 
-
-    char log_buffer[128]; 
-    snprintf(log_buffer, sizeof(log_buffer), "  Retrieved 'num_boids' setting: %d", (int)num_boids_setting);
-    logInfo(log_buffer); 
+    logDebug("BoidsScene::initBoids(): num_boids setting %d", num_boids_setting);
 
     float speed_limit_setting = settings["speed_limit"];
     float chaos_setting = settings["chaos"];
 
-    bool defaulted = false;
-    if (num_boids_setting <= 0 || num_boids_setting > 1000) { 
-        snprintf(log_buffer, sizeof(log_buffer), "Invalid number of boids retrieved from settings: %d. Defaulting to %d", 
-                 (int)num_boids_setting, DEFAULT_NUM_BOIDS);
-        logError(log_buffer);
+    if (num_boids_setting <= 0 || num_boids_setting > MAX_NUM_BOIDS) { 
+        logError("Invalid number of boids retrieved from settings: %d. Defaulting to %d",
+                 num_boids_setting, DEFAULT_NUM_BOIDS);
         num_boids_setting = DEFAULT_NUM_BOIDS;
-        defaulted = true;
     }
-    snprintf(log_buffer, sizeof(log_buffer), "  Value after safety check: %d %s", (int)num_boids_setting, defaulted ? "(defaulted)" : "");
-    logInfo(log_buffer);
 
-    boids.reserve(num_boids_setting);
+    // The flock is the only thing in the scene arena, so start it over. The
+    // block is reused unless the flock grows past it.
+    arena().reset();
+    arena().reserve(sizeof(Boid) * num_boids_setting + alignof(Boid));
+    boids = arena().allocate_uninitialized<Boid>(num_boids_setting);
+    boid_count = 0;
+    boid_capacity = 0;
+    steering.assign(num_boids_setting, Vector3f::Zero());
+    neighborIndex.reserve(num_boids_setting);
+    if (!boids) {
+        logError("BoidsScene: no arena space for %d boids", num_boids_setting);
+        return;
+    }
     for (int i = 0; i < num_boids_setting; ++i) {
-        auto boid = std::make_unique<Boid>(*this, i, speed_limit_setting, chaos_setting);
+        Boid* boid = new (&boids[boid_count++]) Boid(*this, i, speed_limit_setting, chaos_setting);
         uint8_t palette_index = i * 255 / num_boids_setting;
         boid->color = colorFromPalette(PixelTheater::Palettes::OceanColors, palette_index);
-        boids.push_back(std::move(boid));
     }
 
+    boid_capacity = boid_count;
+    boid_count = quality_scale(boids_knob, boid_capacity, boid_capacity / 4);
+
     last_num_boids = num_boids_setting;
     last_speed_limit = speed_limit_setting;
     last_chaos_factor = chaos_setting;
 
-    snprintf(log_buffer, sizeof(log_buffer), "BoidsScene::initBoids() complete, created %d boids", (int)num_boids_setting);
-    logInfo(log_buffer);
+    logInfo("BoidsScene::initBoids() complete, created %d boids", num_boids_setting);
 }
 
 void BoidsScene::tick() {
@@ -88,21 +96,25 @@ void BoidsScene::tick() {
     } else {
         if (current_speed_limit != last_speed_limit) {
             logInfo("speed_limit changed (%.2f -> %.2f), updating boids.", last_speed_limit, current_speed_limit);
-            for (auto& boid : boids) {
-                boid->max_speed = current_speed_limit;
+            for (size_t i = 0; i < boid_capacity; ++i) {
+                boids[i].max_speed = current_speed_limit;
             }
             last_speed_limit = current_speed_limit;
         }
         if (current_chaos_factor != last_chaos_factor) {
              logInfo("chaos_factor changed (%.2f -> %.2f), updating boids.", last_chaos_factor, current_chaos_factor);
-            for (auto& boid : boids) {
-                boid->chaos_factor = current_chaos_factor;
+            for (size_t i = 0; i < boid_capacity; ++i) {
+                boids[i].chaos_factor = current_chaos_factor;
             }
             last_chaos_factor = current_chaos_factor;
         }
     }
     // --- End parameter change check ---
 
+    // Boids left out by the quality governor stay where they are, and rejoin
+    // the flock from there when quality comes back up
+    boid_count = quality_scale(boids_knob, boid_capacity, boid_capacity / 4);
+
     uint8_t fade_amount = settings["fade"];
 
     size_t count = ledCount();
@@ -110,26 +122,51 @@ void BoidsScene::tick() {
         leds[i].fadeToBlackBy(fade_amount); 
     }
 
+    BENCHMARK_START("boid_index");
+    rebuildNeighborIndex();
+    BENCHMARK_END();
+
+    const float visual_range_rad = settings["visual_range"];
+    const float protected_range_rad = settings["protected_range"];
+    const FlockSettings flock{
+        std::cos(visual_range_rad),
+        std::cos(protected_range_rad),
+        settings["centering_factor"],
+        settings["avoid_factor"],
+        settings["matching_factor"],
+        PixelTheater::SphereHash<>::Radius(visual_range_rad)
+    };
+
     BENCHMARK_START("boid_update");
-    for (auto& boid : boids) {
-        updateBoid(*boid); // Calculate forces
-        boid->tick();      // Apply velocity, constrain
+    // Forces are computed from this frame's positions before any boid moves,
+    // so the result does not depend on update order
+    for (size_t i = 0; i < boid_count; ++i) {
+        steering[i] = updateBoid(i, flock);
+    }
+    for (size_t i = 0; i < boid_count; ++i) {
+        boids[i].applyForce(steering[i]);
+        boids[i].tick(); // Apply velocity, constrain
     }
     BENCHMARK_END();
 
     BENCHMARK_START("boid_draw");
-    for (const auto& boid : boids) {
-        drawBoid(*boid);
+    for (size_t i = 0; i < boid_count; ++i) {
+        drawBoid(boids[i]);
     }
     BENCHMARK_END();
 }
 
-void BoidsScene::updateBoid(Boid& boid) {
-    float visual_range_rad = settings["visual_range"];
-    float protected_range_rad = settings["protected_range"];
-    float centering_factor = settings["centering_factor"];
-    float avoid_factor = settings["avoid_factor"];
-    float matching_factor = settings["matching_factor"];
+void BoidsScene::rebuildNeighborIndex() {
+    neighborIndex.clear();
+    for (size_t i = 0; i < boid_count; ++i) {
+        const Vector3f& pos = boids[i].pos;
+        neighborIndex.insert(static_cast<uint16_t>(i), pos.x(), pos.y(), pos.z());
+    }
+    neighborIndex.build();
+}
+
+Vector3f BoidsScene::updateBoid(size_t index, const FlockSettings& flock) const {
+    const Boid& boid = boids[index];
 
     Vector3f total_separation_force = Vector3f::Zero(); 
     Vector3f alignment_force = Vector3f::Zero(); 
@@ -139,60 +176,45 @@ void BoidsScene::updateBoid(Boid& boid) {
     Vector3f average_velocity = Vector3f::Zero();
     int visual_neighbors = 0;
 
-    for (const auto& other_boid_ptr : boids) {
-        const Boid& other_boid = *other_boid_ptr;
-        if (&boid == &other_boid) continue; 
-
-        float dist_rad = sphericalDistance(boid, other_boid);
+    // Only boids within visual range are visited; dot is the cosine of their angular distance
+    neighborIndex.query(boid.pos.x(), boid.pos.y(), boid.pos.z(), flock.visual_range, [&](uint16_t id, float dot) {
+        if (id == index || dot <= flock.cos_visual_range) return;
+        const Boid& other_boid = boids[id];
 
-        if (dist_rad < visual_range_rad) {
-            visual_neighbors++;
-            center_of_mass += other_boid.pos;
-            average_velocity += other_boid.vel;
+        visual_neighbors++;
+        center_of_mass += other_boid.pos;
+        average_velocity += other_boid.vel;
 
-            if (dist_rad < protected_range_rad && dist_rad > 1e-6f) {
+        if (dot > flock.cos_protected_range) {
+            float dist_rad = std::acos(std::min(dot, 1.0f));
+            if (dist_rad > 1e-6f) {
                 Vector3f away_vec = boid.pos - other_boid.pos;
-                total_separation_force += (away_vec.normalized() / dist_rad) * avoid_factor;
+                total_separation_force += (away_vec.normalized() / dist_rad) * flock.avoid_factor;
             }
         }
-    }
+    });
 
     if (visual_neighbors > 0) {
         average_velocity /= visual_neighbors;
-        alignment_force = (average_velocity - boid.vel) * matching_factor;
+        alignment_force = (average_velocity - boid.vel) * flock.matching_factor;
 
         center_of_mass /= visual_neighbors;
-        cohesion_force = (center_of_mass - boid.pos) * centering_factor;
+        cohesion_force = (center_of_mass - boid.pos) * flock.centering_factor;
     }
 
-    Vector3f total_force = total_separation_force + alignment_force + cohesion_force;
-    boid.applyForce(total_force);
+    return total_separation_force + alignment_force + cohesion_force;
 }
 
 void BoidsScene::drawBoid(const Boid& boid) {
-    float min_dist_sq = 1e18f; 
-    int closest_led_index = -1;
     size_t num_leds = this->ledCount(); 
 
-    char log_buffer[128]; 
-
     if (num_leds == 0) {
         logError("BoidsScene::drawBoid: Cannot draw, ledCount() is zero.");
         return; 
     }
 
-    for (size_t i = 0; i < num_leds; ++i) {
-        const auto& point = this->model().point(i); 
-        float dx = point.x() - boid.pos.x();
-        float dy = point.y() - boid.pos.y();
-        float dz = point.z() - boid.pos.z();
-        float dist_sq = dx * dx + dy * dy + dz * dz;
-
-        if (dist_sq < min_dist_sq) {
-            min_dist_sq = dist_sq;
-            closest_led_index = static_cast<int>(i);
-        }
-    }
+    // Nearest LED by direction (boids live on the sphere surface)
+    int closest_led_index = ledIndex.nearest(boid.pos.x(), boid.pos.y(), boid.pos.z());
 
     if (closest_led_index >= 0 && static_cast<size_t>(closest_led_index) < num_leds) {
         float intensity_setting = settings["intensity"]; 
@@ -200,27 +222,18 @@ void BoidsScene::drawBoid(const Boid& boid) {
         PixelTheater::nblend(leds[closest_led_index], boid.color, blend_amount); 
     } else {
         if (closest_led_index >= static_cast<int>(num_leds)) { 
-            snprintf(log_buffer, sizeof(log_buffer), "BoidsScene::drawBoid: Closest LED index %d out of bounds (%zu)", closest_led_index, num_leds);
-            logError(log_buffer);
+            logError("BoidsScene::drawBoid: Closest LED index %d out of bounds (%zu)", closest_led_index, num_leds);
         } else { 
-            snprintf(log_buffer, sizeof(log_buffer), "BoidsScene::drawBoid: Could not find closest LED for boid %u", boid.boid_id);
-            logError(log_buffer);
+            logError("BoidsScene::drawBoid: Could not find closest LED for boid %u", boid.boid_id);
         }
     }
 }
 
-float BoidsScene::sphericalDistance(const Boid& b1, const Boid& b2) const {
-    Vector3f dir1 = b1.pos.normalized();
-    Vector3f dir2 = b2.pos.normalized();
-    float dot = std::clamp(dir1.dot(dir2), -1.0f, 1.0f);
-    return acos(dot); 
-}
-
 std::string BoidsScene::status() const {
     // Provide a basic status, maybe add more detail later
     char buffer[128];
     snprintf(buffer, sizeof(buffer), "Boids: %zu | Chaos: %.2f | SpeedL: %.1f", 
-            boids.size(), 
+            boid_count, 
             static_cast<float>(settings["chaos"]), // Get current chaos param
             static_cast<float>(settings["speed_limit"])
             );
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PixelTheater/SceneKit.h"
+#include "PixelTheater/core/sphere_hash.h"
 #include "benchmark.h"
 
 #include <vector>
@@ -29,6 +30,7 @@ public:
     // float sphere_radius = 300.0f; // Removed - Use model().getSphereRadius()
 
     // Define default values used in setup()
+    static constexpr int MAX_NUM_BOIDS = 2000;
     static constexpr int DEFAULT_NUM_BOIDS = 80;
     static constexpr float DEFAULT_VISUAL_RANGE = 0.40f;
     static constexpr float DEFAULT_PROTECTED_RANGE = 0.35f;
@@ -41,7 +43,23 @@ public:
     static constexpr float DEFAULT_INTENSITY = 0.60f;
 
 private:
-    std::vector<std::unique_ptr<Boid>> boids;
+    // Flocking settings read once per tick rather than once per boid
+    struct FlockSettings {
+        float cos_visual_range;
+        float cos_protected_range;
+        float centering_factor;
+        float avoid_factor;
+        float matching_factor;
+        PixelTheater::SphereHash<>::Radius visual_range;
+    };
+
+    Boid* boids = nullptr;                      // boid_capacity Boids in the scene arena
+    size_t boid_capacity = 0;                   // Boids built for the num_boids setting
+    size_t boid_count = 0;                      // Boids flying: fewer at lower quality
+    size_t boids_knob = PixelTheater::QualityKnobs::NONE;
+    std::vector<Vector3f> steering;             // Per-boid force, computed before any boid moves
+    PixelTheater::SphereHash<> neighborIndex;   // Boid positions, rebuilt every tick
+    PixelTheater::SphereHash<> ledIndex;        // LED directions, built once in setup()
 
     // Add members to store last used parameter values
     int last_num_boids = -1; // Initialize to ensure first check triggers update
@@ -50,9 +68,9 @@ private:
 
     // Helper methods - declarations only
     void initBoids();
-    void updateBoid(Boid& boid);
+    void rebuildNeighborIndex();
+    Vector3f updateBoid(size_t index, const FlockSettings& flock) const;
     void drawBoid(const Boid& boid);
-    float sphericalDistance(const Boid& b1, const Boid& b2) const;
 
     friend class Boid; // Allow Boid to access Scene members
 
@@ -118,7 +136,7 @@ inline void Boid::reset() {
     setRandomTimer();
 
     // Use model().getSphereRadius() instead of scene.sphere_radius
-    scene.logInfo("Boid %d reset: Using radius %.2f", boid_id, scene.model().getSphereRadius()); 
+    scene.logDebug("Boid %d reset: Using radius %.2f", boid_id, scene.model().getSphereRadius()); 
 
     Vector3f random_dir(scene.getRandomFloat(-1.0f, 1.0f), scene.getRandomFloat(-1.0f, 1.0f), scene.getRandomFloat(-1.0f, 1.0f));
     if (random_dir.norm() > 1e-6f) { 
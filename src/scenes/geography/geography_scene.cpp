@@ -55,6 +55,11 @@ void GeographyScene::setup() {
     spin_y = 0.0f;
     spin_z = 0.0f;
 
+    // Palettes to use, expanded to 256 entries once
+    palette1.build(PixelTheater::Palettes::RainbowColors);
+    palette2.build(PixelTheater::Palettes::OceanColors);
+    palette3.build(PixelTheater::Palettes::LavaColors);
+
     // Estimate model radius based on points - REMOVED
     // float max_r_sq = 0.0f;
     // for(size_t i=0; i < model().pointCount(); ++i) {
@@ -153,10 +158,6 @@ void GeographyScene::tick() {
     gradient_axis2 = rot_z_mat * axis_y;
     gradient_axis3 = rot_x_mat * axis_z;
 
-    // Define palettes to use
-    const auto& palette1 = PixelTheater::Palettes::RainbowColors;
-    const auto& palette2 = PixelTheater::Palettes::OceanColors;
-    const auto& palette3 = PixelTheater::Palettes::LavaColors;
     uint8_t dimming_factor = static_cast<uint8_t>((float)settings["dimming"] * 255.0f);
 
     for (size_t i = 0; i < ledCount(); i++) {
@@ -175,9 +176,9 @@ void GeographyScene::tick() {
         uint8_t index3 = static_cast<uint8_t>(PixelTheater::map(dot3, -radius, radius, 0.0f, 255.0f));
 
         // Get colors from the palettes
-        PixelTheater::CRGB color1 = PixelTheater::colorFromPalette(palette1, index1);
-        PixelTheater::CRGB color2 = PixelTheater::colorFromPalette(palette2, index2);
-        PixelTheater::CRGB color3 = PixelTheater::colorFromPalette(palette3, index3);
+        PixelTheater::CRGB color1 = palette1[index1];
+        PixelTheater::CRGB color2 = palette2[index2];
+        PixelTheater::CRGB color3 = palette3[index3];
 
         // Blend the colors using nblend for less saturation
         PixelTheater::CRGB final_color = color1.fadeToBlackBy(128);
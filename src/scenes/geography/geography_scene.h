@@ -45,6 +45,11 @@ private:
     float spin_y = 0.0f;
     float spin_z = 0.0f;
 
+    // Expanded once in setup(), looked up per LED
+    PixelTheater::Palette256 palette1;
+    PixelTheater::Palette256 palette2;
+    PixelTheater::Palette256 palette3;
+
     // Helper for Lorenz calculation
     void updateLorenz();
 };
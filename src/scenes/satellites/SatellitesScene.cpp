@@ -25,6 +25,7 @@ const float SatellitesScene::SPARK_BASE_SPEED = 30.0f;
 const float SatellitesScene::MIN_SPARK_LIFETIME = 1.4f;
 const float SatellitesScene::MAX_SPARK_LIFETIME = 2.5f;
 const uint8_t SatellitesScene::SPARK_BLEND_AMOUNT = 230;
+const float SatellitesScene::SPARK_SEARCH_ANGLE = 0.1f; // About the LED spacing; nearest() widens the search if needed
 
 // Global speed factor
 const float TIME_SCALE_FACTOR = 0.8f; 
@@ -34,19 +35,29 @@ void SatellitesScene::setup() {
     set_description("Satellites orbiting on the surface, crashing on collision.");
 
     // Simplified Parameters
-    param("population", "count", 1, 200, 30);
+    param("population", "count", 1, MAX_POPULATION, 30);
     param("speed", "range", 0.1f, 5.0f, 1.6f); // Scales base angular speed
     param("chaos", "ratio", 0.0f, 1.0f, 0.15f); // How much orbits are perturbed
     param("trails", "ratio", 0.5f); // Fade amount (higher = less fade)
     param("render_radius", "range", 0.01f, 0.3f, 0.080f); // Satellite head angular size
     param("blur", "ratio", 0.0f, 1.0f, 0.0f); // Post-process spatial blur
 
+    // The blur pass is the first thing to go when frames run long
+    blurKnob = quality_knob("blur");
+
     // Init satellites (Dead with random timers)
     int population = settings["population"];
     satellites.resize(population);
+    orbitIndex.reserve(population);
     for (auto& sat : satellites) {
         sat.timer = randomFloat(0.0f, SPAWN_DURATION + RESPAWN_DELAY);
     }
+
+    sparks.clear();
+    ledIndex.indexModel(model());
+
+    // Blur towards the neighbour mean; the stack keeps its scratch buffer
+    blurStage = post_process().addBlur(0.0f);
 }
 
 void SatellitesScene::tick() {
@@ -59,7 +70,10 @@ void SatellitesScene::tick() {
     // Read relevant settings once per tick
     const float chaosSetting = static_cast<float>(settings["chaos"]);
     const uint8_t fadeAmount = static_cast<uint8_t>(static_cast<float>(settings["trails"]) * MAX_FADE_AMOUNT);
-    const float blurAmount = settings["blur"];
+    const float blurSetting = static_cast<float>(settings["blur"]);
+    // Blur off (the default): its knob has nothing to give, so the governor skips it
+    quality_knobs().setActive(blurKnob, blurSetting > 0.0f);
+    const float blurAmount = quality_full(blurKnob) ? blurSetting : 0.0f;
     // 1. Apply fade effect
     BENCHMARK_START("fade_leds");
     if (fadeAmount > 0) {
@@ -93,98 +107,34 @@ void SatellitesScene::tick() {
 
     // 5. Update and Render Spark Particles
     BENCHMARK_START("update_render_sparks");
-    float renderAngleSpark = static_cast<float>(settings["render_radius"]) * 0.5f; 
     CRGB finalSparkColor = CRGB::Yellow;
-    // const float SPARK_DAMAGE_PROXIMITY_SQ = SPARK_DAMAGE_PROXIMITY * SPARK_DAMAGE_PROXIMITY; // Removed - Constant and logic removed
-
-    // Iterate backwards for safe removal
-    for (int i = sparkParticles.size() - 1; i >= 0; --i) {
-        auto& spark = sparkParticles[i];
-        spark.lifetime -= dt;
-        if (spark.lifetime <= 0) {
-            sparkParticles.erase(sparkParticles.begin() + i);
-            continue; 
-        }
-        spark.position += spark.velocity * dt;
+    sparks.update(dt); // Ages, drifts and swap-removes dead sparks
 
+    for (uint16_t i = 0; i < sparks.size(); ++i) {
         // Update color (Red to Yellow fade)
         float fadeProgress = 0.0f;
-        if (spark.initialLifetime > 1e-6f) { 
-             fadeProgress = std::max(0.0f, spark.lifetime / spark.initialLifetime);
-        }
-        spark.color = blend(finalSparkColor, CRGB::Red, static_cast<uint8_t>(fadeProgress * 255.0f));
-
-        // Render the spark (Optimized: Find single closest LED)
-        float minDistSq = 1e18f; // Initialize with a large value
-        int closestLedIndex = -1;
-        size_t numLeds = ledCount();
-
-        for (size_t led_idx = 0; led_idx < numLeds; ++led_idx) {
-            const auto& p = model().point(led_idx);
-            float dx = p.x() - spark.position.x();
-            float dy = p.y() - spark.position.y();
-            float dz = p.z() - spark.position.z();
-            float distSq = dx * dx + dy * dy + dz * dz;
-
-            if (distSq < minDistSq) {
-                minDistSq = distSq;
-                closestLedIndex = static_cast<int>(led_idx);
-            }
+        if (sparks.max_life[i] > 1e-6f) {
+             fadeProgress = std::max(0.0f, sparks.life[i] / sparks.max_life[i]);
         }
+        sparks.color[i] = blend(finalSparkColor, CRGB::Red, static_cast<uint8_t>(fadeProgress * 255.0f));
+
+        // Render to the single closest LED (by direction) from the LED index
+        int closestLedIndex = ledIndex.nearest(sparks.x[i], sparks.y[i], sparks.z[i], SPARK_SEARCH_ANGLE);
 
-        // Render to the closest LED found
         if (closestLedIndex >= 0) {
             // Simple blend, maybe adjust amount based on distance later if needed
             uint8_t blendAmount = 180; // Strong blend for the single spark point
-            nblend(leds[closestLedIndex], spark.color, blendAmount);
+            nblend(leds[closestLedIndex], sparks.color[i], blendAmount);
         }
     }
     BENCHMARK_END(); // End update_render_sparks
     
-    // 6. Apply Spatial Blur
-    BENCHMARK_START("spatial_blur");
-    if (blurAmount > 1e-3f && ledCount() > 0) { 
-        uint8_t blurAmountInt = static_cast<uint8_t>(blurAmount * 255.0f);
-
-        // Create a temporary copy of the LED buffer
-        // Correct way to copy from LedsProxy
-        std::vector<CRGB> leds_copy(ledCount()); // Create vector of the right size
-        for (size_t k=0; k < ledCount(); ++k) { // Copy element by element
-            leds_copy[k] = leds[k];
-        }
-
-        for (size_t i = 0; i < ledCount(); ++i) {
-            const auto& neighbors = model().point(i).getNeighbors();
-            uint8_t neighbor_count = 0;
-            uint32_t avg_r = 0, avg_g = 0, avg_b = 0;
-
-            // Calculate average neighbor color from the copy
-            // Iterate through the fixed-size neighbor array
-            for (const auto& neighbor_info : neighbors) {
-                // Check if neighbor ID is valid (within bounds)
-                // Assuming neighbor_info.id is set to an invalid value (e.g. >= ledCount() or a specific const)
-                // if ID is invalid. Let's just check bounds.
-                if (neighbor_info.id < ledCount()) {
-                    avg_r += leds_copy[neighbor_info.id].r;
-                    avg_g += leds_copy[neighbor_info.id].g;
-                    avg_b += leds_copy[neighbor_info.id].b;
-                    neighbor_count++;
-                }
-            }
-
-            if (neighbor_count > 0) {
-                CRGB avgNeighborColor(
-                    static_cast<uint8_t>(avg_r / neighbor_count),
-                    static_cast<uint8_t>(avg_g / neighbor_count),
-                    static_cast<uint8_t>(avg_b / neighbor_count)
-                );
-                // Blend the *original* LED color towards the neighbor average
-                nblend(leds[i], avgNeighborColor, blurAmountInt);
-            }
-        }
+    // 6. Spatial blur runs after tick() in the post-processing stack
+    PixelTheater::PostProcess::Stage* blur = post_process().stage(blurStage);
+    if (blur) {
+        blur->amount = blurAmount;
+        blur->enabled = blurAmount > 1e-3f;
     }
-    BENCHMARK_END(); // End spatial_blur
-    // --- End Spatial Blur ---
 
     BENCHMARK_END(); // End scene_total
 }
@@ -294,64 +244,79 @@ void SatellitesScene::applySatelliteInteractions(float chaosSetting) {
     if (satellites.size() <= 1) return;
     const float collisionProximitySq = COLLISION_PROXIMITY * COLLISION_PROXIMITY; 
 
+    // Only orbiting satellites can collide, and they all sit on the orbital sphere,
+    // so the proximity distance is a fixed angle (plus a little slack for rounding)
+    orbitIndex.clear();
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        const auto& sat = satellites[i];
+        if (sat.state != Satellite::State::Orbiting) continue;
+        orbitIndex.insert(static_cast<uint16_t>(i), sat.position.x(), sat.position.y(), sat.position.z());
+    }
+    orbitIndex.build();
+    const PixelTheater::SphereHash<>::Radius collisionAngle(
+        2.0f * std::asin(std::min(1.0f, COLLISION_PROXIMITY / (2.0f * BASE_ORBITAL_RADIUS))) + 0.01f);
+
     for (size_t i = 0; i < satellites.size(); ++i) {
         auto& sat1 = satellites[i];
         // Skip if not in a state to collide
         if (sat1.state == Satellite::State::Dead || sat1.state == Satellite::State::Spawning || sat1.state == Satellite::State::Crashing) continue;
         
-        for (size_t j = i + 1; j < satellites.size(); ++j) {
-            auto& sat2 = satellites[j];
-            if (sat2.state == Satellite::State::Dead || sat2.state == Satellite::State::Spawning || sat2.state == Satellite::State::Crashing) continue;
-            
-            Eigen::Vector3f diff = sat2.position - sat1.position;
-            float distanceSq = diff.squaredNorm();
-
-            if (distanceSq < collisionProximitySq) {
-                // Collision detected!
-                Eigen::Vector3f impactPoint = sat1.position + diff * 0.5f;
-                
-                // Create Spark Particles
-                int numSparks = random(MIN_SPARKS_PER_COLLISION, MAX_SPARKS_PER_COLLISION + 1);
-                float sparkLifetimeBase = randomFloat(MIN_SPARK_LIFETIME, MAX_SPARK_LIFETIME);
-                for (int k = 0; k < numSparks; ++k) {
-                    SparkParticle spark;
-                    spark.position = impactPoint;
-                    // Eject sparks: Generate unique random direction for EACH spark
-                    Eigen::Vector3f randomDir( // Initialize components directly
-                        randomFloat(-1.0f, 1.0f),
-                        randomFloat(-1.0f, 1.0f),
-                        randomFloat(-1.0f, 1.0f)
-                    );
-                    // Ensure non-zero vector before normalizing
-                     if (randomDir.squaredNorm() < 1e-6f) {
-                         randomDir.x() = 1.0f; 
-                     }
-                     randomDir.normalize(); // Normalize after creation
-                     
-                    // Set velocity to a slow drift in its unique random direction
-                    spark.velocity = randomDir * SPARK_BASE_SPEED;
-                    spark.lifetime = sparkLifetimeBase * randomFloat(0.8f, 1.2f); 
-                    spark.initialLifetime = spark.lifetime; 
-                    spark.color = CRGB::Red;
-                    sparkParticles.push_back(spark); 
-                }
-                
-                // --- Reduce Speed on Impact --- 
-                const float impactSpeedReductionFactor = 0.3f; // Reduce speed to 30%
-                sat1.angularSpeed *= impactSpeedReductionFactor * randomFloat(0.8f, 1.2f); // Add some randomness
-                sat2.angularSpeed *= impactSpeedReductionFactor * randomFloat(0.8f, 1.2f);
-                // --- End Speed Reduction ---
-
-                // Set both to CRASHING state
-                sat1.state = Satellite::State::Crashing;
-                sat1.timer = CRASH_DURATION + randomFloat(0.0f, 1.5f);
-                sat2.state = Satellite::State::Crashing;
-                sat2.timer = CRASH_DURATION + randomFloat(0.0f, 1.5f);
-                
-                // Break inner loop once sat1 is crashing
-                break; 
-            }
+        // Collide with the lowest-index nearby partner, as a scan over j > i would
+        size_t partner = satellites.size();
+        orbitIndex.query(sat1.position.x(), sat1.position.y(), sat1.position.z(), collisionAngle, [&](uint16_t j, float) {
+            if (j <= i || j >= partner) return;
+            const auto& sat2 = satellites[j];
+            if (sat2.state != Satellite::State::Orbiting) return; // May have crashed earlier this tick
+            if ((sat2.position - sat1.position).squaredNorm() < collisionProximitySq) partner = j;
+        });
+
+        if (partner == satellites.size()) continue;
+        auto& sat2 = satellites[partner];
+
+        // Collision detected!
+        Eigen::Vector3f diff = sat2.position - sat1.position;
+        Eigen::Vector3f impactPoint = sat1.position + diff * 0.5f;
+        
+        // Create Spark Particles
+        int numSparks = random(MIN_SPARKS_PER_COLLISION, MAX_SPARKS_PER_COLLISION + 1);
+        float sparkLifetimeBase = randomFloat(MIN_SPARK_LIFETIME, MAX_SPARK_LIFETIME);
+        for (int k = 0; k < numSparks; ++k) {
+            PixelTheater::ParticleSpawn spark;
+            spark.x = impactPoint.x();
+            spark.y = impactPoint.y();
+            spark.z = impactPoint.z();
+            // Eject sparks: Generate unique random direction for EACH spark
+            Eigen::Vector3f randomDir( // Initialize components directly
+                randomFloat(-1.0f, 1.0f),
+                randomFloat(-1.0f, 1.0f),
+                randomFloat(-1.0f, 1.0f)
+            );
+            // Ensure non-zero vector before normalizing
+             if (randomDir.squaredNorm() < 1e-6f) {
+                 randomDir.x() = 1.0f; 
+             }
+             randomDir.normalize(); // Normalize after creation
+             
+            // Set velocity to a slow drift in its unique random direction
+            spark.vx = randomDir.x() * SPARK_BASE_SPEED;
+            spark.vy = randomDir.y() * SPARK_BASE_SPEED;
+            spark.vz = randomDir.z() * SPARK_BASE_SPEED;
+            spark.life = sparkLifetimeBase * randomFloat(0.8f, 1.2f);
+            spark.color = CRGB::Red;
+            sparks.spawn(spark); // Dropped if the pool is full
         }
+        
+        // --- Reduce Speed on Impact --- 
+        const float impactSpeedReductionFactor = 0.3f; // Reduce speed to 30%
+        sat1.angularSpeed *= impactSpeedReductionFactor * randomFloat(0.8f, 1.2f); // Add some randomness
+        sat2.angularSpeed *= impactSpeedReductionFactor * randomFloat(0.8f, 1.2f);
+        // --- End Speed Reduction ---
+
+        // Set both to CRASHING state
+        sat1.state = Satellite::State::Crashing;
+        sat1.timer = CRASH_DURATION + randomFloat(0.0f, 1.5f);
+        sat2.state = Satellite::State::Crashing;
+        sat2.timer = CRASH_DURATION + randomFloat(0.0f, 1.5f);
     }
 }
 
@@ -362,6 +327,7 @@ void SatellitesScene::renderSatellites() {
     float renderAngle = settings["render_radius"];
     const uint8_t MIN_BLEND_AMOUNT_HEAD = 4; 
     const float cosRenderAngle = std::cos(std::min(static_cast<float>(M_PI - 1e-4), renderAngle));
+    const PixelTheater::SphereHash<>::Radius renderRadius(renderAngle);
     // BENCHMARK_END(); // End render_sat_setup
 
     // BENCHMARK_START("render_sat_head"); // Combine head/tail benchmarks
@@ -388,12 +354,9 @@ void SatellitesScene::renderSatellites() {
 
         // Render Head (Angular)
         if (sat.position.squaredNorm() < 1e-6f) continue;
-        Eigen::Vector3f satDir = sat.position.normalized();
 
-        for (size_t i = 0; i < numLeds; ++i) {
-            const auto& p = model().point(i);
-            Eigen::Vector3f ledDir = Eigen::Vector3f(p.x(), p.y(), p.z()).normalized();
-            float dot = satDir.dot(ledDir);
+        // Visit only the LEDs within the render angle
+        ledIndex.query(sat.position.x(), sat.position.y(), sat.position.z(), renderRadius, [&](uint16_t i, float dot) {
             if (dot > cosRenderAngle && dot <= 1.0f) {
                 float falloff = 0.0f;
                 float denominator = 1.0f - cosRenderAngle;
@@ -407,7 +370,7 @@ void SatellitesScene::renderSatellites() {
                 uint8_t blendAmount = static_cast<uint8_t>(MIN_BLEND_AMOUNT_HEAD + falloff * (255.0f - MIN_BLEND_AMOUNT_HEAD));
                 nblend(leds[i], finalSatColor, blendAmount);
             }
-        }
+        });
         // Tail rendering removed for simplicity
     } // End satellite loop
     // BENCHMARK_END(); // End render_sat_head
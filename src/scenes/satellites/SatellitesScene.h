@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PixelTheater/SceneKit.h"
+#include "PixelTheater/particles/particle_system.h"
 #include <vector>
 // #include <Eigen/Core> // Removed: Eigen is included via SceneKit.h -> math.h
 
@@ -44,18 +45,15 @@ private:
         uint32_t uniqueId = 0;          // Unique identifier
     };
 
-    // --- Add Spark Particle Struct ---
-    struct SparkParticle {
-        Eigen::Vector3f position;
-        Eigen::Vector3f velocity;
-        CRGB color;
-        float lifetime; // Remaining time in seconds
-        float initialLifetime; // Initial lifetime for calculations
-    };
-    // --- End Spark Particle Struct ---
+    static constexpr uint16_t MAX_SPARKS = 256;
+    static constexpr int MAX_POPULATION = 2000;
 
     std::vector<Satellite> satellites;
-    std::vector<SparkParticle> sparkParticles; // Add vector for spark particles
+    PixelTheater::ParticleSystem<MAX_SPARKS> sparks; // Fixed pool; dead sparks are swap-removed
+    PixelTheater::SphereHash<> ledIndex;             // LED directions, built once in setup()
+    PixelTheater::SphereHash<> orbitIndex;           // Orbiting satellites, rebuilt every tick
+    size_t blurStage = PixelTheater::PostProcess::NONE;  // "blur" setting, in post_process()
+    size_t blurKnob = PixelTheater::QualityKnobs::NONE;  // Blur off at low quality
 
     uint32_t nextUniqueId = 1;  // Start at 1 for more human-readable IDs
 
@@ -83,6 +81,7 @@ private:
     static const float MIN_SPARK_LIFETIME;
     static const float MAX_SPARK_LIFETIME;
     static const uint8_t SPARK_BLEND_AMOUNT;
+    static const float SPARK_SEARCH_ANGLE;
 
     // Helper methods
     void initializeSatellite(Satellite& sat);
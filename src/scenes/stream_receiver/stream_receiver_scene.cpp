@@ -0,0 +1,98 @@
+#include "stream_receiver_scene.h"
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace Scenes {
+
+PixelTheater::ByteStream* StreamReceiverScene::_source = nullptr;
+PixelTheater::PacketTransport* StreamReceiverScene::_packet_source = nullptr;
+
+void StreamReceiverScene::setup() {
+    set_name("Stream Receiver");
+    set_description("Shows LED frames streamed from a host over serial or the network");
+    set_version("1.0");
+    set_author("PixelTheater Team");
+
+    param("timeout", "range", 0.1f, 10.0f, DEFAULT_TIMEOUT, "clamp", "Seconds without frames before the idle pattern");
+
+    decoder = std::make_unique<PixelTheater::FrameDecoder>(ledCount());
+    if (_packet_source) ingest = std::make_unique<PixelTheater::NetworkIngest>(ledCount());
+    last_frame_ms = 0;
+    frames_shown = 0;
+}
+
+void StreamReceiverScene::tick() {
+    Scene::tick();
+    if (!decoder) return;
+
+    BENCHMARK_START("stream_receive");
+    size_t frames = 0;
+    const PixelTheater::CRGB* frame = nullptr;
+    size_t count = 0;
+    if (_source) {
+        uint8_t chunk[512];
+        size_t total = 0;
+        while (total < MAX_READ_PER_TICK) {
+            const size_t n = _source->read(chunk, sizeof(chunk));
+            if (n == 0) break;
+            frames += decoder->feed(chunk, n);
+            total += n;
+        }
+        if (frames > 0) {
+            frame = decoder->frame();
+            count = decoder->ledCount();
+        }
+    }
+    if (_packet_source && ingest && ingest->drain(*_packet_source) > 0) {
+        frame = ingest->frame();
+        count = ingest->ledCount();
+        ++frames;
+    }
+    BENCHMARK_END();
+
+    if (frames > 0) {
+        BENCHMARK_START("stream_show_frame");
+        count = std::min(count, ledCount());
+        for (size_t i = 0; i < count; ++i) leds[i] = frame[i];
+        last_frame_ms = millis();
+        ++frames_shown;
+        BENCHMARK_END();
+        return;
+    }
+
+    // Hold the last frame through short gaps; idle once the stream has gone quiet
+    const float timeout = settings["timeout"];
+    if (frames_shown == 0 || millis() - last_frame_ms > static_cast<uint32_t>(timeout * 1000.0f)) {
+        showIdle();
+    }
+}
+
+void StreamReceiverScene::showIdle() {
+    // Slow dim breathing so it's obvious the receiver is running but has no data
+    const float breath = (std::sin(millis() * PT_PI / 1500.0f) + 1.0f) * 0.5f;
+    const CRGB color(0, 0, static_cast<uint8_t>(8 + breath * 40));
+    for (size_t i = 0; i < ledCount(); ++i) leds[i] = color;
+}
+
+std::string StreamReceiverScene::status() const {
+    if (!decoder) return "not set up";
+    const auto& s = decoder->stats();
+    char buf[192];
+    int len = snprintf(buf, sizeof(buf), "%s, %lu frames shown, %lu bytes, crc %lu fmt %lu base %lu",
+                       _source ? "listening" : "no serial source",
+                       static_cast<unsigned long>(frames_shown), static_cast<unsigned long>(s.bytes),
+                       static_cast<unsigned long>(s.checksum_errors), static_cast<unsigned long>(s.format_errors),
+                       static_cast<unsigned long>(s.missing_base));
+    if (ingest && len > 0 && static_cast<size_t>(len) < sizeof(buf)) {
+        const auto& n = ingest->stats();
+        snprintf(buf + len, sizeof(buf) - len, "; net %lu packets, %lu frames%s",
+                 static_cast<unsigned long>(n.packets), static_cast<unsigned long>(n.frames),
+                 ingest->syncMode() ? " (synced)" : "");
+    }
+    return buf;
+}
+
+} // namespace Scenes
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "PixelTheater/SceneKit.h"
+#include "PixelTheater/stream/byte_stream.h"
+#include "PixelTheater/stream/frame_codec.h"
+#include "PixelTheater/stream/network_ingest.h"
+#include "PixelTheater/stream/packet_transport.h"
+#include <memory>
+#include <string>
+
+namespace Scenes {
+
+/**
+ * Shows LED frames streamed from a host (see util/stream_sender).
+ *
+ * Two inputs, each shared by all instances and set once at startup:
+ *   - setSource(): framed serial stream, e.g. a SerialByteStream over the
+ *     Teensy USB port
+ *   - setPacketSource(): OPC / Art-Net / E1.31 datagrams, e.g. an
+ *     ArduinoUdpTransport over Teensy 4.1 Ethernet
+ * Each tick drains whatever has arrived and shows only the newest complete
+ * frame, so a slow frame never queues up behind older ones.
+ */
+class StreamReceiverScene : public Scene {
+public:
+    static constexpr size_t MAX_READ_PER_TICK = 64 * 1024; // Bytes; bounds the time spent draining
+    static constexpr float DEFAULT_TIMEOUT = 2.0f;          // Seconds without frames before idling
+
+    static void setSource(PixelTheater::ByteStream* source) { _source = source; }
+    static PixelTheater::ByteStream* source() { return _source; }
+    static void setPacketSource(PixelTheater::PacketTransport* transport) { _packet_source = transport; }
+    static PixelTheater::PacketTransport* packetSource() { return _packet_source; }
+
+    StreamReceiverScene() = default;
+
+    void setup() override;
+    void tick() override;
+    std::string status() const override;
+
+private:
+    void showIdle();
+
+    static PixelTheater::ByteStream* _source;
+    static PixelTheater::PacketTransport* _packet_source;
+
+    std::unique_ptr<PixelTheater::FrameDecoder> decoder;
+    std::unique_ptr<PixelTheater::NetworkIngest> ingest;
+    uint32_t last_frame_ms = 0;
+    uint32_t frames_shown = 0;
+};
+
+} // namespace Scenes
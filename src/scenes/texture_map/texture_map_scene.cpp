@@ -1,4 +1,5 @@
 #include "texture_map_scene.h"
+#include "benchmark.h"
 // #include "PixelTheater/mapping/coordinate_map.h" // Removed - Assume mapping comes from base Scene/Model
 #include <cmath> // For std::fmod, atan2, acos, sqrt, max, min
 #include <vector> // Include vector for safety, though already in .h
@@ -32,11 +33,13 @@ void TextureMapScene::setup() {
     set_description("Displays the Earth texture mapped onto the sphere.");
     set_version("2.1");
     set_author("PixelTheater User");
+    set_retain_state(true); // Keep the UV cache across switches
 
     // Register parameters using constants defined in the header
     param("rotation_speed", "range", -2.0f, 2.0f, DEFAULT_ROTATION_SPEED, "clamp", "Rotation speed (radians/sec)");
     param("brightness", "range", 0.0f, 1.0f, DEFAULT_BRIGHTNESS, "clamp", "Texture brightness multiplier");
     param("switch_interval", "range", 5.0f, 120.0f, DEFAULT_SWITCH_INTERVAL, "clamp", "Texture switch interval (sec)");
+    param("bilinear", "switch", DEFAULT_BILINEAR, "", "Bilinear texture filtering (off = nearest texel)");
 
     // Populate the texture list (adjust names if generate_props changes them)
     textures_.clear(); // Ensure list is empty before adding
@@ -53,6 +56,7 @@ void TextureMapScene::setup() {
     current_texture_index_ = 0;
     time_since_last_switch_ = 0.0f;
     last_rotation_update_ms_ = millis(); // Initialize with current time
+    rebuildUVCache();
 }
 
 void TextureMapScene::reset() {
@@ -61,51 +65,160 @@ void TextureMapScene::reset() {
     current_texture_index_ = 0; // Start from the first texture
     time_since_last_switch_ = 0.0f; // Reset timer
     last_rotation_update_ms_ = millis(); // Reset rotation timer
+    cached_texture_index_ = SIZE_MAX; // Force a cache rebuild on the next tick
 }
 
-PixelTheater::CRGB TextureMapScene::getColorFromUV(float u, float v) {
-    if (textures_.empty() || current_texture_index_ >= textures_.size()) {
-        return PixelTheater::CRGB::Magenta; // Error color if no textures or index out of bounds
+void TextureMapScene::rebuildUVCache() {
+    cached_texture_index_ = current_texture_index_;
+    uv_cache_.clear();
+    dir_cache_.clear();
+    if (textures_.empty() || current_texture_index_ >= textures_.size()) return;
+
+    const PixelTheater::TextureData* tex = textures_[current_texture_index_];
+    const uint32_t row_bytes = tex->width * 3;
+
+    if (tex->layout != PixelTheater::TextureLayout::Equirectangular) {
+        dir_cache_.assign(this->ledCount(), Vector3f::Zero());
+        for (size_t i = 0; i < dir_cache_.size(); ++i) {
+            const PixelTheater::Point& p = this->model().point(i);
+            Vector3f p_vec(p.x(), p.y(), p.z());
+            if (p_vec.norm() >= 1e-6f) dir_cache_[i] = p_vec.normalized();
+        }
+        return;
     }
-    const PixelTheater::TextureData* currentTexture = textures_[current_texture_index_];
 
-    // Clamp/wrap UV coordinates
-    u = std::fmod(u, 1.0f);
-    if (u < 0.0f) u += 1.0f;
-    // v is typically clamped [0, 1]
-    v = std::max(0.0f, std::min(1.0f, v));
+    uv_cache_.assign(this->ledCount(), UVSample{});
+    for (size_t i = 0; i < uv_cache_.size(); ++i) {
+        const PixelTheater::Point& p = this->model().point(i);
+        Vector3f p_vec(p.x(), p.y(), p.z());
 
-    // Calculate integer pixel coordinates (simple nearest neighbor for now)
-    int x = static_cast<int>(u * currentTexture->width);
-    int y = static_cast<int>(v * currentTexture->height);
+        float r = p_vec.norm();
+        if (r < 1e-6f) continue; // Centre point, left invalid (drawn black)
 
-    // Clamp coordinates to be safe
-    x = std::max(0, std::min(x, static_cast<int>(currentTexture->width) - 1));
-    y = std::max(0, std::min(y, static_cast<int>(currentTexture->height) - 1));
+        // Equirectangular projection: longitude -> u, inclination from Z+ -> v
+        float theta = std::atan2(p_vec.y(), p_vec.x());
+        float phi = std::acos(std::max(-1.0f, std::min(1.0f, p_vec.z() / r)));
+        float u = (theta + PT_PI) / (2.0f * PT_PI);
+        float v = phi / PT_PI;
 
-    // Calculate index in the 1D data array (RGB order)
-    int index = (y * currentTexture->width + x) * 3;
+        // Vertical texel position, shifted by half a texel so weights are relative to texel centres
+        float ty = v * tex->height - 0.5f;
+        ty = std::max(0.0f, std::min(ty, static_cast<float>(tex->height - 1)));
+        uint32_t y0 = static_cast<uint32_t>(ty);
+        uint32_t y1 = std::min(y0 + 1, tex->height - 1);
 
-    // Ensure index is within bounds (should be, but good practice)
-    if (index < 0 || index + 2 >= static_cast<int>(currentTexture->width * currentTexture->height * 3)) {
-        return PixelTheater::CRGB::DarkRed; // Different Error color for index bounds issue
+        UVSample& s = uv_cache_[i];
+        s.u = static_cast<uint16_t>(static_cast<uint32_t>(u * 65536.0f) & 0xFFFF);
+        s.row0 = y0 * row_bytes;
+        s.row1 = y1 * row_bytes;
+        s.fy = static_cast<uint8_t>((ty - y0) * 255.0f);
+        s.valid = true;
     }
+}
 
-    // Retrieve the RGB color from PROGMEM
-    uint8_t r = pgm_read_byte(&(currentTexture->data[index + 0]));
-    uint8_t g = pgm_read_byte(&(currentTexture->data[index + 1]));
-    uint8_t b = pgm_read_byte(&(currentTexture->data[index + 2]));
-    
-    PixelTheater::CRGB color = PixelTheater::CRGB(r, g, b);
-
-    // Apply brightness scaling
-    float brightness_param = settings["brightness"]; // Get brightness value
-    uint8_t scale = static_cast<uint8_t>(brightness_param * 255.0f);
-    color.r = scale8_video(color.r, scale);
-    color.g = scale8_video(color.g, scale);
-    color.b = scale8_video(color.b, scale);
-    
-    return color; // Return scaled color
+PixelTheater::CRGB TextureMapScene::sampleNearest(const UVSample& s, uint16_t u_offset) const {
+    const PixelTheater::TextureData* tex = textures_[current_texture_index_];
+    uint16_t u = s.u + u_offset; // Wraps around the full turn for free
+    uint32_t x = (static_cast<uint32_t>(u) * tex->width) >> 16;
+    uint32_t index = (s.fy < 128 ? s.row0 : s.row1) + x * 3;
+    return PixelTheater::CRGB(pgm_read_byte(&tex->data[index + 0]),
+                              pgm_read_byte(&tex->data[index + 1]),
+                              pgm_read_byte(&tex->data[index + 2]));
+}
+
+PixelTheater::CRGB TextureMapScene::sampleBilinear(const UVSample& s, uint16_t u_offset) const {
+    const PixelTheater::TextureData* tex = textures_[current_texture_index_];
+    uint16_t u = s.u + u_offset;
+
+    // 16.16 texel position, shifted half a texel and wrapped around longitude
+    const uint32_t span = tex->width << 16;
+    uint32_t tx = static_cast<uint32_t>(u) * tex->width + span - 0x8000;
+    if (tx >= span) tx -= span;
+    uint32_t x0 = tx >> 16;
+    uint32_t x1 = (x0 + 1 == tex->width) ? 0 : x0 + 1;
+    uint16_t fx = (tx >> 8) & 0xFF;
+    uint16_t fy = s.fy;
+
+    const uint8_t* d = tex->data;
+    const uint32_t i00 = s.row0 + x0 * 3, i01 = s.row0 + x1 * 3;
+    const uint32_t i10 = s.row1 + x0 * 3, i11 = s.row1 + x1 * 3;
+
+    uint8_t out[3];
+    for (int c = 0; c < 3; ++c) {
+        uint16_t top = (pgm_read_byte(&d[i00 + c]) * (256 - fx) + pgm_read_byte(&d[i01 + c]) * fx) >> 8;
+        uint16_t bot = (pgm_read_byte(&d[i10 + c]) * (256 - fx) + pgm_read_byte(&d[i11 + c]) * fx) >> 8;
+        out[c] = static_cast<uint8_t>((top * (256 - fy) + bot * fy) >> 8);
+    }
+    return PixelTheater::CRGB(out[0], out[1], out[2]);
+}
+
+PixelTheater::CRGB TextureMapScene::sampleSquare(const PixelTheater::TextureData* tex, uint32_t rx, uint32_t ry,
+                                                 uint32_t size, float s, float t, bool bilinear) {
+    const uint8_t* d = tex->data;
+    const float max_texel = static_cast<float>(size - 1);
+    if (!bilinear) {
+        uint32_t x = rx + static_cast<uint32_t>(std::min(std::max(s * size, 0.0f), max_texel));
+        uint32_t y = ry + static_cast<uint32_t>(std::min(std::max(t * size, 0.0f), max_texel));
+        uint32_t index = (y * tex->width + x) * 3;
+        return PixelTheater::CRGB(pgm_read_byte(&d[index + 0]),
+                                  pgm_read_byte(&d[index + 1]),
+                                  pgm_read_byte(&d[index + 2]));
+    }
+
+    // Clamp to the square so taps never bleed into a neighbouring cube face
+    float tx = std::min(std::max(s * size - 0.5f, 0.0f), max_texel);
+    float ty = std::min(std::max(t * size - 0.5f, 0.0f), max_texel);
+    uint32_t x0 = static_cast<uint32_t>(tx), y0 = static_cast<uint32_t>(ty);
+    uint32_t x1 = std::min(x0 + 1, size - 1), y1 = std::min(y0 + 1, size - 1);
+    uint16_t fx = static_cast<uint16_t>((tx - x0) * 256.0f);
+    uint16_t fy = static_cast<uint16_t>((ty - y0) * 256.0f);
+
+    const uint32_t row0 = (ry + y0) * tex->width, row1 = (ry + y1) * tex->width;
+    const uint32_t i00 = (row0 + rx + x0) * 3, i01 = (row0 + rx + x1) * 3;
+    const uint32_t i10 = (row1 + rx + x0) * 3, i11 = (row1 + rx + x1) * 3;
+
+    uint8_t out[3];
+    for (int c = 0; c < 3; ++c) {
+        uint16_t top = (pgm_read_byte(&d[i00 + c]) * (256 - fx) + pgm_read_byte(&d[i01 + c]) * fx) >> 8;
+        uint16_t bot = (pgm_read_byte(&d[i10 + c]) * (256 - fx) + pgm_read_byte(&d[i11 + c]) * fx) >> 8;
+        out[c] = static_cast<uint8_t>((top * (256 - fy) + bot * fy) >> 8);
+    }
+    return PixelTheater::CRGB(out[0], out[1], out[2]);
+}
+
+PixelTheater::CRGB TextureMapScene::sampleDirection(const PixelTheater::TextureData* tex,
+                                                    float x, float y, float z, bool bilinear) {
+    if (tex->layout == PixelTheater::TextureLayout::CubeMap) {
+        // Same face order and orientation as util/generate_props.py (OpenGL convention)
+        const uint32_t size = tex->width / 3;
+        float ax = std::fabs(x), ay = std::fabs(y), az = std::fabs(z);
+        uint8_t face;
+        float ma, sc, tc;
+        if (ax >= ay && ax >= az) {
+            ma = ax; tc = -y;
+            if (x > 0) { face = 0; sc = -z; } else { face = 1; sc = z; }
+        } else if (ay >= az) {
+            ma = ay; sc = x;
+            if (y > 0) { face = 2; tc = z; } else { face = 3; tc = -z; }
+        } else {
+            ma = az; tc = -y;
+            if (z > 0) { face = 4; sc = x; } else { face = 5; sc = -x; }
+        }
+        float inv = 0.5f / ma;
+        return sampleSquare(tex, (face % 3) * size, (face / 3) * size, size,
+                            sc * inv + 0.5f, tc * inv + 0.5f, bilinear);
+    }
+
+    // Octahedral: project onto |x|+|y|+|z| = 1, fold the lower hemisphere outwards
+    float n = 1.0f / (std::fabs(x) + std::fabs(y) + std::fabs(z));
+    float p = x * n, q = y * n;
+    if (z < 0.0f) {
+        float fp = (1.0f - std::fabs(q)) * (p >= 0.0f ? 1.0f : -1.0f);
+        float fq = (1.0f - std::fabs(p)) * (q >= 0.0f ? 1.0f : -1.0f);
+        p = fp;
+        q = fq;
+    }
+    return sampleSquare(tex, 0, 0, tex->width, (p + 1.0f) * 0.5f, (q + 1.0f) * 0.5f, bilinear);
 }
 
 void TextureMapScene::tick() {
@@ -122,6 +235,11 @@ void TextureMapScene::tick() {
         }
         time_since_last_switch_ = 0.0f; // Reset timer
     }
+    // The cache in use covers every LED; any other size means the model changed
+    const size_t cached_leds = uv_cache_.empty() ? dir_cache_.size() : uv_cache_.size();
+    if (cached_texture_index_ != current_texture_index_ || cached_leds != this->ledCount()) {
+        rebuildUVCache();
+    }
     // --- End Texture Switching ---
 
     // --- Rotation Update based on millis() --- 
@@ -135,47 +253,53 @@ void TextureMapScene::tick() {
     }
     last_rotation_update_ms_ = current_millis;
 
-    // --- DEBUG LOGGING --- Update log to show elapsed_ms
-    static uint32_t last_log_time = 0;
-    if (current_millis - last_log_time > 1000) { // Log approx every second
-        this->logInfo("TextureMap Debug: Speed=%.2f, ElapsedMs=%lu, Angle=%.2f", speed, elapsed_ms, rotation_angle_);
-        last_log_time = current_millis;
+    if (textures_.empty() || current_texture_index_ >= textures_.size()) {
+        for (size_t i = 0; i < this->ledCount(); ++i) this->leds[i] = PixelTheater::CRGB::Magenta;
+        return;
     }
-    // --- END DEBUG LOGGING ---
-    
-    for (size_t i = 0; i < this->ledCount(); ++i) { // Use ledCount()
-        // Get the 3D cartesian coordinates of the LED
-        const PixelTheater::Point& p = this->model().point(i); 
-        // Convert PixelTheater::Point to Eigen::Vector3f
-        Vector3f p_vec(p.x(), p.y(), p.z());
 
-        // Convert cartesian to spherical coordinates (theta, phi)
-        float r = p_vec.norm(); // Use Eigen norm()
-        if (r < 1e-6f) { // Check against small epsilon
-            this->leds[i] = PixelTheater::CRGB::Black; // Center point, map to black
+    // Parameters are read once per frame, not per LED
+    uint8_t scale = static_cast<uint8_t>(static_cast<float>(this->settings["brightness"]) * 255.0f);
+    bool bilinear = this->settings["bilinear"];
+
+    const PixelTheater::TextureData* tex = textures_[current_texture_index_];
+    if (tex->layout != PixelTheater::TextureLayout::Equirectangular) {
+        BENCHMARK_START("texture_sample");
+        // Sample at Rz(angle) * p, which matches the equirectangular u offset below
+        const float ca = std::cos(rotation_angle_), sa = std::sin(rotation_angle_);
+        for (size_t i = 0; i < dir_cache_.size(); ++i) {
+            const Vector3f& p = dir_cache_[i];
+            if (p.isZero()) {
+                this->leds[i] = PixelTheater::CRGB::Black;
+                continue;
+            }
+            PixelTheater::CRGB color = sampleDirection(tex, p.x() * ca - p.y() * sa, p.x() * sa + p.y() * ca, p.z(), bilinear);
+            color.r = scale8_video(color.r, scale);
+            color.g = scale8_video(color.g, scale);
+            color.b = scale8_video(color.b, scale);
+            this->leds[i] = color;
+        }
+        BENCHMARK_END();
+        return;
+    }
+
+    // Rotation about Z is a longitude shift: convert the angle to a 16-bit turn fraction
+    uint16_t u_offset = static_cast<uint16_t>(static_cast<int32_t>(rotation_angle_ * (65536.0f / (2.0f * PT_PI))));
+
+    BENCHMARK_START("texture_sample");
+    for (size_t i = 0; i < uv_cache_.size(); ++i) {
+        const UVSample& s = uv_cache_[i];
+        if (!s.valid) {
+            this->leds[i] = PixelTheater::CRGB::Black;
             continue;
         }
-        float theta = std::atan2(p_vec.y(), p_vec.x()); // Azimuth
-        float phi = std::acos(p_vec.z() / r);          // Inclination from Z+
-
-        // Apply rotation around the Y-axis (changes theta)
-        // Simple angle addition might be sufficient if atan2 range is handled
-        float rotated_theta = std::fmod(theta + rotation_angle_, 2.0f * PT_PI);
-        // Ensure positive range [0, 2*PI)
-        // if (rotated_theta < 0) rotated_theta += 2.0f * PT_PI; 
-        // Using atan2 for wrapping robustness:
-        rotated_theta = std::atan2(std::sin(theta + rotation_angle_), std::cos(theta + rotation_angle_));
-
-        // Map spherical coordinates (longitude, latitude) to texture coordinates (u, v)
-        // Equirectangular projection: u relates to longitude (theta), v relates to latitude (phi)
-        // Map theta from [-PI, PI] to u [0, 1]
-        float u = (rotated_theta + PT_PI) / (2.0f * PT_PI); 
-        // Map phi from [0, PI] to v [0, 1]
-        float v = phi / PT_PI;                
-
-        // Get color from texture
-        this->leds[i] = getColorFromUV(u, v);
+        PixelTheater::CRGB color = bilinear ? sampleBilinear(s, u_offset) : sampleNearest(s, u_offset);
+        color.r = scale8_video(color.r, scale);
+        color.g = scale8_video(color.g, scale);
+        color.b = scale8_video(color.b, scale);
+        this->leds[i] = color;
     }
+    BENCHMARK_END();
 }
 
 } // namespace Scenes
@@ -12,6 +12,7 @@ public:
     static constexpr float DEFAULT_ROTATION_SPEED = -0.3f;
     static constexpr float DEFAULT_BRIGHTNESS = 0.6f;
     static constexpr float DEFAULT_SWITCH_INTERVAL = 20.0f;
+    static constexpr bool DEFAULT_BILINEAR = true;
 
     // Constructor: Use default name or allow override
     TextureMapScene() = default;
@@ -20,9 +21,36 @@ public:
     void reset() override;
     void tick() override;
 
+    // Cube map / octahedral: project a (rotated) unit direction and sample the texture.
+    // Rotation is no longer a plain offset here, but the projections need no trig.
+    static CRGB sampleDirection(const PixelTheater::TextureData* tex, float x, float y, float z, bool bilinear);
+
 private:
-    // Helper function to get color from the current texture's coordinates (u, v)
-    CRGB getColorFromUV(float u, float v);
+    // Per-LED texture lookup, precomputed once per texture.
+    // LED positions never move, so the spherical angles only need computing once;
+    // a rotation about Z is then just an offset added to the cached longitude.
+    struct UVSample {
+        uint16_t u = 0;       // Longitude as a fraction of a full turn (0-65535)
+        uint32_t row0 = 0;    // Byte offset of the upper texel row
+        uint32_t row1 = 0;    // Byte offset of the lower texel row
+        uint8_t fy = 0;       // Blend weight toward row1 (0-255)
+        bool valid = false;   // False for points at the model centre
+    };
+
+    // Rebuild uv_cache_ (equirectangular) or dir_cache_ (other layouts) for the current texture
+    void rebuildUVCache();
+
+    // Sample the current texture for one cached LED, with u_offset applied to longitude
+    CRGB sampleNearest(const UVSample& s, uint16_t u_offset) const;
+    CRGB sampleBilinear(const UVSample& s, uint16_t u_offset) const;
+
+    // Sample face-local (s, t) in [0, 1] inside the size x size texel square at (rx, ry)
+    static CRGB sampleSquare(const PixelTheater::TextureData* tex, uint32_t rx, uint32_t ry, uint32_t size,
+                             float s, float t, bool bilinear);
+
+    std::vector<UVSample> uv_cache_;
+    std::vector<Eigen::Vector3f> dir_cache_;  // Unit LED directions, zero for the model centre
+    size_t cached_texture_index_ = SIZE_MAX; // Texture the cache was built for
 
     // Texture management
     std::vector<const PixelTheater::TextureData*> textures_; // Vector of texture pointers
@@ -16,8 +16,7 @@ namespace Scenes {
 
 Particle::Particle(WanderingParticlesScene& parent_scene, uint16_t unique_id)
     : scene(parent_scene),
-      particle_id(unique_id),
-      path(MAX_PATH_LENGTH, -1) 
+      particle_id(unique_id)
 {
     // Call the common initializer with a random starting LED
     initializeParticleState(scene.random(scene.ledCount())); 
@@ -28,10 +27,11 @@ void Particle::initializeParticleState(int start_led_number) {
     current_led_number = start_led_number;
     target_led_number = -1; // Initialize target as invalid
     transition_progress = 0.0f; // Start progress at 0
-    std::fill(path.begin(), path.end(), -1); 
+    path.clear();
+    while (!path.full()) path.push(-1);
 
     if (current_led_number >= 0 && current_led_number < (int)scene.ledCount()) {
-        path[0] = current_led_number; 
+        path.push(current_led_number); // Newest entry
         const auto& p = scene.model().point(current_led_number);
         float r = sqrt(p.x()*p.x() + p.y()*p.y() + p.z()*p.z());
         if (r > 1e-6) { 
@@ -44,7 +44,7 @@ void Particle::initializeParticleState(int start_led_number) {
         // Invalid start LED, maybe default to 0?
         current_led_number = 0; 
         if (current_led_number < (int)scene.ledCount()) { // Check if LED 0 is valid
-             path[0] = current_led_number;
+             path.push(current_led_number);
              const auto& p = scene.model().point(current_led_number);
              float r = sqrt(p.x()*p.x() + p.y()*p.y() + p.z()*p.z());
              if (r > 1e-6) { 
@@ -150,11 +150,7 @@ void Particle::tick() {
 
         // Update path history ONLY when a new LED is fully reached
         if (current_led_number >= 0) { 
-            // Shift elements down: path[i] = path[i-1]
-            for (size_t i = path.size() - 1; i > 0; --i) {
-                path[i] = path[i-1];
-            }
-            path[0] = current_led_number; // Add new current LED to the start
+            path.push(current_led_number); // Newest entry; the oldest drops off
         }
     }
     // --- End Target LED Handling ---
@@ -211,7 +207,7 @@ void Particle::findNextLed(float gravity_strength) {
     Vector3f preferred_direction;
 
     // Determine preferred direction (based on path)
-    int previous_led = (path.size() > 1 && path[1] != -1) ? path[1] : -1;
+    int previous_led = (path.size() > 1 && path.newest(1) != -1) ? path.newest(1) : -1;
     if (previous_led >= 0 && previous_led < (int)scene.ledCount()) {
         const auto& prev_point = scene.model().point(previous_led);
         Vector3f p_prev(prev_point.x(), prev_point.y(), prev_point.z());
@@ -249,7 +245,7 @@ void Particle::findNextLed(float gravity_strength) {
     const auto& neighbors = current_point.getNeighbors(); 
     
     // --- Collect Candidate Neighbors --- 
-    std::vector<std::pair<float, int>> candidates;
+    PixelTheater::FixedVector<std::pair<float, int>, PixelTheater::Limits::MAX_NEIGHBORS> candidates;
     const float DIRECTION_ALIGNMENT_THRESHOLD = 0.3f; 
 
     for (const auto& neighbor : neighbors) {
@@ -259,7 +255,7 @@ void Particle::findNextLed(float gravity_strength) {
 
         // Path Avoidance (prevents going directly back)
         bool in_path = false;
-        if (!path.empty() && path[0] != -1 && path[0] == potential_next_led) { // Check only immediate previous step
+        if (!path.empty() && path.newest() != -1 && path.newest() == potential_next_led) { // Check only immediate previous step
             in_path = true;
         }
         if (in_path) continue; 
@@ -281,16 +277,25 @@ void Particle::findNextLed(float gravity_strength) {
     // --- Choose Next LED --- 
     int chosen_led = -1;
     if (!candidates.empty()) {
-        std::sort(candidates.begin(), candidates.end(), std::greater<std::pair<float, int>>());
-        size_t num_choices = std::min(candidates.size(), (size_t)3);
-        chosen_led = candidates[scene.random(num_choices)].second;
+        // Pick among the 3 best aligned; only those need ordering
+        constexpr size_t MAX_CHOICES = 3;
+        std::pair<float, int> best[MAX_CHOICES];
+        size_t num_choices = 0;
+        for (const auto& candidate : candidates) {
+            size_t slot = num_choices < MAX_CHOICES ? num_choices++ : MAX_CHOICES;
+            for (; slot > 0 && best[slot - 1] < candidate; --slot) {
+                if (slot < MAX_CHOICES) best[slot] = best[slot - 1];
+            }
+            if (slot < MAX_CHOICES) best[slot] = candidate;
+        }
+        chosen_led = best[scene.random(num_choices)].second;
     } else {
         // Fallback: No suitable aligned neighbors found
-        std::vector<int> valid_neighbors;
+        PixelTheater::FixedVector<int, PixelTheater::Limits::MAX_NEIGHBORS> valid_neighbors;
         for (const auto& neighbor : neighbors) {
              if (neighbor.id != 0xFFFF && neighbor.distance > 1e-6f && neighbor.id < (int)scene.ledCount()) {
                  // Avoid immediate previous LED in fallback too
-                 if (path.empty() || path[0] == -1 || path[0] != neighbor.id) {
+                 if (path.empty() || path.newest() == -1 || path.newest() != neighbor.id) {
                     valid_neighbors.push_back(neighbor.id);
                  }
              }
@@ -303,7 +308,7 @@ void Particle::findNextLed(float gravity_strength) {
              // Let's try picking any valid neighbor that isn't the immediate previous one.
              for (const auto& neighbor : neighbors) {
                   if (neighbor.id != 0xFFFF && neighbor.id < (int)scene.ledCount()) {
-                       if (path.empty() || path[0] == -1 || path[0] != neighbor.id) {
+                       if (path.empty() || path.newest() == -1 || path.newest() != neighbor.id) {
                           chosen_led = neighbor.id;
                           break; // Take the first one found
                        }
@@ -4,6 +4,7 @@
 #include <vector>
 #include <memory> // Often included with vector of unique_ptr
 #include "PixelTheater/core/crgb.h" // Include CRGB definition
+#include "PixelTheater/core/fixed_containers.h"
 
 namespace Scenes {
 
@@ -36,7 +37,7 @@ public:
     int target_led_number = -1; // Next LED target
     float transition_progress = 0.0f; // Progress towards target_led (0.0 to 1.0)
     static constexpr size_t MAX_PATH_LENGTH = 10;
-    std::vector<int> path; // Recent path (trail) of LED indices
+    PixelTheater::RingBuffer<int, MAX_PATH_LENGTH> path; // Recent path (trail) of LED indices; newest(0) is the latest
     PixelTheater::CRGB color = PixelTheater::CRGB::White;
     int ticks_at_pole = 0; // Add counter for ticks stuck at a pole
     ParticleState state = ParticleState::FADING_IN; // Add state member
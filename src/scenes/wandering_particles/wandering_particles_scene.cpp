@@ -118,7 +118,7 @@ void WanderingParticlesScene::tick() {
         
         // Draw particle trail (Based on discrete path history)
         for (size_t i = 0; i < particle.path.size(); i++) { // Start from i=0 (current_led) for trail fade relative to head
-            int trail_led_idx = particle.path[i];
+            int trail_led_idx = particle.path.newest(i);
             if (trail_led_idx < 0 || trail_led_idx >= (int)count) continue; // Skip invalid indices
             
             // Skip drawing the current/target head LEDs again in the trail loop
@@ -386,7 +386,7 @@ public:
         }
         
         try {
-            auto schema = scene->parameter_schema();
+            const auto& schema = scene->parameter_schema();
             PixelTheater::Log::info("C++ getSceneParameters: Found %zu parameters for scene '%s'", 
                                   schema.parameters.size(), scene->name().c_str());
             
@@ -469,7 +469,7 @@ public:
         }
         
         try {
-            auto schema = scene->parameter_schema();
+            const auto& schema = scene->parameter_schema();
             auto it = std::find_if(schema.parameters.begin(), schema.parameters.end(),
                 [&param_id](const auto& param) { return param.name == param_id; });
             
@@ -699,34 +699,37 @@ const char* get_current_scene_metadata_json() {
         return allocate_default(); // Early return
     }
 
-    try {
+    // Rebuilt only when the scene or its metadata changes
+    static const PixelTheater::Scene* cached_scene = nullptr;
+    static std::string cached_fields[4];
+    static std::string cached_json;
+    const std::string* fields[4] = { &scene->name(), &scene->description(), &scene->version(), &scene->author() };
+    bool stale = cached_scene != scene;
+    for (int i = 0; i < 4 && !stale; ++i) stale = cached_fields[i] != *fields[i];
+
+    if (stale) {
         std::ostringstream json_stream;
         json_stream << "{";
         json_stream << "\"name\":\"" << escape_json_helper(scene->name()) << "\",";
         json_stream << "\"description\":\"" << escape_json_helper(scene->description()) << "\",";
         json_stream << "\"version\":\"" << escape_json_helper(scene->version()) << "\",";
-        json_stream << "\"author\":\"" << escape_json_helper(scene->author()) << "\""; 
+        json_stream << "\"author\":\"" << escape_json_helper(scene->author()) << "\",";
+        json_stream << "\"schema_version\":" << scene->schema_version();
         json_stream << "}";
+        cached_json = json_stream.str();
+        cached_scene = scene;
+        for (int i = 0; i < 4; ++i) cached_fields[i] = *fields[i];
+        PixelTheater::Log::info("Generated Metadata JSON for '%s': %s", scene->name().c_str(), cached_json.c_str());
+    }
 
-        std::string json_string = json_stream.str();
-        PixelTheater::Log::info("Generated Metadata JSON for '%s': %s", scene->name().c_str(), json_string.c_str());
-
-        // Allocate memory and copy
-        allocated_json_str = (char*)malloc(json_string.length() + 1);
-        if (!allocated_json_str) {
-            PixelTheater::Log::error("Failed to allocate memory for metadata JSON string!");
-            return allocate_default(); // Early return on allocation failure
-        }
-        strcpy(allocated_json_str, json_string.c_str());
-        return allocated_json_str; // Return successfully allocated string
-
-    } catch (const std::exception& e) {
-        PixelTheater::Log::error("Error creating metadata JSON: %s", e.what());
-        return allocate_default(); // Early return on exception
-    } catch (...) {
-         PixelTheater::Log::error("Unknown error creating metadata JSON");
-        return allocate_default(); // Early return on unknown exception
+    // Allocate memory and copy; JS frees it with free_string_memory
+    allocated_json_str = (char*)malloc(cached_json.length() + 1);
+    if (!allocated_json_str) {
+        PixelTheater::Log::error("Failed to allocate memory for metadata JSON string!");
+        return allocate_default();
     }
+    strcpy(allocated_json_str, cached_json.c_str());
+    return allocated_json_str;
 }
 
 EMSCRIPTEN_KEEPALIVE
@@ -971,57 +974,42 @@ const char* get_scene_parameters_json() {
         return nullptr;
     }
 
-    std::stringstream json_stream;
-    json_stream << "[";
-    bool first_param = true;
-
-    try {
-        auto schema = scene->parameter_schema();
-        PixelTheater::Log::info("get_scene_parameters_json: Found %zu parameters for scene '%s'", 
-                              schema.parameters.size(), scene->name().c_str());
-
+    // The descriptors only change with the schema, so they are built once per
+    // schema version as text either side of each value; a call then just
+    // formats the current values into place.
+    struct ParamFragment {
+        std::string prefix;     // Up to and including "value":
+        std::string suffix;     // The rest of the object
+        std::string name;
+        std::string type;
+        float default_float;
+        int default_int;
+    };
+    static const PixelTheater::Scene* cached_scene = nullptr;
+    static uint32_t cached_version = 0;
+    static std::vector<ParamFragment> fragments;
+
+    const auto& schema = scene->parameter_schema();
+    if (cached_scene != scene || cached_version != schema.version) {
+        fragments.clear();
+        fragments.reserve(schema.parameters.size());
         for (const auto& param : schema.parameters) {
-            if (!first_param) {
-                json_stream << ",";
-            }
-            first_param = false;
-
-            json_stream << "{";
-            json_stream << "\"id\":\"" << escape_json_helper(param.name) << "\",";
+            std::stringstream head, tail;
+            head << "{";
+            head << "\"id\":\"" << escape_json_helper(param.name) << "\",";
             // Use description if available, otherwise name, for the label
             std::string label = !param.description.empty() ? param.description : param.name;
-            json_stream << "\"label\":\"" << escape_json_helper(label) << "\",";
-            // Also include the actual description field
-            json_stream << "\"description\":\"" << escape_json_helper(param.description) << "\",";
-            json_stream << "\"type\":\"" << escape_json_helper(param.type) << "\",";
+            head << "\"label\":\"" << escape_json_helper(label) << "\",";
+            head << "\"description\":\"" << escape_json_helper(param.description) << "\",";
+            head << "\"type\":\"" << escape_json_helper(param.type) << "\",";
 
             std::string controlType = "slider";
-            std::string valueStr = "";
-            std::vector<std::string> options;
             float min_val = 0.0f, max_val = 1.0f, step_val = 0.01f;
-
             if (param.type == "switch") {
                 controlType = "checkbox";
-                bool value = scene->settings[param.name];
-                valueStr = value ? "true" : "false";
             } else if (param.type == "select") {
                 controlType = "select";
-                valueStr = "TODO"; // Placeholder - Need to access current selection
-                options = param.options;
             } else { // Numeric types
-                controlType = "slider";
-                if (param.type == "count") {
-                    int intValue = scene->settings[param.name];
-                     if (intValue == 0 && param.default_int != 0) { intValue = param.default_int; }
-                    valueStr = std::to_string(intValue);
-                } else { 
-                    float floatValue = scene->settings[param.name];
-                    if (floatValue == 0.0f && param.default_float != 0.0f) { floatValue = param.default_float; }
-                    std::stringstream ss_val;
-                    ss_val.precision(6);
-                    ss_val << std::fixed << floatValue;
-                    valueStr = ss_val.str();
-                }
                 min_val = param.min_value;
                 max_val = param.max_value;
                 // Calculate step
@@ -1029,48 +1017,63 @@ const char* get_scene_parameters_json() {
                 else if (param.type == "angle" || param.type == "signed_angle") step_val = M_PI / 100.0f;
                 else if (param.type == "range") step_val = (max_val != min_val) ? (max_val - min_val) / 100.0f : 0.01f;
                 else if (param.type == "count") step_val = 1.0f;
-                else step_val = 0.01f; 
+                else step_val = 0.01f;
             }
+            head << "\"controlType\":\"" << controlType << "\",";
+            head << "\"value\":";
 
-            json_stream << "\"controlType\":\"" << escape_json_helper(controlType) << "\",";
-            // Value needs quotes only if it's not a number or boolean
-            if (controlType == "checkbox") {
-                 json_stream << "\"value\":" << valueStr << ","; // Booleans don't need quotes in JSON
-            } else {
-                 json_stream << "\"value\":\"" << escape_json_helper(valueStr) << "\",";
-            }
-           
             if (controlType == "slider") {
-                json_stream << "\"min\":" << min_val << ",";
-                json_stream << "\"max\":" << max_val << ",";
-                json_stream << "\"step\":" << step_val << ",";
+                tail << ",\"min\":" << min_val;
+                tail << ",\"max\":" << max_val;
+                tail << ",\"step\":" << step_val;
             }
             if (controlType == "select") {
-                json_stream << "\"options\":[";
+                tail << ",\"options\":[";
                 bool first_option = true;
-                for(const auto& opt : options) {
-                    if (!first_option) json_stream << ",";
+                for (const auto& opt : param.options) {
+                    if (!first_option) tail << ",";
                     first_option = false;
-                    json_stream << "\"" << escape_json_helper(opt) << "\"";
+                    tail << "\"" << escape_json_helper(opt) << "\"";
                 }
-                 json_stream << "],";
+                tail << "]";
             }
+            tail << "}";
 
-            // Remove trailing comma if any fields were added
-             json_stream.seekp(-1, std::ios_base::end);
-             json_stream << "}"; // Close param object
+            fragments.push_back({head.str(), tail.str(), param.name, param.type,
+                                 param.default_float, param.default_int});
         }
-
-    } catch (const std::exception& e) {
-        PixelTheater::Log::error("Error creating JSON for scene parameters: %s", e.what());
-        json_stream.str(""); // Clear stream on error
-        json_stream << "[]"; // Return empty array on error
+        cached_scene = scene;
+        cached_version = schema.version;
+        PixelTheater::Log::info("get_scene_parameters_json: Cached %zu parameter descriptors for scene '%s'",
+                              fragments.size(), scene->name().c_str());
     }
 
-    json_stream << "]"; // Close main array
-
-    std::string json_string = json_stream.str();
-    PixelTheater::Log::info("Generated JSON: %s", json_string.c_str());
+    std::string json_string = "[";
+    char value_buf[32];
+    for (size_t i = 0; i < fragments.size(); ++i) {
+        const ParamFragment& param = fragments[i];
+        if (i) json_string += ",";
+        json_string += param.prefix;
+        if (param.type == "switch") {
+            // Booleans don't need quotes in JSON
+            bool value = scene->settings[param.name];
+            json_string += value ? "true" : "false";
+        } else if (param.type == "select") {
+            json_string += "\"TODO\""; // Placeholder - Need to access current selection
+        } else if (param.type == "count") {
+            int intValue = scene->settings[param.name];
+            if (intValue == 0 && param.default_int != 0) { intValue = param.default_int; }
+            snprintf(value_buf, sizeof(value_buf), "\"%d\"", intValue);
+            json_string += value_buf;
+        } else {
+            float floatValue = scene->settings[param.name];
+            if (floatValue == 0.0f && param.default_float != 0.0f) { floatValue = param.default_float; }
+            snprintf(value_buf, sizeof(value_buf), "\"%.6f\"", floatValue);
+            json_string += value_buf;
+        }
+        json_string += param.suffix;
+    }
+    json_string += "]";
 
     // Allocate memory and copy the string
     char* json_c_str = (char*)malloc(json_string.length() + 1);
@@ -0,0 +1,206 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "PixelTheater/limits.h"
+#include "PixelTheater/model/kd_tree.h"
+#include "PixelTheater/model/model_blob.h"
+
+namespace PixelTheater::Testing {
+
+/**
+ * Synthetic models for scaling tests, built as model blobs in memory and
+ * loaded with RuntimeModel (so one test binary can sweep LED counts without
+ * a ModelDefinition per size):
+ *
+ *   RuntimeModel model;
+ *   auto blob = SyntheticModel::geodesicSphere(5000);
+ *   model.load(blob.data(), blob.size());
+ *
+ * LEDs are spread over each face with a sunflower spiral, numbered face by
+ * face, and get Limits::MAX_NEIGHBORS neighbours from a k-d tree. Faces keep
+ * to Limits::MAX_LEDS_PER_FACE, so the LED count is rounded down to a
+ * multiple of the face count; use the loaded model's pointCount().
+ */
+namespace SyntheticModel {
+
+struct Vec3 {
+    double x, y, z;
+    Vec3 operator+(const Vec3& o) const { return {x + o.x, y + o.y, z + o.z}; }
+    Vec3 operator-(const Vec3& o) const { return {x - o.x, y - o.y, z - o.z}; }
+    Vec3 operator*(double s) const { return {x * s, y * s, z * s}; }
+    double dot(const Vec3& o) const { return x * o.x + y * o.y + z * o.z; }
+    Vec3 cross(const Vec3& o) const { return {y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x}; }
+    double length() const { return std::sqrt(dot(*this)); }
+    Vec3 normalized() const { return *this * (1.0 / length()); }
+};
+
+using Polygon = std::vector<Vec3>;
+
+// Fill a face with count LEDs on a sunflower spiral in its inscribed circle;
+// on_sphere projects them onto the sphere of that radius
+inline void spreadLeds(const Polygon& face, size_t count, double on_sphere, std::vector<Vec3>& out) {
+    Vec3 centre{0, 0, 0};
+    for (const auto& v : face) centre = centre + v;
+    centre = centre * (1.0 / face.size());
+    const Vec3 normal = (face[1] - face[0]).cross(face[2] - face[0]).normalized();
+    const Vec3 u = (face[0] - centre).normalized();
+    const Vec3 w = normal.cross(u);
+    // Inscribed radius: distance from the centre to the first edge's midpoint
+    const double inner = ((face[0] + face[1]) * 0.5 - centre).length() * 0.95;
+
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (size_t j = 0; j < count; ++j) {
+        const double r = inner * std::sqrt((j + 0.5) / count);
+        const double a = j * golden_angle;
+        Vec3 p = centre + u * (r * std::cos(a)) + w * (r * std::sin(a));
+        if (on_sphere > 0.0) p = p.normalized() * on_sphere;
+        out.push_back(p);
+    }
+}
+
+inline std::vector<uint8_t> build(const std::string& name, const std::vector<Polygon>& faces,
+                                  size_t leds, double on_sphere) {
+    const size_t per_face = std::min(leds / faces.size(), Limits::MAX_LEDS_PER_FACE);
+    std::vector<Vec3> points;
+    points.reserve(per_face * faces.size());
+    for (const auto& face : faces) spreadLeds(face, per_face, on_sphere, points);
+
+    ModelBlobWriter writer;
+    writer.setMetadata(name, "1.0", "Synthetic " + name + ", " + std::to_string(points.size()) + " LEDs", name);
+    ModelBlob::FaceTypeRecord face_type;
+    face_type.type = static_cast<FaceType>(faces[0].size());
+    face_type.num_leds = static_cast<uint16_t>(per_face);
+    face_type.edge_length_mm = static_cast<float>((faces[0][1] - faces[0][0]).length());
+    writer.addFaceType(face_type);
+
+    for (size_t f = 0; f < faces.size(); ++f) {
+        ModelBlob::FaceRecord record;
+        record.id = static_cast<uint8_t>(f);
+        record.vertex_count = static_cast<uint8_t>(faces[f].size());
+        for (size_t v = 0; v < faces[f].size(); ++v) {
+            record.vertices[v] = {float(faces[f][v].x), float(faces[f][v].y), float(faces[f][v].z)};
+        }
+        writer.addFace(record);
+    }
+
+    std::vector<float> xyz;
+    xyz.reserve(points.size() * 3);
+    double radius = 0.0;
+    for (const auto& p : points) {
+        xyz.insert(xyz.end(), {float(p.x), float(p.y), float(p.z)});
+        radius = std::max(radius, p.length());
+    }
+    writer.setSphereRadius(float(radius));
+
+    KdTree tree;
+    tree.build(xyz.data(), points.size());
+    KdTree::Result found[Limits::MAX_NEIGHBORS];
+    ModelBlob::NeighborRecord neighbors[Limits::MAX_NEIGHBORS];
+    for (size_t i = 0; i < points.size(); ++i) {
+        const size_t n = tree.nearest(xyz[i * 3], xyz[i * 3 + 1], xyz[i * 3 + 2], Limits::MAX_NEIGHBORS,
+                                      float(radius), found, i);
+        for (size_t k = 0; k < n; ++k) neighbors[k] = {uint16_t(found[k].index), std::sqrt(found[k].distance_sq)};
+        ModelBlob::PointRecord point;
+        point.id = static_cast<uint16_t>(i);
+        point.face_id = static_cast<uint8_t>(i / per_face);
+        point.x = xyz[i * 3];
+        point.y = xyz[i * 3 + 1];
+        point.z = xyz[i * 3 + 2];
+        writer.addPoint(point, neighbors, n);
+    }
+    return writer.finish();
+}
+
+/**
+ * @brief An icosahedron of the given radius, each triangle split into
+ * frequency² smaller ones, with the LEDs projected onto the sphere. The
+ * frequency is the lowest that keeps faces within MAX_LEDS_PER_FACE.
+ */
+inline std::vector<uint8_t> geodesicSphere(size_t leds, double radius = 300.0) {
+    const double phi = (1.0 + std::sqrt(5.0)) / 2.0;
+    const Vec3 v[12] = {{-1, phi, 0}, {1, phi, 0}, {-1, -phi, 0}, {1, -phi, 0},
+                        {0, -1, phi}, {0, 1, phi}, {0, -1, -phi}, {0, 1, -phi},
+                        {phi, 0, -1}, {phi, 0, 1}, {-phi, 0, -1}, {-phi, 0, 1}};
+    const int tris[20][3] = {{0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+                             {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+                             {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+                             {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}};
+    size_t frequency = 1;
+    while (20 * frequency * frequency * Limits::MAX_LEDS_PER_FACE < leds) ++frequency;
+
+    std::vector<Polygon> faces;
+    auto onSphere = [radius](const Vec3& p) { return p.normalized() * radius; };
+    for (const auto& t : tris) {
+        const Vec3 a = v[t[0]], b = v[t[1]], c = v[t[2]];
+        const double f = double(frequency);
+        auto at = [&](size_t i, size_t j) { return onSphere(a + (b - a) * (i / f) + (c - a) * (j / f)); };
+        for (size_t i = 0; i < frequency; ++i) {
+            for (size_t j = 0; i + j < frequency; ++j) {
+                faces.push_back({at(i, j), at(i + 1, j), at(i, j + 1)});
+                if (i + j + 1 < frequency) faces.push_back({at(i + 1, j), at(i + 1, j + 1), at(i, j + 1)});
+            }
+        }
+    }
+    return build("GeodesicSphere", faces, leds, radius);
+}
+
+/**
+ * @brief A row of regular dodecahedra, centred on the origin, each with
+ * circumradius radius. Uses as many as it takes to keep faces within
+ * MAX_LEDS_PER_FACE: one up to 1536 LEDs, seven for 10,000.
+ */
+inline std::vector<uint8_t> dodecahedronArray(size_t leds, double radius = 150.0) {
+    const double phi = (1.0 + std::sqrt(5.0)) / 2.0;
+    std::vector<Vec3> vertices;
+    for (int x : {-1, 1})
+        for (int y : {-1, 1})
+            for (int z : {-1, 1}) vertices.push_back({double(x), double(y), double(z)});
+    for (int a : {-1, 1}) {
+        for (int b : {-1, 1}) {
+            vertices.push_back({0, a / phi, b * phi});
+            vertices.push_back({a / phi, b * phi, 0});
+            vertices.push_back({a * phi, 0, b / phi});
+        }
+    }
+    for (auto& p : vertices) p = p.normalized() * radius;
+
+    // Face normals are the icosahedron's vertices; each face is the five
+    // dodecahedron vertices furthest along its normal, in order around it
+    std::vector<Polygon> one;
+    for (int a : {-1, 1}) {
+        for (int b : {-1, 1}) {
+            for (const Vec3& n : {Vec3{0, double(a), b * phi}, Vec3{double(a), b * phi, 0}, Vec3{a * phi, 0, double(b)}}) {
+                std::vector<Vec3> sorted = vertices;
+                std::sort(sorted.begin(), sorted.end(), [&](const Vec3& p, const Vec3& q) { return p.dot(n) > q.dot(n); });
+                sorted.resize(5);
+                const Vec3 axis = n.normalized();
+                const Vec3 u = (sorted[0] - axis * sorted[0].dot(axis)).normalized();
+                const Vec3 w = axis.cross(u);
+                std::sort(sorted.begin(), sorted.end(), [&](const Vec3& p, const Vec3& q) {
+                    return std::atan2(p.dot(w), p.dot(u)) < std::atan2(q.dot(w), q.dot(u));
+                });
+                one.push_back(sorted);
+            }
+        }
+    }
+
+    size_t count = 1;
+    while (count * one.size() * Limits::MAX_LEDS_PER_FACE < leds) ++count;
+    std::vector<Polygon> faces;
+    const double spacing = radius * 2.5;
+    for (size_t d = 0; d < count; ++d) {
+        const Vec3 offset{(d - (count - 1) / 2.0) * spacing, 0, 0};
+        for (const auto& face : one) {
+            Polygon moved;
+            for (const auto& p : face) moved.push_back(p + offset);
+            faces.push_back(moved);
+        }
+    }
+    return build("DodecahedronArray", faces, leds, 0.0);
+}
+
+} // namespace SyntheticModel
+} // namespace PixelTheater::Testing
@@ -0,0 +1,127 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/core/arena.h"
+#include "PixelTheater/core/fixed_containers.h"
+#include "PixelTheater/core/crgb.h"
+
+using namespace PixelTheater;
+
+TEST_SUITE("Arena") {
+    TEST_CASE("allocates from one block until full") {
+        Arena arena;
+        CHECK(arena.allocate<int>(1) == nullptr);   // Nothing reserved yet
+
+        arena.reserve(64);
+        CHECK(arena.capacity() == 64);
+        int* a = arena.allocate<int>(4);
+        REQUIRE(a != nullptr);
+        CHECK(a[0] == 0);                           // Value-initialised
+        CHECK(a[3] == 0);
+        CHECK(arena.used() == 4 * sizeof(int));
+
+        CHECK(arena.allocate<uint8_t>(100) == nullptr);
+        CHECK(arena.used() == 4 * sizeof(int));     // A failed allocation takes nothing
+    }
+
+    TEST_CASE("respects alignment") {
+        Arena arena(64);
+        arena.allocate<uint8_t>(1);
+        double* d = arena.allocate<double>(1);
+        REQUIRE(d != nullptr);
+        CHECK(reinterpret_cast<uintptr_t>(d) % alignof(double) == 0);
+    }
+
+    TEST_CASE("reset reuses the block") {
+        Arena arena(32);
+        CRGB* first = arena.allocate<CRGB>(4);
+        arena.reset();
+        CHECK(arena.used() == 0);
+        CHECK(arena.allocate<CRGB>(4) == first);
+        CHECK(arena.high_water() == 4 * sizeof(CRGB));
+
+        arena.reserve(16);                          // Smaller: keeps the block
+        CHECK(arena.capacity() == 32);
+        arena.reserve(128);                         // Larger: new, empty block
+        CHECK(arena.capacity() == 128);
+        CHECK(arena.used() == 0);
+    }
+
+    TEST_CASE("create constructs in place") {
+        struct Point { int x, y; Point(int x_, int y_) : x(x_), y(y_) {} };
+        Arena arena(64);
+        Point* p = arena.create<Point>(3, 4);
+        REQUIRE(p != nullptr);
+        CHECK(p->x == 3);
+        CHECK(p->y == 4);
+    }
+}
+
+TEST_SUITE("Fixed containers") {
+    TEST_CASE("FixedVector stops at capacity") {
+        FixedVector<int, 3> v;
+        CHECK(v.push_back(1));
+        CHECK(v.push_back(2));
+        CHECK(v.emplace_back(3));
+        CHECK_FALSE(v.push_back(4));
+        CHECK(v.size() == 3);
+        CHECK(v.full());
+
+        int sum = 0;
+        for (int x : v) sum += x;
+        CHECK(sum == 6);
+
+        v.erase_swap(0);                            // Last item moves into slot 0
+        CHECK(v.size() == 2);
+        CHECK(v[0] == 3);
+        CHECK(v.back() == 2);
+
+        v.clear();
+        CHECK(v.empty());
+    }
+
+    TEST_CASE("FixedPool hands out and reclaims slots") {
+        FixedPool<int, 2> pool;
+        int* a = pool.acquire(10);
+        int* b = pool.acquire(20);
+        REQUIRE(a != nullptr);
+        REQUIRE(b != nullptr);
+        CHECK(pool.acquire(30) == nullptr);
+        CHECK(pool.full());
+
+        pool.release(a);
+        CHECK(pool.size() == 1);
+        int* c = pool.acquire(40);
+        CHECK(c == a);                              // Freed slot is reused
+        CHECK(*c == 40);
+
+        int sum = 0;
+        pool.for_each([&](int& x) { sum += x; });
+        CHECK(sum == 60);
+
+        int outside = 0;
+        CHECK(pool.index_of(&outside) == pool.capacity());
+        pool.release(&outside);                     // Not ours: ignored
+        CHECK(pool.size() == 2);
+    }
+
+    TEST_CASE("RingBuffer overwrites the oldest") {
+        RingBuffer<int, 3> ring;
+        ring.push(1);
+        ring.push(2);
+        CHECK(ring.oldest() == 1);
+        CHECK(ring.newest() == 2);
+
+        ring.push(3);
+        ring.push(4);                               // Drops 1
+        CHECK(ring.size() == 3);
+        CHECK(ring[0] == 2);
+        CHECK(ring.newest() == 4);
+        CHECK(ring.newest(2) == 2);
+
+        int out = 0;
+        CHECK(ring.pop(out));
+        CHECK(out == 2);
+        CHECK(ring.size() == 2);
+        ring.clear();
+        CHECK_FALSE(ring.pop(out));
+    }
+}
@@ -0,0 +1,163 @@
+#include <doctest/doctest.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "PixelTheater/core/binary_log.h"
+
+using namespace PixelTheater;
+
+namespace {
+    struct Captured {
+        Log::Level level;
+        std::string text;
+    };
+
+    std::vector<Captured> drainAll(BinaryLog& log) {
+        std::vector<Captured> lines;
+        log.drain([&](Log::Level level, uint32_t, const char* text) { lines.push_back({level, text}); });
+        return lines;
+    }
+}
+
+TEST_SUITE("BinaryLog") {
+    TEST_CASE("formats recorded arguments later") {
+        static BinaryLog log;   // 4 KB ring: keep it off the stack
+        CHECK(log.record(Log::Info, "int %d, unsigned %u, hex %04x", -5, 7u, 0xbeef));
+        CHECK(log.record(Log::Warning, "float %.2f double %.3f", 3.14159f, 2.5));
+        CHECK(log.record(Log::Error, "text '%s' and %-6s|", "hello", "pad"));
+        CHECK(log.record(Log::Info, "size %zu, long %lld, 100%%", size_t(1248), -1234567890123LL));
+        CHECK(log.record(Log::Debug, "no arguments"));
+
+        auto lines = drainAll(log);
+        REQUIRE(lines.size() == 5);
+        CHECK(lines[0].level == Log::Info);
+        CHECK(lines[0].text == "int -5, unsigned 7, hex beef");
+        CHECK(lines[1].level == Log::Warning);
+        CHECK(lines[1].text == "float 3.14 double 2.500");
+        CHECK(lines[2].text == "text 'hello' and pad   |");
+        CHECK(lines[3].text == "size 1248, long -1234567890123, 100%");
+        CHECK(lines[4].text == "no arguments");
+        CHECK(log.pending() == 0);
+        CHECK(log.formatCount() == 5);
+    }
+
+    TEST_CASE("copies string arguments") {
+        static BinaryLog log;
+        char name[16] = "first";
+        log.record(Log::Info, "scene %s", name);
+        std::snprintf(name, sizeof(name), "changed");
+        auto lines = drainAll(log);
+        REQUIRE(lines.size() == 1);
+        CHECK(lines[0].text == "scene first");
+    }
+
+    TEST_CASE("mismatched or missing arguments don't crash") {
+        static BinaryLog log;
+        log.record(Log::Info, "%s and %d", 42);
+        auto lines = drainAll(log);
+        REQUIRE(lines.size() == 1);
+        CHECK(lines[0].text == "<?> and <?>");
+    }
+
+    TEST_CASE("drops when full and recovers") {
+        static BinaryLog log;
+        size_t accepted = 0;
+        for (int i = 0; i < 1000; ++i) {
+            if (log.record(Log::Info, "frame %d value %f", i, 1.0f)) accepted++;
+        }
+        CHECK(accepted < 1000);
+        CHECK(log.dropped() == 1000 - accepted);
+        CHECK(drainAll(log).size() == accepted);
+        CHECK(log.record(Log::Info, "frame %d value %f", 1, 1.0f));
+        CHECK(drainAll(log).size() == 1);
+    }
+
+    TEST_CASE("host decoder reads the raw stream") {
+        static BinaryLog log;
+        for (int i = 0; i < 3; ++i) log.record(Log::Info, "tick %d of %s", i, "boids");
+        log.record(Log::Error, "bad %.1f", 0.5f);
+
+        uint8_t raw[BinaryLog::CAPACITY];
+        const size_t size = log.read(raw, sizeof(raw));
+        CHECK(size > 0);
+        CHECK(log.pending() == 0);
+
+        // Fed a byte at a time, as from a serial port
+        LogDecoder decoder;
+        std::vector<LogDecoder::Line> lines;
+        LogDecoder::Line line;
+        for (size_t i = 0; i < size; ++i) {
+            decoder.feed(raw + i, 1);
+            while (decoder.next(line)) lines.push_back(line);
+        }
+        REQUIRE(lines.size() == 4);
+        CHECK(lines[0].text == "tick 0 of boids");
+        CHECK(lines[2].text == "tick 2 of boids");
+        CHECK(lines[3].level == Log::Error);
+        CHECK(lines[3].text == "bad 0.5");
+        CHECK(decoder.unknown() == 0);
+
+        // A decoder that joins late needs the formats again
+        log.record(Log::Info, "tick %d of %s", 9, "boids");
+        LogDecoder late;
+        const size_t more = log.read(raw, sizeof(raw));
+        late.feed(raw, more);
+        REQUIRE(late.next(line));
+        CHECK(late.unknown() == 1);
+
+        log.resendFormats();
+        log.record(Log::Info, "tick %d of %s", 10, "boids");
+        late.feed(raw, log.read(raw, sizeof(raw)));
+        REQUIRE(late.next(line));
+        CHECK(line.text == "tick 10 of boids");
+    }
+
+    TEST_CASE("compile-time level filter") {
+        static_assert(Log::enabled(Log::Error), "errors are on by default");
+        static_assert(Log::enabled(Log::Info), "info is on by default");
+        static_assert(!Log::enabled(Log::Debug), "debug compiles out by default");
+        static_assert(!Log::enabled(Log::Off), "Off is never a message level");
+    }
+
+    TEST_CASE("per-call cost") {
+        constexpr int CALLS = 64 * 300;
+        using clock = std::chrono::high_resolution_clock;
+        auto ns = [](clock::time_point a, clock::time_point b) {
+            return std::chrono::duration<double, std::nano>(b - a).count() / CALLS;
+        };
+        volatile int sink = 0;
+
+        // What the immediate path does before handing the text to the platform
+        char buffer[256];
+        auto t0 = clock::now();
+        for (int i = 0; i < CALLS; ++i) {
+            sink = sink + std::snprintf(buffer, sizeof(buffer), "speed_limit changed (%.2f -> %.2f), boid %d",
+                                        1.5f * i, 2.5f, i);
+        }
+        auto t1 = clock::now();
+
+        // Timed in batches that fit the ring; formatting happens between them
+        static BinaryLog log;
+        constexpr int BATCH = 64;
+        double record_ns = 0;
+        double format_ns = 0;
+        for (int i = 0; i < CALLS; i += BATCH) {
+            auto a = clock::now();
+            for (int j = i; j < i + BATCH; ++j) {
+                log.record(Log::Info, "speed_limit changed (%.2f -> %.2f), boid %d", 1.5f * j, 2.5f, j);
+            }
+            auto b = clock::now();
+            log.drain([&](Log::Level, uint32_t, const char* text) { sink = sink + text[0]; });
+            auto c = clock::now();
+            record_ns += std::chrono::duration<double, std::nano>(b - a).count();
+            format_ns += std::chrono::duration<double, std::nano>(c - b).count();
+        }
+
+        MESSAGE("immediate snprintf " << ns(t0, t1) << " ns/call, deferred record "
+                << record_ns / CALLS << " ns/call, later format " << format_ns / CALLS
+                << " ns/call, disabled level: compiled out");
+        CHECK(log.dropped() == 0);
+    }
+}
@@ -0,0 +1,100 @@
+#include <doctest/doctest.h>
+#include <chrono>
+#include <cstdio>
+
+#include "PixelTheater/core/cycle_counter.h"
+
+using namespace PixelTheater;
+using CycleCounter::Ticks;
+
+namespace {
+    // Synthetic counters with known behaviour
+    Ticks g_clock = 0;
+    size_t g_reads = 0;
+
+    // Every read costs 7 ticks, and the counter shows each one
+    Ticks fine_clock() { return g_clock += 7; }
+
+    // Moves in steps of 1000 every 16 reads, like a microsecond timer read in ns
+    Ticks coarse_clock() { return (++g_reads / 16) * 1000; }
+
+    // Sum of a small kernel, kept from being optimised away
+    volatile uint32_t g_sink = 0;
+    void kernel(int n) {
+        uint32_t acc = g_sink;
+        for (int i = 0; i < n; ++i) acc = acc * 1664525u + 1013904223u;
+        g_sink = acc;
+    }
+}
+
+TEST_SUITE("CycleCounter") {
+    TEST_CASE("overhead and resolution of a fine counter") {
+        g_clock = 0;
+        const auto cal = CycleCounter::measure(fine_clock, 0.5, "fine", 100);
+        CHECK(cal.overhead == 7);
+        CHECK(cal.resolution == 7);
+        CHECK(cal.overhead_ns() == doctest::Approx(3.5));
+        CHECK(cal.resolution_ns() == doctest::Approx(3.5));
+    }
+
+    TEST_CASE("a coarse counter reports its step, not its read cost") {
+        g_reads = 0;
+        const auto cal = CycleCounter::measure(coarse_clock, 1.0, "coarse", 100);
+        CHECK(cal.overhead == 0);          // Two reads in a row usually see the same value
+        CHECK(cal.resolution == 1000);
+        CHECK(cal.resolution_ns() == doctest::Approx(1000.0));
+    }
+
+    TEST_CASE("platform counter is calibrated to ns") {
+        const auto& cal = CycleCounter::calibration();
+        CHECK(cal.source[0] != '\0');
+        CHECK(cal.ns_per_tick > 0.0);
+        CHECK(cal.overhead_ns() < 1000.0);      // A read costs well under a microsecond
+        CHECK(cal.resolution_ns() > 0.0);
+        CHECK(cal.resolution_ns() < 1000.0);    // Finer than micros()
+
+        // Against the standard clock over a few milliseconds: within 2%
+        using clock = std::chrono::steady_clock;
+        const auto a = clock::now();
+        const Ticks start = CycleCounter::now();
+        while (clock::now() - a < std::chrono::milliseconds(5)) {}
+        const Ticks end = CycleCounter::now();
+        const auto b = clock::now();
+        const double reference = std::chrono::duration<double, std::nano>(b - a).count();
+        CHECK(CycleCounter::elapsedNs(start, end) == doctest::Approx(reference).epsilon(0.02));
+    }
+
+    TEST_CASE("overhead is subtracted from intervals") {
+        const auto& cal = CycleCounter::calibration();
+        constexpr int RUNS = 2000;
+
+        // Nothing between the reads: compensation leaves at most jitter
+        uint32_t empty_min = UINT32_MAX;
+        for (int i = 0; i < RUNS; ++i) {
+            const Ticks a = CycleCounter::now();
+            const Ticks b = CycleCounter::now();
+            const uint32_t ns = CycleCounter::elapsedNs(a, b);
+            if (ns < empty_min) empty_min = ns;
+        }
+        CHECK(empty_min <= cal.resolution_ns() + 1.0);     // Within one step of the counter
+
+        // A kernel of a few hundred cycles, far below micros() resolution
+        uint64_t total = 0;
+        uint32_t kernel_min = UINT32_MAX;
+        for (int i = 0; i < RUNS; ++i) {
+            const Ticks a = CycleCounter::now();
+            kernel(100);
+            const Ticks b = CycleCounter::now();
+            const uint32_t ns = CycleCounter::elapsedNs(a, b);
+            total += ns;
+            if (ns < kernel_min) kernel_min = ns;
+        }
+        CHECK(kernel_min > 0);
+        CHECK(kernel_min < 1000);
+
+        MESSAGE("timer " << cal.source << ": " << cal.ns_per_tick << " ns/tick, resolution "
+                << cal.resolution_ns() << " ns, overhead " << cal.overhead_ns()
+                << " ns; 100-step kernel min " << kernel_min << " ns, mean "
+                << static_cast<double>(total) / RUNS << " ns");
+    }
+}
@@ -0,0 +1,210 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/core/dirty_tracker.h"
+#include "PixelTheater/core/led_buffer_wrapper.h"
+#include "PixelTheater/core/model_wrapper.h"
+#include "PixelTheater/model/model.h"
+#include "PixelTheater/model/runtime_model.h"
+#include "PixelTheater/theater.h"
+#include "fixtures/models/basic_pentagon_model.h"
+#include "synthetic_model.h"
+
+#include <chrono>
+#include <utility>
+#include <vector>
+
+using namespace PixelTheater;
+using namespace PixelTheater::Fixtures;
+
+namespace {
+
+std::vector<std::pair<size_t, size_t>> dirtyRanges(const DirtyTracker& tracker) {
+    std::vector<std::pair<size_t, size_t>> ranges;
+    tracker.forEachDirtyRange([&](size_t first, size_t count) { ranges.push_back({first, count}); });
+    return ranges;
+}
+
+// Lights one LED per frame, moving along the buffer
+class SparseTestScene : public Scene {
+public:
+    bool track = true;
+    void setup() override { set_dirty_tracking(track); }
+    void tick() override {
+        Scene::tick();
+        leds[(tick_count() - 1) % ledCount()] = CRGB(255, 0, 0);
+    }
+};
+
+class UntrackedTestScene : public Scene {
+public:
+    void setup() override {}
+    void tick() override { Scene::tick(); }
+};
+
+} // namespace
+
+TEST_SUITE("DirtyTracker") {
+    TEST_CASE("first capture marks everything, then only real changes") {
+        CRGB buffer[70] = {};
+        LedBufferWrapper leds(buffer, 70);
+        DirtyTracker tracker;
+        tracker.reset(70);
+        CHECK(tracker.frame() == 0);
+
+        tracker.capture(leds);
+        CHECK(tracker.frame() == 1);
+        CHECK(tracker.dirtyCount() == 70);
+        CHECK(dirtyRanges(tracker) == std::vector<std::pair<size_t, size_t>>{{0, 70}});
+
+        // Nothing changed
+        tracker.capture(leds);
+        CHECK_FALSE(tracker.anyDirty());
+        CHECK(dirtyRanges(tracker).empty());
+
+        // Writing the same colour back is not a change
+        leds.led(3) = CRGB(0, 0, 0);
+        leds.led(5) = CRGB(1, 2, 3);
+        for (size_t i = 30; i < 66; ++i) leds.led(i) = CRGB(9, 9, 9); // Spans a word boundary
+        leds.led(69) = CRGB(0, 0, 1);
+        tracker.capture(leds);
+        CHECK(tracker.dirtyCount() == 38);
+        CHECK_FALSE(tracker.isDirty(3));
+        CHECK(tracker.isDirty(5));
+        CHECK(tracker.isDirty(69));
+        CHECK_FALSE(tracker.isDirty(70)); // Out of range
+        CHECK(dirtyRanges(tracker) == std::vector<std::pair<size_t, size_t>>{{5, 1}, {30, 36}, {69, 1}});
+
+        tracker.invalidate();
+        tracker.capture(leds);
+        CHECK(tracker.dirtyCount() == 70);
+    }
+
+    TEST_CASE("changed since frame N") {
+        CRGB buffer[10] = {};
+        LedBufferWrapper leds(buffer, 10);
+        DirtyTracker tracker;
+        tracker.reset(10);
+        tracker.capture(leds);                  // Frame 1: everything
+        const uint32_t seen = tracker.frame();
+
+        leds.led(2) = CRGB(1, 0, 0);
+        tracker.capture(leds);                  // Frame 2
+        leds.led(7) = CRGB(0, 1, 0);
+        tracker.capture(leds);                  // Frame 3
+        tracker.capture(leds);                  // Frame 4: nothing
+
+        CHECK_FALSE(tracker.isDirty(2));        // Only the latest frame
+        CHECK(tracker.changedSince(2, seen));
+        CHECK(tracker.changedSince(7, seen));
+        CHECK_FALSE(tracker.changedSince(7, 3));
+        CHECK_FALSE(tracker.changedSince(0, seen));
+
+        std::vector<size_t> changed;
+        tracker.forEachChangedSince(seen, [&](size_t i) { changed.push_back(i); });
+        CHECK(changed == std::vector<size_t>{2, 7});
+    }
+
+    TEST_CASE("per-face flags follow face LED ranges") {
+        CRGB buffer[BasicPentagonModel::LED_COUNT] = {};
+        ModelWrapper<BasicPentagonModel> model(std::make_unique<Model<BasicPentagonModel>>(buffer));
+        LedBufferWrapper leds(buffer, BasicPentagonModel::LED_COUNT);
+        DirtyTracker tracker;
+        tracker.reset(BasicPentagonModel::LED_COUNT);
+        tracker.setFaces(model);
+        tracker.capture(leds);
+        CHECK(tracker.dirtyFaceCount() == 3);
+
+        // Write through the face, not the buffer: still seen
+        const Face& face = model.face(1);
+        buffer[face.led_offset() + face.led_count() - 1] = CRGB(0, 0, 255);
+        tracker.capture(leds);
+        CHECK(tracker.dirtyFaceCount() == 1);
+        CHECK_FALSE(tracker.faceDirty(0));
+        CHECK(tracker.faceDirty(1));
+        CHECK_FALSE(tracker.faceDirty(2));
+        CHECK_FALSE(tracker.faceDirty(40)); // Out of range
+
+        tracker.capture(leds);
+        CHECK(tracker.dirtyFaceCount() == 0);
+    }
+
+    TEST_CASE("per-face flags reach every face of a large model") {
+        const auto blob = Testing::SyntheticModel::geodesicSphere(Limits::ABSOLUTE_MAX_LEDS);
+        RuntimeModel model;
+        REQUIRE(model.load(blob.data(), blob.size()));
+        const size_t faces = model.faceCount();
+        REQUIRE(faces > 32);
+
+        std::vector<CRGB> buffer(model.pointCount());
+        LedBufferWrapper leds(buffer.data(), buffer.size());
+        DirtyTracker tracker;
+        tracker.reset(buffer.size());
+        tracker.setFaces(model);
+        tracker.capture(leds);
+        CHECK(tracker.dirtyFaceCount() == faces);
+
+        // One LED in the last face
+        const Face& last = model.face(faces - 1);
+        buffer[last.led_offset()] = CRGB(1, 2, 3);
+        tracker.capture(leds);
+        CHECK(tracker.dirtyFaceCount() == 1);
+        CHECK(tracker.faceDirty(faces - 1));
+        CHECK_FALSE(tracker.faceDirty(faces - 2));
+    }
+
+    TEST_CASE("Theater tracks only scenes that ask for it") {
+        Theater theater;
+        theater.useNativePlatform<BasicPentagonModel>(BasicPentagonModel::LED_COUNT);
+        theater.addScene<SparseTestScene>();
+        theater.addScene<UntrackedTestScene>();
+        theater.start();
+
+        const DirtyTracker* tracker = theater.dirtyTracker();
+        REQUIRE(tracker != nullptr);
+        theater.update();
+        CHECK(tracker->dirtyCount() == BasicPentagonModel::LED_COUNT); // First frame is all new
+        theater.update();
+        CHECK(tracker->dirtyCount() == 1);
+        CHECK(tracker->isDirty(1));
+
+        theater.nextScene();
+        CHECK(theater.dirtyTracker() == nullptr);
+
+        theater.nextScene(); // Back to the tracked scene: starts from a full frame again
+        REQUIRE(theater.dirtyTracker() == tracker);
+        theater.update();
+        CHECK(tracker->dirtyCount() == BasicPentagonModel::LED_COUNT);
+    }
+
+    TEST_CASE("benchmark: capture overhead") {
+        const size_t count = 1248; // DodecaRGBv2
+        std::vector<CRGB> buffer(count);
+        LedBufferWrapper leds(buffer.data(), count);
+        DirtyTracker tracker;
+        tracker.reset(count);
+        tracker.capture(leds);
+
+        auto us = [](auto a, auto b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+        const int frames = 500;
+
+        // Sparse: a few LEDs change per frame
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < frames; ++f) {
+            for (size_t k = 0; k < 20; ++k) buffer[(f * 37 + k * 61) % count].r++;
+            tracker.capture(leds);
+        }
+        auto mid = std::chrono::high_resolution_clock::now();
+        size_t sparse_dirty = tracker.dirtyCount();
+
+        // Dense: everything changes every frame
+        for (int f = 0; f < frames; ++f) {
+            for (size_t i = 0; i < count; ++i) buffer[i].g++;
+            tracker.capture(leds);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        CHECK(sparse_dirty <= 20);
+        CHECK(tracker.dirtyCount() == count);
+        MESSAGE("capture of " << count << " LEDs: sparse " << us(start, mid) / frames
+                << " us/frame, dense " << us(mid, end) / frames << " us/frame (dense includes the writes)");
+    }
+}
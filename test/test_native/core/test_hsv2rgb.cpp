@@ -0,0 +1,158 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/color/conversions.h"
+#include "PixelTheater/core/crgb.h"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+// hsv2rgb_rainbow() as it was before the lookup tables: branches on the hue
+// section, then desaturates and scales by value with scale8_video()
+CRGB referenceRainbow(const CHSV& hsv) {
+    if (hsv.sat == 0) return CRGB(hsv.val, hsv.val, hsv.val);
+
+    const uint8_t hue = hsv.hue, sat = hsv.sat, val = hsv.val;
+    const uint8_t offset8 = (hue & 0x1F) << 3;
+    const uint8_t third = scale8(offset8, 256 / 3);
+    const uint8_t twothirds = scale8(offset8, (256 * 2) / 3);
+    uint8_t r, g, b;
+    if (!(hue & 0x80)) {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) { r = 255 - third; g = third; b = 0; }
+            else { r = 171; g = 85 + third; b = 0; }
+        } else {
+            if (!(hue & 0x20)) { r = 171 - twothirds; g = 170 + third; b = 0; }
+            else { r = 0; g = 255 - third; b = third; }
+        }
+    } else {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) { r = 0; g = 171 - twothirds; b = 85 + third; }
+            else { r = third; g = 0; b = 255 - third; }
+        } else {
+            if (!(hue & 0x20)) { r = 85 + third; g = 0; b = 171 - twothirds; }
+            else { r = 170; g = 0; b = 85; }
+        }
+    }
+
+    if (sat != 255) {
+        uint8_t desat = 255 - sat;
+        desat = ((int)desat * (int)desat >> 8) + (desat ? 1 : 0);
+        const uint8_t satscale = 255 - desat;
+        if (r) r = ((int)r * (int)satscale >> 8) + (satscale ? 1 : 0);
+        if (g) g = ((int)g * (int)satscale >> 8) + (satscale ? 1 : 0);
+        if (b) b = ((int)b * (int)satscale >> 8) + (satscale ? 1 : 0);
+        r += desat;
+        g += desat;
+        b += desat;
+    }
+    if (val != 255) {
+        if (val == 0) {
+            r = g = b = 0;
+        } else {
+            if (r) r = ((int)r * (int)val >> 8) + 1;
+            if (g) g = ((int)g * (int)val >> 8) + 1;
+            if (b) b = ((int)b * (int)val >> 8) + 1;
+        }
+    }
+    return CRGB(r, g, b);
+}
+
+bool same(const std::vector<CRGB>& a, const std::vector<CRGB>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(CRGB)) == 0;
+}
+
+} // namespace
+
+TEST_SUITE("hsv2rgb_rainbow") {
+    TEST_CASE("every hue, saturation and value matches the branching conversion") {
+        size_t mismatches = 0;
+        for (int h = 0; h < 256; ++h) {
+            for (int s = 0; s < 256; ++s) {
+                for (int v = 0; v < 256; ++v) {
+                    const CHSV hsv(h, s, v);
+                    CRGB rgb;
+                    hsv2rgb_rainbow(hsv, rgb);
+                    mismatches += !(rgb == referenceRainbow(hsv));
+                }
+            }
+        }
+        CHECK(mismatches == 0);
+    }
+
+    TEST_CASE("batch conversions match one pixel at a time") {
+        std::mt19937 rng(46);
+        for (int count : {0, 1, 255, 256, 257, 1248}) {
+            std::vector<CHSV> hsv(count);
+            std::vector<uint8_t> hue(count), sat(count), val(count);
+            for (int i = 0; i < count; ++i) {
+                hsv[i] = CHSV(rng() & 0xFF, rng() & 0xFF, rng() & 0xFF);
+                hue[i] = hsv[i].hue;
+                sat[i] = hsv[i].sat;
+                val[i] = hsv[i].val;
+            }
+            std::vector<CRGB> expected(count), out(count);
+            for (int i = 0; i < count; ++i) expected[i] = referenceRainbow(hsv[i]);
+
+            hsv2rgb_rainbow(hsv.data(), out.data(), count);
+            CHECK(same(out, expected));
+
+            std::fill(out.begin(), out.end(), CRGB(1, 2, 3));
+            hsv2rgb_rainbow(hue.data(), sat.data(), val.data(), out.data(), count);
+            CHECK(same(out, expected));
+
+            // Shared saturation and value, including the full-brightness shortcut
+            for (auto sv : {std::make_pair(255, 255), std::make_pair(255, 90), std::make_pair(0, 200),
+                            std::make_pair(140, 255)}) {
+                for (int i = 0; i < count; ++i) expected[i] = referenceRainbow(CHSV(hue[i], sv.first, sv.second));
+                hsv2rgb_rainbow(hue.data(), sv.first, sv.second, out.data(), count);
+                CHECK(same(out, expected));
+            }
+        }
+    }
+
+    TEST_CASE("benchmark: HSV to RGB over 1248 LEDs") {
+        constexpr int LEDS = 1248;
+        constexpr int FRAMES = 2000;
+        std::mt19937 rng(7);
+        std::vector<CHSV> hsv(LEDS);
+        std::vector<uint8_t> hue(LEDS), sat(LEDS), val(LEDS);
+        for (int i = 0; i < LEDS; ++i) {
+            hsv[i] = CHSV(rng() & 0xFF, rng() & 0xFF, rng() & 0xFF);
+            hue[i] = hsv[i].hue;
+            sat[i] = hsv[i].sat;
+            val[i] = hsv[i].val;
+        }
+        std::vector<CRGB> out(LEDS);
+        using clock = std::chrono::high_resolution_clock;
+        auto us = [](auto a, auto b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+        uint32_t sink = 0;
+        auto time = [&](auto&& frame) {
+            const auto start = clock::now();
+            for (int f = 0; f < FRAMES; ++f) {
+                hsv[f % LEDS].hue++;        // Keep the compiler from hoisting the work
+                hue[f % LEDS]++;
+                frame();
+                sink += out[f % LEDS].r;
+            }
+            return us(start, clock::now()) / FRAMES;
+        };
+
+        const double branching = time([&] { for (int i = 0; i < LEDS; ++i) out[i] = referenceRainbow(hsv[i]); });
+        const double single = time([&] { for (int i = 0; i < LEDS; ++i) hsv2rgb_rainbow(hsv[i], out[i]); });
+        const double aos = time([&] { hsv2rgb_rainbow(hsv.data(), out.data(), LEDS); });
+        const double soa = time([&] { hsv2rgb_rainbow(hue.data(), sat.data(), val.data(), out.data(), LEDS); });
+        const double dimmed = time([&] { hsv2rgb_rainbow(hue.data(), 255, 160, out.data(), LEDS); });
+        const double rainbow = time([&] { hsv2rgb_rainbow(hue.data(), 255, 255, out.data(), LEDS); });
+        const double copy = time([&] { for (int i = 0; i < LEDS; ++i) out[i] = CRGB(hsv[i].h, hsv[i].s, hsv[i].v); });
+
+        CHECK(rainbow > 0.0);
+        MESSAGE(LEDS << " LEDs: branching " << branching << " us, per pixel " << single << " us, CHSV array "
+                << aos << " us, h/s/v arrays " << soa << " us, hue array at s=255 v=160 " << dimmed
+                << " us, rainbow " << rainbow << " us, plain copy " << copy << " us (sink " << (sink & 1) << ")");
+    }
+}
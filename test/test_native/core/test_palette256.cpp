@@ -0,0 +1,159 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/color/gradients.h"
+#include "PixelTheater/color/palette256.h"
+#include "PixelTheater/color/palette_api.h"
+#include "PixelTheater/color/palettes.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace PixelTheater;
+
+TEST_SUITE("Palette256") {
+    TEST_CASE("entries match colorFromPalette at any brightness and blend") {
+        for (const auto* pal : {&Palettes::RainbowColors, &Palettes::OceanColors, &Palettes::LavaColors,
+                                &Palettes::PartyColors, &Palettes::HeatColors}) {
+            for (uint8_t brightness : {255, 128, 7}) {
+                for (TBlendType blendType : {LINEARBLEND, NOBLEND}) {
+                    Palette256 lut(*pal, brightness, blendType);
+                    for (int i = 0; i < 256; ++i) {
+                        REQUIRE(lut[i] == colorFromPalette(*pal, i, brightness, blendType));
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_CASE("gradient palettes hit their anchors and interpolate between them") {
+        // WLED Party: red at 0, yellow at 85, cyan at 170, magenta at 255
+        Palette256 party(PALETTE_PARTY);
+        CHECK(party[0] == CRGB(255, 0, 0));
+        CHECK(party[85] == CRGB(255, 255, 0));
+        CHECK(party[170] == CRGB(0, 255, 255));
+        CHECK(party[255] == CRGB(255, 0, 255));
+        CHECK(party[42].r == 255);
+        CHECK(party[42].g > 100);
+        CHECK(party[42].g < 155);
+
+        // Channels move monotonically between anchors
+        for (int i = 1; i <= 85; ++i) CHECK(party[i].g >= party[i - 1].g);
+
+        // Every generated WLED palette expands without going black at the ends
+        for (const auto& gradient : {PALETTE_RAINBOW, PALETTE_PARTY, PALETTE_OCEAN_BREEZE,
+                                     PALETTE_SUNSET_REAL, PALETTE_RGI_15, PALETTE_FOREST}) {
+            Palette256 lut(gradient);
+            CHECK(lut[0] == CRGB(gradient.data[1], gradient.data[2], gradient.data[3]));
+            const uint8_t* last = gradient.data + gradient.size - 4;
+            CHECK(lut[255] == CRGB(last[1], last[2], last[3]));
+        }
+
+        // Brightness is baked in like nscale8()
+        Palette256 dim(PALETTE_PARTY, 64);
+        for (int i = 0; i < 256; ++i) REQUIRE(dim[i] == CRGB(party[i]).nscale8(64));
+    }
+
+    TEST_CASE("gradients that start late or are malformed") {
+        static constexpr uint8_t LATE[] = {64, 0, 0, 200, 192, 200, 0, 0};
+        Palette256 late(GradientPaletteData{LATE, sizeof(LATE)});
+        CHECK(late[0] == CRGB(0, 0, 200));
+        CHECK(late[64] == CRGB(0, 0, 200));
+        CHECK(late[192] == CRGB(200, 0, 0));
+        CHECK(late[255] == CRGB(200, 0, 0));
+
+        Palette256 broken(GradientPaletteData{LATE, 6});
+        CHECK(broken == Palette256());
+        Palette256 empty(GradientPaletteData{nullptr, 0});
+        CHECK(empty == Palette256());
+    }
+
+    TEST_CASE("batch mapping with and without a shift") {
+        Palette256 lut(Palettes::RainbowColors);
+        std::vector<uint8_t> indices(300);
+        for (size_t i = 0; i < indices.size(); ++i) indices[i] = static_cast<uint8_t>(i * 7);
+        std::vector<CRGB> out(indices.size());
+
+        lut.map(indices.data(), out.data(), out.size());
+        for (size_t i = 0; i < out.size(); ++i) REQUIRE(out[i] == lut[indices[i]]);
+
+        lut.map(indices.data(), out.data(), out.size(), 200);
+        for (size_t i = 0; i < out.size(); ++i) REQUIRE(out[i] == lut[static_cast<uint8_t>(indices[i] + 200)]);
+    }
+
+    TEST_CASE("fadeToward moves in bounded steps, a slice at a time") {
+        const Palette256 from(Palettes::OceanColors);
+        const Palette256 to(Palettes::LavaColors);
+
+        // Whole table per call: never more than step levels per channel
+        Palette256 fading = from;
+        int calls = 0;
+        Palette256 before = fading;
+        while (!fading.fadeToward(to, 8)) {
+            for (int i = 0; i < 256; ++i) {
+                for (int c = 0; c < 3; ++c) REQUIRE(std::abs(fading[i].raw[c] - before[i].raw[c]) <= 8);
+            }
+            before = fading;
+            REQUIRE(++calls < 64);
+        }
+        CHECK(fading == to);
+        CHECK(calls >= 255 / 8 - 1);
+
+        // A slice of 32 touches only the next 32 entries, then carries on
+        Palette256 sliced = from;
+        sliced.fadeToward(to, 255, 32);
+        for (int i = 0; i < 32; ++i) CHECK(sliced[i] == to[i]);
+        for (int i = 32; i < 256; ++i) CHECK(sliced[i] == from[i]);
+        sliced.fadeToward(to, 255, 32);
+        for (int i = 32; i < 64; ++i) CHECK(sliced[i] == to[i]);
+        int slices = 2;
+        while (!sliced.fadeToward(to, 255, 32)) REQUIRE(++slices < 8);
+        CHECK(sliced == to);
+    }
+
+    TEST_CASE("benchmark: three palette lookups per LED") {
+        constexpr size_t LEDS = 1248;
+        constexpr int FRAMES = 500;
+        std::mt19937 rng(5);
+        std::vector<uint8_t> indices(LEDS * 3);
+        for (auto& i : indices) i = rng() & 0xFF;
+        std::vector<CRGB> out(LEDS);
+        const Palette256 lut1(Palettes::RainbowColors), lut2(Palettes::OceanColors), lut3(Palettes::LavaColors);
+        using clock = std::chrono::high_resolution_clock;
+        auto us = [](auto a, auto b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+
+        uint32_t sink = 0;
+        auto start = clock::now();
+        for (int f = 0; f < FRAMES; ++f) {
+            for (size_t i = 0; i < LEDS; ++i) {
+                CRGB a = colorFromPalette(Palettes::RainbowColors, indices[i * 3]);
+                CRGB b = colorFromPalette(Palettes::OceanColors, indices[i * 3 + 1]);
+                CRGB c = colorFromPalette(Palettes::LavaColors, indices[i * 3 + 2]);
+                out[i] = CRGB(a.r ^ b.g, b.b ^ c.r, c.g ^ a.b);
+            }
+            sink += out[f % LEDS].r;
+        }
+        const double direct = us(start, clock::now()) / FRAMES;
+
+        start = clock::now();
+        for (int f = 0; f < FRAMES; ++f) {
+            for (size_t i = 0; i < LEDS; ++i) {
+                const CRGB& a = lut1[indices[i * 3]];
+                const CRGB& b = lut2[indices[i * 3 + 1]];
+                const CRGB& c = lut3[indices[i * 3 + 2]];
+                out[i] = CRGB(a.r ^ b.g, b.b ^ c.r, c.g ^ a.b);
+            }
+            sink += out[f % LEDS].r;
+        }
+        const double table = us(start, clock::now()) / FRAMES;
+
+        start = clock::now();
+        Palette256 built;
+        for (int f = 0; f < FRAMES; ++f) built.build(Palettes::RainbowColors, static_cast<uint8_t>(f));
+        const double build = us(start, clock::now()) / FRAMES;
+
+        CHECK(table > 0.0);
+        MESSAGE(LEDS << " LEDs x 3 palettes: colorFromPalette " << direct << " us, Palette256 " << table
+                << " us per frame; build " << build << " us (sink " << (sink & 1) << ")");
+    }
+}
@@ -0,0 +1,240 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/core/color.h"
+#include "PixelTheater/core/math_utils.h"
+#include "PixelTheater/core/model_wrapper.h"
+#include "PixelTheater/core/pixel_kernels.h"
+#include "PixelTheater/core/post_process.h"
+#include "PixelTheater/model/model.h"
+#include "PixelTheater/theater.h"
+#include "fixtures/models/basic_pentagon_model.h"
+#include "models/DodecaRGBv2/model.h"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace PixelTheater;
+using namespace PixelTheater::Fixtures;
+
+namespace {
+
+std::vector<CRGB> randomFrame(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<CRGB> frame(count);
+    for (auto& c : frame) c = CRGB(rng() & 0xFF, rng() & 0xFF, rng() & 0xFF);
+    return frame;
+}
+
+bool sameFrame(const std::vector<CRGB>& a, const std::vector<CRGB>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(CRGB)) == 0;
+}
+
+// SatellitesScene's blur before the post-processing stack: the full
+// neighbour array per LED with sentinel checks, a division and nblend()
+void referenceBlur(const IModel& model, std::vector<CRGB>& leds, uint8_t amount) {
+    const std::vector<CRGB> copy = leds;
+    for (size_t i = 0; i < leds.size(); ++i) {
+        uint32_t r = 0, g = 0, b = 0;
+        uint8_t n = 0;
+        for (const auto& neighbor : model.point(i).getNeighbors()) {
+            if (neighbor.id < leds.size()) {
+                r += copy[neighbor.id].r;
+                g += copy[neighbor.id].g;
+                b += copy[neighbor.id].b;
+                n++;
+            }
+        }
+        if (n > 0) nblend(leds[i], CRGB(r / n, g / n, b / n), amount);
+    }
+}
+
+double meanLevel(const std::vector<CRGB>& leds) {
+    double sum = 0;
+    for (const auto& c : leds) sum += c.r + c.g + c.b;
+    return sum / (leds.size() * 3);
+}
+
+// Adds a trails stage in setup(), like a scene would
+class TrailsTestScene : public Scene {
+public:
+    size_t trails = PostProcess::NONE;
+    void setup() override { trails = post_process().addTrails(0.5f); }
+    void tick() override { Scene::tick(); leds[0] = CRGB(200, 200, 200); }
+};
+
+} // namespace
+
+TEST_SUITE("PostProcess") {
+    TEST_CASE("kernels match the per-pixel helpers at any length") {
+        for (size_t n : {0u, 1u, 3u, 7u, 64u, 3744u}) {
+            std::vector<uint8_t> a(n), b(n);
+            std::mt19937 rng(static_cast<uint32_t>(n));
+            for (size_t i = 0; i < n; ++i) { a[i] = rng() & 0xFF; b[i] = rng() & 0xFF; }
+
+            auto out = a;
+            PixelKernels::addSaturate(out.data(), b.data(), n);
+            for (size_t i = 0; i < n; ++i) REQUIRE(out[i] == qadd8(a[i], b[i]));
+
+            PixelKernels::subtractSaturate(out.data(), a.data(), n, 100);
+            for (size_t i = 0; i < n; ++i) REQUIRE(out[i] == qsub8(a[i], 100));
+
+            for (uint8_t amount : {1, 64, 128, 254}) {
+                out = a;
+                PixelKernels::blend(out.data(), b.data(), n, amount);
+                for (size_t i = 0; i < n; ++i) REQUIRE(out[i] == blend8(a[i], b[i], amount));
+            }
+
+            out = a;
+            PixelKernels::scale(out.data(), n, 200);
+            for (size_t i = 0; i < n; ++i) REQUIRE(out[i] == scale8(a[i], 200));
+
+            out = a;
+            PixelKernels::scale16(out.data(), n, 65536, 65535);
+            CHECK(out == a);
+        }
+    }
+
+    TEST_CASE("neighbour graph drops sentinels and averages like a division") {
+        std::vector<CRGB> leds = randomFrame(BasicPentagonModel::LED_COUNT, 1);
+        ModelWrapper<BasicPentagonModel> model(std::make_unique<Model<BasicPentagonModel>>(leds.data()));
+        NeighborGraph graph;
+        graph.build(model, leds.size());
+        REQUIRE(graph.ledCount() == leds.size());
+
+        std::vector<CRGB> mean(leds.size());
+        graph.average(leds[0].raw, mean[0].raw);
+        for (size_t i = 0; i < leds.size(); ++i) {
+            size_t n = 0;
+            uint32_t r = 0;
+            for (const auto& neighbor : model.point(i).getNeighbors()) {
+                if (neighbor.id >= leds.size()) continue;
+                REQUIRE(graph.neighbors(i)[n] == neighbor.id);
+                r += leds[neighbor.id].r;
+                n++;
+            }
+            CHECK(graph.degree(i) == n);
+            CHECK(mean[i].r == (n ? r / n : leds[i].r));
+        }
+    }
+
+    TEST_CASE("blur matches the scene's former per-LED loop on DodecaRGBv2") {
+        using Dodeca = Models::DodecaRGBv2;
+        std::vector<CRGB> leds = randomFrame(Dodeca::LED_COUNT, 2);
+        ModelWrapper<Dodeca> model(std::make_unique<Model<Dodeca>>(leds.data()));
+        std::vector<CRGB> expected = leds;
+
+        PostProcess post(model, leds.size());
+        post.addBlur(0.6f);                         // 153, exactly
+        referenceBlur(model, expected, 153);
+        post.apply(leds.data(), leds.size(), 0.016f);
+        CHECK(sameFrame(leds, expected));
+
+        // Two passes are two rounds of the same
+        post.stage(0)->iterations = 2;
+        referenceBlur(model, expected, 153);
+        referenceBlur(model, expected, 153);
+        post.apply(leds.data(), leds.size(), 0.016f);
+        CHECK(sameFrame(leds, expected));
+
+        // Disabled stages do nothing
+        post.stage(0)->enabled = false;
+        post.apply(leds.data(), leds.size(), 0.016f);
+        CHECK(sameFrame(leds, expected));
+    }
+
+    TEST_CASE("bloom spreads only what is above the threshold") {
+        using Dodeca = Models::DodecaRGBv2;
+        std::vector<CRGB> leds(Dodeca::LED_COUNT, CRGB(40, 40, 40));
+        ModelWrapper<Dodeca> model(std::make_unique<Model<Dodeca>>(leds.data()));
+        PostProcess post(model, leds.size());
+        post.addBloom(100, 1.0f, 2);
+
+        // Nothing bright: unchanged
+        std::vector<CRGB> before = leds;
+        post.apply(leds.data(), leds.size(), 0.016f);
+        CHECK(sameFrame(leds, before));
+
+        // One bright LED lights its neighbours, and itself no less
+        const size_t hot = 600;
+        leds[hot] = CRGB(255, 255, 255);
+        post.apply(leds.data(), leds.size(), 0.016f);
+        CHECK(leds[hot].r == 255);
+        const uint16_t neighbor = post.graph().neighbors(hot)[0];
+        CHECK(leds[neighbor].r > 40);
+        size_t lit = 0;
+        for (const auto& c : leds) lit += c.r > 40;
+        CHECK(lit > 1);
+        CHECK(lit < 100);                           // Two rings, not the whole model
+    }
+
+    TEST_CASE("trails decay by time, not by frame") {
+        using Dodeca = Models::DodecaRGBv2;
+        std::vector<CRGB> leds(Dodeca::LED_COUNT);
+        ModelWrapper<Dodeca> model(std::make_unique<Model<Dodeca>>(leds.data()));
+
+        // One second with a half-life of 0.5 s leaves a quarter, at any frame rate
+        for (int fps : {20, 60, 240}) {
+            std::fill(leds.begin(), leds.end(), CRGB(200, 200, 200));
+            PostProcess post(model, leds.size());
+            post.addTrails(0.5f);
+            for (int f = 0; f < fps; ++f) post.apply(leds.data(), leds.size(), 1.0f / fps);
+            CHECK(meanLevel(leds) == doctest::Approx(50.0).epsilon(0.03));
+        }
+
+        // Dim light keeps fading rather than sticking at a level
+        std::fill(leds.begin(), leds.end(), CRGB(3, 3, 3));
+        PostProcess post(model, leds.size());
+        post.addTrails(0.5f);
+        for (int f = 0; f < 240 * 4; ++f) post.apply(leds.data(), leds.size(), 1.0f / 240);
+        CHECK(meanLevel(leds) < 0.5);
+    }
+
+    TEST_CASE("Theater runs the stack after tick(); reset() removes the stages") {
+        Theater theater;
+        theater.useNativePlatform<BasicPentagonModel>(BasicPentagonModel::LED_COUNT);
+        theater.addScene<TrailsTestScene>();
+        theater.start();
+        auto* scene = static_cast<TrailsTestScene*>(theater.currentScene());
+        REQUIRE(scene->post_process().stageCount() == 1);
+        theater.update();
+        CHECK(theater.platform()->getLEDs()[0].r <= 200);
+
+        scene->reset();
+        CHECK(scene->post_process().stageCount() == 0);
+    }
+
+    TEST_CASE("benchmark: post-processing on DodecaRGBv2") {
+        using Dodeca = Models::DodecaRGBv2;
+        std::vector<CRGB> leds = randomFrame(Dodeca::LED_COUNT, 3);
+        ModelWrapper<Dodeca> model(std::make_unique<Model<Dodeca>>(leds.data()));
+        using clock = std::chrono::high_resolution_clock;
+        auto us = [](auto a, auto b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+        constexpr int FRAMES = 300;
+
+        auto start = clock::now();
+        for (int f = 0; f < FRAMES; ++f) referenceBlur(model, leds, 128);
+        const double reference = us(start, clock::now()) / FRAMES;
+
+        auto time = [&](PostProcess& post) {
+            const auto t0 = clock::now();
+            for (int f = 0; f < FRAMES; ++f) post.apply(leds.data(), leds.size(), 1.0f / 60);
+            return us(t0, clock::now()) / FRAMES;
+        };
+        PostProcess blur(model, leds.size());
+        blur.addBlur(0.5f);
+        PostProcess bloom(model, leds.size());
+        bloom.addBloom(160, 0.5f, 2);
+        PostProcess trails(model, leds.size());
+        trails.addTrails(0.5f);
+        const double blur_us = time(blur);
+        const double bloom_us = time(bloom);
+        const double trails_us = time(trails);
+
+        CHECK(blur_us > 0.0);
+        MESSAGE(leds.size() << " LEDs, " << blur.graph().edgeCount() << " edges: former blur loop "
+                << reference << " us, blur stage " << blur_us << " us, bloom (2 rings) " << bloom_us
+                << " us, trails " << trails_us << " us per frame");
+    }
+}
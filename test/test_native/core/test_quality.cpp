@@ -0,0 +1,258 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/core/quality.h"
+#include "PixelTheater/theater.h"
+#include "fixtures/models/basic_pentagon_model.h"
+
+#include <chrono>
+
+using namespace PixelTheater;
+using namespace PixelTheater::Fixtures;
+
+namespace {
+
+// Feed the same frame time n times; the sum of the steps taken
+int feed(QualityGovernor& governor, QualityKnobs& knobs, uint32_t frame_us, int n) {
+    int steps = 0;
+    for (int i = 0; i < n; ++i) steps += governor.record(frame_us, knobs);
+    return steps;
+}
+
+QualityGovernor::Config testConfig() {
+    QualityGovernor::Config config;
+    config.target_us = 1000;
+    config.down_frames = 5;
+    config.up_frames = 20;
+    return config;
+}
+
+// Artificially slow: spins for a time that grows with its "agents" knob.
+// `cost_us` per level above 0, plus `base_us`.
+class SlowTestScene : public Scene {
+public:
+    uint32_t base_us = 0;
+    uint32_t cost_us = 0;
+    size_t agents = QualityKnobs::NONE;
+
+    void setup() override { agents = quality_knob("agents", 4); }
+    void tick() override {
+        Scene::tick();
+        spin(base_us + cost_us * quality_level(agents));
+    }
+
+    static void spin(uint32_t us) {
+        using clock = std::chrono::steady_clock;
+        const auto until = clock::now() + std::chrono::microseconds(us);
+        while (clock::now() < until) {}
+    }
+};
+
+class PlainTestScene : public Scene {
+public:
+    void setup() override {}
+};
+
+} // namespace
+
+TEST_SUITE("Quality") {
+    TEST_CASE("knobs step down in declaration order and back up in reverse") {
+        QualityKnobs knobs;
+        const size_t blur = knobs.add("blur", 2);
+        const size_t agents = knobs.add("agents", 3);
+        CHECK(knobs.add("flat", 1) == QualityKnobs::NONE);
+        CHECK(knobs.add("blur", 2) == blur);           // setup() running again
+        REQUIRE(knobs.count() == 2);
+        CHECK(knobs.total() == 3);
+        CHECK(knobs.maxTotal() == 3);
+
+        CHECK(knobs.stepDown());
+        CHECK(knobs.level(blur) == 0);
+        CHECK(knobs.level(agents) == 2);
+        CHECK(knobs.stepDown());
+        CHECK(knobs.stepDown());
+        CHECK(knobs.level(agents) == 0);
+        CHECK_FALSE(knobs.stepDown());
+        CHECK(knobs.total() == 0);
+
+        CHECK(knobs.stepUp());
+        CHECK(knobs.level(agents) == 1);
+        CHECK(knobs.level(blur) == 0);
+        CHECK(knobs.stepUp());
+        CHECK(knobs.stepUp());
+        CHECK(knobs.level(blur) == 1);
+        CHECK_FALSE(knobs.stepUp());
+
+        // Unknown knobs read as full quality
+        CHECK(knobs.level(QualityKnobs::NONE) == 0);
+        CHECK(knobs.ratio(QualityKnobs::NONE) == 1.0f);
+        knobs.set(agents, 9);
+        CHECK(knobs.level(agents) == 2);
+    }
+
+    TEST_CASE("inactive knobs are passed over") {
+        QualityKnobs knobs;
+        const size_t blur = knobs.add("blur", 2);
+        const size_t agents = knobs.add("agents", 3);
+        CHECK(knobs.active(blur));
+
+        // Blur at 0 saves nothing: the first step goes straight to agents
+        knobs.setActive(blur, false);
+        CHECK(knobs.stepDown());
+        CHECK(knobs.level(blur) == 1);
+        CHECK(knobs.level(agents) == 1);
+        CHECK(knobs.stepDown());
+        CHECK_FALSE(knobs.stepDown());
+
+        // Back on at full quality, and first in line again
+        knobs.setActive(blur, true);
+        CHECK(knobs.level(blur) == 1);
+        CHECK(knobs.stepDown());
+        CHECK(knobs.level(blur) == 0);
+
+        // Turning it off again restores it, and nothing else moves
+        knobs.setActive(blur, false);
+        CHECK(knobs.level(blur) == 1);
+        CHECK(knobs.stepUp());
+        CHECK(knobs.level(agents) == 1);
+        CHECK_FALSE(knobs.active(QualityKnobs::NONE));
+    }
+
+    TEST_CASE("governor waits for a run of slow frames, then steps once") {
+        QualityKnobs knobs;
+        knobs.add("agents", 4);
+        QualityGovernor governor;
+        governor.setConfig(testConfig());
+
+        // A single spike does not count
+        CHECK(feed(governor, knobs, 5000, 1) == 0);
+        CHECK(feed(governor, knobs, 500, 30) == 0);
+        CHECK(knobs.total() == 3);
+
+        CHECK(feed(governor, knobs, 1200, 4) == 0);
+        CHECK(governor.record(1200, knobs) == -1);
+        CHECK(knobs.total() == 2);
+        CHECK(governor.overCount() == 0);           // Judged afresh from the next frame
+        CHECK(governor.stepsDown() == 1);
+    }
+
+    TEST_CASE("mostly slow frames still step down") {
+        QualityKnobs knobs;
+        knobs.add("agents", 4);
+        QualityGovernor governor;
+        governor.setConfig(testConfig());
+
+        // Two slow frames in three: +1 +1 -1, so down after a few more than down_frames
+        int frames = 0;
+        while (knobs.total() == 3 && frames < 100) {
+            governor.record(frames % 3 == 2 ? 900 : 1300, knobs);
+            ++frames;
+        }
+        CHECK(frames > 5);
+        CHECK(frames < 15);
+
+        // A slow frame spoils the run of fast ones
+        CHECK(feed(governor, knobs, 400, 15) == 0);
+        CHECK(governor.record(1300, knobs) == 0);
+        CHECK(governor.underCount() == 0);
+        CHECK(feed(governor, knobs, 400, 19) == 0);
+        CHECK(governor.record(400, knobs) == 1);
+    }
+
+    TEST_CASE("frames between the thresholds hold the level") {
+        QualityKnobs knobs;
+        knobs.add("agents", 4);
+        QualityGovernor governor;
+        governor.setConfig(testConfig());
+
+        CHECK(feed(governor, knobs, 1200, 5) == -1);
+        // 800 us: under budget, but not by enough to step back up
+        CHECK(feed(governor, knobs, 800, 1000) == 0);
+        CHECK(knobs.total() == 2);
+
+        // Real headroom steps up after up_frames
+        CHECK(feed(governor, knobs, 400, 19) == 0);
+        CHECK(governor.record(400, knobs) == 1);
+        CHECK(knobs.total() == 3);
+    }
+
+    TEST_CASE("a failed step up makes the next one wait longer") {
+        QualityKnobs knobs;
+        knobs.add("agents", 4);
+        QualityGovernor governor;
+        governor.setConfig(testConfig());
+
+        // Level 3 costs 1200 us, level 2 costs 600 us: enough headroom to retry
+        auto cost = [&] { return knobs.total() == 3 ? 1200u : 600u; };
+        auto run = [&](int frames) {
+            int changes = 0;
+            for (int i = 0; i < frames; ++i) changes += governor.record(cost(), knobs) != 0;
+            return changes;
+        };
+
+        CHECK(run(5) == 1);           // Down
+        CHECK(run(20) == 1);          // Up after 20 frames
+        CHECK(run(5) == 1);           // Down again: that failed
+        CHECK(run(39) == 0);          // Now waits 40
+        CHECK(run(1) == 1);
+        CHECK(run(5) == 1);
+        CHECK(run(79) == 0);          // ...then 80
+        CHECK(run(1) == 1);
+
+        // From here on a retry every 8 x 20 + 5 frames, not every 25
+        const int changes = run(2000);
+        CHECK(changes <= 2 * (2000 / 165 + 1));
+        CHECK(knobs.total() >= 2);
+    }
+
+    TEST_CASE("off without a target or without knobs") {
+        QualityKnobs knobs;
+        QualityGovernor governor;
+        CHECK_FALSE(governor.enabled());
+        knobs.add("agents", 4);
+        CHECK(feed(governor, knobs, 100000, 100) == 0);
+        CHECK(knobs.total() == 3);
+
+        QualityKnobs none;
+        governor.setConfig(testConfig());
+        CHECK(feed(governor, none, 100000, 100) == 0);
+    }
+
+    TEST_CASE("Theater governs an artificially slow scene") {
+        Theater theater;
+        theater.useNativePlatform<BasicPentagonModel>(BasicPentagonModel::LED_COUNT);
+        theater.addScene<SlowTestScene>();
+        theater.addScene<PlainTestScene>();
+        theater.start();
+        auto* scene = static_cast<SlowTestScene*>(theater.currentScene());
+
+        // 3 ms budget. Level 3 costs 3.6 ms, level 2 costs 2.7 ms: over the
+        // up threshold (2.1 ms), so the governor should settle on level 2.
+        QualityGovernor::Config config;
+        config.target_us = 3000;
+        config.down_frames = 5;
+        config.up_frames = 20;
+        theater.qualityGovernor().setConfig(config);
+        scene->base_us = 900;
+        scene->cost_us = 900;
+
+        for (int i = 0; i < 60; ++i) theater.update();
+        CHECK(scene->quality_knobs().total() == 2);
+        CHECK(theater.lastFrameUs() >= 2700);
+        CHECK(theater.qualityGovernor().stepsDown() == 1);
+        CHECK(theater.qualityGovernor().stepsUp() == 0);
+
+        // The load goes away: quality comes back, one level per up_frames
+        scene->base_us = 100;
+        scene->cost_us = 100;
+        for (int i = 0; i < 60; ++i) theater.update();
+        CHECK(scene->quality_knobs().total() == 3);
+        CHECK(theater.lastFrameUs() < 1000);
+
+        // Switching scenes starts the counts over; setup() starts at full quality
+        for (int i = 0; i < 3; ++i) theater.update();
+        CHECK(theater.qualityGovernor().underCount() > 0);
+        theater.nextScene();
+        CHECK(theater.qualityGovernor().underCount() == 0);
+        theater.update();
+        CHECK(theater.currentScene()->quality_knobs().count() == 0);
+    }
+}
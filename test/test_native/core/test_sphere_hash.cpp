@@ -0,0 +1,193 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/core/sphere_hash.h"
+#include "PixelTheater/core/model_wrapper.h"
+#include "PixelTheater/model/model.h"
+#include "fixtures/models/basic_pentagon_model.h"
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+struct TestPoint { float x, y, z; };
+
+// Deterministic random directions, some scaled to check that length is ignored
+std::vector<TestPoint> randomPoints(size_t n, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 300.0f);
+    std::vector<TestPoint> pts;
+    while (pts.size() < n) {
+        float x = dist(gen), y = dist(gen), z = dist(gen);
+        float len = std::sqrt(x * x + y * y + z * z);
+        if (len < 1e-3f) continue;
+        float s = scale(gen) / len;
+        pts.push_back({x * s, y * s, z * s});
+    }
+    return pts;
+}
+
+std::set<uint16_t> bruteForce(const std::vector<TestPoint>& pts, TestPoint q, float angle) {
+    std::set<uint16_t> out;
+    float ql = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+    for (size_t i = 0; i < pts.size(); ++i) {
+        const TestPoint& p = pts[i];
+        float pl = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+        float dot = (p.x * q.x + p.y * q.y + p.z * q.z) / (pl * ql);
+        if (angle >= Constants::PT_PI || dot >= std::cos(angle)) out.insert(static_cast<uint16_t>(i));
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_SUITE("SphereHash") {
+    TEST_CASE("matches brute force for random queries") {
+        SphereHash<> hash(2000);
+        auto pts = randomPoints(2000, 42);
+        for (size_t i = 0; i < pts.size(); ++i) {
+            REQUIRE(hash.insert(static_cast<uint16_t>(i), pts[i].x, pts[i].y, pts[i].z));
+        }
+        hash.build();
+        CHECK(hash.size() == 2000);
+
+        auto queries = randomPoints(50, 7);
+        // Poles and the longitude seam are the tricky cases
+        queries.push_back({0, 0, 1});
+        queries.push_back({0, 0, -1});
+        queries.push_back({-1, 0.001f, 0});
+        queries.push_back({-1, -0.001f, 0.2f});
+
+        for (float angle : {0.05f, 0.2f, 0.6f, 1.5f, 3.0f, 3.2f}) {
+            for (const auto& q : queries) {
+                std::set<uint16_t> found;
+                hash.query(q.x, q.y, q.z, angle, [&](uint16_t id, float dot) {
+                    CHECK(dot >= std::cos(std::min(angle, Constants::PT_PI)) - 1e-5f);
+                    found.insert(id);
+                });
+                INFO("angle " << angle << " query " << q.x << "," << q.y << "," << q.z);
+                CHECK(found == bruteForce(pts, q, angle));
+            }
+        }
+    }
+
+    TEST_CASE("capacity and degenerate input") {
+        SphereHash<> hash(4);
+        CHECK(hash.capacity() == 4);
+        CHECK(hash.insert(0, 1, 0, 0));
+        CHECK_FALSE(hash.insert(1, 0, 0, 0)); // Zero vector has no direction
+        CHECK(hash.insert(2, 0, 1, 0));
+        CHECK(hash.insert(3, 0, 0, 1));
+        CHECK(hash.insert(4, -1, 0, 0));
+        CHECK_FALSE(hash.insert(5, 0, -1, 0)); // Full
+        CHECK(hash.size() == 4);
+
+        // Not built yet: queries find nothing
+        int visits = 0;
+        hash.query(1, 0, 0, 0.1f, [&](uint16_t, float) { visits++; });
+        CHECK(visits == 0);
+
+        hash.build();
+        std::set<uint16_t> found;
+        hash.query(1, 0, 0, 0.1f, [&](uint16_t id, float) { found.insert(id); });
+        CHECK(found == std::set<uint16_t>{0});
+
+        hash.clear();
+        CHECK(hash.empty());
+    }
+
+    TEST_CASE("nearest matches brute force") {
+        SphereHash<> hash(500);
+        auto pts = randomPoints(500, 3);
+        for (size_t i = 0; i < pts.size(); ++i) hash.insert(static_cast<uint16_t>(i), pts[i].x, pts[i].y, pts[i].z);
+        CHECK(hash.nearest(1, 0, 0) == -1); // Not built
+
+        hash.build();
+        for (const auto& q : randomPoints(100, 11)) {
+            float ql = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+            int expected = -1;
+            float best = -2.0f;
+            for (size_t i = 0; i < pts.size(); ++i) {
+                const TestPoint& p = pts[i];
+                float pl = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+                float dot = (p.x * q.x + p.y * q.y + p.z * q.z) / (pl * ql);
+                if (dot > best) { best = dot; expected = static_cast<int>(i); }
+            }
+            // A tiny start angle forces the search to widen several times
+            CHECK(hash.nearest(q.x, q.y, q.z, 0.001f) == expected);
+            CHECK(hash.nearest(q.x, q.y, q.z) == expected);
+        }
+    }
+
+    TEST_CASE("indexModel uses LED indices as ids") {
+        CRGB leds[Fixtures::BasicPentagonModel::LED_COUNT];
+        ModelWrapper<Fixtures::BasicPentagonModel> wrapper(std::make_unique<Model<Fixtures::BasicPentagonModel>>(leds));
+        SphereHash<> hash;
+        hash.indexModel(wrapper);
+        CHECK(hash.capacity() == wrapper.pointCount());
+        // The fixture has one point at the origin, which has no direction and is skipped
+        CHECK(hash.size() == wrapper.pointCount() - 1);
+
+        // Every other LED finds itself at (almost) zero distance
+        for (uint16_t i = 0; i < wrapper.pointCount(); ++i) {
+            const Point& p = wrapper.point(i);
+            if (p.x() == 0.0f && p.y() == 0.0f && p.z() == 0.0f) continue;
+            bool found_self = false;
+            hash.query(p.x(), p.y(), p.z(), 0.01f, [&](uint16_t id, float) {
+                if (id == i) found_self = true;
+            });
+            CHECK(found_self);
+        }
+    }
+
+    TEST_CASE("benchmark: neighbor search scaling vs all-pairs") {
+        // Same pattern as the flocking scenes: every agent looks for neighbours
+        // within a fixed angular range. All-pairs is what the scenes did before.
+        const float range = 0.25f;
+        auto us = [](auto a, auto b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+
+        for (size_t n : {250, 500, 1000, 2000, 4000}) {
+            auto pts = randomPoints(n, 99);
+            std::vector<TestPoint> dirs;
+            for (const auto& p : pts) {
+                float len = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+                dirs.push_back({p.x / len, p.y / len, p.z / len});
+            }
+
+            auto start = std::chrono::high_resolution_clock::now();
+            size_t brute_pairs = 0;
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    if (i == j) continue;
+                    float dot = dirs[i].x * dirs[j].x + dirs[i].y * dirs[j].y + dirs[i].z * dirs[j].z;
+                    if (std::acos(std::max(-1.0f, std::min(1.0f, dot))) < range) brute_pairs++;
+                }
+            }
+            auto mid = std::chrono::high_resolution_clock::now();
+
+            // Includes the per-frame rebuild
+            SphereHash<> hash(static_cast<uint16_t>(n));
+            auto rebuild = std::chrono::high_resolution_clock::now();
+            for (size_t i = 0; i < n; ++i) hash.insert(static_cast<uint16_t>(i), dirs[i].x, dirs[i].y, dirs[i].z);
+            hash.build();
+            const SphereHash<>::Radius radius(range);
+            size_t hash_pairs = 0;
+            for (size_t i = 0; i < n; ++i) {
+                hash.query(dirs[i].x, dirs[i].y, dirs[i].z, radius, [&](uint16_t id, float) {
+                    if (id != i) hash_pairs++;
+                });
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+
+            // acos vs cos comparison may disagree right on the boundary
+            CHECK(hash_pairs <= brute_pairs + n / 100);
+            CHECK(hash_pairs + n / 100 >= brute_pairs);
+            MESSAGE(n << " agents: all-pairs " << us(start, mid) << " us, hash " << us(rebuild, end) << " us");
+        }
+    }
+}
@@ -0,0 +1,13 @@
+// Native tests don't build src/, so the firmware scenes are compiled here,
+// once, for every test that runs them (test_scene_allocations, test_scaling)
+#include "../../src/benchmark.cpp"
+#include "../../src/scenes/blobs/blob.cpp"
+#include "../../src/scenes/blobs/blob_scene.cpp"
+#include "../../src/scenes/boids/boids_scene.cpp"
+#include "../../src/scenes/geography/geography_scene.cpp"
+#include "../../src/scenes/orientation_grid/orientation_grid_scene.cpp"
+#include "../../src/scenes/satellites/SatellitesScene.cpp"
+#include "../../src/scenes/sparkles/sparkles_scene.cpp"
+#include "../../src/scenes/texture_map/texture_map_scene.cpp"
+#include "../../src/scenes/wandering_particles/particle.cpp"
+#include "../../src/scenes/wandering_particles/wandering_particles_scene.cpp"
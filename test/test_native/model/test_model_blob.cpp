@@ -0,0 +1,180 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/model/model.h"
+#include "PixelTheater/model/model_blob.h"
+#include "PixelTheater/model/kd_tree.h"
+#include "models/DodecaRGBv2/model.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+std::vector<uint8_t> makeBlob() {
+    ModelBlobWriter writer(3);
+    writer.setMetadata("Tiny", "1.0", "Two faces", "Test");
+    writer.setSphereRadius(2.5f);
+
+    ModelBlob::FaceTypeRecord ft;
+    ft.type = FaceType::Triangle;
+    ft.num_leds = 2;
+    ft.edge_length_mm = 10.0f;
+    writer.addFaceType(ft);
+
+    for (uint8_t f = 0; f < 2; ++f) {
+        ModelBlob::FaceRecord face;
+        face.id = f;
+        face.rotation = f;
+        face.vertex_count = 3;
+        for (int v = 0; v < 3; ++v) face.vertices[v] = {float(f), float(v), 1.0f};
+        writer.addFace(face);
+    }
+    for (uint16_t i = 0; i < 4; ++i) {
+        ModelBlob::PointRecord point;
+        point.id = i;
+        point.face_id = i / 2;
+        point.x = float(i);
+        const ModelBlob::NeighborRecord neighbors[] = {{uint16_t((i + 1) % 4), 1.0f}, {uint16_t((i + 3) % 4), 1.5f}};
+        writer.addPoint(point, neighbors, i == 0 ? 1 : 2);
+    }
+    return writer.finish();
+}
+
+} // namespace
+
+TEST_SUITE("Model Blob") {
+    TEST_CASE("round trip") {
+        const auto bytes = makeBlob();
+        REQUIRE(bytes.size() == ModelBlob::HEADER_SIZE + ModelBlob::FACE_TYPE_SIZE + 2 * ModelBlob::FACE_SIZE +
+                                4 * (ModelBlob::POINT_SIZE + 3 * ModelBlob::NEIGHBOR_SIZE) + 24);
+
+        ModelBlobReader blob(bytes.data(), bytes.size());
+        REQUIRE(blob.valid());
+        CHECK(blob.ledCount() == 4);
+        CHECK(blob.faceCount() == 2);
+        CHECK(blob.maxNeighbors() == 3);
+        CHECK(blob.sphereRadius() == 2.5f);
+        CHECK(std::string(blob.name()) == "Tiny");
+        CHECK(std::string(blob.modelType()) == "Test");
+
+        CHECK(blob.faceType(0).type == FaceType::Triangle);
+        CHECK(blob.faceType(0).num_leds == 2);
+        CHECK(blob.face(1).rotation == 1);
+        CHECK(blob.face(1).vertices[2].y == 2.0f);
+        CHECK(blob.point(3).face_id == 1);
+        CHECK(blob.point(3).x == 3.0f);
+
+        ModelBlob::NeighborRecord neighbors[3];
+        CHECK(blob.neighbors(0, neighbors, 3) == 1);     // Unused slots are skipped
+        CHECK(blob.neighbors(2, neighbors, 3) == 2);
+        CHECK(neighbors[0].id == 3);
+        CHECK(neighbors[1].id == 1);
+        CHECK(neighbors[1].distance == 1.5f);
+    }
+
+    TEST_CASE("damaged blobs are rejected") {
+        const auto good = makeBlob();
+        CHECK_FALSE(ModelBlobReader(nullptr, 0).valid());
+        CHECK_FALSE(ModelBlobReader(good.data(), good.size() - 1).valid());
+
+        auto bytes = good;
+        bytes[0] = 'X';
+        CHECK_FALSE(ModelBlobReader(bytes.data(), bytes.size()).valid());
+
+        bytes = good;
+        bytes[4] = ModelBlob::VERSION + 1;              // Version
+        CHECK_FALSE(ModelBlobReader(bytes.data(), bytes.size()).valid());
+
+        bytes = good;
+        bytes[ModelBlob::HEADER_SIZE + 20] ^= 1;        // Body byte: checksum
+        CHECK_FALSE(ModelBlobReader(bytes.data(), bytes.size()).valid());
+
+        bytes = good;
+        bytes[8] = 5;                                   // LED count no longer adds up
+        CHECK_FALSE(ModelBlobReader(bytes.data(), bytes.size()).valid());
+    }
+
+    TEST_CASE("DodecaRGBv2 loads from its blob") {
+        using Dodeca = Models::DodecaRGBv2;
+        static_assert(HasModelBlob<Dodeca>::value, "DodecaRGBv2 should be a compiled model");
+
+        static CRGB leds[Dodeca::LED_COUNT];
+        Model<Dodeca> model(leds);
+        REQUIRE(model.led_count() == 1248);
+        REQUIRE(model.face_count() == 12);
+
+        // Spot values from the model as generate_model.py wrote it
+        CHECK(model.points[0].x() == -1.427f);
+        CHECK(model.points[0].z() == 262.000f);
+        CHECK(model.faces[1].vertices[0].x == -99.947f);
+        CHECK(model.faces[11].led_offset() == 11 * 104);
+
+        float furthest = 0.0f;
+        for (size_t i = 0; i < model.led_count(); ++i) {
+            const auto& p = model.points[i];
+            CHECK(p.id() == i);
+            CHECK(p.face_id() == i / 104);
+            furthest = std::max(furthest, std::sqrt(p.x() * p.x() + p.y() * p.y() + p.z() * p.z()));
+
+            const auto& neighbors = p.getNeighbors();
+            CHECK(neighbors[0].id != i);
+            CHECK(neighbors[0].distance > 0.0f);
+            for (size_t n = 1; n < neighbors.size() && neighbors[n].id != 0xFFFF; ++n) {
+                CHECK(neighbors[n].distance >= neighbors[n - 1].distance);
+            }
+        }
+        CHECK(furthest == doctest::Approx(Dodeca::SPHERE_RADIUS).epsilon(0.001));
+    }
+}
+
+TEST_SUITE("KdTree") {
+    TEST_CASE("matches a brute-force search at ABSOLUTE_MAX_LEDS") {
+        const size_t count = Limits::ABSOLUTE_MAX_LEDS;
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> coord(-300.0f, 300.0f);
+        std::vector<float> xyz(count * 3);
+        for (auto& v : xyz) v = coord(rng);
+        xyz[3] = xyz[0]; xyz[4] = xyz[1]; xyz[5] = xyz[2];   // A duplicate: ties go by index
+
+        auto start = std::chrono::high_resolution_clock::now();
+        KdTree tree;
+        tree.build(xyz.data(), count);
+        KdTree::Result results[KdTree::MAX_RESULTS];
+        size_t found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            found += tree.nearest(xyz[i * 3], xyz[i * 3 + 1], xyz[i * 3 + 2], 7, 60.0f, results, i);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        CHECK(tree.size() == count);
+        CHECK(found > count * 5);
+
+        // Brute force on a sample of queries
+        std::vector<KdTree::Result> all;
+        for (size_t i = 0; i < count; i += 97) {
+            all.clear();
+            for (size_t j = 0; j < count; ++j) {
+                if (j == i) continue;
+                const float dx = xyz[j * 3] - xyz[i * 3], dy = xyz[j * 3 + 1] - xyz[i * 3 + 1],
+                            dz = xyz[j * 3 + 2] - xyz[i * 3 + 2];
+                const float d = dx * dx + dy * dy + dz * dz;
+                if (d <= 60.0f * 60.0f) all.push_back({uint32_t(j), d});
+            }
+            std::sort(all.begin(), all.end(), [](const KdTree::Result& a, const KdTree::Result& b) {
+                return a.distance_sq < b.distance_sq || (a.distance_sq == b.distance_sq && a.index < b.index);
+            });
+            const size_t n = tree.nearest(xyz[i * 3], xyz[i * 3 + 1], xyz[i * 3 + 2], 7, 60.0f, results, i);
+            REQUIRE(n == std::min<size_t>(7, all.size()));
+            for (size_t k = 0; k < n; ++k) CHECK(results[k].index == all[k].index);
+        }
+
+        CHECK(tree.nearest(xyz[0], xyz[1], xyz[2], 1, 60.0f, results, 0) == 1);
+        CHECK(results[0].index == 1);
+        CHECK(results[0].distance_sq == 0.0f);
+
+        MESSAGE("k-d tree: build + 7 neighbours for " << count << " points in "
+                << std::chrono::duration<double, std::milli>(end - start).count() << " ms");
+    }
+}
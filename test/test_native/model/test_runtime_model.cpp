@@ -0,0 +1,269 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/model/runtime_model.h"
+#include "PixelTheater/core/model_wrapper.h"
+#include "PixelTheater/theater.h"
+#include "models/DodecaRGBv2/model.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+using Dodeca = Models::DodecaRGBv2;
+
+const uint8_t* dodecaBlob() { return reinterpret_cast<const uint8_t*>(Dodeca::BLOB); }
+
+// Writes the DodecaRGBv2 blob to a file and removes it again
+struct BlobFile {
+    const char* path = "test_runtime_model.bin";
+    BlobFile(const uint8_t* data, size_t size) {
+        FILE* f = std::fopen(path, "wb");
+        REQUIRE(f != nullptr);
+        std::fwrite(data, 1, size, f);
+        std::fclose(f);
+    }
+    ~BlobFile() { std::remove(path); }
+};
+
+// Scene that records what it sees of the model
+class ModelProbeScene : public Scene {
+public:
+    size_t points = 0;
+    float radius = 0.0f;
+    void setup() override {
+        points = model().pointCount();
+        radius = model().getSphereRadius();
+    }
+    void tick() override {
+        Scene::tick();
+        for (size_t i = 0; i < ledCount(); ++i) leds[i] = CRGB::Red;
+    }
+};
+
+// Two one-LED faces, broken in at most one way; the writer keeps the checksum valid
+enum class Flaw { None, FaceLedsPastEnd, FaceType, PointFace, Neighbor };
+
+std::vector<uint8_t> tinyBlob(Flaw flaw) {
+    ModelBlobWriter writer(1);
+    writer.setMetadata("Tiny", "1", "", "");
+    ModelBlob::FaceTypeRecord ft;
+    ft.type = FaceType::Triangle;
+    ft.num_leds = flaw == Flaw::FaceLedsPastEnd ? 2 : 1;
+    writer.addFaceType(ft);
+    for (uint8_t f = 0; f < 2; ++f) {
+        ModelBlob::FaceRecord face;
+        face.id = f;
+        face.type_id = flaw == Flaw::FaceType && f == 1 ? 1 : 0;
+        writer.addFace(face);
+    }
+    for (uint16_t i = 0; i < 2; ++i) {
+        ModelBlob::PointRecord point;
+        point.id = i;
+        point.face_id = flaw == Flaw::PointFace && i == 1 ? 2 : uint8_t(i);
+        const ModelBlob::NeighborRecord neighbor{uint16_t(flaw == Flaw::Neighbor ? 2 : 1 - i), 1.0f};
+        writer.addPoint(point, &neighbor, 1);
+    }
+    return writer.finish();
+}
+
+double msSince(std::chrono::high_resolution_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST_SUITE("RuntimeModel") {
+    TEST_CASE("matches the compiled DodecaRGBv2 model") {
+        static CRGB leds[Dodeca::LED_COUNT];
+        Model<Dodeca> compiled(leds);
+
+        RuntimeModel model;
+        REQUIRE(model.load(dodecaBlob(), Dodeca::BLOB_SIZE));
+        model.attachLeds(leds);
+        CHECK(std::string(model.name()) == "DodecaRGBv2");
+        REQUIRE(model.pointCount() == Dodeca::LED_COUNT);
+        REQUIRE(model.faceCount() == Dodeca::FACE_COUNT);
+        CHECK(model.getSphereRadius() == Dodeca::SPHERE_RADIUS);
+
+        for (size_t i = 0; i < model.pointCount(); ++i) {
+            const Point& a = model.point(i);
+            const Point& b = compiled.points[i];
+            CHECK(a.id() == b.id());
+            CHECK(a.face_id() == b.face_id());
+            CHECK(a.x() == b.x());
+            CHECK(a.y() == b.y());
+            CHECK(a.z() == b.z());
+            for (size_t n = 0; n < Limits::MAX_NEIGHBORS; ++n) {
+                CHECK(a.getNeighbors()[n].id == b.getNeighbors()[n].id);
+                CHECK(a.getNeighbors()[n].distance == b.getNeighbors()[n].distance);
+            }
+        }
+        for (size_t f = 0; f < model.faceCount(); ++f) {
+            const Face& a = model.face(f);
+            const Face& b = compiled.faces[f];
+            CHECK(a.id() == b.id());
+            CHECK(a.led_offset() == b.led_offset());
+            CHECK(a.led_count() == b.led_count());
+            CHECK(a.type() == b.type());
+            CHECK(a.vertices[2].z == b.vertices[2].z);
+        }
+
+        // Faces write to the attached buffer
+        model.face(2).leds[0] = CRGB::Blue;
+        CHECK(leds[2 * 104] == CRGB::Blue);
+
+        // Out-of-range indices clamp, as with ModelWrapper
+        CHECK(&model.point(5000) == &model.point(Dodeca::LED_COUNT - 1));
+    }
+
+    TEST_CASE("LED groups from model.yaml") {
+        RuntimeModel model;
+        REQUIRE(model.load(dodecaBlob(), Dodeca::BLOB_SIZE));
+        CHECK(model.blob().groupCount() == 3);
+
+        uint16_t out[8];
+        REQUIRE(model.groupLeds("center", 3, out, 8) == 1);
+        CHECK(out[0] == 3 * 104);
+        REQUIRE(model.groupLeds("ring1", 11, out, 8) == 5);
+        CHECK(out[0] == 11 * 104 + 6);
+        CHECK(out[4] == 11 * 104 + 10);
+        CHECK(model.groupLeds("ring1", 11, out, 2) == 2);
+        CHECK(model.groupLeds("missing", 0, out, 8) == 0);
+        CHECK(model.groupLeds("center", 12, out, 8) == 0);
+    }
+
+    TEST_CASE("loadFile maps model.bin") {
+        BlobFile file(dodecaBlob(), Dodeca::BLOB_SIZE);
+        RuntimeModel model;
+        REQUIRE(model.loadFile(file.path));
+        CHECK(model.pointCount() == Dodeca::LED_COUNT);
+        CHECK(model.blob().size() == Dodeca::BLOB_SIZE);
+        CHECK(model.point(1247).z() == doctest::Approx(-262.0f).epsilon(0.01));
+
+        // Loading something else replaces it
+        CHECK_FALSE(model.loadFile("no_such_model.bin"));
+        CHECK_FALSE(model.loaded());
+        CHECK(model.pointCount() == 0);
+        CHECK(model.faceCount() == 0);
+        CHECK(model.point(0).id() == 0);        // Dummy point, not a crash
+    }
+
+    TEST_CASE("rejects damaged data and reads version 1 blobs") {
+        std::vector<uint8_t> bytes(dodecaBlob(), dodecaBlob() + Dodeca::BLOB_SIZE);
+        bytes[ModelBlob::HEADER_SIZE + 100] ^= 0x40;
+        RuntimeModel model;
+        CHECK_FALSE(model.load(bytes.data(), bytes.size()));
+        CHECK(model.pointCount() == 0);
+
+        // A version 1 blob is a version 2 blob without groups
+        ModelBlobWriter writer;
+        writer.setMetadata("Old", "1", "", "");
+        ModelBlob::FaceTypeRecord ft;
+        ft.type = FaceType::Square;
+        ft.num_leds = 1;
+        writer.addFaceType(ft);
+        writer.addFace(ModelBlob::FaceRecord{});
+        writer.addPoint(ModelBlob::PointRecord{}, nullptr, 0);
+        auto v1 = writer.finish();
+        v1[4] = 1;
+        REQUIRE(model.load(v1.data(), v1.size()));
+        CHECK(model.blob().formatVersion() == 1);
+        CHECK(model.pointCount() == 1);
+        CHECK(model.face(0).type() == FaceType::Square);
+    }
+
+    TEST_CASE("rejects intact blobs whose records don't agree") {
+        RuntimeModel model;
+        auto good = tinyBlob(Flaw::None);
+        REQUIRE(model.load(good.data(), good.size()));
+        CHECK(model.face(1).led_offset() == 1);
+
+        // Each has a valid checksum; face LEDs past the end would let scenes
+        // write past the platform's LED buffer through Face::leds
+        for (Flaw flaw : {Flaw::FaceLedsPastEnd, Flaw::FaceType, Flaw::PointFace, Flaw::Neighbor}) {
+            CAPTURE(static_cast<int>(flaw));
+            auto bytes = tinyBlob(flaw);
+            CHECK_FALSE(ModelBlobReader(bytes.data(), bytes.size()).valid());
+            CHECK_FALSE(model.load(bytes.data(), bytes.size()));
+            CHECK(model.pointCount() == 0);
+            CHECK(model.faceCount() == 0);
+        }
+    }
+
+    TEST_CASE("drives a Theater") {
+        auto model = std::make_unique<RuntimeModel>();
+        REQUIRE(model->load(dodecaBlob(), Dodeca::BLOB_SIZE));
+
+        Theater theater;
+        theater.useNativePlatform(std::move(model));
+        theater.addScene<ModelProbeScene>();
+        theater.start();
+        theater.update();
+
+        auto* scene = static_cast<ModelProbeScene*>(theater.currentScene());
+        REQUIRE(scene != nullptr);
+        CHECK(scene->points == Dodeca::LED_COUNT);
+        CHECK(scene->radius == Dodeca::SPHERE_RADIUS);
+        CHECK(theater.platform()->getNumLEDs() == Dodeca::LED_COUNT);
+        CHECK(theater.platform()->getLEDs()[1247] == CRGB::Red);
+
+        Theater unloaded;
+        unloaded.useNativePlatform(std::make_unique<RuntimeModel>());
+        CHECK(unloaded.platform() == nullptr);
+    }
+
+    TEST_CASE("benchmark: load and access against the compiled model") {
+        static CRGB leds[Dodeca::LED_COUNT];
+        const int loads = 50;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < loads; ++i) {
+            Model<Dodeca> compiled(leds);
+            CHECK(compiled.points[0].id() == 0);
+        }
+        const double compiled_ms = msSince(start) / loads;
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < loads; ++i) {
+            RuntimeModel model;
+            model.load(dodecaBlob(), Dodeca::BLOB_SIZE);
+            CHECK(model.point(0).id() == 0);
+        }
+        const double runtime_ms = msSince(start) / loads;
+
+        BlobFile file(dodecaBlob(), Dodeca::BLOB_SIZE);
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < loads; ++i) {
+            RuntimeModel model;
+            model.loadFile(file.path);
+            CHECK(model.pointCount() == Dodeca::LED_COUNT);
+        }
+        const double file_ms = msSince(start) / loads;
+
+        // Per access, both through IModel as scenes see them
+        ModelWrapper<Dodeca> wrapper(std::make_unique<Model<Dodeca>>(leds));
+        RuntimeModel runtime;
+        runtime.load(dodecaBlob(), Dodeca::BLOB_SIZE);
+        auto sweep = [](const IModel& model) {
+            const int passes = 200;
+            float sum = 0.0f;
+            auto begin = std::chrono::high_resolution_clock::now();
+            for (int p = 0; p < passes; ++p) {
+                for (size_t i = 0; i < model.pointCount(); ++i) sum += model.point(i).x() + model.point(i).getNeighbors()[0].distance;
+            }
+            const double ns = msSince(begin) * 1e6 / (passes * model.pointCount());
+            CHECK(sum != 0.0f);
+            return ns;
+        };
+        const double wrapper_ns = sweep(wrapper);
+        const double runtime_ns = sweep(runtime);
+
+        MESSAGE("DodecaRGBv2 load: Model<> " << compiled_ms << " ms, RuntimeModel::load " << runtime_ms
+                << " ms, loadFile " << file_ms << " ms; point access: ModelWrapper " << wrapper_ns
+                << " ns, RuntimeModel " << runtime_ns << " ns");
+    }
+}
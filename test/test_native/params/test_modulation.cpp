@@ -0,0 +1,159 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/params/modulation.h"
+
+#include <chrono>
+#include <cmath>
+#include <string>
+
+using namespace PixelTheater;
+
+namespace {
+
+Settings makeSettings() {
+    Settings settings;
+    settings.add_range_parameter("speed", 0.0f, 10.0f, 5.0f, "clamp", "Speed");
+    settings.add_parameter(ParamDef::create_ratio("level", 0.5f, Flags::CLAMP, "Level"));
+    settings.add_count_parameter("count", 0, 100, 50, "clamp", "Count");
+    settings.add_parameter(ParamDef::create_switch("enabled", true, "Enabled"));
+    return settings;
+}
+
+float value(const Settings& settings, const char* name) {
+    return settings.get_value(name).as_float();
+}
+
+} // namespace
+
+TEST_SUITE("ModulationMatrix") {
+    TEST_CASE("LFO shapes ride on the base value") {
+        Settings settings = makeSettings();
+        ModulationMatrix mod(settings);
+        const int sine = mod.add_lfo(1.0f);
+        const int square = mod.add_lfo(1.0f, ModulationMatrix::Shape::Square);
+        REQUIRE(mod.route(sine, "speed", 2.0f));
+        REQUIRE(mod.route(square, "count", 10.0f, 1.0f));
+
+        mod.update(0.25f);                              // Quarter cycle: sine peak
+        CHECK(mod.source_value(sine) == doctest::Approx(1.0f));
+        CHECK(value(settings, "speed") == doctest::Approx(7.0f));
+        CHECK(settings.get_value("count").as_int() == 61);
+        mod.update(0.5f);                               // Three quarters: trough
+        CHECK(value(settings, "speed") == doctest::Approx(3.0f));
+        CHECK(settings.get_value("count").as_int() == 41);
+
+        // Two routes to one parameter add up
+        const int saw = mod.add_lfo(1.0f, ModulationMatrix::Shape::Saw);
+        REQUIRE(mod.route(saw, "speed", 1.0f));
+        mod.update(0.25f);                              // Sine back at 0, saw at -0.5
+        CHECK(value(settings, "speed") == doctest::Approx(4.5f));
+
+        // Switches can't be modulated
+        CHECK_FALSE(mod.route(sine, "enabled", 1.0f));
+        CHECK_FALSE(mod.route(sine, "missing", 1.0f));
+        CHECK_FALSE(mod.route(9, "speed", 1.0f));
+    }
+
+    TEST_CASE("results are clamped and outside edits become the base") {
+        Settings settings = makeSettings();
+        ModulationMatrix mod(settings);
+        const int lfo = mod.add_lfo(1.0f);
+        REQUIRE(mod.route(lfo, "level", 1.0f));
+        mod.update(0.25f);
+        CHECK(value(settings, "level") == doctest::Approx(1.0f));   // 1.5 clamped
+
+        // The UI moves the knob: modulation continues around the new value
+        settings.set_value("level", ParamValue(0.2f));
+        mod.update(0.5f);
+        CHECK(value(settings, "level") == doctest::Approx(0.0f));   // 0.2 - 1 clamped
+        mod.update(0.25f);
+        CHECK(value(settings, "level") == doctest::Approx(0.2f).epsilon(0.001));
+
+        mod.unroute("level");
+        CHECK(mod.route_count() == 0);
+        CHECK(value(settings, "level") == doctest::Approx(0.2f));
+        mod.update(0.25f);
+        CHECK(value(settings, "level") == doctest::Approx(0.2f));
+    }
+
+    TEST_CASE("envelope stages") {
+        Settings settings = makeSettings();
+        ModulationMatrix mod(settings);
+        const int env = mod.add_envelope(0.1f, 0.2f, 0.5f, 0.5f);
+        REQUIRE(mod.route(env, "speed", 4.0f));
+        mod.update(0.05f);
+        CHECK(mod.source_value(env) == 0.0f);           // Idle until triggered
+
+        mod.trigger(env);
+        mod.update(0.05f);
+        CHECK(mod.source_value(env) == doctest::Approx(0.5f));
+        mod.update(0.05f);
+        CHECK(mod.source_value(env) == doctest::Approx(1.0f));
+        CHECK(value(settings, "speed") == doctest::Approx(9.0f));
+        for (int i = 0; i < 10; ++i) mod.update(0.05f);
+        CHECK(mod.source_value(env) == doctest::Approx(0.5f));  // Sustain
+
+        mod.release(env);
+        mod.update(0.125f);
+        CHECK(mod.source_value(env) == doctest::Approx(0.25f));
+        mod.update(0.5f);
+        CHECK(mod.source_value(env) == 0.0f);
+        CHECK(value(settings, "speed") == doctest::Approx(5.0f));
+    }
+
+    TEST_CASE("random walk stays in range and is repeatable") {
+        Settings a = makeSettings(), b = makeSettings();
+        ModulationMatrix ma(a), mb(b);
+        const int wa = ma.add_random_walk(2.0f, 42);
+        const int wb = mb.add_random_walk(2.0f, 42);
+        float lo = 1.0f, hi = -1.0f;
+        for (int i = 0; i < 5000; ++i) {
+            ma.update(1.0f / 60.0f);
+            mb.update(1.0f / 60.0f);
+            lo = std::min(lo, ma.source_value(wa));
+            hi = std::max(hi, ma.source_value(wa));
+        }
+        CHECK(ma.source_value(wa) == mb.source_value(wb));
+        CHECK(lo >= -1.0f);
+        CHECK(hi <= 1.0f);
+        CHECK(hi - lo > 0.5f);                          // It does wander
+    }
+
+    TEST_CASE("routes survive parameters being added") {
+        Settings settings = makeSettings();
+        ModulationMatrix mod(settings);
+        const int lfo = mod.add_lfo(1.0f, ModulationMatrix::Shape::Square);
+        REQUIRE(mod.route(lfo, "count", 5.0f));
+        settings.add_range_parameter("late", 0.0f, 1.0f, 0.5f);
+        mod.update(0.1f);
+        CHECK(settings.get_value("count").as_int() == 55);
+
+        mod.clear();
+        CHECK(settings.get_value("count").as_int() == 50);
+        CHECK(mod.source_count() == 0);
+    }
+
+    TEST_CASE("benchmark: 32 routes per frame") {
+        Settings settings;
+        for (int i = 0; i < 16; ++i) {
+            settings.add_range_parameter("param_" + std::to_string(i), 0.0f, 10.0f, 5.0f, "clamp");
+        }
+        ModulationMatrix mod(settings);
+        int sources[8];
+        for (int i = 0; i < 4; ++i) sources[i] = mod.add_lfo(0.1f * (i + 1), static_cast<ModulationMatrix::Shape>(i));
+        for (int i = 4; i < 6; ++i) sources[i] = mod.add_random_walk(0.5f, i + 1);
+        for (int i = 6; i < 8; ++i) {
+            sources[i] = mod.add_envelope(0.5f, 0.5f, 0.5f, 1.0f);
+            mod.trigger(sources[i]);
+        }
+        for (int r = 0; r < 32; ++r) {
+            REQUIRE(mod.route(sources[r % 8], "param_" + std::to_string(r % 16), 0.5f + 0.1f * (r % 5)));
+        }
+        CHECK(mod.route_count() == 32);
+
+        const int frames = 20000;
+        const auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f) mod.update(1.0f / 60.0f);
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / frames;
+        MESSAGE("modulation: 8 sources, 32 routes onto 16 params: " << ns << " ns/frame");
+    }
+}
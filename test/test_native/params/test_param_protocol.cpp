@@ -0,0 +1,288 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/scene.h"
+#include "PixelTheater/params/param_protocol.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace PixelTheater;
+using namespace PixelTheater::ParamProtocol;
+
+namespace {
+
+class ProtocolTestScene : public Scene {
+public:
+    void setup() override {
+        param("speed", "range", 0.1f, 2.0f, 1.0f, "clamp", "Animation speed");
+        param("brightness", "ratio", 0.8f, "clamp", "Overall brightness");
+        param("count", "count", 1, 10, 5, "clamp", "Item count");
+        param("enabled", "switch", true, "", "Enable feature");
+        param("hue", "count", 0, 255, 0, "wrap", "Base hue");
+        param("spin", "signed_angle", 0.0f, "wrap", "Rotation");
+    }
+
+    void addExtra() { param("extra", "ratio", 0.5f, "", "Added later"); }
+};
+
+// A scene the size of the bigger ones in src/scenes
+class WideScene : public Scene {
+public:
+    void setup() override {
+        set_name("Wide");
+        for (int i = 0; i < 16; ++i) {
+            param("level_" + std::to_string(i), "range", 0.0f, 10.0f, 1.0f, "clamp", "Level");
+        }
+    }
+};
+
+float settingFloat(Scene& scene, const std::string& name) {
+    return scene._settings_storage.get_value(name).as_float();
+}
+
+// What a JSON control channel would send: {"name":value,...}
+std::string jsonUpdate(const SceneParameterSchema& schema, const std::vector<float>& values) {
+    std::ostringstream json;
+    json << "{";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i) json << ",";
+        json << "\"" << schema.parameters[i].name << "\":" << values[i];
+    }
+    json << "}";
+    return json.str();
+}
+
+// Minimal parse of the flat object above, applying each value by name
+size_t applyJsonUpdate(Scene& scene, const std::string& json) {
+    size_t applied = 0;
+    const char* p = json.c_str();
+    while ((p = strchr(p, '"')) != nullptr) {
+        const char* end = strchr(p + 1, '"');
+        if (!end || end[1] != ':') break;
+        std::string name(p + 1, end);
+        char* next = nullptr;
+        const float value = strtof(end + 2, &next);
+        scene._settings_storage.set_value(name, ParamValue(value));
+        applied++;
+        p = next;
+    }
+    return applied;
+}
+
+} // namespace
+
+TEST_SUITE("ParamProtocol") {
+    TEST_CASE("schema is cached until the parameters or metadata change") {
+        ProtocolTestScene scene;
+        scene.setup();
+        const SceneParameterSchema* first = &scene.parameter_schema();
+        const std::string* json = &scene.parameter_schema_json();
+        const uint32_t version = scene.schema_version();
+        CHECK(version != 0);
+        CHECK(&scene.parameter_schema() == first);
+        CHECK(&scene.parameter_schema_json() == json);
+        CHECK(json->find("\"version\": " + std::to_string(version)) != std::string::npos);
+
+        // Declaration order, which is also the protocol index order
+        REQUIRE(first->parameters.size() == 6);
+        CHECK(first->parameters[0].name == "speed");
+        CHECK(first->parameters[3].name == "enabled");
+        CHECK(first->parameters[3].param_type == ParamType::switch_type);
+
+        // Values are not part of the schema
+        scene.settings["speed"] = 1.5f;
+        CHECK(scene.schema_version() == version);
+        const std::string before = scene.parameter_schema_json();
+
+        // Same parameters elsewhere: same version
+        ProtocolTestScene other;
+        other.setup();
+        CHECK(other.schema_version() == version);
+
+        scene.set_name("Renamed");
+        CHECK(scene.schema_version() != version);
+        CHECK(scene.parameter_schema_json() != before);
+        CHECK(scene.parameter_schema_json().find("Renamed") != std::string::npos);
+
+        const uint32_t renamed = scene.schema_version();
+        scene.addExtra();
+        CHECK(scene.schema_version() != renamed);
+        CHECK(scene.parameter_schema().parameters.size() == 7);
+    }
+
+    TEST_CASE("batched set and get round trip") {
+        ProtocolTestScene scene;
+        scene.setup();
+        const SceneParameterSchema& schema = scene.parameter_schema();
+        uint8_t request[64], reply[256];
+
+        const Update updates[] = {
+            {0, ParamValue(1.5f)},
+            {1, ParamValue(2.0f)},      // Clamped to 1.0
+            {2, ParamValue(7)},
+            {3, ParamValue(false)},
+            {4, ParamValue(260)},       // Wraps
+        };
+        const size_t len = encode_set(schema, updates, 5, request, sizeof(request));
+        CHECK(len == REQUEST_HEADER + 5 + 4 * 4 + 1);
+
+        const size_t reply_len = handle(scene, request, len, reply, sizeof(reply));
+        REQUIRE(reply_len > REPLY_HEADER);
+        Reply decoded;
+        Update values[8];
+        REQUIRE(decode_reply(schema, reply, reply_len, decoded, values, 8));
+        CHECK(decoded.status == Status::Ok);
+        CHECK(decoded.op == Op::Set);
+        REQUIRE(decoded.count == 5);
+        CHECK(values[0].value.as_float() == doctest::Approx(1.5f));
+        CHECK(values[1].value.as_float() == doctest::Approx(1.0f));
+        CHECK(values[2].value.as_int() == 7);
+        CHECK(values[3].value.as_bool() == false);
+        CHECK(values[4].value.as_int() == scene._settings_storage.get_value("hue").as_int());
+
+        CHECK(settingFloat(scene, "speed") == doctest::Approx(1.5f));
+        CHECK(int(scene.settings["count"]) == 7);
+        CHECK(bool(scene.settings["enabled"]) == false);
+
+        // Get everything
+        const size_t get_len = encode_get(schema, nullptr, 0, request, sizeof(request));
+        REQUIRE(decode_reply(schema, reply, handle(scene, request, get_len, reply, sizeof(reply)),
+                             decoded, values, 8));
+        CHECK(decoded.op == Op::Get);
+        REQUIRE(decoded.count == 6);
+        CHECK(values[5].index == 5);
+        CHECK(values[2].value.as_int() == 7);
+
+        // Get a subset
+        const uint8_t some[] = {3, 0};
+        const size_t some_len = encode_get(schema, some, 2, request, sizeof(request));
+        REQUIRE(decode_reply(schema, reply, handle(scene, request, some_len, reply, sizeof(reply)),
+                             decoded, values, 8));
+        REQUIRE(decoded.count == 2);
+        CHECK(values[0].index == 3);
+        CHECK(values[1].value.as_float() == doctest::Approx(1.5f));
+    }
+
+    TEST_CASE("bad requests are rejected whole") {
+        ProtocolTestScene scene;
+        scene.setup();
+        SceneParameterSchema schema = scene.parameter_schema();
+        uint8_t request[64], reply[256];
+        Reply decoded;
+        Update values[8];
+
+        // One bad index: nothing is applied
+        const Update good[] = {{0, ParamValue(1.9f)}, {2, ParamValue(3)}};
+        size_t len = encode_set(schema, good, 2, request, sizeof(request));
+        request[REQUEST_HEADER + 5] = 42;               // Second entry's index
+        REQUIRE(decode_reply(schema, reply, handle(scene, request, len, reply, sizeof(reply)),
+                             decoded, values, 8));
+        CHECK(decoded.status == Status::BadIndex);
+        CHECK(settingFloat(scene, "speed") == doctest::Approx(1.0f));
+
+        // Truncated
+        len = encode_set(schema, good, 2, request, sizeof(request));
+        decode_reply(schema, reply, handle(scene, request, len - 1, reply, sizeof(reply)), decoded, values, 8);
+        CHECK(decoded.status == Status::Truncated);
+        CHECK(settingFloat(scene, "speed") == doctest::Approx(1.0f));
+
+        // Unknown op
+        request[0] = 9;
+        decode_reply(schema, reply, handle(scene, request, len, reply, sizeof(reply)), decoded, values, 8);
+        CHECK(decoded.status == Status::BadOp);
+
+        // Schema changed since the client fetched it
+        scene.addExtra();
+        len = encode_set(schema, good, 2, request, sizeof(request));
+        REQUIRE(decode_reply(schema, reply, handle(scene, request, len, reply, sizeof(reply)),
+                             decoded, values, 8));
+        CHECK(decoded.status == Status::StaleSchema);
+        CHECK(decoded.version == scene.schema_version());
+        CHECK(settingFloat(scene, "speed") == doctest::Approx(1.0f));
+
+        // Reply too big for the buffer
+        schema = scene.parameter_schema();
+        const size_t get_len = encode_get(schema, nullptr, 0, request, sizeof(request));
+        decode_reply(schema, reply, handle(scene, request, get_len, reply, 16), decoded, values, 8);
+        CHECK(decoded.status == Status::Overflow);
+        CHECK(handle(scene, request, get_len, reply, REPLY_HEADER - 1) == 0);
+    }
+
+    TEST_CASE("schema request returns the cached JSON") {
+        ProtocolTestScene scene;
+        scene.setup();
+        uint8_t request[16];
+        std::vector<uint8_t> reply(4096);
+        const size_t len = encode_schema_request(0, request, sizeof(request));
+        const size_t reply_len = handle(scene, request, len, reply.data(), reply.size());
+
+        Reply decoded;
+        REQUIRE(decode_reply(SceneParameterSchema(), reply.data(), reply_len, decoded, nullptr, 0));
+        CHECK(decoded.status == Status::Ok);
+        CHECK(decoded.version == scene.schema_version());
+        CHECK(std::string(decoded.json, decoded.json_length) == scene.parameter_schema_json());
+    }
+
+    TEST_CASE("benchmark: binary protocol vs JSON") {
+        WideScene scene;
+        scene.setup();
+        const SceneParameterSchema& schema = scene.parameter_schema();
+        const size_t n = schema.parameters.size();
+        std::vector<float> levels(n);
+        std::vector<Update> updates(n);
+        for (size_t i = 0; i < n; ++i) {
+            levels[i] = 0.25f * static_cast<float>(i);
+            updates[i] = {static_cast<uint8_t>(i), ParamValue(levels[i])};
+        }
+        using Clock = std::chrono::steady_clock;
+        auto ns_per = [](Clock::time_point start, int rounds) {
+            return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / rounds;
+        };
+        volatile size_t sink = 0;
+
+        // Schema: generated every call (the old path) vs cached
+        const int schema_rounds = 2000;
+        auto start = Clock::now();
+        for (int r = 0; r < schema_rounds; ++r) sink = sink + ParamSchema::generate_schema(scene).to_json().size();
+        const double schema_uncached = ns_per(start, schema_rounds);
+        start = Clock::now();
+        for (int r = 0; r < schema_rounds; ++r) sink = sink + scene.parameter_schema_json().size();
+        const double schema_cached = ns_per(start, schema_rounds);
+
+        // A batch setting every parameter
+        const int rounds = 20000;
+        std::string json;
+        start = Clock::now();
+        for (int r = 0; r < rounds; ++r) json = jsonUpdate(schema, levels);
+        const double json_encode = ns_per(start, rounds);
+        start = Clock::now();
+        for (int r = 0; r < rounds; ++r) sink = sink + applyJsonUpdate(scene, json);
+        const double json_decode = ns_per(start, rounds);
+
+        uint8_t request[256], reply[256];
+        size_t len = 0;
+        start = Clock::now();
+        for (int r = 0; r < rounds; ++r) len = encode_set(schema, updates.data(), n, request, sizeof(request));
+        const double bin_encode = ns_per(start, rounds);
+        REQUIRE(len > 0);
+        size_t reply_len = 0;
+        start = Clock::now();
+        for (int r = 0; r < rounds; ++r) reply_len = handle(scene, request, len, reply, sizeof(reply));
+        const double bin_decode = ns_per(start, rounds);
+
+        Reply decoded;
+        std::vector<Update> values(n);
+        REQUIRE(decode_reply(schema, reply, reply_len, decoded, values.data(), n));
+        CHECK(decoded.count == n);
+        CHECK(values[n - 1].value.as_float() == doctest::Approx(levels[n - 1]));
+        CHECK(settingFloat(scene, "level_3") == doctest::Approx(0.75f));
+
+        MESSAGE("schema JSON " << schema_uncached << " ns generated, " << schema_cached << " ns cached; "
+                << n << "-param set: JSON " << json.size() << " bytes, " << json_encode << " ns encode, "
+                << json_decode << " ns apply; binary " << len << " bytes, " << bin_encode << " ns encode, "
+                << bin_decode << " ns apply+reply");
+    }
+}
@@ -0,0 +1,225 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/settings.h"
+#include "PixelTheater/params/preset.h"
+#include "PixelTheater/params/file_preset_storage.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using namespace PixelTheater;
+
+namespace {
+
+Settings makeSettings() {
+    Settings settings;
+    settings.add_range_parameter("speed", 0.0f, 10.0f, 1.0f, "clamp", "Speed");
+    settings.add_parameter(ParamDef::create_ratio("brightness", 0.5f, Flags::CLAMP, "Brightness"));
+    settings.add_count_parameter("count", 0, 100, 10, "clamp", "Count");
+    settings.add_parameter(ParamDef::create_switch("enabled", true, "Enabled"));
+    return settings;
+}
+
+float floatAt(const Settings& settings, const char* name) {
+    return settings.get_value(name).as_float();
+}
+
+// In-memory storage that counts writes
+class MemoryStorage : public PresetStorage {
+public:
+    uint8_t bytes[1024] = {};
+    size_t writes = 0;
+
+    size_t capacity() const override { return sizeof(bytes); }
+    bool read(size_t offset, uint8_t* dst, size_t len) override {
+        if (offset + len > sizeof(bytes)) return false;
+        for (size_t i = 0; i < len; ++i) dst[i] = bytes[offset + i];
+        return true;
+    }
+    bool write(size_t offset, const uint8_t* src, size_t len) override {
+        if (offset + len > sizeof(bytes)) return false;
+        for (size_t i = 0; i < len; ++i) bytes[offset + i] = src[i];
+        writes += len;
+        return true;
+    }
+};
+
+} // namespace
+
+TEST_SUITE("Presets") {
+    TEST_CASE("snapshot and recall every value") {
+        Settings settings = makeSettings();
+        settings.set_value("speed", ParamValue(4.5f));
+        settings.set_value("count", ParamValue(42));
+        settings.set_value("enabled", ParamValue(false));
+
+        Preset preset;
+        REQUIRE(settings.snapshot(preset));
+        CHECK(preset.count() == 4);
+        CHECK(preset.size() == Preset::HEADER_SIZE + 3 * 4 + 1);
+
+        settings.reset_all();
+        CHECK(floatAt(settings, "speed") == doctest::Approx(1.0f));
+        REQUIRE(settings.recall(preset));
+        CHECK(floatAt(settings, "speed") == doctest::Approx(4.5f));
+        CHECK(settings.get_value("count").as_int() == 42);
+        CHECK(settings.get_value("enabled").as_bool() == false);
+
+        // Round trip through raw bytes
+        Preset copy;
+        REQUIRE(copy.assign(preset.data(), preset.size()));
+        CHECK(copy.layout() == settings.layout_hash());
+        CHECK_FALSE(copy.assign(preset.data(), Preset::HEADER_SIZE));   // Values cut off
+    }
+
+    TEST_CASE("presets only recall into the same layout") {
+        Settings settings = makeSettings();
+        Preset preset;
+        REQUIRE(settings.snapshot(preset));
+
+        Settings same = makeSettings();
+        CHECK(same.layout_hash() == settings.layout_hash());
+        CHECK(same.recall(preset));
+
+        Settings more = makeSettings();
+        more.add_range_parameter("extra", 0.0f, 1.0f, 0.5f);
+        CHECK_FALSE(more.recall(preset));
+
+        // Same names, different type
+        Settings retyped;
+        retyped.add_range_parameter("speed", 0.0f, 10.0f, 1.0f);
+        retyped.add_parameter(ParamDef::create_ratio("brightness", 0.5f, Flags::NONE, ""));
+        retyped.add_range_parameter("count", 0.0f, 100.0f, 10.0f);
+        retyped.add_parameter(ParamDef::create_switch("enabled", true, ""));
+        CHECK(retyped.layout_hash() != settings.layout_hash());
+        CHECK_FALSE(retyped.recall(preset));
+
+        Preset blank;
+        CHECK_FALSE(settings.recall(blank));
+    }
+
+    TEST_CASE("morph interpolates numeric values from flat arrays") {
+        Settings settings = makeSettings();
+        Preset a, b;
+        settings.set_value("speed", ParamValue(2.0f));
+        settings.set_value("count", ParamValue(0));
+        REQUIRE(settings.snapshot(a));
+        settings.set_value("speed", ParamValue(6.0f));
+        settings.set_value("count", ParamValue(9));
+        settings.set_value("enabled", ParamValue(false));
+        REQUIRE(settings.snapshot(b));
+
+        PresetMorph morph;
+        REQUIRE(morph.begin(settings, a, b, 1.0f));
+        morph.apply(settings, 0.25f);
+        CHECK(floatAt(settings, "speed") == doctest::Approx(3.0f));
+        CHECK(settings.get_value("count").as_int() == 2);           // 2.25 rounds down
+        CHECK(settings.get_value("enabled").as_bool() == true);     // Not halfway yet
+        CHECK(floatAt(settings, "brightness") == doctest::Approx(0.5f));
+
+        CHECK(morph.update(settings, 0.5f));
+        CHECK(morph.progress() == doctest::Approx(0.5f));
+        CHECK(floatAt(settings, "speed") == doctest::Approx(4.0f));
+        CHECK(settings.get_value("enabled").as_bool() == false);
+
+        CHECK_FALSE(morph.update(settings, 0.75f));                 // Overshoot lands on b
+        CHECK_FALSE(morph.active());
+        CHECK(floatAt(settings, "speed") == doctest::Approx(6.0f));
+        CHECK(settings.get_value("count").as_int() == 9);
+
+        // From the current values
+        REQUIRE(morph.begin(settings, a, 2.0f));
+        morph.update(settings, 1.0f);
+        CHECK(floatAt(settings, "speed") == doctest::Approx(4.0f));
+
+        Settings other = makeSettings();
+        other.add_range_parameter("extra", 0.0f, 1.0f, 0.5f);
+        CHECK_FALSE(morph.begin(other, a, b, 1.0f));
+    }
+
+    TEST_CASE("bank keeps slots in RAM and writes through") {
+        MemoryStorage storage;
+        Settings settings = makeSettings();
+        {
+            PresetBank bank(storage, 8);
+            CHECK(bank.slot_count() == 4);                          // 1024 bytes hold 4 slots
+            CHECK(bank.load() == 0);
+            settings.set_value("speed", ParamValue(7.0f));
+            REQUIRE(bank.save(2, settings));
+            CHECK(storage.writes == bank.slot(2)->size());          // Only the used bytes
+            CHECK_FALSE(bank.save(4, settings));
+            CHECK(bank.slot(0) == nullptr);
+        }
+
+        PresetBank bank(storage, 4);
+        CHECK(bank.load() == 1);
+        settings.reset_all();
+        REQUIRE(bank.recall(2, settings));
+        CHECK(floatAt(settings, "speed") == doctest::Approx(7.0f));
+        CHECK_FALSE(bank.recall(1, settings));
+
+        REQUIRE(bank.erase(2));
+        CHECK(bank.slot(2) == nullptr);
+        PresetBank reloaded(storage, 4);
+        CHECK(reloaded.load() == 0);
+    }
+
+    TEST_CASE("file storage persists presets") {
+        const std::string path = "/tmp/pixeltheater_presets_test.bin";
+        std::remove(path.c_str());
+        Settings settings = makeSettings();
+        settings.set_value("count", ParamValue(77));
+        {
+            FilePresetStorage storage(path);
+            PresetBank bank(storage, 16);
+            CHECK(bank.load() == 0);                                // No file yet
+            REQUIRE(bank.save(5, settings));
+        }
+        settings.reset_all();
+        FilePresetStorage storage(path);
+        PresetBank bank(storage, 16);
+        CHECK(bank.load() == 1);
+        REQUIRE(bank.recall(5, settings));
+        CHECK(settings.get_value("count").as_int() == 77);
+        std::remove(path.c_str());
+    }
+
+    TEST_CASE("benchmark: recall and morph vs string lookups") {
+        Settings settings;
+        for (int i = 0; i < 24; ++i) {
+            settings.add_range_parameter("param_" + std::to_string(i), 0.0f, 10.0f, 1.0f, "clamp");
+        }
+        Preset a, b;
+        REQUIRE(settings.snapshot(a));
+        for (int i = 0; i < 24; ++i) settings.set_value("param_" + std::to_string(i), ParamValue(5.0f));
+        REQUIRE(settings.snapshot(b));
+        std::vector<std::string> names;
+        for (int i = 0; i < 24; ++i) names.push_back("param_" + std::to_string(i));
+
+        using Clock = std::chrono::steady_clock;
+        const int rounds = 20000;
+        auto start = Clock::now();
+        for (int r = 0; r < rounds; ++r) settings.recall((r & 1) ? a : b);
+        const double recall_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / rounds;
+
+        PresetMorph morph;
+        REQUIRE(morph.begin(settings, a, b, 1.0f));
+        start = Clock::now();
+        for (int r = 0; r < rounds; ++r) morph.apply(settings, static_cast<float>(r % 100) / 100.0f);
+        const double morph_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / rounds;
+
+        // The same interpolation through name lookups
+        start = Clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            const float t = static_cast<float>(r % 100) / 100.0f;
+            for (const auto& name : names) {
+                const float from = 1.0f, to = settings.get_value(name).as_float() * 0.0f + 5.0f;
+                settings.set_value(name, ParamValue(from + (to - from) * t));
+            }
+        }
+        const double lookup_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / rounds;
+
+        MESSAGE("24 params: recall " << recall_ns << " ns, morph frame " << morph_ns
+                << " ns, same by name " << lookup_ns << " ns");
+    }
+}
@@ -0,0 +1,178 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/particles/particle_system.h"
+#include "PixelTheater/core/led_buffer_wrapper.h"
+#include "PixelTheater/platform/native_platform.h"
+
+#include <chrono>
+#include <cmath>
+
+using namespace PixelTheater;
+
+namespace {
+
+constexpr float RADIUS = 100.0f;
+
+// Evenly spread LED positions (Fibonacci sphere) for splat tests
+void indexFibonacciSphere(SphereHash<>& hash, uint16_t count) {
+    hash.reserve(count);
+    const float golden = 2.39996323f;
+    for (uint16_t i = 0; i < count; ++i) {
+        float z = 1.0f - 2.0f * (i + 0.5f) / count;
+        float r = std::sqrt(1.0f - z * z);
+        hash.insert(i, std::cos(golden * i) * r * RADIUS, std::sin(golden * i) * r * RADIUS, z * RADIUS);
+    }
+    hash.build();
+}
+
+ParticleSpawn particleAt(float x, float y, float z, float life = 1.0f) {
+    ParticleSpawn p;
+    p.x = x; p.y = y; p.z = z;
+    p.life = life;
+    return p;
+}
+
+} // namespace
+
+TEST_SUITE("ParticleSystem") {
+    TEST_CASE("spawn respects capacity") {
+        ParticleSystem<3> ps;
+        CHECK(ps.empty());
+        CHECK(ps.spawn(particleAt(1, 0, 0)));
+        CHECK(ps.spawn(particleAt(2, 0, 0)));
+        CHECK(ps.spawn(particleAt(3, 0, 0)));
+        CHECK(ps.full());
+        CHECK_FALSE(ps.spawn(particleAt(4, 0, 0)));
+        CHECK(ps.size() == 3);
+        CHECK_FALSE(ps.spawn(particleAt(0, 0, 0, 0.0f))); // Zero life is rejected
+    }
+
+    TEST_CASE("kill swaps the last particle into the hole") {
+        ParticleSystem<4> ps;
+        ps.spawn(particleAt(1, 0, 0));
+        ps.spawn(particleAt(2, 0, 0));
+        ps.spawn(particleAt(3, 0, 0));
+        ps.kill(0);
+        CHECK(ps.size() == 2);
+        CHECK(ps.x[0] == doctest::Approx(3.0f));
+        CHECK(ps.x[1] == doctest::Approx(2.0f));
+
+        ps.kill(1); // Last one
+        CHECK(ps.size() == 1);
+        ps.kill(5); // Out of range is ignored
+        CHECK(ps.size() == 1);
+    }
+
+    TEST_CASE("update integrates, ages and removes dead particles") {
+        ParticleSystem<8> ps;
+        ParticleSpawn p = particleAt(0, 0, 0, 1.0f);
+        p.vx = 10.0f;
+        ps.spawn(p);
+        ps.spawn(particleAt(5, 5, 5, 0.05f));
+
+        ps.update(0.1f);
+        REQUIRE(ps.size() == 1); // Short-lived particle died
+        CHECK(ps.x[0] == doctest::Approx(1.0f));
+        CHECK(ps.life[0] == doctest::Approx(0.9f));
+
+        ps.update(0.1f, 0.0f, 5.0f); // Drag halves velocity over 0.1s
+        CHECK(ps.vx[0] == doctest::Approx(5.0f));
+    }
+
+    TEST_CASE("radius keeps particles on the sphere surface") {
+        ParticleSystem<8> ps;
+        ParticleSpawn p = particleAt(RADIUS, 0, 0, 10.0f);
+        p.vx = 50.0f; // Radial: removed
+        p.vy = 50.0f; // Tangent: kept
+        ps.spawn(p);
+        for (int i = 0; i < 20; ++i) ps.update(0.05f, RADIUS);
+        float len = std::sqrt(ps.x[0] * ps.x[0] + ps.y[0] * ps.y[0] + ps.z[0] * ps.z[0]);
+        CHECK(len == doctest::Approx(RADIUS));
+        float radial = (ps.vx[0] * ps.x[0] + ps.vy[0] * ps.y[0] + ps.vz[0] * ps.z[0]) / len;
+        CHECK(std::fabs(radial) < 0.5f);
+    }
+
+    TEST_CASE("emitter spawns at its rate with tangent velocity") {
+        NativePlatform platform(1);
+        ParticleSystem<64> ps;
+        ParticleEmitter emitter;
+        emitter.x = 0; emitter.y = 0; emitter.z = RADIUS;
+        emitter.rate = 10.0f;
+        emitter.speed = 20.0f;
+
+        uint16_t total = 0;
+        for (int i = 0; i < 10; ++i) total += emitter.emit(ps, 0.1f, platform); // 1 second
+        CHECK(total == 10);
+        CHECK(ps.size() == 10);
+        for (uint16_t i = 0; i < ps.size(); ++i) {
+            CHECK(ps.vz[i] == doctest::Approx(0.0f).epsilon(1e-3));
+            float speed = std::sqrt(ps.vx[i] * ps.vx[i] + ps.vy[i] * ps.vy[i]);
+            CHECK(speed == doctest::Approx(20.0f));
+        }
+
+        // A full pool drops the burst instead of saving it up
+        emitter.rate = 1000.0f;
+        emitter.emit(ps, 1.0f, platform);
+        CHECK(ps.full());
+        ps.clear();
+        emitter.rate = 0.0f;
+        CHECK(emitter.emit(ps, 1.0f, platform) == 0);
+    }
+
+    TEST_CASE("render splats additively onto nearby LEDs") {
+        SphereHash<> leds_index;
+        indexFibonacciSphere(leds_index, 500);
+        CRGB buffer[500];
+        LedBufferWrapper leds(buffer, 500);
+
+        ParticleSystem<4> ps;
+        ParticleSpawn p = particleAt(0, 0, RADIUS);
+        p.color = CRGB(200, 0, 0);
+        ps.spawn(p);
+        ps.render(leds, leds_index, 0.3f);
+
+        int lit = 0;
+        for (int i = 0; i < 500; ++i) {
+            if (buffer[i].r > 0) lit++;
+            CHECK(buffer[i].g == 0);
+        }
+        CHECK(lit > 0);
+        CHECK(lit < 50);
+        // Closest LED (index 0 is nearest +Z on a Fibonacci sphere) is brightest
+        CHECK(buffer[0].r > 150);
+        // Opposite side untouched
+        CHECK(buffer[499] == CRGB(0, 0, 0));
+    }
+
+    TEST_CASE("benchmark: 10k particles update and render") {
+        static ParticleSystem<10000> ps;
+        SphereHash<> leds_index;
+        static CRGB buffer[1248];
+        indexFibonacciSphere(leds_index, 1248);
+        LedBufferWrapper leds(buffer, 1248);
+        NativePlatform platform(1);
+
+        ParticleEmitter emitter;
+        emitter.z = RADIUS;
+        emitter.speed = 40.0f;
+        emitter.speed_jitter = 20.0f;
+        emitter.life = 1000.0f; // Live for the whole benchmark
+        ps.clear();
+        while (!ps.full()) ps.spawn(emitter.makeParticle(platform));
+        // Scatter starting points so splats cover the sphere
+        for (uint16_t i = 0; i < ps.size(); ++i) {
+            ps.x[i] = platform.randomFloat(-1, 1); ps.y[i] = platform.randomFloat(-1, 1); ps.z[i] = platform.randomFloat(-1, 1);
+        }
+        ps.update(0.0f, RADIUS);
+
+        const int frames = 20;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < frames; ++f) ps.update(1.0f / 60.0f, RADIUS);
+        auto mid = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < frames; ++f) ps.render(leds, leds_index, 0.08f);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        CHECK(ps.size() == 10000);
+        auto us = [](auto a, auto b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+        MESSAGE("10k particles: update " << us(start, mid) / frames << " us/frame, render " << us(mid, end) / frames << " us/frame");
+    }
+}
@@ -0,0 +1,383 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/platform/output_map.h"
+#include "PixelTheater/platform/native_platform.h"
+#include "PixelTheater/model/runtime_model.h"
+#include "PixelTheater/core/dirty_tracker.h"
+#include "PixelTheater/core/led_buffer_wrapper.h"
+#include "PixelTheater/core/model_wrapper.h"
+#include "PixelTheater/theater.h"
+#include "models/DodecaRGBv2/model.h"
+#include "synthetic_model.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+using Dodeca = Models::DodecaRGBv2;
+
+// Records each channel's bytes as a parallel driver would clock them out
+class FakeDriver : public OutputDriver {
+public:
+    std::vector<std::vector<uint8_t>> channels;
+    size_t writes = 0;
+    size_t frames = 0;
+
+    void write(size_t channel, const uint8_t* bytes, size_t size) override {
+        if (channels.size() <= channel) channels.resize(channel + 1);
+        channels[channel].assign(bytes, bytes + size);
+        ++writes;
+    }
+    void show() override { ++frames; }
+};
+
+// Faces of the given sizes, back to back; no points beyond their count
+class FaceSizesModel : public IModel {
+public:
+    explicit FaceSizesModel(std::initializer_list<uint16_t> sizes) {
+        uint16_t offset = 0;
+        for (uint16_t size : sizes) {
+            _faces.emplace_back(FaceType::Pentagon, uint8_t(_faces.size()), offset, size, nullptr, 5);
+            offset += size;
+        }
+        _count = offset;
+    }
+    const Point& point(size_t) const override { return _point; }
+    size_t pointCount() const noexcept override { return _count; }
+    const Face& face(size_t index) const override { return _faces[index]; }
+    size_t faceCount() const noexcept override { return _faces.size(); }
+    float getSphereRadius() const override { return 1.0f; }
+
+private:
+    std::vector<Face> _faces;
+    Point _point;
+    size_t _count = 0;
+};
+
+// Every LED a different colour: index in red and green, face in blue
+class IndexScene : public Scene {
+public:
+    void setup() override {}
+    void tick() override {
+        Scene::tick();
+        for (size_t i = 0; i < ledCount(); ++i) {
+            leds[i] = CRGB(uint8_t(i), uint8_t(i >> 8), uint8_t(model().point(i).face_id()));
+        }
+    }
+};
+
+// Tracks its LEDs and, after the first frame, changes one LED of face 0 per frame
+class FirstFaceScene : public Scene {
+public:
+    void setup() override { set_dirty_tracking(true); }
+    void tick() override {
+        Scene::tick();
+        leds[tick_count() % 104] = CRGB(uint8_t(tick_count()), 0, 0);
+    }
+};
+
+// Each channel's longest run, for checking a split's balance
+size_t longest(const OutputMap& map) {
+    size_t most = 0;
+    for (size_t c = 0; c < map.channels(); ++c) most = std::max(most, map.channelLength(c));
+    return most;
+}
+
+} // namespace
+
+TEST_SUITE("OutputMap") {
+    TEST_CASE("even split keeps model order") {
+        OutputMap map;
+        REQUIRE(map.splitEvenly(1248, 2));
+        CHECK(map.channels() == 2);
+        CHECK(map.channelLength(0) == 624);
+        CHECK(map.channelLength(1) == 624);
+        for (size_t i = 0; i < 1248; ++i) CHECK(map.slot(i) == i);
+
+        // Lengths differ by at most one; the buffer pads the short channels
+        REQUIRE(map.splitEvenly(10, 3));
+        CHECK(map.channelLength(0) == 4);
+        CHECK(map.channelLength(2) == 3);
+        CHECK(map.stride() == 4);
+        CHECK(map.bufferSize() == 12);
+        CHECK(map.channelOf(4) == 1);
+        CHECK(map.positionOf(4) == 0);
+        CHECK(map.slot(9) == 2 * 4 + 2);
+        CHECK(map.source(2, 2) == 9);
+    }
+
+    TEST_CASE("face split on DodecaRGBv2") {
+        static CRGB leds[Dodeca::LED_COUNT];
+        ModelWrapper<Dodeca> model(std::make_unique<Model<Dodeca>>(leds));
+        OutputMap map;
+
+        // Two channels: the original wiring, faces 0-5 and 6-11
+        REQUIRE(map.splitByFace(model, 2));
+        CHECK(map.stride() == 624);
+        for (size_t i = 0; i < Dodeca::LED_COUNT; ++i) CHECK(map.slot(i) == i);
+
+        REQUIRE(map.splitByFace(model, 4));
+        CHECK(map.stride() == 312);
+        CHECK(map.channelOf(3 * 104) == 1);
+        CHECK(map.positionOf(3 * 104) == 0);
+
+        // 12 faces don't split 5 ways evenly: the longest is still 3 faces,
+        // and no channel is left idle
+        REQUIRE(map.splitByFace(model, 5));
+        CHECK(longest(map) == 312);
+        for (size_t c = 0; c < 5; ++c) CHECK(map.channelLength(c) > 0);
+
+        // More channels than faces: one face each, the rest empty
+        REQUIRE(map.splitByFace(model, 16));
+        CHECK(map.stride() == 104);
+        CHECK(map.channelLength(11) == 104);
+        CHECK(map.channelLength(12) == 0);
+        CHECK(map.channelOf(Dodeca::LED_COUNT - 1) == 11);
+    }
+
+    TEST_CASE("face split balances uneven faces") {
+        FaceSizesModel model{100, 20, 20, 20, 60, 60, 10, 90, 30};
+        OutputMap map;
+        REQUIRE(map.splitByFace(model, 3));
+        // Best runs: 100+20+20 = 140 | 20+60+60 = 140 | 10+90+30 = 130
+        CHECK(longest(map) == 140);
+        CHECK(map.channelLength(2) == 130);
+        CHECK(map.channelOf(139) == 0);
+        CHECK(map.channelOf(140) == 1);
+
+        size_t total = 0;
+        for (size_t c = 0; c < 3; ++c) total += map.channelLength(c);
+        CHECK(total == model.pointCount());
+
+        // A face larger than an even share still goes whole
+        FaceSizesModel lopsided{500, 10, 10};
+        REQUIRE(map.splitByFace(lopsided, 2));
+        CHECK(map.channelLength(0) == 500);
+        CHECK(map.channelLength(1) == 20);
+    }
+
+    TEST_CASE("hand-wired faces permute the output") {
+        static CRGB leds[Dodeca::LED_COUNT];
+        ModelWrapper<Dodeca> model(std::make_unique<Model<Dodeca>>(leds));
+        uint8_t wiring[Dodeca::FACE_COUNT];
+        for (size_t f = 0; f < Dodeca::FACE_COUNT; ++f) wiring[f] = uint8_t(f % 3);
+
+        OutputMap map;
+        REQUIRE(map.assignFaces(model, wiring, 3));
+        CHECK(map.stride() == 4 * 104);
+        // Channel 1 runs through faces 1, 4, 7, 10
+        CHECK(map.source(1, 0) == 1 * 104);
+        CHECK(map.source(1, 104) == 4 * 104);
+        CHECK(map.source(1, 3 * 104 + 5) == 10 * 104 + 5);
+        for (size_t i = 0; i < Dodeca::LED_COUNT; ++i) {
+            CHECK(map.source(map.channelOf(i), map.positionOf(i)) == i);
+        }
+
+        std::vector<CRGB> in(Dodeca::LED_COUNT), out(map.bufferSize());
+        for (size_t i = 0; i < in.size(); ++i) in[i] = CRGB(uint8_t(i), uint8_t(i >> 8), 7);
+        map.gather(in.data(), out.data());
+        for (size_t i = 0; i < in.size(); ++i) CHECK(out[map.slot(i)] == in[i]);
+        CHECK(out[2 * map.stride() + 104] == in[5 * 104]);
+    }
+
+    TEST_CASE("bad layouts are rejected") {
+        OutputMap map;
+        CHECK_FALSE(map.splitEvenly(100, 0));
+        CHECK_FALSE(map.splitEvenly(100, OutputMap::MAX_CHANNELS + 1));
+        CHECK(map.channels() == 0);
+        CHECK(map.ledCount() == 0);
+        CHECK_FALSE(map.splitEvenly(Limits::ABSOLUTE_MAX_LEDS + 1, 4));
+        CHECK(map.splitEvenly(100, OutputMap::MAX_CHANNELS));
+
+        FaceSizesModel model{10, 10};
+        const uint8_t wiring[] = {0, 2};
+        CHECK_FALSE(map.assignFaces(model, wiring, 2));
+        CHECK(map.channels() == 0);
+    }
+
+    TEST_CASE("channel bytes in wire order") {
+        OutputMap map;
+        REQUIRE(map.splitEvenly(3, 2));
+        const CRGB leds[] = {CRGB(1, 2, 3), CRGB(4, 5, 6), CRGB(200, 100, 50)};
+        uint8_t bytes[6];
+
+        REQUIRE(map.channelBytes(0, leds, bytes) == 6);
+        CHECK(bytes[0] == 2);       // GRB
+        CHECK(bytes[1] == 1);
+        CHECK(bytes[2] == 3);
+        CHECK(bytes[5] == 6);
+
+        REQUIRE(map.channelBytes(1, leds, bytes, ColorOrder::BGR) == 3);
+        CHECK(bytes[0] == 50);
+        CHECK(bytes[2] == 200);
+
+        map.channelBytes(1, leds, bytes, ColorOrder::RGB, 128);
+        CHECK(bytes[0] == scale8(200, 128));
+        CHECK(bytes[1] == scale8(100, 128));
+    }
+}
+
+TEST_SUITE("NativePlatform output") {
+    TEST_CASE("a fake 4-channel driver sees each channel's strip") {
+        Theater theater;
+        theater.useNativePlatform<Dodeca>(Dodeca::LED_COUNT);
+        theater.addScene<IndexScene>();
+        REQUIRE(theater.model() != nullptr);
+
+        OutputMap map;
+        REQUIRE(map.splitByFace(*theater.model(), 4));
+        FakeDriver driver;
+        auto* platform = static_cast<NativePlatform*>(theater.platform());
+        platform->setOutput(&map, &driver);
+
+        theater.start();
+        theater.update();
+        REQUIRE(driver.frames == 1);
+        CHECK(driver.writes == 4);
+        REQUIRE(driver.channels.size() == 4);
+
+        // Faces 0-2 on channel 0, 3-5 on channel 1, ...: each channel's
+        // stream is its faces' LEDs in order, green first
+        std::vector<std::vector<uint8_t>> expected(4);
+        for (size_t i = 0; i < Dodeca::LED_COUNT; ++i) {
+            const size_t face = i / 104;
+            auto& stream = expected[face / 3];
+            stream.push_back(uint8_t(i >> 8));
+            stream.push_back(uint8_t(i));
+            stream.push_back(uint8_t(face));
+        }
+        for (size_t c = 0; c < 4; ++c) {
+            CAPTURE(c);
+            CHECK(driver.channels[c].size() == 312 * 3);
+            CHECK(driver.channels[c] == expected[c]);
+        }
+
+        // Brightness is applied on the way out, as FastLED does; the LED
+        // array keeps full values
+        platform->setBrightness(64);
+        theater.update();
+        CHECK(driver.frames == 2);
+        CHECK(driver.channels[3][1] == scale8(uint8_t(9 * 104), 64));
+        CHECK(platform->getLEDs()[9 * 104].r == uint8_t(9 * 104));
+
+        platform->setOutput(nullptr, nullptr);
+        theater.update();
+        CHECK(driver.frames == 2);
+    }
+
+    TEST_CASE("a tracked scene rewrites only the channels it changed") {
+        Theater theater;
+        theater.useNativePlatform<Dodeca>(Dodeca::LED_COUNT);
+        theater.addScene<FirstFaceScene>();
+        theater.addScene<IndexScene>();
+
+        OutputMap map;
+        REQUIRE(map.splitByFace(*theater.model(), 4));
+        FakeDriver driver;
+        auto* platform = static_cast<NativePlatform*>(theater.platform());
+        platform->setOutput(&map, &driver);
+        theater.start();
+
+        theater.update();
+        CHECK(driver.writes == 4); // First frame: everything
+        theater.update();
+        theater.update();
+        CHECK(driver.frames == 3);
+        CHECK(driver.writes == 6); // Then face 0's channel only
+
+        std::vector<uint8_t> expected(map.stride() * 3);
+        expected.resize(map.channelBytes(0, platform->getLEDs(), expected.data()));
+        CHECK(driver.channels[0] == expected);
+
+        // Brightness changes every byte
+        platform->setBrightness(128);
+        theater.update();
+        CHECK(driver.writes == 10);
+
+        // Untracked scenes write every channel, every frame
+        theater.nextScene();
+        CHECK(theater.dirtyTracker() == nullptr);
+        theater.update();
+        theater.update();
+        CHECK(driver.writes == 18);
+    }
+
+    TEST_CASE("dirty channels follow the tracker") {
+        CRGB buffer[Dodeca::LED_COUNT] = {};
+        LedBufferWrapper leds(buffer, Dodeca::LED_COUNT);
+        ModelWrapper<Dodeca> model(std::make_unique<Model<Dodeca>>(buffer));
+        OutputMap map;
+        REQUIRE(map.splitByFace(model, 4));
+        DirtyTracker tracker;
+        tracker.reset(Dodeca::LED_COUNT);
+        tracker.capture(leds);
+        CHECK(map.dirtyChannels(tracker) == 0b1111);
+
+        tracker.capture(leds);
+        CHECK(map.dirtyChannels(tracker) == 0);
+
+        buffer[0] = CRGB(1, 0, 0);          // Face 0: channel 0
+        buffer[11 * 104] = CRGB(1, 0, 0);   // Face 11: channel 3
+        tracker.capture(leds);
+        CHECK(map.dirtyChannels(tracker) == 0b1001);
+
+        DirtyTracker other;
+        other.reset(10);
+        CHECK(map.dirtyChannels(other) == OutputMap::ALL_CHANNELS);
+
+        // Masked gather leaves the other channels alone
+        std::vector<CRGB> out(map.bufferSize(), CRGB(9, 9, 9));
+        map.gather(buffer, out.data(), 0b0001);
+        CHECK(out[map.slot(0)] == CRGB(1, 0, 0));
+        CHECK(out[map.slot(11 * 104)] == CRGB(9, 9, 9));
+    }
+
+    TEST_CASE("benchmark: output mapping and transmit time by channel count") {
+        const auto blob = Testing::SyntheticModel::geodesicSphere(Limits::ABSOLUTE_MAX_LEDS);
+        RuntimeModel big;
+        REQUIRE(big.load(blob.data(), blob.size()));
+        static CRGB dodeca_leds[Dodeca::LED_COUNT];
+        ModelWrapper<Dodeca> dodeca(std::make_unique<Model<Dodeca>>(dodeca_leds));
+
+        // WS2812: 24 bits at 800 kHz per LED, plus a 300 us latch
+        auto transmitMs = [](size_t stride) { return (stride * 30.0 + 300.0) / 1000.0; };
+
+        for (const IModel* model : {static_cast<const IModel*>(&dodeca), static_cast<const IModel*>(&big)}) {
+            const size_t count = model->pointCount();
+            std::vector<CRGB> leds(count, CRGB(10, 20, 30));
+            std::string report = std::to_string(count) + " LEDs:";
+            for (size_t channels : {2, 4, 8, 16}) {
+                OutputMap map;
+                REQUIRE(map.splitByFace(*model, channels));
+                std::vector<CRGB> out(map.bufferSize());
+                std::vector<uint8_t> bytes(map.stride() * 3);
+
+                const int runs = 200;
+                auto start = std::chrono::high_resolution_clock::now();
+                for (int r = 0; r < runs; ++r) map.gather(leds.data(), out.data());
+                auto mid = std::chrono::high_resolution_clock::now();
+                for (int r = 0; r < runs; ++r) {
+                    for (size_t c = 0; c < channels; ++c) map.channelBytes(c, leds.data(), bytes.data());
+                }
+                auto end = std::chrono::high_resolution_clock::now();
+                const double gather_ns = std::chrono::duration<double, std::nano>(mid - start).count() / (runs * count);
+                const double bytes_ns = std::chrono::duration<double, std::nano>(end - mid).count() / (runs * count);
+
+                char line[160];
+                std::snprintf(line, sizeof(line),
+                              "\n  %2zu channels: longest %5zu LEDs, transmit %6.2f ms (%4.0f fps max); "
+                              "gather %.2f ns/LED, wire bytes %.2f ns/LED",
+                              channels, map.stride(), transmitMs(map.stride()), 1000.0 / transmitMs(map.stride()),
+                              gather_ns, bytes_ns);
+                report += line;
+                CHECK(map.stride() * channels >= count);
+            }
+            MESSAGE(report);
+        }
+    }
+}
@@ -0,0 +1,247 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/stream/frame_codec.h"
+#include "PixelTheater/stream/fd_byte_stream.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+using Frame = std::vector<CRGB>;
+using Bytes = std::vector<uint8_t>;
+
+bool sameFrame(const FrameDecoder& decoder, const Frame& expected) {
+    if (!decoder.hasFrame() || decoder.ledCount() != expected.size()) return false;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const CRGB& a = decoder.frame()[i];
+        if (a.r != expected[i].r || a.g != expected[i].g || a.b != expected[i].b) return false;
+    }
+    return true;
+}
+
+Bytes encoded(FrameEncoder& encoder, const Frame& frame, FrameEncoder::Mode mode = FrameEncoder::Mode::Auto) {
+    encoder.encode(frame.data(), frame.size(), mode);
+    return Bytes(encoder.data(), encoder.data() + encoder.size());
+}
+
+// A moving bright spot over a gradient: mostly static with a few changes per frame
+Frame animatedFrame(size_t count, int t) {
+    Frame f(count);
+    for (size_t i = 0; i < count; ++i) f[i] = CRGB(static_cast<uint8_t>(i / 8), 0, 0);
+    for (int k = 0; k < 5; ++k) f[(t * 3 + k) % count] = CRGB(255, 255, static_cast<uint8_t>(t));
+    return f;
+}
+
+} // namespace
+
+TEST_SUITE("FrameStream") {
+    TEST_CASE("crc16 is CCITT-FALSE") {
+        const char* check = "123456789";
+        CHECK(FrameStream::crc16(reinterpret_cast<const uint8_t*>(check), 9) == 0x29B1);
+    }
+
+    TEST_CASE("every mode round-trips in any chunking") {
+        const size_t count = 300;
+        for (auto mode : {FrameEncoder::Mode::Auto, FrameEncoder::Mode::Raw,
+                          FrameEncoder::Mode::Rle, FrameEncoder::Mode::Delta}) {
+            FrameEncoder encoder(count, 8);
+            FrameDecoder decoder(count);
+            std::mt19937 gen(5);
+            for (int t = 0; t < 40; ++t) {
+                Frame frame = animatedFrame(count, t);
+                if (t % 7 == 0) frame[gen() % count] = CRGB(1, 2, 3);
+                Bytes bytes = encoded(encoder, frame, mode);
+
+                // Chunk sizes from single bytes up to whole frames
+                size_t frames = 0;
+                for (size_t pos = 0; pos < bytes.size(); ) {
+                    size_t n = std::min<size_t>(bytes.size() - pos, 1 + gen() % (t % 3 == 0 ? 2 : 700));
+                    frames += decoder.feed(bytes.data() + pos, n);
+                    pos += n;
+                }
+                INFO("mode " << static_cast<int>(mode) << " frame " << t);
+                CHECK(frames == 1);
+                CHECK(sameFrame(decoder, frame));
+            }
+            CHECK(decoder.stats().frames == 40);
+            CHECK(decoder.stats().checksum_errors == 0);
+        }
+    }
+
+    TEST_CASE("auto mode picks compact encodings") {
+        const size_t count = 1248;
+        FrameEncoder encoder(count, 30);
+        const size_t raw = FrameStream::HEADER_SIZE + count * 3 + FrameStream::CRC_SIZE;
+
+        Frame solid(count, CRGB(10, 20, 30));
+        CHECK(encoded(encoder, solid).size() < 50);
+        CHECK(encoder.lastType() == FrameStream::FrameType::Rle);
+
+        solid[600] = CRGB(255, 0, 0);
+        CHECK(encoded(encoder, solid).size() == FrameStream::HEADER_SIZE + 4 + 3 + FrameStream::CRC_SIZE);
+        CHECK(encoder.lastType() == FrameStream::FrameType::Delta);
+
+        // Unchanged frame: empty delta
+        CHECK(encoded(encoder, solid).size() == FrameStream::HEADER_SIZE + FrameStream::CRC_SIZE);
+
+        // Noise: nothing beats raw
+        std::mt19937 gen(1);
+        Frame noise(count);
+        for (auto& c : noise) c = CRGB(gen() & 0xFF, gen() & 0xFF, gen() & 0xFF);
+        CHECK(encoded(encoder, noise).size() == raw);
+        CHECK(encoder.lastType() == FrameStream::FrameType::Raw);
+
+        // Count changes force a keyframe
+        CHECK(encoder.encode(noise.data(), 100) > 0);
+        CHECK(encoder.lastType() != FrameStream::FrameType::Delta);
+        CHECK(encoder.encode(noise.data(), count + 1) == 0);
+    }
+
+    TEST_CASE("keyframes are sent on schedule") {
+        const size_t count = 64;
+        FrameEncoder encoder(count, 4);
+        std::vector<FrameStream::FrameType> types;
+        for (int t = 0; t < 9; ++t) {
+            encoded(encoder, animatedFrame(count, t));
+            types.push_back(encoder.lastType());
+        }
+        using FrameStream::FrameType;
+        for (int t : {0, 4, 8}) CHECK(types[t] != FrameType::Delta);
+        for (int t : {1, 2, 3, 5, 6, 7}) CHECK(types[t] == FrameType::Delta);
+
+        encoder.forceKeyframe();
+        encoded(encoder, animatedFrame(count, 9));
+        CHECK(encoder.lastType() != FrameType::Delta);
+    }
+
+    TEST_CASE("corruption is rejected and the stream recovers") {
+        const size_t count = 200;
+        FrameEncoder encoder(count, 5);
+        FrameDecoder decoder(count);
+        std::vector<Frame> frames;
+        std::vector<Bytes> packets;
+        for (int t = 0; t < 11; ++t) {
+            frames.push_back(animatedFrame(count, t));
+            packets.push_back(encoded(encoder, frames.back()));
+        }
+
+        // Junk before the first frame, including a false magic
+        Bytes junk = {0x00, 'P', 0x13, 'P', 'T', 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+        CHECK(decoder.feed(junk.data(), junk.size()) == 0);
+        CHECK(decoder.stats().format_errors == 1);
+        CHECK(decoder.feed(packets[0].data(), packets[0].size()) == 1);
+        CHECK(sameFrame(decoder, frames[0]));
+        CHECK(decoder.feed(packets[1].data(), packets[1].size()) == 1);
+
+        // Frame 2 corrupted: rejected, frame 1 stays up
+        packets[2][FrameStream::HEADER_SIZE + 1] ^= 0x40;
+        CHECK(decoder.feed(packets[2].data(), packets[2].size()) == 0);
+        CHECK(decoder.stats().checksum_errors == 1);
+        CHECK(sameFrame(decoder, frames[1]));
+
+        // Deltas 3 and 4 have no base until keyframe 5
+        for (int t : {3, 4}) CHECK(decoder.feed(packets[t].data(), packets[t].size()) == 0);
+        CHECK(decoder.stats().missing_base == 2);
+        CHECK(decoder.feed(packets[5].data(), packets[5].size()) == 1);
+        CHECK(sameFrame(decoder, frames[5]));
+
+        // A truncated frame swallows the start of the next one: the next good
+        // frame after it is still found, and deltas resume on keyframe 10
+        Bytes stream(packets[6].begin(), packets[6].begin() + 20);
+        for (int t = 7; t <= 10; ++t) stream.insert(stream.end(), packets[t].begin(), packets[t].end());
+        decoder.feed(stream.data(), stream.size());
+        CHECK(sameFrame(decoder, frames[10]));
+        CHECK(decoder.sequence() == encoder.sequence());
+    }
+
+    TEST_CASE("oversized frames are refused") {
+        FrameEncoder encoder(500);
+        FrameDecoder decoder(100);
+        Frame frame = animatedFrame(500, 0);
+        Bytes big = encoded(encoder, frame, FrameEncoder::Mode::Raw);
+        CHECK(decoder.feed(big.data(), big.size()) == 0);
+        CHECK(decoder.stats().format_errors >= 1);
+        CHECK_FALSE(decoder.hasFrame());
+
+        Frame small = animatedFrame(100, 1);
+        Bytes ok = encoded(encoder, small);
+        CHECK(decoder.feed(ok.data(), ok.size()) == 1);
+        CHECK(sameFrame(decoder, small));
+    }
+
+    TEST_CASE("open() needs an existing path; create() makes the file") {
+        const char* path = "test_frame_codec_output.bin";
+        std::remove(path);
+        CHECK(FdByteStream::open(path) == nullptr);     // A mistyped device is an error...
+        CHECK(std::fopen(path, "rb") == nullptr);       // ...and leaves nothing behind
+
+        auto file = FdByteStream::create(path);
+        REQUIRE(file != nullptr);
+        const uint8_t bytes[] = {'P', 'T', 1};
+        CHECK(file->write(bytes, sizeof(bytes)) == sizeof(bytes));
+        file.reset();
+
+        auto existing = FdByteStream::open(path);
+        REQUIRE(existing != nullptr);
+        uint8_t back[4] = {};
+        CHECK(existing->read(back, sizeof(back)) == sizeof(bytes));
+        CHECK(back[2] == 1);
+        existing.reset();
+        std::remove(path);
+    }
+
+    TEST_CASE("benchmark: pipe loopback latency and throughput") {
+        const size_t count = 1248; // DodecaRGBv2
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+        FdByteStream writer(fds[1], true);
+        FdByteStream reader(fds[0], true);
+
+        const int total = 500;
+        std::vector<std::chrono::steady_clock::time_point> sent_at(total);
+        std::atomic<int> received{0};
+        double latency_sum = 0.0;
+        bool all_match = true;
+
+        std::vector<Frame> frames;
+        for (int t = 0; t < total; ++t) frames.push_back(animatedFrame(count, t));
+
+        std::thread consumer([&] {
+            FrameDecoder decoder(count);
+            uint8_t chunk[4096];
+            while (received.load() < total && reader.waitReadable(1000)) {
+                const size_t n = reader.read(chunk, sizeof(chunk));
+                const size_t got = decoder.feed(chunk, n);
+                if (got == 0) continue;
+                const int index = received.fetch_add(static_cast<int>(got)) + static_cast<int>(got) - 1;
+                latency_sum += std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - sent_at[index]).count() * got;
+                all_match = all_match && sameFrame(decoder, frames[index]);
+            }
+        });
+
+        FrameEncoder encoder(count);
+        size_t bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < total; ++t) {
+            encoder.encode(frames[t].data(), count);
+            sent_at[t] = std::chrono::steady_clock::now();
+            bytes += writer.write(encoder.data(), encoder.size());
+        }
+        consumer.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        CHECK(received.load() == total);
+        CHECK(all_match);
+        MESSAGE(total << " frames of " << count << " LEDs: " << bytes / total << " bytes/frame (raw "
+                << count * 3 << "), " << total / seconds << " fps, " << bytes / seconds / 1e6
+                << " MB/s, avg latency " << latency_sum / std::max(1, received.load()) << " us");
+    }
+}
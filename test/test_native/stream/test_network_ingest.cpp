@@ -0,0 +1,266 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/stream/network_ingest.h"
+#include "PixelTheater/stream/udp_transport.h"
+
+#include <chrono>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+constexpr size_t LEDS = 1248;       // DodecaRGBv2: 8 universes of 170
+constexpr size_t UNIVERSES = 8;
+
+using Frame = std::vector<CRGB>;
+using Packet = std::vector<uint8_t>;
+
+Frame testFrame(int t) {
+    Frame f(LEDS);
+    for (size_t i = 0; i < LEDS; ++i) f[i] = CRGB(static_cast<uint8_t>(i), static_cast<uint8_t>(t), static_cast<uint8_t>(i >> 8));
+    return f;
+}
+
+const uint8_t* slotsFor(const Frame& f, size_t universe) {
+    return reinterpret_cast<const uint8_t*>(f.data()) + universe * 170 * 3;
+}
+
+size_t slotCount(size_t universe) {
+    return std::min<size_t>(170, LEDS - universe * 170) * 3;
+}
+
+Packet artnet(const Frame& f, size_t universe, uint8_t seq = 0) {
+    Packet p(ArtNet::MAX_PACKET);
+    p.resize(ArtNet::buildDmx(p.data(), static_cast<uint16_t>(universe), seq, slotsFor(f, universe), slotCount(universe)));
+    return p;
+}
+
+Packet e131(const Frame& f, size_t universe, uint8_t seq, uint16_t sync = 0) {
+    Packet p(E131::MAX_PACKET);
+    p.resize(E131::buildData(p.data(), static_cast<uint16_t>(universe + 1), seq, sync, slotsFor(f, universe), slotCount(universe)));
+    return p;
+}
+
+bool sameFrame(const NetworkIngest& ingest, const Frame& expected) {
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const CRGB& a = ingest.frame()[i];
+        if (a.r != expected[i].r || a.g != expected[i].g || a.b != expected[i].b) return false;
+    }
+    return true;
+}
+
+NetworkIngest::Protocol feed(NetworkIngest& ingest, const Packet& p) {
+    return ingest.handlePacket(p.data(), p.size());
+}
+
+} // namespace
+
+TEST_SUITE("NetworkIngest") {
+    TEST_CASE("Art-Net universes assemble into one frame") {
+        NetworkIngest ingest(LEDS);
+        CHECK(ingest.universeCount() == UNIVERSES);
+        const Frame frame = testFrame(1);
+        for (size_t u = 0; u < UNIVERSES; ++u) {
+            CHECK(ingest.frameCount() == 0);
+            CHECK(feed(ingest, artnet(frame, u, 1)) == NetworkIngest::Protocol::ArtNet);
+        }
+        CHECK(ingest.frameCount() == 1);
+        CHECK(sameFrame(ingest, frame));
+
+        // Unmapped universes and non-DMX opcodes are recognised but ignored
+        CHECK(feed(ingest, artnet(frame, UNIVERSES, 2)) == NetworkIngest::Protocol::ArtNet);
+        Packet poll = artnet(frame, 0);
+        poll[9] = 0x20;                                 // OpPoll
+        CHECK(feed(ingest, poll) == NetworkIngest::Protocol::ArtNet);
+        CHECK(ingest.stats().ignored == 2);
+
+        // Length past the end of the packet
+        Packet truncated = artnet(frame, 0);
+        truncated.resize(100);
+        CHECK(feed(ingest, truncated) == NetworkIngest::Protocol::None);
+        CHECK(ingest.stats().malformed == 1);
+    }
+
+    TEST_CASE("a repeated universe completes a partial frame") {
+        NetworkIngest ingest(LEDS);
+        const Frame a = testFrame(1), b = testFrame(2);
+        for (size_t u = 0; u < UNIVERSES; ++u) feed(ingest, artnet(a, u));
+        CHECK(ingest.frameCount() == 1);
+
+        // Sender drops universe 5 of the next frame
+        for (size_t u = 0; u < UNIVERSES; ++u) {
+            if (u != 5) feed(ingest, artnet(b, u));
+        }
+        CHECK(ingest.frameCount() == 1);
+        feed(ingest, artnet(b, 0));                     // Next frame starts
+        CHECK(ingest.frameCount() == 2);
+        CHECK(ingest.frame()[0].g == 2);
+        CHECK(ingest.frame()[5 * 170].g == 1);          // Kept from the previous frame
+    }
+
+    TEST_CASE("ArtSync holds frames until the sync packet") {
+        NetworkIngest ingest(LEDS);
+        uint8_t sync[ArtNet::MAX_PACKET];
+        const size_t sync_len = ArtNet::buildSync(sync);
+        ingest.handlePacket(sync, sync_len);
+        CHECK(ingest.syncMode());
+
+        const Frame frame = testFrame(3);
+        for (size_t u = 0; u < UNIVERSES; ++u) feed(ingest, artnet(frame, u));
+        CHECK(ingest.frameCount() == 0);                // Complete but not synced yet
+        ingest.handlePacket(sync, sync_len);
+        CHECK(ingest.frameCount() == 1);
+        CHECK(sameFrame(ingest, frame));
+        ingest.handlePacket(sync, sync_len);            // Nothing new: no extra frame
+        CHECK(ingest.frameCount() == 1);
+
+        // Sender stops syncing: fall back to completing on the last universe
+        for (int f = 0; f < 9; ++f) {
+            for (size_t u = 0; u < UNIVERSES; ++u) feed(ingest, artnet(testFrame(10 + f), u));
+        }
+        CHECK_FALSE(ingest.syncMode());
+        CHECK(ingest.frameCount() >= 2);
+        CHECK(sameFrame(ingest, testFrame(18)));
+    }
+
+    TEST_CASE("E1.31 sequence, preview, sync address and start codes") {
+        NetworkIngest ingest(LEDS);
+        const Frame a = testFrame(1), b = testFrame(2);
+        for (size_t u = 0; u < UNIVERSES; ++u) CHECK(feed(ingest, e131(a, u, 10)) == NetworkIngest::Protocol::E131);
+        CHECK(ingest.frameCount() == 1);
+        CHECK(sameFrame(ingest, a));
+
+        // Late duplicate of universe 0 is dropped
+        feed(ingest, e131(b, 0, 9));
+        CHECK(ingest.stats().out_of_order == 1);
+
+        Packet preview = e131(b, 1, 11);
+        preview[112] = 0x80;
+        feed(ingest, preview);
+        Packet alt_start = e131(b, 1, 11);
+        alt_start[125] = 0xDD;
+        feed(ingest, alt_start);
+        CHECK(ingest.stats().ignored == 2);
+
+        // Synchronised: data names sync universe 7000, and only that sync shows the frame
+        for (size_t u = 0; u < UNIVERSES; ++u) feed(ingest, e131(b, u, 12, 7000));
+        CHECK(ingest.syncMode());
+        CHECK(ingest.frameCount() == 1);
+        uint8_t sync[E131::SYNC_PACKET];
+        ingest.handlePacket(sync, E131::buildSync(sync, 1, 6999));
+        CHECK(ingest.frameCount() == 1);
+        ingest.handlePacket(sync, E131::buildSync(sync, 2, 7000));
+        CHECK(ingest.frameCount() == 2);
+        CHECK(sameFrame(ingest, b));
+
+        Packet bad = e131(b, 0, 13);
+        bad[123] = 0x03;                                // Property count past the end
+        CHECK(feed(ingest, bad) == NetworkIngest::Protocol::None);
+        CHECK(ingest.stats().malformed == 1);
+    }
+
+    TEST_CASE("E1.31 sync recovers after a fallback") {
+        NetworkIngest ingest(LEDS);
+        uint8_t sync[E131::SYNC_PACKET];
+        uint8_t seq = 0;
+        auto sendFrame = [&](int t) {
+            ++seq;
+            for (size_t u = 0; u < UNIVERSES; ++u) feed(ingest, e131(testFrame(t), u, seq, 7000));
+        };
+
+        sendFrame(1);
+        ingest.handlePacket(sync, E131::buildSync(sync, seq, 7000));
+        CHECK(ingest.syncMode());
+        CHECK(ingest.frameCount() == 1);
+
+        // Sync packets stop: after eight frames' worth it completes on the last universe
+        for (int f = 0; f < 9; ++f) sendFrame(10 + f);
+        CHECK_FALSE(ingest.syncMode());
+        const uint32_t unsynced = ingest.frameCount();
+        sendFrame(20);
+        CHECK_FALSE(ingest.syncMode());
+        CHECK(ingest.frameCount() == unsynced + 1);
+        CHECK(sameFrame(ingest, testFrame(20)));
+
+        // Sync is back: the next data waits for it again
+        ingest.handlePacket(sync, E131::buildSync(sync, seq, 7000));
+        sendFrame(21);
+        CHECK(ingest.syncMode());
+        CHECK(ingest.frameCount() == unsynced + 1);
+        ingest.handlePacket(sync, E131::buildSync(sync, seq, 7000));
+        CHECK(ingest.frameCount() == unsynced + 2);
+        CHECK(sameFrame(ingest, testFrame(21)));
+    }
+
+    TEST_CASE("OPC messages are whole frames") {
+        NetworkIngest::Config config;
+        config.opc_channel = 2;
+        NetworkIngest ingest(LEDS, config);
+        const Frame frame = testFrame(4);
+        Packet p(Opc::HEADER_SIZE + LEDS * 3);
+        p.resize(Opc::buildSetPixels(p.data(), 2, frame.data(), LEDS));
+        CHECK(feed(ingest, p) == NetworkIngest::Protocol::Opc);
+        CHECK(ingest.frameCount() == 1);
+        CHECK(sameFrame(ingest, frame));
+
+        // Another channel is ignored; broadcast (0) is not
+        p[0] = 3;
+        feed(ingest, p);
+        CHECK(ingest.frameCount() == 1);
+        CHECK(ingest.stats().ignored == 1);
+
+        // Two short messages in one datagram
+        const Frame small = testFrame(5);
+        Packet two(2 * (Opc::HEADER_SIZE + 30));
+        size_t len = Opc::buildSetPixels(two.data(), 0, small.data(), 10);
+        Opc::buildSetPixels(two.data() + len, 0, small.data() + 10, 10);
+        CHECK(feed(ingest, two) == NetworkIngest::Protocol::Opc);
+        CHECK(ingest.frameCount() == 3);
+        CHECK(ingest.frame()[0].g == 5);
+        CHECK(ingest.frame()[20].g == 4);               // Past the short message: unchanged
+
+        Packet junk = {0, 0, 0xFF, 0xFF, 1, 2};
+        CHECK(feed(ingest, junk) == NetworkIngest::Protocol::None);
+    }
+
+    TEST_CASE("benchmark: UDP loopback latency and per-packet cost") {
+        UdpTransport rx, tx;
+        REQUIRE(rx.bind(0, "127.0.0.1"));
+        REQUIRE(tx.setRemote("127.0.0.1", rx.localPort()));
+        NetworkIngest ingest(LEDS);
+
+        const int frames = 200;
+        double latency_us = 0.0;
+        int received = 0;
+        for (int t = 0; t < frames; ++t) {
+            const Frame frame = testFrame(t);
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t u = 0; u < UNIVERSES; ++u) {
+                Packet p = e131(frame, u, static_cast<uint8_t>(t));
+                REQUIRE(tx.send(p.data(), p.size()) == p.size());
+            }
+            const uint32_t before = ingest.frameCount();
+            while (ingest.frameCount() == before && rx.waitReadable(500)) ingest.drain(rx);
+            if (ingest.frameCount() == before) break;
+            latency_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            received += sameFrame(ingest, frame) ? 1 : 0;
+        }
+        CHECK(received == frames);
+
+        // Parse cost alone, no socket
+        const Frame frame = testFrame(0);
+        std::vector<Packet> packets;
+        for (size_t u = 0; u < UNIVERSES; ++u) packets.push_back(artnet(frame, u));
+        const int rounds = 2000;
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            for (const auto& p : packets) ingest.handlePacket(p.data(), p.size());
+        }
+        const double per_packet_ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / (rounds * UNIVERSES);
+
+        MESSAGE("E1.31 over UDP loopback, " << LEDS << " LEDs in " << UNIVERSES << " universes: "
+                << latency_us / std::max(1, received) << " us send-to-frame; Art-Net parse "
+                << per_packet_ns << " ns/packet");
+    }
+}
@@ -0,0 +1,312 @@
+#include <doctest/doctest.h>
+#include "PixelTheater/stream/telemetry.h"
+#include "PixelTheater/scene.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+class TelemetryTestScene : public Scene {
+public:
+    void setup() override {
+        set_name("Telemetry Test");
+        param("speed", "range", 0.1f, 2.0f, 1.0f, "clamp", "Animation speed");
+        param("count", "count", 1, 10, 5, "clamp", "Item count");
+        param("enabled", "switch", true, "", "Enable feature");
+    }
+};
+
+// Runs the encoder like the firmware loop does: one frame and one next() per step
+struct Device {
+    TelemetryEncoder encoder;
+    uint32_t now = 0;
+    Bytes wire;
+
+    Device() { flush(); }     // Starts the encoder's clock at 0
+
+    void step(uint32_t frame_us, uint32_t ms = 10) {
+        now += ms;
+        encoder.recordFrame(frame_us);
+        if (encoder.statsDue(now)) {
+            encoder.setZone("frame_total", now / 10, now * 100, 8000, 12000);
+            encoder.setSystem(41.25f, 3500.0f, 15, 2);
+            encoder.setQuality(3, 4);
+        }
+        flush();
+    }
+
+    void flush() {
+        uint8_t packet[Telemetry::MAX_PACKET];
+        const size_t n = encoder.next(now, packet, sizeof(packet));
+        wire.insert(wire.end(), packet, packet + n);
+    }
+};
+
+std::vector<TelemetryDecoder::Packet> decodeAll(TelemetryDecoder& decoder, const Bytes& bytes, size_t chunk) {
+    std::vector<TelemetryDecoder::Packet> packets;
+    TelemetryDecoder::Packet packet;
+    for (size_t i = 0; i < bytes.size(); i += chunk) {
+        decoder.feed(bytes.data() + i, std::min(chunk, bytes.size() - i));
+        while (decoder.next(packet)) packets.push_back(packet);
+    }
+    return packets;
+}
+
+const TelemetryDecoder::Packet* lastOf(const std::vector<TelemetryDecoder::Packet>& packets, Telemetry::Type type) {
+    for (auto it = packets.rbegin(); it != packets.rend(); ++it) {
+        if (it->type == type) return &*it;
+    }
+    return nullptr;
+}
+
+double field(const TelemetryDecoder::Packet& packet, const std::string& key) {
+    for (const auto& f : packet.fields) {
+        if (f.key == key) return f.value;
+    }
+    return std::nan("");    // Fails any comparison
+
+}
+
+} // namespace
+
+TEST_SUITE("Telemetry") {
+    TEST_CASE("frame histogram, zones and system round-trip in any chunking") {
+        Device device;
+        // 90 frames at 9.5 ms, 10 at 25 ms over the first second
+        for (int i = 0; i < 100; ++i) device.step(i % 10 == 9 ? 25000 : 9500);
+        for (int i = 0; i < 20; ++i) device.step(9500);
+
+        for (size_t chunk : {size_t(1), size_t(7), device.wire.size()}) {
+            TelemetryDecoder decoder;
+            auto packets = decodeAll(decoder, device.wire, chunk);
+            CHECK(decoder.stats().checksum_errors == 0);
+            CHECK(decoder.stats().lost == 0);
+
+            const auto* frames = lastOf(packets, Telemetry::Type::Frames);
+            REQUIRE(frames);
+            CHECK(field(*frames, "frames") == 100);
+            CHECK(field(*frames, "fps") == doctest::Approx(100.0));
+            CHECK(field(*frames, "frame_us.min") == 9500);
+            CHECK(field(*frames, "frame_us.max") == 25000);
+            CHECK(field(*frames, "frame_us.avg") == doctest::Approx(11050.0));
+            CHECK(field(*frames, "frame_us.p50") == 10000);
+            CHECK(field(*frames, "frame_us.p99") == 26000);
+            CHECK(field(*frames, "hist.9000") == 90);
+            CHECK(field(*frames, "hist.25000") == 10);
+
+            const auto* zones = lastOf(packets, Telemetry::Type::Zones);
+            REQUIRE(zones);
+            CHECK(field(*zones, "zone.frame_total.calls") == 100);
+            CHECK(field(*zones, "zone.frame_total.avg_us") == 1000);
+            CHECK(field(*zones, "zone.frame_total.max_us") == 12000);
+
+            const auto* system = lastOf(packets, Telemetry::Type::System);
+            REQUIRE(system);
+            CHECK(field(*system, "cpu_temp_c") == doctest::Approx(41.25));
+            CHECK(field(*system, "power_w") == doctest::Approx(3.5));
+            CHECK(field(*system, "brightness") == 15);
+            CHECK(field(*system, "log_dropped") == 2);
+            CHECK(field(*system, "quality") == 3);
+            CHECK(field(*system, "quality_max") == 4);
+        }
+    }
+
+    TEST_CASE("scene and parameters are sent on change") {
+        TelemetryTestScene scene;
+        scene.setup();
+        Device device;
+        device.encoder.setScene(&scene, 3);
+        for (int i = 0; i < 10; ++i) device.step(10000);
+
+        TelemetryDecoder decoder;
+        auto packets = decodeAll(decoder, device.wire, 16);
+        const auto* info = lastOf(packets, Telemetry::Type::Scene);
+        REQUIRE(info);
+        CHECK(info->text == "Telemetry Test");
+        CHECK(field(*info, "scene.index") == 3);
+        CHECK(field(*info, "scene.params") == 3);
+        const auto* params = lastOf(packets, Telemetry::Type::Params);
+        REQUIRE(params);
+        CHECK(field(*params, "param.speed") == doctest::Approx(1.0));
+        CHECK(field(*params, "param.count") == 5);
+        CHECK(field(*params, "param.enabled") == 1);
+
+        // Unchanged values aren't sent again before the keyframe
+        device.wire.clear();
+        for (int i = 0; i < 50; ++i) device.step(10000);
+        packets = decodeAll(decoder, device.wire, 16);
+        CHECK_FALSE(lastOf(packets, Telemetry::Type::Params));
+
+        scene.settings["speed"] = 1.5f;
+        device.wire.clear();
+        for (int i = 0; i < 25; ++i) device.step(10000);
+        packets = decodeAll(decoder, device.wire, 16);
+        params = lastOf(packets, Telemetry::Type::Params);
+        REQUIRE(params);
+        CHECK(field(*params, "param.speed") == doctest::Approx(1.5));
+    }
+
+    TEST_CASE("scene status is sent when it changes and at keyframes") {
+        Device device;
+        device.encoder.setStatus("blobs: 12");
+        for (int i = 0; i < 10; ++i) device.step(10000);
+
+        TelemetryDecoder decoder;
+        auto packets = decodeAll(decoder, device.wire, 3);
+        const auto* status = lastOf(packets, Telemetry::Type::Status);
+        REQUIRE(status);
+        CHECK(status->text == "blobs: 12");
+
+        // Same text again: nothing new until the keyframe
+        device.wire.clear();
+        device.encoder.setStatus("blobs: 12");
+        for (int i = 0; i < 100; ++i) device.step(10000);
+        packets = decodeAll(decoder, device.wire, 3);
+        CHECK_FALSE(lastOf(packets, Telemetry::Type::Status));
+
+        device.wire.clear();
+        device.encoder.setStatus(std::string(300, 'x').c_str());
+        for (int i = 0; i < 10; ++i) device.step(10000);
+        packets = decodeAll(decoder, device.wire, 3);
+        status = lastOf(packets, Telemetry::Type::Status);
+        REQUIRE(status);
+        CHECK(status->text == std::string(Telemetry::MAX_STATUS, 'x'));
+
+        device.wire.clear();
+        for (int i = 0; i < 500; ++i) device.step(10000);   // Past the 5 s keyframe
+        packets = decodeAll(decoder, device.wire, 3);
+        CHECK(lastOf(packets, Telemetry::Type::Status));
+        CHECK(decoder.stats().checksum_errors == 0);
+    }
+
+    TEST_CASE("late decoder learns names at the next keyframe") {
+        TelemetryTestScene scene;
+        scene.setup();
+        Device device;
+        device.encoder.setScene(&scene, 0);
+        for (int i = 0; i < 200; ++i) device.step(10000);   // Names went out at the start
+
+        device.wire.clear();
+        for (int i = 0; i < 400; ++i) device.step(10000);   // Past the 5 s keyframe
+        TelemetryDecoder late;
+        auto packets = decodeAll(late, device.wire, 64);
+        REQUIRE(!packets.empty());
+
+        // Before the keyframe the zone only has its id
+        const auto* first = &packets.front();
+        for (const auto& p : packets) {
+            if (p.type == Telemetry::Type::Zones) {
+                first = &p;
+                break;
+            }
+        }
+        CHECK(field(*first, "zone.zone0.calls") > 0);
+
+        const auto* zones = lastOf(packets, Telemetry::Type::Zones);
+        REQUIRE(zones);
+        CHECK(field(*zones, "zone.frame_total.calls") > 0);
+        const auto* params = lastOf(packets, Telemetry::Type::Params);
+        REQUIRE(params);
+        CHECK(field(*params, "param.count") == 5);
+    }
+
+    TEST_CASE("text and corruption between packets are skipped") {
+        Device device;
+        for (int i = 0; i < 250; ++i) device.step(10000);
+
+        // Interleave log lines as the firmware does, and flip a byte in one packet
+        Bytes mixed;
+        const char* line = "[INFO] Pretty Print: scene switched\n";
+        size_t packets_in = 0;
+        TelemetryDecoder counter;
+        TelemetryDecoder::Packet packet;
+        size_t pos = 0;
+        counter.feed(device.wire.data(), device.wire.size());
+        while (counter.next(packet)) {
+            const size_t len = Telemetry::HEADER_SIZE + device.wire[pos + 9] + (device.wire[pos + 10] << 8) +
+                               Telemetry::CRC_SIZE;
+            mixed.insert(mixed.end(), line, line + std::strlen(line));
+            size_t start = mixed.size();
+            mixed.insert(mixed.end(), device.wire.begin() + pos, device.wire.begin() + pos + len);
+            if (packets_in == 2) mixed[start + Telemetry::HEADER_SIZE] ^= 0x40;
+            pos += len;
+            packets_in++;
+        }
+        REQUIRE(packets_in > 5);
+
+        TelemetryDecoder decoder;
+        auto packets = decodeAll(decoder, mixed, 5);
+        CHECK(packets.size() == packets_in - 1);
+        CHECK(decoder.stats().checksum_errors == 1);
+        CHECK(decoder.stats().lost == 1);
+        const std::string text = decoder.takeText();
+        CHECK(text.find("[INFO] Pretty Print: scene switched\n") == 0);
+        CHECK(decoder.takeText().empty());
+    }
+
+    TEST_CASE("cost and bandwidth compared with the text status") {
+        TelemetryTestScene scene;
+        scene.setup();
+        Device device;
+        device.encoder.setScene(&scene, 0);
+
+        constexpr int FRAMES = 6000;     // 60 s at 100 fps
+        using clock = std::chrono::high_resolution_clock;
+        double record_ns = 0;
+        double next_ns = 0;
+        uint8_t packet[Telemetry::MAX_PACKET];
+        size_t bytes = 0;
+        for (int i = 0; i < FRAMES; ++i) {
+            device.now += 10;
+            auto a = clock::now();
+            device.encoder.recordFrame(9000 + (i % 7) * 300);
+            auto b = clock::now();
+            if (device.encoder.statsDue(device.now)) {
+                for (int z = 0; z < 8; ++z) {
+                    char name[16];
+                    std::snprintf(name, sizeof(name), "zone_%d", z);
+                    device.encoder.setZone(name, i, i * 50, 40, 90);
+                }
+                device.encoder.setSystem(45.0f, 4200.0f, 15);
+            }
+            auto c = clock::now();
+            bytes += device.encoder.next(device.now, packet, sizeof(packet));
+            auto d = clock::now();
+            record_ns += std::chrono::duration<double, std::nano>(b - a).count();
+            next_ns += std::chrono::duration<double, std::nano>(d - c).count();
+        }
+
+        // The old status: scene line, status, power and an 8-zone benchmark table every 3 s
+        char text[2048];
+        int status = 0;
+        constexpr int REPORTS = 200;
+        auto e = clock::now();
+        for (int r = 0; r < REPORTS; ++r) {
+            status = std::snprintf(text, sizeof(text),
+                "--> mode:%d (%s) @ %d FPS <--\nStatus: %s\nEst Power: %0.1f W (%.1f%% brightness)\n",
+                0, "Telemetry Test", 100 + r % 3, "(empty)", 4.2, 5.9);
+            for (int z = 0; z < 8; ++z) {
+                status += std::snprintf(text + status, sizeof(text) - status,
+                    "zone_%d                  : avg %8.2f us  min %6u us  max %6u us  (%5.1f%%) x %u\n",
+                    z, 50.0 + r, 40u, 90u, 0.5, 6000u + r);
+            }
+        }
+        auto f = clock::now();
+        const double text_us = std::chrono::duration<double, std::micro>(f - e).count() / REPORTS;
+
+        MESSAGE("telemetry: " << bytes / 60.0 << " bytes and " << next_ns / 60 / 1000.0
+                << " us per 1 s report (histogram, 8 zones, system, scene); text status: " << status
+                << " bytes and " << text_us << " us to format per 3 s report; recordFrame "
+                << record_ns / FRAMES << " ns");
+        CHECK(bytes > 0);
+    }
+}
@@ -0,0 +1,246 @@
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "PixelTheater.h"
+#include "PixelTheater/core/neighbor_graph.h"
+#include "PixelTheater/core/pixel_kernels.h"
+#include "PixelTheater/core/post_process.h"
+#include "PixelTheater/core/sphere_hash.h"
+#include "synthetic_model.h"
+
+// Scene implementations are compiled in firmware_scenes.cpp
+#include "benchmark.h"
+#include "../../src/scenes/blobs/blob_scene.h"
+#include "../../src/scenes/boids/boids_scene.h"
+#include "../../src/scenes/geography/geography_scene.h"
+#include "../../src/scenes/orientation_grid/orientation_grid_scene.h"
+#include "../../src/scenes/satellites/SatellitesScene.h"
+#include "../../src/scenes/sparkles/sparkles_scene.h"
+#include "../../src/scenes/test_scene/test_scene.h"
+#include "../../src/scenes/texture_map/texture_map_scene.h"
+#include "../../src/scenes/wandering_particles/wandering_particles_scene.h"
+#include "../../src/scenes/xyz_scanner/xyz_scanner_scene.h"
+
+using namespace PixelTheater;
+using namespace PixelTheater::Testing;
+
+namespace {
+
+const size_t SIZES[] = {500, 1248, 2500, 5000, Limits::ABSOLUTE_MAX_LEDS};
+constexpr int WARMUP_FRAMES = 3;
+constexpr int TIMED_FRAMES = 20;
+
+struct Shape {
+    const char* name;
+    std::vector<uint8_t> (*make)(size_t leds);
+};
+std::vector<uint8_t> sphere(size_t leds) { return SyntheticModel::geodesicSphere(leds); }
+std::vector<uint8_t> dodecas(size_t leds) { return SyntheticModel::dodecahedronArray(leds); }
+const Shape SHAPES[] = {{"geodesic sphere", sphere}, {"dodecahedron array", dodecas}};
+
+std::unique_ptr<RuntimeModel> loadModel(const std::vector<uint8_t>& blob) {
+    auto model = std::make_unique<RuntimeModel>();
+    REQUIRE(model->load(blob.data(), blob.size()));
+    return model;
+}
+
+double usSince(std::chrono::high_resolution_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// One row of the report: per-frame time and time per LED at each size
+struct Row {
+    std::string name;
+    std::vector<double> us;
+    std::vector<size_t> leds;
+
+    std::string format() const {
+        std::string line = name;
+        line.resize(22, ' ');
+        char cell[48];
+        for (size_t i = 0; i < us.size(); ++i) {
+            std::snprintf(cell, sizeof(cell), " %8.1f us %5.1f ns/LED |", us[i], us[i] * 1000.0 / leds[i]);
+            line += cell;
+        }
+        return line;
+    }
+};
+
+// Lights every LED through the model's faces rather than leds[]
+class FaceFillScene : public Scene {
+public:
+    void setup() override {}
+    void tick() override {
+        Scene::tick();
+        for (size_t f = 0; f < model().faceCount(); ++f) {
+            const Face& face = model().face(f);
+            for (size_t j = 0; j < face.led_count(); ++j) face.leds[j] = CRGB(1, 2, 3);
+        }
+    }
+};
+
+template <typename SceneType>
+double sceneFrameUs(const std::vector<uint8_t>& blob) {
+    Theater theater;
+    theater.useNativePlatform(loadModel(blob));
+    theater.addScene<SceneType>();
+    theater.start();
+    for (int i = 0; i < WARMUP_FRAMES; ++i) theater.update();
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < TIMED_FRAMES; ++i) theater.update();
+    return usSince(start) / TIMED_FRAMES;
+}
+
+template <typename SceneType>
+void addSceneRow(std::vector<Row>& rows, const char* name, const std::vector<std::vector<uint8_t>>& blobs,
+                 const std::vector<size_t>& leds) {
+    Row row{name, {}, leds};
+    for (const auto& blob : blobs) row.us.push_back(sceneFrameUs<SceneType>(blob));
+    rows.push_back(row);
+}
+
+template <typename Fn>
+double kernelUs(int runs, Fn&& fn) {
+    fn();
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < runs; ++i) fn();
+    return usSince(start) / runs;
+}
+
+} // namespace
+
+TEST_SUITE("Scaling") {
+    TEST_CASE("synthetic models hold together up to ABSOLUTE_MAX_LEDS") {
+        for (const auto& shape : SHAPES) {
+            for (size_t target : SIZES) {
+                CAPTURE(shape.name);
+                CAPTURE(target);
+                const auto blob = shape.make(target);
+                const auto model = loadModel(blob);
+                const size_t count = model->pointCount();
+                CHECK(count <= target);
+                CHECK(count > target * 9 / 10);
+                CHECK(count <= Limits::ABSOLUTE_MAX_LEDS);
+                CHECK(model->faceCount() <= Limits::ABSOLUTE_MAX_FACES);
+
+                // Indices, face ranges and neighbour ids must not wrap
+                size_t next_offset = 0;
+                for (size_t f = 0; f < model->faceCount(); ++f) {
+                    const Face& face = model->face(f);
+                    CHECK(face.id() == f);
+                    CHECK(face.led_offset() == next_offset);
+                    CHECK(face.led_count() <= Limits::MAX_LEDS_PER_FACE);
+                    next_offset += face.led_count();
+                }
+                CHECK(next_offset == count);
+
+                size_t bad = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    const Point& p = model->point(i);
+                    const Face& face = model->face(p.face_id());
+                    if (p.id() != i || i < face.led_offset() || i >= face.led_offset() + face.led_count()) ++bad;
+                    const auto& neighbors = p.getNeighbors();
+                    if (neighbors[0].id == i || neighbors[0].id >= count) ++bad;
+                    for (const auto& n : neighbors) {
+                        if (n.id != 0xFFFF && (n.id >= count || n.distance <= 0.0f)) ++bad;
+                    }
+                }
+                CHECK(bad == 0);
+            }
+        }
+    }
+
+    TEST_CASE("faces reach every LED of a 10,000 LED model") {
+        for (const auto& shape : SHAPES) {
+            CAPTURE(shape.name);
+            Theater theater;
+            theater.useNativePlatform(loadModel(shape.make(Limits::ABSOLUTE_MAX_LEDS)));
+            theater.addScene<FaceFillScene>();
+            theater.start();
+            theater.update();
+
+            // Nothing stopped short at a 16-bit, per-face or face count limit
+            const CRGB* leds = theater.platform()->getLEDs();
+            const size_t count = theater.platform()->getNumLEDs();
+            CHECK(count > Limits::ABSOLUTE_MAX_LEDS * 9 / 10);
+            size_t unlit = 0;
+            for (size_t i = 0; i < count; ++i) unlit += leds[i] != CRGB(1, 2, 3);
+            CHECK(unlit == 0);
+        }
+    }
+
+    TEST_CASE("benchmark: scenes and kernels across LED counts") {
+        Benchmark::enabled = false;     // Scenes' own BENCHMARK_START timers
+        for (const auto& shape : SHAPES) {
+            std::vector<std::vector<uint8_t>> blobs;
+            std::vector<size_t> leds;
+            for (size_t target : SIZES) {
+                blobs.push_back(shape.make(target));
+                leds.push_back(loadModel(blobs.back())->pointCount());
+            }
+
+            std::vector<Row> rows;
+            addSceneRow<Scenes::BlobScene>(rows, "blobs", blobs, leds);
+            addSceneRow<Scenes::BoidsScene>(rows, "boids", blobs, leds);
+            addSceneRow<Scenes::GeographyScene>(rows, "geography", blobs, leds);
+            addSceneRow<Scenes::OrientationGridScene>(rows, "orientation grid", blobs, leds);
+            addSceneRow<Scenes::SatellitesScene>(rows, "satellites", blobs, leds);
+            addSceneRow<Scenes::SparklesScene>(rows, "sparkles", blobs, leds);
+            addSceneRow<Scenes::TestScene>(rows, "test scene", blobs, leds);
+            addSceneRow<Scenes::TextureMapScene>(rows, "texture map", blobs, leds);
+            addSceneRow<Scenes::WanderingParticlesScene>(rows, "wandering particles", blobs, leds);
+            addSceneRow<Scenes::XYZScannerScene>(rows, "xyz scanner", blobs, leds);
+
+            Row load{"model load", {}, leds}, graph{"neighbor graph build", {}, leds};
+            Row average{"neighbor average", {}, leds}, blur{"post blur + bloom", {}, leds};
+            Row hash{"sphere hash + queries", {}, leds}, fade{"scale (fade)", {}, leds};
+            for (size_t s = 0; s < blobs.size(); ++s) {
+                const auto model = loadModel(blobs[s]);
+                const size_t count = model->pointCount();
+                std::vector<CRGB> pixels(count, CRGB(200, 100, 50));
+                std::vector<CRGB> scratch(count);
+
+                load.us.push_back(kernelUs(5, [&] { RuntimeModel m; m.load(blobs[s].data(), blobs[s].size()); }));
+
+                NeighborGraph neighbor_graph;
+                graph.us.push_back(kernelUs(5, [&] { neighbor_graph.build(*model, count); }));
+                average.us.push_back(kernelUs(20, [&] {
+                    neighbor_graph.average(reinterpret_cast<const uint8_t*>(pixels.data()),
+                                           reinterpret_cast<uint8_t*>(scratch.data()));
+                }));
+
+                PostProcess post(*model, count);
+                post.addBlur(0.5f);
+                post.addBloom(180, 0.5f);
+                blur.us.push_back(kernelUs(20, [&] { post.apply(pixels.data(), count, 1.0f / 60.0f); }));
+
+                SphereHash<> sphere_hash;
+                sphere_hash.indexModel(*model);
+                size_t visited = 0;
+                hash.us.push_back(kernelUs(5, [&] {
+                    sphere_hash.indexModel(*model);
+                    for (int q = 0; q < 32; ++q) {
+                        const Point& p = model->point(q * count / 32);
+                        sphere_hash.query(p.x(), p.y(), p.z(), 0.2f, [&](uint16_t, float) { ++visited; });
+                    }
+                }));
+                CHECK(visited > 0);
+
+                fade.us.push_back(kernelUs(50, [&] {
+                    PixelKernels::scale(reinterpret_cast<uint8_t*>(pixels.data()), count * 3, 250);
+                }));
+            }
+            for (const Row& row : {load, graph, average, blur, hash, fade}) rows.push_back(row);
+
+            std::string report = std::string(shape.name) + ", LEDs:";
+            for (size_t n : leds) report += " " + std::to_string(n);
+            for (const Row& row : rows) report += "\n  " + row.format();
+            MESSAGE(report);
+        }
+    }
+}
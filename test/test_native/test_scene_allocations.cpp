@@ -0,0 +1,116 @@
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "PixelTheater.h"
+#include "models/DodecaRGBv2/model.h"
+
+// Scene implementations are compiled in firmware_scenes.cpp
+#include "benchmark.h"
+#include "../../src/scenes/blobs/blob_scene.h"
+#include "../../src/scenes/boids/boids_scene.h"
+#include "../../src/scenes/geography/geography_scene.h"
+#include "../../src/scenes/orientation_grid/orientation_grid_scene.h"
+#include "../../src/scenes/satellites/SatellitesScene.h"
+#include "../../src/scenes/sparkles/sparkles_scene.h"
+#include "../../src/scenes/texture_map/texture_map_scene.h"
+#include "../../src/scenes/wandering_particles/wandering_particles_scene.h"
+#include "../../src/scenes/xyz_scanner/xyz_scanner_scene.h"
+
+using namespace PixelTheater;
+
+// Counts heap allocations while armed. Every form of the global operator
+// new and delete is replaced, all on malloc()/free(), so nothing this
+// binary frees came from the default allocator. It must stay the only
+// replacement.
+namespace {
+    std::atomic<bool> g_counting{false};
+    std::atomic<size_t> g_allocations{0};
+
+    void* allocate(size_t size, size_t alignment = 0) noexcept {
+        if (g_counting.load(std::memory_order_relaxed)) g_allocations.fetch_add(1, std::memory_order_relaxed);
+        if (size == 0) size = 1;
+        if (alignment <= alignof(std::max_align_t)) return std::malloc(size);
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    void* allocateOrThrow(size_t size, size_t alignment = 0) {
+        if (void* p = allocate(size, alignment)) return p;
+        throw std::bad_alloc();
+    }
+
+    // The one place memory goes back. Kept out of line so GCC doesn't see
+    // free() inlined against operator new and report -Wmismatched-new-delete.
+    [[gnu::noinline]] void deallocate(void* p) noexcept { std::free(p); }
+}
+
+void* operator new(size_t size) { return allocateOrThrow(size); }
+void* operator new[](size_t size) { return allocateOrThrow(size); }
+void* operator new(size_t size, std::align_val_t al) { return allocateOrThrow(size, size_t(al)); }
+void* operator new[](size_t size, std::align_val_t al) { return allocateOrThrow(size, size_t(al)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return allocate(size, size_t(al)); }
+void* operator new[](size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return allocate(size, size_t(al)); }
+
+void operator delete(void* p) noexcept { deallocate(p); }
+void operator delete[](void* p) noexcept { deallocate(p); }
+void operator delete(void* p, size_t) noexcept { deallocate(p); }
+void operator delete[](void* p, size_t) noexcept { deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(p); }
+
+namespace {
+
+constexpr int WARMUP_FRAMES = 5;    // Lazily sized scratch may grow once
+constexpr int COUNTED_FRAMES = 300;
+
+template <typename SceneType>
+size_t allocationsPerRun() {
+    Theater theater;
+    theater.useNativePlatform<Models::DodecaRGBv2>(Models::DodecaRGBv2::LED_COUNT);
+    theater.addScene<SceneType>();
+    theater.start();
+    for (int i = 0; i < WARMUP_FRAMES; ++i) theater.update();
+
+    g_allocations = 0;
+    g_counting = true;
+    for (int i = 0; i < COUNTED_FRAMES; ++i) theater.update();
+    g_counting = false;
+    return g_allocations;
+}
+
+} // namespace
+
+TEST_SUITE("Scene allocations") {
+    TEST_CASE("counter sees allocations") {
+        g_allocations = 0;
+        g_counting = true;
+        int* p = new int(1);
+        g_counting = false;
+        delete p;
+        CHECK(g_allocations == 1);
+    }
+
+    TEST_CASE("scenes do not allocate in tick()") {
+        Benchmark::enabled = false;
+        CHECK(allocationsPerRun<Scenes::BlobScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::BoidsScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::GeographyScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::OrientationGridScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::SatellitesScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::SparklesScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::TextureMapScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::WanderingParticlesScene>() == 0);
+        CHECK(allocationsPerRun<Scenes::XYZScannerScene>() == 0);
+    }
+}
@@ -0,0 +1,74 @@
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "PixelTheater.h"
+
+// Scene implementations are compiled in firmware_scenes.cpp
+#include "../../src/scenes/texture_map/texture_map_scene.h"
+
+using namespace PixelTheater;
+using Scenes::TextureMapScene;
+
+namespace {
+
+// Every texel names itself: red = column, green = row
+std::vector<uint8_t> coordinateTexels(uint32_t width, uint32_t height) {
+    std::vector<uint8_t> data;
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            data.push_back(uint8_t(x));
+            data.push_back(uint8_t(y));
+            data.push_back(7);
+        }
+    }
+    return data;
+}
+
+struct Lookup {
+    float x, y, z;
+    uint8_t column, row;
+};
+
+// Directions aim at texel centres, so nearest and bilinear agree exactly
+void checkLookups(const TextureData& tex, const Lookup* lookups, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const Lookup& l = lookups[i];
+        CAPTURE(i);
+        for (bool bilinear : {false, true}) {
+            CAPTURE(bilinear);
+            CHECK(TextureMapScene::sampleDirection(&tex, l.x, l.y, l.z, bilinear) == CRGB(l.column, l.row, 7));
+        }
+    }
+}
+
+} // namespace
+
+TEST_SUITE("TextureMapScene") {
+    TEST_CASE("cube map directions land on their face's texels") {
+        // 4x4 faces in a 3x2 atlas: +X -X +Y / -Y +Z -Z
+        const auto data = coordinateTexels(12, 8);
+        const TextureData tex{12, 8, data.data(), TextureLayout::CubeMap};
+        const Lookup lookups[] = {
+            {1.0f, 0.75f, 0.75f, 0, 0},       // +X, top left
+            {-1.0f, -0.75f, 0.75f, 7, 3},     // -X, bottom right
+            {0.25f, 1.0f, -0.25f, 10, 1},     // +Y
+            {0.75f, -1.0f, 0.75f, 3, 4},      // -Y
+            {-0.25f, -0.25f, 1.0f, 5, 6},     // +Z
+            {0.75f, 0.25f, -1.0f, 8, 5},      // -Z
+        };
+        checkLookups(tex, lookups, sizeof(lookups) / sizeof(lookups[0]));
+    }
+
+    TEST_CASE("octahedral directions land on the unfolded square") {
+        const auto data = coordinateTexels(8, 8);
+        const TextureData tex{8, 8, data.data(), TextureLayout::Octahedral};
+        const Lookup lookups[] = {
+            {0.125f, 0.125f, 0.75f, 4, 4},    // Near +Z: the centre
+            {0.625f, -0.125f, 0.25f, 6, 3},   // Upper hemisphere, towards +X
+            {0.125f, 0.125f, -0.75f, 7, 7},   // Near -Z: folded out to a corner
+            {-0.375f, 0.125f, -0.5f, 0, 6},   // Lower hemisphere, folded past -X
+        };
+        checkLookups(tex, lookups, sizeof(lookups) / sizeof(lookups[0]));
+    }
+}
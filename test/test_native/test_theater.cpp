@@ -35,6 +35,17 @@ public:
     void reset() override { Scene::reset(); reset_calls++; }
 };
 
+// Scene that keeps its state across switches
+class RetainedTestScene : public Scene {
+public:
+    int setup_calls = 0;
+    int resume_calls = 0;
+
+    RetainedTestScene() { set_name("Retained"); }
+    void setup() override { setup_calls++; set_retain_state(true); }
+    void resume() override { resume_calls++; }
+};
+
 // Another minimal scene for switching tests
 class AnotherMinimalTestScene : public Scene {
 public:
@@ -43,6 +54,31 @@ public:
     void tick() override { Scene::tick(); }
 };
 
+// Scene list scenes that count how many of them are alive
+template <int Id>
+class CountedTestScene : public Scene {
+public:
+    static int alive;
+    static int constructed;
+    int setup_calls = 0;
+    int resume_calls = 0;
+    bool retain = false;
+
+    CountedTestScene() { alive++; constructed++; }
+    ~CountedTestScene() override { alive--; }
+    void setup() override { setup_calls++; set_name("Counted"); set_retain_state(retain); }
+    void resume() override { resume_calls++; }
+    void tick() override { Scene::tick(); }
+};
+template <int Id> int CountedTestScene<Id>::alive = 0;
+template <int Id> int CountedTestScene<Id>::constructed = 0;
+
+// Larger than the others, to check the slot is sized for the biggest
+class LargeCountedScene : public CountedTestScene<2> {
+public:
+    uint8_t payload[256] = {};
+};
+
 // --- Restore TheaterTester --- 
 class TheaterTester : public Theater {
 public:
@@ -230,18 +266,149 @@ TEST_SUITE("Theater") {
         CHECK(scene0_ptr->reset_calls == 2); // Reset called again
     }
 
+    TEST_CASE_FIXTURE(TheaterSceneFixture, "Scene Management - retained state and prewarm") {
+        theater.addScene<MinimalTestScene>();   // Scene 0
+        theater.addScene<RetainedTestScene>();  // Scene 1
+        theater.addScene<MinimalTestScene>();   // Scene 2
+        auto* scene0 = dynamic_cast<MinimalTestScene*>(&theater.scene(0));
+        auto* retained = dynamic_cast<RetainedTestScene*>(&theater.scene(1));
+        auto* scene2 = dynamic_cast<MinimalTestScene*>(&theater.scene(2));
+        REQUIRE(retained != nullptr);
+
+        theater.start();
+        CHECK(theater.switchStats().count == 0);
+
+        // First visit sets up; the tick count carries over later visits
+        theater.nextScene();
+        CHECK(retained->setup_calls == 1);
+        theater.update();
+        theater.update();
+        theater.nextScene();
+        theater.nextScene();
+        theater.nextScene();
+        CHECK(theater.currentScene() == retained);
+        CHECK(retained->setup_calls == 1);
+        CHECK(retained->resume_calls == 1);
+        CHECK(retained->tick_count() == 2);
+
+        // Prewarming runs setup ahead of the switch, once
+        CHECK(theater.prewarmNext());
+        CHECK(scene2->setup_calls == 2);
+        CHECK_FALSE(theater.prewarmNext());
+        CHECK_FALSE(theater.prewarm(1));        // Current scene
+        theater.nextScene();
+        CHECK(scene2->setup_calls == 2);        // Not again at the switch
+        CHECK(scene2->reset_calls == 2);
+
+        // Non-retained scenes start over on their next visit
+        theater.nextScene();
+        const int scene0_setups = scene0->setup_calls;
+        theater.previousScene();
+        CHECK(scene2->setup_calls == 3);
+
+        // Re-selecting the current scene restarts even a retained one
+        theater.setScene(1);
+        theater.setScene(1);
+        CHECK(retained->setup_calls == 2);
+        CHECK(scene0->setup_calls == scene0_setups);
+
+        CHECK(theater.switchStats().count == 9);
+        CHECK(theater.switchStats().max_us >= theater.switchStats().last_us);
+    }
+
+    TEST_CASE_FIXTURE(TheaterSceneFixture, "Scene Management - scene list") {
+        using A = CountedTestScene<0>;
+        using B = CountedTestScene<1>;
+        using List = SceneList<A, B, LargeCountedScene>;
+        static_assert(List::count == 3, "three scenes");
+        static_assert(List::slot_size >= sizeof(LargeCountedScene), "slot fits the largest scene");
+        A::constructed = B::constructed = LargeCountedScene::constructed = 0;
+
+        {
+            TheaterTester lazy;
+            lazy.useNativePlatform<BasicPentagonModel>(led_count);
+            lazy.useSceneList<List>();
+            CHECK(lazy.sceneCount() == 3);
+            CHECK(lazy.sceneStorageBytes() == List::slot_size);
+            CHECK(A::constructed == 0);              // Nothing built up front
+            CHECK_FALSE(lazy.isResident(0));
+            CHECK(lazy.scene(0).name() == "DummyScene");
+
+            lazy.start();
+            CHECK(A::alive == 1);
+            CHECK(lazy.currentSceneIndex() == 0);
+            lazy.update();
+
+            // One slot: the outgoing scene is destroyed before the next is built
+            lazy.nextScene();
+            CHECK(A::alive == 0);
+            CHECK(B::alive == 1);
+            CHECK(lazy.currentSceneIndex() == 1);
+            CHECK_FALSE(lazy.prewarmNext());         // No spare slot
+
+            lazy.nextScene();
+            CHECK(LargeCountedScene::alive == 1);
+            CHECK(B::alive == 0);
+            lazy.update();
+            lazy.setScene(0);
+            CHECK(A::alive == 1);
+            CHECK(A::constructed == 2);              // Rebuilt from scratch
+            CHECK(lazy.switchStats().count == 3);
+        }
+        CHECK(A::alive == 0);                        // Destroyed with the Theater
+
+        {
+            // Two slots: prewarm builds the next scene beside the current one
+            TheaterTester lazy;
+            lazy.useNativePlatform<BasicPentagonModel>(led_count);
+            lazy.useSceneList<List, 2>();
+            lazy.start();
+            CHECK(lazy.prewarmNext());
+            CHECK(B::alive == 1);
+            auto* b = dynamic_cast<B*>(&lazy.scene(1));
+            REQUIRE(b != nullptr);
+            CHECK(b->setup_calls == 1);
+            lazy.nextScene();
+            CHECK(lazy.currentScene() == b);
+            CHECK(b->setup_calls == 1);
+            CHECK(A::alive == 1);                    // Still resident, until its slot is needed
+
+            // A retained scene resumes while resident
+            b->retain = true;
+            lazy.setScene(1);                        // Restart so setup() picks up retain
+            lazy.nextScene();                        // Evicts A, the least recently used
+            CHECK(A::alive == 0);
+            CHECK(LargeCountedScene::alive == 1);
+            lazy.previousScene();
+            CHECK(b->resume_calls == 1);
+            CHECK(b->setup_calls == 2);
+        }
+        CHECK(B::alive == 0);
+        CHECK(LargeCountedScene::alive == 0);
+
+        // Mixed with addScene(): indices continue in registration order
+        theater.addScene<MinimalTestScene>();
+        theater.useSceneList<SceneList<A>>();
+        CHECK(theater.sceneCount() == 2);
+        theater.start();
+        CHECK(theater.currentSceneIndex() == 0);
+        theater.nextScene();
+        CHECK(theater.currentSceneIndex() == 1);
+        CHECK(A::alive == 1);
+    }
+
     TEST_CASE_FIXTURE(TheaterSceneFixture, "Scene Accessors") {
         CHECK(theater.sceneCount() == 0);
         CHECK(theater.currentScene() == nullptr);
-        CHECK(theater.scenes().empty());
+        CHECK(theater.currentSceneIndex() == 0);
         CHECK(theater.scene(0).name() == "DummyScene"); // Check name of returned dummy
 
         theater.addScene<MinimalTestScene>();
         theater.addScene<AnotherMinimalTestScene>();
 
         CHECK(theater.sceneCount() == 2);
-        CHECK_FALSE(theater.scenes().empty());
-        CHECK(theater.scenes().size() == 2);
+        CHECK(theater.currentSceneIndex() == 0);
+        CHECK(theater.isResident(1));
         
         CHECK(theater.currentScene() == &theater.scene(0)); // Current defaults to first
         const TheaterTester& const_theater = theater;
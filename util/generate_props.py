@@ -4,9 +4,25 @@ import json
 import argparse
 from pathlib import Path
 from PIL import Image
+import math
 import datetime # Added for timestamp
 
-__script_version__ = "1.1.0" # Simple version tracking
+__script_version__ = "1.2.0" # Simple version tracking
+
+# Sphere texture layouts. Values match PixelTheater::TextureLayout in the generated header.
+#  - equirect:   longitude/latitude grid (source images are expected in this layout)
+#  - cubemap:    6 square faces (+X,-X,+Y,-Y,+Z,-Z) in a 3x2 atlas, OpenGL face orientation
+#  - octahedral: one square, sphere projected onto an octahedron and unfolded
+TEXTURE_LAYOUTS = {
+    'equirect': 'Equirectangular',
+    'cubemap': 'CubeMap',
+    'octahedral': 'Octahedral',
+}
+DEFAULT_LAYOUT_SIZE = {
+    'cubemap': 32,     # Face size: 6x32x32 texels, >=250 texels/sr everywhere
+    'octahedral': 96,  # Side length: 96x96 texels, >=440 texels/sr everywhere
+}
+LAYOUT_SUFFIX = {'equirect': '', 'cubemap': '_CUBE', 'octahedral': '_OCTA'}
 
 def validate_palette(data):
     """Validate palette data structure and format"""
@@ -101,7 +117,105 @@ def process_palettes(palette_dir):
     
     return output
 
-def generate_image_code(name, image_path, max_width, max_height):
+def _normalize(v):
+    length = math.sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2])
+    return (v[0] / length, v[1] / length, v[2] / length)
+
+def cubemap_direction(face, s, t):
+    """Unit direction for face-local (s, t) in [0, 1] on cube face 0-5 (+X,-X,+Y,-Y,+Z,-Z)"""
+    sc, tc = 2.0 * s - 1.0, 2.0 * t - 1.0
+    return _normalize([
+        (1.0, -tc, -sc), (-1.0, -tc, sc),
+        (sc, 1.0, tc), (sc, -1.0, -tc),
+        (sc, -tc, 1.0), (-sc, -tc, -1.0),
+    ][face])
+
+def cubemap_face_uv(x, y, z):
+    """Inverse of cubemap_direction: returns (face, s, t)"""
+    ax, ay, az = abs(x), abs(y), abs(z)
+    if ax >= ay and ax >= az:
+        face, ma, sc, tc = (0, ax, -z, -y) if x > 0 else (1, ax, z, -y)
+    elif ay >= az:
+        face, ma, sc, tc = (2, ay, x, z) if y > 0 else (3, ay, x, -z)
+    else:
+        face, ma, sc, tc = (4, az, x, -y) if z > 0 else (5, az, -x, -y)
+    return face, (sc / ma + 1.0) * 0.5, (tc / ma + 1.0) * 0.5
+
+def octahedral_direction(u, v):
+    """Unit direction for octahedral (u, v) in [0, 1]; upper hemisphere in the centre diamond"""
+    p, q = 2.0 * u - 1.0, 2.0 * v - 1.0
+    z = 1.0 - abs(p) - abs(q)
+    if z < 0.0:
+        p, q = (1.0 - abs(q)) * (1.0 if p >= 0 else -1.0), (1.0 - abs(p)) * (1.0 if q >= 0 else -1.0)
+    return _normalize((p, q, z))
+
+def octahedral_uv(x, y, z):
+    """Inverse of octahedral_direction"""
+    n = abs(x) + abs(y) + abs(z)
+    p, q = x / n, y / n
+    if z < 0.0:
+        p, q = (1.0 - abs(q)) * (1.0 if p >= 0 else -1.0), (1.0 - abs(p)) * (1.0 if q >= 0 else -1.0)
+    return (p + 1.0) * 0.5, (q + 1.0) * 0.5
+
+def equirect_uv(x, y, z):
+    """Equirectangular (u, v) for a unit direction, matching TextureMapScene"""
+    u = (math.atan2(y, x) + math.pi) / (2.0 * math.pi)
+    v = math.acos(max(-1.0, min(1.0, z))) / math.pi
+    return u % 1.0, v
+
+def reproject_equirect(img, layout, size):
+    """Resample an equirectangular RGB image into a cubemap atlas or octahedral square.
+
+    Each output texel averages a 2x2 grid of bilinear taps from the source image.
+    Returns a new RGB image.
+    """
+    src = img.convert("RGB")
+    sw, sh = src.size
+    pixels = src.load()
+
+    def sample(u, v):
+        fx = u * sw - 0.5
+        fy = min(max(v * sh - 0.5, 0.0), sh - 1.0)
+        x0, y0 = int(math.floor(fx)), int(fy)
+        wx, wy = fx - x0, fy - y0
+        x0 %= sw
+        x1, y1 = (x0 + 1) % sw, min(y0 + 1, sh - 1)
+        out = [0.0, 0.0, 0.0]
+        for (px, py, w) in ((x0, y0, (1 - wx) * (1 - wy)), (x1, y0, wx * (1 - wy)),
+                            (x0, y1, (1 - wx) * wy), (x1, y1, wx * wy)):
+            c = pixels[px, py]
+            for k in range(3):
+                out[k] += c[k] * w
+        return out
+
+    def texel(direction_fn, i, j, n):
+        acc = [0.0, 0.0, 0.0]
+        for (ox, oy) in ((0.25, 0.25), (0.75, 0.25), (0.25, 0.75), (0.75, 0.75)):
+            d = direction_fn((i + ox) / n, (j + oy) / n)
+            c = sample(*equirect_uv(*d))
+            for k in range(3):
+                acc[k] += c[k]
+        return tuple(int(round(c / 4.0)) for c in acc)
+
+    if layout == 'cubemap':
+        out = Image.new("RGB", (size * 3, size * 2))
+        dst = out.load()
+        for face in range(6):
+            ox, oy = (face % 3) * size, (face // 3) * size
+            for j in range(size):
+                for i in range(size):
+                    dst[ox + i, oy + j] = texel(lambda s, t: cubemap_direction(face, s, t), i, j, size)
+        return out
+    if layout == 'octahedral':
+        out = Image.new("RGB", (size, size))
+        dst = out.load()
+        for j in range(size):
+            for i in range(size):
+                dst[i, j] = texel(octahedral_direction, i, j, size)
+        return out
+    raise ValueError(f"Unsupported layout for reprojection: {layout}")
+
+def generate_image_code(name, image_path, max_width, max_height, layout='equirect', layout_size=None):
     """Generate C++ struct for image data, resizing if necessary, and return code + metadata."""
     metadata = {
         "original_name": image_path.name,
@@ -109,7 +223,8 @@ def generate_image_code(name, image_path, max_width, max_height):
         "original_height": 0,
         "resized": False,
         "final_width": 0,
-        "final_height": 0
+        "final_height": 0,
+        "layout": layout
     }
     try:
         img = Image.open(image_path)
@@ -120,8 +235,15 @@ def generate_image_code(name, image_path, max_width, max_height):
         width, height = original_width, original_height
         resized = False
 
+        if layout != 'equirect':
+            # Reproject the equirectangular source into the requested layout
+            size = layout_size or DEFAULT_LAYOUT_SIZE[layout]
+            img = reproject_equirect(img, layout, size)
+            width, height = img.size
+            resized = True
+            metadata["resized"] = True
         # Check if resizing is needed
-        if width > max_width or height > max_height:
+        elif width > max_width or height > max_height:
             print(f"Info: Resizing {name} from {width}x{height} to fit within {max_width}x{max_height}...", file=sys.stderr)
             # Maintain aspect ratio
             ratio = min(max_width / width, max_height / height)
@@ -139,7 +261,7 @@ def generate_image_code(name, image_path, max_width, max_height):
         pixel_data = list(img.tobytes())
 
         # Convert name to valid C++ identifier
-        cpp_name = name.replace('-', '_').upper()
+        cpp_name = name.replace('-', '_').upper() + LAYOUT_SUFFIX[layout]
         data_array_name = f"TEXTURE_{cpp_name}_DATA"
         
         # Format data array
@@ -156,12 +278,13 @@ def generate_image_code(name, image_path, max_width, max_height):
     constexpr TextureData TEXTURE_{cpp_name} = {{
         {width}, // width
         {height}, // height
-        {data_array_name}
+        {data_array_name},
+        TextureLayout::{TEXTURE_LAYOUTS[layout]}
     }};"""
 
         # Generate comment block with metadata
         comment = f"""// Source: {metadata['original_name']} ({metadata['original_width']}x{metadata['original_height']})
-    // {'Resized to: ' + str(metadata['final_width']) + 'x' + str(metadata['final_height']) if metadata['resized'] else 'Original size used.'}"""
+    // {'Resized to: ' + str(metadata['final_width']) + 'x' + str(metadata['final_height']) if metadata['resized'] else 'Original size used.'}{'' if layout == 'equirect' else ' (' + layout + ')'}"""
 
         # Combine comment and code
         code_block = f"""
@@ -175,21 +298,26 @@ def generate_image_code(name, image_path, max_width, max_height):
         print(f"Error processing image {image_path}: {e}", file=sys.stderr)
         return None, metadata # Still return metadata even on error if possible
 
-def process_images(image_dir, max_width, max_height):
-    """Process images, generate header content with metadata."""
+def process_images(image_dir, max_width=200, max_height=100, layouts=('equirect',), layout_size=None):
+    """Process images, generate header content with metadata.
+
+    Each image is emitted once per requested layout; non-equirect layouts get a
+    _CUBE / _OCTA suffix on their symbol names.
+    """
     image_dir = Path(image_dir)
     image_blocks = [] # Store tuples of (code_block, metadata)
     supported_extensions = ['.png', '.bmp', '.gif']
     found_images = False
     
     # Process each supported image file in the immediate directory
-    for path in image_dir.glob('*'): # Only process top-level files in the dir
+    for path in sorted(image_dir.glob('*')): # Only top-level files, sorted for stable output
         if path.is_file() and path.suffix.lower() in supported_extensions:
             name = path.stem
-            image_code, metadata = generate_image_code(name, path, max_width, max_height)
-            if image_code:
-                image_blocks.append((image_code, metadata))
-                found_images = True
+            for layout in layouts:
+                image_code, metadata = generate_image_code(name, path, max_width, max_height, layout, layout_size)
+                if image_code:
+                    image_blocks.append((image_code, metadata))
+                    found_images = True
     
     if not found_images:
         return None # No images found or processed
@@ -233,11 +361,19 @@ def process_images(image_dir, max_width, max_height):
 {conditional_include}
 namespace PixelTheater {{
 
+// How texels map onto the sphere
+enum class TextureLayout : uint8_t {{
+    Equirectangular, // u = longitude, v = inclination from +Z
+    CubeMap,         // 3x2 atlas of square faces: +X -X +Y / -Y +Z -Z
+    Octahedral       // Single square, octahedron unfolded around +Z
+}};
+
 // Definition for the Texture Data structure
 struct TextureData {{
     const uint32_t width;
     const uint32_t height;
     const uint8_t* data; // Pixel data stored row by row, R, G, B order (PROGMEM)
+    const TextureLayout layout;
 }};
 
 {os.linesep.join(image_code_parts)} // Join only the code parts
@@ -255,6 +391,11 @@ def main():
     parser.add_argument('--images', help='Directory containing image files to process')
     parser.add_argument('--max-resolution', default='200x100', 
                       help='Maximum resolution WxH for images (e.g., \'200x100\')')
+    parser.add_argument('--layouts', default='equirect',
+                      help='Comma-separated texture layouts to emit: ' + ', '.join(TEXTURE_LAYOUTS))
+    parser.add_argument('--layout-size', type=int,
+                      help='Face size (cubemap) or side length (octahedral); defaults: ' +
+                           ', '.join(f'{k}={v}' for k, v in DEFAULT_LAYOUT_SIZE.items()))
     args = parser.parse_args()
     
     # Parse max resolution
@@ -273,6 +414,12 @@ def main():
             print(f"Error: Invalid --max-resolution value '{args.max_resolution}': {e}", file=sys.stderr)
             return 1
 
+    layouts = [l.strip() for l in args.layouts.split(',') if l.strip()]
+    unknown = [l for l in layouts if l not in TEXTURE_LAYOUTS]
+    if unknown or not layouts:
+        print(f"Error: Unknown texture layout(s) {unknown}. Choose from: {', '.join(TEXTURE_LAYOUTS)}", file=sys.stderr)
+        return 1
+
     # Process Palettes
     if args.palettes:
         try:
@@ -320,7 +467,7 @@ struct GradientPaletteData {{
                 print(f"Error: Image directory not found: {args.images}", file=sys.stderr)
                 return 1
                 
-            image_header_content = process_images(args.images, max_width, max_height)
+            image_header_content = process_images(args.images, max_width, max_height, layouts, args.layout_size)
             
             if image_header_content:
                 # Define output path within the image directory
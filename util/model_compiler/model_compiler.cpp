@@ -0,0 +1,711 @@
+// model_compiler: build a model from model.yaml and the PCB pick-and-place
+// file, and write it as a binary blob (model.bin) plus a thin model.h that
+// embeds the same blob. A native replacement for generate_model.py's C++
+// output: neighbours come from a k-d tree instead of comparing every pair,
+// and the header is one string literal instead of thousands of initialisers.
+//
+// Build with ./build_model_compiler.sh, then e.g.
+//   build/model_compiler -d src/models/DodecaRGBv2
+//   build/model_compiler -m model.yaml -i pcb/board.csv -o model.h -b model.bin
+
+#include "PixelTheater/limits.h"
+#include "PixelTheater/model/kd_tree.h"
+#include "PixelTheater/model/model_blob.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace PixelTheater;
+
+namespace {
+
+struct Options {
+    std::string model_dir;
+    std::string yaml;
+    std::string pcb;
+    std::string header;
+    std::string blob;
+    std::string command;
+    size_t neighbors = Limits::MAX_NEIGHBORS;
+    double max_distance = 100.0;
+    bool quiet = false;
+};
+
+void usage() {
+    std::fprintf(stderr,
+        "usage: model_compiler (-d DIR | -m YAML) [options]\n"
+        "  -d, --model-dir DIR   directory with model.yaml and pcb/*.csv or *.pos\n"
+        "  -m, --model YAML      model definition\n"
+        "  -i, --input FILE      pick-and-place file (default: from -d, or the YAML)\n"
+        "  -o, --output FILE     thin header (default: DIR/model.h)\n"
+        "  -b, --blob FILE       binary model (default: next to the header, model.bin)\n"
+        "  --neighbors N         neighbours per LED (default: %zu)\n"
+        "  --max-distance MM     ignore neighbours further than this (default: 100)\n"
+        "  -q, --quiet           no summary on stderr\n",
+        Limits::MAX_NEIGHBORS);
+}
+
+bool parse(int argc, char** argv, Options& opt) {
+    opt.command = "model_compiler";
+    for (int i = 1; i < argc; ++i) opt.command += std::string(" ") + argv[i];
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if ((arg == "-d" || arg == "--model-dir") && has_value) opt.model_dir = argv[++i];
+        else if ((arg == "-m" || arg == "--model") && has_value) opt.yaml = argv[++i];
+        else if ((arg == "-i" || arg == "--input") && has_value) opt.pcb = argv[++i];
+        else if ((arg == "-o" || arg == "--output") && has_value) opt.header = argv[++i];
+        else if ((arg == "-b" || arg == "--blob") && has_value) opt.blob = argv[++i];
+        else if (arg == "--neighbors" && has_value) opt.neighbors = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--max-distance" && has_value) opt.max_distance = std::strtod(argv[++i], nullptr);
+        else if (arg == "-q" || arg == "--quiet") opt.quiet = true;
+        else return false;
+    }
+    if (opt.model_dir.empty() == opt.yaml.empty()) return false;
+    return opt.neighbors > 0 && opt.neighbors <= Limits::MAX_NEIGHBORS && opt.max_distance > 0.0;
+}
+
+bool fail(const std::string& message) {
+    std::fprintf(stderr, "model_compiler: %s\n", message.c_str());
+    return false;
+}
+
+// --- A YAML subset: block maps and lists, flow lists, scalars, comments ---
+
+struct Yaml {
+    enum class Kind { Scalar, Map, List };
+    Kind kind = Kind::Scalar;
+    std::string value;
+    std::vector<std::pair<std::string, Yaml>> map;
+    std::vector<Yaml> list;
+
+    const Yaml* get(const std::string& key) const {
+        for (const auto& entry : map) {
+            if (entry.first == key) return &entry.second;
+        }
+        return nullptr;
+    }
+    std::string str(const std::string& key, const std::string& fallback = "") const {
+        const Yaml* node = get(key);
+        return node && node->kind == Kind::Scalar ? node->value : fallback;
+    }
+    double num(const std::string& key, double fallback = 0.0) const {
+        const Yaml* node = get(key);
+        return node && node->kind == Kind::Scalar && !node->value.empty() ? std::strtod(node->value.c_str(), nullptr)
+                                                                         : fallback;
+    }
+};
+
+struct YamlLine {
+    size_t indent;
+    std::string text;
+};
+
+std::string trim(const std::string& s) {
+    const size_t begin = s.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    const size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(begin, end - begin + 1);
+}
+
+std::string unquote(const std::string& s) {
+    if (s.size() >= 2 && (s.front() == '"' || s.front() == '\'') && s.back() == s.front()) {
+        return s.substr(1, s.size() - 2);
+    }
+    return s;
+}
+
+// Drop a trailing comment: a '#' outside quotes, at the start or after a space
+std::string stripComment(const std::string& line) {
+    char quote = 0;
+    for (size_t i = 0; i < line.size(); ++i) {
+        const char c = line[i];
+        if (quote) {
+            if (c == quote) quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '#' && (i == 0 || line[i - 1] == ' ' || line[i - 1] == '\t')) {
+            return line.substr(0, i);
+        }
+    }
+    return line;
+}
+
+Yaml scalarOrFlow(const std::string& text) {
+    Yaml node;
+    if (text.size() >= 2 && text.front() == '[' && text.back() == ']') {
+        node.kind = Yaml::Kind::List;
+        std::stringstream items(text.substr(1, text.size() - 2));
+        std::string item;
+        while (std::getline(items, item, ',')) {
+            if (trim(item).empty()) continue;
+            Yaml child;
+            child.value = unquote(trim(item));
+            node.list.push_back(child);
+        }
+        return node;
+    }
+    node.value = unquote(text);
+    return node;
+}
+
+// "key: value" -> key, value; false if the line is not a mapping entry
+bool splitKey(const std::string& text, std::string& key, std::string& value) {
+    const size_t colon = text.find(": ");
+    if (colon != std::string::npos) {
+        key = unquote(trim(text.substr(0, colon)));
+        value = trim(text.substr(colon + 2));
+        return true;
+    }
+    if (!text.empty() && text.back() == ':') {
+        key = unquote(trim(text.substr(0, text.size() - 1)));
+        value.clear();
+        return true;
+    }
+    return false;
+}
+
+bool isItem(const YamlLine& line) { return line.text == "-" || line.text.compare(0, 2, "- ") == 0; }
+
+Yaml parseBlock(std::vector<YamlLine>& lines, size_t& i, size_t indent);
+
+Yaml parseList(std::vector<YamlLine>& lines, size_t& i, size_t indent) {
+    Yaml node;
+    node.kind = Yaml::Kind::List;
+    while (i < lines.size() && lines[i].indent == indent && isItem(lines[i])) {
+        const std::string rest = lines[i].text.size() > 1 ? trim(lines[i].text.substr(2)) : "";
+        std::string key, value;
+        if (rest.empty()) {
+            ++i;
+            node.list.push_back(i < lines.size() && lines[i].indent > indent ? parseBlock(lines, i, lines[i].indent)
+                                                                              : Yaml());
+        } else if (splitKey(rest, key, value)) {
+            // "- key: value" opens a map whose first entry shares the dash's line
+            const size_t item_indent = indent + (lines[i].text.size() - rest.size());
+            lines[i] = {item_indent, rest};
+            node.list.push_back(parseBlock(lines, i, item_indent));
+        } else {
+            node.list.push_back(scalarOrFlow(rest));
+            ++i;
+        }
+    }
+    return node;
+}
+
+Yaml parseBlock(std::vector<YamlLine>& lines, size_t& i, size_t indent) {
+    if (i < lines.size() && isItem(lines[i])) return parseList(lines, i, indent);
+    Yaml node;
+    node.kind = Yaml::Kind::Map;
+    while (i < lines.size() && lines[i].indent == indent && !isItem(lines[i])) {
+        std::string key, value;
+        if (!splitKey(lines[i].text, key, value)) {
+            ++i;    // Not something this subset understands: skip it
+            continue;
+        }
+        ++i;
+        if (!value.empty()) {
+            node.map.emplace_back(key, scalarOrFlow(value));
+        } else if (i < lines.size() && (lines[i].indent > indent || (lines[i].indent == indent && isItem(lines[i])))) {
+            node.map.emplace_back(key, parseBlock(lines, i, lines[i].indent));
+        } else {
+            node.map.emplace_back(key, Yaml());
+        }
+    }
+    return node;
+}
+
+bool loadYaml(const std::string& path, Yaml& out) {
+    std::ifstream in(path);
+    if (!in) return fail("cannot read " + path);
+    std::vector<YamlLine> lines;
+    std::string raw;
+    while (std::getline(in, raw)) {
+        const std::string text = stripComment(raw);
+        if (trim(text).empty()) continue;
+        lines.push_back({text.find_first_not_of(' '), trim(text)});
+    }
+    size_t i = 0;
+    out = lines.empty() ? Yaml() : parseBlock(lines, i, lines[0].indent);
+    return true;
+}
+
+// --- Pick-and-place data ---
+
+struct PcbLed {
+    double x, y;
+    int num;
+};
+
+// Same cleanup and scaling as dodeca_core.load_pcb_points()
+constexpr double PCB_OFFSET_X = 0.2;
+constexpr double PCB_OFFSET_Y = -55.884;
+constexpr double PCB_SCALE = 5.15;
+
+std::string field(const std::string& s) { return unquote(trim(s)); }
+
+bool loadPcb(const std::string& path, const std::string& prefix, std::vector<PcbLed>& leds) {
+    std::ifstream in(path);
+    if (!in) return fail("cannot read " + path);
+    std::string line;
+    if (!std::getline(in, line)) return fail(path + " is empty");
+
+    auto split = [](const std::string& text) {
+        std::vector<std::string> fields;
+        std::stringstream ss(text);
+        std::string f;
+        while (std::getline(ss, f, '\t')) fields.push_back(field(f));
+        return fields;
+    };
+    const auto header = split(line);
+    auto column = [&](const char* name) {
+        return static_cast<size_t>(std::find(header.begin(), header.end(), name) - header.begin());
+    };
+    const size_t designator = column("Designator"), mid_x = column("Mid X"), mid_y = column("Mid Y");
+    if (designator == header.size() || mid_x == header.size() || mid_y == header.size()) {
+        return fail(path + ": needs Designator, Mid X and Mid Y columns");
+    }
+
+    size_t line_number = 1;
+    while (std::getline(in, line)) {
+        ++line_number;
+        const auto fields = split(line);
+        if (fields.size() <= std::max({designator, mid_x, mid_y})) continue;
+        const std::string& ref = fields[designator];
+        if (ref.compare(0, prefix.size(), prefix) != 0) continue;
+        char* end = nullptr;
+        const double x = std::strtod(fields[mid_x].c_str(), &end);     // "12.5mm": stops at the unit
+        const double y = std::strtod(fields[mid_y].c_str(), &end);
+        const int num = std::atoi(ref.c_str() + prefix.size()) - 1;
+        if (num < 0) return fail(path + ":" + std::to_string(line_number) + ": bad designator " + ref);
+        leds.push_back({(x + PCB_OFFSET_X) * PCB_SCALE, (y + PCB_OFFSET_Y) * PCB_SCALE, num});
+    }
+    return true;
+}
+
+// --- Dodecahedron geometry, as in dodeca_core.py and generate_model.py ---
+
+constexpr double PI = 3.14159265358979323846;
+constexpr double TWO_PI = 2.0 * PI;
+constexpr double ZV = TWO_PI / 20;      // Rotation between faces
+constexpr double RO = TWO_PI / 5;       // Rotation for pentagon points
+constexpr double XV = 1.1071;           // Angle between faces
+constexpr double RADIUS = 200;          // Base radius for pentagon faces
+constexpr int SIDE_ROTATION[12] = {0, 3, 4, 4, 4, 4, 2, 2, 2, 2, 2, 0};
+
+struct Matrix {
+    double m[4][4] = {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}};
+
+    void multiply(const double b[4][4]) {
+        double r[4][4] = {};
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                for (int k = 0; k < 4; ++k) r[i][j] += m[i][k] * b[k][j];
+        std::memcpy(m, r, sizeof(m));
+    }
+    void rotateX(double a) {
+        const double c = std::cos(a), s = std::sin(a);
+        const double r[4][4] = {{1, 0, 0, 0}, {0, c, -s, 0}, {0, s, c, 0}, {0, 0, 0, 1}};
+        multiply(r);
+    }
+    void rotateZ(double a) {
+        const double c = std::cos(a), s = std::sin(a);
+        const double r[4][4] = {{c, -s, 0, 0}, {s, c, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}};
+        multiply(r);
+    }
+    void translate(double x, double y, double z) {
+        const double t[4][4] = {{1, 0, 0, x}, {0, 1, 0, y}, {0, 0, 1, z}, {0, 0, 0, 1}};
+        multiply(t);
+    }
+    // Applied, then Y and Z negated to match Processing's coordinate system
+    void apply(double x, double y, double z, double out[3]) const {
+        for (int i = 0; i < 3; ++i) out[i] = x * m[i][0] + y * m[i][1] + z * m[i][2] + m[i][3];
+        out[1] = -out[1];
+        out[2] = -out[2];
+    }
+};
+
+Matrix faceTransform(int side) {
+    Matrix m;
+    m.rotateX(PI);
+    if (side == 0) {
+        m.rotateZ(-ZV - RO * 2);
+    } else if (side < 6) {
+        m.rotateZ(RO * side + ZV - RO);
+        m.rotateX(XV);
+    } else if (side < 11) {
+        m.rotateZ(RO * side - ZV + RO * 3);
+        m.rotateX(PI - XV);
+    } else {
+        m.rotateX(PI);
+        m.rotateZ(ZV);
+    }
+    m.translate(0, 0, RADIUS * 1.31);
+    m.rotateZ(side >= 6 && side < 11 ? ZV : -ZV);
+    m.rotateZ(RO * SIDE_ROTATION[side % 12]);
+    return m;
+}
+
+FaceType faceTypeNamed(const std::string& name, int sides) {
+    static const std::pair<const char*, FaceType> NAMES[] = {
+        {"strip", FaceType::Strip},       {"circle", FaceType::Circle},     {"triangle", FaceType::Triangle},
+        {"square", FaceType::Square},     {"pentagon", FaceType::Pentagon}, {"hexagon", FaceType::Hexagon},
+        {"septagon", FaceType::Septagon}, {"octagon", FaceType::Octagon},
+    };
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    for (const auto& entry : NAMES) {
+        if (lower == entry.first) return entry.second;
+    }
+    return sides >= 3 && sides <= 8 ? static_cast<FaceType>(sides) : FaceType::None;
+}
+
+// Values go through "%.3f" as the generated headers always did, so a model
+// compiled here is the same model the Python generator produced
+float round3(double v) {
+    char text[64];
+    std::snprintf(text, sizeof(text), "%.3f", v);
+    return std::strtof(text, nullptr);
+}
+
+// --- The model ---
+
+struct Led {
+    double pos[3];
+    int face_id;
+};
+
+struct Group {
+    uint8_t face_type;
+    std::string name;
+    std::vector<uint16_t> leds;
+};
+
+struct CompiledModel {
+    std::string name, version, description, shape, source, author;
+    std::vector<ModelBlob::FaceTypeRecord> face_types;
+    std::vector<Group> groups;
+    std::vector<std::string> face_type_names;
+    std::vector<ModelBlob::FaceRecord> faces;
+    std::vector<Led> leds;
+    std::vector<std::vector<ModelBlob::NeighborRecord>> neighbors;
+    double sphere_radius = 0.0;
+};
+
+bool buildModel(const Yaml& yaml, const std::vector<PcbLed>& pcb, CompiledModel& model) {
+    const Yaml* meta = yaml.get("model");
+    const Yaml* geometry = yaml.get("geometry");
+    const Yaml* face_types = yaml.get("face_types");
+    const Yaml* faces = yaml.get("faces");
+    if (!meta || !geometry || !face_types || !faces || faces->kind != Yaml::Kind::List) {
+        return fail("model.yaml needs model, geometry, face_types and a faces list");
+    }
+    model.name = meta->str("name");
+    model.version = meta->str("version");
+    model.description = meta->str("description");
+    model.source = meta->str("source", "Unknown");
+    model.author = meta->str("author");
+    model.shape = geometry->str("shape");
+    if (model.name.empty()) return fail("model.name is required");
+    const double edge_length = geometry->num("edge_length_mm");
+
+    std::vector<int> sides_of;
+    for (const auto& entry : face_types->map) {
+        const int sides = static_cast<int>(entry.second.num("num_sides"));
+        ModelBlob::FaceTypeRecord ft;
+        ft.type = faceTypeNamed(entry.first, sides);
+        ft.num_leds = static_cast<uint16_t>(entry.second.num("num_leds"));
+        ft.edge_length_mm = static_cast<float>(edge_length);
+        model.face_types.push_back(ft);
+        model.face_type_names.push_back(entry.first);
+        sides_of.push_back(sides);
+
+        if (const Yaml* groups = entry.second.get("groups")) {
+            for (const auto& g : groups->map) {
+                Group group{static_cast<uint8_t>(model.face_types.size() - 1), g.first, {}};
+                for (const auto& led : g.second.list) {
+                    const long index = std::strtol(led.value.c_str(), nullptr, 10);
+                    if (index < 0 || index >= ft.num_leds) {
+                        return fail("group " + g.first + ": LED " + led.value + " is not on a " + entry.first);
+                    }
+                    group.leds.push_back(static_cast<uint16_t>(index));
+                }
+                model.groups.push_back(group);
+            }
+        }
+    }
+
+    for (const auto& face_yaml : faces->list) {
+        ModelBlob::FaceRecord face;
+        const int id = static_cast<int>(face_yaml.num("id"));
+        const std::string type = face_yaml.str("type");
+        const auto found = std::find(model.face_type_names.begin(), model.face_type_names.end(), type);
+        if (found == model.face_type_names.end()) return fail("face " + std::to_string(id) + ": unknown type " + type);
+        face.id = static_cast<uint8_t>(id);
+        face.type_id = static_cast<uint8_t>(found - model.face_type_names.begin());
+        face.rotation = static_cast<uint8_t>(face_yaml.num("rotation"));
+        if (const Yaml* position = face_yaml.get("position")) {
+            face.x = static_cast<float>(position->num("x"));
+            face.y = static_cast<float>(position->num("y"));
+            face.z = static_cast<float>(position->num("z"));
+        }
+
+        const Matrix m = faceTransform(id);
+        const int sides = std::min<int>(sides_of[face.type_id], ModelBlob::MAX_VERTICES);
+        face.vertex_count = static_cast<uint8_t>(std::max(sides, 0));
+        for (int v = 0; v < sides; ++v) {
+            const double angle = v * (TWO_PI / sides);
+            double out[3];
+            m.apply(RADIUS * std::cos(angle), RADIUS * std::sin(angle), 0, out);
+            face.vertices[v] = {round3(out[0]), round3(out[1]), round3(out[2])};
+        }
+        model.faces.push_back(face);
+
+        // LED positions get one more quarter-section turn than the vertices
+        Matrix led_m = m;
+        led_m.rotateZ(PI / 10);
+        for (const auto& led : pcb) {
+            Led out;
+            led_m.apply(led.x, led.y, 0, out.pos);
+            out.face_id = id;
+            model.leds.push_back(out);
+        }
+    }
+    if (model.leds.empty()) return fail("no LEDs: check the pick-and-place file and designator prefix");
+    if (model.leds.size() > Limits::ABSOLUTE_MAX_LEDS) {
+        return fail(std::to_string(model.leds.size()) + " LEDs is over Limits::ABSOLUTE_MAX_LEDS");
+    }
+
+    double max_sq = 0.0;
+    for (const auto& led : model.leds) {
+        max_sq = std::max(max_sq, led.pos[0] * led.pos[0] + led.pos[1] * led.pos[1] + led.pos[2] * led.pos[2]);
+    }
+    model.sphere_radius = max_sq > 1e-9 ? std::sqrt(max_sq) : 0.0;
+    return true;
+}
+
+/**
+ * The k nearest LEDs within max_distance for every LED, nearest first and
+ * by index on a tie, as the pairwise search ordered them. The tree works in
+ * float and returns a few spare candidates; their distances are then
+ * recomputed in double so the order does not depend on float rounding.
+ */
+void findNeighbors(CompiledModel& model, size_t k, double max_distance) {
+    const size_t count = model.leds.size();
+    std::vector<float> xyz(count * 3);
+    for (size_t i = 0; i < count; ++i) {
+        for (int a = 0; a < 3; ++a) xyz[i * 3 + a] = static_cast<float>(model.leds[i].pos[a]);
+    }
+    KdTree tree;
+    tree.build(xyz.data(), count);
+
+    const size_t candidates = std::min(k + 4, KdTree::MAX_RESULTS);
+    KdTree::Result found[KdTree::MAX_RESULTS];
+    std::vector<std::pair<double, uint32_t>> exact;
+    model.neighbors.assign(count, {});
+    for (size_t i = 0; i < count; ++i) {
+        const size_t n = tree.nearest(xyz[i * 3], xyz[i * 3 + 1], xyz[i * 3 + 2], candidates,
+                                      static_cast<float>(max_distance * 1.0001), found, i);
+        exact.clear();
+        const double* p = model.leds[i].pos;
+        for (size_t c = 0; c < n; ++c) {
+            const double* q = model.leds[found[c].index].pos;
+            const double d = std::sqrt((p[0] - q[0]) * (p[0] - q[0]) + (p[1] - q[1]) * (p[1] - q[1]) +
+                                       (p[2] - q[2]) * (p[2] - q[2]));
+            if (d <= max_distance) exact.emplace_back(d, found[c].index);
+        }
+        std::sort(exact.begin(), exact.end());
+        if (exact.size() > k) exact.resize(k);
+        for (const auto& e : exact) {
+            model.neighbors[i].push_back({static_cast<uint16_t>(e.second), round3(e.first)});
+        }
+    }
+}
+
+std::vector<uint8_t> encode(const CompiledModel& model, size_t max_neighbors) {
+    ModelBlobWriter writer(max_neighbors);
+    writer.setMetadata(model.name, model.version, model.description, model.shape);
+    writer.setSphereRadius(round3(model.sphere_radius));
+    for (const auto& ft : model.face_types) writer.addFaceType(ft);
+    for (const auto& face : model.faces) writer.addFace(face);
+    for (const auto& g : model.groups) writer.addGroup(g.face_type, g.name, g.leds.data(), g.leds.size());
+    for (size_t i = 0; i < model.leds.size(); ++i) {
+        ModelBlob::PointRecord point;
+        point.id = static_cast<uint16_t>(i);
+        point.face_id = static_cast<uint8_t>(model.leds[i].face_id);
+        point.x = round3(model.leds[i].pos[0]);
+        point.y = round3(model.leds[i].pos[1]);
+        point.z = round3(model.leds[i].pos[2]);
+        writer.addPoint(point, model.neighbors[i].data(), model.neighbors[i].size());
+    }
+    return writer.finish();
+}
+
+// --- Output ---
+
+std::string cString(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+// The blob as adjacent string literals: printable bytes as themselves,
+// everything else as three-digit octal so a following digit cannot join
+// the escape. Compiles far faster than the same bytes as an array of ints.
+void writeBlobLiteral(std::ostream& out, const std::vector<uint8_t>& blob) {
+    constexpr size_t LINE = 100;
+    std::string line;
+    char octal[5];
+    for (size_t i = 0; i < blob.size(); ++i) {
+        const uint8_t c = blob[i];
+        if (c >= 0x20 && c < 0x7F && c != '"' && c != '\\' && c != '?') {
+            line += static_cast<char>(c);
+        } else {
+            std::snprintf(octal, sizeof(octal), "\\%03o", c);
+            line += octal;
+        }
+        if (line.size() >= LINE || i + 1 == blob.size()) {
+            out << "        \"" << line << "\"\n";
+            line.clear();
+        }
+    }
+}
+
+bool writeHeader(const std::string& path, const Options& opt, const CompiledModel& model,
+                 const std::vector<uint8_t>& blob, const std::string& date) {
+    std::ofstream out(path);
+    if (!out) return fail("cannot write " + path);
+    char radius[32];
+    std::snprintf(radius, sizeof(radius), "%.3f", model.sphere_radius);
+
+    out << "#pragma once\n"
+        << "#include \"PixelTheater/model_def.h\"\n"
+        << "#include \"PixelTheater/model/face_type.h\"\n\n"
+        << "// Generated on: " << date << "\n"
+        << "// Generated using: " << opt.command << "\n"
+        << "// Model source: " << model.source << "\n";
+    if (!model.author.empty()) out << "// Author: " << model.author << "\n";
+    out << "//\n"
+        << "// Points, faces, neighbours and LED groups are a ModelBlob (PixelTheater/model/model_blob.h),\n"
+        << "// the same bytes as model.bin. Regenerate with util/model_compiler; do not edit.\n\n"
+        << "namespace PixelTheater {\n"
+        << "namespace Models {\n\n"
+        << "// " << model.description << "\n"
+        << "struct " << model.name << " : public ModelDefinition<" << model.leds.size() << ", "
+        << model.faces.size() << "> {\n\n"
+        << "    // Required metadata\n"
+        << "    static constexpr const char* NAME = \"" << cString(model.name) << "\";\n"
+        << "    static constexpr const char* VERSION = \"" << cString(model.version) << "\";\n"
+        << "    static constexpr const char* DESCRIPTION = \"" << cString(model.description) << "\";\n"
+        << "    static constexpr const char* MODEL_TYPE = \"" << cString(model.shape) << "\";\n"
+        << "    static constexpr const char* GENERATED_DATE = \"" << date << "\";\n\n"
+        << "    static constexpr size_t LED_COUNT = " << model.leds.size() << ";\n"
+        << "    static constexpr size_t FACE_COUNT = " << model.faces.size() << ";\n"
+        << "    static constexpr float SPHERE_RADIUS = " << radius << "f;\n\n"
+        << "    // Model geometry\n"
+        << "    static constexpr size_t BLOB_SIZE = " << blob.size() << ";\n"
+        << "    static constexpr char BLOB[] =\n";
+    writeBlobLiteral(out, blob);
+    out << "        ;\n"
+        << "};\n\n"
+        << "}} // namespace PixelTheater::Models\n";
+    return static_cast<bool>(out);
+}
+
+bool writeBlob(const std::string& path, const std::vector<uint8_t>& blob) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return fail("cannot write " + path);
+    out.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+    return static_cast<bool>(out);
+}
+
+std::string directoryOf(const std::string& path) {
+    const size_t slash = path.find_last_of('/');
+    return slash == std::string::npos ? "." : path.substr(0, slash);
+}
+
+// First *.pos or *.csv in DIR/pcb, like generate_model.find_model_files()
+std::string findPickAndPlace(const std::string& model_dir) {
+    const std::string pcb_dir = model_dir + "/pcb";
+    std::vector<std::string> found;
+    if (DIR* dir = opendir(pcb_dir.c_str())) {
+        while (dirent* entry = readdir(dir)) {
+            const std::string name = entry->d_name;
+            if (name.size() > 4 && (name.compare(name.size() - 4, 4, ".pos") == 0 ||
+                                    name.compare(name.size() - 4, 4, ".csv") == 0)) {
+                found.push_back(name);
+            }
+        }
+        closedir(dir);
+    }
+    std::sort(found.begin(), found.end());
+    if (found.size() > 1) std::fprintf(stderr, "model_compiler: several pick-and-place files, using %s\n", found[0].c_str());
+    return found.empty() ? "" : pcb_dir + "/" + found[0];
+}
+
+double msSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse(argc, argv, opt)) {
+        usage();
+        return 1;
+    }
+    if (!opt.model_dir.empty()) {
+        opt.yaml = opt.model_dir + "/model.yaml";
+        if (opt.pcb.empty()) opt.pcb = findPickAndPlace(opt.model_dir);
+        if (opt.header.empty()) opt.header = opt.model_dir + "/model.h";
+    }
+    if (opt.header.empty()) opt.header = directoryOf(opt.yaml) + "/model.h";
+    if (opt.blob.empty()) opt.blob = directoryOf(opt.header) + "/model.bin";
+
+    const auto start = std::chrono::steady_clock::now();
+    Yaml yaml;
+    if (!loadYaml(opt.yaml, yaml)) return 1;
+    const Yaml* hardware = yaml.get("hardware");
+    const Yaml* pcb_config = hardware ? hardware->get("pcb") : nullptr;
+    if (opt.pcb.empty() && pcb_config) opt.pcb = pcb_config->str("pick_and_place_file");
+    if (opt.pcb.empty()) return fail("no pick-and-place file: use -i"), 1;
+    std::vector<PcbLed> pcb;
+    if (!loadPcb(opt.pcb, pcb_config ? pcb_config->str("led_designator_prefix", "LED") : "LED", pcb)) return 1;
+
+    CompiledModel model;
+    if (!buildModel(yaml, pcb, model)) return 1;
+    const double load_ms = msSince(start);
+
+    const auto neighbors_start = std::chrono::steady_clock::now();
+    findNeighbors(model, opt.neighbors, opt.max_distance);
+    const double neighbors_ms = msSince(neighbors_start);
+
+    const std::vector<uint8_t> blob = encode(model, opt.neighbors);
+    if (blob.empty()) return fail("model too large for the blob format"), 1;
+
+    char date[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+    if (!writeBlob(opt.blob, blob) || !writeHeader(opt.header, opt, model, blob, date)) return 1;
+
+    if (!opt.quiet) {
+        std::fprintf(stderr, "%s: %zu LEDs, %zu faces -> %s (%zu bytes), %s\n", model.name.c_str(),
+                     model.leds.size(), model.faces.size(), opt.blob.c_str(), blob.size(), opt.header.c_str());
+        std::fprintf(stderr, "load %.1f ms, neighbours %.1f ms, total %.1f ms\n", load_ms, neighbors_ms,
+                     msSince(start));
+    }
+    return 0;
+}
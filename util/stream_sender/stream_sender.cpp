@@ -0,0 +1,468 @@
+// stream_sender: render a scene on the host and stream its frames to a
+// StreamReceiverScene, over USB serial (or any tty, pty or pipe, or into a file) or
+// as Art-Net / E1.31 / OPC datagrams.
+//
+// Build with ./build_stream_sender.sh, then e.g.
+//   build/stream_sender --list
+//   build/stream_sender --scene 2 --device /dev/ttyACM0 --fps 60
+//   build/stream_sender --scene 2 --output frames.bin --frames 600
+//   build/stream_sender --scene 2 --udp 192.168.1.50 --protocol e131 --sync
+//   build/stream_sender --scene 2 --loopback --frames 2000 --fps 0
+//   build/stream_sender --scene 2 --loopback-udp --protocol artnet --frames 2000
+
+#include "PixelTheater/theater.h"
+#include "PixelTheater/stream/fd_byte_stream.h"
+#include "PixelTheater/stream/frame_codec.h"
+#include "PixelTheater/stream/network_ingest.h"
+#include "PixelTheater/stream/udp_transport.h"
+#include "models/DodecaRGBv2/model.h"
+#include "benchmark.h"
+#include "scenes/test_scene/test_scene.h"
+#include "scenes/blobs/blob_scene.h"
+#include "scenes/wandering_particles/wandering_particles_scene.h"
+#include "scenes/xyz_scanner/xyz_scanner_scene.h"
+#include "scenes/boids/boids_scene.h"
+#include "scenes/orientation_grid/orientation_grid_scene.h"
+#include "scenes/texture_map/texture_map_scene.h"
+#include "scenes/geography/geography_scene.h"
+#include "scenes/sparkles/sparkles_scene.h"
+#include "scenes/satellites/SatellitesScene.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace PixelTheater;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t NUM_LEDS = 1248;
+
+enum class NetProtocol { ArtNet, E131, Opc };
+
+struct Options {
+    int scene = 0;
+    const char* device = nullptr;
+    const char* output = nullptr;       // File to create, instead of a device
+    std::string udp_host;
+    uint16_t udp_port = 0;              // 0 = protocol default
+    NetProtocol protocol = NetProtocol::E131;
+    bool sync = false;
+    float fps = 60.0f;                  // 0 = as fast as possible
+    long frames = 0;                    // 0 = until interrupted
+    uint16_t keyframe = 30;
+    FrameEncoder::Mode mode = FrameEncoder::Mode::Auto;
+    bool loopback = false;
+    bool loopback_udp = false;
+    bool list = false;
+};
+
+void usage() {
+    std::fprintf(stderr,
+        "usage: stream_sender [--list] [--scene N] OUTPUT [--fps F] [--frames N]\n"
+        "OUTPUT is one of:\n"
+        "  --device PATH            framed serial stream to an existing serial port, pty or pipe ('-' for stdout)\n"
+        "  --output FILE            framed serial stream saved to FILE (created or truncated)\n"
+        "      [--mode auto|raw|rle|delta] [--keyframe N]\n"
+        "  --udp HOST[:PORT]        datagrams to a network receiver\n"
+        "      [--protocol artnet|e131|opc] [--sync]\n"
+        "  --loopback               serial stream through a local pty, reports latency and throughput\n"
+        "  --loopback-udp           datagrams through 127.0.0.1, reports latency and per-packet cost\n"
+        "  --fps F                  frame rate, 0 for as fast as possible (default 60)\n");
+}
+
+bool parse(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--list") opt.list = true;
+        else if (arg == "--loopback") opt.loopback = true;
+        else if (arg == "--loopback-udp") opt.loopback_udp = true;
+        else if (arg == "--sync") opt.sync = true;
+        else if (arg == "--scene" && has_value) opt.scene = std::atoi(argv[++i]);
+        else if (arg == "--device" && has_value) opt.device = argv[++i];
+        else if (arg == "--output" && has_value) opt.output = argv[++i];
+        else if (arg == "--fps" && has_value) opt.fps = std::max(0.0f, static_cast<float>(std::atof(argv[++i])));
+        else if (arg == "--frames" && has_value) opt.frames = std::atol(argv[++i]);
+        else if (arg == "--keyframe" && has_value) opt.keyframe = static_cast<uint16_t>(std::max(1, std::atoi(argv[++i])));
+        else if (arg == "--udp" && has_value) {
+            opt.udp_host = argv[++i];
+            const size_t colon = opt.udp_host.find(':');
+            if (colon != std::string::npos) {
+                opt.udp_port = static_cast<uint16_t>(std::atoi(opt.udp_host.c_str() + colon + 1));
+                opt.udp_host.resize(colon);
+            }
+        } else if (arg == "--protocol" && has_value) {
+            const std::string p = argv[++i];
+            if (p == "artnet") opt.protocol = NetProtocol::ArtNet;
+            else if (p == "e131") opt.protocol = NetProtocol::E131;
+            else if (p == "opc") opt.protocol = NetProtocol::Opc;
+            else return false;
+        } else if (arg == "--mode" && has_value) {
+            const std::string m = argv[++i];
+            if (m == "auto") opt.mode = FrameEncoder::Mode::Auto;
+            else if (m == "raw") opt.mode = FrameEncoder::Mode::Raw;
+            else if (m == "rle") opt.mode = FrameEncoder::Mode::Rle;
+            else if (m == "delta") opt.mode = FrameEncoder::Mode::Delta;
+            else return false;
+        } else {
+            return false;
+        }
+    }
+    return opt.list || opt.loopback || opt.loopback_udp || opt.device || opt.output || !opt.udp_host.empty();
+}
+
+uint16_t frameChecksum(const CRGB* leds, size_t count) {
+    static_assert(sizeof(CRGB) == 3, "CRGB must be packed for frameChecksum");
+    return FrameStream::crc16(reinterpret_cast<const uint8_t*>(leds), count * 3);
+}
+
+double microsSince(Clock::time_point t) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - t).count();
+}
+
+// --- Outputs ---
+
+class FrameSink {
+public:
+    virtual ~FrameSink() = default;
+    // Bytes sent, 0 on failure
+    virtual size_t send(const CRGB* leds, size_t count) = 0;
+    virtual void report(long frames) const = 0;
+};
+
+class SerialSink : public FrameSink {
+public:
+    SerialSink(ByteStream& out, const Options& opt) : _out(out), _encoder(NUM_LEDS, opt.keyframe), _mode(opt.mode) {}
+
+    size_t send(const CRGB* leds, size_t count) override {
+        const auto t0 = Clock::now();
+        const size_t len = _encoder.encode(leds, count, _mode);
+        _encode_us += microsSince(t0);
+        ++_types[static_cast<int>(_encoder.lastType())];
+        return _out.write(_encoder.data(), len) == len ? len : 0;
+    }
+
+    void report(long frames) const override {
+        std::fprintf(stderr, "Frame types: %ld raw, %ld rle, %ld delta; encode %.1f us/frame (raw frame %zu bytes)\n",
+                     _types[0], _types[1], _types[2], frames ? _encode_us / frames : 0.0,
+                     FrameStream::HEADER_SIZE + NUM_LEDS * 3 + FrameStream::CRC_SIZE);
+    }
+
+private:
+    ByteStream& _out;
+    FrameEncoder _encoder;
+    FrameEncoder::Mode _mode;
+    long _types[3] = {0, 0, 0};
+    double _encode_us = 0.0;
+};
+
+class NetworkSink : public FrameSink {
+public:
+    NetworkSink(PacketTransport& out, NetProtocol protocol, bool sync)
+        : _out(out), _protocol(protocol), _sync(sync),
+          _packet(std::max(E131::MAX_PACKET, Opc::HEADER_SIZE + NUM_LEDS * 3)) {}
+
+    size_t send(const CRGB* leds, size_t count) override {
+        size_t bytes = 0;
+        if (_protocol == NetProtocol::Opc) {
+            return sendPacket(Opc::buildSetPixels(_packet.data(), 0, leds, count));
+        }
+
+        // Same layout NetworkIngest expects: 170 LEDs per universe from the first one
+        const NetworkIngest::Config config;
+        const uint8_t* bytes_in = reinterpret_cast<const uint8_t*>(leds);
+        _seq = static_cast<uint8_t>(_seq == 255 ? 1 : _seq + 1);   // Art-Net reserves 0
+        for (size_t first = 0, u = 0; first < count; first += config.leds_per_universe, ++u) {
+            const size_t slots = std::min<size_t>(config.leds_per_universe, count - first) * 3;
+            size_t len;
+            if (_protocol == NetProtocol::ArtNet) {
+                len = ArtNet::buildDmx(_packet.data(), static_cast<uint16_t>(config.artnet_universe + u), _seq,
+                                       bytes_in + first * 3, slots);
+            } else {
+                len = E131::buildData(_packet.data(), static_cast<uint16_t>(config.e131_universe + u), _seq,
+                                      _sync ? SYNC_UNIVERSE : 0, bytes_in + first * 3, slots);
+            }
+            if (sendPacket(len) == 0) return 0;
+            bytes += len;
+        }
+        if (_sync) {
+            const size_t len = _protocol == NetProtocol::ArtNet ? ArtNet::buildSync(_packet.data())
+                                                               : E131::buildSync(_packet.data(), _seq, SYNC_UNIVERSE);
+            if (sendPacket(len) == 0) return 0;
+            bytes += len;
+        }
+        return bytes;
+    }
+
+    void report(long frames) const override {
+        std::fprintf(stderr, "%ld packets (%.1f per frame)\n", _packets, frames ? double(_packets) / frames : 0.0);
+    }
+
+private:
+    static constexpr uint16_t SYNC_UNIVERSE = 7000;
+
+    size_t sendPacket(size_t len) {
+        ++_packets;
+        return _out.send(_packet.data(), len);
+    }
+
+    PacketTransport& _out;
+    NetProtocol _protocol;
+    bool _sync;
+    std::vector<uint8_t> _packet;
+    uint8_t _seq = 0;
+    long _packets = 0;
+};
+
+// --- Loopback receivers: decode on a second thread and check each frame ---
+
+struct Loopback {
+    Loopback() : sent_at(65536), sent_crc(65536) {}
+
+    // frame_number counts from 1 on both ends; only the newest frame of a batch is checked, as on the device
+    void check(uint32_t frame_number, const CRGB* frame, size_t count, size_t frames) {
+        const uint16_t slot = static_cast<uint16_t>(frame_number);
+        const double us = microsSince(sent_at[slot]);
+        latency_sum += us;
+        latency_max = std::max(latency_max, us);
+        ++latency_samples;
+        if (frameChecksum(frame, count) != sent_crc[slot]) ++mismatches;
+        received.fetch_add(static_cast<long>(frames));
+    }
+
+    void sent(uint32_t frame_number, const CRGB* leds) {
+        const uint16_t slot = static_cast<uint16_t>(frame_number);
+        sent_crc[slot] = frameChecksum(leds, NUM_LEDS);
+        sent_at[slot] = Clock::now();
+    }
+
+    std::vector<Clock::time_point> sent_at;
+    std::vector<uint16_t> sent_crc;
+    std::atomic<bool> stop{false};
+    std::atomic<long> received{0};
+    double latency_sum = 0.0;
+    double latency_max = 0.0;
+    long latency_samples = 0;
+    long mismatches = 0;
+    std::string errors;
+    std::string extra;
+};
+
+void receiveSerial(FdByteStream& stream, Loopback& loop) {
+    FrameDecoder decoder(NUM_LEDS);
+    uint8_t chunk[4096];
+    while (!loop.stop.load()) {
+        if (!stream.waitReadable(20)) continue;
+        const size_t n = stream.read(chunk, sizeof(chunk));
+        const size_t frames = n > 0 ? decoder.feed(chunk, n) : 0;
+        if (frames > 0) loop.check(decoder.sequence(), decoder.frame(), decoder.ledCount(), frames);
+    }
+    const auto& s = decoder.stats();
+    char buf[128];
+    snprintf(buf, sizeof(buf), "crc %u fmt %u base %u", s.checksum_errors, s.format_errors, s.missing_base);
+    loop.errors = buf;
+}
+
+void receiveUdp(UdpTransport& transport, Loopback& loop) {
+    NetworkIngest ingest(NUM_LEDS);
+    std::vector<uint8_t> packet(ingest.maxPacket());
+    double handle_us = 0.0;
+    while (!loop.stop.load()) {
+        if (!transport.waitReadable(20)) continue;
+        size_t len;
+        while ((len = transport.receive(packet.data(), packet.size())) > 0) {
+            const uint32_t before = ingest.frameCount();
+            const auto t0 = Clock::now();
+            ingest.handlePacket(packet.data(), len);
+            handle_us += microsSince(t0);
+            if (ingest.frameCount() != before) {
+                loop.check(ingest.frameCount(), ingest.frame(), ingest.ledCount(), ingest.frameCount() - before);
+            }
+        }
+    }
+    const auto& s = ingest.stats();
+    char buf[160];
+    snprintf(buf, sizeof(buf), "ignored %u malformed %u out-of-order %u", s.ignored, s.malformed, s.out_of_order);
+    loop.errors = buf;
+    snprintf(buf, sizeof(buf), "%u packets, %.2f us/packet to parse%s", s.packets,
+             s.packets ? handle_us / s.packets : 0.0, ingest.syncMode() ? ", synced" : "");
+    loop.extra = buf;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse(argc, argv, opt)) {
+        usage();
+        return 1;
+    }
+
+    Theater theater;
+    theater.useNativePlatform<Models::DodecaRGBv2>(NUM_LEDS);
+    theater.addScene<Scenes::OrientationGridScene>();
+    theater.addScene<Scenes::TestScene>();
+    theater.addScene<Scenes::BlobScene>();
+    theater.addScene<Scenes::WanderingParticlesScene>();
+    theater.addScene<Scenes::XYZScannerScene>();
+    theater.addScene<Scenes::BoidsScene>();
+    theater.addScene<Scenes::TextureMapScene>();
+    theater.addScene<Scenes::GeographyScene>();
+    theater.addScene<Scenes::SparklesScene>();
+    theater.addScene<Scenes::SatellitesScene>();
+    theater.start();
+
+    if (opt.list) {
+        // Scenes name themselves in setup(), which runs when they are selected
+        for (size_t i = 0; i < theater.sceneCount(); ++i) {
+            theater.setScene(i);
+            std::printf("%2zu  %s\n", i, theater.scene(i).name().c_str());
+        }
+        return 0;
+    }
+    if (opt.scene < 0 || !theater.setScene(static_cast<size_t>(opt.scene))) {
+        std::fprintf(stderr, "No scene %d (see --list)\n", opt.scene);
+        return 1;
+    }
+
+    // Set up the output, plus the receiving end for the loopback modes
+    std::unique_ptr<FdByteStream> stream;
+    std::unique_ptr<FdByteStream> stream_rx;
+    UdpTransport udp;
+    UdpTransport udp_rx;
+    std::unique_ptr<FrameSink> sink;
+    Loopback loop;
+    std::thread receiver;
+    std::string target;
+
+    if (opt.loopback) {
+        const int master = posix_openpt(O_RDWR | O_NOCTTY);
+        if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+            std::perror("posix_openpt");
+            return 1;
+        }
+        const int slave = ::open(ptsname(master), O_RDWR | O_NOCTTY);
+        if (slave < 0) {
+            std::perror("open pty");
+            return 1;
+        }
+        FdByteStream::makeRaw(master);
+        FdByteStream::makeRaw(slave);
+        stream.reset(new FdByteStream(master, true));
+        stream_rx.reset(new FdByteStream(slave, true));
+        receiver = std::thread([&] { receiveSerial(*stream_rx, loop); });
+        target = "local pty";
+    } else if (opt.loopback_udp) {
+        if (!udp_rx.bind(0, "127.0.0.1") || !udp.setRemote("127.0.0.1", udp_rx.localPort())) {
+            std::perror("udp loopback");
+            return 1;
+        }
+        receiver = std::thread([&] { receiveUdp(udp_rx, loop); });
+        target = "127.0.0.1:" + std::to_string(udp_rx.localPort());
+    } else if (!opt.udp_host.empty()) {
+        const uint16_t port = opt.udp_port ? opt.udp_port
+            : opt.protocol == NetProtocol::ArtNet ? ArtNet::PORT
+            : opt.protocol == NetProtocol::E131 ? E131::PORT : Opc::PORT;
+        if (!udp.setRemote(opt.udp_host.c_str(), port)) {
+            std::fprintf(stderr, "Bad address %s (IPv4 expected)\n", opt.udp_host.c_str());
+            return 1;
+        }
+        target = opt.udp_host + ":" + std::to_string(port);
+    } else if (opt.output) {
+        stream = FdByteStream::create(opt.output);
+        if (!stream) {
+            std::perror(opt.output);
+            return 1;
+        }
+        target = opt.output;
+    } else if (std::strcmp(opt.device, "-") == 0) {
+        stream.reset(new FdByteStream(STDOUT_FILENO));
+        target = "stdout";
+    } else {
+        stream = FdByteStream::open(opt.device);
+        if (!stream) {
+            std::perror(opt.device);
+            return 1;
+        }
+        target = opt.device;
+    }
+    if (stream) sink.reset(new SerialSink(*stream, opt));
+    else sink.reset(new NetworkSink(udp, opt.protocol, opt.sync));
+    const bool checking = opt.loopback || opt.loopback_udp;
+
+    std::fprintf(stderr, "Streaming '%s' (%zu LEDs) to %s\n", theater.currentScene()->name().c_str(),
+                 NUM_LEDS, target.c_str());
+
+    const CRGB* leds = theater.platform()->getLEDs();
+    const auto period = opt.fps > 0.0f ? std::chrono::duration<double>(1.0 / opt.fps) : std::chrono::duration<double>(0);
+    const auto start = Clock::now();
+    auto next = start;
+    auto report = start + std::chrono::seconds(1);
+    long sent = 0;
+    size_t bytes = 0, report_bytes = 0;
+    long report_frames = 0;
+
+    while (opt.frames == 0 || sent < opt.frames) {
+        theater.update();
+
+        if (checking) loop.sent(static_cast<uint32_t>(sent + 1), leds);
+        const size_t len = sink->send(leds, NUM_LEDS);
+        if (len == 0) {
+            std::fprintf(stderr, "Send failed after %ld frames\n", sent);
+            break;
+        }
+        ++sent;
+        ++report_frames;
+        bytes += len;
+        report_bytes += len;
+
+        const auto now = Clock::now();
+        if (now >= report) {
+            std::fprintf(stderr, "%ld fps, %.0f bytes/frame, %.1f KB/s\n", report_frames,
+                         report_frames ? static_cast<double>(report_bytes) / report_frames : 0.0,
+                         report_bytes / 1024.0);
+            report_frames = 0;
+            report_bytes = 0;
+            report += std::chrono::seconds(1);
+        }
+        if (opt.fps > 0.0f) {
+            next += std::chrono::duration_cast<Clock::duration>(period);
+            std::this_thread::sleep_until(next);
+        } else if (opt.loopback_udp) {
+            // Don't outrun the receiver's socket buffer
+            while (loop.received.load() + 4 < sent && microsSince(now) < 100000.0) std::this_thread::yield();
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::fprintf(stderr, "Sent %ld frames, %zu bytes (%.0f bytes/frame) in %.2f s: %.1f fps, %.2f MB/s\n",
+                 sent, bytes, sent ? static_cast<double>(bytes) / sent : 0.0, seconds,
+                 sent / seconds, bytes / seconds / (1024.0 * 1024.0));
+    sink->report(sent);
+
+    if (!checking) return 0;
+
+    // Let the last frames drain through
+    const auto deadline = Clock::now() + std::chrono::seconds(2);
+    while (loop.received.load() < sent && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    loop.stop.store(true);
+    receiver.join();
+    const long got = loop.received.load();
+    std::fprintf(stderr, "Loopback: %ld/%ld frames received, %ld mismatched, latency avg %.1f us max %.1f us; %s\n",
+                 got, sent, loop.mismatches, loop.latency_samples ? loop.latency_sum / loop.latency_samples : 0.0,
+                 loop.latency_max, loop.errors.c_str());
+    if (!loop.extra.empty()) std::fprintf(stderr, "Receiver: %s\n", loop.extra.c_str());
+    return (got == sent && loop.mismatches == 0) ? 0 : 2;
+}
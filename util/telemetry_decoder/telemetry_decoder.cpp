@@ -0,0 +1,150 @@
+// telemetry_decoder: read the firmware's binary telemetry (frame-time
+// histograms, profiler zones, temperature, power, scene, parameters and
+// scene status)
+// from a serial port, capture file or stdin, and print it as CSV or JSON.
+//
+// Build with ./build_telemetry_decoder.sh, then e.g.
+//   build/telemetry_decoder /dev/ttyACM0
+//   build/telemetry_decoder --format json --text /dev/ttyACM0
+//   cat capture.bin | build/telemetry_decoder --format csv > telemetry.csv
+
+#include "PixelTheater/stream/fd_byte_stream.h"
+#include "PixelTheater/stream/telemetry.h"
+
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <unistd.h>
+
+using namespace PixelTheater;
+
+namespace {
+
+enum class Format { Csv, Json };
+
+struct Options {
+    Format format = Format::Csv;
+    const char* input = "-";
+    bool text = false;          // Copy text between packets (boot messages, logs) to stderr
+};
+
+volatile std::sig_atomic_t stop = 0;
+
+void usage() {
+    std::fprintf(stderr,
+        "usage: telemetry_decoder [--format csv|json] [--text] [INPUT]\n"
+        "  INPUT              serial port, capture file or '-' for stdin (default)\n"
+        "  --format csv       one row per value: millis,seq,type,key,value (default)\n"
+        "  --format json      one object per packet, one packet per line\n"
+        "  --text             copy the text between packets to stderr\n");
+}
+
+bool parse(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--format") == 0 && i + 1 < argc) {
+            const char* value = argv[++i];
+            if (std::strcmp(value, "csv") == 0) opt.format = Format::Csv;
+            else if (std::strcmp(value, "json") == 0) opt.format = Format::Json;
+            else return false;
+        } else if (std::strcmp(arg, "--text") == 0) {
+            opt.text = true;
+        } else if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0) {
+            return false;
+        } else if (arg[0] != '-' || std::strcmp(arg, "-") == 0) {
+            opt.input = arg;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A Status packet's text is the scene status; every other text is a name
+const char* textKey(const TelemetryDecoder::Packet& packet) {
+    return packet.type == Telemetry::Type::Status ? "status" : "name";
+}
+
+// Quoted for both CSV and JSON: names are short and printable, but be safe
+std::string quoted(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20) out += c;
+    }
+    return out + "\"";
+}
+
+void printCsv(const TelemetryDecoder::Packet& packet) {
+    const char* type = Telemetry::typeName(packet.type);
+    if (!packet.text.empty()) {
+        std::printf("%u,%u,%s,%s,%s\n", packet.millis, packet.seq, type, textKey(packet),
+                    quoted(packet.text).c_str());
+    }
+    for (const auto& field : packet.fields) {
+        std::printf("%u,%u,%s,%s,%.6g\n", packet.millis, packet.seq, type, field.key.c_str(), field.value);
+    }
+}
+
+void printJson(const TelemetryDecoder::Packet& packet) {
+    std::printf("{\"millis\":%u,\"seq\":%u,\"type\":\"%s\"", packet.millis, packet.seq,
+                Telemetry::typeName(packet.type));
+    if (!packet.text.empty()) std::printf(",\"%s\":%s", textKey(packet), quoted(packet.text).c_str());
+    for (const auto& field : packet.fields) {
+        std::printf(",%s:%.6g", quoted(field.key).c_str(), field.value);
+    }
+    std::printf("}\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse(argc, argv, opt)) {
+        usage();
+        return 1;
+    }
+
+    std::unique_ptr<FdByteStream> input;
+    if (std::strcmp(opt.input, "-") == 0) {
+        input.reset(new FdByteStream(STDIN_FILENO));
+    } else {
+        const int fd = ::open(opt.input, O_RDONLY | O_NOCTTY);
+        if (fd < 0) {
+            std::perror(opt.input);
+            return 1;
+        }
+        FdByteStream::makeRaw(fd);
+        input.reset(new FdByteStream(fd, true));
+    }
+    std::signal(SIGINT, [](int) { stop = 1; });
+
+    if (opt.format == Format::Csv) std::printf("millis,seq,type,key,value\n");
+
+    TelemetryDecoder decoder;
+    TelemetryDecoder::Packet packet;
+    uint8_t buffer[4096];
+    while (!stop) {
+        if (!input->waitReadable(200)) continue;
+        // Readable but nothing read: end of file, or the device went away
+        const ssize_t n = ::read(input->fd(), buffer, sizeof(buffer));
+        if (n <= 0) break;
+        decoder.feed(buffer, static_cast<size_t>(n));
+
+        while (decoder.next(packet)) {
+            if (opt.format == Format::Csv) printCsv(packet);
+            else printJson(packet);
+        }
+        const std::string text = decoder.takeText();
+        if (opt.text && !text.empty()) std::fwrite(text.data(), 1, text.size(), stderr);
+        std::fflush(stdout);
+    }
+
+    const auto& stats = decoder.stats();
+    std::fprintf(stderr, "%u packets, %u lost, %u checksum errors, %u other bytes\n",
+                 stats.packets, stats.lost, stats.checksum_errors, stats.other_bytes);
+    return 0;
+}
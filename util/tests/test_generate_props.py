@@ -2,7 +2,10 @@ import unittest
 import json
 import tempfile
 from pathlib import Path
+import math
 from util.generate_props import validate_palette, generate_palette_code
+from util.generate_props import (cubemap_direction, cubemap_face_uv,
+                                 octahedral_direction, octahedral_uv, equirect_uv)
 
 class TestPaletteGeneration(unittest.TestCase):
     def test_validate_palette(self):
@@ -62,4 +65,54 @@ class TestPaletteGeneration(unittest.TestCase):
         self.assertIn("constexpr GradientPaletteData PALETTE_OCEAN_BLUE", code)
         self.assertIn("8", code) # Check size is present        
         self.assertIn("0, 0, 0, 128", code)
-        self.assertIn("255, 0, 0, 128", code) 
\ No newline at end of file
+        self.assertIn("255, 0, 0, 128", code)
+
+
+class TestTextureLayouts(unittest.TestCase):
+    def _directions(self):
+        """A spread of unit directions, including axes and octant diagonals"""
+        dirs = [(1, 0, 0), (-1, 0, 0), (0, 1, 0), (0, -1, 0), (0, 0, 1), (0, 0, -1)]
+        for i in range(7):
+            for j in range(13):
+                phi = (i + 0.5) / 7 * math.pi
+                theta = j / 13 * 2 * math.pi
+                dirs.append((math.sin(phi) * math.cos(theta), math.sin(phi) * math.sin(theta), math.cos(phi)))
+        return dirs
+
+    def assertDirectionAlmostEqual(self, a, b):
+        for x, y in zip(a, b):
+            self.assertAlmostEqual(x, y, places=6)
+
+    def test_cubemap_round_trip(self):
+        """Cube map face/uv projection inverts cubemap_direction"""
+        for d in self._directions():
+            face, s, t = cubemap_face_uv(*d)
+            self.assertTrue(0 <= face < 6)
+            self.assertTrue(0.0 <= s <= 1.0 and 0.0 <= t <= 1.0)
+            self.assertDirectionAlmostEqual(cubemap_direction(face, s, t), d)
+
+    def test_cubemap_face_order(self):
+        """Faces are ordered +X, -X, +Y, -Y, +Z, -Z"""
+        self.assertEqual(cubemap_face_uv(1, 0, 0)[0], 0)
+        self.assertEqual(cubemap_face_uv(-1, 0, 0)[0], 1)
+        self.assertEqual(cubemap_face_uv(0, 1, 0)[0], 2)
+        self.assertEqual(cubemap_face_uv(0, -1, 0)[0], 3)
+        self.assertEqual(cubemap_face_uv(0, 0, 1)[0], 4)
+        self.assertEqual(cubemap_face_uv(0, 0, -1)[0], 5)
+
+    def test_octahedral_round_trip(self):
+        """Octahedral projection inverts octahedral_direction"""
+        for d in self._directions():
+            u, v = octahedral_uv(*d)
+            self.assertTrue(0.0 <= u <= 1.0 and 0.0 <= v <= 1.0)
+            self.assertDirectionAlmostEqual(octahedral_direction(u, v), d)
+        # +Z maps to the centre of the square
+        self.assertEqual(octahedral_uv(0, 0, 1), (0.5, 0.5))
+
+    def test_equirect_uv(self):
+        """Equirectangular uv matches TextureMapScene (v = 0 at +Z)"""
+        u, v = equirect_uv(0, 0, 1)
+        self.assertAlmostEqual(v, 0.0)
+        u, v = equirect_uv(-1, 0, 0)
+        self.assertAlmostEqual(v, 0.5)
+        self.assertTrue(u < 1e-6 or u > 1 - 1e-6)